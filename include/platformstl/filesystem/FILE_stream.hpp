@@ -4,11 +4,11 @@
  * Purpose:     Facade for the standard C Streams API.
  *
  * Created:     31st May 2009
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2009-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_MAJOR       2
-# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_MINOR       1
-# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_REVISION    4
-# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_EDIT        24
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_MINOR       2
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_REVISION    1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM_EDIT        25
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -215,17 +215,47 @@ public: // Operations
     /// Writes the given string and the end-of-line character
     /// <code>'\n'</code> to the underlying file stream.
     ///
-    /// \note The line is combined with the end-of-line character before
-    ///   passing to the underlying <code>fwrite()</code> operation. In
-    ///   cases where <code>fwrite()</code> is implemented to write
-    ///   atomically to the underlying file, the line and character will be
-    ///   written in a single operation.
+    /// \note The line and the end-of-line character are written while
+    ///   holding the stream's lock, so they are not interleaved with
+    ///   writes to the same stream from other threads. (The line is not
+    ///   copied in order to append the end-of-line character.)
     template <typename S>
     class_type& write_line(S const& line)
     {
         return write_line_(STLSOFT_NS_QUAL(c_str_data)(line), STLSOFT_NS_QUAL(c_str_len)(line));
     }
 
+    /// Writes each string in the range <code>[from, to)</code>, each
+    /// followed by the end-of-line character <code>'\n'</code>, to the
+    /// underlying file stream.
+    ///
+    /// \note The stream's lock is acquired once for the whole batch, so the
+    ///   lines are written contiguously, and the per-line cost is that of
+    ///   the copy into the stream's buffer.
+    template <typename II>
+    class_type& write_lines(II from, II to)
+    {
+        stream_lock_ lock(m_ref->handle);
+
+        for (; from != to; ++from)
+        {
+            write_line_unlocked_(STLSOFT_NS_QUAL(c_str_data)(*from), STLSOFT_NS_QUAL(c_str_len)(*from));
+        }
+
+        return *this;
+    }
+
+    /// Writes each string in the given collection, each followed by the
+    /// end-of-line character <code>'\n'</code>, to the underlying file
+    /// stream.
+    ///
+    /// \see write_lines(II, II)
+    template <typename C>
+    class_type& write_lines(C const& lines)
+    {
+        return write_lines(lines.begin(), lines.end());
+    }
+
     /// Writes an empty line to the underlying stream.
     class_type& write_line()
     {
@@ -445,40 +475,95 @@ private: // Implementation
     }
 #endif /* compiler */
 
+    // Holds the lock of a file stream for the duration of a compound
+    // write. The stream's own operations take the lock recursively
+    class stream_lock_
+    {
+    public:
+        explicit stream_lock_(FILE* h)
+            : m_h(h)
+        {
+#if 0
+#elif defined(PLATFORMSTL_OS_IS_UNIX)
+
+            ::flockfile(m_h);
+#elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+      _MSC_VER >= 1400
+
+            ::_lock_file(m_h);
+#endif
+        }
+        ~stream_lock_() STLSOFT_NOEXCEPT
+        {
+#if 0
+#elif defined(PLATFORMSTL_OS_IS_UNIX)
+
+            ::funlockfile(m_h);
+#elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+      _MSC_VER >= 1400
+
+            ::_unlock_file(m_h);
+#endif
+        }
+    private:
+        FILE* const m_h;
+    private:
+        stream_lock_(stream_lock_ const&);
+        void operator =(stream_lock_ const&);
+    };
+
+    template <ss_typename_param_k C>
     class_type&
     write_line_(
-        char const* s
+        C const*    s
     ,   size_type   len
     )
     {
-        STLSOFT_NS_QUAL(auto_buffer)<char>  buff(2u + len);
+        stream_lock_ lock(m_ref->handle);
 
+        return write_line_unlocked_(s, len);
+    }
+
+    class_type&
+    write_line_unlocked_(
+        char const* s
+    ,   size_type   len
+    )
+    {
         if (0 != len)
         {
-            STLSOFT_API_INTERNAL_memfns_memcpy(&buff[0], s, sizeof(*s) * len);
+            write_bytes_(s, len);
+        }
+
+        if (EOF == ::putc('\n', m_ref->handle))
+        {
+            int const e = errno;
+
+            report_nonnormative_("failed to write multibyte string to file", e);
         }
-        buff[len + 0] = '\n';
-        buff[len + 1] = '\0';
 
-        return write_text_(buff.data(), 1u + len);
+        return *this;
     }
 
     class_type&
-    write_line_(
+    write_line_unlocked_(
         wchar_t const*  s
     ,   size_type       len
     )
     {
-        STLSOFT_NS_QUAL(auto_buffer)<wchar_t>  buff(2u + len);
-
         if (0 != len)
         {
-            STLSOFT_API_INTERNAL_memfns_memcpy(&buff[0], s, sizeof(*s) * len);
+            write_text_(s, len);
+        }
+
+        if (WEOF == ::fputwc(L'\n', m_ref->handle))
+        {
+            int const e = errno;
+
+            report_nonnormative_("failed to write wide string to file", e);
         }
-        buff[len + 0] = '\n';
-        buff[len + 1] = '\0';
 
-        return write_text_(buff.data(), 1u + len);
+        return *this;
     }
 
     class_type&
@@ -535,15 +620,18 @@ private: // Implementation
     ,   size_type       cch
     )
     {
-        wchar_t         fmt_[20 + 3 + 1];
+        // "%ls" (rather than "%s") is the portable conversion for a wide
+        // string argument to the wide formatting functions
+        wchar_t         fmt_[20 + 4 + 1];
         size_t          n;
-        wchar_t const*  fmt =   stlsoft::integer_to_decimal_string(&fmt_[0], STLSOFT_NUM_ELEMENTS(fmt_) - 1, cch, &n);
+        wchar_t const*  fmt =   stlsoft::integer_to_decimal_string(&fmt_[0], STLSOFT_NUM_ELEMENTS(fmt_) - 2, cch, &n);
 
+        fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - 3] = 'l';
         fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - 2] = 's';
         fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - 1] = '\0';
 
-        fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - (2 + n + 1)] = '.';
-        fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - (2 + n + 2)] = '%';
+        fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - (3 + n + 1)] = '.';
+        fmt_[STLSOFT_NUM_ELEMENTS(fmt_) - (3 + n + 2)] = '%';
 
         fmt -= 2;
 
@@ -0,0 +1,884 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        platformstl/filesystem/async_FILE_sink.hpp
+ *
+ * Purpose:     Asynchronous, double-buffered sink for FILE_stream.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file platformstl/filesystem/async_FILE_sink.hpp
+ *
+ * \brief [C++] Definition of the platformstl::async_FILE_sink class
+ *   (\ref group__library__FileSystem "File System" Library).
+ *
+ * \note Requires C++11 (for <code>std::thread</code> and
+ *   <code>std::atomic</code>).
+ */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK
+#define PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK_MAJOR       1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK_MINOR       0
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK_REVISION    2
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK_EDIT        2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL
+# include <platformstl/platformstl.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM
+# include <platformstl/filesystem/FILE_stream.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_FILE_STREAM */
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_SYNCH_HPP_THREAD_MUTEX
+# include <platformstl/synch/thread_mutex.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_SYNCH_HPP_THREAD_MUTEX */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
+# include <stlsoft/shims/access/string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_LOCK_SCOPE
+# include <stlsoft/synch/lock_scope.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_LOCK_SCOPE */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_memfns
+# include <stlsoft/api/internal/memfns.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_memfns */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_CHRONO
+# define STLSOFT_INCL_CHRONO
+# include <chrono>
+#endif /* !STLSOFT_INCL_CHRONO */
+#ifndef STLSOFT_INCL_CONDITION_VARIABLE
+# define STLSOFT_INCL_CONDITION_VARIABLE
+# include <condition_variable>
+#endif /* !STLSOFT_INCL_CONDITION_VARIABLE */
+#ifndef STLSOFT_INCL_EXCEPTION
+# define STLSOFT_INCL_EXCEPTION
+# include <exception>
+#endif /* !STLSOFT_INCL_EXCEPTION */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#if 0
+#elif defined(PLATFORMSTL_OS_IS_UNIX)
+# ifndef STLSOFT_INCL_H_UNISTD
+#  define STLSOFT_INCL_H_UNISTD
+#  include <unistd.h>
+# endif /* !STLSOFT_INCL_H_UNISTD */
+#elif defined(PLATFORMSTL_OS_IS_WINDOWS)
+# include <io.h>
+#endif /* OS */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::platformstl */
+namespace platformstl
+{
+#else
+/* Define stlsoft::platformstl_project */
+namespace stlsoft
+{
+namespace platformstl_project
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Writes records - lines, or blocks of bytes - to a file stream on a
+ * background thread, so that the writing threads do not wait for the
+ * file system.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * Records are appended to the current one of a fixed number of
+ * fixed-size buffers. Any number of threads may write concurrently: each
+ * reserves its space in the current buffer with a single atomic addition,
+ * and copies its record in without taking a lock. The thread whose
+ * reservation first overruns the buffer seals it and makes the next free
+ * buffer current, and the background thread writes each sealed buffer to
+ * the stream in a single <code>fwrite()</code>. Each record is written
+ * whole and contiguously, and the records of any one thread are written
+ * in the order in which it wrote them.
+ *
+ * The memory used is bounded by the buffer size and count. When every
+ * buffer is awaiting the background thread, a write is handled according
+ * to the backpressure policy: it waits (backpressureBlock), is discarded
+ * (backpressureDrop), or is written synchronously to the stream by the
+ * writing thread (backpressureSpill), once the records buffered before it
+ * have been written. A record larger than a buffer is always written
+ * synchronously, in the same way.
+ *
+ * A buffer that is only partly filled is written when the oldest of its
+ * records has waited for (at most) the flush interval, and when flush()
+ * is called. The stream is synchronised to storage (with
+ * <code>fsync()</code> or <code>_commit()</code>) at most once in each
+ * synchronisation interval, if one is specified, and when sync() is
+ * called.
+ *
+ * Errors from writing to the stream on the background thread are
+ * rethrown by the next call to flush(), sync(), or close().
+ *
+ * \note close() - and, therefore, destruction - must not run concurrently
+ *   with writes.
+ */
+class async_FILE_sink
+{
+public: // Member Types
+    /// This type
+    typedef async_FILE_sink                                     class_type;
+    /// The stream type
+    typedef thread_shareable_FILE_stream                        stream_type;
+    /// The mutex type
+    typedef thread_mutex                                        mutex_type;
+    /// The size type
+    typedef ss_size_t                                           size_type;
+
+    /// What a write does when every buffer is awaiting the background
+    /// thread
+    enum backpressure_policy
+    {
+        /// The write waits until the background thread frees a buffer
+        backpressureBlock
+        /// The record is discarded, and the write returns \c false
+    ,   backpressureDrop
+        /// The record is written to the stream by the writing thread
+    ,   backpressureSpill
+    };
+
+    /// The options with which an instance is constructed
+    struct options
+    {
+    public:
+        options()
+            : bufferSize(256 * 1024)
+            , numBuffers(4)
+            , backpressure(backpressureBlock)
+            , flushIntervalMs(100)
+            , syncIntervalMs(0)
+            , syncOnClose(false)
+        {}
+
+    public:
+        /// The size of each buffer, which is the size of each write to the
+        /// stream
+        size_type           bufferSize;
+        /// The number of buffers. Must be at least 2
+        size_type           numBuffers;
+        /// What a write does when every buffer is awaiting the background
+        /// thread
+        backpressure_policy backpressure;
+        /// The longest time, in milliseconds, for which a record may wait
+        /// in a partly-filled buffer. If 0, a buffer is written only when
+        /// full or when flush() is called
+        unsigned            flushIntervalMs;
+        /// The shortest time, in milliseconds, between synchronisations
+        /// of the stream to storage by the background thread. If 0, the
+        /// stream is synchronised only by sync()
+        unsigned            syncIntervalMs;
+        /// Whether close() synchronises the stream to storage
+        bool                syncOnClose;
+    };
+
+private:
+    struct buffer_
+    {
+        char*                               data;
+        // The bytes reserved by writers. Exceeds the buffer size once the
+        // buffer is sealed, until it is next made current
+        std::atomic<size_type>              reserved;
+        // The bytes copied in by writers
+        std::atomic<size_type>              committed;
+        // The bytes to be written, set when the buffer is sealed
+        size_type                           used;
+    };
+    typedef std::chrono::steady_clock                           clock_type_;
+
+public: // Construction
+    /// Constructs an instance that writes to the given stream
+    explicit
+    async_FILE_sink(
+        stream_type const&  stm
+    ,   options const&      opts = options()
+    )
+        : m_stream(stm)
+        , m_options(validate_options_(opts))
+        , m_storage(new char[m_options.bufferSize * m_options.numBuffers])
+        , m_buffers(new buffer_[m_options.numBuffers])
+        , m_current(NULL)
+        , m_sealed(m_options.numBuffers)
+        , m_sealedHead(0)
+        , m_sealedCount(0)
+        , m_numSealed(0)
+        , m_numWritten(0)
+        , m_closing(false)
+        , m_closed(false)
+        , m_numDropped(0)
+        , m_numSpilled(0)
+    {
+        m_free.reserve(m_options.numBuffers);
+
+        for (size_type i = 0; i != m_options.numBuffers; ++i)
+        {
+            buffer_& b = m_buffers[i];
+
+            b.data = &m_storage[i * m_options.bufferSize];
+            b.reserved.store(m_options.bufferSize + 1, std::memory_order_relaxed);
+            b.committed.store(0, std::memory_order_relaxed);
+            b.used = 0;
+
+            if (0 == i)
+            {
+                make_current_(&b);
+            }
+            else
+            {
+                m_free.push_back(&b);
+            }
+        }
+
+        m_thread = std::thread(&class_type::run_, this);
+    }
+    /// Constructs an instance that writes to the file stream opened for
+    /// the given \c path according to the given \c mode
+    template<
+        ss_typename_param_k S1
+    ,   ss_typename_param_k S2
+    >
+    async_FILE_sink(
+        S1 const&       path
+    ,   S2 const&       mode
+    ,   options const&  opts = options()
+    )
+        : class_type(stream_type(path, mode), opts)
+    {}
+    /// Writes all buffered records, and stops the background thread,
+    /// ignoring any errors
+    ~async_FILE_sink() STLSOFT_NOEXCEPT
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {}
+    }
+private:
+    async_FILE_sink(class_type const&);         // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+
+public: // Operations
+    /// Writes the given string and the end-of-line character
+    /// <code>'\\n'</code> as a single record
+    ///
+    /// \retval true The record was buffered or written
+    /// \retval false The record was discarded, by the backpressureDrop
+    ///   policy, or because the instance is closed
+    template <ss_typename_param_k S>
+    bool write_line(S const& line)
+    {
+        return write_(STLSOFT_NS_QUAL(c_str_data_a)(line), STLSOFT_NS_QUAL(c_str_len_a)(line), true);
+    }
+    /// Writes the given string as a single record
+    ///
+    /// \see write_line()
+    template <ss_typename_param_k S>
+    bool write(S const& s)
+    {
+        return write_(STLSOFT_NS_QUAL(c_str_data_a)(s), STLSOFT_NS_QUAL(c_str_len_a)(s), false);
+    }
+    /// Writes the given block of memory as a single record
+    ///
+    /// \see write_line()
+    bool write(void const* pv, size_type cb)
+    {
+        return write_(static_cast<char const*>(pv), cb, false);
+    }
+
+    /// Waits until all records written before the call have been written
+    /// to the stream, and flushes the stream
+    ///
+    /// \exception X Any exception thrown by the stream on the background
+    ///   thread since the last call to flush(), sync(), or close()
+    void flush()
+    {
+        {
+            STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+            wait_for_buffered_locked_();
+
+            rethrow_error_locked_();
+        }
+
+        m_stream.flush();
+    }
+
+    /// Performs flush(), and synchronises the stream to storage
+    void sync()
+    {
+        flush();
+        sync_stream_();
+    }
+
+    /// Writes all buffered records, and stops the background thread.
+    /// Subsequent writes are discarded
+    ///
+    /// \exception X Any exception thrown by the stream on the background
+    ///   thread since the last call to flush(), sync(), or close()
+    void close()
+    {
+        if (!m_thread.joinable())
+        {
+            return;
+        }
+
+        {
+            STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+            m_closing = true;
+            m_cvWriter.notify_one();
+        }
+
+        m_thread.join();
+
+        {
+            STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+            m_closed.store(true, std::memory_order_release);
+            m_current.store(NULL, std::memory_order_release);
+            m_cvProducers.notify_all();
+
+            rethrow_error_locked_();
+        }
+
+        m_stream.flush();
+        if (m_options.syncOnClose)
+        {
+            sync_stream_();
+        }
+    }
+
+public: // Accessors
+    /// The options with which the instance was constructed, after
+    /// validation
+    options const& get_options() const STLSOFT_NOEXCEPT
+    {
+        return m_options;
+    }
+    /// The number of records discarded, by the backpressureDrop policy,
+    /// or because the instance is closed
+    ss_uint64_t num_dropped() const STLSOFT_NOEXCEPT
+    {
+        return m_numDropped.load(std::memory_order_relaxed);
+    }
+    /// The number of records written synchronously, by the
+    /// backpressureSpill policy, or because they are larger than a buffer
+    ss_uint64_t num_spilled() const STLSOFT_NOEXCEPT
+    {
+        return m_numSpilled.load(std::memory_order_relaxed);
+    }
+
+private: // Implementation
+    static
+    options
+    validate_options_(
+        options const& opts
+    )
+    {
+        options r(opts);
+
+        if (r.bufferSize < 1)
+        {
+            r.bufferSize = 1;
+        }
+        if (r.numBuffers < 2)
+        {
+            r.numBuffers = 2;
+        }
+
+        return r;
+    }
+
+    bool
+    write_(
+        char const* s
+    ,   size_type   len
+    ,   bool        addNewline
+    )
+    {
+        size_type const cb  =   len + (addNewline ? 1u : 0u);
+        size_type const cap =   m_options.bufferSize;
+
+        if (cb > cap)
+        {
+            return spill_(s, len, addNewline);
+        }
+
+        for (;;)
+        {
+            buffer_* const b = m_current.load(std::memory_order_acquire);
+
+            if (NULL != b)
+            {
+                size_type const start = b->reserved.fetch_add(cb, std::memory_order_acq_rel);
+
+                if (start + cb <= cap)
+                {
+                    if (0 != len)
+                    {
+                        STLSOFT_API_INTERNAL_memfns_memcpy(b->data + start, s, len);
+                    }
+                    if (addNewline)
+                    {
+                        b->data[start + len] = '\n';
+                    }
+
+                    b->committed.fetch_add(cb, std::memory_order_release);
+
+                    return true;
+                }
+
+                if (start <= cap)
+                {
+                    // This reservation is the first to overrun the buffer,
+                    // so the data ends at start
+
+                    STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+                    seal_locked_(b, start);
+                }
+                else if (b == m_current.load(std::memory_order_acquire))
+                {
+                    // Another writer is sealing the buffer
+                    std::this_thread::yield();
+                }
+
+                continue;
+            }
+
+            // Every buffer is awaiting the background thread, or the
+            // instance is closed
+
+            if (m_closed.load(std::memory_order_acquire))
+            {
+                m_numDropped.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+
+            switch (m_options.backpressure)
+            {
+                case    backpressureDrop:
+                    m_numDropped.fetch_add(1, std::memory_order_relaxed);
+
+                    return false;
+                case    backpressureSpill:
+                    return spill_(s, len, addNewline);
+                case    backpressureBlock:
+                default:
+                    {
+                        STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+                        for (; NULL == m_current.load(std::memory_order_relaxed) && !m_closed.load(std::memory_order_relaxed); )
+                        {
+                            m_cvProducers.wait(m_mx);
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+
+    // Writes the record directly to the stream, once all records
+    // buffered before it - including any of the calling thread's - have
+    // been written, so that each thread's records stay in order
+    bool
+    spill_(
+        char const* s
+    ,   size_type   len
+    ,   bool        addNewline
+    )
+    {
+        {
+            STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+            if (m_closed.load(std::memory_order_relaxed))
+            {
+                m_numDropped.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+
+            wait_for_buffered_locked_();
+        }
+
+        m_numSpilled.fetch_add(1, std::memory_order_relaxed);
+
+        if (addNewline)
+        {
+            // A single write, so that the record is not interleaved with
+            // those of other threads
+            STLSOFT_NS_QUAL(auto_buffer)<char>  buff(1u + len);
+
+            if (0 != len)
+            {
+                STLSOFT_API_INTERNAL_memfns_memcpy(&buff[0], s, len);
+            }
+            buff[len] = '\n';
+
+            m_stream.write(static_cast<void const*>(buff.data()), buff.size());
+        }
+        else
+        {
+            m_stream.write(static_cast<void const*>(s), len);
+        }
+
+        return true;
+    }
+
+    // Makes the given (free) buffer current. Its reservation count is
+    // reset last, since until then any writer that finds it (having read
+    // m_current before the buffer was last sealed) must be refused
+    void
+    make_current_(
+        buffer_* b
+    )
+    {
+        b->committed.store(0, std::memory_order_relaxed);
+        b->reserved.store(0, std::memory_order_release);
+
+        m_current.store(b, std::memory_order_release);
+    }
+
+    void
+    seal_locked_(
+        buffer_*    b
+    ,   size_type   used
+    )
+    {
+        b->used = used;
+
+        m_sealed[(m_sealedHead + m_sealedCount) % m_options.numBuffers] = b;
+        ++m_sealedCount;
+        ++m_numSealed;
+
+        if (m_free.empty())
+        {
+            m_current.store(NULL, std::memory_order_release);
+        }
+        else
+        {
+            buffer_* const next = m_free.back();
+
+            m_free.pop_back();
+
+            make_current_(next);
+        }
+
+        m_cvWriter.notify_one();
+    }
+
+    // Seals the current buffer if it holds any data, and returns the
+    // number of buffers that must be written for all data written so far
+    // to have been written
+    ss_uint64_t
+    seal_partial_locked_()
+    {
+        buffer_* const b = m_current.load(std::memory_order_acquire);
+
+        if (NULL != b &&
+            0 != b->reserved.load(std::memory_order_acquire))
+        {
+            size_type const start = b->reserved.fetch_add(m_options.bufferSize + 1, std::memory_order_acq_rel);
+
+            if (start <= m_options.bufferSize)
+            {
+                seal_locked_(b, start);
+            }
+            else
+            {
+                // A writer has overrun the buffer, and will seal it once
+                // it acquires the mutex
+                return m_numSealed + 1;
+            }
+        }
+
+        return m_numSealed;
+    }
+
+    // Waits until every buffer holding data written so far has been
+    // written to the stream, or the instance is closed
+    void
+    wait_for_buffered_locked_()
+    {
+        ss_uint64_t const ticket = seal_partial_locked_();
+
+        m_cvWriter.notify_one();
+
+        for (; m_numWritten < ticket && !m_closed.load(std::memory_order_relaxed); )
+        {
+            m_cvProducers.wait(m_mx);
+        }
+    }
+
+    void
+    rethrow_error_locked_()
+    {
+        if (m_error)
+        {
+            std::exception_ptr x;
+
+            x.swap(m_error);
+
+            std::rethrow_exception(x);
+        }
+    }
+
+    void
+    sync_stream_()
+    {
+        FILE* const h = get_FILE_ptr(m_stream);
+
+#if 0
+#elif defined(PLATFORMSTL_OS_IS_UNIX)
+
+        if (0 != ::fsync(::fileno(h)))
+#elif defined(PLATFORMSTL_OS_IS_WINDOWS)
+
+        if (0 != ::_commit(::_fileno(h)))
+#else
+
+        if (0 != ::fflush(h))
+#endif
+        {
+            int const e = errno;
+
+            STLSOFT_THROW_X(filesystem_exception("failed to synchronise file", e));
+        }
+    }
+
+    // Writes the buffer's data to the stream, once all writers that
+    // reserved space in it have finished copying
+    void
+    drain_(
+        buffer_*                    b
+    ,   clock_type_::time_point&    lastSync
+    )
+    {
+        for (; b->used != b->committed.load(std::memory_order_acquire); )
+        {
+            std::this_thread::yield();
+        }
+
+        // Written as bytes, with fwrite(), since records may contain
+        // NUL characters
+        if (0 != b->used)
+        {
+            m_stream.write(static_cast<void const*>(b->data), b->used);
+        }
+
+        m_stream.flush();
+
+        if (0 != m_options.syncIntervalMs)
+        {
+            clock_type_::time_point const now = clock_type_::now();
+
+            if (now - lastSync >= std::chrono::milliseconds(m_options.syncIntervalMs))
+            {
+                sync_stream_();
+
+                lastSync = now;
+            }
+        }
+    }
+
+    void
+    run_()
+    {
+        clock_type_::time_point lastSync = clock_type_::now();
+
+        STLSOFT_NS_QUAL(lock_scope)<mutex_type> scope(m_mx);
+
+        for (;;)
+        {
+            if (0 == m_sealedCount)
+            {
+                if (!m_closing)
+                {
+                    if (0 == m_options.flushIntervalMs)
+                    {
+                        m_cvWriter.wait(m_mx);
+                    }
+                    else
+                    {
+                        m_cvWriter.wait_for(m_mx, std::chrono::milliseconds(m_options.flushIntervalMs));
+                    }
+                }
+
+                if (0 == m_sealedCount &&
+                    (   m_closing ||
+                        0 != m_options.flushIntervalMs))
+                {
+                    seal_partial_locked_();
+                }
+
+                if (0 == m_sealedCount)
+                {
+                    if (m_closing)
+                    {
+                        break;
+                    }
+
+                    continue;
+                }
+            }
+
+            buffer_* const b = m_sealed[m_sealedHead];
+
+            m_sealedHead = (m_sealedHead + 1) % m_options.numBuffers;
+            --m_sealedCount;
+
+            std::exception_ptr x;
+
+            m_mx.unlock();
+            try
+            {
+                drain_(b, lastSync);
+            }
+            catch (...)
+            {
+                x = std::current_exception();
+            }
+            m_mx.lock();
+
+            if (x && !m_error)
+            {
+                m_error = x;
+            }
+
+            ++m_numWritten;
+
+            if (NULL == m_current.load(std::memory_order_relaxed))
+            {
+                make_current_(b);
+            }
+            else
+            {
+                m_free.push_back(b);
+            }
+
+            m_cvProducers.notify_all();
+        }
+    }
+
+private: // Member Variables
+    stream_type                                                 m_stream;
+    options const                                               m_options;
+    std::unique_ptr<char[]>                                     m_storage;
+    std::unique_ptr<buffer_[]>                                  m_buffers;
+    std::atomic<buffer_*>                                       m_current;
+    mutex_type                                                  m_mx;
+    std::condition_variable_any                                 m_cvWriter;
+    std::condition_variable_any                                 m_cvProducers;
+    std::vector<buffer_*>                                       m_free;
+    // The sealed buffers, in order, in a ring of numBuffers slots
+    std::vector<buffer_*>                                       m_sealed;
+    size_type                                                   m_sealedHead;
+    size_type                                                   m_sealedCount;
+    ss_uint64_t                                                 m_numSealed;
+    ss_uint64_t                                                 m_numWritten;
+    bool                                                        m_closing;
+    std::atomic<bool>                                           m_closed;
+    std::exception_ptr                                          m_error;
+    std::atomic<ss_uint64_t>                                    m_numDropped;
+    std::atomic<ss_uint64_t>                                    m_numSpilled;
+    std::thread                                                 m_thread;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace platformstl */
+#else
+} /* namespace platformstl_project */
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_ASYNC_FILE_SINK */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,517 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        platformstl/filesystem/parallel_file_lines.hpp
+ *
+ * Purpose:     Platform header for the parallel_file_lines components.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES
+#define PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES
+
+/* File version */
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES_MAJOR       1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES_MINOR       1
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES_REVISION    2
+# define PLATFORMSTL_VER_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES_EDIT        3
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \file platformstl/filesystem/parallel_file_lines.hpp
+ *
+ * \brief [C++] Definition of the platformstl::parallel_file_lines type
+ *   (\ref group__library__FileSystem "File System" Library).
+ *
+ * The platformstl::basic_parallel_file_lines class template presents the
+ * same random-access line table as platformstl::basic_file_lines, but
+ * indexes the memory-mapped file concurrently: the contents are split
+ * into chunks that each end on a line-feed boundary, the chunks are
+ * indexed concurrently on a stlsoft::work_stealing_pool, and the
+ * per-chunk results are stitched into a single table.
+ *
+ * \note Requires C++11 (for <code>std::thread</code>, by way of
+ *   stlsoft::work_stealing_pool).
+ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL
+# include <platformstl/platformstl.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_HPP_PLATFORMSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+# ifndef PLATFORMSTL_INCL_PLATFORMSTL_EXCEPTION_HPP_INVALID_FILE_TYPE_EXCEPTION
+#  include <platformstl/exception/invalid_file_type_exception.hpp>
+# endif /* !PLATFORMSTL_INCL_PLATFORMSTL_EXCEPTION_HPP_INVALID_FILE_TYPE_EXCEPTION */
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+#ifndef PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE
+# include <platformstl/filesystem/memory_mapped_file.hpp>
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_MEMORY_MAPPED_FILE */
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS
+# include <stlsoft/conversion/w2m.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD
+# include <stlsoft/shims/access/string/fwd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_STRING_H_FWD */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW
+# include <stlsoft/string/string_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL
+# include <stlsoft/synch/work_stealing_pool.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL */
+
+#ifndef STLSOFT_INCL_ALGORITHM
+# define STLSOFT_INCL_ALGORITHM
+# include <algorithm>
+#endif /* !STLSOFT_INCL_ALGORITHM */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::platformstl */
+namespace platformstl
+{
+#else
+/* Define stlsoft::platformstl_project */
+namespace stlsoft
+{
+namespace platformstl_project
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Maps a text file's contents and presents them as a vector of lines,
+ * indexing the contents concurrently
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * \param C The character type
+ * \param V The value type. Defaults to
+ *   <code>stlsoft::basic_string_view<C></code>, which refers into the
+ *   mapping and so requires no per-line allocation
+ *
+ * Line recognition is identical to that of platformstl::basic_file_lines:
+ * LF, CRLF and lone CR are all treated as end-of-line sequences. Chunks
+ * always end immediately after an LF, so no end-of-line sequence is ever
+ * split between two chunks, and the resulting table is identical to that
+ * obtained by a sequential scan.
+ *
+ * The chunks are indexed, and then stitched, on the pool passed to the
+ * constructor, or on stlsoft::work_stealing_pool::default_instance(), so
+ * that no threads are created for each instance.
+ *
+ * \note Unlike platformstl::basic_file_lines, the contents are not copied
+ *   into an intermediate string: the mapping is held for the lifetime of
+ *   the instance.
+ */
+template<
+    ss_typename_param_k C
+,   ss_typename_param_k V = stlsoft::basic_string_view<C>
+>
+class basic_parallel_file_lines
+{
+public: // Member Types
+    typedef basic_parallel_file_lines<C, V>                             class_type;
+    typedef C                                                           char_type;
+private:
+    typedef V                                                           value_string_type_;
+    typedef std::vector<V>                                              strings_type_;
+    typedef memory_mapped_file                                          mmf_type_;
+public:
+    typedef ss_typename_type_k strings_type_::value_type                value_type;
+    typedef ss_typename_type_k strings_type_::size_type                 size_type;
+    typedef ss_typename_type_k strings_type_::const_iterator            const_iterator;
+    typedef ss_typename_type_k strings_type_::const_reference           const_reference;
+    typedef ss_bool_t                                                   bool_type;
+    /// The pool type
+    typedef stlsoft::work_stealing_pool                                 pool_type;
+
+public: // Constants
+    enum
+    {
+        /// The minimum number of characters given to each chunk. Files
+        /// smaller than this are indexed on the calling thread
+        minimumChunkSize    =   64 * 1024
+    };
+
+public: // Construction
+    /// Maps the given file and indexes its lines on the default pool
+    ///
+    /// \param path The path of the file
+    /// \param concurrency The maximum number of chunks. If 0, the
+    ///   concurrency of the default pool is used
+    template <ss_typename_param_k S>
+    ss_explicit_k
+    basic_parallel_file_lines(
+        S const&    path
+    ,   size_type   concurrency = 0
+    )
+        : m_mmf(path)
+        , m_strings()
+        , m_numChunks(0)
+    {
+        create_(STLSOFT_NS_QUAL(c_str_ptr)(path), pool_type::default_instance(), concurrency);
+    }
+    /// Maps the given file and indexes its lines on the given pool
+    ///
+    /// \param path The path of the file
+    /// \param pool The pool on which the chunks are indexed
+    /// \param concurrency The maximum number of chunks. If 0, the
+    ///   concurrency of \c pool is used
+    template <ss_typename_param_k S>
+    basic_parallel_file_lines(
+        S const&    path
+    ,   pool_type&  pool
+    ,   size_type   concurrency = 0
+    )
+        : m_mmf(path)
+        , m_strings()
+        , m_numChunks(0)
+    {
+        create_(STLSOFT_NS_QUAL(c_str_ptr)(path), pool, concurrency);
+    }
+
+    ~basic_parallel_file_lines() STLSOFT_NOEXCEPT
+    {}
+
+private:
+    basic_parallel_file_lines(class_type const&);   // copy-construction proscribed
+    class_type& operator =(class_type const&);      // copy-assignment proscribed
+
+public: // Accessors
+    /// Returns the number of lines in the file
+    size_type size() const
+    {
+        return m_strings.size();
+    }
+
+    /// Indicates whethere there are any lines in the file
+    bool_type empty() const
+    {
+        return 0u == size();
+    }
+
+    /// The number of chunks into which the contents were split for
+    /// indexing
+    size_type num_chunks() const
+    {
+        return m_numChunks;
+    }
+
+    /// Returns a non-mutable (const) reference to the line at \c index
+    ///
+    /// \note The behaviour is undefined if index >= size()
+    const_reference operator [](size_type index) const
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", index < size());
+
+        return m_strings[index];
+    }
+
+    /// Begins the iteration
+    ///
+    /// \return An iterator representing the start of the sequence
+    const_iterator begin() const
+    {
+        return m_strings.begin();
+    }
+
+    /// Ends the iteration
+    ///
+    /// \return An iterator representing the end of the sequence
+    const_iterator end() const
+    {
+        return m_strings.end();
+    }
+
+private: // Implementation
+    static
+    void
+    index_lines_(
+        char_type const*    begin
+    ,   char_type const*    end
+    ,   strings_type_&      strings
+    )
+    {
+        // This must recognise exactly the same EOL sequences as
+        // basic_file_lines, so that the results are interchangeable.
+
+        char_type const*    s0      =   begin;
+        char_type           prev    =   '\0';
+
+        strings.reserve(1u + static_cast<size_type>(end - begin) / 32u);
+
+        { for (; begin != end; ++begin)
+        {
+            char_type const     c   =   *begin;
+            char_type const*    eol =   begin;
+
+            switch (c)
+            {
+            case '\r':
+                if ('\r' == prev)
+                {
+                    --eol;
+
+                    strings.push_back(value_string_type_(s0, eol));
+
+                    s0 = begin;
+                }
+                break;
+            case '\n':
+                if ('\r' == prev)
+                {
+                    --eol;
+                }
+
+                strings.push_back(value_string_type_(s0, eol));
+
+                s0 = begin + 1;
+                break;
+            default:
+                if ('\r' == prev)
+                {
+                    --eol;
+
+                    strings.push_back(value_string_type_(s0, eol));
+
+                    s0 = begin;
+                }
+                break;
+            }
+
+            prev = c;
+        }}
+        if (s0 != end)
+        {
+            char_type const* eol = begin;
+
+            if ('\r' == prev)
+            {
+                --eol;
+            }
+
+            strings.push_back(value_string_type_(s0, eol));
+        }
+    }
+
+    // The path is used only in the message of the exception thrown for
+    // a binary file, so wide paths are converted, as in
+    // basic_file_lines::create_from_ref_().
+    void
+    create_(
+        ss_char_w_t const*  path
+    ,   pool_type&          pool
+    ,   size_type           concurrency
+    )
+    {
+        create_(STLSOFT_NS_QUAL(w2m)(path), pool, concurrency);
+    }
+
+    void
+    create_(
+        ss_char_a_t const*  path
+    ,   pool_type&          pool
+    ,   size_type           concurrency
+    )
+    {
+        STLSOFT_ASSERT(NULL != path);
+
+        char_type const* const  base    =   static_cast<char_type const*>(m_mmf.memory());
+        size_type const         cch     =   static_cast<size_type>(m_mmf.size() / sizeof(char_type));
+        char_type const* const  end     =   base + cch;
+
+        if (0 == concurrency)
+        {
+            concurrency = pool.concurrency();
+        }
+
+        size_type numChunks = cch / static_cast<size_type>(minimumChunkSize);
+
+        if (numChunks > concurrency)
+        {
+            numChunks = concurrency;
+        }
+        if (0 == numChunks)
+        {
+            numChunks = 1;
+        }
+
+        // 1. Determine the chunk boundaries, each one (other than the
+        //    first) being just past an LF
+
+        std::vector<char_type const*> bounds(numChunks + 1);
+
+        bounds[0]           =   base;
+        bounds[numChunks]   =   end;
+
+        { for (size_type i = 1; i != numChunks; ++i)
+        {
+            char_type const* const  from    =   base + (cch / numChunks) * i;
+            char_type const*        b       =   std::find(STLSOFT_NS_QUAL_STD(max)(from, bounds[i - 1]), end, '\n');
+
+            bounds[i] = (end == b) ? end : (b + 1);
+        }}
+
+        // 2. Index each chunk concurrently, checking as we go that it does
+        //    not look like a binary file
+
+        std::vector<strings_type_>  chunkStrings(numChunks);
+        std::vector<char>           chunkBinary(numChunks, 0);
+
+        pool.for_each_chunk(numChunks, [&](ss_size_t i) {
+
+            char_type const* const  b   =   bounds[i];
+            char_type const* const  e   =   bounds[i + 1];
+
+            if (e != std::find(b, e, '\0'))
+            {
+                chunkBinary[i] = 1;
+            }
+            else
+            {
+                index_lines_(b, e, chunkStrings[i]);
+            }
+        });
+
+        if (chunkBinary.end() != std::find(chunkBinary.begin(), chunkBinary.end(), 1))
+        {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(invalid_file_type_exception("file is binary (or unsupported text encoding)", 0, path));
+#else /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            return;
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+
+        // 3. Stitch the per-chunk tables into the single table, again
+        //    concurrently since each chunk's destination is now known
+
+        std::vector<size_type> offsets(numChunks + 1, 0);
+
+        { for (size_type i = 0; i != numChunks; ++i)
+        {
+            offsets[i + 1] = offsets[i] + chunkStrings[i].size();
+        }}
+
+        if (1 == numChunks)
+        {
+            m_strings.swap(chunkStrings[0]);
+        }
+        else
+        {
+            m_strings.resize(offsets[numChunks]);
+
+            pool.for_each_chunk(numChunks, [&](ss_size_t i) {
+
+                std::copy(chunkStrings[i].begin(), chunkStrings[i].end(), m_strings.begin() + offsets[i]);
+
+                strings_type_().swap(chunkStrings[i]);
+            });
+        }
+
+        m_numChunks = numChunks;
+    }
+
+private: // Fields
+    mmf_type_           m_mmf;
+    strings_type_       m_strings;
+    size_type           m_numChunks;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs for commonly encountered types
+ */
+
+/** Specialisation of the basic_parallel_file_lines template for the ANSI
+ * character type \c char
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef basic_parallel_file_lines<ss_char_a_t>  parallel_file_lines_a;
+
+/** Specialisation of the basic_parallel_file_lines template for the
+ * Unicode character type \c wchar_t
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef basic_parallel_file_lines<ss_char_w_t>  parallel_file_lines_w;
+
+/** Specialisation of the basic_parallel_file_lines template for the
+ * character type \c char
+ *
+ * \ingroup group__library__FileSystem
+ */
+typedef parallel_file_lines_a                   parallel_file_lines;
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#if defined(STLSOFT_NO_NAMESPACE) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace platformstl */
+#else
+} /* namespace platformstl_project */
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !PLATFORMSTL_INCL_PLATFORMSTL_FILESYSTEM_HPP_PARALLEL_FILE_LINES */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,1147 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        rangelib/pipeline.hpp
+ *
+ * Purpose:     Lazy, fused range pipelines.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file rangelib/pipeline.hpp Lazy, fused range pipelines
+ *
+ * Pipelines are composed with the <code>|</code> operator from a source
+ * - a container, an array, or a Notional Range - and one or more
+ * stages - filter(), transform(), take(), take_while(), drop() - and
+ * are evaluated by one of the terminal operations of
+ * rangelib::pipeline, as in:
+\code
+  std::vector<int>  v = . . .;
+
+  int sum = (v | rangelib::filter(is_odd()) | rangelib::transform(square()) | rangelib::take(10)).accumulate(0);
+\endcode
+ *
+ * The stages are fused: the source is traversed once, and each element
+ * is passed through all the stages, with no intermediate containers.
+ *
+ * Contiguous sources - arrays, and containers that have
+ * <code>data()</code> and <code>size()</code> methods, or whose iterators
+ * are pointers - are traversed in batches of
+ * RANGELIB_PIPELINE_BATCH_SIZE elements, with the test for the
+ * completion of a short-circuiting operation - take(), take_while(),
+ * pipeline::any_of(), pipeline::first(), and so on - made once per
+ * batch, so that the inner loop has no exit other than its bound, and
+ * may be vectorised by the compiler. The remainder of a batch is still
+ * pushed through the stages after the pipeline has completed, but each
+ * stage that invokes a function - filter(), transform(), take_while() -
+ * first tests whether the stages that follow it have completed, so no
+ * function is invoked on an element after the pipeline has completed,
+ * just as for any other source.
+ *
+ * \note Requires C++11.
+ */
+
+#ifndef RANGELIB_INCL_RANGELIB_HPP_PIPELINE
+#define RANGELIB_INCL_RANGELIB_HPP_PIPELINE
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define RANGELIB_VER_RANGELIB_HPP_PIPELINE_MAJOR       1
+# define RANGELIB_VER_RANGELIB_HPP_PIPELINE_MINOR       0
+# define RANGELIB_VER_RANGELIB_HPP_PIPELINE_REVISION    2
+# define RANGELIB_VER_RANGELIB_HPP_PIPELINE_EDIT        2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef RANGELIB_INCL_RANGELIB_HPP_RANGELIB
+# include <rangelib/rangelib.hpp>
+#endif /* !RANGELIB_INCL_RANGELIB_HPP_RANGELIB */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_UTILITY
+# define STLSOFT_INCL_UTILITY
+# include <utility>
+#endif /* !STLSOFT_INCL_UTILITY */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def RANGELIB_PIPELINE_BATCH_SIZE
+ *
+ * The number of elements of a contiguous source that are passed through
+ * a pipeline between each test for completion, which may be defined by
+ * the user prior to inclusion.
+ */
+#ifndef RANGELIB_PIPELINE_BATCH_SIZE
+# define RANGELIB_PIPELINE_BATCH_SIZE                       (64)
+#endif /* !RANGELIB_PIPELINE_BATCH_SIZE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef RANGELIB_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::rangelib */
+namespace rangelib
+{
+# else
+/* Define stlsoft::rangelib_project */
+namespace stlsoft
+{
+namespace rangelib_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !RANGELIB_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_pipeline
+{
+
+    // Evaluates to T if X is well-formed, for use in SFINAE
+    template<
+        ss_typename_param_k X
+    ,   ss_typename_param_k T
+    >
+    struct first_of_
+    {
+        typedef T                                           type;
+    };
+
+    // Orders the overloads of make_source_()
+    template <int N>
+    struct rank_
+        : rank_<N - 1>
+    {};
+    template <>
+    struct rank_<0>
+    {};
+
+    /* sources
+     */
+
+    template <ss_typename_param_k P>
+    struct contiguous_source_
+    {
+        P   first;
+        P   last;
+    };
+
+    template <ss_typename_param_k I>
+    struct iterator_source_
+    {
+        I   first;
+        I   last;
+    };
+
+    template <ss_typename_param_k R>
+    struct range_source_
+    {
+        R   range;
+    };
+
+    template<
+        ss_typename_param_k I
+    >
+    inline
+    iterator_source_<I>
+    make_iterator_source_(
+        I   first
+    ,   I   last
+    )
+    {
+        iterator_source_<I> s = { first, last };
+
+        return s;
+    }
+
+    template<
+        ss_typename_param_k T
+    >
+    inline
+    contiguous_source_<T*>
+    make_iterator_source_(
+        T*  first
+    ,   T*  last
+    )
+    {
+        contiguous_source_<T*> s = { first, last };
+
+        return s;
+    }
+
+    template<
+        ss_typename_param_k T
+    ,   ss_size_t           N
+    >
+    inline
+    contiguous_source_<T const*>
+    make_source_(
+        T const (&ar)[N]
+    ,   rank_<3>
+    )
+    {
+        contiguous_source_<T const*> s = { &ar[0], &ar[0] + N };
+
+        return s;
+    }
+
+    template <ss_typename_param_k R>
+    inline
+    auto
+    make_source_(
+        R const&    r
+    ,   rank_<2>
+    ) -> ss_typename_type_k first_of_<decltype(r.is_open()), range_source_<R> >::type
+    {
+        range_source_<R> s = { r };
+
+        return s;
+    }
+
+    template <ss_typename_param_k C>
+    inline
+    auto
+    make_source_(
+        C const&    c
+    ,   rank_<1>
+    ) -> ss_typename_type_k first_of_<decltype(c.size()), contiguous_source_<decltype(c.data())> >::type
+    {
+        contiguous_source_<decltype(c.data())> s = { c.data(), c.data() + c.size() };
+
+        return s;
+    }
+
+    template <ss_typename_param_k C>
+    inline
+    auto
+    make_source_(
+        C const&    c
+    ,   rank_<0>
+    ) -> decltype(make_iterator_source_(c.begin(), c.end()))
+    {
+        return make_iterator_source_(c.begin(), c.end());
+    }
+
+    /* drivers
+     *
+     * Each takes the sink by value, so that its state is local to the
+     * loop, and may be kept in registers, rather than written through a
+     * reference that the compiler must assume may alias the source.
+     */
+
+    template<
+        ss_typename_param_k P
+    ,   ss_typename_param_k K
+    >
+    inline
+    K
+    drive_(
+        contiguous_source_<P> const&    source
+    ,   K                               sink
+    )
+    {
+        P           p       =   source.first;
+        P const     last    =   source.last;
+
+        for (; last != p && !sink.done(); )
+        {
+            P const end = (last - p > RANGELIB_PIPELINE_BATCH_SIZE) ? p + RANGELIB_PIPELINE_BATCH_SIZE : last;
+
+            for (; end != p; ++p)
+            {
+                sink.push(*p);
+            }
+        }
+
+        return sink;
+    }
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k K
+    >
+    inline
+    K
+    drive_(
+        iterator_source_<I> const&  source
+    ,   K                           sink
+    )
+    {
+        for (I i = source.first; source.last != i && !sink.done(); ++i)
+        {
+            sink.push(*i);
+        }
+
+        return sink;
+    }
+
+    template<
+        ss_typename_param_k R
+    ,   ss_typename_param_k K
+    >
+    inline
+    K
+    drive_(
+        range_source_<R> const& source
+    ,   K                       sink
+    )
+    {
+        for (R r(source.range); r.is_open() && !sink.done(); r.advance())
+        {
+            sink.push(r.current());
+        }
+
+        return sink;
+    }
+
+    /* intermediate sinks
+     *
+     * Each holds the next sink by value, so that the whole chain is a
+     * single object, which the compiler can keep in registers, and from
+     * which the terminal sink, and its result, is obtained by terminal().
+     * Those that invoke a function do so only while the next sink is not
+     * done, since the driver may push the remainder of a batch.
+     */
+
+    template<
+        ss_typename_param_k P
+    ,   ss_typename_param_k K
+    >
+    struct filter_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (!next.done() &&
+                pred(x))
+            {
+                next.push(x);
+            }
+        }
+        bool done() const
+        {
+            return next.done();
+        }
+        auto terminal() -> decltype(STLSOFT_NS_QUAL_STD(declval)<K&>().terminal())
+        {
+            return next.terminal();
+        }
+
+        P   pred;
+        K   next;
+    };
+
+    template<
+        ss_typename_param_k F
+    ,   ss_typename_param_k K
+    >
+    struct transform_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (!next.done())
+            {
+                next.push(fn(x));
+            }
+        }
+        bool done() const
+        {
+            return next.done();
+        }
+        auto terminal() -> decltype(STLSOFT_NS_QUAL_STD(declval)<K&>().terminal())
+        {
+            return next.terminal();
+        }
+
+        F   fn;
+        K   next;
+    };
+
+    template <ss_typename_param_k K>
+    struct take_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            // Elements after the last are ignored, since the driver may
+            // push the remainder of a batch
+            if (0 != remaining)
+            {
+                --remaining;
+
+                next.push(x);
+            }
+        }
+        bool done() const
+        {
+            return 0 == remaining || next.done();
+        }
+        auto terminal() -> decltype(STLSOFT_NS_QUAL_STD(declval)<K&>().terminal())
+        {
+            return next.terminal();
+        }
+
+        ss_size_t   remaining;
+        K           next;
+    };
+
+    template<
+        ss_typename_param_k P
+    ,   ss_typename_param_k K
+    >
+    struct take_while_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (!stopped &&
+                !next.done())
+            {
+                if (pred(x))
+                {
+                    next.push(x);
+                }
+                else
+                {
+                    stopped = true;
+                }
+            }
+        }
+        bool done() const
+        {
+            return stopped || next.done();
+        }
+        auto terminal() -> decltype(STLSOFT_NS_QUAL_STD(declval)<K&>().terminal())
+        {
+            return next.terminal();
+        }
+
+        P       pred;
+        bool    stopped;
+        K       next;
+    };
+
+    template <ss_typename_param_k K>
+    struct drop_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (0 != remaining)
+            {
+                --remaining;
+            }
+            else
+            {
+                next.push(x);
+            }
+        }
+        bool done() const
+        {
+            return next.done();
+        }
+        auto terminal() -> decltype(STLSOFT_NS_QUAL_STD(declval)<K&>().terminal())
+        {
+            return next.terminal();
+        }
+
+        ss_size_t   remaining;
+        K           next;
+    };
+
+    /* terminal sinks
+     *
+     * Each holds its result by value (rather than by reference to the
+     * caller's variable), so that it cannot alias the source, and those
+     * that short-circuit ignore elements after they are done, since the
+     * driver may push the remainder of a batch.
+     */
+
+    template <ss_typename_param_k F>
+    struct for_each_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            fn(x);
+        }
+        bool done() const
+        {
+            return false;
+        }
+        for_each_sink_& terminal()
+        {
+            return *this;
+        }
+
+        F   fn;
+    };
+
+    template<
+        ss_typename_param_k T
+    ,   ss_typename_param_k F
+    >
+    struct accumulate_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            result = op(result, x);
+        }
+        bool done() const
+        {
+            return false;
+        }
+        accumulate_sink_& terminal()
+        {
+            return *this;
+        }
+
+        T   result;
+        F   op;
+    };
+
+    struct sum_
+    {
+        template<
+            ss_typename_param_k T
+        ,   ss_typename_param_k X
+        >
+        T operator ()(T const& t, X const& x) const
+        {
+            return t + x;
+        }
+    };
+
+    struct count_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const&)
+        {
+            ++result;
+        }
+        bool done() const
+        {
+            return false;
+        }
+        count_sink_& terminal()
+        {
+            return *this;
+        }
+
+        ss_size_t   result;
+    };
+
+    template<
+        ss_typename_param_k P
+    ,   bool                V_match
+    >
+    struct find_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (!found &&
+                V_match == static_cast<bool>(pred(x)))
+            {
+                found = true;
+            }
+        }
+        bool done() const
+        {
+            return found;
+        }
+        find_sink_& terminal()
+        {
+            return *this;
+        }
+
+        P       pred;
+        bool    found;
+    };
+
+    template <ss_typename_param_k T>
+    struct first_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            if (!found)
+            {
+                *result =   x;
+                found   =   true;
+            }
+        }
+        bool done() const
+        {
+            return found;
+        }
+        first_sink_& terminal()
+        {
+            return *this;
+        }
+
+        T*      result;
+        bool    found;
+    };
+
+    template <ss_typename_param_k O>
+    struct copy_sink_
+    {
+        template <ss_typename_param_k X>
+        void push(X const& x)
+        {
+            *out = x;
+            ++out;
+        }
+        bool done() const
+        {
+            return false;
+        }
+        copy_sink_& terminal()
+        {
+            return *this;
+        }
+
+        O   out;
+    };
+
+} /* namespace ximpl_pipeline */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * stage classes
+ */
+
+/** Pipeline stage that passes on only those elements that satisfy a
+ * predicate
+ *
+ * \ingroup group__library__Range
+ *
+ * \see filter()
+ */
+template <ss_typename_param_k P>
+class filter_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    ss_explicit_k filter_stage(P pred)
+        : m_pred(pred)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    ximpl_pipeline::filter_sink_<P, K> make_sink(K const& next) const
+    {
+        ximpl_pipeline::filter_sink_<P, K> sink = { m_pred, next };
+
+        return sink;
+    }
+
+private:
+    P   m_pred;
+};
+
+/** Pipeline stage that passes on the result of a function applied to
+ * each element
+ *
+ * \ingroup group__library__Range
+ *
+ * \see transform()
+ */
+template <ss_typename_param_k F>
+class transform_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    ss_explicit_k transform_stage(F fn)
+        : m_fn(fn)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    ximpl_pipeline::transform_sink_<F, K> make_sink(K const& next) const
+    {
+        ximpl_pipeline::transform_sink_<F, K> sink = { m_fn, next };
+
+        return sink;
+    }
+
+private:
+    F   m_fn;
+};
+
+/** Pipeline stage that passes on at most a given number of elements,
+ * and then completes
+ *
+ * \ingroup group__library__Range
+ *
+ * \see take()
+ */
+class take_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    ss_explicit_k take_stage(ss_size_t n)
+        : m_n(n)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    ximpl_pipeline::take_sink_<K> make_sink(K const& next) const
+    {
+        ximpl_pipeline::take_sink_<K> sink = { m_n, next };
+
+        return sink;
+    }
+
+private:
+    ss_size_t   m_n;
+};
+
+/** Pipeline stage that passes on elements until the first that does not
+ * satisfy a predicate, and then completes
+ *
+ * \ingroup group__library__Range
+ *
+ * \see take_while()
+ */
+template <ss_typename_param_k P>
+class take_while_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    ss_explicit_k take_while_stage(P pred)
+        : m_pred(pred)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    ximpl_pipeline::take_while_sink_<P, K> make_sink(K const& next) const
+    {
+        ximpl_pipeline::take_while_sink_<P, K> sink = { m_pred, false, next };
+
+        return sink;
+    }
+
+private:
+    P   m_pred;
+};
+
+/** Pipeline stage that discards a given number of elements, and passes
+ * on the remainder
+ *
+ * \ingroup group__library__Range
+ *
+ * \see drop()
+ */
+class drop_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    ss_explicit_k drop_stage(ss_size_t n)
+        : m_n(n)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    ximpl_pipeline::drop_sink_<K> make_sink(K const& next) const
+    {
+        ximpl_pipeline::drop_sink_<K> sink = { m_n, next };
+
+        return sink;
+    }
+
+private:
+    ss_size_t   m_n;
+};
+
+/** Pipeline stage that is the composition of two stages, as created by
+ * the <code>|</code> operator
+ *
+ * \ingroup group__library__Range
+ */
+template<
+    ss_typename_param_k D1
+,   ss_typename_param_k D2
+>
+class composite_stage
+{
+public:
+    typedef void                                            pipeline_stage_tag;
+
+public:
+    composite_stage(
+        D1 const&   first
+    ,   D2 const&   second
+    )
+        : m_first(first)
+        , m_second(second)
+    {}
+
+public:
+    template <ss_typename_param_k K>
+    auto make_sink(K const& next) const -> decltype(STLSOFT_NS_QUAL_STD(declval)<D1 const&>().make_sink(STLSOFT_NS_QUAL_STD(declval)<D2 const&>().make_sink(next)))
+    {
+        return m_first.make_sink(m_second.make_sink(next));
+    }
+
+private:
+    D1  m_first;
+    D2  m_second;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * pipeline class
+ */
+
+/** A lazy pipeline, comprising a source and a (possibly composite)
+ * stage, which is evaluated, in a single pass, by each of its terminal
+ * operations
+ *
+ * \ingroup group__library__Range
+ *
+ * \param S The source type
+ * \param D The stage type
+ *
+ * \note A pipeline whose source is a container or an array refers to,
+ *   rather than copies, the elements, so the container must outlive the
+ *   pipeline; a Notional Range source is copied, and each terminal
+ *   operation traverses a copy of it.
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k D
+>
+class pipeline
+{
+/// \name Member Types
+/// @{
+public:
+    typedef S                                               source_type;
+    typedef D                                               stage_type;
+    typedef pipeline<S, D>                                  class_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    pipeline(
+        source_type const&  source
+    ,   stage_type const&   stage
+    )
+        : m_source(source)
+        , m_stage(stage)
+    {}
+/// @}
+
+/// \name Terminal operations
+/// @{
+public:
+    /// Invokes a function on each element, returning the function
+    template <ss_typename_param_k F>
+    F for_each(F fn) const
+    {
+        ximpl_pipeline::for_each_sink_<F> const sink = { fn };
+
+        return run_(sink).fn;
+    }
+
+    /// Adds each element to an initial value, and returns the sum
+    template <ss_typename_param_k T>
+    T accumulate(T init) const
+    {
+        return accumulate(init, ximpl_pipeline::sum_());
+    }
+
+    /// Combines each element with an initial value, by a binary
+    /// operation, and returns the result
+    template<
+        ss_typename_param_k T
+    ,   ss_typename_param_k F
+    >
+    T accumulate(T init, F op) const
+    {
+        ximpl_pipeline::accumulate_sink_<T, F> const sink = { init, op };
+
+        return run_(sink).result;
+    }
+
+    /// The number of elements
+    ss_size_t count() const
+    {
+        ximpl_pipeline::count_sink_ const sink = { 0 };
+
+        return run_(sink).result;
+    }
+
+    /// Indicates whether any element satisfies the predicate, stopping
+    /// at the first that does
+    template <ss_typename_param_k P>
+    bool any_of(P pred) const
+    {
+        ximpl_pipeline::find_sink_<P, true> const sink = { pred, false };
+
+        return run_(sink).found;
+    }
+
+    /// Indicates whether all elements satisfy the predicate, stopping
+    /// at the first that does not
+    template <ss_typename_param_k P>
+    bool all_of(P pred) const
+    {
+        ximpl_pipeline::find_sink_<P, false> const sink = { pred, false };
+
+        return !run_(sink).found;
+    }
+
+    /// Indicates whether no element satisfies the predicate, stopping
+    /// at the first that does
+    template <ss_typename_param_k P>
+    bool none_of(P pred) const
+    {
+        return !any_of(pred);
+    }
+
+    /// Obtains the first element, if any
+    ///
+    /// \param result Receives the first element, if any
+    ///
+    /// \retval true The pipeline had at least one element, which has
+    ///   been assigned to \c result
+    /// \retval false The pipeline had no elements, and \c result is
+    ///   unchanged
+    template <ss_typename_param_k T>
+    bool first(T& result) const
+    {
+        ximpl_pipeline::first_sink_<T> const sink = { &result, false };
+
+        return run_(sink).found;
+    }
+
+    /// Copies each element to an output iterator, returning the output
+    /// iterator
+    template <ss_typename_param_k O>
+    O copy(O out) const
+    {
+        ximpl_pipeline::copy_sink_<O> const sink = { out };
+
+        return run_(sink).out;
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    source_type const& source() const
+    {
+        return m_source;
+    }
+    stage_type const& stage() const
+    {
+        return m_stage;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    template <ss_typename_param_k K>
+    K run_(K const& terminal) const
+    {
+        return ximpl_pipeline::drive_(m_source, m_stage.make_sink(terminal)).terminal();
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    source_type m_source;
+    stage_type  m_stage;
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * creator functions
+ */
+
+/** Creates a stage that passes on only those elements that satisfy the
+ * given predicate
+ *
+ * \ingroup group__library__Range
+ */
+template <ss_typename_param_k P>
+inline filter_stage<P> filter(P pred)
+{
+    return filter_stage<P>(pred);
+}
+
+/** Creates a stage that passes on the result of the given function
+ * applied to each element
+ *
+ * \ingroup group__library__Range
+ */
+template <ss_typename_param_k F>
+inline transform_stage<F> transform(F fn)
+{
+    return transform_stage<F>(fn);
+}
+
+/** Creates a stage that passes on at most \c n elements
+ *
+ * \ingroup group__library__Range
+ */
+inline take_stage take(ss_size_t n)
+{
+    return take_stage(n);
+}
+
+/** Creates a stage that passes on elements until the first that does not
+ * satisfy the given predicate
+ *
+ * \ingroup group__library__Range
+ */
+template <ss_typename_param_k P>
+inline take_while_stage<P> take_while(P pred)
+{
+    return take_while_stage<P>(pred);
+}
+
+/** Creates a stage that discards the first \c n elements
+ *
+ * \ingroup group__library__Range
+ */
+inline drop_stage drop(ss_size_t n)
+{
+    return drop_stage(n);
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * operators
+ */
+
+/** Creates a pipeline from a source - an array, a container, or a
+ * Notional Range - and a stage
+ *
+ * \ingroup group__library__Range
+ */
+template<
+    ss_typename_param_k C
+,   ss_typename_param_k D
+>
+inline
+auto
+operator |(
+    C const&    source
+,   D const&    stage
+) -> pipeline<
+    decltype(ximpl_pipeline::make_source_(source, ximpl_pipeline::rank_<3>()))
+,   ss_typename_type_k ximpl_pipeline::first_of_<ss_typename_type_k D::pipeline_stage_tag, D>::type
+>
+{
+    return pipeline<decltype(ximpl_pipeline::make_source_(source, ximpl_pipeline::rank_<3>())), D>(ximpl_pipeline::make_source_(source, ximpl_pipeline::rank_<3>()), stage);
+}
+
+/** Appends a stage to a pipeline
+ *
+ * \ingroup group__library__Range
+ */
+template<
+    ss_typename_param_k S
+,   ss_typename_param_k D1
+,   ss_typename_param_k D2
+>
+inline
+pipeline<
+    S
+,   composite_stage<D1, ss_typename_type_k ximpl_pipeline::first_of_<ss_typename_type_k D2::pipeline_stage_tag, D2>::type>
+>
+operator |(
+    pipeline<S, D1> const&  lhs
+,   D2 const&               stage
+)
+{
+    return pipeline<S, composite_stage<D1, D2> >(lhs.source(), composite_stage<D1, D2>(lhs.stage(), stage));
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef RANGELIB_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace rangelib */
+# else
+} /* namespace rangelib_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !RANGELIB_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !RANGELIB_INCL_RANGELIB_HPP_PIPELINE */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,647 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/algorithms/parallel.hpp
+ *
+ * Purpose:     Parallel whole-collection algorithms.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file stlsoft/algorithms/parallel.hpp
+ *
+ * \brief [C++] Parallel whole-collection algorithms, for contiguous
+ *   (random-access) collections
+ *   (\ref group__library__Algorithm "Algorithm" Library).
+ *
+ * The algorithms par_for_all(), par_transform(), par_accumulate() and
+ * par_count_if() are the parallel counterparts of
+ * stlsoft::for_all(), stlsoft::copy_all() (with a transformation),
+ * <code>std::accumulate()</code> and <code>std::count_if()</code>,
+ * applied to any collection that provides random-access
+ * <code>begin()</code> and <code>size()</code>, including
+ * stlsoft::fixed_array_1d (.. 4d), stlsoft::static_array_1d (.. 4d),
+ * stlsoft::array_view and stlsoft::pod_vector. They are executed on a
+ * stlsoft::work_stealing_pool - by default,
+ * stlsoft::work_stealing_pool::default_instance() - which runs the
+ * collection in chunks of \c grain elements.
+ *
+ * The reductions are deterministic: the chunk boundaries depend only on
+ * the size of the collection and the grain, and the per-chunk results
+ * are combined in chunk order, so the result does not depend on the
+ * number of threads or on the scheduling. The result of a reduction
+ * that is not associative (such as floating-point addition) may
+ * nevertheless differ from that of the sequential algorithm, since the
+ * elements are grouped differently.
+ *
+ * \note Requires C++11 (for <code>std::thread</code>).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_ALGORITHMS_HPP_PARALLEL
+#define STLSOFT_INCL_STLSOFT_ALGORITHMS_HPP_PARALLEL
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_PARALLEL_MAJOR      1
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_PARALLEL_MINOR      0
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_PARALLEL_REVISION   2
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_PARALLEL_EDIT       2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL
+# include <stlsoft/synch/work_stealing_pool.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+# include <stlsoft/synch/util/cache_line_padded_.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+#ifndef STLSOFT_INCL_FUNCTIONAL
+# define STLSOFT_INCL_FUNCTIONAL
+# include <functional>
+#endif /* !STLSOFT_INCL_FUNCTIONAL */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+ *
+ * The default number of elements in each chunk of the parallel
+ * algorithms, which may be defined by the user prior to inclusion.
+ */
+#ifndef STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+# define STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN          (16384)
+#endif /* !STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_parallel
+{
+
+    inline
+    ss_size_t
+    num_chunks_(
+        ss_size_t   n
+    ,   ss_size_t   grain
+    ) STLSOFT_NOEXCEPT
+    {
+        return (n / grain) + (0 != (n % grain));
+    }
+
+    // The base of the chunk functions, which calculates the bounds of a
+    // given chunk
+    template <ss_typename_param_k I>
+    struct chunk_base_
+    {
+    public:
+        chunk_base_(
+            I           first
+        ,   ss_size_t   n
+        ,   ss_size_t   grain
+        )
+            : first(first)
+            , n(n)
+            , grain(grain)
+        {}
+
+    public:
+        I
+        begin_(
+            ss_size_t   chunk
+        ) const
+        {
+            return first + static_cast<ss_ptrdiff_t>(chunk * grain);
+        }
+        ss_size_t
+        size_(
+            ss_size_t   chunk
+        ) const STLSOFT_NOEXCEPT
+        {
+            ss_size_t const offset = chunk * grain;
+
+            return (n - offset < grain) ? (n - offset) : grain;
+        }
+
+    public:
+        I const         first;
+        ss_size_t const n;
+        ss_size_t const grain;
+    };
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k UF
+    >
+    struct for_all_chunk_
+        : public chunk_base_<I>
+    {
+    public:
+        for_all_chunk_(
+            I           first
+        ,   ss_size_t   n
+        ,   ss_size_t   grain
+        ,   UF&         func
+        )
+            : chunk_base_<I>(first, n, grain)
+            , func(func)
+        {}
+
+    public:
+        void operator ()(ss_size_t chunk) const
+        {
+            I           it  =   this->begin_(chunk);
+            ss_size_t   n   =   this->size_(chunk);
+
+            for (; 0 != n; --n, ++it)
+            {
+                func(*it);
+            }
+        }
+
+    public:
+        UF& func;
+    };
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k O
+    ,   ss_typename_param_k UF
+    >
+    struct transform_chunk_
+        : public chunk_base_<I>
+    {
+    public:
+        transform_chunk_(
+            I           first
+        ,   ss_size_t   n
+        ,   ss_size_t   grain
+        ,   O           dest
+        ,   UF&         func
+        )
+            : chunk_base_<I>(first, n, grain)
+            , dest(dest)
+            , func(func)
+        {}
+
+    public:
+        void operator ()(ss_size_t chunk) const
+        {
+            I           it  =   this->begin_(chunk);
+            O           out =   dest + static_cast<ss_ptrdiff_t>(chunk * this->grain);
+            ss_size_t   n   =   this->size_(chunk);
+
+            for (; 0 != n; --n, ++it, ++out)
+            {
+                *out = func(*it);
+            }
+        }
+
+    public:
+        O const dest;
+        UF&     func;
+    };
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k T
+    ,   ss_typename_param_k BF
+    >
+    struct accumulate_chunk_
+        : public chunk_base_<I>
+    {
+    public:
+        accumulate_chunk_(
+            I                                               first
+        ,   ss_size_t                                       n
+        ,   ss_size_t                                       grain
+        ,   ximpl_cache_line_padded::cache_line_padded<T>*  results
+        ,   BF&                                             op
+        )
+            : chunk_base_<I>(first, n, grain)
+            , results(results)
+            , op(op)
+        {}
+
+    public:
+        void operator ()(ss_size_t chunk) const
+        {
+            I           it  =   this->begin_(chunk);
+            ss_size_t   n   =   this->size_(chunk);
+            T           r(*it);
+
+            for (++it, --n; 0 != n; --n, ++it)
+            {
+                r = op(r, *it);
+            }
+
+            results[chunk].value = r;
+        }
+
+    public:
+        ximpl_cache_line_padded::cache_line_padded<T>* const    results;
+        BF&                                                     op;
+    };
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k P
+    >
+    struct count_if_chunk_
+        : public chunk_base_<I>
+    {
+    public:
+        count_if_chunk_(
+            I                                                       first
+        ,   ss_size_t                                               n
+        ,   ss_size_t                                               grain
+        ,   ximpl_cache_line_padded::cache_line_padded<ss_size_t>*  results
+        ,   P&                                                      pred
+        )
+            : chunk_base_<I>(first, n, grain)
+            , results(results)
+            , pred(pred)
+        {}
+
+    public:
+        void operator ()(ss_size_t chunk) const
+        {
+            I           it  =   this->begin_(chunk);
+            ss_size_t   n   =   this->size_(chunk);
+            ss_size_t   r   =   0;
+
+            for (; 0 != n; --n, ++it)
+            {
+                if (pred(*it))
+                {
+                    ++r;
+                }
+            }
+
+            results[chunk].value = r;
+        }
+
+    public:
+        ximpl_cache_line_padded::cache_line_padded<ss_size_t>* const    results;
+        P&                                                              pred;
+    };
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k UF
+    >
+    inline
+    void
+    for_all_(
+        work_stealing_pool& pool
+    ,   I                   first
+    ,   ss_size_t           n
+    ,   ss_size_t           grain
+    ,   UF&                 func
+    )
+    {
+        pool.for_each_chunk(num_chunks_(n, grain), for_all_chunk_<I, UF>(first, n, grain, func));
+    }
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k O
+    ,   ss_typename_param_k UF
+    >
+    inline
+    void
+    transform_(
+        work_stealing_pool& pool
+    ,   I                   first
+    ,   ss_size_t           n
+    ,   ss_size_t           grain
+    ,   O                   dest
+    ,   UF&                 func
+    )
+    {
+        pool.for_each_chunk(num_chunks_(n, grain), transform_chunk_<I, O, UF>(first, n, grain, dest, func));
+    }
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k T
+    ,   ss_typename_param_k BF
+    >
+    inline
+    void
+    accumulate_(
+        work_stealing_pool&                             pool
+    ,   I                                               first
+    ,   ss_size_t                                       n
+    ,   ss_size_t                                       grain
+    ,   ximpl_cache_line_padded::cache_line_padded<T>*  results
+    ,   BF&                                             op
+    )
+    {
+        pool.for_each_chunk(num_chunks_(n, grain), accumulate_chunk_<I, T, BF>(first, n, grain, results, op));
+    }
+
+    template<
+        ss_typename_param_k I
+    ,   ss_typename_param_k P
+    >
+    inline
+    void
+    count_if_(
+        work_stealing_pool&                                     pool
+    ,   I                                                       first
+    ,   ss_size_t                                               n
+    ,   ss_size_t                                               grain
+    ,   ximpl_cache_line_padded::cache_line_padded<ss_size_t>*  results
+    ,   P&                                                      pred
+    )
+    {
+        pool.for_each_chunk(num_chunks_(n, grain), count_if_chunk_<I, P>(first, n, grain, results, pred));
+    }
+
+} /* namespace ximpl_parallel */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * algorithms
+ */
+
+/** Applies a function to each element of a collection, in parallel.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * \param container The collection instance
+ * \param func The function, which is invoked concurrently from multiple
+ *   threads (and so must be safe to do so), each invocation on a
+ *   different element
+ * \param grain The number of elements in each chunk of work
+ * \param pool The pool on which to execute
+ *
+ * \note Unlike stlsoft::for_all(), the function is not returned, since
+ *   it is shared between the threads, and the order in which the
+ *   elements are visited is unspecified.
+ */
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k UF
+        >
+// [[synesis:function:algorithm: par_for_all(T<C> &container, T<UF> func, size_t grain, work_stealing_pool& pool)]]
+inline
+void
+par_for_all(
+    C&                  container
+,   UF                  func
+,   ss_size_t           grain   =   STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+,   work_stealing_pool& pool    =   work_stealing_pool::default_instance()
+)
+{
+    STLSOFT_MESSAGE_ASSERT("grain must be non-zero", 0 != grain);
+
+    ximpl_parallel::for_all_(pool, container.begin(), container.size(), grain, func);
+}
+
+/** Assigns to each element of a destination range the result of a
+ * function applied to the corresponding element of a collection, in
+ * parallel.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * \param container The source collection instance
+ * \param dest A random-access iterator to the start of the destination
+ *   range, which must have at least <code>container.size()</code>
+ *   elements
+ * \param func The transformation function, which is invoked concurrently
+ *   from multiple threads
+ * \param grain The number of elements in each chunk of work
+ * \param pool The pool on which to execute
+ *
+ * \return <code>dest + container.size()</code>
+ */
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k O
+        ,   ss_typename_param_k UF
+        >
+// [[synesis:function:algorithm: par_transform(T<C> const& container, T<O> dest, T<UF> func, size_t grain, work_stealing_pool& pool)]]
+inline
+O
+par_transform(
+    C const&            container
+,   O                   dest
+,   UF                  func
+,   ss_size_t           grain   =   STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+,   work_stealing_pool& pool    =   work_stealing_pool::default_instance()
+)
+{
+    STLSOFT_MESSAGE_ASSERT("grain must be non-zero", 0 != grain);
+
+    ss_size_t const n = container.size();
+
+    ximpl_parallel::transform_(pool, container.begin(), n, grain, dest, func);
+
+    return dest + static_cast<ss_ptrdiff_t>(n);
+}
+
+/** Combines the elements of a collection, and an initial value, with a
+ * binary operation, in parallel.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * The elements of each chunk are combined in order, starting from the
+ * chunk's first element, and then \c init and the chunk results are
+ * combined in order, so the result is deterministic.
+ *
+ * \param container The collection instance
+ * \param init The initial value
+ * \param op The binary operation, which must be associative, and which
+ *   is invoked concurrently from multiple threads
+ * \param grain The number of elements in each chunk of work
+ * \param pool The pool on which to execute
+ */
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k T
+        ,   ss_typename_param_k BF
+        >
+// [[synesis:function:algorithm: par_accumulate(T<C> const& container, T<T> init, T<BF> op, size_t grain, work_stealing_pool& pool)]]
+inline
+T
+par_accumulate(
+    C const&            container
+,   T                   init
+,   BF                  op
+,   ss_size_t           grain   =   STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+,   work_stealing_pool& pool    =   work_stealing_pool::default_instance()
+)
+{
+    STLSOFT_MESSAGE_ASSERT("grain must be non-zero", 0 != grain);
+
+    // The per-chunk results are written concurrently, so each is padded
+    // to a cache line (which also makes them distinct objects when T is
+    // bool, as they would not be in a std::vector<bool>)
+    typedef ximpl_cache_line_padded::cache_line_padded<T>   slot_t;
+    typedef STLSOFT_NS_QUAL_STD(vector)<slot_t>             slots_t;
+
+    ss_size_t const n           =   container.size();
+    ss_size_t const numChunks   =   ximpl_parallel::num_chunks_(n, grain);
+    slots_t         results(numChunks, slot_t(init));
+
+    if (0 != numChunks)
+    {
+        ximpl_parallel::accumulate_(pool, container.begin(), n, grain, &results[0], op);
+    }
+
+    for (ss_size_t i = 0; i != numChunks; ++i)
+    {
+        init = op(init, results[i].value);
+    }
+
+    return init;
+}
+
+/** Sums the elements of a collection, and an initial value, in parallel.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * \param container The collection instance
+ * \param init The initial value
+ *
+ * \note To specify the grain, or the pool, use the four- or five-
+ *   parameter overload, with <code>std::plus&lt;T&gt;()</code>.
+ */
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k T
+        >
+// [[synesis:function:algorithm: par_accumulate(T<C> const& container, T<T> init)]]
+inline
+T
+par_accumulate(
+    C const&            container
+,   T                   init
+)
+{
+    return par_accumulate(container, init, STLSOFT_NS_QUAL_STD(plus)<T>());
+}
+
+/** Counts the elements of a collection that satisfy a predicate, in
+ * parallel.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * \param container The collection instance
+ * \param pred The predicate, which is invoked concurrently from multiple
+ *   threads
+ * \param grain The number of elements in each chunk of work
+ * \param pool The pool on which to execute
+ */
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k P
+        >
+// [[synesis:function:algorithm: par_count_if(T<C> const& container, T<P> pred, size_t grain, work_stealing_pool& pool)]]
+inline
+ss_size_t
+par_count_if(
+    C const&            container
+,   P                   pred
+,   ss_size_t           grain   =   STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN
+,   work_stealing_pool& pool    =   work_stealing_pool::default_instance()
+)
+{
+    STLSOFT_MESSAGE_ASSERT("grain must be non-zero", 0 != grain);
+
+    typedef ximpl_cache_line_padded::cache_line_padded<ss_size_t>   slot_t;
+    typedef STLSOFT_NS_QUAL_STD(vector)<slot_t>                     slots_t;
+
+    ss_size_t const n           =   container.size();
+    ss_size_t const numChunks   =   ximpl_parallel::num_chunks_(n, grain);
+    slots_t         results(numChunks);
+    ss_size_t       r           =   0;
+
+    if (0 != numChunks)
+    {
+        ximpl_parallel::count_if_(pool, container.begin(), n, grain, &results[0], pred);
+    }
+
+    for (ss_size_t i = 0; i != numChunks; ++i)
+    {
+        r += results[i].value;
+    }
+
+    return r;
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_ALGORITHMS_HPP_PARALLEL */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose:     Algorithms for Plain-Old Data types.
  *
  * Created:     17th January 2002
- * Updated:     2nd January 2021
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2021, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2002-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_MAJOR       3
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_MINOR       5
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_REVISION    8
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_EDIT        103
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_MINOR       6
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_REVISION    1
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_POD_EDIT        104
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -71,6 +71,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_ALGORITHM_STD_HPP_ALT
 # include <stlsoft/algorithms/std/alt.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_ALGORITHM_STD_HPP_ALT */
+#ifndef STLSOFT_INCL_STLSOFT_META_HPP_BASE_TYPE_TRAITS
+# include <stlsoft/meta/base_type_traits.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_META_HPP_BASE_TYPE_TRAITS */
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_CONSTRAINTS
 # include <stlsoft/util/constraints.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_CONSTRAINTS */
@@ -90,6 +93,29 @@
 #ifndef STLSOFT_INCL_STLSOFT_API_internal_h_memfns
 # include <stlsoft/api/internal/memfns.h>
 #endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_memfns */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD
+ *
+ * The size, in bytes, below which stlsoft::pod_copy_nt() and
+ * stlsoft::pod_fill_n_nt() use ordinary (cached) stores. Non-temporal
+ * stores only pay off for buffers that will not fit in the last-level
+ * cache, so the default is 8MB. May be defined by the user.
+ */
+#ifndef STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD
+# define STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD      (8 * 1024 * 1024)
+#endif /* !STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD */
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -189,6 +215,617 @@ struct ximpl_stlsoft_algorithm_pod_helper_
     }
 
 };
+
+namespace ximpl_pod
+{
+
+    // The unsigned integer type of a given size, used to form the lane
+    // patterns of the SIMD kernels
+
+    template <ss_size_t N>
+    struct uint_;
+
+    template <>
+    struct uint_<1>
+    {
+        typedef ss_uint8_t  type;
+    };
+
+    template <>
+    struct uint_<2>
+    {
+        typedef ss_uint16_t type;
+    };
+
+    template <>
+    struct uint_<4>
+    {
+        typedef ss_uint32_t type;
+    };
+
+    template <>
+    struct uint_<8>
+    {
+        typedef ss_uint64_t type;
+    };
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+    // Lane operations for lanes of N bytes. max_blocks is the number of
+    // comparison results that may be accumulated in a lane before it
+    // overflows. There is no signed comparison for 64-bit lanes in SSE2,
+    // so min/max of 8-byte types is done by the scalar kernel
+
+    template <ss_size_t N>
+    struct sse2_;
+
+    template <>
+    struct sse2_<1>
+    {
+        enum { max_blocks = 255 };
+
+        static __m128i set1(ss_uint8_t v)           { return _mm_set1_epi8(static_cast<char>(v)); }
+        static __m128i cmpeq(__m128i a, __m128i b)  { return _mm_cmpeq_epi8(a, b); }
+        static __m128i cmpgt(__m128i a, __m128i b)  { return _mm_cmpgt_epi8(a, b); }
+        static __m128i sub(__m128i a, __m128i b)    { return _mm_sub_epi8(a, b); }
+    };
+
+    template <>
+    struct sse2_<2>
+    {
+        enum { max_blocks = 65535 };
+
+        static __m128i set1(ss_uint16_t v)          { return _mm_set1_epi16(static_cast<short>(v)); }
+        static __m128i cmpeq(__m128i a, __m128i b)  { return _mm_cmpeq_epi16(a, b); }
+        static __m128i cmpgt(__m128i a, __m128i b)  { return _mm_cmpgt_epi16(a, b); }
+        static __m128i sub(__m128i a, __m128i b)    { return _mm_sub_epi16(a, b); }
+    };
+
+    template <>
+    struct sse2_<4>
+    {
+        enum { max_blocks = 0x7fffffff };
+
+        static __m128i set1(ss_uint32_t v)          { return _mm_set1_epi32(static_cast<int>(v)); }
+        static __m128i cmpeq(__m128i a, __m128i b)  { return _mm_cmpeq_epi32(a, b); }
+        static __m128i cmpgt(__m128i a, __m128i b)  { return _mm_cmpgt_epi32(a, b); }
+        static __m128i sub(__m128i a, __m128i b)    { return _mm_sub_epi32(a, b); }
+    };
+
+    template <>
+    struct sse2_<8>
+    {
+        enum { max_blocks = 0x7fffffff };
+
+        static __m128i set1(ss_uint64_t v)          { return _mm_set1_epi64x(static_cast<long long>(v)); }
+        static __m128i cmpeq(__m128i a, __m128i b)
+        {
+            // Both 32-bit halves of a lane must be equal
+            __m128i const m = _mm_cmpeq_epi32(a, b);
+
+            return _mm_and_si128(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+        static __m128i sub(__m128i a, __m128i b)    { return _mm_sub_epi64(a, b); }
+    };
+
+    // Returns the lanes of a where mask is set, otherwise those of b
+    inline
+    __m128i
+    select_(
+        __m128i mask
+    ,   __m128i a
+    ,   __m128i b
+    )
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    __m128i
+    set1_(
+        T v
+    )
+    {
+        typedef ss_typename_type_k uint_<sizeof(T)>::type   uint_t;
+
+        return sse2_<sizeof(T)>::set1(static_cast<uint_t>(v));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+
+    // find
+
+    template <ss_typename_param_k T>
+    inline
+    ss_size_t
+    find_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T const&    value
+    ,   no_type
+    )
+    {
+        ss_size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            if (value == p[i + 0]) return i + 0;
+            if (value == p[i + 1]) return i + 1;
+            if (value == p[i + 2]) return i + 2;
+            if (value == p[i + 3]) return i + 3;
+        }
+
+        for (; i != n; ++i)
+        {
+            if (value == p[i])
+            {
+                break;
+            }
+        }
+
+        return i;
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    ss_size_t
+    find_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T const&    value
+    ,   yes_type
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        typedef sse2_<sizeof(T)>    ops_t;
+
+        enum { K = 16 / sizeof(T) };
+
+        __m128i const   needle  =   set1_(value);
+        ss_size_t       i       =   0;
+
+        // Four vectors are tested per iteration, and only the (one) block
+        // containing a match is examined lane by lane
+
+        for (; i + 4 * K <= n; i += 4 * K)
+        {
+            __m128i const* const    v   =   reinterpret_cast<__m128i const*>(p + i);
+            __m128i const           e0  =   ops_t::cmpeq(_mm_loadu_si128(v + 0), needle);
+            __m128i const           e1  =   ops_t::cmpeq(_mm_loadu_si128(v + 1), needle);
+            __m128i const           e2  =   ops_t::cmpeq(_mm_loadu_si128(v + 2), needle);
+            __m128i const           e3  =   ops_t::cmpeq(_mm_loadu_si128(v + 3), needle);
+
+            if (0 != _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3))))
+            {
+                break;
+            }
+        }
+
+        for (; i + K <= n; i += K)
+        {
+            int const mask = _mm_movemask_epi8(ops_t::cmpeq(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), needle));
+
+            if (0 != mask)
+            {
+                return i + STLSOFT_API_INTERNAL_simd_mask_lowest_bit(static_cast<ss_uint32_t>(mask)) / sizeof(T);
+            }
+        }
+
+        return i + find_(p + i, n - i, value, no_type());
+#else /* ? STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        return find_(p, n, value, no_type());
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+    }
+
+
+    // count
+
+    template <ss_typename_param_k T>
+    inline
+    ss_size_t
+    count_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T const&    value
+    ,   no_type
+    )
+    {
+        // Independent counters, so that the comparisons do not form a
+        // single dependency chain
+        ss_size_t   r0  =   0;
+        ss_size_t   r1  =   0;
+        ss_size_t   r2  =   0;
+        ss_size_t   r3  =   0;
+        ss_size_t   i   =   0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            r0 += (value == p[i + 0]);
+            r1 += (value == p[i + 1]);
+            r2 += (value == p[i + 2]);
+            r3 += (value == p[i + 3]);
+        }
+
+        for (; i != n; ++i)
+        {
+            r0 += (value == p[i]);
+        }
+
+        return r0 + r1 + r2 + r3;
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    ss_size_t
+    count_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T const&    value
+    ,   yes_type
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        typedef sse2_<sizeof(T)>                            ops_t;
+        typedef ss_typename_type_k uint_<sizeof(T)>::type   uint_t;
+
+        enum { K = 16 / sizeof(T) };
+
+        __m128i const   needle  =   set1_(value);
+        ss_size_t       r       =   0;
+        ss_size_t       i       =   0;
+
+        // Each match subtracts -1 from its lane's counter, and the
+        // counters are summed before any of them can overflow
+
+        for (; i + K <= n; )
+        {
+            ss_size_t   numBlocks   =   (n - i) / K;
+            __m128i     counts      =   _mm_setzero_si128();
+            uint_t      lanes[K];
+
+            if (numBlocks > static_cast<ss_size_t>(ops_t::max_blocks))
+            {
+                numBlocks = static_cast<ss_size_t>(ops_t::max_blocks);
+            }
+
+            for (; 0 != numBlocks; --numBlocks, i += K)
+            {
+                counts = ops_t::sub(counts, ops_t::cmpeq(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), needle));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), counts);
+
+            for (ss_size_t j = 0; j != K; ++j)
+            {
+                r += static_cast<ss_size_t>(lanes[j]);
+            }
+        }
+
+        return r + count_(p + i, n - i, value, no_type());
+#else /* ? STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        return count_(p, n, value, no_type());
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+    }
+
+
+    // replace
+
+    template <ss_typename_param_k T>
+    inline
+    void
+    replace_(
+        T*          p
+    ,   ss_size_t   n
+    ,   T const&    oldValue
+    ,   T const&    newValue
+    ,   no_type
+    )
+    {
+        for (ss_size_t i = 0; i != n; ++i)
+        {
+            if (oldValue == p[i])
+            {
+                p[i] = newValue;
+            }
+        }
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    void
+    replace_(
+        T*          p
+    ,   ss_size_t   n
+    ,   T const&    oldValue
+    ,   T const&    newValue
+    ,   yes_type
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        typedef sse2_<sizeof(T)>    ops_t;
+
+        enum { K = 16 / sizeof(T) };
+
+        __m128i const   olds    =   set1_(oldValue);
+        __m128i const   news    =   set1_(newValue);
+        ss_size_t       i       =   0;
+
+        // Blocks without a match are not written, as with std::replace()
+
+        for (; i + K <= n; i += K)
+        {
+            __m128i* const  v   =   reinterpret_cast<__m128i*>(p + i);
+            __m128i const   x   =   _mm_loadu_si128(v);
+            __m128i const   eq  =   ops_t::cmpeq(x, olds);
+
+            if (0 != _mm_movemask_epi8(eq))
+            {
+                _mm_storeu_si128(v, select_(eq, news, x));
+            }
+        }
+
+        replace_(p + i, n - i, oldValue, newValue, no_type());
+#else /* ? STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        replace_(p, n, oldValue, newValue, no_type());
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+    }
+
+
+    // min_max
+
+    template <ss_typename_param_k T>
+    inline
+    void
+    min_max_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T*          minValue
+    ,   T*          maxValue
+    ,   no_type
+    )
+    {
+        T   mn  =   *minValue;
+        T   mx  =   *maxValue;
+
+        for (ss_size_t i = 0; i != n; ++i)
+        {
+            if (p[i] < mn)
+            {
+                mn = p[i];
+            }
+            if (mx < p[i])
+            {
+                mx = p[i];
+            }
+        }
+
+        *minValue = mn;
+        *maxValue = mx;
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    void
+    min_max_(
+        T const*    p
+    ,   ss_size_t   n
+    ,   T*          minValue
+    ,   T*          maxValue
+    ,   yes_type
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        typedef sse2_<sizeof(T)>                            ops_t;
+        typedef ss_typename_type_k uint_<sizeof(T)>::type   uint_t;
+
+        enum { K            =   16 / sizeof(T)      };
+        enum { IS_SIGNED    =   (T(-1) < T(0))      };
+
+        ss_size_t i = 0;
+
+        if (n >= K)
+        {
+            // SSE2 has only signed comparisons, so unsigned values are
+            // biased by flipping their sign bits, which maps their order
+            // onto that of the signed values
+            __m128i const   bias    =   IS_SIGNED ? _mm_setzero_si128() : ops_t::set1(static_cast<uint_t>(uint_t(1) << (8 * sizeof(T) - 1)));
+            __m128i         mn      =   _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)), bias);
+            __m128i         mx      =   mn;
+            T               lanes[K];
+
+            for (i = K; i + K <= n; i += K)
+            {
+                __m128i const x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p + i)), bias);
+
+                mn = select_(ops_t::cmpgt(mn, x), x, mn);
+                mx = select_(ops_t::cmpgt(x, mx), x, mx);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), _mm_xor_si128(mn, bias));
+            min_max_(&lanes[0], K, minValue, maxValue, no_type());
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), _mm_xor_si128(mx, bias));
+            min_max_(&lanes[0], K, minValue, maxValue, no_type());
+        }
+
+        min_max_(p + i, n - i, minValue, maxValue, no_type());
+#else /* ? STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        min_max_(p, n, minValue, maxValue, no_type());
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+    }
+
+
+    // equal
+
+    template <ss_typename_param_k T>
+    inline
+    bool
+    equal_(
+        T const*    p1
+    ,   ss_size_t   n
+    ,   T const*    p2
+    ,   no_type
+    )
+    {
+        for (ss_size_t i = 0; i != n; ++i)
+        {
+            if (!(p1[i] == p2[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    bool
+    equal_(
+        T const*    p1
+    ,   ss_size_t   n
+    ,   T const*    p2
+    ,   yes_type
+    )
+    {
+        // For integral types equality is bitwise, so the (vectorised)
+        // library memcmp() is used
+        return 0 == n || 0 == ::memcmp(p1, p2, n * sizeof(T));
+    }
+
+
+    // non-temporal copy/fill
+
+    inline
+    void
+    copy_nt_(
+        void*       dest
+    ,   void const* src
+    ,   ss_size_t   cb
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        if (cb >= 64 &&
+            cb >= static_cast<ss_size_t>(STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD))
+        {
+            ss_byte_t*          d       =   static_cast<ss_byte_t*>(dest);
+            ss_byte_t const*    s       =   static_cast<ss_byte_t const*>(src);
+            ss_size_t const     head    =   (16 - (reinterpret_cast<ss_uintptr_t>(d) & 15)) & 15;
+
+            // Streaming stores require an aligned destination, so the
+            // head is copied conventionally
+
+            STLSOFT_API_INTERNAL_memfns_memcpy(d, s, head);
+            d   +=  head;
+            s   +=  head;
+            cb  -=  head;
+
+            for (; cb >= 64; d += 64, s += 64, cb -= 64)
+            {
+                __m128i const* const    v   =   reinterpret_cast<__m128i const*>(s);
+                __m128i const           x0  =   _mm_loadu_si128(v + 0);
+                __m128i const           x1  =   _mm_loadu_si128(v + 1);
+                __m128i const           x2  =   _mm_loadu_si128(v + 2);
+                __m128i const           x3  =   _mm_loadu_si128(v + 3);
+                __m128i* const          w   =   reinterpret_cast<__m128i*>(d);
+
+                _mm_stream_si128(w + 0, x0);
+                _mm_stream_si128(w + 1, x1);
+                _mm_stream_si128(w + 2, x2);
+                _mm_stream_si128(w + 3, x3);
+            }
+
+            _mm_sfence();
+
+            STLSOFT_API_INTERNAL_memfns_memcpy(d, s, cb);
+
+            return;
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        STLSOFT_API_INTERNAL_memfns_memcpy(dest, src, cb);
+    }
+
+    template <ss_typename_param_k T>
+    inline
+    void
+    fill_n_nt_(
+        T*          dest
+    ,   ss_size_t   n
+    ,   T const&    value
+    )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        enum { K = 16 / sizeof(T) };
+
+        // The 16-byte pattern can only be formed from a whole number of
+        // elements
+        if (0 == 16 % sizeof(T) &&
+            n * sizeof(T) >= static_cast<ss_size_t>(STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD))
+        {
+            T   pattern[K];
+
+            for (ss_size_t i = 0; i != K; ++i)
+            {
+                pattern[i] = value;
+            }
+
+            for (ss_size_t i = 0; i != K && 0 != n && 0 != (reinterpret_cast<ss_uintptr_t>(dest) & 15); ++i, ++dest, --n)
+            {
+                *dest = value;
+            }
+
+            // An element type that is less aligned than its size may
+            // never reach a 16-byte boundary
+            if (0 == (reinterpret_cast<ss_uintptr_t>(dest) & 15))
+            {
+                __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&pattern[0]));
+
+                for (; n >= 4 * K; dest += 4 * K, n -= 4 * K)
+                {
+                    __m128i* const w = reinterpret_cast<__m128i*>(dest);
+
+                    _mm_stream_si128(w + 0, x);
+                    _mm_stream_si128(w + 1, x);
+                    _mm_stream_si128(w + 2, x);
+                    _mm_stream_si128(w + 3, x);
+                }
+
+                _mm_sfence();
+            }
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        std_fill_n(dest, n, value);
+    }
+
+    // Indicates whether the SIMD kernels may be used for T: integral types
+    // only, since for floating-point types (and for structures, which may
+    // have padding) bitwise equality is not value equality
+    template <ss_typename_param_k T>
+    struct use_simd_
+    {
+        enum
+        {
+            value   =   0 != is_integral_type<T>::value &&
+                        (   1 == sizeof(T) ||
+                            2 == sizeof(T) ||
+                            4 == sizeof(T) ||
+                            8 == sizeof(T))
+        };
+    };
+} /* namespace ximpl_pod */
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -447,6 +1084,301 @@ inline void pod_fill_n(unsigned char *dest, ss_size_t n, int value)
 }
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
+/** Searches a range of POD (Plain Old Data) entities for a given value
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as std::find(). For integral
+ * element types it compares 16 bytes at a time using SSE2, when available;
+ * otherwise it uses an unrolled element-wise loop.
+ *
+\code
+  const int16_t values[5] = { 1, 2, 3, 4, 5 };
+
+  assert(&values[3] == pod_find(&values[0], &values[0] + STLSOFT_NUM_ELEMENTS(values), 4));
+\endcode
+ *
+ * \param first Contiguous Iterator marking the start of the range
+ * \param last Contiguous Iterator marking the one-past-the-end of the range
+ * \param value The value to be found
+ *
+ * \return A pointer to the first element equal to \c value, or \c last if
+ *   there is none
+ */
+template<   ss_typename_param_k T
+        ,   ss_typename_param_k V
+        >
+// [[synesis:function:algorithm: pod_find(T<T>* first, T<T>* last, T<V> const& value)]]
+inline T* pod_find(T* first, T* last, V const& value)
+{
+    typedef ss_typename_type_k base_type_traits<T>::base_type               value_t;
+    typedef ss_typename_type_k value_to_yesno_type<
+        ximpl_pod::use_simd_<value_t>::value
+    >::type                                                                 yesno_t;
+
+    stlsoft_constraint_must_be_pod(value_t);
+
+    STLSOFT_ASSERT(first <= last);
+
+    value_t const v = static_cast<value_t>(value);
+
+    // A value that is not representable by the element type cannot match
+    if (!(static_cast<V>(v) == value))
+    {
+        return last;
+    }
+
+    return first + ximpl_pod::find_(static_cast<value_t const*>(first), static_cast<ss_size_t>(last - first), v, yesno_t());
+}
+
+/** Counts the elements in a range of POD (Plain Old Data) entities that
+ * are equal to a given value
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as std::count(). For integral
+ * element types it counts 16 bytes at a time using SSE2, when available;
+ * otherwise it uses an unrolled element-wise loop.
+ *
+ * \param first Contiguous Iterator marking the start of the range
+ * \param last Contiguous Iterator marking the one-past-the-end of the range
+ * \param value The value to be counted
+ */
+template<   ss_typename_param_k T
+        ,   ss_typename_param_k V
+        >
+// [[synesis:function:algorithm: pod_count(T<T>* first, T<T>* last, T<V> const& value)]]
+inline ss_size_t pod_count(T* first, T* last, V const& value)
+{
+    typedef ss_typename_type_k base_type_traits<T>::base_type               value_t;
+    typedef ss_typename_type_k value_to_yesno_type<
+        ximpl_pod::use_simd_<value_t>::value
+    >::type                                                                 yesno_t;
+
+    stlsoft_constraint_must_be_pod(value_t);
+
+    STLSOFT_ASSERT(first <= last);
+
+    value_t const v = static_cast<value_t>(value);
+
+    if (!(static_cast<V>(v) == value))
+    {
+        return 0;
+    }
+
+    return ximpl_pod::count_(static_cast<value_t const*>(first), static_cast<ss_size_t>(last - first), v, yesno_t());
+}
+
+/** Replaces each element in a range of POD (Plain Old Data) entities that
+ * is equal to a given value with another value
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as std::replace(). For integral
+ * element types it compares and blends 16 bytes at a time using SSE2, when
+ * available.
+ *
+ * \param first Contiguous Iterator marking the start of the range
+ * \param last Contiguous Iterator marking the one-past-the-end of the range
+ * \param oldValue The value to be replaced
+ * \param newValue The replacement value
+ */
+template<   ss_typename_param_k T
+        ,   ss_typename_param_k V1
+        ,   ss_typename_param_k V2
+        >
+// [[synesis:function:algorithm: pod_replace(T<T>* first, T<T>* last, T<V1> const& oldValue, T<V2> const& newValue)]]
+inline void pod_replace(T* first, T* last, V1 const& oldValue, V2 const& newValue)
+{
+    typedef ss_typename_type_k value_to_yesno_type<
+        ximpl_pod::use_simd_<T>::value
+    >::type                                                                 yesno_t;
+
+    stlsoft_constraint_must_be_pod(T);
+
+    STLSOFT_ASSERT(first <= last);
+
+    T const v = static_cast<T>(oldValue);
+
+    if (!(static_cast<V1>(v) == oldValue))
+    {
+        return;
+    }
+
+    ximpl_pod::replace_(first, static_cast<ss_size_t>(last - first), v, static_cast<T>(newValue), yesno_t());
+}
+
+/** Obtains the minimum and maximum values in a range of POD (Plain Old
+ * Data) entities, in a single pass
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * For integral element types of up to 32 bits it compares 16 bytes at a
+ * time using SSE2, when available; otherwise it uses an element-wise loop,
+ * comparing with <code>operator <()</code>.
+ *
+\code
+  const int32_t values[5] = { 3, -7, 12, 0, 5 };
+  int32_t       mn;
+  int32_t       mx;
+
+  if (pod_min_max(&values[0], &values[0] + STLSOFT_NUM_ELEMENTS(values), &mn, &mx))
+  {
+    assert(-7 == mn);
+    assert(12 == mx);
+  }
+\endcode
+ *
+ * \param first Contiguous Iterator marking the start of the range
+ * \param last Contiguous Iterator marking the one-past-the-end of the range
+ * \param minValue Pointer to a variable to receive the minimum value. May
+ *   not be \c nullptr
+ * \param maxValue Pointer to a variable to receive the maximum value. May
+ *   not be \c nullptr
+ *
+ * \retval true The range is not empty, and \c *minValue and \c *maxValue
+ *   have been set
+ * \retval false The range is empty, and \c *minValue and \c *maxValue are
+ *   unchanged
+ */
+template<   ss_typename_param_k T
+        >
+// [[synesis:function:algorithm: pod_min_max(T<T>* first, T<T>* last, T<T>* minValue, T<T>* maxValue)]]
+inline
+bool
+pod_min_max(
+    T*                                                  first
+,   T*                                                  last
+,   ss_typename_type_k base_type_traits<T>::base_type*  minValue
+,   ss_typename_type_k base_type_traits<T>::base_type*  maxValue
+)
+{
+    typedef ss_typename_type_k base_type_traits<T>::base_type               value_t;
+    typedef ss_typename_type_k value_to_yesno_type<
+        (   ximpl_pod::use_simd_<value_t>::value &&
+            sizeof(value_t) < 8)
+    >::type                                                                 yesno_t;
+
+    stlsoft_constraint_must_be_pod(value_t);
+
+    STLSOFT_ASSERT(first <= last);
+    STLSOFT_ASSERT(ss_nullptr_k != minValue);
+    STLSOFT_ASSERT(ss_nullptr_k != maxValue);
+
+    if (first == last)
+    {
+        return false;
+    }
+    else
+    {
+        *minValue = *first;
+        *maxValue = *first;
+
+        ximpl_pod::min_max_(static_cast<value_t const*>(first), static_cast<ss_size_t>(last - first), minValue, maxValue, yesno_t());
+
+        return true;
+    }
+}
+
+/** Compares two ranges of POD (Plain Old Data) entities
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as std::equal(). For integral
+ * element types it compares the ranges en bloc with ::<code>memcmp()</code>;
+ * for all others - including floating-point types, for which bitwise
+ * equality is not value equality - it compares with
+ * <code>operator ==()</code>.
+ *
+ * \note The implementation uses static assertions to ensure that the two
+ * element types are the same, disregarding cv-qualification.
+ *
+ * \param first1 Contiguous Iterator marking the start of the first range
+ * \param last1 Contiguous Iterator marking the one-past-the-end of the first range
+ * \param first2 Contiguous Iterator marking the start of the second range
+ */
+template<   ss_typename_param_k T1
+        ,   ss_typename_param_k T2
+        >
+// [[synesis:function:algorithm: pod_equal(T<T1>* first1, T<T1>* last1, T<T2>* first2)]]
+inline bool pod_equal(T1* first1, T1* last1, T2* first2)
+{
+    typedef ss_typename_type_k base_type_traits<T1>::base_type              value_t;
+    typedef ss_typename_type_k base_type_traits<T2>::base_type              value2_t;
+    typedef ss_typename_type_k value_to_yesno_type<
+        0 != is_integral_type<value_t>::value
+    >::type                                                                 yesno_t;
+
+    STLSOFT_STATIC_ASSERT((is_same_type<value_t, value2_t>::value));
+    stlsoft_constraint_must_be_pod(value_t);
+
+    STLSOFT_ASSERT(first1 <= last1);
+
+    return ximpl_pod::equal_(static_cast<value_t const*>(first1), static_cast<ss_size_t>(last1 - first1), static_cast<value_t const*>(first2), yesno_t());
+}
+
+/** Copies one range of POD (Plain Old Data) entities to another, using
+ * non-temporal stores for large ranges
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as stlsoft::pod_copy(). When the
+ * range is at least \ref STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD
+ * bytes, and SSE2 is available, the destination is written with streaming
+ * stores that bypass the cache, so that copying a buffer larger than the
+ * last-level cache does not evict the working set (nor read the
+ * destination lines in before overwriting them). It should not be used
+ * when the destination is to be read again soon.
+ *
+ * \note The implementation uses static assertions to ensure that the source and
+ * destination element types are the same size.
+ *
+ * \param first Contiguous Iterator marking the start of the source range
+ * \param last Contiguous Iterator marking the one-past-the-end of the source range
+ * \param dest Contiguous Iterator marking the start of the destination range
+ */
+template<   ss_typename_param_k I
+        ,   ss_typename_param_k O
+        >
+// [[synesis:function:algorithm: pod_copy_nt(T<I>* first, T<I>* last, T<O>* dest)]]
+inline void pod_copy_nt(I* first, I* last, O* dest)
+{
+    STLSOFT_STATIC_ASSERT(sizeof(*dest) == sizeof(*first));
+    stlsoft_constraint_must_be_pod(O);
+    stlsoft_constraint_must_be_pod(I);
+
+    STLSOFT_ASSERT(first <= last);
+
+    ximpl_pod::copy_nt_(dest, first, static_cast<ss_size_t>(last - first) * sizeof(*dest));
+}
+
+/** Sets all the elements in a range of POD (Plain Old Data) to a given
+ * value, using non-temporal stores for large ranges
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * This algorithm has the same semantics as stlsoft::pod_fill_n(). When the
+ * range is at least \ref STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD
+ * bytes, SSE2 is available, and the element size divides 16, the range is
+ * written with streaming stores that bypass the cache.
+ *
+ * \param dest Contiguous Iterator marking the start of the range
+ * \param n Number of elements in the range
+ * \param value Value to which each element in dest[0, n) will be set
+ */
+template<   ss_typename_param_k T
+        ,   ss_typename_param_k V
+        >
+// [[synesis:function:algorithm: pod_fill_n_nt(T<T>* dest, size_t n, T<V> const& value)]]
+inline void pod_fill_n_nt(T* dest, ss_size_t n, V const& value)
+{
+    stlsoft_constraint_must_be_pod(T);
+
+    T const v = static_cast<T>(value);
+
+    ximpl_pod::fill_n_nt_(dest, n, v);
+}
+
 /* ////////////////////////////////////////////////////////////////////// */
 
 #ifndef STLSOFT_NO_NAMESPACE
@@ -4,11 +4,11 @@
  * Purpose:     Algorithms for manipulating unordered sequences.
  *
  * Created:     17th January 2002
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2002-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -45,6 +45,17 @@
  *
  * \brief [C++] Algorithms for manipulating unordered sequences
  *   (\ref group__library__Algorithm "Algorithm" Library).
+ *
+ * With C++11 and later, the overloads of find_first_duplicate(),
+ * unordered_unique(), unordered_unique_copy(),
+ * remove_duplicates_from_unordered_sequence() and unordered_includes()
+ * that use the equality operator operate in (expected) linear time, by
+ * means of a hash table, when the value type is hashable by
+ * <code>std::hash</code> and the sequence has at least
+ * STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD elements; otherwise they
+ * search linearly, in quadratic time. The overloads that take a hash
+ * function and an equality predicate do likewise, irrespective of value
+ * type.
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_ALGORITHMS_HPP_UNORDERED
@@ -52,9 +63,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_MAJOR     3
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_MINOR     3
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_REVISION  7
-# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_EDIT      86
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_MINOR     5
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_REVISION  1
+# define STLSOFT_VER_STLSOFT_ALGORITHMS_HPP_UNORDERED_EDIT      88
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -74,6 +85,43 @@
 #ifdef STLSOFT_CF_std_NAMESPACE
 # include <functional>
 #endif /* STLSOFT_CF_std_NAMESPACE */
+#if __cplusplus >= 201103L
+# ifndef STLSOFT_INCL_ITERATOR
+#  define STLSOFT_INCL_ITERATOR
+#  include <iterator>
+# endif /* !STLSOFT_INCL_ITERATOR */
+# ifndef STLSOFT_INCL_TYPE_TRAITS
+#  define STLSOFT_INCL_TYPE_TRAITS
+#  include <type_traits>
+# endif /* !STLSOFT_INCL_TYPE_TRAITS */
+# ifndef STLSOFT_INCL_UNORDERED_MAP
+#  define STLSOFT_INCL_UNORDERED_MAP
+#  include <unordered_map>
+# endif /* !STLSOFT_INCL_UNORDERED_MAP */
+# ifndef STLSOFT_INCL_UNORDERED_SET
+#  define STLSOFT_INCL_UNORDERED_SET
+#  include <unordered_set>
+# endif /* !STLSOFT_INCL_UNORDERED_SET */
+# ifndef STLSOFT_INCL_UTILITY
+#  define STLSOFT_INCL_UTILITY
+#  include <utility>
+# endif /* !STLSOFT_INCL_UTILITY */
+#endif /* C++11+ */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD
+ *
+ * The sequence length at and above which the algorithms in this file use
+ * a hash table rather than linear searching. May be defined by the user
+ * before inclusion.
+ */
+#ifndef STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD
+# define STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD        (256)
+#endif /* !STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD */
 
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -85,6 +133,557 @@ namespace stlsoft
 {
 #endif /* STLSOFT_NO_NAMESPACE */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_unordered
+{
+
+    template <ss_typename_param_k I>
+    inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate_linear_(I first, I last)
+    {
+        for (; first != last; ++first)
+        {
+            I next = first;
+
+            for (++next; next != last; ++next)
+            {
+                if (*next == *first)
+                {
+                    return STLSOFT_NS_QUAL_STD(make_pair)(first, next);
+                }
+            }
+        }
+
+        return STLSOFT_NS_QUAL_STD(make_pair)(last, last);
+    }
+
+    template <ss_typename_param_k FI>
+    inline FI unordered_unique_linear_(FI first, FI last)
+    {
+        if (first != last)
+        {
+            // Because this is unordered, we need to enumerate through the
+            // elements in the sequence, and ...
+            const FI    start   =   first;
+            FI          dest    =   ++first;
+
+            for (; first != last; ++first)
+            {
+                // ... for each element in the sequence, we see if it has
+                // already in the 'accepted' sequence, and, if not, ...
+                if (dest == std_find(start, dest, *first))
+                {
+                    // ... add it into the accepted sequence at the
+                    // current point.
+                    //
+                    // Effectively, this is to overwrite the element
+                    // if the source and destination points are different,
+                    // or simply moving past it if not.
+                    if (dest != first)
+                    {
+                        *dest = *first;
+                    }
+                    ++dest;
+                }
+            }
+
+            first = dest;
+        }
+
+        return first;
+    }
+
+    // As unordered_unique_linear_(), but with an equality predicate, which
+    // need not be adaptable
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k BP
+            >
+    inline FI unordered_unique_linear_(FI first, FI last, BP const& pred)
+    {
+        FI const    start   =   first;
+        FI          dest    =   first;
+
+        for (; first != last; ++first)
+        {
+            FI it = start;
+
+            for (; it != dest && !pred(*it, *first); ++it)
+            {}
+
+            if (it == dest)
+            {
+                if (dest != first)
+                {
+                    *dest = *first;
+                }
+                ++dest;
+            }
+        }
+
+        return dest;
+    }
+
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k OI
+            >
+    inline OI unordered_unique_copy_linear_(FI first, FI last, OI dest)
+    {
+        if (first != last)
+        {
+            // Because this is unordered, we need to enumerate through the
+            // elements in the sequence, and ...
+            const OI    start   =   dest;
+
+            *dest++ = *first++;
+            for (; first != last; ++first)
+            {
+                // ... for each element in the sequence, we see if it has
+                // already in the 'accepted' sequence, and, if not, ...
+                if (dest == std_find(start, dest, *first))
+                {
+                    // ... add it into the accepted sequence at the
+                    // current point.
+                    *dest = *first;
+                    ++dest;
+                }
+            }
+        }
+
+        return dest;
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            >
+    inline ss_bool_t unordered_includes_linear_(I1 first1, I1 last1, I2 first2, I2 last2)
+    {
+        for (; first2 != last2; ++first2)
+        {
+            ss_bool_t   bFound  =   false;
+
+            for (I1 i1 = first1; i1 != last1; ++i1)
+            {
+                if (*first2 == *i1)
+                {
+                    bFound = true;
+                    break;
+                }
+            }
+
+            if (!bFound)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            ,   ss_typename_param_k BP
+            >
+    inline ss_bool_t unordered_includes_linear_(I1 first1, I1 last1, I2 first2, I2 last2, BP pred)
+    {
+        for (; first2 != last2; ++first2)
+        {
+            ss_bool_t   bFound  =   false;
+
+            for (I1 i1 = first1; i1 != last1; ++i1)
+            {
+                if (pred(*first2, *i1))
+                {
+                    bFound = true;
+                    break;
+                }
+            }
+
+            if (!bFound)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+#if __cplusplus >= 201103L
+
+    // Indicates whether T may be hashed by std::hash
+    template <ss_typename_param_k T>
+    struct is_hashable_
+    {
+    private:
+        template <ss_typename_param_k U>
+        static char (&test_(decltype(STLSOFT_NS_QUAL_STD(hash)<U>()(STLSOFT_NS_QUAL_STD(declval)<U const&>()))*))[1];
+        template <ss_typename_param_k U>
+        static char (&test_(...))[2];
+
+    public:
+        typedef STLSOFT_NS_QUAL_STD(integral_constant)<bool, 1 == sizeof(test_<T>(ss_nullptr_k))>   type;
+    };
+
+    // Adapts a hash function of values to one of (dereferenceable)
+    // iterators
+    template<   ss_typename_param_k I
+            ,   ss_typename_param_k H
+            >
+    struct iterator_hash_
+    {
+        explicit iterator_hash_(H const& h)
+            : h(h)
+        {}
+
+        ss_size_t operator ()(I const& it) const
+        {
+            return h(*it);
+        }
+
+        H   h;
+    };
+
+    // Adapts an equality predicate of values to one of (dereferenceable)
+    // iterators
+    template<   ss_typename_param_k I
+            ,   ss_typename_param_k BP
+            >
+    struct iterator_equal_
+    {
+        explicit iterator_equal_(BP const& pred)
+            : pred(pred)
+        {}
+
+        bool operator ()(I const& lhs, I const& rhs) const
+        {
+            return pred(*lhs, *rhs);
+        }
+
+        BP  pred;
+    };
+
+    template<   ss_typename_param_k I
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    struct iterator_set_
+    {
+        typedef STLSOFT_NS_QUAL_STD(unordered_set)<
+            I
+        ,   iterator_hash_<I, H>
+        ,   iterator_equal_<I, BP>
+        >                                                   type;
+    };
+
+    template <ss_typename_param_k I>
+    inline ss_size_t distance_(I first, I last)
+    {
+        return static_cast<ss_size_t>(STLSOFT_NS_QUAL_STD(distance)(first, last));
+    }
+
+    // Finds the first duplicate in the same terms as the linear algorithm:
+    // the earliest element having a later equal, paired with the first
+    // such equal
+    template<   ss_typename_param_k I
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate_hashed_(I first, I last, ss_size_t n, H const& hash, BP const& pred)
+    {
+        typedef STLSOFT_NS_QUAL_STD(unordered_map)<
+            I
+        ,   ss_size_t
+        ,   iterator_hash_<I, H>
+        ,   iterator_equal_<I, BP>
+        >                                                   map_t;
+
+        map_t                           firsts(n, iterator_hash_<I, H>(hash), iterator_equal_<I, BP>(pred));
+        STLSOFT_NS_QUAL_STD(pair)<I, I> r(last, last);
+        ss_size_t                       ri  =   n;
+        ss_size_t                       j   =   0;
+
+        for (; first != last; ++first, ++j)
+        {
+            STLSOFT_NS_QUAL_STD(pair)<ss_typename_type_k map_t::iterator, bool> const   ins = firsts.insert(STLSOFT_NS_QUAL_STD(make_pair)(first, j));
+
+            if (!ins.second &&
+                ins.first->second < ri)
+            {
+                ri  =   ins.first->second;
+                r   =   STLSOFT_NS_QUAL_STD(make_pair)(ins.first->first, first);
+
+                if (0 == ri)
+                {
+                    break;
+                }
+            }
+        }
+
+        return r;
+    }
+
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline FI unordered_unique_hashed_(FI first, FI last, ss_size_t n, H const& hash, BP const& pred)
+    {
+        typedef ss_typename_type_k iterator_set_<FI, H, BP>::type   set_t;
+
+        set_t   accepted(n, iterator_hash_<FI, H>(hash), iterator_equal_<FI, BP>(pred));
+        FI      dest    =   first;
+
+        // Each element is moved to the destination before being offered to
+        // the set, so that the set only ever refers to the accepted prefix,
+        // which is not subsequently written
+
+        for (; first != last; ++first)
+        {
+            if (dest != first)
+            {
+                *dest = STLSOFT_NS_QUAL_STD(move)(*first);
+            }
+
+            if (accepted.insert(dest).second)
+            {
+                ++dest;
+            }
+        }
+
+        return dest;
+    }
+
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k OI
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline OI unordered_unique_copy_hashed_(FI first, FI last, OI dest, ss_size_t n, H const& hash, BP const& pred)
+    {
+        typedef ss_typename_type_k iterator_set_<FI, H, BP>::type   set_t;
+
+        set_t   accepted(n, iterator_hash_<FI, H>(hash), iterator_equal_<FI, BP>(pred));
+
+        for (; first != last; ++first)
+        {
+            if (accepted.insert(first).second)
+            {
+                *dest = *first;
+                ++dest;
+            }
+        }
+
+        return dest;
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline ss_bool_t unordered_includes_hashed_(I1 first1, I1 last1, I2 first2, I2 last2, ss_size_t n1, H const& hash, BP const& pred)
+    {
+        // Keyed by address, so that the elements of the second range may
+        // be looked up without being copied
+
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<I1>::value_type value_t;
+        typedef ss_typename_type_k iterator_set_<value_t const*, H, BP>::type           set_t;
+
+        set_t   values(n1, iterator_hash_<value_t const*, H>(hash), iterator_equal_<value_t const*, BP>(pred));
+
+        for (; first1 != last1; ++first1)
+        {
+            values.insert(&*first1);
+        }
+
+        for (; first2 != last2; ++first2)
+        {
+            if (values.end() == values.find(&*first2))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <ss_typename_param_k I>
+    inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate_(I first, I last, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return find_first_duplicate_linear_(first, last);
+    }
+
+    template <ss_typename_param_k I>
+    inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate_(I first, I last, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<I>::value_type  value_t;
+
+        ss_size_t const n = distance_(first, last);
+
+        if (n >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+        {
+            return find_first_duplicate_hashed_(first, last, n, STLSOFT_NS_QUAL_STD(hash)<value_t>(), STLSOFT_NS_QUAL_STD(equal_to)<value_t>());
+        }
+        else
+        {
+            return find_first_duplicate_linear_(first, last);
+        }
+    }
+
+    template <ss_typename_param_k FI>
+    inline FI unordered_unique_(FI first, FI last, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<FI>::value_type value_t;
+
+        ss_size_t const n = distance_(first, last);
+
+        if (n >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+        {
+            return unordered_unique_hashed_(first, last, n, STLSOFT_NS_QUAL_STD(hash)<value_t>(), STLSOFT_NS_QUAL_STD(equal_to)<value_t>());
+        }
+        else
+        {
+            return unordered_unique_linear_(first, last);
+        }
+    }
+
+    template <ss_typename_param_k FI>
+    inline FI unordered_unique_(FI first, FI last, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return unordered_unique_linear_(first, last);
+    }
+
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k OI
+            >
+    inline OI unordered_unique_copy_(FI first, FI last, OI dest, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<FI>::value_type value_t;
+
+        ss_size_t const n = distance_(first, last);
+
+        if (n >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+        {
+            return unordered_unique_copy_hashed_(first, last, dest, n, STLSOFT_NS_QUAL_STD(hash)<value_t>(), STLSOFT_NS_QUAL_STD(equal_to)<value_t>());
+        }
+        else
+        {
+            return unordered_unique_copy_linear_(first, last, dest);
+        }
+    }
+
+    template<   ss_typename_param_k FI
+            ,   ss_typename_param_k OI
+            >
+    inline OI unordered_unique_copy_(FI first, FI last, OI dest, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return unordered_unique_copy_linear_(first, last, dest);
+    }
+
+    // The hashed form of unordered_includes() requires that the elements of
+    // both ranges are lvalues of the same type, since it looks them up by
+    // address ...
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            >
+    struct unordered_includes_addressable_
+    {
+        typedef STLSOFT_NS_QUAL_STD(iterator_traits)<I1>                                traits1_t;
+        typedef STLSOFT_NS_QUAL_STD(iterator_traits)<I2>                                traits2_t;
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(remove_cv)<
+            ss_typename_type_k traits1_t::value_type
+        >::type                                                                         value1_t;
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(remove_cv)<
+            ss_typename_type_k traits2_t::value_type
+        >::type                                                                         value2_t;
+
+        typedef STLSOFT_NS_QUAL_STD(integral_constant)<
+            bool
+        ,   STLSOFT_NS_QUAL_STD(is_same)<value1_t, value2_t>::value &&
+            STLSOFT_NS_QUAL_STD(is_lvalue_reference)<ss_typename_type_k traits1_t::reference>::value &&
+            STLSOFT_NS_QUAL_STD(is_lvalue_reference)<ss_typename_type_k traits2_t::reference>::value
+        >                                                                               type;
+    };
+
+    // ... and, when no hash function is given, that the type is hashable
+    // by std::hash
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            >
+    struct unordered_includes_hashable_
+    {
+        typedef ss_typename_type_k unordered_includes_addressable_<I1, I2>::value1_t    value1_t;
+
+        typedef STLSOFT_NS_QUAL_STD(integral_constant)<
+            bool
+        ,   unordered_includes_addressable_<I1, I2>::type::value &&
+            is_hashable_<value1_t>::type::value
+        >                                                                               type;
+    };
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            >
+    inline ss_bool_t unordered_includes_(I1 first1, I1 last1, I2 first2, I2 last2, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        typedef ss_typename_type_k unordered_includes_hashable_<I1, I2>::value1_t   value_t;
+
+        ss_size_t const n1 = distance_(first1, last1);
+
+        if (n1 >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+        {
+            return unordered_includes_hashed_(first1, last1, first2, last2, n1, STLSOFT_NS_QUAL_STD(hash)<value_t>(), STLSOFT_NS_QUAL_STD(equal_to)<value_t>());
+        }
+        else
+        {
+            return unordered_includes_linear_(first1, last1, first2, last2);
+        }
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            >
+    inline ss_bool_t unordered_includes_(I1 first1, I1 last1, I2 first2, I2 last2, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return unordered_includes_linear_(first1, last1, first2, last2);
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline ss_bool_t unordered_includes_(I1 first1, I1 last1, I2 first2, I2 last2, H const& hash, BP const& pred, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        ss_size_t const n1 = distance_(first1, last1);
+
+        if (n1 >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+        {
+            return unordered_includes_hashed_(first1, last1, first2, last2, n1, hash, pred);
+        }
+        else
+        {
+            return unordered_includes_linear_(first1, last1, first2, last2, pred);
+        }
+    }
+
+    template<   ss_typename_param_k I1
+            ,   ss_typename_param_k I2
+            ,   ss_typename_param_k H
+            ,   ss_typename_param_k BP
+            >
+    inline ss_bool_t unordered_includes_(I1 first1, I1 last1, I2 first2, I2 last2, H const& /* hash */, BP const& pred, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return unordered_includes_linear_(first1, last1, first2, last2, pred);
+    }
+#endif /* C++11+ */
+} /* namespace ximpl_unordered */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /* /////////////////////////////////////////////////////////////////////////
  * algorithms
  */
@@ -123,20 +722,15 @@ find_first_duplicate(
 ,   I   last
 )
 {
-    for (; first != last; ++first)
-    {
-        I next = first;
+#if __cplusplus >= 201103L
 
-        for (++next; next != last; ++next)
-        {
-            if (*next == *first)
-            {
-                return STLSOFT_NS_QUAL_STD(make_pair)(first, next);
-            }
-        }
-    }
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<I>::value_type  value_t;
 
-    return STLSOFT_NS_QUAL_STD(make_pair)(last, last);
+    return ximpl_unordered::find_first_duplicate_(first, last, ss_typename_type_k ximpl_unordered::is_hashable_<value_t>::type());
+#else /* ? C++ */
+
+    return ximpl_unordered::find_first_duplicate_linear_(first, last);
+#endif /* C++ */
 }
 
 /**
@@ -171,6 +765,44 @@ inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate(I first, I last, BP
     return STLSOFT_NS_QUAL_STD(make_pair)(last, last);
 }
 
+# if __cplusplus >= 201103L
+
+/** Finds the first duplicate item in the unordered sequence
+ *    <code>[first, last)</code>, using the given hash function and
+ *    equality predicate.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * Results are as for find_first_duplicate(first, last, pred). For
+ * sequences of at least STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD
+ * elements the search takes (expected) linear time.
+ *
+ * \param first The start of the (unordered) sequence
+ * \param last The (one past the) end point of the sequence
+ * \param hash The hash function, which must give the same result for any
+ *   two elements that are equal according to \c pred
+ * \param pred The predicate used to determine the equivalence of items
+ */
+template<   ss_typename_param_k I
+        ,   ss_typename_param_k H
+        ,   ss_typename_param_k BP
+        >
+// [[synesis:function:algorithm: find_first_duplicate(T<I> first, T<I> last, T<H> hash, T<BP> pred)]]
+inline STLSOFT_NS_QUAL_STD(pair)<I, I> find_first_duplicate(I first, I last, H hash, BP pred)
+{
+    ss_size_t const n = ximpl_unordered::distance_(first, last);
+
+    if (n >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+    {
+        return ximpl_unordered::find_first_duplicate_hashed_(first, last, n, hash, pred);
+    }
+    else
+    {
+        return find_first_duplicate(first, last, pred);
+    }
+}
+# endif /* C++11+ */
+
 #endif /* STLSOFT_CF_std_NAMESPACE */
 
 
@@ -183,37 +815,15 @@ template <ss_typename_param_k FI>
 // [[synesis:function:algorithm: unordered_unique(T<I> first, T<I> last)]]
 inline FI unordered_unique(FI first, FI last)
 {
-    if (first != last)
-    {
-        // Because this is unordered, we need to enumerate through the
-        // elements in the sequence, and ...
-        const FI    start   =   first;
-        FI          dest    =   ++first;
+#if __cplusplus >= 201103L
 
-        for (; first != last; ++first)
-        {
-            // ... for each element in the sequence, we see if it has
-            // already in the 'accepted' sequence, and, if not, ...
-            if (dest == std_find(start, dest, *first))
-            {
-                // ... add it into the accepted sequence at the
-                // current point.
-                //
-                // Effectively, this is to overwrite the element
-                // if the source and destination points are different,
-                // or simply moving past it if not.
-                if (dest != first)
-                {
-                    *dest = *first;
-                }
-                ++dest;
-            }
-        }
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<FI>::value_type value_t;
 
-        first = dest;
-    }
+    return ximpl_unordered::unordered_unique_(first, last, ss_typename_type_k ximpl_unordered::is_hashable_<value_t>::type());
+#else /* ? C++ */
 
-    return first;
+    return ximpl_unordered::unordered_unique_linear_(first, last);
+#endif /* C++ */
 }
 
 /**
@@ -264,6 +874,46 @@ inline FI unordered_unique(FI first, FI last, BP pred)
     return first;
 }
 
+#if __cplusplus >= 201103L
+
+/** Removes, from the unordered sequence <code>[first, last)</code>, all
+ *   but the first of each group of equivalent elements, using the given
+ *   hash function and equality predicate, and preserving the order of
+ *   those retained.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * For sequences of at least STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD
+ * elements the operation takes (expected) linear time.
+ *
+ * \param first The start of the (unordered) sequence
+ * \param last The (one past the) end point of the sequence
+ * \param hash The hash function, which must give the same result for any
+ *   two elements that are equal according to \c pred
+ * \param pred The predicate used to determine the equivalence of items
+ *
+ * \return The end of the retained elements
+ */
+template<   ss_typename_param_k FI
+        ,   ss_typename_param_k H
+        ,   ss_typename_param_k BP
+        >
+// [[synesis:function:algorithm: unordered_unique(T<I> first, T<I> last, T<H> hash, T<BP> pred)]]
+inline FI unordered_unique(FI first, FI last, H hash, BP pred)
+{
+    ss_size_t const n = ximpl_unordered::distance_(first, last);
+
+    if (n >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+    {
+        return ximpl_unordered::unordered_unique_hashed_(first, last, n, hash, pred);
+    }
+    else
+    {
+        return ximpl_unordered::unordered_unique_linear_(first, last, pred);
+    }
+}
+#endif /* C++11+ */
+
 /**
  *
  * \ingroup group__library__Algorithm
@@ -289,31 +939,48 @@ template<   ss_typename_param_k FI
 // [[synesis:function:algorithm: unordered_unique(T<I> first, T<I> last, T<OI> dest)]]
 inline OI unordered_unique_copy(FI first, FI last, OI dest)
 {
-    if (first != last)
-    {
-        // Because this is unordered, we need to enumerate through the
-        // elements in the sequence, and ...
-        const OI    start   =   dest;
-        FI          curr    =   first;  // The first elements is always unique
+#if __cplusplus >= 201103L
 
-        *dest++ = *first++;
-        for (; first != last; ++first)
-        {
-            // ... for each element in the sequence, we see if it has
-            // already in the 'accepted' sequence, and, if not, ...
-            if (dest == std_find(start, dest, *first))
-            {
-                // ... add it into the accepted sequence at the
-                // current point.
-                *dest = *first;
-                ++dest;
-            }
-        }
-    }
+    typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<FI>::value_type value_t;
+
+    return ximpl_unordered::unordered_unique_copy_(first, last, dest, ss_typename_type_k ximpl_unordered::is_hashable_<value_t>::type());
+#else /* ? C++ */
 
-    return dest;
+    return ximpl_unordered::unordered_unique_copy_linear_(first, last, dest);
+#endif /* C++ */
 }
 
+#if __cplusplus >= 201103L
+
+/** Copies, from the unordered sequence <code>[first, last)</code>, the
+ *   first of each group of equivalent elements, using the given hash
+ *   function and equality predicate, and preserving their order.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * Unlike unordered_unique_copy(first, last, dest), this does not read
+ * from the destination, which may therefore be a pure output iterator.
+ * The operation takes (expected) linear time.
+ *
+ * \param first The start of the (unordered) sequence
+ * \param last The (one past the) end point of the sequence
+ * \param dest The destination
+ * \param hash The hash function, which must give the same result for any
+ *   two elements that are equal according to \c pred
+ * \param pred The predicate used to determine the equivalence of items
+ */
+template<   ss_typename_param_k FI
+        ,   ss_typename_param_k OI
+        ,   ss_typename_param_k H
+        ,   ss_typename_param_k BP
+        >
+// [[synesis:function:algorithm: unordered_unique_copy(T<I> first, T<I> last, T<OI> dest, T<H> hash, T<BP> pred)]]
+inline OI unordered_unique_copy(FI first, FI last, OI dest, H hash, BP pred)
+{
+    return ximpl_unordered::unordered_unique_copy_hashed_(first, last, dest, ximpl_unordered::distance_(first, last), hash, pred);
+}
+#endif /* C++11+ */
+
 
 /** This algorithm removes duplicate entries from unordered sequences.
  *
@@ -384,8 +1051,10 @@ inline void remove_duplicates_from_unordered_sequence(C &container, BP pred)
  *
  * \ingroup group__library__Algorithm
  *
- * It necessarily runs in O(n2) time, since it must do a bubble-like double
- * pass on the sequence (in order to work with unordered sequences).
+ * It runs in O(n2) time, since it must do a bubble-like double pass on
+ * the sequence (in order to work with unordered sequences), unless the
+ * value type is hashable (see the file documentation), in which case it
+ * takes (expected) linear time.
  *
  * \param container The container
  */
@@ -395,9 +1064,54 @@ inline void remove_duplicates_from_unordered_sequence(C &container)
 {
     typedef ss_typename_type_k C::value_type    value_t;
 
+# if __cplusplus >= 201103L
+
+    if (ximpl_unordered::is_hashable_<value_t>::type::value &&
+        container.size() >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+    {
+        container.erase(unordered_unique(container.begin(), container.end()), container.end());
+
+        return;
+    }
+# endif /* C++11+ */
+
     remove_duplicates_from_unordered_sequence(container, STLSOFT_NS_QUAL_STD(equal_to)<value_t>());
 }
 
+# if __cplusplus >= 201103L
+
+/** This algorithm removes duplicate entries from unordered sequences,
+ *   using the given hash function and equality predicate.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * For containers of at least STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD
+ * elements the operation takes (expected) linear time, with the
+ * duplicates being removed by a single range erasure.
+ *
+ * \param container The container
+ * \param hash The hash function, which must give the same result for any
+ *   two elements that are equal according to \c pred
+ * \param pred The predicate used to determine the equivalence of items
+ */
+// [[synesis:function:algorithm: remove_duplicates_from_unordered_sequence(T<C> &container, T<H> hash, T<BP> pred)]]
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k H
+        ,   ss_typename_param_k BP
+        >
+inline void remove_duplicates_from_unordered_sequence(C &container, H hash, BP pred)
+{
+    if (container.size() >= STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD)
+    {
+        container.erase(unordered_unique(container.begin(), container.end(), hash, pred), container.end());
+    }
+    else
+    {
+        remove_duplicates_from_unordered_sequence(container, pred);
+    }
+}
+# endif /* C++11+ */
+
 #endif /* STLSOFT_CF_std_NAMESPACE */
 
 
@@ -441,34 +1155,82 @@ inline I skip_equal(I first, I last)
  * \ingroup group__library__Algorithm
  *
  * \note The algorithm does <i>not</i> assume that the ranges are ordered, and
- * so does linear searches. If the ranges are ordered, you should use \c std::includes
+ * so does linear searches - or, when the elements of both ranges are
+ * lvalues of the same hashable type (see the file documentation), hash
+ * lookups. If the ranges are ordered, you should use \c std::includes
  */
 template<   ss_typename_param_k I1
         ,   ss_typename_param_k I2
         >
 inline ss_bool_t unordered_includes(I1 first1, I1 last1, I2 first2, I2 last2)
 {
-    for (; first2 != last2; ++first2)
-    {
-        ss_bool_t   bFound  =   false;
+#if __cplusplus >= 201103L
 
-        for (I1 i1 = first1; i1 != last1; ++i1)
-        {
-            if (*first2 == *i1)
-            {
-                bFound = true;
-                break;
-            }
-        }
+    return ximpl_unordered::unordered_includes_(first1, last1, first2, last2, ss_typename_type_k ximpl_unordered::unordered_includes_hashable_<I1, I2>::type());
+#else /* ? C++ */
 
-        if (!bFound)
-        {
-            return false;
-        }
-    }
+    return ximpl_unordered::unordered_includes_linear_(first1, last1, first2, last2);
+#endif /* C++ */
+}
 
-    return true;
+/** Determines whether all elements from the range
+ *    <code>[first2, last2)</code> are contained within the range
+ *    <code>[first1, last1)</code>, using the given equality predicate.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * \param first1 The start of the range to be searched
+ * \param last1 The (one past the) end point of the range to be searched
+ * \param first2 The start of the range whose elements are sought
+ * \param last2 The (one past the) end point of the range whose elements
+ *   are sought
+ * \param pred The predicate used to determine the equivalence of items,
+ *   invoked as <code>pred(*i2, *i1)</code>
+ */
+template<   ss_typename_param_k I1
+        ,   ss_typename_param_k I2
+        ,   ss_typename_param_k BP
+        >
+inline ss_bool_t unordered_includes(I1 first1, I1 last1, I2 first2, I2 last2, BP pred)
+{
+    return ximpl_unordered::unordered_includes_linear_(first1, last1, first2, last2, pred);
+}
+
+#if __cplusplus >= 201103L
+
+/** Determines whether all elements from the range
+ *    <code>[first2, last2)</code> are contained within the range
+ *    <code>[first1, last1)</code>, using the given hash function and
+ *    equality predicate.
+ *
+ * \ingroup group__library__Algorithm
+ *
+ * Results are as for unordered_includes(first1, last1, first2, last2,
+ * pred). When the elements of both ranges are lvalues of the same type
+ * and <code>[first1, last1)</code> has at least
+ * STLSOFT_ALGORITHMS_UNORDERED_HASH_THRESHOLD elements the search takes
+ * (expected) linear time; otherwise it is quadratic.
+ *
+ * \param first1 The start of the range to be searched
+ * \param last1 The (one past the) end point of the range to be searched
+ * \param first2 The start of the range whose elements are sought
+ * \param last2 The (one past the) end point of the range whose elements
+ *   are sought
+ * \param hash The hash function, which must give the same result for any
+ *   two elements that are equal according to \c pred
+ * \param pred The predicate used to determine the equivalence of items
+ */
+template<   ss_typename_param_k I1
+        ,   ss_typename_param_k I2
+        ,   ss_typename_param_k H
+        ,   ss_typename_param_k BP
+        >
+// [[synesis:function:algorithm: unordered_includes(T<I1> first1, T<I1> last1, T<I2> first2, T<I2> last2, T<H> hash, T<BP> pred)]]
+inline ss_bool_t unordered_includes(I1 first1, I1 last1, I2 first2, I2 last2, H hash, BP pred)
+{
+    return ximpl_unordered::unordered_includes_(first1, last1, first2, last2, hash, pred, ss_typename_type_k ximpl_unordered::unordered_includes_addressable_<I1, I2>::type());
 }
+#endif /* C++11+ */
 
 /* ////////////////////////////////////////////////////////////////////// */
 
@@ -0,0 +1,179 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/api/internal/simd.h
+ *
+ * Purpose:     Internal discrimination of SIMD instruction set support.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* WARNING: this file contains undocumented internal features that are
+ * subject to change at any time, so if you use them it is at your own risk.
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+#define STLSOFT_INCL_STLSOFT_API_internal_h_simd
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * SIMD discrimination
+ *
+ * Support is determined solely from the compilation target - i.e. from
+ * what the compiler has been told it may emit - so there is no run-time
+ * dispatch. Defining STLSOFT_NO_SIMD suppresses all SIMD paths, leaving
+ * only the scalar implementations.
+ */
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+# undef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+# undef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+
+#if !defined(STLSOFT_NO_SIMD)
+# if 0
+# elif defined(__SSE2__)
+#  define STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+# elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+       (   defined(_M_X64) || \
+           (   defined(_M_IX86_FP) && \
+               _M_IX86_FP >= 2))
+#  define STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+# endif
+# if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT) && \
+     defined(__AVX2__)
+#  define STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+# endif
+#endif /* !STLSOFT_NO_SIMD */
+
+#if 0
+#elif defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+# ifndef STLSOFT_INCL_H_IMMINTRIN
+#  define STLSOFT_INCL_H_IMMINTRIN
+#  include <immintrin.h>
+# endif /* !STLSOFT_INCL_H_IMMINTRIN */
+#elif defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+# ifndef STLSOFT_INCL_H_EMMINTRIN
+#  define STLSOFT_INCL_H_EMMINTRIN
+#  include <emmintrin.h>
+# endif /* !STLSOFT_INCL_H_EMMINTRIN */
+#endif
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT) && \
+    defined(STLSOFT_COMPILER_IS_MSVC)
+# ifndef STLSOFT_INCL_H_INTRIN
+#  define STLSOFT_INCL_H_INTRIN
+#  include <intrin.h>
+# endif /* !STLSOFT_INCL_H_INTRIN */
+#endif
+
+/* /////////////////////////////////////////////////////////////////////////
+ * mask functions
+ */
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+/* Returns the index of the lowest set bit in a (non-zero) comparison
+ * mask, as obtained from _mm_movemask_epi8() / _mm256_movemask_epi8().
+ */
+STLSOFT_INLINE
+unsigned
+STLSOFT_API_INTERNAL_simd_mask_lowest_bit(
+    STLSOFT_NS_QUAL(ss_uint32_t) mask
+)
+{
+    STLSOFT_ASSERT(0 != mask);
+
+# if defined(STLSOFT_COMPILER_IS_MSVC)
+
+    unsigned long index;
+
+    _BitScanForward(&index, mask);
+
+    return STLSOFT_STATIC_CAST(unsigned, index);
+# else /* ? compiler */
+
+    return STLSOFT_STATIC_CAST(unsigned, __builtin_ctz(mask));
+# endif /* compiler */
+}
+
+/* Returns the index of the highest set bit in a (non-zero) comparison
+ * mask, as obtained from _mm_movemask_epi8() / _mm256_movemask_epi8().
+ */
+STLSOFT_INLINE
+unsigned
+STLSOFT_API_INTERNAL_simd_mask_highest_bit(
+    STLSOFT_NS_QUAL(ss_uint32_t) mask
+)
+{
+    STLSOFT_ASSERT(0 != mask);
+
+# if defined(STLSOFT_COMPILER_IS_MSVC)
+
+    unsigned long index;
+
+    _BitScanReverse(&index, mask);
+
+    return STLSOFT_STATIC_CAST(unsigned, index);
+# else /* ? compiler */
+
+    return 31u - STLSOFT_STATIC_CAST(unsigned, __builtin_clz(mask));
+# endif /* compiler */
+}
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,851 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/collections/strided_array_view.hpp
+ *
+ * Purpose:     Non-owning, strided views of one- and two-dimensional
+ *              arrays.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file stlsoft/collections/strided_array_view.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::strided_array_view_1d and
+ *   stlsoft::strided_array_view_2d class templates
+ *   (\ref group__library__Collection "Collection" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW
+#define STLSOFT_INCL_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW_MAJOR       1
+# define STLSOFT_VER_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW_MINOR       0
+# define STLSOFT_VER_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW_REVISION    1
+# define STLSOFT_VER_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW_EDIT        1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_STD_HPP_ITERATOR_HELPER
+# include <stlsoft/util/std/iterator_helper.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_STD_HPP_ITERATOR_HELPER */
+#ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS
+# include <stlsoft/collections/util/collections.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
+# include <stlsoft/util/std_swap.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+# include <stdexcept>                       // for std::out_of_range
+#endif /* !STLSOFT_CF_EXCEPTION_SUPPORT */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+namespace ximpl_strided_array_view
+{
+
+    // A random-access iterator over every s'th element from a base
+    // pointer. It holds the base, stride, and index, rather than a
+    // moving pointer, so that any stride - including 0 - is valid, and
+    // distance is exact.
+    template <ss_typename_param_k V>
+    class strided_iterator_
+        : public iterator_base<
+            STLSOFT_NS_QUAL_STD(random_access_iterator_tag)
+        ,   V
+        ,   ss_ptrdiff_t
+        ,   V*
+        ,   V&
+        >
+    {
+    public:
+        typedef V                                       value_type;
+        typedef strided_iterator_<V>                    class_type;
+        typedef V*                                      pointer;
+        typedef V&                                      reference;
+        typedef ss_ptrdiff_t                            difference_type;
+        typedef STLSOFT_NS_QUAL_STD(random_access_iterator_tag) iterator_category;
+
+    public:
+        strided_iterator_()
+            : m_base(ss_nullptr_k)
+            , m_stride(1)
+            , m_index(0)
+        {}
+        strided_iterator_(pointer base, difference_type stride, difference_type index)
+            : m_base(base)
+            , m_stride(stride)
+            , m_index(index)
+        {}
+        // allows conversion from iterator to const_iterator
+        template <ss_typename_param_k U>
+        strided_iterator_(strided_iterator_<U> const& rhs)
+            : m_base(rhs.base())
+            , m_stride(rhs.stride())
+            , m_index(rhs.index())
+        {}
+
+    public:
+        pointer         base() const
+        {
+            return m_base;
+        }
+        difference_type stride() const
+        {
+            return m_stride;
+        }
+        difference_type index() const
+        {
+            return m_index;
+        }
+
+    public:
+        reference operator *() const
+        {
+            return m_base[m_index * m_stride];
+        }
+        pointer operator ->() const
+        {
+            return &m_base[m_index * m_stride];
+        }
+        reference operator [](difference_type n) const
+        {
+            return m_base[(m_index + n) * m_stride];
+        }
+
+        class_type& operator ++()
+        {
+            ++m_index;
+
+            return *this;
+        }
+        class_type operator ++(int)
+        {
+            class_type r(*this);
+
+            ++m_index;
+
+            return r;
+        }
+        class_type& operator --()
+        {
+            --m_index;
+
+            return *this;
+        }
+        class_type operator --(int)
+        {
+            class_type r(*this);
+
+            --m_index;
+
+            return r;
+        }
+        class_type& operator +=(difference_type n)
+        {
+            m_index += n;
+
+            return *this;
+        }
+        class_type& operator -=(difference_type n)
+        {
+            m_index -= n;
+
+            return *this;
+        }
+        class_type operator +(difference_type n) const
+        {
+            return class_type(m_base, m_stride, m_index + n);
+        }
+        class_type operator -(difference_type n) const
+        {
+            return class_type(m_base, m_stride, m_index - n);
+        }
+        difference_type operator -(class_type const& rhs) const
+        {
+            STLSOFT_MESSAGE_ASSERT("comparing iterators from different views", m_base == rhs.m_base && m_stride == rhs.m_stride);
+
+            return m_index - rhs.m_index;
+        }
+
+        ss_bool_t operator ==(class_type const& rhs) const
+        {
+            STLSOFT_MESSAGE_ASSERT("comparing iterators from different views", m_base == rhs.m_base && m_stride == rhs.m_stride);
+
+            return m_index == rhs.m_index;
+        }
+        ss_bool_t operator !=(class_type const& rhs) const
+        {
+            return !operator ==(rhs);
+        }
+        ss_bool_t operator <(class_type const& rhs) const
+        {
+            return m_index < rhs.m_index;
+        }
+        ss_bool_t operator >(class_type const& rhs) const
+        {
+            return m_index > rhs.m_index;
+        }
+        ss_bool_t operator <=(class_type const& rhs) const
+        {
+            return m_index <= rhs.m_index;
+        }
+        ss_bool_t operator >=(class_type const& rhs) const
+        {
+            return m_index >= rhs.m_index;
+        }
+
+    private:
+        pointer         m_base;
+        difference_type m_stride;
+        difference_type m_index;
+    };
+
+    template <ss_typename_param_k V>
+    inline strided_iterator_<V> operator +(ss_ptrdiff_t n, strided_iterator_<V> const& it)
+    {
+        return it + n;
+    }
+
+} /* namespace ximpl_strided_array_view */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A non-owning view of a one-dimensional sequence of elements that
+ *    are a fixed number of elements (the stride) apart, such as a row or
+ *    a column of a matrix.
+ *
+ * \ingroup group__library__Collection
+ *
+ * \param T The element type. May be <code>const</code>-qualified, to give
+ *   a view through which the elements may not be modified
+ *
+ * The view is a (pointer, extent, stride) triple, so copying it is cheap,
+ *   and it can be passed by value into numeric kernels. It does not
+ *   extend the lifetime of the elements. As for a pointer, the constness
+ *   of the view does not apply to the elements, which are non-mutable
+ *   only if \c T is <code>const</code>-qualified.
+ */
+template <ss_typename_param_k T>
+class strided_array_view_1d
+    : public stl_collection_tag
+{
+/// \name Types
+/// @{
+public:
+    /// The value type
+    typedef T                                                       value_type;
+    /// This type
+    typedef strided_array_view_1d<T>                                class_type;
+    /// The pointer type
+    typedef value_type*                                             pointer;
+    /// The non-mutating (const) pointer type
+    typedef value_type const*                                       const_pointer;
+    /// The reference type
+    typedef value_type&                                             reference;
+    /// The non-mutating (const) reference type
+    typedef value_type const&                                       const_reference;
+    /// The size type
+    typedef ss_size_t                                               size_type;
+    /// The difference type, which is also the type of strides
+    typedef ss_ptrdiff_t                                            difference_type;
+    /// The iterator type
+    typedef ximpl_strided_array_view::strided_iterator_<T>          iterator;
+    /// The non-mutating (const) iterator type
+    typedef ximpl_strided_array_view::strided_iterator_<T const>    const_iterator;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Default constructor, creating a view of 0 size
+    strided_array_view_1d() STLSOFT_NOEXCEPT
+        : m_data(ss_nullptr_k)
+        , m_d0(0)
+        , m_s0(1)
+    {}
+    /// Constructs a view of the \c d0 elements starting at \c p, which
+    /// are \c s0 elements apart
+    ///
+    /// \param p Pointer to the first element
+    /// \param d0 The number of elements
+    /// \param s0 The stride, in elements
+    strided_array_view_1d(pointer p, size_type d0, difference_type s0 = 1) STLSOFT_NOEXCEPT
+        : m_data(p)
+        , m_d0(d0)
+        , m_s0(s0)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k != p || 0 == d0);
+    }
+    /// Converts a view of mutable elements into a view of non-mutable
+    /// elements
+    template <ss_typename_param_k U>
+    strided_array_view_1d(strided_array_view_1d<U> const& rhs) STLSOFT_NOEXCEPT
+        : m_data(rhs.data())
+        , m_d0(rhs.dimension0())
+        , m_s0(rhs.stride0())
+    {}
+
+    /// Swaps the contents between \c this and \c rhs
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        std_swap(m_data, rhs.m_data);
+        std_swap(m_d0, rhs.m_d0);
+        std_swap(m_s0, rhs.m_s0);
+    }
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// Pointer to the first element
+    pointer         data() const STLSOFT_NOEXCEPT
+    {
+        return m_data;
+    }
+    /// The number of elements
+    size_type       dimension0() const STLSOFT_NOEXCEPT
+    {
+        return m_d0;
+    }
+    /// The number of elements between successive elements
+    difference_type stride0() const STLSOFT_NOEXCEPT
+    {
+        return m_s0;
+    }
+    /// The number of elements
+    size_type       size() const STLSOFT_NOEXCEPT
+    {
+        return m_d0;
+    }
+    /// Indicates whether the view is empty
+    ss_bool_t       empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == m_d0;
+    }
+    /// Indicates whether the elements are adjacent in memory, in which
+    /// case <code>[data(), data() + size())</code> is a valid range
+    ss_bool_t       is_contiguous() const STLSOFT_NOEXCEPT
+    {
+        return 1 == m_s0 || m_d0 < 2;
+    }
+/// @}
+
+/// \name Subscripting
+/// @{
+public:
+    /// Returns the element at the given index
+    ///
+    /// \note No runtime checking of the validity of the index is provided in release builds, only a debug-time assert
+    reference       operator [](size_type i0) const
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of bounds, in strided_array_view_1d", i0 < m_d0);
+
+        return m_data[static_cast<difference_type>(i0) * m_s0];
+    }
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    /// Returns the element at the given index
+    ///
+    /// \note Throws an instance of std::out_of_range if the index is not < size()
+    reference       at(size_type i0) const
+    {
+        range_check_(i0);
+
+        return operator [](i0);
+    }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+/// @}
+
+/// \name Slicing
+/// @{
+public:
+    /// A view of the \c n elements starting at index \c first, taking
+    /// every \c step'th element
+    class_type      slice(size_type first, size_type n, difference_type step = 1) const
+    {
+        STLSOFT_MESSAGE_ASSERT("slice out of bounds, in strided_array_view_1d", 0 == n || (step >= 0 ? first + (n - 1) * static_cast<size_type>(step) < m_d0 : first < m_d0 && (n - 1) * static_cast<size_type>(-step) <= first));
+
+        return class_type(m_data + static_cast<difference_type>(first) * m_s0, n, m_s0 * step);
+    }
+/// @}
+
+/// \name Iteration
+/// @{
+public:
+    /// Begins the iteration
+    iterator        begin() const
+    {
+        return iterator(m_data, m_s0, 0);
+    }
+    /// Ends the iteration
+    iterator        end() const
+    {
+        return iterator(m_data, m_s0, static_cast<difference_type>(m_d0));
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    void range_check_(size_type i0) const
+    {
+        if (!(i0 < m_d0))
+        {
+            STLSOFT_THROW_X(STLSOFT_NS_QUAL_STD(out_of_range)("strided array view index out of range"));
+        }
+    }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+/// @}
+
+/// \name Members
+/// @{
+private:
+    pointer         m_data;
+    size_type       m_d0;
+    difference_type m_s0;
+/// @}
+};
+
+/** A non-owning view of a two-dimensional array of elements, each of whose
+ *    dimensions has its own stride, such as a matrix, a block within a
+ *    matrix, or the transpose of either.
+ *
+ * \ingroup group__library__Collection
+ *
+ * \param T The element type. May be <code>const</code>-qualified, to give
+ *   a view through which the elements may not be modified
+ *
+ * Element <code>(i0, i1)</code> is at
+ *   <code>data()[i0 * stride0() + i1 * stride1()]</code>. Row, column,
+ *   and block slices, and the transpose, are themselves views of the same
+ *   elements, obtained in constant time without copying.
+ *
+ * Numeric kernels that iterate the view with operator ()(), or with
+ *   data() and the strides, compile to the same address arithmetic as
+ *   hand-written pointer code, which is not generally the case for the
+ *   nested dimension proxies returned by the subscript operators of
+ *   stlsoft::fixed_array_2d and its siblings.
+ *
+ * Used with padded storage, the view hides the padding: the following
+ *   allocates a 1024x1024 matrix whose rows are 64-byte aligned and
+ *   padded by calc_padded_row_stride() so that a column walk does not
+ *   repeatedly evict the same cache sets:
+ *
+\code
+  typedef stlsoft::fixed_array_2d<
+      double
+  ,   stlsoft::aligned_allocator<double, 64>
+  >                                             storage_t;
+
+  storage_t                             storage(1024, stlsoft::calc_padded_row_stride<double>(1024, 64));
+  stlsoft::strided_array_view_2d<double> m = stlsoft::make_strided_array_view_2d(storage).block(0, 0, 1024, 1024);
+\endcode
+ */
+template <ss_typename_param_k T>
+class strided_array_view_2d
+    : public stl_collection_tag
+{
+/// \name Types
+/// @{
+public:
+    /// The value type
+    typedef T                                                       value_type;
+    /// This type
+    typedef strided_array_view_2d<T>                                class_type;
+    /// The view type of a row or column
+    typedef strided_array_view_1d<T>                                dimension_element_type;
+    /// The pointer type
+    typedef value_type*                                             pointer;
+    /// The non-mutating (const) pointer type
+    typedef value_type const*                                       const_pointer;
+    /// The reference type
+    typedef value_type&                                             reference;
+    /// The non-mutating (const) reference type
+    typedef value_type const&                                       const_reference;
+    /// The size type
+    typedef ss_size_t                                               size_type;
+    /// The difference type, which is also the type of strides
+    typedef ss_ptrdiff_t                                            difference_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Default constructor, creating a view of 0 size
+    strided_array_view_2d() STLSOFT_NOEXCEPT
+        : m_data(ss_nullptr_k)
+        , m_d0(0)
+        , m_d1(0)
+        , m_s0(0)
+        , m_s1(1)
+    {}
+    /// Constructs a view of the dense, row-major \c d0 x \c d1 array
+    /// starting at \c p
+    strided_array_view_2d(pointer p, size_type d0, size_type d1) STLSOFT_NOEXCEPT
+        : m_data(p)
+        , m_d0(d0)
+        , m_d1(d1)
+        , m_s0(static_cast<difference_type>(d1))
+        , m_s1(1)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k != p || 0 == d0 * d1);
+    }
+    /// Constructs a view of the \c d0 x \c d1 array starting at \c p,
+    /// with the given strides
+    ///
+    /// \param p Pointer to the element <code>(0, 0)</code>
+    /// \param d0 The number of rows
+    /// \param d1 The number of columns
+    /// \param s0 The number of elements between successive rows
+    /// \param s1 The number of elements between successive columns
+    strided_array_view_2d(pointer p, size_type d0, size_type d1, difference_type s0, difference_type s1 = 1) STLSOFT_NOEXCEPT
+        : m_data(p)
+        , m_d0(d0)
+        , m_d1(d1)
+        , m_s0(s0)
+        , m_s1(s1)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k != p || 0 == d0 * d1);
+    }
+    /// Converts a view of mutable elements into a view of non-mutable
+    /// elements
+    template <ss_typename_param_k U>
+    strided_array_view_2d(strided_array_view_2d<U> const& rhs) STLSOFT_NOEXCEPT
+        : m_data(rhs.data())
+        , m_d0(rhs.dimension0())
+        , m_d1(rhs.dimension1())
+        , m_s0(rhs.stride0())
+        , m_s1(rhs.stride1())
+    {}
+
+    /// Swaps the contents between \c this and \c rhs
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        std_swap(m_data, rhs.m_data);
+        std_swap(m_d0, rhs.m_d0);
+        std_swap(m_d1, rhs.m_d1);
+        std_swap(m_s0, rhs.m_s0);
+        std_swap(m_s1, rhs.m_s1);
+    }
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// Pointer to the element <code>(0, 0)</code>
+    pointer         data() const STLSOFT_NOEXCEPT
+    {
+        return m_data;
+    }
+    /// The number of rows
+    size_type       dimension0() const STLSOFT_NOEXCEPT
+    {
+        return m_d0;
+    }
+    /// The number of columns
+    size_type       dimension1() const STLSOFT_NOEXCEPT
+    {
+        return m_d1;
+    }
+    /// The number of elements between successive rows
+    difference_type stride0() const STLSOFT_NOEXCEPT
+    {
+        return m_s0;
+    }
+    /// The number of elements between successive columns
+    difference_type stride1() const STLSOFT_NOEXCEPT
+    {
+        return m_s1;
+    }
+    /// The number of elements
+    size_type       size() const STLSOFT_NOEXCEPT
+    {
+        return m_d0 * m_d1;
+    }
+    /// Indicates whether the view is empty
+    ss_bool_t       empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == size();
+    }
+    /// Indicates whether the elements are adjacent in memory, in
+    /// row-major order, in which case <code>[data(), data() + size())</code>
+    /// is a valid range
+    ss_bool_t       is_contiguous() const STLSOFT_NOEXCEPT
+    {
+        return  empty() ||
+                (   (1 == m_s1 || m_d1 < 2) &&
+                    (static_cast<difference_type>(m_d1) == m_s0 || m_d0 < 2));
+    }
+/// @}
+
+/// \name Subscripting
+/// @{
+public:
+    /// Returns the element at the given indexes
+    ///
+    /// \note No runtime checking of the validity of the indexes is provided in release builds, only a debug-time assert
+    reference       operator ()(size_type i0, size_type i1) const
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of bounds, in strided_array_view_2d", i0 < m_d0 && i1 < m_d1);
+
+        return m_data[static_cast<difference_type>(i0) * m_s0 + static_cast<difference_type>(i1) * m_s1];
+    }
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    /// Returns the element at the given indexes
+    ///
+    /// \note Throws an instance of std::out_of_range if either index is out of range
+    reference       at(size_type i0, size_type i1) const
+    {
+        range_check_(i0, i1);
+
+        return operator ()(i0, i1);
+    }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+    /// Returns a view of the given row
+    dimension_element_type  operator [](size_type i0) const
+    {
+        return row(i0);
+    }
+/// @}
+
+/// \name Slicing
+/// @{
+public:
+    /// Returns a view of the given row
+    dimension_element_type  row(size_type i0) const
+    {
+        STLSOFT_MESSAGE_ASSERT("row out of bounds, in strided_array_view_2d", i0 < m_d0);
+
+        return dimension_element_type(m_data + static_cast<difference_type>(i0) * m_s0, m_d1, m_s1);
+    }
+    /// Returns a view of the given column
+    dimension_element_type  column(size_type i1) const
+    {
+        STLSOFT_MESSAGE_ASSERT("column out of bounds, in strided_array_view_2d", i1 < m_d1);
+
+        return dimension_element_type(m_data + static_cast<difference_type>(i1) * m_s1, m_d0, m_s0);
+    }
+    /// Returns a view of the \c n0 x \c n1 block whose first element is
+    /// <code>(i0, i1)</code>
+    class_type              block(size_type i0, size_type i1, size_type n0, size_type n1) const
+    {
+        STLSOFT_MESSAGE_ASSERT("block out of bounds, in strided_array_view_2d", i0 + n0 <= m_d0 && i1 + n1 <= m_d1);
+
+        return class_type(m_data + static_cast<difference_type>(i0) * m_s0 + static_cast<difference_type>(i1) * m_s1, n0, n1, m_s0, m_s1);
+    }
+    /// Returns a view of the transpose, in which element
+    /// <code>(i1, i0)</code> is this view's <code>(i0, i1)</code>
+    class_type              transpose() const
+    {
+        return class_type(m_data, m_d1, m_d0, m_s1, m_s0);
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    void range_check_(size_type i0, size_type i1) const
+    {
+        if (!(i0 < m_d0) ||
+            !(i1 < m_d1))
+        {
+            STLSOFT_THROW_X(STLSOFT_NS_QUAL_STD(out_of_range)("strided array view index out of range"));
+        }
+    }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+/// @}
+
+/// \name Members
+/// @{
+private:
+    pointer         m_data;
+    size_type       m_d0;
+    size_type       m_d1;
+    difference_type m_s0;
+    difference_type m_s1;
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Calculates a row stride, in elements, for a row-major array of \c d1
+ *   columns of \c T, that is a whole number of \c alignment -byte units
+ *   and that is an odd number of them.
+ *
+ * \ingroup group__library__Collection
+ *
+ * \param d1 The number of columns
+ * \param alignment The unit, in bytes, which should be the cache line size
+ *   (and the alignment of the storage). Must be a multiple of
+ *   <code>sizeof(T)</code>, otherwise \c d1 is returned
+ *
+ * A row stride that is a large power of two, such as the 8192 bytes of a
+ *   row of 1024 <code>double</code>s, maps every element of a column onto
+ *   the same few cache sets, so that walking a column (as in a transpose,
+ *   or a matrix multiplication) misses on almost every access. An odd
+ *   number of cache lines spreads the column across all sets.
+ */
+template <ss_typename_param_k T>
+inline
+ss_size_t
+calc_padded_row_stride(
+    ss_size_t   d1
+,   ss_size_t   alignment = 64
+) STLSOFT_NOEXCEPT
+{
+    if (alignment < sizeof(T) ||
+        0 != (alignment % sizeof(T)))
+    {
+        return d1;
+    }
+    else
+    {
+        ss_size_t const perUnit =   alignment / sizeof(T);
+        ss_size_t       units   =   (d1 + perUnit - 1) / perUnit;
+
+        if (units > 1 &&
+            0 == (units % 2))
+        {
+            ++units;
+        }
+
+        return units * perUnit;
+    }
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * creator functions
+ */
+
+/** Creates a view of a one-dimensional array type, such as
+ *   stlsoft::fixed_array_1d or std::vector, that provides \c data() and
+ *   \c size().
+ *
+ * \ingroup group__library__Collection
+ */
+template <ss_typename_param_k A>
+inline strided_array_view_1d<ss_typename_type_k A::value_type> make_strided_array_view_1d(A& ar)
+{
+    return strided_array_view_1d<ss_typename_type_k A::value_type>(ar.data(), ar.size());
+}
+
+/** Creates a view of a one-dimensional array type, such as
+ *   stlsoft::fixed_array_1d or std::vector, that provides \c data() and
+ *   \c size().
+ *
+ * \ingroup group__library__Collection
+ */
+template <ss_typename_param_k A>
+inline strided_array_view_1d<ss_typename_type_k A::value_type const> make_strided_array_view_1d(A const& ar)
+{
+    return strided_array_view_1d<ss_typename_type_k A::value_type const>(ar.data(), ar.size());
+}
+
+/** Creates a view of a dense, row-major two-dimensional array type, such
+ *   as stlsoft::fixed_array_2d (or a plane of stlsoft::fixed_array_3d), that
+ *   provides \c data(), \c dimension0() and \c dimension1().
+ *
+ * \ingroup group__library__Collection
+ */
+template <ss_typename_param_k A>
+inline strided_array_view_2d<ss_typename_type_k A::value_type> make_strided_array_view_2d(A& ar)
+{
+    return strided_array_view_2d<ss_typename_type_k A::value_type>(ar.data(), ar.dimension0(), ar.dimension1());
+}
+
+/** Creates a view of a dense, row-major two-dimensional array type, such
+ *   as stlsoft::fixed_array_2d (or a plane of stlsoft::fixed_array_3d), that
+ *   provides \c data(), \c dimension0() and \c dimension1().
+ *
+ * \ingroup group__library__Collection
+ */
+template <ss_typename_param_k A>
+inline strided_array_view_2d<ss_typename_type_k A::value_type const> make_strided_array_view_2d(A const& ar)
+{
+    return strided_array_view_2d<ss_typename_type_k A::value_type const>(ar.data(), ar.dimension0(), ar.dimension1());
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_HPP_STRIDED_ARRAY_VIEW */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,1035 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/containers/dynamic_bitset.hpp
+ *
+ * Purpose:     A compact, resizable bitset, with rank/select.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/containers/dynamic_bitset.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::dynamic_bitset container class
+ *   template
+ *   (\ref group__library__Container "Container" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET
+#define STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET_MAJOR    1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET_MINOR    0
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET_REVISION 2
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET_EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_ALLOCATOR_SELECTOR
+# include <stlsoft/memory/util/allocator_selector.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_ALLOCATOR_SELECTOR */
+#ifndef STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS
+# include <stlsoft/collections/util/collections.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_COLLECTIONS_UTIL_HPP_COLLECTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS
+# include <stlsoft/util/bits/bitmap_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS
+# include <stlsoft/util/bits/count_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
+# include <stlsoft/util/bits/test_functions.h>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
+# include <stlsoft/util/std_swap.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
+
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>                                  // for std::bad_alloc
+#endif /* !STLSOFT_INCL_NEW */
+#ifndef STLSOFT_INCL_STDEXCEPT
+# define STLSOFT_INCL_STDEXCEPT
+# include <stdexcept>                            // for std::out_of_range
+#endif /* !STLSOFT_INCL_STDEXCEPT */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>                             // for memcmp(), memset()
+#endif /* !STLSOFT_INCL_H_STRING */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A compact, resizable sequence of bits.
+ *
+ * \ingroup group__library__Container
+ *
+ * The bits are held in 64-bit words in an auto_buffer, so that bitsets of
+ * up to <code>64 * V_internalWords</code> bits require no allocation.
+ * Whole-set operations work a word at a time (using the bitmap functions
+ * in stlsoft/util/bits), and set bits are enumerated by
+ * <code>find_first()</code> / <code>find_next()</code> using bit-scan
+ * instructions, rather than by testing each bit.
+ *
+ * <code>rank()</code> and <code>select()</code> are linear in the size of
+ * the set, unless a rank index has been built by
+ * <code>build_rank_index()</code>, in which case they are constant-time
+ * and logarithmic-time, respectively. The index is discarded by any
+ * operation that changes the bits.
+ *
+ * \tparam V_internalWords The number of words held in the internal buffer
+ * \tparam T_allocator The allocator type
+ */
+template<
+    ss_size_t           V_internalWords =   4
+,   ss_typename_param_k T_allocator     =   ss_typename_type_def_k allocator_selector<ss_uint64_t>::allocator_type
+>
+class dynamic_bitset
+    : public stl_collection_tag
+{
+public: // types
+    /// This type
+    typedef dynamic_bitset<
+        V_internalWords
+    ,   T_allocator
+    >                                                       class_type;
+    /// The word type
+    typedef ss_uint64_t                                     word_type;
+    /// The allocator type
+    typedef T_allocator                                     allocator_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The boolean type
+    typedef ss_bool_t                                       bool_type;
+private:
+    typedef auto_buffer_old<
+        word_type
+    ,   allocator_type
+    ,   V_internalWords
+    >                                                       words_type_;
+    typedef auto_buffer_old<
+        size_type
+    ,   ss_typename_type_k allocator_selector<size_type>::allocator_type
+    ,   1
+    >                                                       ranks_type_;
+
+public: // constants
+    enum
+    {
+        /// The number of bits in each word
+        bits_per_word   =   64
+    ,   /// The number of words in each block of the rank index
+        words_per_block =   8
+    };
+
+    /// The value returned by <code>find_first()</code>,
+    /// <code>find_next()</code> and <code>select()</code> when there is no
+    /// such bit
+    static size_type const npos = ~size_type(0);
+
+public: // construction
+    /// Creates an instance with \c numBits bits, each of which is set to
+    /// \c value
+    ///
+    /// \exception std::bad_alloc If the storage cannot be allocated, when
+    ///   exception support is enabled; otherwise the instance is empty
+    ss_explicit_k
+    dynamic_bitset(
+        size_type   numBits =   0
+    ,   bool_type   value   =   false
+    )
+        : m_numBits(0)
+        , m_words(0)
+        , m_ranks(0)
+        , m_hasRanks(false)
+    {
+        resize(numBits, value);
+
+        STLSOFT_ASSERT(is_valid_());
+    }
+    /// Creates an instance with the same bits as \c rhs
+    ///
+    /// \exception std::bad_alloc If the storage cannot be allocated, when
+    ///   exception support is enabled; otherwise the instance is empty
+    dynamic_bitset(class_type const& rhs)
+        : m_numBits(0)
+        , m_words(0)
+        , m_ranks(0)
+        , m_hasRanks(false)
+    {
+        resize(rhs.size());
+
+        copy_words_(m_words.data(), rhs.m_words.data(), num_words());
+
+        STLSOFT_ASSERT(is_valid_());
+    }
+#ifdef STLSOFT_CF_RVALUE_REFERENCES_SUPPORT
+    /// Creates an instance by taking over the state of \c rhs, which is
+    /// left empty
+    dynamic_bitset(class_type&& rhs) STLSOFT_NOEXCEPT
+        : m_numBits(0)
+        , m_words(0)
+        , m_ranks(0)
+        , m_hasRanks(false)
+    {
+        swap(rhs);
+    }
+#endif /* STLSOFT_CF_RVALUE_REFERENCES_SUPPORT */
+
+    /// Copy-assigns the bits of \c rhs
+    class_type& operator =(class_type const& rhs)
+    {
+        class_type t(rhs);
+
+        t.swap(*this);
+
+        return *this;
+    }
+
+public: // attributes
+    /// The number of bits
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_numBits;
+    }
+
+    /// Indicates whether there are no bits
+    bool_type empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == m_numBits;
+    }
+
+    /// The number of bits that may be held without reallocation
+    size_type capacity() const STLSOFT_NOEXCEPT
+    {
+        return m_words.size() * bits_per_word;
+    }
+
+    /// The number of words used to hold the bits
+    size_type num_words() const STLSOFT_NOEXCEPT
+    {
+        return words_for_(m_numBits);
+    }
+
+    /// Pointer to the words holding the bits, of which there are
+    /// <code>num_words()</code>. Bit \c i is held in bit
+    /// <code>i % 64</code> of word <code>i / 64</code>, and any bits in the
+    /// last word beyond <code>size()</code> are zero
+    word_type const* data() const STLSOFT_NOEXCEPT
+    {
+        return m_words.data();
+    }
+
+    /// Indicates whether the rank index is present
+    bool_type has_rank_index() const STLSOFT_NOEXCEPT
+    {
+        return m_hasRanks;
+    }
+
+public: // accessors
+    /// Indicates whether the bit at \c pos is set
+    ///
+    /// \pre pos < size()
+    bool_type operator [](size_type pos) const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", pos < size());
+
+        return 0 != (m_words.data()[pos / bits_per_word] & bit_(pos));
+    }
+
+    /// Indicates whether the bit at \c pos is set
+    ///
+    /// \exception std::out_of_range If <code>pos >= size()</code>
+    bool_type test(size_type pos) const
+    {
+        range_check_(pos);
+
+        return operator [](pos);
+    }
+
+    /// The number of set bits
+    size_type count() const STLSOFT_NOEXCEPT
+    {
+        return count_bits_over_range(m_words.data(), num_words());
+    }
+
+    /// Indicates whether any bits are set
+    bool_type any() const STLSOFT_NOEXCEPT
+    {
+        return npos != find_first();
+    }
+
+    /// Indicates whether no bits are set
+    bool_type none() const STLSOFT_NOEXCEPT
+    {
+        return npos == find_first();
+    }
+
+    /// Indicates whether all bits are set. Returns \c true when
+    /// <code>empty()</code>
+    bool_type all() const STLSOFT_NOEXCEPT
+    {
+        size_type const         n   =   m_numBits / bits_per_word;
+        word_type const* const  w   =   m_words.data();
+
+        { for (size_type i = 0; i != n; ++i)
+        {
+            if (~word_type(0) != w[i])
+            {
+                return false;
+            }
+        }}
+
+        return (0 == m_numBits % bits_per_word) || (tail_mask_() == w[n]);
+    }
+
+public: // search
+    /// The position of the first set bit, or <code>npos</code> if no bits
+    /// are set
+    size_type find_first() const STLSOFT_NOEXCEPT
+    {
+        return find_from_word_(0);
+    }
+
+    /// The position of the first set bit after \c pos, or
+    /// <code>npos</code> if there is none
+    size_type find_next(size_type pos) const STLSOFT_NOEXCEPT
+    {
+        ++pos;
+
+        if (pos >= m_numBits)
+        {
+            return npos;
+        }
+        else
+        {
+            size_type const index   =   pos / bits_per_word;
+            word_type const w       =   m_words.data()[index] & (~word_type(0) << (pos % bits_per_word));
+
+            if (0 != w)
+            {
+                return index * bits_per_word + (find_lowest_bit(w) - 1);
+            }
+
+            return find_from_word_(index + 1);
+        }
+    }
+
+    /// The number of set bits in the range <code>[0, pos)</code>
+    ///
+    /// \pre pos <= size()
+    ///
+    /// \note Constant-time when the rank index is present, otherwise
+    ///   linear
+    size_type rank(size_type pos) const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", pos <= size());
+
+        word_type const* const  w       =   m_words.data();
+        size_type const         index   =   pos / bits_per_word;
+        size_type               r;
+        size_type               i;
+
+        if (m_hasRanks)
+        {
+            size_type const block = index / words_per_block;
+
+            r   =   m_ranks.data()[block];
+            i   =   block * words_per_block;
+        }
+        else
+        {
+            r   =   0;
+            i   =   0;
+        }
+
+        r += count_bits_over_range(w + i, index - i);
+
+        if (0 != pos % bits_per_word)
+        {
+            r += count_bits(w[index] & ~(~word_type(0) << (pos % bits_per_word)));
+        }
+
+        return r;
+    }
+
+    /// The position of the set bit with the given (0-based) ordinal, or
+    /// <code>npos</code> if <code>n >= count()</code>
+    ///
+    /// \note Logarithmic-time when the rank index is present, otherwise
+    ///   linear
+    size_type select(size_type n) const STLSOFT_NOEXCEPT
+    {
+        word_type const* const  w       =   m_words.data();
+        size_type const         nw      =   num_words();
+        size_type               i       =   0;
+
+        if (m_hasRanks)
+        {
+            // find the last block whose starting rank is <= n
+            size_type const* const  ranks   =   m_ranks.data();
+            size_type               lo      =   0;
+            size_type               hi      =   num_blocks_();
+
+            if (n >= ranks[hi])
+            {
+                return npos;
+            }
+
+            for (; hi - lo > 1; )
+            {
+                size_type const mid = lo + (hi - lo) / 2;
+
+                if (ranks[mid] <= n)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+
+            n   -=  ranks[lo];
+            i   =   lo * words_per_block;
+        }
+
+        for (; i != nw; ++i)
+        {
+            size_type const c = count_bits(w[i]);
+
+            if (n < c)
+            {
+                word_type v = w[i];
+
+                for (; 0 != n; --n)
+                {
+                    v &= v - 1;
+                }
+
+                return i * bits_per_word + (find_lowest_bit(v) - 1);
+            }
+
+            n -= c;
+        }
+
+        return npos;
+    }
+
+public: // modifiers
+    /// Sets the bit at \c pos to \c value
+    ///
+    /// \pre pos < size()
+    class_type& set(size_type pos, bool_type value = true) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", pos < size());
+
+        m_hasRanks = false;
+
+        if (value)
+        {
+            m_words.data()[pos / bits_per_word] |= bit_(pos);
+        }
+        else
+        {
+            m_words.data()[pos / bits_per_word] &= ~bit_(pos);
+        }
+
+        return *this;
+    }
+
+    /// Clears the bit at \c pos
+    ///
+    /// \pre pos < size()
+    class_type& reset(size_type pos) STLSOFT_NOEXCEPT
+    {
+        return set(pos, false);
+    }
+
+    /// Inverts the bit at \c pos
+    ///
+    /// \pre pos < size()
+    class_type& flip(size_type pos) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("index out of range", pos < size());
+
+        m_hasRanks = false;
+
+        m_words.data()[pos / bits_per_word] ^= bit_(pos);
+
+        return *this;
+    }
+
+    /// Sets all bits
+    class_type& set() STLSOFT_NOEXCEPT
+    {
+        m_hasRanks = false;
+
+        fill_words_(m_words.data(), num_words(), ~word_type(0));
+        trim_();
+
+        return *this;
+    }
+
+    /// Clears all bits
+    class_type& reset() STLSOFT_NOEXCEPT
+    {
+        m_hasRanks = false;
+
+        fill_words_(m_words.data(), num_words(), 0);
+
+        return *this;
+    }
+
+    /// Inverts all bits
+    class_type& flip() STLSOFT_NOEXCEPT
+    {
+        word_type* const    w   =   m_words.data();
+        size_type const     n   =   num_words();
+
+        m_hasRanks = false;
+
+        { for (size_type i = 0; i != n; ++i)
+        {
+            w[i] = ~w[i];
+        }}
+        trim_();
+
+        return *this;
+    }
+
+    /// Changes the number of bits to \c numBits, setting any new bits to
+    /// \c value
+    ///
+    /// \exception std::bad_alloc If the storage cannot be allocated, when
+    ///   exception support is enabled; the instance is unchanged
+    ///
+    /// \retval true The instance has been resized
+    /// \retval false The storage could not be allocated, when exception
+    ///   support is not enabled; the instance is unchanged
+    bool_type resize(size_type numBits, bool_type value = false)
+    {
+        size_type const oldBits     =   m_numBits;
+        size_type const oldWords    =   num_words();
+        size_type const newWords    =   words_for_(numBits);
+
+        if (newWords > m_words.size())
+        {
+            // grow geometrically, so that push_back() is amortised
+            // constant-time, but settle for the exact size if the larger
+            // allocation fails
+            size_type const n = (newWords < 2 * m_words.size()) ? 2 * m_words.size() : newWords;
+
+            if (!m_words.resize(n) &&
+                (n == newWords ||
+                 !m_words.resize(newWords)))
+            {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+                STLSOFT_THROW_X(STLSOFT_NS_QUAL_STD(bad_alloc)());
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+                return false;
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            }
+        }
+
+        m_hasRanks = false;
+
+        if (newWords > oldWords)
+        {
+            fill_words_(m_words.data() + oldWords, newWords - oldWords, value ? ~word_type(0) : 0);
+        }
+
+        if (value &&
+            0 != oldBits % bits_per_word &&
+            numBits > oldBits)
+        {
+            m_words.data()[oldWords - 1] |= ~word_type(0) << (oldBits % bits_per_word);
+        }
+
+        m_numBits = numBits;
+
+        trim_();
+
+        STLSOFT_ASSERT(is_valid_());
+
+        return true;
+    }
+
+    /// Appends a bit with the given value
+    ///
+    /// \exception std::bad_alloc If the storage cannot be allocated, when
+    ///   exception support is enabled; the instance is unchanged
+    ///
+    /// \retval true The bit has been appended
+    /// \retval false The storage could not be allocated, when exception
+    ///   support is not enabled; the instance is unchanged
+    bool_type push_back(bool_type value)
+    {
+        size_type const pos = m_numBits;
+
+        if (!resize(pos + 1))
+        {
+            return false;
+        }
+
+        if (value)
+        {
+            m_words.data()[pos / bits_per_word] |= bit_(pos);
+        }
+
+        return true;
+    }
+
+    /// Removes all bits, releasing any allocated storage
+    void clear() STLSOFT_NOEXCEPT
+    {
+        m_numBits   =   0;
+        m_hasRanks  =   false;
+
+        m_words.resize(0);
+        m_ranks.resize(0);
+    }
+
+    /// Swaps the state of the given instance with this instance
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        std_swap(m_numBits, rhs.m_numBits);
+        m_words.swap(rhs.m_words);
+        m_ranks.swap(rhs.m_ranks);
+        std_swap(m_hasRanks, rhs.m_hasRanks);
+    }
+
+public: // set operations
+    /// Intersects with \c rhs
+    ///
+    /// \pre size() == rhs.size()
+    class_type& operator &=(class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("bitsets must be the same size", size() == rhs.size());
+
+        m_hasRanks = false;
+
+        bitmap_and(m_words.data(), m_words.data(), rhs.m_words.data(), num_words());
+
+        return *this;
+    }
+
+    /// Unites with \c rhs
+    ///
+    /// \pre size() == rhs.size()
+    class_type& operator |=(class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("bitsets must be the same size", size() == rhs.size());
+
+        m_hasRanks = false;
+
+        bitmap_or(m_words.data(), m_words.data(), rhs.m_words.data(), num_words());
+
+        return *this;
+    }
+
+    /// Takes the symmetric difference with \c rhs
+    ///
+    /// \pre size() == rhs.size()
+    class_type& operator ^=(class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("bitsets must be the same size", size() == rhs.size());
+
+        m_hasRanks = false;
+
+        bitmap_xor(m_words.data(), m_words.data(), rhs.m_words.data(), num_words());
+
+        return *this;
+    }
+
+    /// Clears all bits that are set in \c rhs
+    ///
+    /// \pre size() == rhs.size()
+    class_type& operator -=(class_type const& rhs) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("bitsets must be the same size", size() == rhs.size());
+
+        m_hasRanks = false;
+
+        bitmap_andnot(m_words.data(), m_words.data(), rhs.m_words.data(), num_words());
+
+        return *this;
+    }
+
+    /// Indicates whether any bit is set in both this instance and \c rhs
+    ///
+    /// \pre size() == rhs.size()
+    bool_type intersects(class_type const& rhs) const STLSOFT_NOEXCEPT
+    {
+        STLSOFT_MESSAGE_ASSERT("bitsets must be the same size", size() == rhs.size());
+
+        word_type const* const  l   =   m_words.data();
+        word_type const* const  r   =   rhs.m_words.data();
+        size_type const         n   =   num_words();
+
+        { for (size_type i = 0; i != n; ++i)
+        {
+            if (0 != (l[i] & r[i]))
+            {
+                return true;
+            }
+        }}
+
+        return false;
+    }
+
+    /// Indicates whether the instance has the same bits as \c rhs
+    bool_type equal(class_type const& rhs) const STLSOFT_NOEXCEPT
+    {
+        return  size() == rhs.size() &&
+                0 == ::memcmp(m_words.data(), rhs.m_words.data(), sizeof(word_type) * num_words());
+    }
+
+public: // rank index
+    /// Builds the rank index, which holds the number of set bits preceding
+    /// each block of <code>words_per_block</code> words, making
+    /// <code>rank()</code> constant-time and <code>select()</code>
+    /// logarithmic-time until the bits are next changed
+    void build_rank_index()
+    {
+        size_type const nb = num_blocks_();
+
+        if (!m_ranks.resize(nb + 1))
+        {
+            return;
+        }
+
+        word_type const* const  w       =   m_words.data();
+        size_type const         nw      =   num_words();
+        size_type* const        ranks   =   m_ranks.data();
+        size_type               total   =   0;
+
+        { for (size_type b = 0; b != nb; ++b)
+        {
+            size_type const first   =   b * words_per_block;
+            size_type const n       =   (nw - first < size_type(words_per_block)) ? nw - first : size_type(words_per_block);
+
+            ranks[b] = total;
+
+            total += count_bits_over_range(w + first, n);
+        }}
+        ranks[nb] = total;
+
+        m_hasRanks = true;
+    }
+
+    /// Discards the rank index
+    void drop_rank_index() STLSOFT_NOEXCEPT
+    {
+        m_hasRanks = false;
+
+        m_ranks.resize(0);
+    }
+
+private: // implementation
+    static size_type words_for_(size_type numBits) STLSOFT_NOEXCEPT
+    {
+        return (numBits + (bits_per_word - 1)) / bits_per_word;
+    }
+
+    static word_type bit_(size_type pos) STLSOFT_NOEXCEPT
+    {
+        return word_type(1) << (pos % bits_per_word);
+    }
+
+    static void copy_words_(word_type* dest, word_type const* src, size_type n) STLSOFT_NOEXCEPT
+    {
+        if (0 != n)
+        {
+            ::memcpy(dest, src, sizeof(word_type) * n);
+        }
+    }
+
+    static void fill_words_(word_type* dest, size_type n, word_type value) STLSOFT_NOEXCEPT
+    {
+        { for (size_type i = 0; i != n; ++i)
+        {
+            dest[i] = value;
+        }}
+    }
+
+    size_type num_blocks_() const STLSOFT_NOEXCEPT
+    {
+        return (num_words() + (words_per_block - 1)) / words_per_block;
+    }
+
+    word_type tail_mask_() const STLSOFT_NOEXCEPT
+    {
+        return ~(~word_type(0) << (m_numBits % bits_per_word));
+    }
+
+    // Clears the bits of the last word that lie beyond size()
+    void trim_() STLSOFT_NOEXCEPT
+    {
+        if (0 != m_numBits % bits_per_word)
+        {
+            m_words.data()[num_words() - 1] &= tail_mask_();
+        }
+    }
+
+    size_type find_from_word_(size_type index) const STLSOFT_NOEXCEPT
+    {
+        word_type const* const  w   =   m_words.data();
+        size_type const         n   =   num_words();
+
+        { for (; index != n; ++index)
+        {
+            if (0 != w[index])
+            {
+                return index * bits_per_word + (find_lowest_bit(w[index]) - 1);
+            }
+        }}
+
+        return npos;
+    }
+
+    void range_check_(size_type pos) const
+    {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+
+        if (!(pos < size()))
+        {
+            STLSOFT_THROW_X(STLSOFT_NS_QUAL_STD(out_of_range)("dynamic bitset index out of range"));
+        }
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        STLSOFT_MESSAGE_ASSERT("dynamic bitset index out of range", pos < size());
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+    }
+
+    bool_type is_valid_() const STLSOFT_NOEXCEPT
+    {
+        if (m_words.size() < num_words())
+        {
+            return false;
+        }
+
+        if (0 != m_numBits % bits_per_word &&
+            0 != (m_words.data()[num_words() - 1] & ~tail_mask_()))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+private: // fields
+    size_type   m_numBits;
+    words_type_ m_words;
+    ranks_type_ m_ranks;
+    bool_type   m_hasRanks;
+};
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+/* static */ ss_typename_type_k dynamic_bitset<V_internalWords, T_allocator>::size_type const dynamic_bitset<V_internalWords, T_allocator>::npos;
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * operators
+ */
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+ss_bool_t
+operator ==(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    return lhs.equal(rhs);
+}
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+ss_bool_t
+operator !=(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    return !lhs.equal(rhs);
+}
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+dynamic_bitset<V_internalWords, T_allocator>
+operator &(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    dynamic_bitset<V_internalWords, T_allocator> r(lhs);
+
+    r &= rhs;
+
+    return r;
+}
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+dynamic_bitset<V_internalWords, T_allocator>
+operator |(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    dynamic_bitset<V_internalWords, T_allocator> r(lhs);
+
+    r |= rhs;
+
+    return r;
+}
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+dynamic_bitset<V_internalWords, T_allocator>
+operator ^(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    dynamic_bitset<V_internalWords, T_allocator> r(lhs);
+
+    r ^= rhs;
+
+    return r;
+}
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline
+dynamic_bitset<V_internalWords, T_allocator>
+operator -(
+    dynamic_bitset<V_internalWords, T_allocator> const& lhs
+,   dynamic_bitset<V_internalWords, T_allocator> const& rhs
+)
+{
+    dynamic_bitset<V_internalWords, T_allocator> r(lhs);
+
+    r -= rhs;
+
+    return r;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * swapping
+ */
+
+template<
+    ss_size_t           V_internalWords
+,   ss_typename_param_k T_allocator
+>
+inline void swap(
+    dynamic_bitset<V_internalWords, T_allocator>& lhs
+,   dynamic_bitset<V_internalWords, T_allocator>& rhs
+)
+{
+    lhs.swap(rhs);
+}
+
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONTAINERS_HPP_DYNAMIC_BITSET */
+
+/* ///////////////////////////// end of file //////////////////////////// */
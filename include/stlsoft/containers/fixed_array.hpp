@@ -5,7 +5,7 @@
  *              fixed_array_4d template classes.
  *
  * Created:     4th August 1998
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Thanks to:   Neal Becker for suggesting the uninitialised mode,
  *              requesting the function call operator, and for requesting
@@ -16,7 +16,7 @@
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 1998-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -62,9 +62,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_MAJOR      4
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_MINOR      9
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_REVISION   12
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_EDIT       206
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_MINOR      10
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_REVISION   1
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_FIXED_ARRAY_EDIT       207
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -337,6 +337,18 @@ private:
  * \param T The value type
  * \param A The allocator type
  * \param P The construction policy type
+ *
+ * The elements are held contiguously, in row-major order, at data(). The
+ *   number of elements between successive indexes of each dimension is
+ *   given by stride0() and stride1() (and so on, for the higher-dimension
+ *   arrays), for use by numeric kernels that address the elements
+ *   directly rather than through the dimension proxies returned by
+ *   operator [].
+ *
+ * To obtain storage aligned for vector loads, specify
+ *   stlsoft::aligned_allocator as the allocator type. For row, column,
+ *   block, and transposed views, and for rows padded to avoid cache-set
+ *   aliasing, see stlsoft::strided_array_view_2d.
  */
 template<   ss_typename_param_k T
 #ifdef STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT
@@ -446,6 +458,8 @@ public:
 public:
     index_type              dimension0() const;
     index_type              dimension1() const;
+    index_type              stride0() const;
+    index_type              stride1() const;
     index_type              size() const;
     bool_type               empty() const;
     static size_type        max_size();
@@ -612,6 +626,9 @@ public:
     index_type              dimension0() const;
     index_type              dimension1() const;
     index_type              dimension2() const;
+    index_type              stride0() const;
+    index_type              stride1() const;
+    index_type              stride2() const;
     index_type              size() const;
     bool_type               empty() const;
     static size_type        max_size();
@@ -779,6 +796,10 @@ public:
     index_type              dimension1() const;
     index_type              dimension2() const;
     index_type              dimension3() const;
+    index_type              stride0() const;
+    index_type              stride1() const;
+    index_type              stride2() const;
+    index_type              stride3() const;
     index_type              size() const;
     bool_type               empty() const;
     static size_type        max_size();
@@ -1487,6 +1508,18 @@ inline ss_typename_type_ret_k fixed_array_2d<T, A, P, R>::index_type fixed_array
     return m_d1;
 }
 
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_2d<T, A, P, R>::index_type fixed_array_2d<T, A, P, R>::stride0() const
+{
+    return m_d1;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_2d<T, A, P, R>::index_type fixed_array_2d<T, A, P, R>::stride1() const
+{
+    return 1;
+}
+
 template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
 inline ss_typename_type_ret_k fixed_array_2d<T, A, P, R>::index_type fixed_array_2d<T, A, P, R>::size() const
 {
@@ -1891,6 +1924,24 @@ inline ss_typename_type_ret_k fixed_array_3d<T, A, P, R>::index_type fixed_array
     return m_d2;
 }
 
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_3d<T, A, P, R>::index_type fixed_array_3d<T, A, P, R>::stride0() const
+{
+    return m_d1 * m_d2;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_3d<T, A, P, R>::index_type fixed_array_3d<T, A, P, R>::stride1() const
+{
+    return m_d2;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_3d<T, A, P, R>::index_type fixed_array_3d<T, A, P, R>::stride2() const
+{
+    return 1;
+}
+
 template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
 inline ss_typename_type_ret_k fixed_array_3d<T, A, P, R>::index_type fixed_array_3d<T, A, P, R>::size() const
 {
@@ -2308,6 +2359,30 @@ inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array
     return m_d3;
 }
 
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array_4d<T, A, P, R>::stride0() const
+{
+    return m_d1 * m_d2 * m_d3;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array_4d<T, A, P, R>::stride1() const
+{
+    return m_d2 * m_d3;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array_4d<T, A, P, R>::stride2() const
+{
+    return m_d3;
+}
+
+template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
+inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array_4d<T, A, P, R>::stride3() const
+{
+    return 1;
+}
+
 template <ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k P, ss_bool_t R>
 inline ss_typename_type_ret_k fixed_array_4d<T, A, P, R>::index_type fixed_array_4d<T, A, P, R>::size() const
 {
@@ -4,11 +4,11 @@
  * Purpose:     An associative container that maintains the order of element insertion.
  *
  * Created:     12th February 2006
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2006-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MAJOR      1
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MINOR      3
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_REVISION   7
-# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_EDIT       34
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_MINOR      4
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_REVISION   2
+# define STLSOFT_VER_STLSOFT_CONTAINERS_HPP_UNSORTED_MAP_EDIT       36
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -112,6 +112,20 @@ STLSOFT_COMPILER_IS_BORLAND:
 # include <vector>
 #endif /* !STLSOFT_INCL_VECTOR */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD
+ *
+ * The default number of elements at and above which an
+ * stlsoft::unsorted_map using the stlsoft::unsorted_map_hash_index lookup
+ * policy builds its index. May be defined by the user before inclusion.
+ */
+#ifndef STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD
+# define STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD    (16)
+#endif /* !STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD */
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -121,6 +135,337 @@ namespace stlsoft
 {
 #endif /* STLSOFT_NO_NAMESPACE */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+namespace ximpl_unsorted_map
+{
+
+#if __cplusplus >= 201103L
+
+    // Hashes any key type for which std::hash is specialised
+    struct std_hash_
+    {
+        template <ss_typename_param_k K>
+        ss_size_t operator ()(K const& key) const
+        {
+            return STLSOFT_NS_QUAL_STD(hash)<K>()(key);
+        }
+    };
+#endif /* C++11+ */
+
+    template <ss_typename_param_k C>
+    inline
+    ss_typename_type_k C::size_type
+    linear_find_(
+        C const&                                    elements
+    ,   ss_typename_type_k C::value_type::first_type const& key
+    )
+    {
+        ss_typename_type_k C::size_type const   n   =   elements.size();
+
+        { for (ss_typename_type_k C::size_type i = 0; n != i; ++i)
+        {
+            if (elements[i].first == key)
+            {
+                return i;
+            }
+        }}
+
+        return n;
+    }
+
+} /* namespace ximpl_unsorted_map */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lookup policies
+ */
+
+/** Lookup policy for stlsoft::unsorted_map that searches the elements
+ *   linearly, in insertion order.
+ *
+ * \ingroup group__library__Container
+ *
+ * This is the default policy. It requires nothing of the key type beyond
+ * equality comparison, and is the fastest policy for small maps.
+ */
+struct unsorted_map_linear_lookup
+{
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+public: // operations
+    template <ss_typename_param_k C>
+    ss_typename_type_k C::size_type
+    find(
+        C const&                                    elements
+    ,   ss_typename_type_k C::value_type::first_type const& key
+    ) const
+    {
+        return ximpl_unsorted_map::linear_find_(elements, key);
+    }
+
+    template <ss_typename_param_k C>
+    void on_push_back(C const& /* elements */)
+    {}
+
+    template <ss_typename_param_k C>
+    void on_erase(
+        C const&                        /* elements */
+    ,   ss_typename_type_k C::size_type /* index */
+    )
+    {}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+};
+
+/** Lookup policy for stlsoft::unsorted_map that maintains a hash index
+ *   of element positions alongside the elements, so that lookup is of
+ *   constant time.
+ *
+ * \ingroup group__library__Container
+ *
+ * \param H The hash function type, which must be default-constructible,
+ *   and give the same result for any two keys that compare equal. With
+ *   C++11 and later, defaults to a function that uses
+ *   <code>std::hash</code>
+ * \param N The number of elements at and above which the index is built.
+ *   Below this, elements are searched linearly, exactly as by
+ *   stlsoft::unsorted_map_linear_lookup. Defaults to
+ *   STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD
+ *
+ * The index is a linear-probing open-addressing table of 8-byte slots,
+ *   each holding a position and the low 32 bits of the key's hash, kept
+ *   at most half full. The elements themselves remain contiguous and in
+ *   insertion order. Erasing an element is linear in the number of
+ *   elements, as it is for the elements themselves. The index is
+ *   discarded if the map shrinks below <code>N / 2</code> elements.
+ */
+template<
+#if __cplusplus >= 201103L
+    ss_typename_param_k H   =   ximpl_unsorted_map::std_hash_
+#else /* ? C++11+ */
+    ss_typename_param_k H
+#endif /* C++11+ */
+,   ss_size_t           N   =   STLSOFT_CONTAINERS_UNSORTED_MAP_INDEX_THRESHOLD
+>
+class unsorted_map_hash_index
+{
+public: // types
+    /// The hash function type
+    typedef H                                                               hasher;
+    /// This type
+    typedef unsorted_map_hash_index<H, N>                                   class_type;
+private:
+    struct slot_t
+    {
+        ss_uint32_t position1;  // 1 + the element position; 0 if empty
+        ss_uint32_t hash;       // low 32 bits of the key's hash
+    };
+    typedef STLSOFT_NS_QUAL_STD(vector)<slot_t
+                                    ,   ss_typename_type_k allocator_selector<slot_t>::allocator_type
+                                    >                                       slots_type_;
+    typedef ss_typename_type_k slots_type_::size_type                       slot_index_type_;
+
+    enum { minimumSlots = 32 };
+
+public: // construction
+    /// Constructs an instance, with the given hash function
+    ss_explicit_k
+    unsorted_map_hash_index(hasher const& hash = hasher())
+        : m_hash(hash)
+        , m_slots()
+    {}
+
+public: // attributes
+    /// Indicates whether the index is built
+    ss_bool_t is_indexed() const STLSOFT_NOEXCEPT
+    {
+        return !m_slots.empty();
+    }
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+public: // operations
+    template <ss_typename_param_k C>
+    ss_typename_type_k C::size_type
+    find(
+        C const&                                    elements
+    ,   ss_typename_type_k C::value_type::first_type const& key
+    ) const
+    {
+        if (m_slots.empty())
+        {
+            return ximpl_unsorted_map::linear_find_(elements, key);
+        }
+        else
+        {
+            ss_uint32_t const       h       =   static_cast<ss_uint32_t>(m_hash(key));
+            slot_index_type_ const  mask    =   m_slots.size() - 1;
+
+            { for (slot_index_type_ i = h & mask;; i = (i + 1) & mask)
+            {
+                slot_t const& slot = m_slots[i];
+
+                if (0 == slot.position1)
+                {
+                    return elements.size();
+                }
+                if (h == slot.hash &&
+                    elements[slot.position1 - 1].first == key)
+                {
+                    return slot.position1 - 1;
+                }
+            }}
+        }
+    }
+
+    template <ss_typename_param_k C>
+    void on_push_back(C const& elements)
+    {
+        ss_typename_type_k C::size_type const n = elements.size();
+
+        if (m_slots.empty())
+        {
+            if (n >= N)
+            {
+                build_(elements);
+            }
+        }
+        else if (!is_indexable_(n))
+        {
+            slots_type_().swap(m_slots);
+        }
+        else
+        {
+            if (2 * n > m_slots.size())
+            {
+                grow_();
+            }
+
+            insert_(static_cast<ss_uint32_t>(n), static_cast<ss_uint32_t>(m_hash(elements.back().first)));
+        }
+    }
+
+    /* Called before the element at \c index is erased from \c elements */
+    template <ss_typename_param_k C>
+    void on_erase(
+        C const&                        elements
+    ,   ss_typename_type_k C::size_type index
+    )
+    {
+        if (!m_slots.empty())
+        {
+            if (2 * (elements.size() - 1) < N)
+            {
+                slots_type_().swap(m_slots);
+            }
+            else
+            {
+                erase_(static_cast<ss_uint32_t>(1 + index), static_cast<ss_uint32_t>(m_hash(elements[index].first)));
+            }
+        }
+    }
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+private: // implementation
+    static
+    ss_bool_t
+    is_indexable_(ss_size_t n) STLSOFT_NOEXCEPT
+    {
+        return n < static_cast<ss_uint32_t>(~ss_uint32_t(0));
+    }
+
+    template <ss_typename_param_k C>
+    void build_(C const& elements)
+    {
+        ss_typename_type_k C::size_type const   n       =   elements.size();
+        slot_index_type_                        cslots  =   minimumSlots;
+
+        if (!is_indexable_(n))
+        {
+            return;
+        }
+
+        for (; cslots < 2 * n; cslots *= 2)
+        {}
+
+        slots_type_(cslots, slot_t()).swap(m_slots);
+
+        { for (ss_typename_type_k C::size_type i = 0; n != i; ++i)
+        {
+            insert_(static_cast<ss_uint32_t>(1 + i), static_cast<ss_uint32_t>(m_hash(elements[i].first)));
+        }}
+    }
+
+    // Doubles the table, using the stored hashes
+    void grow_()
+    {
+        slots_type_ slots(2 * m_slots.size(), slot_t());
+
+        m_slots.swap(slots);
+
+        { for (ss_typename_type_k slots_type_::const_iterator i = slots.begin(); slots.end() != i; ++i)
+        {
+            if (0 != (*i).position1)
+            {
+                insert_((*i).position1, (*i).hash);
+            }
+        }}
+    }
+
+    void insert_(ss_uint32_t position1, ss_uint32_t h)
+    {
+        slot_index_type_ const  mask    =   m_slots.size() - 1;
+        slot_index_type_        i       =   h & mask;
+
+        for (; 0 != m_slots[i].position1; i = (i + 1) & mask)
+        {}
+
+        m_slots[i].position1    =   position1;
+        m_slots[i].hash         =   h;
+    }
+
+    // Removes the slot for position1, closing the gap by backward-shift
+    // deletion, and then renumbers all later positions
+    void erase_(ss_uint32_t position1, ss_uint32_t h)
+    {
+        slot_index_type_ const  mask    =   m_slots.size() - 1;
+        slot_index_type_        i       =   h & mask;
+
+        for (; position1 != m_slots[i].position1; i = (i + 1) & mask)
+        {
+            STLSOFT_ASSERT(0 != m_slots[i].position1);
+        }
+
+        { for (slot_index_type_ j = (i + 1) & mask; 0 != m_slots[j].position1; j = (j + 1) & mask)
+        {
+            slot_index_type_ const home = m_slots[j].hash & mask;
+
+            // move j's entry into the gap at i unless its home lies
+            // (cyclically) in (i, j]
+            if ((i < j) ? (home <= i || home > j) : (home <= i && home > j))
+            {
+                m_slots[i] = m_slots[j];
+                i = j;
+            }
+        }}
+
+        m_slots[i].position1 = 0;
+
+        { for (ss_typename_type_k slots_type_::iterator k = m_slots.begin(); m_slots.end() != k; ++k)
+        {
+            if ((*k).position1 > position1)
+            {
+                --(*k).position1;
+            }
+        }}
+    }
+
+private: // fields
+    hasher      m_hash;
+    slots_type_ m_slots;
+};
+
 /* /////////////////////////////////////////////////////////////////////////
  * classes
  */
@@ -134,15 +479,32 @@ namespace stlsoft
  * \param T The container mapped type
  * \param P The comparison predicate type
  * \param A The allocator type
+ * \param L The lookup policy type. Defaults to
+ *   stlsoft::unsorted_map_linear_lookup; maps of more than a few tens of
+ *   elements should use stlsoft::unsorted_map_hash_index
  *
 \code
   stlsoft::unsorted_map
+\endcode
+ *
+ * For example, a map of header fields that retains the order in which
+ *   they were added, and is indexed once it holds 16 or more fields:
+ *
+\code
+  typedef stlsoft::unsorted_map<
+      std::string
+  ,   std::string
+  ,   std::less<std::string>
+  ,   std::allocator<std::string>
+  ,   stlsoft::unsorted_map_hash_index<>
+  >                                     headers_t;
 \endcode
  */
 template<   ss_typename_param_k K
         ,   ss_typename_param_k T
         ,   ss_typename_param_k P   =   STLSOFT_NS_QUAL_STD(less)<K>
         ,   ss_typename_param_k A   =   ss_typename_type_def_k allocator_selector<T>::allocator_type
+        ,   ss_typename_param_k L   =   unsorted_map_linear_lookup
         >
 class unsorted_map
     : public stl_collection_tag
@@ -158,8 +520,10 @@ public:
     typedef STLSOFT_NS_QUAL_STD(pair)<const K, T>                           value_type;
     /// The allocator type
     typedef A                                                               allocator_type;
+    /// The lookup policy type
+    typedef L                                                               lookup_policy_type;
     /// This type
-    typedef unsorted_map<K, T, P, A>                                        class_type;
+    typedef unsorted_map<K, T, P, A, L>                                     class_type;
 private:
     typedef STLSOFT_NS_QUAL_STD(pair)<K, T>                                 internal_value_type_;
     typedef STLSOFT_NS_QUAL_STD(vector)<internal_value_type_
@@ -247,19 +611,19 @@ public:
 public:
     iterator    begin()
     {
-        return sap_cast<value_type*>(&*m_elements.begin());
+        return sap_cast<value_type*>(data_());
     }
     iterator    end()
     {
-        return sap_cast<value_type*>(&*m_elements.end());
+        return sap_cast<value_type*>(data_() + m_elements.size());
     }
     const_iterator  begin() const
     {
-        return sap_cast<value_type const*>(&*m_elements.begin());
+        return sap_cast<value_type const*>(data_());
     }
     const_iterator  end() const
     {
-        return sap_cast<value_type const*>(&*m_elements.end());
+        return sap_cast<value_type const*>(data_() + m_elements.size());
     }
 #if defined(STLSOFT_LF_BIDIRECTIONAL_ITERATOR_SUPPORT)
     reverse_iterator    rbegin()
@@ -281,17 +645,39 @@ public:
 #endif /* STLSOFT_LF_BIDIRECTIONAL_ITERATOR_SUPPORT */
 
 public:
-    size_type erase(key_type const& key)
+    /// Returns an iterator to the element with the given key, or end() if
+    /// there is none
+    iterator    find(key_type const& key)
+    {
+        return begin() + static_cast<difference_type>(m_lookup.find(m_elements, key));
+    }
+    /// Returns an iterator to the element with the given key, or end() if
+    /// there is none
+    const_iterator  find(key_type const& key) const
     {
-        ss_typename_type_k container_type_::iterator    it;
+        return begin() + static_cast<difference_type>(m_lookup.find(m_elements, key));
+    }
+    /// Returns the number of elements with the given key: 0 or 1
+    size_type   count(key_type const& key) const
+    {
+        return (m_elements.size() != m_lookup.find(m_elements, key)) ? 1u : 0u;
+    }
 
-        it = STLSOFT_NS_QUAL_STD(find)( member_selector(m_elements.begin(), &internal_value_type_::first)
-                                    ,   member_selector(m_elements.end(), &internal_value_type_::first)
-                                    ,   key).base();
+    /// The lookup policy instance
+    lookup_policy_type const&   lookup_policy() const
+    {
+        return m_lookup;
+    }
+
+public:
+    size_type erase(key_type const& key)
+    {
+        size_type const index = m_lookup.find(m_elements, key);
 
-        if (m_elements.end() != it)
+        if (m_elements.size() != index)
         {
-            m_elements.erase(it);
+            m_lookup.on_erase(m_elements, index);
+            m_elements.erase(m_elements.begin() + static_cast<difference_type>(index));
 
             return 1;
         }
@@ -306,24 +692,49 @@ public:
     }
     void push_back(key_type const& key, mapped_type const& value)
     {
-        ss_typename_type_k container_type_::iterator    it;
+        size_type const index = m_lookup.find(m_elements, key);
 
-        it = STLSOFT_NS_QUAL_STD(find)( member_selector(m_elements.begin(), &internal_value_type_::first)
-                                    ,   member_selector(m_elements.end(), &internal_value_type_::first)
-                                    ,   key).base();
-
-        if (m_elements.end() == it)
+        if (m_elements.size() == index)
         {
             m_elements.push_back(value_type(key, value));
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            try
+            {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+                m_lookup.on_push_back(m_elements);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            }
+            catch(...)
+            {
+                m_elements.pop_back();
+
+                throw;
+            }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
         }
         else
         {
-            (*it).second = value;
+            m_elements[index].second = value;
         }
     }
 
 private:
-    container_type_ m_elements;
+    // The address of the first element, or null if there are none, since
+    // neither begin() nor end() of the vector may be dereferenced when it
+    // is empty
+    internal_value_type_* data_()
+    {
+        return m_elements.empty() ? ss_nullptr_k : &m_elements[0];
+    }
+    internal_value_type_ const* data_() const
+    {
+        return m_elements.empty() ? ss_nullptr_k : &m_elements[0];
+    }
+
+private:
+    container_type_     m_elements;
+    lookup_policy_type  m_lookup;
 };
 
 /* ////////////////////////////////////////////////////////////////////// */
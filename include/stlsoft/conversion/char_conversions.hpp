@@ -4,11 +4,11 @@
  * Purpose:     Character-encoding scheme interconversion components.
  *
  * Created:     31st May 2003
- * Updated:     29th January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2003-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -43,8 +43,9 @@
 
 /** \file stlsoft/conversion/char_conversions.hpp
  *
- * \brief [C++] Definition of the stlsoft::multibyte2wide and
- *  stlsoft::wide2multibyte class templates
+ * \brief [C++] Definition of the stlsoft::multibyte2wide,
+ *  stlsoft::wide2multibyte, stlsoft::utf82wide, and stlsoft::wide2utf8
+ *  class templates
  *   (\ref group__library__Conversion "Conversion" Library).
  */
 
@@ -53,9 +54,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MAJOR      5
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MINOR      3
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_REVISION   4
-# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_EDIT       120
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_MINOR      4
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_REVISION   3
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_CHAR_CONVERSIONS_EDIT       123
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -84,6 +85,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
 # include <stlsoft/memory/auto_buffer.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+# include <stlsoft/conversion/utf8_transcoding.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING */
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
 # ifndef STLSOFT_INCL_STLSOFT_ERROR_HPP_CONVERSION_ERROR
 #  include <stlsoft/error/conversion_error.hpp>
@@ -492,6 +496,267 @@ private:
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 };
 
+/** Converts a UTF-8 string to a wide (<code>whar_t</code>-based) string -
+ *   UTF-16 or UTF-32, according to the size of <code>wchar_t</code> -
+ *   independently of the locale.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Unlike stlsoft::multibyte2wide, which uses <code>mbstowcs()</code>, the
+ * conversion is done by stlsoft::transcode_utf8_to_wide(), which neither
+ * depends on nor touches the locale, and which validates the input.
+ *
+ * \exception stlsoft::conversion_error Thrown, with the error code
+ *   <code>EILSEQ</code>, if the string is not well-formed UTF-8. (In the
+ *   absence of exception support, the result is the empty string.)
+ */
+template <
+    ss_size_t V_internalSize
+>
+class utf82wide
+    : public convertible_buffer_<ss_char_w_t, ss_char_a_t, V_internalSize>
+{
+/// \name Member Types
+/// @{
+private:
+    typedef convertible_buffer_<
+        ss_char_w_t
+    ,   ss_char_a_t
+    ,   V_internalSize
+    >                                                       parent_class_type;
+public:
+    /// The character type
+    typedef ss_typename_type_k parent_class_type::char_type char_type;
+    /// The alternate character type
+    typedef ss_typename_type_k parent_class_type::alt_char_type
+                                                            alt_char_type;
+    /// The size type
+    typedef ss_typename_type_k parent_class_type::size_type size_type;
+    /// The pointer type
+    typedef ss_typename_type_k parent_class_type::pointer   pointer;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+#ifdef STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT
+
+    template <ss_typename_param_k S>
+    ss_explicit_k utf82wide(S const& s)
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_data_a)(s), calc_length_(s));
+    }
+#else /* ? STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+    ss_explicit_k utf82wide(alt_char_type const* s)
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_ptr_a)(s), calc_length_(s));
+    }
+#endif /* STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+#ifdef STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT
+
+    template <ss_typename_param_k S>
+    utf82wide(S const& s, size_type cch)
+#else /* ? STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+    utf82wide(alt_char_type const* s, size_type cch)
+#endif /* STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_data_a)(s), cch);
+    }
+
+    utf82wide(utf82wide const& rhs)
+        : parent_class_type(rhs.size() + 1)
+    {
+        STLSOFT_API_INTERNAL_memfns_memcpy(parent_class_type::data_(), rhs.data(), sizeof(char_type) * (rhs.size() + 1));
+    }
+/// @}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+/// \name Implementation
+/// @{
+private:
+    template <ss_typename_param_k S>
+    static size_type calc_length_(S const& s)
+    {
+        return STLSOFT_NS_QUAL(c_str_len_a)(s);
+    }
+
+    void prepare_(alt_char_type const* s, size_type size)
+    {
+        // The wide length is measured (and the input validated) first, so
+        // that the buffer is sized exactly
+        ss_size_t const cch = STLSOFT_NS_QUAL(utf8_to_wide_length)<char_type>(s, size);
+
+        if (static_cast<ss_size_t>(-1) == cch)
+        {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(conversion_error("failed to convert UTF-8 string to wide string", EILSEQ));
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+            parent_class_type::data_()[0] = '\0';
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+        else if (!parent_class_type::resize(cch + 1))
+        {
+            // Only in the absence of exception support
+            parent_class_type::data_()[0] = '\0';
+        }
+        else
+        {
+            pointer const data = parent_class_type::data_();
+
+            // The capacity is passed, since the buffer may have fewer
+            // units than the input has bytes
+            STLSOFT_NS_QUAL(transcode_utf8_to_wide)(s, size, data, cch);
+
+            data[cch] = '\0';
+        }
+    }
+/// @}
+
+/// \name Not to be implemented
+/// @{
+private:
+    utf82wide& operator =(utf82wide const&);
+/// @}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+};
+
+/** Converts a wide (<code>whar_t</code>-based) string - UTF-16 or UTF-32,
+ *   according to the size of <code>wchar_t</code> - to a UTF-8 string,
+ *   independently of the locale.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Unlike stlsoft::wide2multibyte, which uses <code>wcstombs()</code>, the
+ * conversion is done by stlsoft::transcode_wide_to_utf8(), which neither
+ * depends on nor touches the locale, and which validates the input.
+ *
+ * \exception stlsoft::conversion_error Thrown, with the error code
+ *   <code>EILSEQ</code>, if the string contains an unpaired surrogate (or,
+ *   for UTF-32, a surrogate or a value beyond U+10FFFF). (In the absence
+ *   of exception support, the result is the empty string.)
+ */
+template <
+    ss_size_t V_internalSize
+>
+class wide2utf8
+    : public convertible_buffer_<ss_char_a_t, ss_char_w_t, V_internalSize>
+{
+/// \name Member Types
+/// @{
+private:
+    typedef convertible_buffer_<
+        ss_char_a_t
+    ,   ss_char_w_t
+    ,   V_internalSize
+    >                                                       parent_class_type;
+public:
+    /// The character type
+    typedef ss_typename_type_k parent_class_type::char_type char_type;
+    /// The alternate character type
+    typedef ss_typename_type_k parent_class_type::alt_char_type
+                                                            alt_char_type;
+    /// The size type
+    typedef ss_typename_type_k parent_class_type::size_type size_type;
+    /// The pointer type
+    typedef ss_typename_type_k parent_class_type::pointer   pointer;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+#ifdef STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT
+
+    template <ss_typename_param_k S>
+    ss_explicit_k wide2utf8(S const& s)
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_data_w)(s), calc_length_(s));
+    }
+#else /* ? STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+    ss_explicit_k wide2utf8(alt_char_type const* s)
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_ptr_w)(s), calc_length_(s));
+    }
+#endif /* STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+#ifdef STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT
+
+    template <ss_typename_param_k S>
+    wide2utf8(S const& s, size_type cch)
+#else /* ? STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+
+    wide2utf8(alt_char_type const* s, size_type cch)
+#endif /* STLSOFT_CF_MEMBER_TEMPLATE_CTOR_SUPPORT */
+        : parent_class_type(1)
+    {
+        prepare_(STLSOFT_NS_QUAL(c_str_data_w)(s), cch);
+    }
+
+    wide2utf8(wide2utf8 const& rhs)
+        : parent_class_type(rhs.size() + 1)
+    {
+        STLSOFT_API_INTERNAL_memfns_memcpy(parent_class_type::data_(), rhs.data(), sizeof(char_type) * (rhs.size() + 1));
+    }
+/// @}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+/// \name Implementation
+/// @{
+private:
+    template <ss_typename_param_k S>
+    static size_type calc_length_(S const& s)
+    {
+        return STLSOFT_NS_QUAL(c_str_len_w)(s);
+    }
+
+    void prepare_(alt_char_type const* s, size_type size)
+    {
+        // The UTF-8 length is measured (and the input validated) first, so
+        // that the buffer is sized exactly
+        ss_size_t const cb = STLSOFT_NS_QUAL(wide_to_utf8_length)(s, size);
+
+        if (static_cast<ss_size_t>(-1) == cb)
+        {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(conversion_error("failed to convert wide string to UTF-8 string", EILSEQ));
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+            parent_class_type::data_()[0] = '\0';
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+        else if (!parent_class_type::resize(cb + 1))
+        {
+            // Only in the absence of exception support
+            parent_class_type::data_()[0] = '\0';
+        }
+        else
+        {
+            pointer const data = parent_class_type::data_();
+
+            STLSOFT_NS_QUAL(transcode_wide_to_utf8)(s, size, data);
+
+            data[cb] = '\0';
+        }
+    }
+/// @}
+
+/// \name Not to be implemented
+/// @{
+private:
+    wide2utf8& operator =(wide2utf8 const&);
+/// @}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+};
+
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 template <ss_typename_param_k C>
 class encoding2encoding
@@ -536,6 +801,19 @@ typedef multibyte2wide<256>                                 m2w;
  */
 typedef wide2multibyte<256>                                 w2m;
 
+/** Type that converts a UTF-8 string to a wide string, independently of
+ * the locale.
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef utf82wide<256>                                      utf8_to_wide;
+/** Type that converts a wide string to a UTF-8 string, independently of
+ * the locale.
+ *
+ * \ingroup group__library__Conversion
+ */
+typedef wide2utf8<256>                                      wide_to_utf8;
+
 /** [DEPRECATED] Type that converts a multibyte string to a wide string.
  *
  * \ingroup group__library__Conversion
@@ -758,6 +1036,195 @@ inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2multibyte)<V_internalSize> con
 
 
 
+/** \ref group__concept__Shim__string_access__c_str_ptr_null for stlsoft::utf82wide
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_ptr_null(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_ptr_null_w(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+/** \ref group__concept__Shim__string_access__c_str_ptr for stlsoft::utf82wide
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_ptr(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.c_str();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_ptr_w(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.c_str();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \ref group__concept__Shim__string_access__c_str_data for stlsoft::utf82wide
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_data(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.data();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_w_t const* c_str_data_w(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.data();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \ref group__concept__Shim__string_access__c_str_len for stlsoft::utf82wide
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_size_t c_str_len(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.size();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_size_t c_str_len_w(STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const& c)
+{
+    return c.size();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+
+/** \ref group__concept__Shim__string_access__c_str_ptr_null for stlsoft::wide2utf8
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_ptr_null(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_ptr_null_a(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return STLSOFT_NS_QUAL(c_str_ptr_null)(c.c_str());
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \ref group__concept__Shim__string_access__c_str_ptr for stlsoft::wide2utf8
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_ptr(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.c_str();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_ptr_a(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.c_str();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \ref group__concept__Shim__string_access__c_str_data for stlsoft::wide2utf8
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_data(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.data();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_char_a_t const* c_str_data_a(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.data();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** \ref group__concept__Shim__string_access__c_str_len for stlsoft::wide2utf8
+ *
+ * \ingroup group__concept__Shim__string_access
+ */
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_size_t c_str_len(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.size();
+}
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <
+    ss_size_t   V_internalSize
+>
+inline ss_size_t c_str_len_a(STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const& c)
+{
+    return c.size();
+}
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+
+
 
 /** \ref group__concept__Shim__stream_insertion "stream insertion shim" for stlsoft::multibyte2wide
  *
@@ -811,6 +1278,58 @@ operator <<(
     return stm;
 }
 
+/** \ref group__concept__Shim__stream_insertion "stream insertion shim" for stlsoft::utf82wide
+ *
+ * \ingroup group__concept__Shim__stream_insertion
+ *
+ * \tparam T_stream The stream type
+ * \tparam V_internalSize The internal size of the utf82wide specialisation
+ *
+ * \param stm The stream
+ * \param c The converter
+ */
+template <
+    ss_typename_param_k T_stream
+,   ss_size_t           V_internalSize
+>
+inline
+T_stream&
+operator <<(
+    T_stream&                                               stm
+,   STLSOFT_NS_QUAL(utf82wide)<V_internalSize> const&  c
+)
+{
+    stm << c.c_str();
+
+    return stm;
+}
+
+/** \ref group__concept__Shim__stream_insertion "stream insertion shim" for stlsoft::wide2utf8
+ *
+ * \ingroup group__concept__Shim__stream_insertion
+ *
+ * \tparam T_stream The stream type
+ * \tparam V_internalSize The internal size of the wide2utf8 specialisation
+ *
+ * \param stm The stream
+ * \param c The converter
+ */
+template <
+    ss_typename_param_k T_stream
+,   ss_size_t           V_internalSize
+>
+inline
+T_stream&
+operator <<(
+    T_stream&                                               stm
+,   STLSOFT_NS_QUAL(wide2utf8)<V_internalSize> const&  c
+)
+{
+    stm << c.c_str();
+
+    return stm;
+}
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -0,0 +1,1074 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/conversion/utf8_transcoding.hpp
+ *
+ * Purpose:     Locale-independent UTF-8 <-> UTF-16/UTF-32 transcoding.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/conversion/utf8_transcoding.hpp
+ *
+ * \brief [C++] Locale-independent, validating transcoding between UTF-8
+ *   and UTF-16/UTF-32
+ *   (\ref group__library__Conversion "Conversion" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+#define STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_MAJOR      1
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_MINOR      1
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_REVISION   2
+# define STLSOFT_VER_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING_EDIT       3
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_utf8_transcoding
+{
+
+    typedef ss_uint32_t                                     code_point_t;
+
+    inline
+    bool
+    is_continuation_(
+        ss_byte_t b
+    )
+    {
+        return 0x80 == (b & 0xC0);
+    }
+
+    // Decodes the (non-ASCII) sequence at s[0], where n is the number of
+    // bytes available, returning the number of bytes consumed, or 0 if the
+    // sequence is ill-formed. Overlong forms, surrogates, and values above
+    // U+10FFFF are rejected, as required by the Unicode Standard (Table
+    // 3-7)
+    inline
+    ss_size_t
+    decode_(
+        ss_byte_t const*    s
+    ,   ss_size_t           n
+    ,   code_point_t*       cp
+    )
+    {
+        code_point_t const b0 = s[0];
+
+        if (b0 < 0xC2)
+        {
+            // a continuation byte, or an overlong lead byte (C0, C1)
+            return 0;
+        }
+        else if (b0 < 0xE0)
+        {
+            if (n < 2 ||
+                !is_continuation_(s[1]))
+            {
+                return 0;
+            }
+
+            *cp = ((b0 & 0x1F) << 6) | (s[1] & 0x3F);
+
+            return 2;
+        }
+        else if (b0 < 0xF0)
+        {
+            if (n < 3 ||
+                !is_continuation_(s[1]) ||
+                !is_continuation_(s[2]))
+            {
+                return 0;
+            }
+
+            code_point_t const c = ((b0 & 0x0F) << 12) | (code_point_t(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+
+            if (c < 0x800 ||
+                0xD800 == (c & 0xF800))
+            {
+                return 0;
+            }
+
+            *cp = c;
+
+            return 3;
+        }
+        else if (b0 < 0xF5)
+        {
+            if (n < 4 ||
+                !is_continuation_(s[1]) ||
+                !is_continuation_(s[2]) ||
+                !is_continuation_(s[3]))
+            {
+                return 0;
+            }
+
+            code_point_t const c = ((b0 & 0x07) << 18) | (code_point_t(s[1] & 0x3F) << 12) | (code_point_t(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+
+            if (c < 0x10000 ||
+                c > 0x10FFFF)
+            {
+                return 0;
+            }
+
+            *cp = c;
+
+            return 4;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    // Encodes the (valid, non-ASCII) code point c, returning the number of
+    // bytes written
+    inline
+    ss_size_t
+    encode_(
+        code_point_t    c
+    ,   ss_byte_t*      d
+    )
+    {
+        if (c < 0x800)
+        {
+            d[0] = static_cast<ss_byte_t>(0xC0 | (c >> 6));
+            d[1] = static_cast<ss_byte_t>(0x80 | (c & 0x3F));
+
+            return 2;
+        }
+        else if (c < 0x10000)
+        {
+            d[0] = static_cast<ss_byte_t>(0xE0 | (c >> 12));
+            d[1] = static_cast<ss_byte_t>(0x80 | ((c >> 6) & 0x3F));
+            d[2] = static_cast<ss_byte_t>(0x80 | (c & 0x3F));
+
+            return 3;
+        }
+        else
+        {
+            d[0] = static_cast<ss_byte_t>(0xF0 | (c >> 18));
+            d[1] = static_cast<ss_byte_t>(0x80 | ((c >> 12) & 0x3F));
+            d[2] = static_cast<ss_byte_t>(0x80 | ((c >> 6) & 0x3F));
+            d[3] = static_cast<ss_byte_t>(0x80 | (c & 0x3F));
+
+            return 4;
+        }
+    }
+
+    inline
+    ss_size_t
+    encoded_length_(
+        code_point_t c
+    )
+    {
+        return (c < 0x80) ? 1 : (c < 0x800) ? 2 : (c < 0x10000) ? 3 : 4;
+    }
+
+    // Operations that depend on the size of the wide code unit: UTF-16
+    // for 2, and UTF-32 for 4
+
+    template <ss_size_t N>
+    struct utf_;
+
+    template <>
+    struct utf_<2>
+    {
+        // The number of units required for the (valid) code point c
+        static
+        ss_size_t
+        units(
+            code_point_t    c
+        )
+        {
+            return (c < 0x10000) ? 1 : 2;
+        }
+
+        // Writes the (valid) code point c, returning the number of units
+        // written
+        template <ss_typename_param_k W>
+        static
+        ss_size_t
+        put(
+            W*              d
+        ,   code_point_t    c
+        )
+        {
+            if (c < 0x10000)
+            {
+                d[0] = static_cast<W>(c);
+
+                return 1;
+            }
+            else
+            {
+                c -= 0x10000;
+
+                d[0] = static_cast<W>(0xD800 + (c >> 10));
+                d[1] = static_cast<W>(0xDC00 + (c & 0x3FF));
+
+                return 2;
+            }
+        }
+
+        // Reads the code point at s[0], where n is the number of units
+        // available, returning the number of units consumed, or 0 if it
+        // is an unpaired surrogate
+        template <ss_typename_param_k W>
+        static
+        ss_size_t
+        get(
+            W const*        s
+        ,   ss_size_t       n
+        ,   code_point_t*   cp
+        )
+        {
+            code_point_t const u0 = static_cast<ss_uint16_t>(s[0]);
+
+            if (0xD800 != (u0 & 0xF800))
+            {
+                *cp = u0;
+
+                return 1;
+            }
+
+            if (u0 >= 0xDC00 ||
+                n < 2)
+            {
+                return 0;
+            }
+
+            code_point_t const u1 = static_cast<ss_uint16_t>(s[1]);
+
+            if (0xDC00 != (u1 & 0xFC00))
+            {
+                return 0;
+            }
+
+            *cp = 0x10000 + ((u0 - 0xD800) << 10) + (u1 - 0xDC00);
+
+            return 2;
+        }
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        // Writes the 16 bytes of v as 16 units
+        static
+        void
+        widen_16(
+            void*   d
+        ,   __m128i v
+        )
+        {
+            __m128i const   z   =   _mm_setzero_si128();
+            __m128i* const  w   =   static_cast<__m128i*>(d);
+
+            _mm_storeu_si128(w + 0, _mm_unpacklo_epi8(v, z));
+            _mm_storeu_si128(w + 1, _mm_unpackhi_epi8(v, z));
+        }
+
+        // Narrows the 16 units at s to bytes, returning a 16-bit mask of
+        // those that are ASCII. Only the ASCII bytes of *packed are valid
+        static
+        ss_uint32_t
+        narrow_16(
+            void const* s
+        ,   __m128i*    packed
+        )
+        {
+            __m128i const* const    v   =   static_cast<__m128i const*>(s);
+            __m128i const           x0  =   _mm_loadu_si128(v + 0);
+            __m128i const           x1  =   _mm_loadu_si128(v + 1);
+            __m128i const           hi  =   _mm_set1_epi16(static_cast<short>(0xFF80));
+            __m128i const           z   =   _mm_setzero_si128();
+            __m128i const           a0  =   _mm_cmpeq_epi16(_mm_and_si128(x0, hi), z);
+            __m128i const           a1  =   _mm_cmpeq_epi16(_mm_and_si128(x1, hi), z);
+
+            *packed = _mm_packus_epi16(x0, x1);
+
+            return static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(a0, a1)));
+        }
+
+        // Loads 8 units as 16-bit lanes, returning false if any is outside
+        // the BMP (which cannot be so for UTF-16)
+        static
+        bool
+        load_bmp_8(
+            void const* s
+        ,   __m128i*    v
+        )
+        {
+            *v = _mm_loadu_si128(static_cast<__m128i const*>(s));
+
+            return true;
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#if defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+        // Writes the 32 bytes at s as 32 units
+        static
+        void
+        widen_32(
+            void*       d
+        ,   void const* s
+        )
+        {
+            __m128i const* const    v   =   static_cast<__m128i const*>(s);
+            __m256i* const          w   =   static_cast<__m256i*>(d);
+
+            _mm256_storeu_si256(w + 0, _mm256_cvtepu8_epi16(_mm_loadu_si128(v + 0)));
+            _mm256_storeu_si256(w + 1, _mm256_cvtepu8_epi16(_mm_loadu_si128(v + 1)));
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+    };
+
+    template <>
+    struct utf_<4>
+    {
+        static
+        ss_size_t
+        units(
+            code_point_t    /* c */
+        )
+        {
+            return 1;
+        }
+
+        template <ss_typename_param_k W>
+        static
+        ss_size_t
+        put(
+            W*              d
+        ,   code_point_t    c
+        )
+        {
+            d[0] = static_cast<W>(c);
+
+            return 1;
+        }
+
+        // Reads the code point at s[0], returning 1, or 0 if it is a
+        // surrogate or is above U+10FFFF
+        template <ss_typename_param_k W>
+        static
+        ss_size_t
+        get(
+            W const*        s
+        ,   ss_size_t       /* n */
+        ,   code_point_t*   cp
+        )
+        {
+            code_point_t const u = static_cast<code_point_t>(s[0]);
+
+            if (u > 0x10FFFF ||
+                0xD800 == (u & 0xFFFFF800))
+            {
+                return 0;
+            }
+
+            *cp = u;
+
+            return 1;
+        }
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        static
+        void
+        widen_16(
+            void*   d
+        ,   __m128i v
+        )
+        {
+            __m128i const   z   =   _mm_setzero_si128();
+            __m128i const   lo  =   _mm_unpacklo_epi8(v, z);
+            __m128i const   hi  =   _mm_unpackhi_epi8(v, z);
+            __m128i* const  w   =   static_cast<__m128i*>(d);
+
+            _mm_storeu_si128(w + 0, _mm_unpacklo_epi16(lo, z));
+            _mm_storeu_si128(w + 1, _mm_unpackhi_epi16(lo, z));
+            _mm_storeu_si128(w + 2, _mm_unpacklo_epi16(hi, z));
+            _mm_storeu_si128(w + 3, _mm_unpackhi_epi16(hi, z));
+        }
+
+        static
+        ss_uint32_t
+        narrow_16(
+            void const* s
+        ,   __m128i*    packed
+        )
+        {
+            __m128i const* const    v   =   static_cast<__m128i const*>(s);
+            __m128i const           x0  =   _mm_loadu_si128(v + 0);
+            __m128i const           x1  =   _mm_loadu_si128(v + 1);
+            __m128i const           x2  =   _mm_loadu_si128(v + 2);
+            __m128i const           x3  =   _mm_loadu_si128(v + 3);
+            __m128i const           hi  =   _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            __m128i const           z   =   _mm_setzero_si128();
+            __m128i const           a0  =   _mm_cmpeq_epi32(_mm_and_si128(x0, hi), z);
+            __m128i const           a1  =   _mm_cmpeq_epi32(_mm_and_si128(x1, hi), z);
+            __m128i const           a2  =   _mm_cmpeq_epi32(_mm_and_si128(x2, hi), z);
+            __m128i const           a3  =   _mm_cmpeq_epi32(_mm_and_si128(x3, hi), z);
+
+            *packed = _mm_packus_epi16(_mm_packs_epi32(x0, x1), _mm_packs_epi32(x2, x3));
+
+            return static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(_mm_packs_epi32(a0, a1), _mm_packs_epi32(a2, a3))));
+        }
+
+        static
+        bool
+        load_bmp_8(
+            void const* s
+        ,   __m128i*    v
+        )
+        {
+            __m128i const* const    p   =   static_cast<__m128i const*>(s);
+            __m128i const           x0  =   _mm_loadu_si128(p + 0);
+            __m128i const           x1  =   _mm_loadu_si128(p + 1);
+            __m128i const           hi  =   _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+
+            if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(x0, x1), hi), _mm_setzero_si128())))
+            {
+                return false;
+            }
+
+            // There is no unsigned saturating 32-to-16 pack in SSE2, so
+            // each lane is sign-extended from 16 bits, making the signed
+            // pack exact
+            *v = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(x0, 16), 16), _mm_srai_epi32(_mm_slli_epi32(x1, 16), 16));
+
+            return true;
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#if defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+        static
+        void
+        widen_32(
+            void*       d
+        ,   void const* s
+        )
+        {
+            ss_byte_t const* const  b   =   static_cast<ss_byte_t const*>(s);
+            __m256i* const          w   =   static_cast<__m256i*>(d);
+
+            _mm256_storeu_si256(w + 0, _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(b + 0))));
+            _mm256_storeu_si256(w + 1, _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(b + 8))));
+            _mm256_storeu_si256(w + 2, _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(b + 16))));
+            _mm256_storeu_si256(w + 3, _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(b + 24))));
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+    };
+
+    inline
+    ss_size_t
+    failed_()
+    {
+        return static_cast<ss_size_t>(-1);
+    }
+} /* namespace ximpl_utf8_transcoding */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_utf8_transcoding
+{
+
+    // Whole blocks are stored at dest + o only when they fit within
+    // cchDest, which must be at least the number of units required
+    template <ss_typename_param_k W>
+    inline
+    ss_size_t
+    transcode_utf8_to_wide_(
+        ss_char_a_t const*  src
+    ,   ss_size_t           cchSrc
+    ,   W*                  dest
+    ,   ss_size_t           cchDest
+    )
+    {
+        STLSOFT_STATIC_ASSERT(2 == sizeof(W) || 4 == sizeof(W));
+
+        typedef utf_<sizeof(W)>                             utf_t;
+
+        ss_byte_t const* const  s   =   reinterpret_cast<ss_byte_t const*>(src);
+        ss_size_t const         n   =   cchSrc;
+        ss_size_t               i   =   0;
+        ss_size_t               o   =   0;
+
+        for (; i != n; )
+        {
+#if defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+            for (; i + 32 <= n && o + 32 <= cchDest; i += 32, o += 32)
+            {
+                if (0 != _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(s + i))))
+                {
+                    break;
+                }
+
+                utf_t::widen_32(dest + o, s + i);
+            }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+            if (i + 16 <= n &&
+                o + 16 <= cchDest)
+            {
+                __m128i const       v       =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i));
+                ss_uint32_t const   mask    =   static_cast<ss_uint32_t>(_mm_movemask_epi8(v));
+
+                // All 16 are written, but only the ASCII prefix is retained
+                utf_t::widen_16(dest + o, v);
+
+                if (0 == mask)
+                {
+                    i += 16;
+                    o += 16;
+
+                    continue;
+                }
+                else
+                {
+                    unsigned const k = STLSOFT_API_INTERNAL_simd_mask_lowest_bit(mask);
+
+                    i += k;
+                    o += k;
+                }
+            }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+            if (i == n)
+            {
+                break;
+            }
+
+            // The block that was not all ASCII - or, for the last few
+            // bytes (or units), the remainder - is decoded one character
+            // at a time, so that mixed text does not return to the vector
+            // path for every short run of ASCII
+
+            ss_size_t const end = i + 16;
+
+            do
+            {
+                if (s[i] < 0x80)
+                {
+                    dest[o++] = static_cast<W>(s[i++]);
+                }
+                else
+                {
+                    code_point_t    cp;
+                    ss_size_t const len = decode_(s + i, n - i, &cp);
+
+                    if (0 == len)
+                    {
+                        return failed_();
+                    }
+
+                    i += len;
+                    o += utf_t::put(dest + o, cp);
+                }
+            }
+            while ( i != n &&
+                    (   i < end ||
+                        s[i] >= 0x80 ||
+                        i + 16 > n ||
+                        o + 16 > cchDest));
+        }
+
+        return o;
+    }
+
+} /* namespace ximpl_utf8_transcoding */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** Transcodes a UTF-8 string to UTF-16 or UTF-32, according to the size
+ * of the wide character type, validating it as it does so.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Unlike <code>mbstowcs()</code>, the conversion does not depend on (or
+ * touch) the locale, and so may be used freely from multiple threads.
+ * Runs of ASCII characters are converted 16 bytes at a time with SSE2
+ * (32 with AVX2), when available; multibyte sequences are decoded
+ * individually.
+ *
+ * Ill-formed input - truncated or overlong sequences, encoded surrogates,
+ * and values beyond U+10FFFF - is rejected.
+ *
+ * \param src Pointer to the UTF-8 string. May be \c nullptr only when
+ *   \c cchSrc is 0
+ * \param cchSrc Number of bytes in the string
+ * \param dest Pointer to the destination buffer, which must have space
+ *   for at least \c cchSrc units (since no sequence yields more units than
+ *   it has bytes). It is not nul-terminated
+ *
+ * \return The number of units written, or <code>static_cast<size_t>(-1)</code>
+ *   if the string is not well-formed UTF-8, in which case the contents of
+ *   \c dest are unspecified
+ */
+template <ss_typename_param_k W>
+inline
+ss_size_t
+transcode_utf8_to_wide(
+    ss_char_a_t const*  src
+,   ss_size_t           cchSrc
+,   W*                  dest
+)
+{
+    // No sequence yields more units than it has bytes, so a capacity of
+    // cchSrc suffices
+    return ximpl_utf8_transcoding::transcode_utf8_to_wide_(src, cchSrc, dest, cchSrc);
+}
+
+/** Transcodes a UTF-8 string to UTF-16 or UTF-32, according to the size
+ * of the wide character type, validating it as it does so, into a
+ * destination buffer of a given capacity.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * As transcode_utf8_to_wide(src, cchSrc, dest), except that the
+ * destination need have space only for the number of units that the
+ * conversion requires - as given by utf8_to_wide_length() - rather than
+ * for \c cchSrc units. Blocks of ASCII characters are converted with
+ * SSE2 (or AVX2) only where the whole block fits within \c cchDest.
+ *
+ * \param src Pointer to the UTF-8 string. May be \c nullptr only when
+ *   \c cchSrc is 0
+ * \param cchSrc Number of bytes in the string
+ * \param dest Pointer to the destination buffer. It is not nul-terminated
+ * \param cchDest Number of units in the destination buffer, which must
+ *   be at least the number required
+ *
+ * \return The number of units written, or <code>static_cast<size_t>(-1)</code>
+ *   if the string is not well-formed UTF-8, in which case the contents of
+ *   \c dest are unspecified
+ */
+template <ss_typename_param_k W>
+inline
+ss_size_t
+transcode_utf8_to_wide(
+    ss_char_a_t const*  src
+,   ss_size_t           cchSrc
+,   W*                  dest
+,   ss_size_t           cchDest
+)
+{
+    return ximpl_utf8_transcoding::transcode_utf8_to_wide_(src, cchSrc, dest, cchDest);
+}
+
+/** Calculates the number of units required to transcode a UTF-8 string
+ * to UTF-16 or UTF-32, according to the size of the wide character type,
+ * validating it as it does so.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Runs of ASCII characters are measured 16 bytes at a time with SSE2,
+ * when available.
+ *
+ * \param src Pointer to the UTF-8 string. May be \c nullptr only when
+ *   \c cchSrc is 0
+ * \param cchSrc Number of bytes in the string
+ *
+ * \return The number of units required, or <code>static_cast<size_t>(-1)</code>
+ *   if the string is not well-formed UTF-8
+ */
+template <ss_typename_param_k W>
+inline
+ss_size_t
+utf8_to_wide_length(
+    ss_char_a_t const*  src
+,   ss_size_t           cchSrc
+)
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(W) || 4 == sizeof(W));
+
+    typedef ximpl_utf8_transcoding::utf_<sizeof(W)>         utf_t;
+    typedef ximpl_utf8_transcoding::code_point_t            code_point_t;
+
+    ss_byte_t const* const  s   =   reinterpret_cast<ss_byte_t const*>(src);
+    ss_size_t const         n   =   cchSrc;
+    ss_size_t               i   =   0;
+    ss_size_t               r   =   0;
+
+    for (; i != n; )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        for (; i + 16 <= n; )
+        {
+            ss_uint32_t const mask = static_cast<ss_uint32_t>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i))));
+
+            if (0 == mask)
+            {
+                i += 16;
+                r += 16;
+            }
+            else
+            {
+                unsigned const k = STLSOFT_API_INTERNAL_simd_mask_lowest_bit(mask);
+
+                i += k;
+                r += k;
+
+                break;
+            }
+        }
+
+        if (i == n)
+        {
+            break;
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        // The block that was not all ASCII - or, for the last few bytes,
+        // the remainder - is measured one character at a time
+
+        ss_size_t const end = i + 16;
+
+        do
+        {
+            if (s[i] < 0x80)
+            {
+                ++i;
+                ++r;
+            }
+            else
+            {
+                code_point_t    cp;
+                ss_size_t const len = ximpl_utf8_transcoding::decode_(s + i, n - i, &cp);
+
+                if (0 == len)
+                {
+                    return ximpl_utf8_transcoding::failed_();
+                }
+
+                i += len;
+                r += utf_t::units(cp);
+            }
+        }
+        while ( i != n &&
+                (   i < end ||
+                    s[i] >= 0x80 ||
+                    i + 16 > n));
+    }
+
+    return r;
+}
+
+/** Calculates the number of bytes required to transcode a UTF-16 or
+ * UTF-32 string, according to the size of the wide character type, to
+ * UTF-8, validating it as it does so.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Blocks of characters from the Basic Multilingual Plane are measured 8
+ * at a time with SSE2, when available.
+ *
+ * \param src Pointer to the wide string. May be \c nullptr only when
+ *   \c cchSrc is 0
+ * \param cchSrc Number of units in the string
+ *
+ * \return The number of bytes required, or <code>static_cast<size_t>(-1)</code>
+ *   if the string contains an unpaired surrogate (or, for UTF-32, a
+ *   surrogate or a value beyond U+10FFFF)
+ */
+template <ss_typename_param_k W>
+inline
+ss_size_t
+wide_to_utf8_length(
+    W const*    src
+,   ss_size_t   cchSrc
+)
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(W) || 4 == sizeof(W));
+
+    typedef ximpl_utf8_transcoding::utf_<sizeof(W)>         utf_t;
+    typedef ximpl_utf8_transcoding::code_point_t            code_point_t;
+
+    ss_size_t const n   =   cchSrc;
+    ss_size_t       i   =   0;
+    ss_size_t       r   =   0;
+
+    for (; i != n; )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        {
+            // Each BMP unit takes 3 bytes, less one for each of the
+            // tests (u < 0x800) and (u < 0x80) that it passes, each of
+            // which yields -1 in its lane. The 16-bit lane sums are
+            // flushed before they can exceed 32767
+            __m128i const   z       =   _mm_setzero_si128();
+            __m128i const   three   =   _mm_set1_epi16(3);
+            __m128i const   m80     =   _mm_set1_epi16(static_cast<short>(0xFF80));
+            __m128i const   m800    =   _mm_set1_epi16(static_cast<short>(0xF800));
+            __m128i const   d800    =   _mm_set1_epi16(static_cast<short>(0xD800));
+            __m128i         sums    =   z;
+            ss_size_t       blocks  =   0;
+            __m128i         v;
+
+            for (; i + 8 <= n && utf_t::load_bmp_8(src + i, &v); i += 8)
+            {
+                __m128i const hi = _mm_and_si128(v, m800);
+
+                if (0 != _mm_movemask_epi8(_mm_cmpeq_epi16(hi, d800)))
+                {
+                    break;
+                }
+
+                sums = _mm_add_epi16(sums, _mm_add_epi16(three, _mm_add_epi16(_mm_cmpeq_epi16(_mm_and_si128(v, m80), z), _mm_cmpeq_epi16(hi, z))));
+
+                if (8192 == ++blocks)
+                {
+                    ss_uint32_t lanes[4];
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), _mm_madd_epi16(sums, _mm_set1_epi16(1)));
+
+                    r += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+                    sums    =   z;
+                    blocks  =   0;
+                }
+            }
+
+            {
+                ss_uint32_t lanes[4];
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(&lanes[0]), _mm_madd_epi16(sums, _mm_set1_epi16(1)));
+
+                r += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            }
+
+            if (i == n)
+            {
+                break;
+            }
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        // The block that could not be measured - or, for the last few
+        // units, the remainder - is measured one character at a time
+
+        ss_size_t const end = i + 8;
+
+        do
+        {
+            code_point_t    cp;
+            ss_size_t const len = utf_t::get(src + i, n - i, &cp);
+
+            if (0 == len)
+            {
+                return ximpl_utf8_transcoding::failed_();
+            }
+
+            i += len;
+            r += ximpl_utf8_transcoding::encoded_length_(cp);
+        }
+        while ( i != n &&
+                (   i < end ||
+                    i + 8 > n));
+    }
+
+    return r;
+}
+
+/** Transcodes a UTF-16 or UTF-32 string, according to the size of the
+ * wide character type, to UTF-8, validating it as it does so.
+ *
+ * \ingroup group__library__Conversion
+ *
+ * Unlike <code>wcstombs()</code>, the conversion does not depend on (or
+ * touch) the locale, and so may be used freely from multiple threads.
+ * Runs of ASCII characters are converted 16 units at a time with SSE2,
+ * when available; all other characters are encoded individually.
+ *
+ * \param src Pointer to the wide string. May be \c nullptr only when
+ *   \c cchSrc is 0
+ * \param cchSrc Number of units in the string
+ * \param dest Pointer to the destination buffer, which must have space
+ *   for the number of bytes given by stlsoft::wide_to_utf8_length(). It is
+ *   not nul-terminated
+ *
+ * \return The number of bytes written, or <code>static_cast<size_t>(-1)</code>
+ *   if the string is not well-formed, in which case the contents of
+ *   \c dest are unspecified
+ */
+template <ss_typename_param_k W>
+inline
+ss_size_t
+transcode_wide_to_utf8(
+    W const*        src
+,   ss_size_t       cchSrc
+,   ss_char_a_t*    dest
+)
+{
+    STLSOFT_STATIC_ASSERT(2 == sizeof(W) || 4 == sizeof(W));
+
+    typedef ximpl_utf8_transcoding::utf_<sizeof(W)>         utf_t;
+    typedef ximpl_utf8_transcoding::code_point_t            code_point_t;
+
+    ss_byte_t* const    d   =   reinterpret_cast<ss_byte_t*>(dest);
+    ss_size_t const     n   =   cchSrc;
+    ss_size_t           i   =   0;
+    ss_size_t           o   =   0;
+
+    // Every unit yields at least one byte, so whole blocks may be written
+    // at dest + o whenever a whole block may be read at src + i
+
+    for (; i != n; )
+    {
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        for (; i + 16 <= n; )
+        {
+            __m128i             packed;
+            ss_uint32_t const   mask    =   utf_t::narrow_16(src + i, &packed);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(d + o), packed);
+
+            if (0xFFFF == mask)
+            {
+                i += 16;
+                o += 16;
+            }
+            else
+            {
+                unsigned const k = STLSOFT_API_INTERNAL_simd_mask_lowest_bit(~mask & 0xFFFF);
+
+                i += k;
+                o += k;
+
+                break;
+            }
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        if (i == n)
+        {
+            break;
+        }
+
+        // The block that was not all ASCII - or, for the last few units,
+        // the remainder - is encoded one character at a time, so that
+        // mixed text does not return to the vector path for every short
+        // run of ASCII
+
+        ss_size_t const end = i + 16;
+
+        do
+        {
+            code_point_t const u = static_cast<code_point_t>(src[i]);
+
+            if (u < 0x80)
+            {
+                d[o++] = static_cast<ss_byte_t>(u);
+                ++i;
+            }
+            else
+            {
+                code_point_t    cp;
+                ss_size_t const len = utf_t::get(src + i, n - i, &cp);
+
+                if (0 == len)
+                {
+                    return ximpl_utf8_transcoding::failed_();
+                }
+
+                i += len;
+                o += ximpl_utf8_transcoding::encode_(cp, d + o);
+            }
+        }
+        while ( i != n &&
+                (   i < end ||
+                    static_cast<code_point_t>(src[i]) >= 0x80 ||
+                    i + 16 > n));
+    }
+
+    return o;
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_CONVERSION_HPP_UTF8_TRANSCODING */
+
+/* ///////////////////////////// end of file //////////////////////////// */
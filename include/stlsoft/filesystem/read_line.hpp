@@ -4,7 +4,7 @@
  * Purpose:     Definition of stlsoft::read_line() function template.
  *
  * Created:     2nd January 2007
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_MAJOR     2
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_MINOR     1
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_REVISION  5
-# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_EDIT      25
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_MINOR     2
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_REVISION  1
+# define STLSOFT_VER_STLSOFT_FILESYSTEM_HPP_READ_LINE_EDIT      26
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -69,6 +69,10 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+
 #ifndef STLSOFT_INCL_STDEXCEPT
 # define STLSOFT_INCL_STDEXCEPT
 # include <stdexcept>
@@ -78,6 +82,10 @@
 # define STLSOFT_INCL_H_STDIO
 # include <stdio.h>
 #endif /* !STLSOFT_INCL_H_STDIO */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -385,10 +393,232 @@ namespace read_line_impl
         return !line.empty();
     }
 
+    /* Block-oriented equivalent of read_line(), for policies that expose
+     * their buffered contents. Runs of characters other than CR and LF
+     * are located with memchr() and appended to the line in a single
+     * operation; the CR/LF/CRLF handling is exactly as in read_line().
+     *
+     * The line is emptied via clear(), rather than by swapping with a
+     * default-constructed instance, so that its capacity is reused from
+     * one line to the next.
+     */
+    template<   ss_typename_param_k S
+            ,   ss_typename_param_k P
+            >
+    static ss_bool_t read_line_blocks(P& policy, S& line, read_line_flags::flags_t flags)
+    {
+        ss_size_t numCr = 0;
+
+        if (0 == (read_line_flags::mask & flags))
+        {
+            flags = read_line_flags::recogniseAll;
+        }
+
+        line.clear();
+
+        for (; policy.underflow(); )
+        {
+            char const* const   b   =   policy.buffered_begin();
+            char const* const   e   =   policy.buffered_end();
+            char const*         lf  =   static_cast<char const*>(::memchr(b, '\n', static_cast<ss_size_t>(e - b)));
+
+            if (NULL == lf)
+            {
+                lf = e;
+            }
+
+            char const*         eol =   static_cast<char const*>(::memchr(b, '\r', static_cast<ss_size_t>(lf - b)));
+
+            if (NULL == eol)
+            {
+                eol = lf;
+            }
+
+            if (b != eol)
+            {
+                if (numCr > 0)
+                {
+                    line.append(numCr, '\r');
+                    numCr = 0;
+                }
+
+                line.append(b, static_cast<ss_size_t>(eol - b));
+            }
+
+            if (e == eol)
+            {
+                policy.consume(static_cast<ss_size_t>(e - b));
+
+                continue;
+            }
+
+            char const ch = *eol;
+
+            policy.consume(static_cast<ss_size_t>(eol - b) + 1u);
+
+            if ('\r' == ch)
+            {
+                if (0 != ((read_line_flags::recogniseCrAsEOL | read_line_flags::recogniseCrLfAsEOL) & flags))
+                {
+                    if (read_line_flags::recogniseCrLfAsEOL & flags)
+                    {
+                        if ('\n' == policy.peek_next_char())
+                        {
+                            policy.consume(1u);
+
+                            line.append(numCr, '\r');
+
+                            return true;
+                        }
+                    }
+
+                    if (read_line_flags::recogniseCrAsEOL & flags)
+                    {
+                        return true;
+                    }
+                }
+
+                ++numCr;
+            }
+            else
+            {
+                if (numCr > 0 &&
+                    (read_line_flags::recogniseCrLfAsEOL & flags))
+                {
+                    line.append(numCr - 1, '\r');
+
+                    return true;
+                }
+                else if (read_line_flags::recogniseLfAsEOL & flags)
+                {
+                    line.append(numCr, '\r');
+
+                    return true;
+                }
+
+                line.append(1, '\n');
+            }
+        }
+
+        return !line.empty();
+    }
+
 } /* namespace read_line_impl */
 
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+namespace readers
+{
+    /** Reader policy that reads from a C stream in large blocks
+     *
+     * Whereas the reader used by <code>read_line(FILE*, ...)</code>
+     * obtains each character via <code>fgetc()</code>, this reads the
+     * stream in blocks via <code>fread()</code> into an internal buffer,
+     * allowing stlsoft::read_line() to locate end-of-line sequences with
+     * <code>memchr()</code> and to append whole line segments at once.
+     *
+     * Because the reader reads ahead of the current line, the same
+     * instance must be passed to each read_line() call for a given
+     * stream, and the stream should not be read by other means while the
+     * reader is in use.
+     */
+    class read_from_FILE_buffered
+    {
+    public: // Member Types
+        typedef read_from_FILE_buffered             class_type;
+    private:
+        typedef auto_buffer<char, 1024>             buffer_type_;
+
+    public: // Constants
+        enum
+        {
+            /// The default buffer size
+            defaultBufferSize   =   64 * 1024
+        };
+
+    public: // Construction
+        ss_explicit_k read_from_FILE_buffered(FILE* stm, ss_size_t bufferSize = defaultBufferSize)
+            : m_stm(stm)
+            , m_buffer(0 == bufferSize ? ss_size_t(defaultBufferSize) : bufferSize)
+            , m_pos(0)
+            , m_end(0)
+        {
+            STLSOFT_ASSERT(NULL != stm);
+        }
+    private:
+        read_from_FILE_buffered(class_type const&);     // copy-construction proscribed
+        class_type& operator =(class_type const&);      // copy-assignment proscribed
+
+    public: // Operations
+        /// Ensures that the buffer is non-empty, reading the next block
+        /// from the stream if necessary
+        ///
+        /// \retval true The buffer contains at least one character
+        /// \retval false The stream is exhausted
+        ss_bool_t underflow()
+        {
+            if (m_pos == m_end)
+            {
+                m_pos   =   0;
+                m_end   =   ::fread(m_buffer.data(), 1, m_buffer.size(), m_stm);
+            }
+
+            return m_pos != m_end;
+        }
+
+        /// The start of the buffered (unconsumed) characters
+        char const* buffered_begin() const
+        {
+            return m_buffer.data() + m_pos;
+        }
+
+        /// The end of the buffered (unconsumed) characters
+        char const* buffered_end() const
+        {
+            return m_buffer.data() + m_end;
+        }
+
+        /// Marks the given number of buffered characters as consumed
+        void consume(ss_size_t n)
+        {
+            STLSOFT_ASSERT(n <= m_end - m_pos);
+
+            m_pos += n;
+        }
+
+        int read_char()
+        {
+            if (!underflow())
+            {
+                return EOF;
+            }
+
+            return static_cast<unsigned char>(m_buffer[m_pos++]);
+        }
+
+        int peek_next_char()
+        {
+            if (!underflow())
+            {
+                return EOF;
+            }
+
+            return static_cast<unsigned char>(m_buffer[m_pos]);
+        }
+
+    private: // Fields
+        FILE* const     m_stm;
+        buffer_type_    m_buffer;
+        ss_size_t       m_pos;
+        ss_size_t       m_end;
+    };
+
+} /* namespace readers */
+
 /* /////////////////////////////////////////////////////////////////////////
  * functions
  */
@@ -424,6 +654,33 @@ ss_bool_t read_line(
     return read_line_impl::read_line(policy, line, flags);
 }
 
+/** Reads a line from a C stream via a block-buffered reader
+ *
+ * \param reader The reader, which must be the same instance for all
+ *   calls on a given stream
+ * \param line The line to read into. In addition to the requirements of
+ *   the <code>FILE*</code> overload, it must have a clear() method and a
+ *   block append method taking a pointer and a length
+ * \param flags The flags that control what line-termination sequences are
+ *   recognised
+ *
+ * \return An indication of whether there is more to parse
+ * \retval true The parsing is not complete
+ * \retval false The parsing is complete
+ *
+ * \remarks Recognises the same line-termination sequences, and produces
+ *   the same lines, as the <code>FILE*</code> overload.
+ */
+template <ss_typename_param_k S>
+ss_bool_t read_line(
+    readers::read_from_FILE_buffered&   reader
+,   S&                                  line
+,   read_line_flags::flags_t            flags = read_line_flags::recogniseAll
+)
+{
+    return read_line_impl::read_line_blocks(reader, line, flags);
+}
+
 /** Reads a line from a pair of iterators
  */
 template<   ss_typename_param_k I
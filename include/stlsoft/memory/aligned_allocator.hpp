@@ -0,0 +1,321 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/memory/aligned_allocator.hpp
+ *
+ * Purpose:     aligned_allocator class - allocates storage at a given
+ *              alignment.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file stlsoft/memory/aligned_allocator.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::aligned_allocator class
+ *   (\ref group__library__Memory "Memory" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR
+#define STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR_MAJOR     1
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR_MINOR     0
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR_REVISION  2
+# define STLSOFT_VER_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR_EDIT      2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE
+# include <stlsoft/memory/allocator_base.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALLOCATOR_BASE */
+
+#ifndef STLSOFT_INCL_H_STDLIB
+# define STLSOFT_INCL_H_STDLIB
+# include <stdlib.h>                     // for malloc(), free()
+#endif /* !STLSOFT_INCL_H_STDLIB */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT
+ *
+ * The default alignment, in bytes, of stlsoft::aligned_allocator: that of
+ * a cache line on most current processors, and sufficient for AVX-512
+ * loads and stores. May be defined by the user before inclusion.
+ */
+#ifndef STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT
+# define STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT        (64)
+#endif /* !STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** STL Allocator that returns storage aligned to a given power-of-two
+ *   boundary, based on the C runtime \c malloc() & \c free() functions
+ *
+ * \ingroup group__library__Memory
+ *
+ * \param T The value_type of the allocator
+ * \param N The alignment, in bytes, which must be a power of two.
+ *   Defaults to STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT
+ *
+ * Each block is over-allocated by <code>N - 1</code> bytes plus one
+ *   pointer, which is stored immediately before the aligned address in
+ *   order that the block may be freed. So that that pointer is itself
+ *   aligned, blocks are aligned to at least <code>sizeof(void*)</code>
+ *   bytes, whatever the value of \c N.
+ *
+ * Used as the allocator of stlsoft::fixed_array_2d (and the other fixed
+ *   arrays), it gives arrays whose data() is suitably aligned for aligned
+ *   vector loads, and whose rows do not straddle cache lines
+ *   unnecessarily:
+ *
+\code
+  typedef stlsoft::fixed_array_2d<
+      float
+  ,   stlsoft::aligned_allocator<float, 64>
+  >                                         matrix_t;
+\endcode
+ */
+template<
+    ss_typename_param_k T
+,   ss_size_t           N = STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT
+>
+class aligned_allocator
+    : public allocator_base<T, aligned_allocator<T, N> >
+{
+private:
+    typedef allocator_base<T, aligned_allocator<T, N> >             parent_class_type;
+public:
+    /// The current specialisation of the type
+    typedef aligned_allocator<T, N>                                 class_type;
+    /// The value type
+    typedef ss_typename_type_k parent_class_type::value_type        value_type;
+    /// The pointer type
+    typedef ss_typename_type_k parent_class_type::pointer           pointer;
+    /// The non-mutating (const) pointer type
+    typedef ss_typename_type_k parent_class_type::const_pointer     const_pointer;
+    /// The reference type
+    typedef ss_typename_type_k parent_class_type::reference         reference;
+    /// The non-mutating (const) reference type
+    typedef ss_typename_type_k parent_class_type::const_reference   const_reference;
+    /// The difference type
+    typedef ss_typename_type_k parent_class_type::difference_type   difference_type;
+    /// The size type
+    typedef ss_typename_type_k parent_class_type::size_type         size_type;
+
+public:
+    enum
+    {
+        /// The alignment, in bytes, of all allocated blocks
+        alignment   =   N
+    };
+private:
+    enum
+    {
+        // The alignment actually used, which is at least that of the
+        // pointer stored before each block
+        blockAlignment  =   (N < sizeof(void*)) ? sizeof(void*) : N
+    };
+
+public:
+#ifdef STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT
+    /// The allocator's <b><code>rebind</code></b> structure
+    template <ss_typename_param_k U>
+    struct rebind
+    {
+        typedef aligned_allocator<U, N>                             other;
+    };
+#endif /* STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT */
+
+/// \name Construction
+/// @{
+public:
+    /// Default constructor
+    aligned_allocator() STLSOFT_NOEXCEPT
+    {}
+    /// Copy constructor
+#ifdef STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT
+    template <ss_typename_param_k U>
+    aligned_allocator(aligned_allocator<U, N> const&)
+    {}
+#else /* ? STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT */
+    aligned_allocator(class_type const&)
+    {}
+#endif /* STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT */
+/// @}
+
+private:
+    friend class allocator_base<T, aligned_allocator<T, N> >;
+
+    void* do_allocate(size_type n, void const* hint)
+    {
+        STLSOFT_STATIC_ASSERT(0 != N && 0 == (N & (N - 1)));
+
+        STLSOFT_SUPPRESS_UNUSED(hint);
+
+        if (n > this->max_size())
+        {
+            return NULL;
+        }
+        else
+        {
+            size_type const cb      =   n * sizeof(value_type);
+            size_type const extra   =   (blockAlignment - 1) + sizeof(void*);
+
+            if (cb > static_cast<size_type>(-1) - extra)
+            {
+                return NULL;
+            }
+            else
+            {
+                void* const pv = ::malloc(cb + extra);
+
+                if (NULL == pv)
+                {
+                    return NULL;
+                }
+                else
+                {
+                    ss_uintptr_t const  base    =   reinterpret_cast<ss_uintptr_t>(pv) + sizeof(void*);
+                    void** const        p       =   reinterpret_cast<void**>((base + (blockAlignment - 1)) & ~static_cast<ss_uintptr_t>(blockAlignment - 1));
+
+                    p[-1] = pv;
+
+                    return p;
+                }
+            }
+        }
+    }
+    void do_deallocate(void* pv, size_type n)
+    {
+        STLSOFT_SUPPRESS_UNUSED(n);
+
+        do_deallocate(pv);
+    }
+    void do_deallocate(void* pv)
+    {
+        if (NULL != pv)
+        {
+            ::free(static_cast<void**>(pv)[-1]);
+        }
+    }
+};
+
+
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+// Specialisation for void
+template <ss_size_t N>
+class aligned_allocator<void, N>
+{
+public:
+    typedef void                        value_type;
+    typedef aligned_allocator<void, N>  class_type;
+    typedef void*                       pointer;
+    typedef void const*                 const_pointer;
+    typedef ss_ptrdiff_t                difference_type;
+    typedef ss_size_t                   size_type;
+
+#ifdef STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT
+    /// The allocator <b><code>rebind</code></b> structure
+    template <ss_typename_param_k U>
+    struct rebind
+    {
+        typedef aligned_allocator<U, N> other;
+    };
+#endif /* STLSOFT_CF_ALLOCATOR_REBIND_SUPPORT */
+};
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+template <ss_typename_param_k T, ss_size_t N>
+inline ss_bool_t operator ==(aligned_allocator<T, N> const& /* lhs */, aligned_allocator<T, N> const& /* rhs */)
+{
+    return ss_true_v;
+}
+
+template <ss_typename_param_k T, ss_size_t N>
+inline ss_bool_t operator !=(aligned_allocator<T, N> const& /* lhs */, aligned_allocator<T, N> const& /* rhs */)
+{
+    return ss_false_v;
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_ALIGNED_ALLOCATOR */
+
+/* ///////////////////////////// end of file //////////////////////////// */
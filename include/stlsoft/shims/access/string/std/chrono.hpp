@@ -4,11 +4,11 @@
  * Purpose:     Contains the c_str_data and c_str_len accessors.
  *
  * Created:     25th October 2020
- * Updated:     18th January 2021
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2020-2021, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2020-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_MAJOR     1
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_MINOR     0
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_REVISION  3
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_EDIT      3
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_MINOR     1
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_REVISION  1
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_BASIC_CHRONO_EDIT      4
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -75,9 +75,9 @@
 # include <stlsoft/string/shim_string.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_SHIM_STRING */
 
-#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_time
-# include <stlsoft/api/internal/time.h>
-#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_time */
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_CACHED_LOCALTIME
+# include <stlsoft/time/cached_localtime.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_CACHED_LOCALTIME */
 
 #ifndef STLSOFT_INCL_CHRONO
 # define STLSOFT_INCL_CHRONO
@@ -98,6 +98,10 @@ namespace stlsoft
  *
  * This can be applied to an expression, and the return value is either a
  * pointer to the character string or to an empty string.
+ *
+ * The conversion to local time is via cached_localtime(), so repeated
+ * conversions within the same second (as when logging) do not repeat the
+ * full localtime() conversion.
  */
 
 #if 0
@@ -123,7 +127,7 @@ c_str_data_a(
 
     time_t const    t   =   std::chrono::system_clock::to_time_t(tp);
     struct tm       tm;
-    int const       r   =   STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+    int const       r   =   cached_localtime(&tm, &t);
 
     if (0 != r)
     {
@@ -167,7 +171,7 @@ c_str_len_a(
 {
     time_t const    t   =   std::chrono::system_clock::to_time_t(tp);
     struct tm       tm;
-    int const       r   =   STLSOFT_API_INTERNAL_Time_localtime(&tm, &t);
+    int const       r   =   cached_localtime(&tm, &t);
 
     if (0 != r)
     {
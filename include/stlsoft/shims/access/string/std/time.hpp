@@ -4,11 +4,11 @@
  * Purpose:     String shims for standard time structures.
  *
  * Created:     25th July 2005
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2005-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_MAJOR     3
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_MINOR     1
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_REVISION  0
-# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_EDIT      38
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_MINOR     2
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_REVISION  2
+# define STLSOFT_VER_STLSOFT_SHIMS_ACCESS_STRING_STD_HPP_TIME_EDIT      40
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -75,7 +75,18 @@
 #ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_SHIM_STRING
 # include <stlsoft/string/shim_string.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_SHIM_STRING */
-
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME
+# include <stlsoft/time/fast_strftime.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME */
+
+#ifndef STLSOFT_INCL_H_LOCALE
+# define STLSOFT_INCL_H_LOCALE
+# include <locale.h>
+#endif /* !STLSOFT_INCL_H_LOCALE */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
 #ifndef STLSOFT_INCL_H_TIME
 # define STLSOFT_INCL_H_TIME
 # include <time.h>
@@ -90,10 +101,92 @@ namespace stlsoft
 {
 #endif /* STLSOFT_NO_NAMESPACE */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_time_shims
+{
+
+    /* The format of the default conversion */
+    inline
+    ss_char_a_t const*
+    default_format_() STLSOFT_NOEXCEPT
+    {
+        return "%a %b %d %H:%M:%S %Y";
+    }
+
+    /* Indicates whether the default conversion of the given time may be
+     * rendered by fast_strftime(), which requires that the LC_TIME
+     * category of the calling thread's locale be "C" (or "POSIX") -
+     * since it uses the English names of days and months - and that the
+     * fields are within the ranges it supports. setlocale() reports only
+     * the global locale, so a thread that has installed its own with
+     * uselocale() is assumed not to be using "C"
+     */
+    inline
+    bool
+    can_use_fast_strftime_(
+        struct tm const* t
+    ) STLSOFT_NOEXCEPT
+    {
+        if (t->tm_sec < 0 || t->tm_sec >= 60 ||
+            t->tm_min < 0 || t->tm_min >= 60 ||
+            t->tm_hour < 0 || t->tm_hour >= 24 ||
+            t->tm_mday < 1 || t->tm_mday > 31 ||
+            t->tm_mon < 0 || t->tm_mon >= 12 ||
+            t->tm_year < 0 || t->tm_year >= 8100 ||
+            t->tm_wday < 0 || t->tm_wday >= 7 ||
+            t->tm_yday < 0 || t->tm_yday >= 366)
+        {
+            return false;
+        }
+#ifdef LC_GLOBAL_LOCALE
+        else if (LC_GLOBAL_LOCALE != ::uselocale(static_cast<locale_t>(0)))
+        {
+            return false;
+        }
+#endif /* LC_GLOBAL_LOCALE */
+        else
+        {
+            char const* const name = ::setlocale(LC_TIME, ss_nullptr_k);
+
+            return ss_nullptr_k != name && (0 == ::strcmp(name, "C") || 0 == ::strcmp(name, "POSIX"));
+        }
+    }
+
+    /* Renders the default conversion into the given buffer, returning
+     * the number of characters written, or 0 on failure
+     */
+    inline
+    ss_size_t
+    format_default_(
+        struct tm const*    t
+    ,   ss_char_a_t       (&buff)[101]
+    )
+    {
+        if (can_use_fast_strftime_(t))
+        {
+            return fast_strftime(&buff[0], STLSOFT_NUM_ELEMENTS(buff), default_format_(), t);
+        }
+        else
+        {
+            return STLSOFT_NS_GLOBAL(strftime)(&buff[0], STLSOFT_NUM_ELEMENTS(buff), default_format_(), t);
+        }
+    }
+
+} /* namespace ximpl_time_shims */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /* /////////////////////////////////////////////////////////////////////////
  * shims
  *
- * All the struct tm-related conversions assume a format of 20 characters
+ * The default struct tm-related conversions have the form of asctime(),
+ * e.g. "Mon Oct 19 12:34:56 2026", which is 24 characters in the "C"
+ * locale; they are rendered by fast_strftime() when the calling thread's
+ * locale is "C", and by strftime() otherwise.
  */
 
 /* struct tm const* */
@@ -120,22 +213,12 @@ c_str_data_a(
     }
     else
     {
-        ss_char_a_t     fmt[101];
-        ss_size_t const n0  =   STLSOFT_NS_GLOBAL(strftime)(&fmt[0], STLSOFT_NUM_ELEMENTS(fmt), "%a %b %%d %%H:%%M:%%S %%Y", t);
+        ss_char_a_t     buff[101];
+        ss_size_t const n   =   ximpl_time_shims::format_default_(t, buff);
 
-        if (0 != n0)
+        if (0 != n)
         {
-            shim_string_t   s(n0 + 2);
-            ss_size_t const n1  =   STLSOFT_NS_GLOBAL(strftime)(s.data(), 1 + s.size(), fmt, t);
-
-            if (0 != n1)
-            {
-                STLSOFT_ASSERT(n1 <= s.size());
-
-                s.truncate(n1);
-
-                return s;
-            }
+            return shim_string_t(&buff[0], n);
         }
     }
 
@@ -223,13 +306,12 @@ c_str_len_a(
     }
     else
     {
-        ss_char_a_t     sz[101];
-        ss_size_t const n1  =   STLSOFT_NS_GLOBAL(strftime)(&sz[0], STLSOFT_NUM_ELEMENTS(sz), "%a %b", t);
+        ss_char_a_t     buff[101];
+        ss_size_t const n   =   ximpl_time_shims::format_default_(t, buff);
 
-        if (0 != n1)
+        if (0 != n)
         {
-            // See implementation of c_str_data_a(struct tm const*)
-            return 17 + n1;
+            return n;
         }
 
         return 14;
@@ -4,11 +4,11 @@
  * Purpose:     Definition of stlsoft_C_strnstrn() and stlsoft_C_wcsnstrn()
  *
  * Created:     1st October 2020
- * Updated:     25th November 2020
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2020, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2020-2026, Matthew Wilson and Synesis Information Systems
  * All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
@@ -45,6 +45,24 @@
  * \brief [C, C++] Definition of stlsoft_C_strnstrn() and stlsoft_C_wcsnstrn()
  *
  *   (\ref group__library__String "String" Library).
+ *
+ * The search algorithm is selected by needle length: a single character
+ * is located by <code>memchr()</code> / <code>wmemchr()</code>; needles
+ * of at least STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE (or, for
+ * <code>wchar_t</code>, STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE)
+ * characters are located by the Boyer-Moore-Horspool method; all others
+ * by filtering
+ * candidate positions on their first and last characters (16/32 at a
+ * time with SSE2/AVX2, for <code>char</code>) and then comparing the
+ * remainder.
+ *
+ * Neither of the latter two methods is linear in the worst case - e.g. a
+ * needle of the form "aaa...ab" in a haystack of 'a's is O(n1 * n2) - so
+ * each counts its verification work and, once that exceeds a fixed
+ * multiple of the distance scanned, completes the search by the Two-Way
+ * method, which is O(n1 + n2) in time and requires no allocation. The
+ * worst case of the search as a whole is thus O(n1 + n2); the typical
+ * case remains sub-linear (Horspool) or vectorised (filter).
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_STRING_C_STRING_H_STRNSTRN
@@ -52,9 +70,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MAJOR       1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MINOR       0
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_MINOR       2
 # define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_REVISION    1
-# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_EDIT        1
+# define STLSOFT_VER_STLSOFT_STRING_C_STRING_H_STRNSTRN_EDIT        3
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -68,6 +86,613 @@
 # pragma message(__FILE__)
 #endif /* STLSOFT_TRACE_INCLUDE */
 
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+#ifndef STLSOFT_INCL_H_WCHAR
+# define STLSOFT_INCL_H_WCHAR
+# include <wchar.h>
+#endif /* !STLSOFT_INCL_H_WCHAR */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+/** \def STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE
+ *
+ * The needle length at and above which the Boyer-Moore-Horspool method is
+ * used by stlsoft_C_strnstrn(). May be defined by the user before
+ * inclusion. When SIMD is available the first/last filter is faster for
+ * all but very long needles, so the default is correspondingly higher.
+ */
+#ifndef STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE
+# ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+#  define STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE            (512)
+# else /* ? STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#  define STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE            (32)
+# endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#endif /* !STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE */
+
+/** \def STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE
+ *
+ * The needle length at and above which the Boyer-Moore-Horspool method is
+ * used by stlsoft_C_wcsnstrn(). May be defined by the user before
+ * inclusion.
+ */
+#ifndef STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE
+# define STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE             (32)
+#endif /* !STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+/* Two-Way (Crochemore-Perrin): used when the verification work of the
+ * filter or Horspool methods exceeds a fixed multiple of the distance
+ * scanned - e.g. for needles such as "aaa...ab" - so that the worst case
+ * is O(n1 + n2) in time and O(1) in space.
+ *
+ * The factorisation helpers return the start of the maximal suffix of the
+ * needle, minus one (so that the empty prefix is (size_t)-1), and its
+ * period; the comparisons are written in terms of (x + 1) accordingly.
+ */
+
+STLSOFT_INLINE
+size_t
+stlsoft_C_strnstrn_Two_Way_max_suffix_(
+    char const* s2
+,   size_t      n2
+,   size_t*     period
+,   int         reversed
+)
+{
+    size_t  ip  =   STLSOFT_STATIC_CAST(size_t, -1);
+    size_t  jp  =   0;
+    size_t  k   =   1;
+    size_t  p   =   1;
+
+    for (; jp + k < n2; )
+    {
+        unsigned char const a = STLSOFT_STATIC_CAST(unsigned char, s2[ip + k]);
+        unsigned char const b = STLSOFT_STATIC_CAST(unsigned char, s2[jp + k]);
+
+        if (a == b)
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                ++k;
+            }
+        }
+        else if ((a > b) != (0 != reversed))
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+
+    *period = p;
+
+    return ip;
+}
+
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_by_Two_Way_method(
+    char const* s1
+,   size_t      n1
+,   char const* s2
+,   size_t      n2
+)
+{
+    size_t  p0;
+    size_t  p1;
+    size_t  ms0 =   stlsoft_C_strnstrn_Two_Way_max_suffix_(s2, n2, &p0, 0);
+    size_t  ms1 =   stlsoft_C_strnstrn_Two_Way_max_suffix_(s2, n2, &p1, 1);
+    size_t  ms;
+    size_t  p;
+    size_t  mem0;
+    size_t  mem;
+    size_t  pos;
+
+    STLSOFT_ASSERT(0 != n2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+    if (ms1 + 1 > ms0 + 1)
+    {
+        ms  =   ms1;
+        p   =   p1;
+    }
+    else
+    {
+        ms  =   ms0;
+        p   =   p0;
+    }
+
+    if (0 != memcmp(s2, s2 + p, ms + 1))
+    {
+        /* not periodic: shift past the longer half */
+        mem0    =   0;
+        p       =   ((ms > n2 - ms - 1) ? ms : n2 - ms - 1) + 1;
+    }
+    else
+    {
+        /* periodic: remember the matched prefix across shifts */
+        mem0    =   n2 - p;
+    }
+
+    for (pos = 0, mem = 0; pos <= n1 - n2; )
+    {
+        size_t k;
+
+        /* right half */
+        for (k = (ms + 1 > mem) ? ms + 1 : mem; k < n2 && s2[k] == s1[pos + k]; ++k)
+        {}
+        if (k < n2)
+        {
+            pos += k - ms;
+            mem = 0;
+
+            continue;
+        }
+
+        /* left half */
+        for (k = ms + 1; k > mem && s2[k - 1] == s1[pos + k - 1]; --k)
+        {}
+        if (k <= mem)
+        {
+            return s1 + pos;
+        }
+
+        pos += p;
+        mem = mem0;
+    }
+
+    return ss_nullptr_k;
+}
+
+STLSOFT_INLINE
+size_t
+stlsoft_C_wcsnstrn_Two_Way_max_suffix_(
+    wchar_t const*  s2
+,   size_t          n2
+,   size_t*         period
+,   int             reversed
+)
+{
+    size_t  ip  =   STLSOFT_STATIC_CAST(size_t, -1);
+    size_t  jp  =   0;
+    size_t  k   =   1;
+    size_t  p   =   1;
+
+    for (; jp + k < n2; )
+    {
+        wchar_t const a = s2[ip + k];
+        wchar_t const b = s2[jp + k];
+
+        if (a == b)
+        {
+            if (k == p)
+            {
+                jp += p;
+                k = 1;
+            }
+            else
+            {
+                ++k;
+            }
+        }
+        else if ((a > b) != (0 != reversed))
+        {
+            jp += k;
+            k = 1;
+            p = jp - ip;
+        }
+        else
+        {
+            ip = jp++;
+            k = p = 1;
+        }
+    }
+
+    *period = p;
+
+    return ip;
+}
+
+STLSOFT_INLINE
+wchar_t const*
+stlsoft_C_wcsnstrn_by_Two_Way_method(
+    wchar_t const*  s1
+,   size_t          n1
+,   wchar_t const*  s2
+,   size_t          n2
+)
+{
+    size_t  p0;
+    size_t  p1;
+    size_t  ms0 =   stlsoft_C_wcsnstrn_Two_Way_max_suffix_(s2, n2, &p0, 0);
+    size_t  ms1 =   stlsoft_C_wcsnstrn_Two_Way_max_suffix_(s2, n2, &p1, 1);
+    size_t  ms;
+    size_t  p;
+    size_t  mem0;
+    size_t  mem;
+    size_t  pos;
+
+    STLSOFT_ASSERT(0 != n2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+    if (ms1 + 1 > ms0 + 1)
+    {
+        ms  =   ms1;
+        p   =   p1;
+    }
+    else
+    {
+        ms  =   ms0;
+        p   =   p0;
+    }
+
+    if (0 != wmemcmp(s2, s2 + p, ms + 1))
+    {
+        mem0    =   0;
+        p       =   ((ms > n2 - ms - 1) ? ms : n2 - ms - 1) + 1;
+    }
+    else
+    {
+        mem0    =   n2 - p;
+    }
+
+    for (pos = 0, mem = 0; pos <= n1 - n2; )
+    {
+        size_t k;
+
+        for (k = (ms + 1 > mem) ? ms + 1 : mem; k < n2 && s2[k] == s1[pos + k]; ++k)
+        {}
+        if (k < n2)
+        {
+            pos += k - ms;
+            mem = 0;
+
+            continue;
+        }
+
+        for (k = ms + 1; k > mem && s2[k - 1] == s1[pos + k - 1]; --k)
+        {}
+        if (k <= mem)
+        {
+            return s1 + pos;
+        }
+
+        pos += p;
+        mem = mem0;
+    }
+
+    return ss_nullptr_k;
+}
+
+/* The verification work (characters compared, bounded above by the needle
+ * length per candidate) that the filter and Horspool methods may perform
+ * before handing over to Two-Way is this multiple of the number of
+ * characters so far passed over plus the needle length.
+ */
+#define STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_            (4)
+
+/* Boyer-Moore-Horspool: the skip table is indexed by the low 8 bits of the
+ * character, which is exact for char, and for wchar_t is a hash for which
+ * each slot holds the smallest shift of any of the characters mapping to
+ * it, so remains correct.
+ */
+
+STLSOFT_INLINE
+void
+stlsoft_C_strnstrn_prepare_Horspool_table(
+    char const* s2
+,   size_t      n2
+,   size_t      skip[256]
+)
+{
+    size_t i;
+
+    STLSOFT_ASSERT(0 != n2);
+
+    for (i = 0; i != 256; ++i)
+    {
+        skip[i] = n2;
+    }
+    for (i = 0; i != n2 - 1; ++i)
+    {
+        skip[STLSOFT_STATIC_CAST(unsigned char, s2[i])] = n2 - 1 - i;
+    }
+}
+
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_by_Horspool_method(
+    char const*     s1
+,   size_t          n1
+,   char const*     s2
+,   size_t          n2
+,   size_t const    skip[256]
+)
+{
+    char const  lastChar    =   s2[n2 - 1];
+    size_t      work        =   0;
+    size_t      pos;
+
+    STLSOFT_ASSERT(0 != n2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+    for (pos = 0; pos <= n1 - n2; )
+    {
+        char const c = s1[pos + n2 - 1];
+
+        if (c == lastChar)
+        {
+            if (0 == memcmp(s1 + pos, s2, n2 - 1))
+            {
+                return s1 + pos;
+            }
+
+            work += n2;
+
+            if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (pos + n2))
+            {
+                return stlsoft_C_strnstrn_by_Two_Way_method(s1 + pos, n1 - pos, s2, n2);
+            }
+        }
+
+        pos += skip[STLSOFT_STATIC_CAST(unsigned char, c)];
+    }
+
+    return ss_nullptr_k;
+}
+
+STLSOFT_INLINE
+char const*
+stlsoft_C_strnstrn_by_first_last_filter(
+    char const* s1
+,   size_t      n1
+,   char const* s2
+,   size_t      n2
+)
+{
+    char const      firstChar   =   s2[0];
+    char const      lastChar    =   s2[n2 - 1];
+    size_t const    numStarts   =   n1 - n2 + 1;
+    size_t          work        =   0;
+    size_t          i           =   0;
+
+    STLSOFT_ASSERT(n2 >= 2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+    {
+        __m256i const   first32 =   _mm256_set1_epi8(firstChar);
+        __m256i const   last32  =   _mm256_set1_epi8(lastChar);
+
+        for (; i + 32 <= numStarts; i += 32)
+        {
+            __m256i const                   bf      =   _mm256_loadu_si256(STLSOFT_C_CAST(__m256i const*, s1 + i));
+            __m256i const                   bl      =   _mm256_loadu_si256(STLSOFT_C_CAST(__m256i const*, s1 + i + n2 - 1));
+            STLSOFT_NS_QUAL(ss_uint32_t)    mask    =   STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first32, bf), _mm256_cmpeq_epi8(last32, bl))));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                unsigned const bit = STLSOFT_API_INTERNAL_simd_mask_lowest_bit(mask);
+
+                if (0 == memcmp(s1 + i + bit + 1, s2 + 1, n2 - 2))
+                {
+                    return s1 + i + bit;
+                }
+
+                work += n2;
+
+                if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (i + bit + n2))
+                {
+                    return stlsoft_C_strnstrn_by_Two_Way_method(s1 + i + bit, n1 - (i + bit), s2, n2);
+                }
+            }
+        }
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+    {
+        __m128i const   first16 =   _mm_set1_epi8(firstChar);
+        __m128i const   last16  =   _mm_set1_epi8(lastChar);
+
+        for (; i + 16 <= numStarts; i += 16)
+        {
+            __m128i const                   bf      =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, s1 + i));
+            __m128i const                   bl      =   _mm_loadu_si128(STLSOFT_C_CAST(__m128i const*, s1 + i + n2 - 1));
+            STLSOFT_NS_QUAL(ss_uint32_t)    mask    =   STLSOFT_STATIC_CAST(STLSOFT_NS_QUAL(ss_uint32_t), _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first16, bf), _mm_cmpeq_epi8(last16, bl))));
+
+            for (; 0 != mask; mask &= mask - 1)
+            {
+                unsigned const bit = STLSOFT_API_INTERNAL_simd_mask_lowest_bit(mask);
+
+                if (0 == memcmp(s1 + i + bit + 1, s2 + 1, n2 - 2))
+                {
+                    return s1 + i + bit;
+                }
+
+                work += n2;
+
+                if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (i + bit + n2))
+                {
+                    return stlsoft_C_strnstrn_by_Two_Way_method(s1 + i + bit, n1 - (i + bit), s2, n2);
+                }
+            }
+        }
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != numStarts; )
+    {
+        char const* const p = STLSOFT_STATIC_CAST(char const*, memchr(s1 + i, firstChar, numStarts - i));
+
+        if (ss_nullptr_k == p)
+        {
+            break;
+        }
+
+        i = STLSOFT_STATIC_CAST(size_t, p - s1);
+
+        if (p[n2 - 1] == lastChar)
+        {
+            if (0 == memcmp(p + 1, s2 + 1, n2 - 2))
+            {
+                return p;
+            }
+
+            work += n2;
+
+            if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (i + n2))
+            {
+                return stlsoft_C_strnstrn_by_Two_Way_method(p, n1 - i, s2, n2);
+            }
+        }
+
+        ++i;
+    }
+
+    return ss_nullptr_k;
+}
+
+STLSOFT_INLINE
+void
+stlsoft_C_wcsnstrn_prepare_Horspool_table(
+    wchar_t const*  s2
+,   size_t          n2
+,   size_t          skip[256]
+)
+{
+    size_t i;
+
+    STLSOFT_ASSERT(0 != n2);
+
+    for (i = 0; i != 256; ++i)
+    {
+        skip[i] = n2;
+    }
+    for (i = 0; i != n2 - 1; ++i)
+    {
+        skip[STLSOFT_STATIC_CAST(size_t, s2[i]) & 0xff] = n2 - 1 - i;
+    }
+}
+
+STLSOFT_INLINE
+wchar_t const*
+stlsoft_C_wcsnstrn_by_Horspool_method(
+    wchar_t const*  s1
+,   size_t          n1
+,   wchar_t const*  s2
+,   size_t          n2
+,   size_t const    skip[256]
+)
+{
+    wchar_t const   lastChar    =   s2[n2 - 1];
+    size_t          work        =   0;
+    size_t          pos;
+
+    STLSOFT_ASSERT(0 != n2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+    for (pos = 0; pos <= n1 - n2; )
+    {
+        wchar_t const c = s1[pos + n2 - 1];
+
+        if (c == lastChar)
+        {
+            if (0 == wmemcmp(s1 + pos, s2, n2 - 1))
+            {
+                return s1 + pos;
+            }
+
+            work += n2;
+
+            if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (pos + n2))
+            {
+                return stlsoft_C_wcsnstrn_by_Two_Way_method(s1 + pos, n1 - pos, s2, n2);
+            }
+        }
+
+        pos += skip[STLSOFT_STATIC_CAST(size_t, c) & 0xff];
+    }
+
+    return ss_nullptr_k;
+}
+
+STLSOFT_INLINE
+wchar_t const*
+stlsoft_C_wcsnstrn_by_first_last_filter(
+    wchar_t const*  s1
+,   size_t          n1
+,   wchar_t const*  s2
+,   size_t          n2
+)
+{
+    wchar_t const   firstChar   =   s2[0];
+    wchar_t const   lastChar    =   s2[n2 - 1];
+    size_t const    numStarts   =   n1 - n2 + 1;
+    size_t          work        =   0;
+    size_t          i           =   0;
+
+    STLSOFT_ASSERT(n2 >= 2);
+    STLSOFT_ASSERT(n2 <= n1);
+
+    for (; i != numStarts; )
+    {
+        wchar_t const* const p = wmemchr(s1 + i, firstChar, numStarts - i);
+
+        if (ss_nullptr_k == p)
+        {
+            break;
+        }
+
+        i = STLSOFT_STATIC_CAST(size_t, p - s1);
+
+        if (p[n2 - 1] == lastChar)
+        {
+            if (0 == wmemcmp(p + 1, s2 + 1, n2 - 2))
+            {
+                return p;
+            }
+
+            work += n2;
+
+            if (work > STLSOFT_C_STRNSTRN_VERIFY_BUDGET_FACTOR_ * (i + n2))
+            {
+                return stlsoft_C_wcsnstrn_by_Two_Way_method(p, n1 - i, s2, n2);
+            }
+        }
+
+        ++i;
+    }
+
+    return ss_nullptr_k;
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /* /////////////////////////////////////////////////////////////////////////
  * API functions
  */
@@ -96,28 +721,26 @@ stlsoft_C_strnstrn(
         return s1;
     }
 
-    for (; n1 >= n2; --n1, ++s1)
+    if (n2 > n1)
     {
-        if (*s1 == *s2)
-        {
-            size_t i;
+        return ss_nullptr_k;
+    }
 
-            for (i = 1; i != n2; ++i)
-            {
-                if (s1[i] != s2[i])
-                {
-                    break;
-                }
-            }
+    if (1 == n2)
+    {
+        return STLSOFT_STATIC_CAST(char const*, memchr(s1, s2[0], n1));
+    }
 
-            if (i == n2)
-            {
-                return s1;
-            }
-        }
+    if (n2 >= STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE)
+    {
+        size_t skip[256];
+
+        stlsoft_C_strnstrn_prepare_Horspool_table(s2, n2, skip);
+
+        return stlsoft_C_strnstrn_by_Horspool_method(s1, n1, s2, n2, skip);
     }
 
-    return ss_nullptr_k;
+    return stlsoft_C_strnstrn_by_first_last_filter(s1, n1, s2, n2);
 }
 
 /** Finds a specific-length (slice of a) string within a specific-length
@@ -144,28 +767,26 @@ stlsoft_C_wcsnstrn(
         return s1;
     }
 
-    for (; n1 >= n2; --n1, ++s1)
+    if (n2 > n1)
     {
-        if (*s1 == *s2)
-        {
-            size_t i;
+        return ss_nullptr_k;
+    }
 
-            for (i = 1; i != n2; ++i)
-            {
-                if (s1[i] != s2[i])
-                {
-                    break;
-                }
-            }
+    if (1 == n2)
+    {
+        return wmemchr(s1, s2[0], n1);
+    }
 
-            if (i == n2)
-            {
-                return s1;
-            }
-        }
+    if (n2 >= STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE)
+    {
+        size_t skip[256];
+
+        stlsoft_C_wcsnstrn_prepare_Horspool_table(s2, n2, skip);
+
+        return stlsoft_C_wcsnstrn_by_Horspool_method(s1, n1, s2, n2, skip);
     }
 
-    return ss_nullptr_k;
+    return stlsoft_C_wcsnstrn_by_first_last_filter(s1, n1, s2, n2);
 }
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -218,6 +839,129 @@ wcsnstrn(
     return stlsoft_C_wcsnstrn(s1, n1, s2, n2);
 }
 
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_strnstrn
+{
+
+    inline size_t Horspool_min_needle(char const*)
+    {
+        return STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE;
+    }
+    inline size_t Horspool_min_needle(wchar_t const*)
+    {
+        return STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE;
+    }
+
+    inline void prepare_Horspool_table(char const* s2, size_t n2, size_t skip[256])
+    {
+        stlsoft_C_strnstrn_prepare_Horspool_table(s2, n2, skip);
+    }
+    inline void prepare_Horspool_table(wchar_t const* s2, size_t n2, size_t skip[256])
+    {
+        stlsoft_C_wcsnstrn_prepare_Horspool_table(s2, n2, skip);
+    }
+
+    inline char const* by_Horspool_method(char const* s1, size_t n1, char const* s2, size_t n2, size_t const skip[256])
+    {
+        return stlsoft_C_strnstrn_by_Horspool_method(s1, n1, s2, n2, skip);
+    }
+    inline wchar_t const* by_Horspool_method(wchar_t const* s1, size_t n1, wchar_t const* s2, size_t n2, size_t const skip[256])
+    {
+        return stlsoft_C_wcsnstrn_by_Horspool_method(s1, n1, s2, n2, skip);
+    }
+
+} /* namespace ximpl_strnstrn */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/** Precompiled searcher for repeated searches for the same needle
+ *
+ * \param C The character type; one of <code>char</code> or
+ *   <code>wchar_t</code>
+ *
+ * When the needle is long enough for the Boyer-Moore-Horspool method to
+ * be used, its skip table is computed once, at construction, rather than
+ * on every search. Results are identical to those of strnstrn().
+ *
+ * \note The searcher does not copy the needle, which must remain valid
+ *   for the lifetime of the searcher.
+ */
+template <ss_typename_param_k C>
+class basic_strnstrn_searcher
+{
+public: // Member Types
+    typedef C                               char_type;
+    typedef basic_strnstrn_searcher<C>      class_type;
+
+public: // Construction
+    /// Prepares a searcher for the needle [s2, s2 + n2)
+    basic_strnstrn_searcher(
+        char_type const*    s2
+    ,   size_t              n2
+    )
+        : m_s2(s2)
+        , m_n2(n2)
+        , m_useHorspool(n2 >= ximpl_strnstrn::Horspool_min_needle(s2))
+    {
+        if (m_useHorspool)
+        {
+            ximpl_strnstrn::prepare_Horspool_table(s2, n2, m_skip);
+        }
+    }
+
+public: // Operations
+    /// Finds the needle within [s1, s1 + n1)
+    ///
+    /// \retval nullptr The needle is not found in [s1, s1 + n1)
+    char_type const*
+    find(
+        char_type const*    s1
+    ,   size_t              n1
+    ) const
+    {
+        if (m_useHorspool)
+        {
+            if (m_n2 > n1)
+            {
+                return ss_nullptr_k;
+            }
+
+            return ximpl_strnstrn::by_Horspool_method(s1, n1, m_s2, m_n2, m_skip);
+        }
+        else
+        {
+            return strnstrn(s1, n1, m_s2, m_n2);
+        }
+    }
+
+    /// The needle
+    char_type const* needle() const
+    {
+        return m_s2;
+    }
+    /// The length of the needle
+    size_t needle_length() const
+    {
+        return m_n2;
+    }
+
+private: // Fields
+    char_type const* const  m_s2;
+    size_t const            m_n2;
+    bool const              m_useHorspool;
+    size_t                  m_skip[256];
+};
+
+/** Specialisation of basic_strnstrn_searcher for <code>char</code> */
+typedef basic_strnstrn_searcher<char>       strnstrn_searcher;
+/** Specialisation of basic_strnstrn_searcher for <code>wchar_t</code> */
+typedef basic_strnstrn_searcher<wchar_t>    wcsnstrn_searcher;
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -4,11 +4,11 @@
  * Purpose:     String utility functions for manipulating case.
  *
  * Created:     1st April 2005
- * Updated:     26th December 2020
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2020, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2005-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -45,6 +45,20 @@
  *
  * \brief [C++] String utility functions for manipulating case
  *   (\ref group__library__String "String" Library).
+ *
+ * When the <code>LC_CTYPE</code> category of the calling thread's locale
+ * is <code>"C"</code> (or <code>"POSIX"</code>), the conversion of
+ * <code>char</code> strings of at least 32 characters - instances of
+ * <code>std::basic_string<char></code>, and of any string type whose
+ * iterator is <code>char*</code> - is carried out by an ASCII kernel
+ * (16/32 characters at a time with SSE2/AVX2) rather than by
+ * <code>toupper()</code>/<code>tolower()</code> per character. Shorter
+ * strings, and other character types, are converted per character.
+ *
+ * \note The locale is determined by <code>setlocale()</code>. Where the
+ *   calling thread has installed its own locale with
+ *   <code>uselocale()</code>, whose name that function does not report,
+ *   the kernel is not used, and the strings are converted per character.
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS
@@ -52,9 +66,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_MAJOR       2
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_MINOR       0
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_REVISION    5
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_EDIT        29
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_MINOR       1
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_REVISION    3
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_CASE_FUNCTIONS_EDIT        32
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -78,6 +92,24 @@
 # include <stlsoft/algorithms/std/alt.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_ALGORITHM_STD_HPP_ALT */
 
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+#ifndef STLSOFT_INCL_STRING
+# define STLSOFT_INCL_STRING
+# include <string>
+#endif /* !STLSOFT_INCL_STRING */
+
+#ifndef STLSOFT_INCL_H_LOCALE
+# define STLSOFT_INCL_H_LOCALE
+# include <locale.h>
+#endif /* !STLSOFT_INCL_H_LOCALE */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -101,6 +133,191 @@ inline S& transform_impl(S& s, F f)
     return s;
 }
 
+namespace ximpl_case_functions
+{
+
+    // The length at and above which the locale is consulted and the ASCII
+    // kernel used: for shorter strings the call to setlocale() would cost
+    // more than it saves, so they are converted per character
+    enum { ascii_kernel_min_length = 32 };
+
+    // Indicates whether the LC_CTYPE category of the calling thread's
+    // locale is "C" (or "POSIX"), in which case toupper()/tolower() affect
+    // only the ASCII letters. setlocale() reports only the global locale,
+    // so a thread that has installed its own with uselocale() is assumed
+    // not to be using "C"
+    inline
+    bool
+    is_C_ctype_locale()
+    {
+#ifdef LC_GLOBAL_LOCALE
+        if (LC_GLOBAL_LOCALE != ::uselocale(static_cast<locale_t>(0)))
+        {
+            return false;
+        }
+#endif /* LC_GLOBAL_LOCALE */
+
+        char const* const name = ::setlocale(LC_CTYPE, ss_nullptr_k);
+
+        return  ss_nullptr_k != name &&
+                (   ('C' == name[0] && '\0' == name[1]) ||
+                    0 == ::strcmp(name, "POSIX"));
+    }
+
+    // Flips the case of each character in [s, s + n) that is in the range
+    // [lo, lo + 26), where lo is 'a' (to upper) or 'A' (to lower)
+    inline
+    void
+    flip_ascii_case(
+        char*       s
+    ,   ss_size_t   n
+    ,   char        lo
+    )
+    {
+        ss_size_t   i   =   0;
+
+        // Adding (0x80 - lo) maps [lo, lo + 26) - and only that range -
+        // onto [-128, -102) as signed bytes, so that one signed
+        // comparison identifies the letters to be flipped
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+        {
+            __m256i const   bias    =   _mm256_set1_epi8(static_cast<char>(0x80 - lo));
+            __m256i const   limit   =   _mm256_set1_epi8(static_cast<char>(-128 + 26));
+            __m256i const   flip    =   _mm256_set1_epi8(0x20);
+
+            for (; i + 32 <= n; i += 32)
+            {
+                __m256i const   v   =   _mm256_loadu_si256(reinterpret_cast<__m256i const*>(s + i));
+                __m256i const   m   =   _mm256_cmpgt_epi8(limit, _mm256_add_epi8(v, bias));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(s + i), _mm256_xor_si256(v, _mm256_and_si256(m, flip)));
+            }
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+        {
+            __m128i const   bias    =   _mm_set1_epi8(static_cast<char>(0x80 - lo));
+            __m128i const   limit   =   _mm_set1_epi8(static_cast<char>(-128 + 26));
+            __m128i const   flip    =   _mm_set1_epi8(0x20);
+
+            for (; i + 16 <= n; i += 16)
+            {
+                __m128i const   v   =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i));
+                __m128i const   m   =   _mm_cmplt_epi8(_mm_add_epi8(v, bias), limit);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(s + i), _mm_xor_si128(v, _mm_and_si128(m, flip)));
+            }
+        }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+        for (; i != n; ++i)
+        {
+            if (static_cast<unsigned char>(s[i] - lo) < 26u)
+            {
+                s[i] = static_cast<char>(s[i] ^ 0x20);
+            }
+        }
+    }
+
+    // Converts [b, e) with the ASCII kernel, if it is long enough and the
+    // locale permits, returning false otherwise; the overload for
+    // non-pointer iterators (and for character types other than char)
+    // always declines
+    inline
+    bool
+    try_flip_ascii_case(
+        char*   b
+    ,   char*   e
+    ,   char    lo
+    )
+    {
+        ss_size_t const n = static_cast<ss_size_t>(e - b);
+
+        if (n < ascii_kernel_min_length ||
+            !is_C_ctype_locale())
+        {
+            return false;
+        }
+
+        flip_ascii_case(b, n, lo);
+
+        return true;
+    }
+
+    template <ss_typename_param_k I>
+    inline
+    bool
+    try_flip_ascii_case(
+        I       /* b */
+    ,   I       /* e */
+    ,   char    /* lo */
+    )
+    {
+        return false;
+    }
+
+    template <ss_typename_param_k S>
+    inline S& make_upper_(S& s)
+    {
+        typedef string_traits<S>                                string_traits_t;
+        typedef ss_typename_type_k string_traits_t::char_type   char_t;
+        typedef ctype_traits<char_t>                            ctype_traits_t;
+
+        if (try_flip_ascii_case(s.begin(), s.end(), 'a'))
+        {
+            return s;
+        }
+
+        return transform_impl(s, &ctype_traits_t::to_upper);
+    }
+
+    template<   ss_typename_param_k T
+            ,   ss_typename_param_k A
+            >
+    inline STLSOFT_NS_QUAL_STD(basic_string)<char, T, A>& make_upper_(STLSOFT_NS_QUAL_STD(basic_string)<char, T, A>& s)
+    {
+        if (!s.empty() &&
+            try_flip_ascii_case(&s[0], &s[0] + s.size(), 'a'))
+        {
+            return s;
+        }
+
+        return transform_impl(s, &ctype_traits<char>::to_upper);
+    }
+
+    template <ss_typename_param_k S>
+    inline S& make_lower_(S& s)
+    {
+        typedef string_traits<S>                                string_traits_t;
+        typedef ss_typename_type_k string_traits_t::char_type   char_t;
+        typedef ctype_traits<char_t>                            ctype_traits_t;
+
+        if (try_flip_ascii_case(s.begin(), s.end(), 'A'))
+        {
+            return s;
+        }
+
+        return transform_impl(s, &ctype_traits_t::to_lower);
+    }
+
+    template<   ss_typename_param_k T
+            ,   ss_typename_param_k A
+            >
+    inline STLSOFT_NS_QUAL_STD(basic_string)<char, T, A>& make_lower_(STLSOFT_NS_QUAL_STD(basic_string)<char, T, A>& s)
+    {
+        if (!s.empty() &&
+            try_flip_ascii_case(&s[0], &s[0] + s.size(), 'A'))
+        {
+            return s;
+        }
+
+        return transform_impl(s, &ctype_traits<char>::to_lower);
+    }
+} /* namespace ximpl_case_functions */
+
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /** Converts all characters in the string to upper case.
@@ -110,11 +327,7 @@ inline S& transform_impl(S& s, F f)
 template <ss_typename_param_k S>
 inline S& make_upper(S& s)
 {
-    typedef string_traits<S>                                string_traits_t;
-    typedef ss_typename_type_k string_traits_t::char_type   char_t;
-    typedef ctype_traits<char_t>                            ctype_traits_t;
-
-    return transform_impl(s, &ctype_traits_t::to_upper);
+    return ximpl_case_functions::make_upper_(s);
 }
 
 /** Converts all characters in the string to lower case.
@@ -124,11 +337,7 @@ inline S& make_upper(S& s)
 template <ss_typename_param_k S>
 inline S& make_lower(S& s)
 {
-    typedef string_traits<S>                                string_traits_t;
-    typedef ss_typename_type_k string_traits_t::char_type   char_t;
-    typedef ctype_traits<char_t>                            ctype_traits_t;
-
-    return transform_impl(s, &ctype_traits_t::to_lower);
+    return ximpl_case_functions::make_lower_(s);
 }
 
 /** Returns a copy of the source string in which all characters have
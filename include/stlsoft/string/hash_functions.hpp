@@ -0,0 +1,858 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/string/hash_functions.hpp
+ *
+ * Purpose:     Fast, non-cryptographic hashing of strings, and std::hash
+ *              specialisations for the STLSoft string types.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/string/hash_functions.hpp
+ *
+ * \brief [C++] Fast, non-cryptographic hashing of strings, and
+ *   <code>std::hash</code> specialisations for the STLSoft string types
+ *   (\ref group__library__String "String" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_HASH_FUNCTIONS
+#define STLSOFT_INCL_STLSOFT_STRING_HPP_HASH_FUNCTIONS
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_STRING_HPP_HASH_FUNCTIONS_MAJOR    1
+# define STLSOFT_VER_STLSOFT_STRING_HPP_HASH_FUNCTIONS_MINOR    0
+# define STLSOFT_VER_STLSOFT_STRING_HPP_HASH_FUNCTIONS_REVISION 1
+# define STLSOFT_VER_STLSOFT_STRING_HPP_HASH_FUNCTIONS_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
+# include <stlsoft/shims/access/string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_SIMPLE_STRING
+# include <stlsoft/string/simple_string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_SIMPLE_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STATIC_STRING
+# include <stlsoft/string/static_string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STATIC_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_SLICE
+# include <stlsoft/string/string_slice.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_SLICE */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW
+# include <stlsoft/string/string_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW */
+
+#if __cplusplus >= 201103L
+# ifndef STLSOFT_INCL_FUNCTIONAL
+#  define STLSOFT_INCL_FUNCTIONAL
+#  include <functional>
+# endif /* !STLSOFT_INCL_FUNCTIONAL */
+#endif /* C++11+ */
+
+#if defined(STLSOFT_COMPILER_IS_MSVC) && \
+    defined(_M_X64)
+# ifndef STLSOFT_INCL_H_INTRIN
+#  define STLSOFT_INCL_H_INTRIN
+#  include <intrin.h>
+# endif /* !STLSOFT_INCL_H_INTRIN */
+#endif /* compiler */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_hash_functions
+{
+
+    // Inputs of up to this many bytes are hashed by the short-input
+    // algorithm, after wyhash (final version 4; public domain), which has
+    // the lowest latency; longer inputs are hashed by the striped
+    // algorithm, after XXH3, whose independent lanes map onto SIMD
+    // registers. Both are fully defined in scalar terms, so that a given
+    // input has the same hash whether or not SIMD is available.
+    //
+    // With AVX2 the striped algorithm has about twice the throughput of
+    // the short-input one from 1KB; with only SSE2 (which has no 64-bit
+    // multiplication) it has a little less, so the threshold is set high
+    // enough that typical keys never reach it
+    enum { long_threshold = 1024 };
+
+    enum
+    {
+            stripe_size         =   64
+        ,   stripes_per_block   =   16
+        ,   block_size          =   stripe_size * stripes_per_block
+    };
+
+    template <int N>
+    struct constants_
+    {
+        // The wyhash "secret"
+        static ss_uint64_t const    wyp[4];
+        // Arbitrary (random, odd) keys for the striped algorithm: stripe
+        // s of a block is keyed by words [s, s + 8); the block scramble by
+        // words [16, 24); the last stripe by words [17, 25); the final
+        // merge by words [8, 16); and the initial accumulators by words
+        // [24, 32)
+        static ss_uint64_t const    secret[32];
+    };
+
+    template <int N>
+    ss_uint64_t const constants_<N>::wyp[4] =
+    {
+            STLSOFT_GEN_UINT64_SUFFIX(0xa0761d6478bd642f), STLSOFT_GEN_UINT64_SUFFIX(0xe7037ed1a0b428db)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x8ebc6af09c88c6e3), STLSOFT_GEN_UINT64_SUFFIX(0x589965cc75374cc3)
+    };
+
+    template <int N>
+    ss_uint64_t const constants_<N>::secret[32] =
+    {
+            STLSOFT_GEN_UINT64_SUFFIX(0x529ed28196c194bf), STLSOFT_GEN_UINT64_SUFFIX(0xb92f5e7cf6c8d93b)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x1ecb363ff3fe8045), STLSOFT_GEN_UINT64_SUFFIX(0x7856cb89364210a1)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x4ae957c18a0e5fe1), STLSOFT_GEN_UINT64_SUFFIX(0xb76ebd72444db03d)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x5946f6d10716a049), STLSOFT_GEN_UINT64_SUFFIX(0x016b16252345c1f3)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x8b99d640b9cea9d7), STLSOFT_GEN_UINT64_SUFFIX(0x70b153aa4b48845f)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0xf4086205a48e2e61), STLSOFT_GEN_UINT64_SUFFIX(0x8e7ee4384576fdcf)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x13c0b72350d92073), STLSOFT_GEN_UINT64_SUFFIX(0x628c83f7142dd61d)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x40e3b449a4988a35), STLSOFT_GEN_UINT64_SUFFIX(0x739f5d2f3aced0e1)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x2fd63476148f93b9), STLSOFT_GEN_UINT64_SUFFIX(0xea9b88126738e963)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x56dcea6bd858cf9f), STLSOFT_GEN_UINT64_SUFFIX(0xd93ba347050022d1)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0xdd2b901f8dd9d6b9), STLSOFT_GEN_UINT64_SUFFIX(0xe901e8fcaa3d90ff)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x44cf288855f3102f), STLSOFT_GEN_UINT64_SUFFIX(0x2f57e38ad09ae085)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x1913457b92decd55), STLSOFT_GEN_UINT64_SUFFIX(0xc4b27f44e87a5be7)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x9ee6abe25e2506ef), STLSOFT_GEN_UINT64_SUFFIX(0xef54817e09b1373f)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x63e8916c9558bff5), STLSOFT_GEN_UINT64_SUFFIX(0xc42ce65800003827)
+        ,   STLSOFT_GEN_UINT64_SUFFIX(0x5aaecaddb7ea57c7), STLSOFT_GEN_UINT64_SUFFIX(0xee7005d4ddb86dd9)
+    };
+
+    typedef constants_<0>                                   constants;
+
+    inline
+    ss_uint64_t
+    read64_(
+        ss_byte_t const* p
+    )
+    {
+        ss_uint64_t v;
+
+        ::memcpy(&v, p, sizeof(v));
+
+        return v;
+    }
+
+    inline
+    ss_uint64_t
+    read32_(
+        ss_byte_t const* p
+    )
+    {
+        ss_uint32_t v;
+
+        ::memcpy(&v, p, sizeof(v));
+
+        return v;
+    }
+
+    // Forms the full 128-bit product of *a and *b, into (lo: *a, hi: *b)
+    inline
+    void
+    mum_(
+        ss_uint64_t*    a
+    ,   ss_uint64_t*    b
+    )
+    {
+#if 0
+#elif defined(__SIZEOF_INT128__)
+
+        __extension__ typedef unsigned __int128 uint128_t_;
+
+        uint128_t_ const r = uint128_t_(*a) * *b;
+
+        *a  =   static_cast<ss_uint64_t>(r);
+        *b  =   static_cast<ss_uint64_t>(r >> 64);
+#elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+      defined(_M_X64)
+
+        *a  =   _umul128(*a, *b, b);
+#else /* ? 128-bit multiplication */
+
+        ss_uint64_t const   ha  =   *a >> 32;
+        ss_uint64_t const   hb  =   *b >> 32;
+        ss_uint64_t const   la  =   static_cast<ss_uint32_t>(*a);
+        ss_uint64_t const   lb  =   static_cast<ss_uint32_t>(*b);
+        ss_uint64_t const   rh  =   ha * hb;
+        ss_uint64_t const   rm0 =   ha * lb;
+        ss_uint64_t const   rm1 =   hb * la;
+        ss_uint64_t const   rl  =   la * lb;
+        ss_uint64_t const   t   =   rl + (rm0 << 32);
+        ss_uint64_t         c   =   t < rl;
+        ss_uint64_t const   lo  =   t + (rm1 << 32);
+
+        c += lo < t;
+
+        *a  =   lo;
+        *b  =   rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif /* 128-bit multiplication */
+    }
+
+    inline
+    ss_uint64_t
+    mix_(
+        ss_uint64_t a
+    ,   ss_uint64_t b
+    )
+    {
+        mum_(&a, &b);
+
+        return a ^ b;
+    }
+
+
+    // short inputs
+
+    inline
+    ss_uint64_t
+    hash_short_(
+        ss_byte_t const*    p
+    ,   ss_size_t           cb
+    ,   ss_uint64_t         seed
+    )
+    {
+        ss_uint64_t const* const    s   =   constants::wyp;
+        ss_uint64_t                 a;
+        ss_uint64_t                 b;
+
+        seed ^= mix_(seed ^ s[0], s[1]);
+
+        if (cb <= 16)
+        {
+            if (cb >= 4)
+            {
+                ss_size_t const o = (cb >> 3) << 2;
+
+                a   =   (read32_(p) << 32) | read32_(p + o);
+                b   =   (read32_(p + cb - 4) << 32) | read32_(p + cb - 4 - o);
+            }
+            else if (cb > 0)
+            {
+                a   =   (ss_uint64_t(p[0]) << 16) | (ss_uint64_t(p[cb >> 1]) << 8) | p[cb - 1];
+                b   =   0;
+            }
+            else
+            {
+                a   =   0;
+                b   =   0;
+            }
+        }
+        else
+        {
+            ss_size_t i = cb;
+
+            if (i > 48)
+            {
+                ss_uint64_t see1 = seed;
+                ss_uint64_t see2 = seed;
+
+                do
+                {
+                    seed    =   mix_(read64_(p) ^ s[1], read64_(p + 8) ^ seed);
+                    see1    =   mix_(read64_(p + 16) ^ s[2], read64_(p + 24) ^ see1);
+                    see2    =   mix_(read64_(p + 32) ^ s[3], read64_(p + 40) ^ see2);
+                    p       +=  48;
+                    i       -=  48;
+                }
+                while (i > 48);
+
+                seed ^= see1 ^ see2;
+            }
+
+            for (; i > 16; p += 16, i -= 16)
+            {
+                seed = mix_(read64_(p) ^ s[1], read64_(p + 8) ^ seed);
+            }
+
+            a   =   read64_(p + i - 16);
+            b   =   read64_(p + i - 8);
+        }
+
+        a ^= s[1];
+        b ^= seed;
+
+        mum_(&a, &b);
+
+        return mix_(a ^ s[0] ^ cb, b ^ s[1]);
+    }
+
+
+    // long inputs
+    //
+    // For each 8-byte word d[i] of a 64-byte stripe, keyed by k[i]:
+    //
+    //   acc[i ^ 1] += d[i]
+    //   acc[i]     += lo32(d[i] ^ k[i]) * hi32(d[i] ^ k[i])
+    //
+    // and, after each 1024-byte block:
+    //
+    //   acc[i] = (acc[i] ^ (acc[i] >> 47) ^ k[i]) * 0x9E3779B1
+
+    ss_uint32_t const   prime32_1   =   0x9E3779B1u;
+
+    inline
+    void
+    accumulate_scalar_(
+        ss_uint64_t*        acc
+    ,   ss_byte_t const*    p
+    ,   ss_size_t           numStripes
+    ,   ss_uint64_t const*  k
+    )
+    {
+        for (ss_size_t n = 0; n != numStripes; ++n, p += stripe_size, ++k)
+        {
+            for (ss_size_t i = 0; i != 8; ++i)
+            {
+                ss_uint64_t const d     =   read64_(p + 8 * i);
+                ss_uint64_t const dk    =   d ^ k[i];
+
+                acc[i ^ 1]  +=  d;
+                acc[i]      +=  (dk & 0xffffffffu) * (dk >> 32);
+            }
+        }
+    }
+
+    inline
+    void
+    scramble_scalar_(
+        ss_uint64_t*        acc
+    ,   ss_uint64_t const*  k
+    )
+    {
+        for (ss_size_t i = 0; i != 8; ++i)
+        {
+            ss_uint64_t a = acc[i];
+
+            a   ^=  a >> 47;
+            a   ^=  k[i];
+            a   *=  prime32_1;
+
+            acc[i] = a;
+        }
+    }
+
+#if 0
+#elif defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+    inline
+    void
+    accumulate_(
+        ss_uint64_t*        acc
+    ,   ss_byte_t const*    p
+    ,   ss_size_t           numStripes
+    ,   ss_uint64_t const*  k
+    )
+    {
+        __m256i a0 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(acc + 0));
+        __m256i a1 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(acc + 4));
+
+        for (ss_size_t n = 0; n != numStripes; ++n, p += stripe_size, ++k)
+        {
+            __m256i const   d0      =   _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 0));
+            __m256i const   d1      =   _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 32));
+            __m256i const   dk0     =   _mm256_xor_si256(d0, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(k + 0)));
+            __m256i const   dk1     =   _mm256_xor_si256(d1, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(k + 4)));
+            __m256i const   pr0     =   _mm256_mul_epu32(dk0, _mm256_shuffle_epi32(dk0, _MM_SHUFFLE(0, 3, 0, 1)));
+            __m256i const   pr1     =   _mm256_mul_epu32(dk1, _mm256_shuffle_epi32(dk1, _MM_SHUFFLE(0, 3, 0, 1)));
+
+            a0  =   _mm256_add_epi64(a0, _mm256_add_epi64(_mm256_shuffle_epi32(d0, _MM_SHUFFLE(1, 0, 3, 2)), pr0));
+            a1  =   _mm256_add_epi64(a1, _mm256_add_epi64(_mm256_shuffle_epi32(d1, _MM_SHUFFLE(1, 0, 3, 2)), pr1));
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 0), a0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + 4), a1);
+    }
+
+    inline
+    void
+    scramble_(
+        ss_uint64_t*        acc
+    ,   ss_uint64_t const*  k
+    )
+    {
+        __m256i const prime = _mm256_set1_epi32(static_cast<int>(prime32_1));
+
+        for (ss_size_t i = 0; i != 8; i += 4)
+        {
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(acc + i));
+
+            a   =   _mm256_xor_si256(a, _mm256_srli_epi64(a, 47));
+            a   =   _mm256_xor_si256(a, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(k + i)));
+            a   =   _mm256_add_epi64(_mm256_mul_epu32(a, prime), _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime), 32));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc + i), a);
+        }
+    }
+#elif defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+    // Accumulates the 16 bytes at p, keyed by k, into the lanes a
+    inline
+    __m128i
+    accumulate_lanes_(
+        __m128i             a
+    ,   ss_byte_t const*    p
+    ,   ss_uint64_t const*  k
+    )
+    {
+        __m128i const   d   =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+        __m128i const   dk  =   _mm_xor_si128(d, _mm_loadu_si128(reinterpret_cast<__m128i const*>(k)));
+        // lo32(dk) * hi32(dk), in each 64-bit lane
+        __m128i const   pr  =   _mm_mul_epu32(dk, _mm_shuffle_epi32(dk, _MM_SHUFFLE(0, 3, 0, 1)));
+
+        // the data are added to the neighbouring lane
+        return _mm_add_epi64(a, _mm_add_epi64(_mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2)), pr));
+    }
+
+    inline
+    void
+    accumulate_(
+        ss_uint64_t*        acc
+    ,   ss_byte_t const*    p
+    ,   ss_size_t           numStripes
+    ,   ss_uint64_t const*  k
+    )
+    {
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + 0));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + 2));
+        __m128i a2 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + 4));
+        __m128i a3 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + 6));
+
+        for (ss_size_t n = 0; n != numStripes; ++n, p += stripe_size, ++k)
+        {
+            a0  =   accumulate_lanes_(a0, p +  0, k + 0);
+            a1  =   accumulate_lanes_(a1, p + 16, k + 2);
+            a2  =   accumulate_lanes_(a2, p + 32, k + 4);
+            a3  =   accumulate_lanes_(a3, p + 48, k + 6);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 0), a0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 2), a1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 4), a2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 6), a3);
+    }
+
+    inline
+    void
+    scramble_(
+        ss_uint64_t*        acc
+    ,   ss_uint64_t const*  k
+    )
+    {
+        __m128i const prime = _mm_set1_epi32(static_cast<int>(prime32_1));
+
+        for (ss_size_t i = 0; i != 8; i += 2)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + i));
+
+            a   =   _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+            a   =   _mm_xor_si128(a, _mm_loadu_si128(reinterpret_cast<__m128i const*>(k + i)));
+            // a * prime, modulo 2^64, from two 32x32 => 64 products
+            a   =   _mm_add_epi64(_mm_mul_epu32(a, prime), _mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), prime), 32));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(acc + i), a);
+        }
+    }
+#else /* ? SIMD */
+
+    inline
+    void
+    accumulate_(
+        ss_uint64_t*        acc
+    ,   ss_byte_t const*    p
+    ,   ss_size_t           numStripes
+    ,   ss_uint64_t const*  k
+    )
+    {
+        accumulate_scalar_(acc, p, numStripes, k);
+    }
+
+    inline
+    void
+    scramble_(
+        ss_uint64_t*        acc
+    ,   ss_uint64_t const*  k
+    )
+    {
+        scramble_scalar_(acc, k);
+    }
+#endif /* SIMD */
+
+    inline
+    ss_uint64_t
+    hash_long_(
+        ss_byte_t const*    p
+    ,   ss_size_t           cb
+    ,   ss_uint64_t         seed
+    )
+    {
+        STLSOFT_ASSERT(cb > ss_size_t(stripe_size));
+
+        ss_uint64_t const* const    k           =   constants::secret;
+        ss_size_t const             numBlocks   =   (cb - 1) / block_size;
+        ss_byte_t const* const      tail        =   p + numBlocks * block_size;
+        ss_uint64_t                 acc[8];
+        ss_uint64_t                 h           =   cb * STLSOFT_GEN_UINT64_SUFFIX(0x9E3779B185EBCA87);
+
+        for (ss_size_t i = 0; i != 8; ++i)
+        {
+            acc[i] = k[24 + i] + ((0 == (i & 1)) ? seed : ~seed);
+        }
+
+        for (; p != tail; p += block_size)
+        {
+            accumulate_(acc, p, stripes_per_block, k);
+            scramble_(acc, k + 16);
+        }
+
+        // the remaining whole stripes, and the last (possibly overlapping)
+        // stripe
+        accumulate_(acc, p, (cb - 1 - numBlocks * block_size) / stripe_size, k);
+        accumulate_(acc, p + (cb - numBlocks * block_size) - stripe_size, 1, k + 17);
+
+        for (ss_size_t i = 0; i != 8; i += 2)
+        {
+            h += mix_(acc[i] ^ k[8 + i], acc[i + 1] ^ k[9 + i]);
+        }
+
+        h ^= seed;
+        h ^= h >> 37;
+        h *= STLSOFT_GEN_UINT64_SUFFIX(0x165667919E3779F9);
+        h ^= h >> 32;
+
+        return h;
+    }
+
+} /* namespace ximpl_hash_functions */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Computes a fast, non-cryptographic, 64-bit hash of a block of memory.
+ *
+ * \ingroup group__library__String
+ *
+ * \param p Pointer to the first byte of the block. May be \c NULL if
+ *   \c cb is 0
+ * \param cb The number of bytes in the block
+ * \param seed A seed, which selects an independent hash function. Defaults
+ *   to 0
+ *
+ * Short inputs are hashed in a handful of 64x64 => 128-bit multiplications;
+ * inputs longer than 1KB in 64-byte stripes, using SSE2 or AVX2 when the
+ * compilation target supports them. The value does not depend on the
+ * availability of SIMD, but does on the byte order, so hashes should not
+ * be persisted or exchanged between architectures. Not suitable for
+ * hashing that must resist deliberately chosen (adversarial) input.
+ */
+inline
+ss_uint64_t
+hash_bytes(
+    void const* p
+,   ss_size_t   cb
+,   ss_uint64_t seed = 0
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_ASSERT(NULL != p || 0 == cb);
+
+    ss_byte_t const* const pb = static_cast<ss_byte_t const*>(p);
+
+    if (cb <= ss_size_t(ximpl_hash_functions::long_threshold))
+    {
+        return ximpl_hash_functions::hash_short_(pb, cb, seed);
+    }
+    else
+    {
+        return ximpl_hash_functions::hash_long_(pb, cb, seed);
+    }
+}
+
+/** Computes the hash (as hash_bytes()) of a character sequence.
+ *
+ * \ingroup group__library__String
+ *
+ * \param s Pointer to the first character. May be \c NULL if \c len is 0
+ * \param len The number of characters
+ * \param seed A seed. Defaults to 0
+ */
+template <ss_typename_param_k C>
+inline
+ss_uint64_t
+hash_string(
+    C const*    s
+,   ss_size_t   len
+,   ss_uint64_t seed = 0
+) STLSOFT_NOEXCEPT
+{
+    return hash_bytes(s, len * sizeof(C), seed);
+}
+
+/** Computes the hash (as hash_bytes()) of the characters of any type for
+ * which the \ref group__concept__Shim__string_access__c_str_data "c_str_data"
+ * and \ref group__concept__Shim__string_access__c_str_len "c_str_len"
+ * shims are defined.
+ *
+ * \ingroup group__library__String
+ *
+ * Equal character sequences have equal hashes whatever their string type,
+ * so that, for example, the hash of a stlsoft::string_view equals that of
+ * a stlsoft::simple_string or a \c std::string with the same contents.
+ */
+template <ss_typename_param_k S>
+inline
+ss_uint64_t
+hash_string(
+    S const& s
+)
+{
+    return hash_string(STLSOFT_NS_QUAL(c_str_data)(s), STLSOFT_NS_QUAL(c_str_len)(s));
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * function objects
+ */
+
+/** Function object that hashes, as hash_string(), any string type.
+ *
+ * \ingroup group__library__String
+ *
+ * It is <em>transparent</em> - it declares \c is_transparent - so that,
+ * with a transparent equality comparison such as stlsoft::string_equal_to,
+ * an unordered container keyed by one string type may be probed by any
+ * other (without conversion, and so without allocation):
+ *
+ * \code
+  std::unordered_map<
+      std::string
+  ,   int
+  ,   stlsoft::string_hash
+  ,   stlsoft::string_equal_to
+  >   m;
+
+  m.find(stlsoft::string_view("key")); // C++20
+ * \endcode
+ *
+ * \note Heterogeneous lookup in the standard unordered containers requires
+ *   C++20; with earlier standards the function object may still be used
+ *   as an ordinary hash function.
+ */
+struct string_hash
+{
+public: // member types
+    /// Marks the type as supporting heterogeneous lookup
+    typedef void                                            is_transparent;
+    /// The result type
+    typedef ss_size_t                                       result_type;
+
+public: // construction
+    /// Constructs an instance with the seed 0, so that its results equal
+    /// those of the <code>std::hash</code> specialisations
+    string_hash() STLSOFT_NOEXCEPT
+        : m_seed(0)
+    {}
+    /// Constructs an instance with the given seed
+    explicit string_hash(ss_uint64_t seed) STLSOFT_NOEXCEPT
+        : m_seed(seed)
+    {}
+
+public: // operations
+    /// Hashes the given string
+    template <ss_typename_param_k S>
+    result_type operator ()(S const& s) const
+    {
+        return static_cast<result_type>(hash_string(STLSOFT_NS_QUAL(c_str_data)(s), STLSOFT_NS_QUAL(c_str_len)(s), m_seed));
+    }
+
+private: // fields
+    ss_uint64_t m_seed;
+};
+
+/** Transparent function object that compares, for equality, the
+ * characters of any two string types.
+ *
+ * \ingroup group__library__String
+ *
+ * \see stlsoft::string_hash
+ */
+struct string_equal_to
+{
+public: // member types
+    /// Marks the type as supporting heterogeneous lookup
+    typedef void                                            is_transparent;
+    /// The result type
+    typedef ss_bool_t                                       result_type;
+
+public: // operations
+    /// Evaluates whether the two strings have the same characters
+    template<
+        ss_typename_param_k S1
+    ,   ss_typename_param_k S2
+    >
+    result_type operator ()(S1 const& lhs, S2 const& rhs) const
+    {
+        return equal_(STLSOFT_NS_QUAL(c_str_data)(lhs), STLSOFT_NS_QUAL(c_str_len)(lhs), STLSOFT_NS_QUAL(c_str_data)(rhs), STLSOFT_NS_QUAL(c_str_len)(rhs));
+    }
+
+private: // implementation
+    template <ss_typename_param_k C>
+    static result_type equal_(C const* s1, ss_size_t n1, C const* s2, ss_size_t n2)
+    {
+        return n1 == n2 && (0 == n1 || 0 == ::memcmp(s1, s2, n1 * sizeof(C)));
+    }
+};
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * std::hash specialisations
+ *
+ * All are consistent with stlsoft::string_hash, and so with one another.
+ */
+
+#if __cplusplus >= 201103L
+
+namespace std
+{
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k T
+    ,   ss_typename_param_k A
+    ,   ss_typename_param_k G
+    >
+    struct hash<STLSOFT_NS_QUAL(basic_simple_string)<C, T, A, G> >
+    {
+        size_t operator ()(STLSOFT_NS_QUAL(basic_simple_string)<C, T, A, G> const& s) const STLSOFT_NOEXCEPT
+        {
+            return static_cast<size_t>(STLSOFT_NS_QUAL(hash_string)(s.data(), s.size()));
+        }
+    };
+
+    template<
+        ss_typename_param_k C
+    ,   STLSOFT_NS_QUAL(ss_size_t) V_internalSize
+    ,   ss_typename_param_k T
+    >
+    struct hash<STLSOFT_NS_QUAL(basic_static_string)<C, V_internalSize, T> >
+    {
+        size_t operator ()(STLSOFT_NS_QUAL(basic_static_string)<C, V_internalSize, T> const& s) const STLSOFT_NOEXCEPT
+        {
+            return static_cast<size_t>(STLSOFT_NS_QUAL(hash_string)(s.data(), s.size()));
+        }
+    };
+
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k T
+    ,   ss_typename_param_k A
+    >
+    struct hash<STLSOFT_NS_QUAL(basic_string_view)<C, T, A> >
+    {
+        size_t operator ()(STLSOFT_NS_QUAL(basic_string_view)<C, T, A> const& s) const STLSOFT_NOEXCEPT
+        {
+            return static_cast<size_t>(STLSOFT_NS_QUAL(hash_string)(s.data(), s.size()));
+        }
+    };
+
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k T
+    ,   ss_typename_param_k P
+    >
+    struct hash<STLSOFT_NS_QUAL(string_slice)<C, T, P> >
+    {
+        size_t operator ()(STLSOFT_NS_QUAL(string_slice)<C, T, P> const& s) const STLSOFT_NOEXCEPT
+        {
+            return static_cast<size_t>(STLSOFT_NS_QUAL(hash_string)(s.ptr, s.len));
+        }
+    };
+} /* namespace std */
+#endif /* C++11+ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_HASH_FUNCTIONS */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose:     String replace functions.
  *
  * Created:     11th May 2010
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2010-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -43,7 +43,9 @@
 
 /** \file stlsoft/string/replace_functions.hpp
  *
- * \brief [C++] Definition of the stlsoft::replace() function template
+ * \brief [C++] Definition of the stlsoft::replace(),
+ *   stlsoft::replace_copy() and stlsoft::replace_multiple() function
+ *   templates
  *
  *   (\ref group__library__String "String" Library).
  */
@@ -53,9 +55,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_MAJOR     1
-# define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_MINOR     1
+# define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_MINOR     2
 # define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_REVISION  2
-# define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_EDIT      14
+# define STLSOFT_VER_STLSOFT_STRING_HPP_REPLACE_FUNCTIONS_EDIT      16
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -72,6 +74,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
 # include <stlsoft/shims/access/string.hpp>
 #endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
 
 #ifndef STLSOFT_INCL_STLSOFT_QUALITY_H_CONTRACT
 # include <stlsoft/quality/contract.h>
@@ -80,6 +85,15 @@
 # include <stlsoft/quality/cover.h>
 #endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
 
+#ifndef STLSOFT_INCL_ALGORITHM
+# define STLSOFT_INCL_ALGORITHM
+# include <algorithm>
+#endif /* !STLSOFT_INCL_ALGORITHM */
+#ifndef STLSOFT_INCL_STRING
+# define STLSOFT_INCL_STRING
+# include <string>
+#endif /* !STLSOFT_INCL_STRING */
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -93,6 +107,177 @@ namespace stlsoft
  * helper functions
  */
 
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_replace_functions
+{
+
+    /* Returns the position of the first occurrence of [f, f + lf) in
+     * [s, s + n) at or after pos, or n if there is none. The first
+     * character is located via char_traits<>::find(), which is memchr()
+     * (or wmemchr()) for the standard character types.
+     */
+    template <ss_typename_param_k C>
+    inline
+    ss_size_t
+    find_(
+        C const*    s
+    ,   ss_size_t   n
+    ,   C const*    f
+    ,   ss_size_t   lf
+    ,   ss_size_t   pos
+    )
+    {
+        typedef std::char_traits<C> traits_t;
+
+        STLSOFT_ASSERT(0 != lf);
+
+        for (; pos + lf <= n; ++pos)
+        {
+            C const* const p = traits_t::find(s + pos, n - pos - (lf - 1), f[0]);
+
+            if (NULL == p)
+            {
+                break;
+            }
+
+            pos = static_cast<ss_size_t>(p - s);
+
+            if (0 == traits_t::compare(p + 1, f + 1, lf - 1))
+            {
+                return pos;
+            }
+        }
+
+        return n;
+    }
+
+    /* Counts the non-overlapping occurrences of [f, f + lf) in [s, s + n)
+     */
+    template <ss_typename_param_k C>
+    inline
+    ss_size_t
+    count_(
+        C const*    s
+    ,   ss_size_t   n
+    ,   C const*    f
+    ,   ss_size_t   lf
+    )
+    {
+        ss_size_t count = 0;
+
+        { for (ss_size_t p = find_(s, n, f, lf, 0); p != n; p = find_(s, n, f, lf, p + lf))
+        {
+            ++count;
+        }}
+
+        return count;
+    }
+
+    /* Writes [s, s + n), with each non-overlapping occurrence of
+     * [f, f + lf) replaced by [r, r + lr), to the output iterator o
+     */
+    template<
+        ss_typename_param_k C
+    ,   ss_typename_param_k O
+    >
+    inline
+    O
+    copy_(
+        C const*    s
+    ,   ss_size_t   n
+    ,   C const*    f
+    ,   ss_size_t   lf
+    ,   C const*    r
+    ,   ss_size_t   lr
+    ,   O           o
+    )
+    {
+        ss_size_t from = 0;
+
+        { for (ss_size_t p = find_(s, n, f, lf, 0); p != n; p = find_(s, n, f, lf, from))
+        {
+            { for (ss_size_t i = from; i != p; ++i, ++o)
+            {
+                *o = s[i];
+            }}
+            { for (ss_size_t i = 0; i != lr; ++i, ++o)
+            {
+                *o = r[i];
+            }}
+
+            from = p + lf;
+        }}
+
+        { for (ss_size_t i = from; i != n; ++i, ++o)
+        {
+            *o = s[i];
+        }}
+
+        return o;
+    }
+
+    /* A find/replace pair, as used by replace_multiple() */
+    template <ss_typename_param_k C>
+    struct pattern_
+    {
+        C const*    f;
+        ss_size_t   lf;
+        C const*    r;
+        ss_size_t   lr;
+    };
+
+    /* Returns the index of the first pattern that matches at position pos
+     * of [s, s + n), or numPatterns if none does
+     */
+    template <ss_typename_param_k C>
+    inline
+    ss_size_t
+    match_at_(
+        C const*                s
+    ,   ss_size_t               n
+    ,   ss_size_t               pos
+    ,   pattern_<C> const*      patterns
+    ,   ss_size_t               numPatterns
+    )
+    {
+        { for (ss_size_t k = 0; k != numPatterns; ++k)
+        {
+            pattern_<C> const& pat = patterns[k];
+
+            if (pat.lf <= n - pos &&
+                s[pos] == pat.f[0] &&
+                0 == std::char_traits<C>::compare(s + pos, pat.f, pat.lf))
+            {
+                return k;
+            }
+        }}
+
+        return numPatterns;
+    }
+
+    /* Returns the first position at or after pos whose character - or,
+     * for wide characters, whose low byte - is marked in the given table,
+     * or n if there is none
+     */
+    template <ss_typename_param_k C>
+    inline
+    ss_size_t
+    next_candidate_(
+        C const*        s
+    ,   ss_size_t       n
+    ,   ss_size_t       pos
+    ,   ss_bool_t const (&firsts)[256]
+    )
+    {
+        for (; pos != n && !firsts[static_cast<ss_size_t>(s[pos]) & 0xff]; ++pos)
+        {}
+
+        return pos;
+    }
+
+} /* namespace ximpl_replace_functions */
+
 template<
     typename S0
 ,   typename C1
@@ -108,26 +293,102 @@ replace_impl(
 ,   ss_size_t   lr
 )
 {
-    size_t const lenOrig = str.size();
+    // Algorithm:
+    //
+    // 1. count the matches, and return if there are none;
+    // 2. if the replacement is the same length as the find string, then
+    //    overwrite each match in place;
+    // 3. otherwise, build the result - sized exactly, once - in a single
+    //    forward pass, and swap it in.
+    //
+    // This is O(n) regardless of the number of matches, whereas replacing
+    // each match in place shifts the tail of the string each time.
+
+    typedef ss_typename_type_k S0::value_type   char_t;
 
-    if (lf <= lenOrig)
+    if (0 == lf)
     {
-        ss_typename_type_k S0::size_type p;
+        return str;
+    }
+
+    char_t const* const s       =   str.data();
+    ss_size_t const     n       =   str.size();
+    ss_size_t const     count   =   ximpl_replace_functions::count_(s, n, f, lf);
 
-        { for (p = str.find(f, 0, lf); p < str.size(); p = str.find(f, p, lf))
+    if (0 == count)
+    {
+        ; // nothing to do
+    }
+    else
+    if (lf == lr)
+    {
+        { for (ss_size_t p = ximpl_replace_functions::find_(s, n, f, lf, 0); p != n; p = ximpl_replace_functions::find_(str.data(), n, f, lf, p + lf))
         {
-            str.replace(str.begin() + p, str.begin() + p + lf, r, lr);
-            p = p + lr - lf + 1;
+            { for (ss_size_t i = 0; i != lr; ++i)
+            {
+                str[p + i] = r[i];
+            }}
         }}
     }
+    else
+    {
+        S0 result;
+
+        result.reserve(n - count * lf + count * lr);
+
+        ss_size_t from = 0;
+
+        { for (ss_size_t p = ximpl_replace_functions::find_(s, n, f, lf, 0); p != n; p = ximpl_replace_functions::find_(s, n, f, lf, from))
+        {
+            result.append(s + from, p - from);
+            result.append(r, lr);
+
+            from = p + lf;
+        }}
+
+        result.append(s + from, n - from);
+
+        str.swap(result);
+    }
 
     return str;
 }
 
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /* /////////////////////////////////////////////////////////////////////////
  * API functions
  */
 
+/** Replaces, in place, all non-overlapping occurrences of a find string
+ * with a replace string
+ *
+ * \param str The string to be modified. Its type must provide
+ *   <code>data()</code>, <code>size()</code>, <code>reserve()</code>,
+ *   <code>append(ptr, len)</code>, <code>swap()</code> and mutating
+ *   subscript
+ * \param findString The string to find. If empty, \c str is unchanged
+ * \param replaceString The string with which to replace each occurrence
+ *
+ * \return \c str
+ *
+ * \remarks Occurrences are matched left-to-right in the original string,
+ *   and replaced text is not searched again. Runs in time linear in the
+ *   length of \c str, and allocates at most once.
+ *
+ * \note Prior to version 1.2 of this file, each match was replaced in
+ *   place with <code>str.replace()</code>, and the search resumed at an
+ *   offset of <code>lr - lf + 1</code> from the match, where \c lf and
+ *   \c lr are the lengths of the find and replace strings. This could
+ *   match text that straddled the end of a replacement (so that
+ *   replacing <code>"aa"</code> by <code>"aaa"</code> in
+ *   <code>"aaaa"</code> gave <code>"aaaaaaa"</code>, rather than the
+ *   <code>"aaaaaa"</code> given now), and it could skip matches when
+ *   the replace string was shorter than the find string. The type of
+ *   \c str was then required to provide only <code>size()</code>,
+ *   <code>begin()</code>, <code>find()</code> and
+ *   <code>replace()</code>.
+ */
 template<
     typename S0
 ,   typename S1
@@ -150,6 +411,241 @@ replace(
             );
 }
 
+/** Writes a copy of a source string to an output iterator, with all
+ * non-overlapping occurrences of a find string replaced with a replace
+ * string
+ *
+ * \param str The source string
+ * \param findString The string to find. If empty, \c str is copied
+ *   unchanged
+ * \param replaceString The string with which to replace each occurrence
+ * \param o The output iterator
+ *
+ * \return The output iterator, one past the last character written
+ */
+template<
+    typename S0
+,   typename S1
+,   typename S2
+,   typename O
+>
+inline
+O
+replace_copy(
+    S0 const&   str
+,   S1 const&   findString
+,   S2 const&   replaceString
+,   O           o
+)
+{
+    ss_size_t const lf = stlsoft::c_str_len(findString);
+
+    if (0 == lf)
+    {
+        return STLSOFT_NS_QUAL_STD(copy)(stlsoft::c_str_data(str), stlsoft::c_str_data(str) + stlsoft::c_str_len(str), o);
+    }
+
+    return ximpl_replace_functions::copy_(
+                stlsoft::c_str_data(str)
+            ,   stlsoft::c_str_len(str)
+            ,   stlsoft::c_str_data(findString)
+            ,   lf
+            ,   stlsoft::c_str_data(replaceString)
+            ,   stlsoft::c_str_len(replaceString)
+            ,   o
+            );
+}
+
+/** Writes a copy of a source string to a caller-supplied buffer, with all
+ * non-overlapping occurrences of a find string replaced with a replace
+ * string
+ *
+ * \param str The source string
+ * \param findString The string to find. If empty, \c str is copied
+ *   unchanged
+ * \param replaceString The string with which to replace each occurrence
+ * \param buffer Pointer to the buffer. May be \c NULL, in which case the
+ *   required size is returned
+ * \param cchBuffer The size of the buffer, in characters
+ *
+ * \return The number of characters required for the result, which is
+ *   the number written if <code>cchBuffer</code> is sufficient; if it is
+ *   not, nothing is written. No nul-terminator is written, and none is
+ *   included in the required size
+ */
+template<
+    typename S0
+,   typename S1
+,   typename S2
+,   typename C
+>
+inline
+ss_size_t
+replace_copy(
+    S0 const&   str
+,   S1 const&   findString
+,   S2 const&   replaceString
+,   C*          buffer
+,   ss_size_t   cchBuffer
+)
+{
+    C const* const  s   =   stlsoft::c_str_data(str);
+    ss_size_t const n   =   stlsoft::c_str_len(str);
+    C const* const  f   =   stlsoft::c_str_data(findString);
+    ss_size_t const lf  =   stlsoft::c_str_len(findString);
+    C const* const  r   =   stlsoft::c_str_data(replaceString);
+    ss_size_t const lr  =   stlsoft::c_str_len(replaceString);
+
+    ss_size_t const count       =   (0 == lf) ? 0 : ximpl_replace_functions::count_(s, n, f, lf);
+    ss_size_t const required    =   n - count * lf + count * lr;
+
+    if (NULL != buffer &&
+        cchBuffer >= required)
+    {
+        if (0 == count)
+        {
+            std::char_traits<C>::copy(buffer, s, n);
+        }
+        else
+        {
+            ximpl_replace_functions::copy_(s, n, f, lf, r, lr, buffer);
+        }
+    }
+
+    return required;
+}
+
+/** Replaces, in place and in a single scan, all occurrences of each of a
+ * number of find strings with its corresponding replace string
+ *
+ * \param str The string to be modified. Its type must provide the same
+ *   operations as required by stlsoft::replace()
+ * \param from The start of the range of find/replace pairs. Each element
+ *   must have members <code>first</code> and <code>second</code>, to
+ *   which the string access shims can be applied
+ * \param to The end of the range of find/replace pairs
+ *
+ * \return \c str
+ *
+ * \remarks At each position the pairs are tried in order, and the first
+ *   whose find string matches is applied; scanning then resumes after the
+ *   matched text. Pairs with empty find strings are ignored. The result is
+ *   built, at most once, after a counting pass that determines its exact
+ *   size.
+ */
+template<
+    typename S0
+,   typename I
+>
+inline
+S0&
+replace_multiple(
+    S0& str
+,   I   from
+,   I   to
+)
+{
+    typedef ss_typename_type_k S0::value_type                   char_t;
+    typedef ximpl_replace_functions::pattern_<char_t>           pattern_t;
+    typedef auto_buffer<pattern_t, 16>                          patterns_t;
+
+    patterns_t  patterns(0);
+
+    for (; from != to; ++from)
+    {
+        pattern_t pat;
+
+        pat.f   =   stlsoft::c_str_data((*from).first);
+        pat.lf  =   stlsoft::c_str_len((*from).first);
+        pat.r   =   stlsoft::c_str_data((*from).second);
+        pat.lr  =   stlsoft::c_str_len((*from).second);
+
+        if (0 != pat.lf)
+        {
+            patterns.resize(patterns.size() + 1);
+            patterns[patterns.size() - 1] = pat;
+        }
+    }
+
+    pattern_t const* const  pats    =   patterns.data();
+    ss_size_t const         np      =   patterns.size();
+    char_t const* const     s       =   str.data();
+    ss_size_t const         n       =   str.size();
+
+    if (0 == np)
+    {
+        return str;
+    }
+
+    // 1. mark the (low bytes of the) first characters of the find
+    //    strings, so that positions that cannot match are skipped cheaply
+
+    ss_bool_t firsts[256] = { false };
+
+    { for (ss_size_t k = 0; k != np; ++k)
+    {
+        firsts[static_cast<ss_size_t>(pats[k].f[0]) & 0xff] = true;
+    }}
+
+    // 2. count the result size
+
+    ss_size_t   required    =   n;
+    ss_size_t   numMatches  =   0;
+
+    { for (ss_size_t pos = ximpl_replace_functions::next_candidate_(s, n, 0, firsts); pos != n; pos = ximpl_replace_functions::next_candidate_(s, n, pos, firsts))
+    {
+        ss_size_t const k = ximpl_replace_functions::match_at_(s, n, pos, pats, np);
+
+        if (k == np)
+        {
+            ++pos;
+        }
+        else
+        {
+            required = required - pats[k].lf + pats[k].lr;
+            pos += pats[k].lf;
+            ++numMatches;
+        }
+    }}
+
+    if (0 == numMatches)
+    {
+        return str;
+    }
+
+    // 3. build the result
+
+    S0 result;
+
+    result.reserve(required);
+
+    ss_size_t lit = 0;
+
+    { for (ss_size_t pos = ximpl_replace_functions::next_candidate_(s, n, 0, firsts); pos != n; pos = ximpl_replace_functions::next_candidate_(s, n, pos, firsts))
+    {
+        ss_size_t const k = ximpl_replace_functions::match_at_(s, n, pos, pats, np);
+
+        if (k == np)
+        {
+            ++pos;
+        }
+        else
+        {
+            result.append(s + lit, pos - lit);
+            result.append(pats[k].r, pats[k].lr);
+
+            pos += pats[k].lf;
+            lit = pos;
+        }
+    }}
+
+    result.append(s + lit, n - lit);
+
+    str.swap(result);
+
+    return str;
+}
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -4,11 +4,11 @@
  * Purpose:     basic_simple_string class template.
  *
  * Created:     19th March 1993
- * Updated:     30th January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 1993-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,9 +53,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MAJOR    4
-# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MINOR    4
+# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_MINOR    5
 # define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_REVISION 1
-# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_EDIT     271
+# define STLSOFT_VER_STLSOFT_STRING_HPP_SIMPLE_STRING_EDIT     272
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -145,11 +145,51 @@ namespace stlsoft
  * classes
  */
 
+/** Growth policy for stlsoft::basic_simple_string that grows the capacity
+ * geometrically - by half as much again - so that building a string of
+ * \c N characters by appending performs <code>O(N)</code> copying.
+ *
+ * \ingroup group__library__String
+ */
+struct simple_string_geometric_growth
+{
+    /// Calculates the new capacity, in characters (excluding the
+    /// terminating nul), when the current capacity \c capacity is
+    /// insufficient to hold \c required characters
+    static ss_size_t calc_capacity(ss_size_t capacity, ss_size_t required)
+    {
+        ss_size_t const grown = capacity + capacity / 2;
+
+        return (grown < required) ? required : grown;
+    }
+};
+
+/** Growth policy for stlsoft::basic_simple_string that grows the capacity
+ * only to that required, which minimises memory use for strings that are
+ * not built incrementally.
+ *
+ * \ingroup group__library__String
+ *
+ * \note This was the behaviour of all versions of the class prior to the
+ *   introduction of growth policies.
+ */
+struct simple_string_exact_growth
+{
+    /// Calculates the new capacity, in characters (excluding the
+    /// terminating nul), when the current capacity is insufficient to
+    /// hold \c required characters
+    static ss_size_t calc_capacity(ss_size_t /* capacity */, ss_size_t required)
+    {
+        return required;
+    }
+};
+
 /** Simple string class
  *
  * \param C The character type
  * \param T The traits type. On translators that support default template arguments this is defaulted to char_traits<C>
  * \param A The allocator type. On translators that support default template arguments this is defaulted to allocator_selector<C>::allocator_type
+ * \param G The growth policy type, which determines the capacity to which the string grows when appending. On translators that support default template arguments this is defaulted to stlsoft::simple_string_geometric_growth
  *
  * \ingroup group__library__String
  */
@@ -157,9 +197,11 @@ template<   ss_typename_param_k C
 #ifdef STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT
         ,   ss_typename_param_k T = stlsoft_char_traits<C>
         ,   ss_typename_param_k A = ss_typename_type_def_k allocator_selector<C>::allocator_type
+        ,   ss_typename_param_k G = simple_string_geometric_growth
 #else /* ? STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
         ,   ss_typename_param_k T /* = stlsoft_char_traits<C> */
         ,   ss_typename_param_k A /* = allocator_selector<C>::allocator_type */
+        ,   ss_typename_param_k G /* = simple_string_geometric_growth */
 #endif /* STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
         >
 // class basic_simple_string
@@ -175,8 +217,10 @@ public:
     typedef T                                               traits_type;
     /// The allocator type
     typedef A                                               allocator_type;
+    /// The growth policy type
+    typedef G                                               growth_policy_type;
     /// The current specialisation of the type
-    typedef basic_simple_string<C, T, A>                    class_type;
+    typedef basic_simple_string<C, T, A, G>                 class_type;
     /// The character type
     typedef value_type                                      char_type;
     /// The pointer type
@@ -393,6 +437,41 @@ public:
     /// \param ch The value with which to initialise additional items if the string is expanded
     void resize(size_type cch, value_type ch = value_type());
 
+#ifdef STLSOFT_CF_MEMBER_TEMPLATE_FUNCTION_SUPPORT
+    /// Resizes the string, having the given function write its contents
+    /// directly into the string's storage, thereby avoiding both the
+    /// initialisation of the new characters and an intermediate buffer
+    ///
+    /// \param cch The maximum new size of the string
+    /// \param op The function, which is invoked as <code>op(p, cch)</code>,
+    ///   where \c p points to storage for at least \c cch characters
+    ///   (plus a terminating nul) whose first size() characters are the
+    ///   current contents of the string. It must return the new size of
+    ///   the string, which must not exceed \c cch, and must not retain
+    ///   \c p
+    ///
+    /// \note If \c op throws an exception the string retains its size,
+    ///   but its contents are undefined
+    template <ss_typename_param_k O>
+    void resize_and_overwrite(size_type cch, O op)
+    {
+        STLSOFT_ASSERT(is_valid());
+
+        if (grow_(cch))
+        {
+            string_buffer* const    buffer  =   string_buffer_from_member_pointer_(m_buffer);
+            size_type const         len     =   static_cast<size_type>(op(buffer->contents, cch));
+
+            STLSOFT_ASSERT(len <= cch);
+
+            buffer->length          =   len;
+            buffer->contents[len]   =   traits_type::to_char_type(0);
+        }
+
+        STLSOFT_ASSERT(is_valid());
+    }
+#endif /* STLSOFT_CF_MEMBER_TEMPLATE_FUNCTION_SUPPORT */
+
     /// Empties the string
     void clear();
 /// @}
@@ -595,6 +674,11 @@ private:
     static void                 destroy_buffer_(string_buffer*);
     static void                 destroy_buffer_(char_type*);
 
+    // Ensures the capacity for cch characters, growing according to the
+    // growth policy. Returns false only if the allocator fails without
+    // throwing
+    ss_bool_t                   grow_(size_type cch);
+
     // Iteration
     pointer                     begin_();
     pointer                     end_();
@@ -698,11 +782,13 @@ typedef basic_simple_string<
     ss_char_a_t
 ,   stlsoft_char_traits<ss_char_a_t>
 ,   allocator_selector<ss_char_a_t>::allocator_type
+,   simple_string_geometric_growth
 >                                                           simple_string;
 typedef basic_simple_string<
     ss_char_w_t
 ,   stlsoft_char_traits<ss_char_w_t>
 ,   allocator_selector<ss_char_w_t>::allocator_type
+,   simple_string_geometric_growth
 >                                                           simple_wstring;
 #endif /* STLSOFT_CF_TEMPLATE_CLASS_DEFAULT_CLASS_ARGUMENT_SUPPORT */
 
@@ -717,9 +803,10 @@ template<
     ss_typename_param_k C
 ,   ss_typename_param_k T
 ,   ss_typename_param_k A
+,   ss_typename_param_k G
 >
 struct string_traits<
-   basic_simple_string<C, T, A>
+   basic_simple_string<C, T, A, G>
 >
 {
     // NOTE: Originally, what is string_type_ was defined as value_type, but
@@ -863,8 +950,9 @@ struct string_traits<simple_wstring>
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator ==(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator ==(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return 0 == lhs.compare(rhs);
 }
@@ -872,11 +960,12 @@ inline ss_bool_t operator ==(basic_simple_string<C, T, A> const& lhs, basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator ==(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator ==(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator ==(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator ==(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return 0 == lhs.compare(rhs);
@@ -885,11 +974,12 @@ inline ss_bool_t operator ==(basic_simple_string<C, T, A> const& lhs, C const* r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator ==(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator ==(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator ==(C *lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator ==(C *lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return 0 == rhs.compare(lhs);
@@ -900,19 +990,21 @@ inline ss_bool_t operator ==(C *lhs, basic_simple_string<C, T, A> const& rhs)
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator !=(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator !=(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return 0 != lhs.compare(rhs);
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator !=(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator !=(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator !=(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator !=(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return 0 != lhs.compare(rhs);
@@ -920,11 +1012,12 @@ inline ss_bool_t operator !=(basic_simple_string<C, T, A> const& lhs, C const* r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator !=(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator !=(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator !=(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator !=(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return 0 != rhs.compare(lhs);
@@ -935,8 +1028,9 @@ inline ss_bool_t operator !=(C const* lhs, basic_simple_string<C, T, A> const& r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator <(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return lhs.compare(rhs) < 0;
 }
@@ -944,11 +1038,12 @@ inline ss_bool_t operator <(basic_simple_string<C, T, A> const& lhs, basic_simpl
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator <(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator <(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator <(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator <(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return lhs.compare(rhs) < 0;
@@ -957,11 +1052,12 @@ inline ss_bool_t operator <(basic_simple_string<C, T, A> const& lhs, C const* rh
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator <(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator <(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return rhs.compare(lhs) > 0;
@@ -972,19 +1068,21 @@ inline ss_bool_t operator <(C const* lhs, basic_simple_string<C, T, A> const& rh
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator <=(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <=(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return lhs.compare(rhs) <= 0;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator <=(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator <=(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator <=(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator <=(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return lhs.compare(rhs) <= 0;
@@ -992,11 +1090,12 @@ inline ss_bool_t operator <=(basic_simple_string<C, T, A> const& lhs, C const* r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator <=(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <=(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator <=(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator <=(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return rhs.compare(lhs) >= 0;
@@ -1007,19 +1106,21 @@ inline ss_bool_t operator <=(C const* lhs, basic_simple_string<C, T, A> const& r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator >(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return lhs.compare(rhs) > 0;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator >(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator >(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator >(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator >(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return lhs.compare(rhs) > 0;
@@ -1027,11 +1128,12 @@ inline ss_bool_t operator >(basic_simple_string<C, T, A> const& lhs, C const* rh
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator >(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator >(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return rhs.compare(lhs) < 0;
@@ -1042,19 +1144,21 @@ inline ss_bool_t operator >(C const* lhs, basic_simple_string<C, T, A> const& rh
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t operator >=(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >=(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
     return lhs.compare(rhs) >= 0;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator >=(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline ss_bool_t operator >=(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator >=(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline ss_bool_t operator >=(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return lhs.compare(rhs) >= 0;
@@ -1062,11 +1166,12 @@ inline ss_bool_t operator >=(basic_simple_string<C, T, A> const& lhs, C const* r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline ss_bool_t operator >=(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >=(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline ss_bool_t operator >=(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline ss_bool_t operator >=(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
     return rhs.compare(lhs) <= 0;
@@ -1077,58 +1182,63 @@ inline ss_bool_t operator >=(C const* lhs, basic_simple_string<C, T, A> const& r
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A> operator +(basic_simple_string<C, T, A> const& lhs, basic_simple_string<C, T, A> const& rhs)
+inline basic_simple_string<C, T, A, G> operator +(basic_simple_string<C, T, A, G> const& lhs, basic_simple_string<C, T, A, G> const& rhs)
 {
-    return basic_simple_string<C, T, A>(lhs) += rhs;
+    return basic_simple_string<C, T, A, G>(lhs) += rhs;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline basic_simple_string<C, T, A> operator +(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type const* rhs)
+inline basic_simple_string<C, T, A, G> operator +(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline basic_simple_string<C, T, A> operator +(basic_simple_string<C, T, A> const& lhs, C const* rhs)
+inline basic_simple_string<C, T, A, G> operator +(basic_simple_string<C, T, A, G> const& lhs, C const* rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
-    return basic_simple_string<C, T, A>(lhs) += rhs;
+    return basic_simple_string<C, T, A, G>(lhs) += rhs;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline basic_simple_string<C, T, A> operator +(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline basic_simple_string<C, T, A, G> operator +(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline basic_simple_string<C, T, A> operator +(C const* lhs, basic_simple_string<C, T, A> const& rhs)
+inline basic_simple_string<C, T, A, G> operator +(C const* lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
-    return basic_simple_string<C, T, A>(lhs) += rhs;
+    return basic_simple_string<C, T, A, G>(lhs) += rhs;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline basic_simple_string<C, T, A> operator +(basic_simple_string<C, T, A> const& lhs, ss_typename_type_k basic_simple_string<C, T, A>::char_type rhs)
+inline basic_simple_string<C, T, A, G> operator +(basic_simple_string<C, T, A, G> const& lhs, ss_typename_type_k basic_simple_string<C, T, A, G>::char_type rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline basic_simple_string<C, T, A> operator +(basic_simple_string<C, T, A> const& lhs, C rhs)
+inline basic_simple_string<C, T, A, G> operator +(basic_simple_string<C, T, A, G> const& lhs, C rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
-    return basic_simple_string<C, T, A>(lhs) += rhs;
+    return basic_simple_string<C, T, A, G>(lhs) += rhs;
 }
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 #ifdef STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT
-inline basic_simple_string<C, T, A> operator +(ss_typename_type_k basic_simple_string<C, T, A>::char_type lhs, basic_simple_string<C, T, A> const& rhs)
+inline basic_simple_string<C, T, A, G> operator +(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type lhs, basic_simple_string<C, T, A, G> const& rhs)
 #else /* ? STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
-inline basic_simple_string<C, T, A> operator +(C lhs, basic_simple_string<C, T, A> const& rhs)
+inline basic_simple_string<C, T, A, G> operator +(C lhs, basic_simple_string<C, T, A, G> const& rhs)
 #endif /* STLSOFT_CF_TEMPLATE_OUTOFCLASSFN_QUALIFIED_TYPE_SUPPORT */
 {
-    return basic_simple_string<C, T, A>(1, lhs) += rhs;
+    return basic_simple_string<C, T, A, G>(1, lhs) += rhs;
 }
 
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
@@ -1146,8 +1256,9 @@ inline basic_simple_string<C, T, A> operator +(C lhs, basic_simple_string<C, T,
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline C const* c_str_ptr_null(basic_simple_string<C, T, A> const& s)
+inline C const* c_str_ptr_null(basic_simple_string<C, T, A, G> const& s)
 {
     return (0 == s.length()) ? NULL : s.c_str();
 }
@@ -1155,8 +1266,8 @@ inline C const* c_str_ptr_null(basic_simple_string<C, T, A> const& s)
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_a_t const* c_str_ptr_null_a(basic_simple_string<ss_char_a_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_a_t const* c_str_ptr_null_a(basic_simple_string<ss_char_a_t, T, A, G> const& s)
 {
     return c_str_ptr_null(s);
 }
@@ -1164,8 +1275,8 @@ inline ss_char_a_t const* c_str_ptr_null_a(basic_simple_string<ss_char_a_t, T, A
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_w_t const* c_str_ptr_null_w(basic_simple_string<ss_char_w_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_w_t const* c_str_ptr_null_w(basic_simple_string<ss_char_w_t, T, A, G> const& s)
 {
     return c_str_ptr_null(s);
 }
@@ -1179,8 +1290,9 @@ inline ss_char_w_t const* c_str_ptr_null_w(basic_simple_string<ss_char_w_t, T, A
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline C const* c_str_ptr(basic_simple_string<C, T, A> const& s)
+inline C const* c_str_ptr(basic_simple_string<C, T, A, G> const& s)
 {
     return s.c_str();
 }
@@ -1188,8 +1300,8 @@ inline C const* c_str_ptr(basic_simple_string<C, T, A> const& s)
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_a_t const* c_str_ptr_a(basic_simple_string<ss_char_a_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_a_t const* c_str_ptr_a(basic_simple_string<ss_char_a_t, T, A, G> const& s)
 {
     return c_str_ptr(s);
 }
@@ -1197,8 +1309,8 @@ inline ss_char_a_t const* c_str_ptr_a(basic_simple_string<ss_char_a_t, T, A> con
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_w_t const* c_str_ptr_w(basic_simple_string<ss_char_w_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_w_t const* c_str_ptr_w(basic_simple_string<ss_char_w_t, T, A, G> const& s)
 {
     return c_str_ptr(s);
 }
@@ -1212,8 +1324,9 @@ inline ss_char_w_t const* c_str_ptr_w(basic_simple_string<ss_char_w_t, T, A> con
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline C const* c_str_data(basic_simple_string<C, T, A> const& s)
+inline C const* c_str_data(basic_simple_string<C, T, A, G> const& s)
 {
     return s.data();
 }
@@ -1221,8 +1334,8 @@ inline C const* c_str_data(basic_simple_string<C, T, A> const& s)
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_a_t const* c_str_data_a(basic_simple_string<ss_char_a_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_a_t const* c_str_data_a(basic_simple_string<ss_char_a_t, T, A, G> const& s)
 {
     return c_str_data(s);
 }
@@ -1230,8 +1343,8 @@ inline ss_char_a_t const* c_str_data_a(basic_simple_string<ss_char_a_t, T, A> co
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_char_w_t const* c_str_data_w(basic_simple_string<ss_char_w_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_char_w_t const* c_str_data_w(basic_simple_string<ss_char_w_t, T, A, G> const& s)
 {
     return c_str_data(s);
 }
@@ -1245,8 +1358,9 @@ inline ss_char_w_t const* c_str_data_w(basic_simple_string<ss_char_w_t, T, A> co
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_size_t c_str_len(basic_simple_string<C, T, A> const& s)
+inline ss_size_t c_str_len(basic_simple_string<C, T, A, G> const& s)
 {
     return s.length();
 }
@@ -1254,8 +1368,8 @@ inline ss_size_t c_str_len(basic_simple_string<C, T, A> const& s)
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_size_t c_str_len_a(basic_simple_string<ss_char_a_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_size_t c_str_len_a(basic_simple_string<ss_char_a_t, T, A, G> const& s)
 {
     return c_str_len(s);
 }
@@ -1263,8 +1377,8 @@ inline ss_size_t c_str_len_a(basic_simple_string<ss_char_a_t, T, A> const& s)
  *
  * \ingroup group__library__String
  */
-template<ss_typename_param_k T, ss_typename_param_k A>
-inline ss_size_t c_str_len_w(basic_simple_string<ss_char_w_t, T, A> const& s)
+template<ss_typename_param_k T, ss_typename_param_k A, ss_typename_param_k G>
+inline ss_size_t c_str_len_w(basic_simple_string<ss_char_w_t, T, A, G> const& s)
 {
     return c_str_len(s);
 }
@@ -1280,12 +1394,13 @@ template <
 ,   ss_typename_param_k C
 ,   ss_typename_param_k T
 ,   ss_typename_param_k A
+,   ss_typename_param_k G
 >
 inline
 T_stream&
 operator <<(
     T_stream&                           stm
-,   basic_simple_string<C, T, A> const& s
+,   basic_simple_string<C, T, A, G> const& s
 )
 {
     STLSOFT_NS_USING(util::string_insert);
@@ -1303,8 +1418,9 @@ operator <<(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void swap(basic_simple_string<C, T, A>& lhs, basic_simple_string<C, T, A>& rhs)
+inline void swap(basic_simple_string<C, T, A, G>& lhs, basic_simple_string<C, T, A, G>& rhs)
 {
     lhs.swap(rhs);
 }
@@ -1320,8 +1436,9 @@ inline void swap(basic_simple_string<C, T, A>& lhs, basic_simple_string<C, T, A>
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::char_type* basic_simple_string<C, T, A>::char_pointer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A>::member_pointer m)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::char_type* basic_simple_string<C, T, A, G>::char_pointer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A, G>::member_pointer m)
 {
 #ifdef STLSOFT_SIMPLE_STRING_NO_PTR_ADJUST
     return (NULL == m) ? NULL : m->contents;
@@ -1334,8 +1451,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::char_ty
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::string_buffer* basic_simple_string<C, T, A>::string_buffer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A>::member_pointer m)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::string_buffer* basic_simple_string<C, T, A, G>::string_buffer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A, G>::member_pointer m)
 {
     STLSOFT_MESSAGE_ASSERT("Attempt to convert a null string_buffer in basic_simple_string", NULL != m);
 
@@ -1349,8 +1467,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::string_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::string_buffer const* basic_simple_string<C, T, A>::string_buffer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A>::member_const_pointer m)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::string_buffer const* basic_simple_string<C, T, A, G>::string_buffer_from_member_pointer_(ss_typename_type_k basic_simple_string<C, T, A, G>::member_const_pointer m)
 {
     STLSOFT_MESSAGE_ASSERT("Attempt to convert a null string_buffer in basic_simple_string", NULL != m);
 
@@ -1364,8 +1483,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::string_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer basic_simple_string<C, T, A>::member_pointer_from_string_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::string_buffer* b)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::member_pointer basic_simple_string<C, T, A, G>::member_pointer_from_string_buffer_(ss_typename_type_k basic_simple_string<C, T, A, G>::string_buffer* b)
 {
 #ifdef STLSOFT_SIMPLE_STRING_NO_PTR_ADJUST
     return b;
@@ -1377,11 +1497,12 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer basic_simple_string<C, T, A>::alloc_buffer_(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          capacity
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          length
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::member_pointer basic_simple_string<C, T, A, G>::alloc_buffer_(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   s
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          capacity
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          length
 )
 {
     // Pre-conditions
@@ -1428,10 +1549,11 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer basic_simple_string<C, T, A>::alloc_buffer_(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::member_pointer basic_simple_string<C, T, A, G>::alloc_buffer_(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   s
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
 {
     size_type   length      =   traits_type::length_max_null(s, cch);
@@ -1448,8 +1570,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer basic_simple_string<C, T, A>::alloc_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::member_pointer basic_simple_string<C, T, A, G>::alloc_buffer_(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s)
 {
     member_pointer res;
 
@@ -1470,27 +1593,17 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_pointer basic_simple_string<C, T, A>::copy_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::member_pointer m)
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::member_pointer basic_simple_string<C, T, A, G>::copy_buffer_(ss_typename_type_k basic_simple_string<C, T, A, G>::member_pointer m)
 {
     if (NULL != m)
     {
-        byte_ator_type          byte_ator;
-        string_buffer* const    buffer      =   string_buffer_from_member_pointer_(m);
-        ss_size_t const         cb          =   buffer->capacity * sizeof(char_type) + STLSOFT_RAW_OFFSETOF(string_buffer, contents);
-# ifdef STLSOFT_LF_ALLOCATOR_ALLOCATE_HAS_HINT
-        void* const             raw_buffer  =   byte_ator.allocate(cb, NULL);
-# else /* ? STLSOFT_LF_ALLOCATOR_ALLOCATE_HAS_HINT */
-        void* const             raw_buffer  =   byte_ator.allocate(cb);
-# endif /* STLSOFT_LF_ALLOCATOR_ALLOCATE_HAS_HINT */
-        string_buffer* const    new_buffer  =   sap_cast<string_buffer*>(raw_buffer);
-
-        if (NULL != new_buffer)
-        {
-            STLSOFT_API_INTERNAL_memfns_memcpy(new_buffer, buffer, cb);
+        // Only the contents are copied: any spare capacity obtained by
+        // the growth policy is not propagated to the copy
+        string_buffer* const buffer = string_buffer_from_member_pointer_(m);
 
-            return member_pointer_from_string_buffer_(new_buffer);
-        }
+        return alloc_buffer_(buffer->contents, buffer->length, buffer->length);
     }
 
     return NULL;
@@ -1499,8 +1612,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::member_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ void basic_simple_string<C, T, A>::destroy_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::string_buffer* buffer)
+inline /* static */ void basic_simple_string<C, T, A, G>::destroy_buffer_(ss_typename_type_k basic_simple_string<C, T, A, G>::string_buffer* buffer)
 {
     byte_ator_type byte_ator;
 
@@ -1510,8 +1624,9 @@ inline /* static */ void basic_simple_string<C, T, A>::destroy_buffer_(ss_typena
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ void basic_simple_string<C, T, A>::destroy_buffer_(ss_typename_type_k basic_simple_string<C, T, A>::char_type* s)
+inline /* static */ void basic_simple_string<C, T, A, G>::destroy_buffer_(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type* s)
 {
     destroy_buffer_(string_buffer_from_member_pointer_(s));
 }
@@ -1519,8 +1634,48 @@ inline /* static */ void basic_simple_string<C, T, A>::destroy_buffer_(ss_typena
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::pointer basic_simple_string<C, T, A>::begin_()
+inline ss_bool_t basic_simple_string<C, T, A, G>::grow_(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type cch)
+{
+    if (NULL == m_buffer)
+    {
+        m_buffer = alloc_buffer_(NULL, cch, 0);
+
+        return NULL != m_buffer;
+    }
+    else
+    {
+        string_buffer* const buffer = string_buffer_from_member_pointer_(m_buffer);
+
+        // The buffer's capacity includes the terminating nul
+        if (cch < buffer->capacity)
+        {
+            return true;
+        }
+        else
+        {
+            member_pointer const new_buffer = alloc_buffer_(buffer->contents, growth_policy_type::calc_capacity(buffer->capacity - 1, cch), buffer->length);
+
+            if (NULL == new_buffer) // Some allocators do not throw on failure!
+            {
+                return false;
+            }
+
+            destroy_buffer_(buffer);
+            m_buffer = new_buffer;
+
+            return true;
+        }
+    }
+}
+
+template<   ss_typename_param_k C
+        ,   ss_typename_param_k T
+        ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
+        >
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::pointer basic_simple_string<C, T, A, G>::begin_()
 {
     return char_pointer_from_member_pointer_(m_buffer);
 }
@@ -1528,8 +1683,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::pointer basic_simple
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::pointer basic_simple_string<C, T, A>::end_()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::pointer basic_simple_string<C, T, A, G>::end_()
 {
     return begin_() + length();
 }
@@ -1537,8 +1693,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::pointer basic_simple
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t basic_simple_string<C, T, A>::is_valid() const
+inline ss_bool_t basic_simple_string<C, T, A, G>::is_valid() const
 {
     if (NULL != m_buffer)
     {
@@ -1569,8 +1726,9 @@ inline ss_bool_t basic_simple_string<C, T, A>::is_valid() const
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::char_type const* basic_simple_string<C, T, A>::empty_string_()
+inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A, G>::char_type const* basic_simple_string<C, T, A, G>::empty_string_()
 {
     // This character array is initialised to 0, which conveniently happens to
     // be the empty string, by the module/application load, so it is
@@ -1587,8 +1745,9 @@ inline /* static */ ss_typename_type_ret_k basic_simple_string<C, T, A>::char_ty
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string()
+inline basic_simple_string<C, T, A, G>::basic_simple_string()
     : m_buffer(NULL)
 {
     STLSOFT_ASSERT(is_valid());
@@ -1597,8 +1756,9 @@ inline basic_simple_string<C, T, A>::basic_simple_string()
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(class_type const& rhs)
+inline basic_simple_string<C, T, A, G>::basic_simple_string(class_type const& rhs)
     : m_buffer(copy_buffer_(rhs.m_buffer))
 {
     STLSOFT_ASSERT(rhs.is_valid());
@@ -1608,10 +1768,11 @@ inline basic_simple_string<C, T, A>::basic_simple_string(class_type const& rhs)
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(
-    ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
+inline basic_simple_string<C, T, A, G>::basic_simple_string(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
 )
     : m_buffer(alloc_buffer_(&rhs[pos]))
 {
@@ -1621,11 +1782,12 @@ inline basic_simple_string<C, T, A>::basic_simple_string(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(
-    ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline basic_simple_string<C, T, A, G>::basic_simple_string(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
     : m_buffer(alloc_buffer_(&rhs[pos], cch, minimum(cch, rhs.length() - pos)))
 {
@@ -1635,8 +1797,9 @@ inline basic_simple_string<C, T, A>::basic_simple_string(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s) // No, not explicit. Sigh
+inline basic_simple_string<C, T, A, G>::basic_simple_string(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s) // No, not explicit. Sigh
     : m_buffer(alloc_buffer_(s))
 {
     STLSOFT_ASSERT(is_valid());
@@ -1645,10 +1808,11 @@ inline basic_simple_string<C, T, A>::basic_simple_string(ss_typename_type_k basi
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type cch
+inline basic_simple_string<C, T, A, G>::basic_simple_string(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type cch
 )
     : m_buffer(alloc_buffer_(s, cch))
 {
@@ -1658,10 +1822,11 @@ inline basic_simple_string<C, T, A>::basic_simple_string(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type  cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::char_type  ch
+inline basic_simple_string<C, T, A, G>::basic_simple_string(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type  cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::char_type  ch
 )
     : m_buffer(NULL)
 {
@@ -1674,10 +1839,11 @@ inline basic_simple_string<C, T, A>::basic_simple_string(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::basic_simple_string(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   first
-,   ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   last
+inline basic_simple_string<C, T, A, G>::basic_simple_string(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   first
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   last
 )
     : m_buffer(alloc_buffer_(first, last - first))
 {
@@ -1690,9 +1856,10 @@ inline basic_simple_string<C, T, A>::basic_simple_string(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
 inline
-basic_simple_string<C, T, A>::basic_simple_string(class_type&& rhs) STLSOFT_NOEXCEPT
+basic_simple_string<C, T, A, G>::basic_simple_string(class_type&& rhs) STLSOFT_NOEXCEPT
     : m_buffer(rhs.m_buffer)
 {
     rhs.m_buffer = ss_nullptr_k;
@@ -1702,8 +1869,9 @@ basic_simple_string<C, T, A>::basic_simple_string(class_type&& rhs) STLSOFT_NOEX
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline basic_simple_string<C, T, A>::~basic_simple_string() STLSOFT_NOEXCEPT
+inline basic_simple_string<C, T, A, G>::~basic_simple_string() STLSOFT_NOEXCEPT
 {
 #if defined(__BORLANDC__) && \
     __BORLANDC__ > 0x0580 && \
@@ -1739,12 +1907,13 @@ inline basic_simple_string<C, T, A>::~basic_simple_string() STLSOFT_NOEXCEPT
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline /* static */ ss_sint_t basic_simple_string<C, T, A>::compare_(
-    ss_typename_type_k basic_simple_string<C, T, A>::value_type const*  lhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          lhs_len
-,   ss_typename_type_k basic_simple_string<C, T, A>::value_type const*  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          rhs_len
+inline /* static */ ss_sint_t basic_simple_string<C, T, A, G>::compare_(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::value_type const*  lhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          lhs_len
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::value_type const*  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          rhs_len
 )
 {
     size_type   cmp_len =   (lhs_len < rhs_len) ? lhs_len : rhs_len;
@@ -1761,12 +1930,13 @@ inline /* static */ ss_sint_t basic_simple_string<C, T, A>::compare_(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::value_type const*  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cchRhs
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::value_type const*  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cchRhs
 ) const
 {
     size_type lhs_len = length();
@@ -1798,11 +1968,12 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::value_type const*  rhs
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::value_type const*  rhs
 ) const
 {
     size_type lhs_len = length();
@@ -1829,8 +2000,9 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(ss_typename_type_k basic_simple_string<C, T, A>::value_type const* rhs) const
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(ss_typename_type_k basic_simple_string<C, T, A, G>::value_type const* rhs) const
 {
     size_type   lhs_len =   length();
     size_type   rhs_len =   (NULL == rhs) ? 0 : traits_type::length(rhs);
@@ -1841,13 +2013,14 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(ss_typename_type_k basic_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          posRhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cchRhs
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          posRhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cchRhs
 ) const
 {
     size_type lhs_len = length();
@@ -1888,11 +2061,12 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
 ) const
 {
     size_type lhs_len = length();
@@ -1919,8 +2093,9 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_sint_t basic_simple_string<C, T, A>::compare(ss_typename_type_k basic_simple_string<C, T, A>::class_type const& rhs) const
+inline ss_sint_t basic_simple_string<C, T, A, G>::compare(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const& rhs) const
 {
     size_type   lhs_len =   length();
     size_type   rhs_len =   rhs.length();
@@ -1932,8 +2107,9 @@ inline ss_sint_t basic_simple_string<C, T, A>::compare(ss_typename_type_k basic_
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simple_string<C, T, A>::operator [](ss_typename_type_k basic_simple_string<C, T, A>::size_type index)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reference basic_simple_string<C, T, A, G>::operator [](ss_typename_type_k basic_simple_string<C, T, A, G>::size_type index)
 {
     STLSOFT_MESSAGE_ASSERT("index access out of range in simple_string", index < length());
 
@@ -1945,8 +2121,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basic_simple_string<C, T, A>::operator [](ss_typename_type_k basic_simple_string<C, T, A>::size_type index) const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reference basic_simple_string<C, T, A, G>::operator [](ss_typename_type_k basic_simple_string<C, T, A, G>::size_type index) const
 {
     STLSOFT_MESSAGE_ASSERT("index access out of range in simple_string", index < length() + 1); // Valid to return (const) reference to nul-terminator
 
@@ -1959,8 +2136,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basi
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simple_string<C, T, A>::at(ss_typename_type_k basic_simple_string<C, T, A>::size_type index)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reference basic_simple_string<C, T, A, G>::at(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type index)
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -1977,8 +2155,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basic_simple_string<C, T, A>::at(ss_typename_type_k basic_simple_string<C, T, A>::size_type index) const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reference basic_simple_string<C, T, A, G>::at(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type index) const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -1995,8 +2174,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basi
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_simple_string<C, T, A>::substr(ss_typename_type_k basic_simple_string<C, T, A>::size_type pos, ss_typename_type_k basic_simple_string<C, T, A>::size_type cch) const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type basic_simple_string<C, T, A, G>::substr(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type pos, ss_typename_type_k basic_simple_string<C, T, A, G>::size_type cch) const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2018,8 +2198,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_sim
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_simple_string<C, T, A>::substr(ss_typename_type_k basic_simple_string<C, T, A>::size_type pos) const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type basic_simple_string<C, T, A, G>::substr(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type pos) const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2036,8 +2217,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_sim
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_simple_string<C, T, A>::substr() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type basic_simple_string<C, T, A, G>::substr() const
 {
     return *this;
 }
@@ -2046,8 +2228,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type basic_sim
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::value_type const* basic_simple_string<C, T, A>::c_str() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::value_type const* basic_simple_string<C, T, A, G>::c_str() const
 {
     return (NULL == m_buffer) ? empty_string_() : char_pointer_from_member_pointer_(m_buffer);
 }
@@ -2055,8 +2238,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::value_type const* ba
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::value_type const* basic_simple_string<C, T, A>::data() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::value_type const* basic_simple_string<C, T, A, G>::data() const
 {
     return (NULL == m_buffer) ? empty_string_() : char_pointer_from_member_pointer_(m_buffer);
 }
@@ -2064,8 +2248,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::value_type const* ba
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simple_string<C, T, A>::front()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reference basic_simple_string<C, T, A, G>::front()
 {
     return (*this)[0];
 }
@@ -2073,8 +2258,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simple_string<C, T, A>::back()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reference basic_simple_string<C, T, A, G>::back()
 {
     return (*this)[length() - 1];
 }
@@ -2082,8 +2268,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reference basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basic_simple_string<C, T, A>::front() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reference basic_simple_string<C, T, A, G>::front() const
 {
     return (*this)[0];
 }
@@ -2091,8 +2278,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basi
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basic_simple_string<C, T, A>::back() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reference basic_simple_string<C, T, A, G>::back() const
 {
     return (*this)[length() - 1];
 }
@@ -2100,11 +2288,12 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reference basi
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simple_string<C, T, A>::copy(
-    ss_typename_type_k basic_simple_string<C, T, A>::value_type*    dest
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type      cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type      pos /* = 0 */
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::size_type basic_simple_string<C, T, A, G>::copy(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::value_type*    dest
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type      cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type      pos /* = 0 */
 ) const
 {
     size_type len = length();
@@ -2132,8 +2321,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_iterator basic_simple_string<C, T, A>::begin() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_iterator basic_simple_string<C, T, A, G>::begin() const
 {
     return const_cast<class_type*>(this)->begin_();
 }
@@ -2141,8 +2331,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_iterator basic
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_iterator basic_simple_string<C, T, A>::end() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_iterator basic_simple_string<C, T, A, G>::end() const
 {
     return const_cast<class_type*>(this)->end_();
 }
@@ -2151,8 +2342,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_iterator basic
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::iterator basic_simple_string<C, T, A>::begin()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::iterator basic_simple_string<C, T, A, G>::begin()
 {
     return begin_();
 }
@@ -2160,8 +2352,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::iterator basic_simpl
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::iterator basic_simple_string<C, T, A>::end()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::iterator basic_simple_string<C, T, A, G>::end()
 {
     return end_();
 }
@@ -2170,8 +2363,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::iterator basic_simpl
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reverse_iterator basic_simple_string<C, T, A>::rbegin() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reverse_iterator basic_simple_string<C, T, A, G>::rbegin() const
 {
     return const_reverse_iterator(end());
 }
@@ -2179,8 +2373,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reverse_iterat
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reverse_iterator basic_simple_string<C, T, A>::rend() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::const_reverse_iterator basic_simple_string<C, T, A, G>::rend() const
 {
     return const_reverse_iterator(begin());
 }
@@ -2188,8 +2383,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::const_reverse_iterat
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reverse_iterator basic_simple_string<C, T, A>::rbegin()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reverse_iterator basic_simple_string<C, T, A, G>::rbegin()
 {
     return reverse_iterator(end());
 }
@@ -2197,8 +2393,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reverse_iterator bas
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reverse_iterator basic_simple_string<C, T, A>::rend()
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::reverse_iterator basic_simple_string<C, T, A, G>::rend()
 {
     return reverse_iterator(begin());
 }
@@ -2208,10 +2405,11 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::reverse_iterator bas
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   s
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
 {
     STLSOFT_ASSERT(is_valid());
@@ -2273,8 +2471,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s)
 {
     return assign(s, (NULL == s) ? 0 : traits_type::length(s));
 }
@@ -2282,11 +2481,12 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(
-    ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
 {
     char_type*  s   =   char_pointer_from_member_pointer_(rhs.m_buffer);
@@ -2317,8 +2517,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(ss_typename_type_k basic_simple_string<C, T, A>::class_type const& rhs)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const& rhs)
 {
     return assign(char_pointer_from_member_pointer_(rhs.m_buffer), rhs.length());
 }
@@ -2326,10 +2527,11 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type  cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::char_type  ch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type  cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::char_type  ch
 )
 {
     buffer_type_    buffer(cch);
@@ -2343,10 +2545,11 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::assign(
-    ss_typename_type_k basic_simple_string<C, T, A>::const_iterator first
-,   ss_typename_type_k basic_simple_string<C, T, A>::const_iterator last
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::assign(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::const_iterator first
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::const_iterator last
 )
 {
     // We have to use this strange appearing this, because of Visual C++ .NET's
@@ -2358,8 +2561,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& basic_simple_string<C, T, A>::operator =(ss_typename_type_k basic_simple_string<C, T, A>::class_type const& rhs)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type const& basic_simple_string<C, T, A, G>::operator =(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const& rhs)
 {
     return assign(rhs);
 }
@@ -2367,8 +2571,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& ba
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& basic_simple_string<C, T, A>::operator =(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type const& basic_simple_string<C, T, A, G>::operator =(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s)
 {
     return assign(s);
 }
@@ -2376,8 +2581,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& ba
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& basic_simple_string<C, T, A>::operator =(ss_typename_type_k basic_simple_string<C, T, A>::char_type ch)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type const& basic_simple_string<C, T, A, G>::operator =(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type ch)
 {
     char_type   sz[2] = { ch, traits_type::to_char_type(0) };
 
@@ -2389,10 +2595,11 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type const& ba
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(
-    ss_typename_type_k basic_simple_string<C, T, A>::char_type const*   s
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const*   s
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
 {
     STLSOFT_ASSERT(is_valid());
@@ -2427,8 +2634,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 
             if (buffer->capacity - buf_len < 1 + cch)
             {
-                // Allocate a new buffer of sufficient size
-                member_pointer const new_buffer = alloc_buffer_(buffer->contents, buf_len + cch);
+                // Allocate a new buffer of sufficient size, as determined
+                // by the growth policy
+                member_pointer const new_buffer = alloc_buffer_(buffer->contents, growth_policy_type::calc_capacity(buffer->capacity - 1, buf_len + cch), buf_len);
 
                 if (NULL == new_buffer) // Some allocators do not throw on failure!
                 {
@@ -2460,8 +2668,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s)
 {
     return append(s, (NULL == s) ? 0 : traits_type::length(s));
 }
@@ -2469,11 +2678,12 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(
-    ss_typename_type_k basic_simple_string<C, T, A>::class_type const&  rhs
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          pos
-,   ss_typename_type_k basic_simple_string<C, T, A>::size_type          cch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const&  rhs
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          pos
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::size_type          cch
 )
 {
     char_type*  s   =   char_pointer_from_member_pointer_(rhs.m_buffer);
@@ -2508,8 +2718,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(ss_typename_type_k basic_simple_string<C, T, A>::class_type const& s)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const& s)
 {
     return append(char_pointer_from_member_pointer_(s.m_buffer), s.length());
 }
@@ -2517,25 +2728,42 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type  cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::char_type  ch
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type  cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::char_type  ch
 )
 {
+    STLSOFT_ASSERT(is_valid());
+
     if (NULL == m_buffer)
     {
         assign(cch, ch);
     }
+    else if (   0 == cch ||
+                traits_type::to_char_type(0) == ch)
+    {
+        // Nothing to do: as with append(s, cch), nul characters are not
+        // appended
+    }
     else
     {
-        buffer_type_    buffer(cch);
+        // The characters are written in place, rather than via an
+        // intermediate buffer
+        size_type const len = string_buffer_from_member_pointer_(m_buffer)->length;
 
-        static_cast<void>(STLSOFT_NS_QUAL_STD(fill)(buffer.begin(), buffer.end(), ch));
+        if (grow_(len + cch))
+        {
+            string_buffer* const buffer = string_buffer_from_member_pointer_(m_buffer);
 
-        append(buffer.data(), buffer.size());
+            traits_type::assign(buffer->contents + len, cch, ch);
+            buffer->length = len + cch;
+            buffer->contents[buffer->length] = traits_type::to_char_type(0);
+        }
     }
 
+    STLSOFT_ASSERT(is_valid());
     return *this;
 }
 
@@ -2543,10 +2771,11 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::append(
-    ss_typename_type_k basic_simple_string<C, T, A>::const_iterator first
-,   ss_typename_type_k basic_simple_string<C, T, A>::const_iterator last
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::append(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::const_iterator first
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::const_iterator last
 )
 {
     // We have to use this strange appearing code because of Visual C++ .NET's
@@ -2558,17 +2787,21 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::operator +=(ss_typename_type_k basic_simple_string<C, T, A>::char_type ch)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::operator +=(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type ch)
 {
-    return append(1, ch);
+    push_back(ch);
+
+    return *this;
 }
 
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::operator +=(ss_typename_type_k basic_simple_string<C, T, A>::char_type const* s)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::operator +=(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type const* s)
 {
     return append(s);
 }
@@ -2576,8 +2809,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_simple_string<C, T, A>::operator +=(ss_typename_type_k basic_simple_string<C, T, A>::class_type const& rhs)
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::class_type& basic_simple_string<C, T, A, G>::operator +=(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type const& rhs)
 {
     return append(rhs);
 }
@@ -2585,9 +2819,26 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::class_type& basic_si
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void basic_simple_string<C, T, A>::push_back(ss_typename_type_k basic_simple_string<C, T, A>::char_type ch)
+inline void basic_simple_string<C, T, A, G>::push_back(ss_typename_type_k basic_simple_string<C, T, A, G>::char_type ch)
 {
+    if (NULL != m_buffer)
+    {
+        string_buffer* const buffer = string_buffer_from_member_pointer_(m_buffer);
+
+        // Fast path for when there is room for the character and the
+        // terminating nul
+        if (buffer->length + 1 < buffer->capacity &&
+            traits_type::to_char_type(0) != ch)
+        {
+            buffer->contents[buffer->length]    =   ch;
+            buffer->contents[++buffer->length]  =   traits_type::to_char_type(0);
+
+            return;
+        }
+    }
+
     append(1, ch);
 }
 
@@ -2595,8 +2846,9 @@ inline void basic_simple_string<C, T, A>::push_back(ss_typename_type_k basic_sim
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void basic_simple_string<C, T, A>::reserve(ss_typename_type_k basic_simple_string<C, T, A>::size_type cch)
+inline void basic_simple_string<C, T, A, G>::reserve(ss_typename_type_k basic_simple_string<C, T, A, G>::size_type cch)
 {
     if (length() < cch)
     {
@@ -2628,8 +2880,9 @@ inline void basic_simple_string<C, T, A>::reserve(ss_typename_type_k basic_simpl
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void basic_simple_string<C, T, A>::swap(ss_typename_type_k basic_simple_string<C, T, A>::class_type& other)
+inline void basic_simple_string<C, T, A, G>::swap(ss_typename_type_k basic_simple_string<C, T, A, G>::class_type& other)
 {
     STLSOFT_ASSERT(is_valid());
     STLSOFT_ASSERT(other.is_valid());
@@ -2640,10 +2893,11 @@ inline void basic_simple_string<C, T, A>::swap(ss_typename_type_k basic_simple_s
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void basic_simple_string<C, T, A>::resize(
-    ss_typename_type_k basic_simple_string<C, T, A>::size_type  cch
-,   ss_typename_type_k basic_simple_string<C, T, A>::value_type ch
+inline void basic_simple_string<C, T, A, G>::resize(
+    ss_typename_type_k basic_simple_string<C, T, A, G>::size_type  cch
+,   ss_typename_type_k basic_simple_string<C, T, A, G>::value_type ch
 )
 {
     STLSOFT_ASSERT(is_valid());
@@ -2654,8 +2908,11 @@ inline void basic_simple_string<C, T, A>::resize(
     {
         if (len < cch)
         {
-            /* Expand the string, using self-assignemt. */
-            assign(c_str(), cch);
+            /* Expand the string, according to the growth policy. */
+            if (!grow_(cch))
+            {
+                return;
+            }
 
             traits_type::assign(char_pointer_from_member_pointer_(m_buffer) + len, cch - len, ch);
         }
@@ -2672,8 +2929,9 @@ inline void basic_simple_string<C, T, A>::resize(
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline void basic_simple_string<C, T, A>::clear()
+inline void basic_simple_string<C, T, A, G>::clear()
 {
     if (NULL != m_buffer)
     {
@@ -2688,8 +2946,9 @@ inline void basic_simple_string<C, T, A>::clear()
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simple_string<C, T, A>::size() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::size_type basic_simple_string<C, T, A, G>::size() const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2699,8 +2958,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simple_string<C, T, A>::max_size() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::size_type basic_simple_string<C, T, A, G>::max_size() const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2710,8 +2970,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simple_string<C, T, A>::length() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::size_type basic_simple_string<C, T, A, G>::length() const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2721,8 +2982,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simple_string<C, T, A>::capacity() const
+inline ss_typename_type_ret_k basic_simple_string<C, T, A, G>::size_type basic_simple_string<C, T, A, G>::capacity() const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2732,8 +2994,9 @@ inline ss_typename_type_ret_k basic_simple_string<C, T, A>::size_type basic_simp
 template<   ss_typename_param_k C
         ,   ss_typename_param_k T
         ,   ss_typename_param_k A
+        ,   ss_typename_param_k G
         >
-inline ss_bool_t basic_simple_string<C, T, A>::empty() const
+inline ss_bool_t basic_simple_string<C, T, A, G>::empty() const
 {
     STLSOFT_ASSERT(is_valid());
 
@@ -2760,8 +3023,9 @@ namespace std
     template<   ss_typename_param_k C
             ,   ss_typename_param_k T
             ,   ss_typename_param_k A
+            ,   ss_typename_param_k G
             >
-    inline void swap(STLSOFT_NS_QUAL(basic_simple_string)<C, T, A>& lhs, STLSOFT_NS_QUAL(basic_simple_string)<C, T, A>& rhs)
+    inline void swap(STLSOFT_NS_QUAL(basic_simple_string)<C, T, A, G>& lhs, STLSOFT_NS_QUAL(basic_simple_string)<C, T, A, G>& rhs)
     {
         lhs.swap(rhs);
     }
@@ -4,7 +4,7 @@
  * Purpose:     basic_string_view class.
  *
  * Created:     16th October 2004
- * Updated:     30th January 2024
+ * Updated:     19th October 2026
  *
  * Thanks to:   Bjorn Karlsson and Scott Patterson for discussions on various
  *              naming and design issues. Thanks also to Pablo Aguilar for
@@ -12,7 +12,7 @@
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2004-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -57,9 +57,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_MAJOR       3
-# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_MINOR       6
+# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_MINOR       7
 # define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_REVISION    1
-# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_EDIT        114
+# define STLSOFT_VER_STLSOFT_STRING_HPP_STRING_VIEW_EDIT        115
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -1023,7 +1023,8 @@ template<   ss_typename_param_k C
         ,   ss_typename_param_k A
         >
 inline basic_string_view<C, T, A>::basic_string_view(basic_string_view<C, T, A> const& rhs)
-    : m_length(rhs.m_length)
+    : A(rhs)
+    , m_length(rhs.m_length)
     , m_base(rhs.m_base)
     , m_cstr(NULL)
 {
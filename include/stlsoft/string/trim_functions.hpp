@@ -4,11 +4,11 @@
  * Purpose:     String utility functions for trimming and removing string contents.
  *
  * Created:     25th April 2005
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2005-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -46,6 +46,12 @@
  * \brief [C++] String utility functions for trimming and removing
  *  string contents
  *   (\ref group__library__String "String" Library).
+ *
+ * The overloads that trim the default whitespace characters do not search
+ * a character set for each character: they test the characters directly,
+ * and, for <code>char</code> strings, 16 at a time with SSE2. As before,
+ * embedded nul characters at the ends of the string are trimmed along
+ * with the whitespace.
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS
@@ -53,9 +59,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_MAJOR       2
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_MINOR       2
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_REVISION    3
-# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_EDIT        59
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_MINOR       3
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_REVISION    2
+# define STLSOFT_VER_INCL_STLSOFT_STRING_HPP_TRIM_FUNCTIONS_EDIT        61
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -84,6 +90,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_API_external_h_string
 # include <stlsoft/api/external/string.h>
 #endif /* !STLSOFT_INCL_STLSOFT_API_external_h_string */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
 
 #ifndef STLSOFT_INCL_ALGORITHM
 # define STLSOFT_INCL_ALGORITHM
@@ -171,6 +180,163 @@ default_trim_chars(
     return &s_trimChars[0];
 }
 
+// Indicates whether the character is one of those returned by
+// default_trim_chars(), or is the nul character, which the strchr()-based
+// test of the character-set overloads has always matched (against the
+// terminator) and which the default trimming therefore also removes
+template <ss_typename_param_k C>
+inline
+bool
+is_default_trim_char(
+    C   ch
+)
+{
+    switch (ch)
+    {
+    case    ' ':
+    case    '\n':
+    case    '\r':
+    case    '\t':
+    case    '\v':
+    case    '\0':
+        return true;
+    default:
+        return false;
+    }
+}
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+// Obtains a mask of the characters in the 16 at s that are not default
+// trim characters
+inline
+ss_uint32_t
+non_default_trim_char_mask_16(
+    char const* s
+)
+{
+    __m128i const   v   =   _mm_loadu_si128(reinterpret_cast<__m128i const*>(s));
+    __m128i         m   =   _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\v')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+
+    return ~static_cast<ss_uint32_t>(_mm_movemask_epi8(m)) & 0xffffu;
+}
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+// Obtains the number of leading default trim characters in [s, s + n)
+template <ss_typename_param_k C>
+inline
+ss_size_t
+count_leading_default_trim_chars(
+    C const*    s
+,   ss_size_t   n
+)
+{
+    ss_size_t i = 0;
+
+    for (; i != n && is_default_trim_char(s[i]); ++i)
+    {}
+
+    return i;
+}
+
+inline
+ss_size_t
+count_leading_default_trim_chars(
+    char const* s
+,   ss_size_t   n
+)
+{
+    ss_size_t i = 0;
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+    for (; i + 16 <= n; i += 16)
+    {
+        ss_uint32_t const mask = non_default_trim_char_mask_16(s + i);
+
+        if (0 != mask)
+        {
+            return i + STLSOFT_API_INTERNAL_simd_mask_lowest_bit(mask);
+        }
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != n && is_default_trim_char(s[i]); ++i)
+    {}
+
+    return i;
+}
+
+// Obtains the length of [s, s + n) without its trailing default trim
+// characters
+template <ss_typename_param_k C>
+inline
+ss_size_t
+length_without_trailing_default_trim_chars(
+    C const*    s
+,   ss_size_t   n
+)
+{
+    for (; 0 != n && is_default_trim_char(s[n - 1]); --n)
+    {}
+
+    return n;
+}
+
+inline
+ss_size_t
+length_without_trailing_default_trim_chars(
+    char const* s
+,   ss_size_t   n
+)
+{
+#if defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT)
+
+    for (; n >= 16; n -= 16)
+    {
+        ss_uint32_t const mask = non_default_trim_char_mask_16(s + n - 16);
+
+        if (0 != mask)
+        {
+            return n - 16 + STLSOFT_API_INTERNAL_simd_mask_highest_bit(mask) + 1;
+        }
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; 0 != n && is_default_trim_char(s[n - 1]); --n)
+    {}
+
+    return n;
+}
+
+// Obtains, in *pl and *pr, the bounds of the contents of [s, s + n) once
+// the leading (if trimLeft) and trailing (if trimRight) default trim
+// characters are removed
+template <ss_typename_param_k C>
+inline
+void
+find_default_trim_bounds(
+    C const*    s
+,   ss_size_t   n
+,   bool        trimLeft
+,   bool        trimRight
+,   ss_size_t*  pl
+,   ss_size_t*  pr
+)
+{
+    STLSOFT_ASSERT(NULL != pl);
+    STLSOFT_ASSERT(NULL != pr);
+
+    *pl = trimLeft ? count_leading_default_trim_chars(s, n) : 0;
+    *pr = (trimRight && *pl != n) ? *pl + length_without_trailing_default_trim_chars(s + *pl, n - *pl) : n;
+}
+
 STLSOFT_CLOSE_WORKER_NS_(ximpl_split_functions)
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
@@ -180,6 +346,35 @@ STLSOFT_CLOSE_WORKER_NS_(ximpl_split_functions)
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
+template <ss_typename_param_k S>
+inline
+S&
+trim_default_impl(
+    S&      str
+,   bool    trimLeft
+,   bool    trimRight
+)
+{
+    // 1. typedef the string traits
+    typedef string_traits<S>                                        string_traits_t;
+    // 2. typedef the iterator type(s)
+    typedef ss_typename_type_k string_traits_t::const_iterator      iterator_t;
+
+    // Determine the bounds on the contiguous representation of the
+    // string, then apply them as offsets from begin()
+
+    ss_size_t   l;
+    ss_size_t   r;
+
+    ximpl_trim_functions::find_default_trim_bounds(c_str_data(str), c_str_len(str), trimLeft, trimRight, &l, &r);
+
+    iterator_t const  it_b    =   str.begin();
+    iterator_t const  it_l    =   it_b + l;
+    iterator_t const  it_r    =   it_b + r;
+
+    return string_traits_t::assign_inplace(str, it_l, it_r);
+}
+
 template<
     ss_typename_param_k S
 ,   ss_typename_param_k C
@@ -242,24 +437,7 @@ trim_left(
     S& str
 )
 {
-    // 1. typedef the string traits
-    typedef string_traits<S>                                string_traits_t;
-
-# if defined(STLSOFT_COMPILER_IS_BORLAND) && \
-     __BORLANDC__ < 0x0564
-    // This is needed here to tell the Borland compiler that it's a type!
-    string_traits_t::char_type* p = NULL;
-# endif /* compiler */
-
-    // 2. typedef the char_t
-    typedef ss_typename_type_k string_traits_t::char_type   char_t;
-
-    ss_size_t       n;
-    char_t const*   trimChars  =   ximpl_trim_functions::default_trim_chars(static_cast<char_t const*>(0), &n);
-
-    STLSOFT_SUPPRESS_UNUSED(n);
-
-    return trim_left_impl(str, trimChars);
+    return trim_default_impl(str, true, false);
 }
 
 /** Trims all the leading given characters, if any, from a string
@@ -370,24 +548,7 @@ trim_right(
     S& str
 )
 {
-    // 1. typedef the string traits
-    typedef string_traits<S>                                string_traits_t;
-
-# if defined(STLSOFT_COMPILER_IS_BORLAND) && \
-     __BORLANDC__ < 0x0564
-    // This is needed here to tell the Borland compiler that it's a type!
-    string_traits_t::char_type* p = NULL;
-# endif /* compiler */
-
-    // 2. typedef the char_t
-    typedef ss_typename_type_k string_traits_t::char_type   char_t;
-
-    ss_size_t       n;
-    char_t const*   trimChars  =   ximpl_trim_functions::default_trim_chars(static_cast<char_t const*>(0), &n);
-
-    STLSOFT_SUPPRESS_UNUSED(n);
-
-    return trim_right_impl(str, trimChars);
+    return trim_default_impl(str, false, true);
 }
 
 /** Trims all the trailing given characters, if any, from a string
@@ -516,25 +677,7 @@ trim_all(
     S& str
 )
 {
-    // 1. typedef the string traits
-    typedef string_traits<S>                                string_traits_t;
-
-# if defined(STLSOFT_COMPILER_IS_BORLAND) && \
-     __BORLANDC__ < 0x0564
-
-    // This is needed here to tell the Borland compiler that it's a type!
-    string_traits_t::char_type* p = NULL;
-# endif /* compiler */
-
-    // 2. typedef the char_t
-    typedef ss_typename_type_k string_traits_t::char_type   char_t;
-
-    ss_size_t       n;
-    char_t const*   trimChars  =   ximpl_trim_functions::default_trim_chars(static_cast<char_t const*>(0), &n);
-
-    STLSOFT_SUPPRESS_UNUSED(n);
-
-    return trim_all_impl(str, trimChars);
+    return trim_default_impl(str, true, true);
 }
 
 /** Trims all the leading and trailing characters, if any, from a string
@@ -4,11 +4,11 @@
  * Purpose:     Synchronisation object lock scoping class.
  *
  * Created:     1st October 1994
- * Updated:     20th January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 1994-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_MAJOR     6
-# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_MINOR     0
-# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_REVISION  6
-# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_EDIT      126
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_MINOR     1
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_REVISION  1
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_LOCK_SCOPE_EDIT      127
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -194,6 +194,52 @@ public:
 /// @}
 };
 
+// class shared_lock_traits
+
+/** Traits class for acquiring shared (read) locks on lockable objects
+ *
+ * \ingroup group__library__Synch
+ *
+ * \param L The lockable class, for which the
+ *   <code>lock_shared_instance()</code> and
+ *   <code>unlock_shared_instance()</code> control shims are defined
+ *
+ * \code
+  stlsoft::lock_scope<
+      unixstl::rw_spin_mutex
+  ,   stlsoft::shared_lock_traits<unixstl::rw_spin_mutex>
+  >     scope(mx);
+ * \endcode
+ */
+template<ss_typename_param_k L>
+struct shared_lock_traits
+{
+/// \name Member Types
+/// @{
+public:
+    /// The lockable type
+    typedef L                                               lock_type;
+    /// The current specialisation of the type
+    typedef shared_lock_traits<L>                           class_type;
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Acquires a shared lock on the given lockable instance
+    static void lock(lock_type &c)
+    {
+        lock_shared_instance(c);
+    }
+
+    /// Releases a shared lock on the given lockable instance
+    static void unlock(lock_type &c)
+    {
+        unlock_shared_instance(c);
+    }
+/// @}
+};
+
 // class lock_scope
 
 /** This class scopes the lock status of a lockable type
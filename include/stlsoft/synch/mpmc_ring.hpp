@@ -0,0 +1,441 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/synch/mpmc_ring.hpp
+ *
+ * Purpose:     Bounded, lock-free multi-producer multi-consumer ring queue.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/synch/mpmc_ring.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::mpmc_ring class template
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_MPMC_RING
+#define STLSOFT_INCL_STLSOFT_SYNCH_HPP_MPMC_RING
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_MPMC_RING_MAJOR      1
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_MPMC_RING_MINOR      0
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_MPMC_RING_REVISION   3
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_MPMC_RING_EDIT       3
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+# include <stlsoft/synch/util/cache_line_padded_.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>
+#endif /* !STLSOFT_INCL_NEW */
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+# ifndef STLSOFT_INCL_STDEXCEPT
+#  define STLSOFT_INCL_STDEXCEPT
+#  include <stdexcept>
+# endif /* !STLSOFT_INCL_STDEXCEPT */
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+#ifndef STLSOFT_INCL_TYPE_TRAITS
+# define STLSOFT_INCL_TYPE_TRAITS
+# include <type_traits>
+#endif /* !STLSOFT_INCL_TYPE_TRAITS */
+#ifndef STLSOFT_INCL_UTILITY
+# define STLSOFT_INCL_UTILITY
+# include <utility>
+#endif /* !STLSOFT_INCL_UTILITY */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A bounded, lock-free queue for any number of producer and consumer
+ * threads.
+ *
+ * \ingroup group__library__Synch
+ *
+ * \param T The element type, whose move constructor and move assignment
+ *   operator must not throw
+ *
+ * The ring is an array of cells, each holding an element and a sequence
+ * number that records whether the cell is free or full for a given lap
+ * of the ring, after the design of Dmitry Vyukov. A producer claims the
+ * cell at the tail by a compare-and-swap of the tail index, and then
+ * publishes the element by advancing the cell's sequence number; a
+ * consumer does likewise at the head. Producers contend only with
+ * producers, and consumers with consumers, and the tail and head indexes
+ * are on separate cache lines.
+ *
+ * try_push_n() and try_pop_n() claim a run of consecutive cells with a
+ * single compare-and-swap.
+ *
+ * A claimed cell cannot be given up, so the operations that transfer an
+ * element after claiming its cell require that the transfer cannot
+ * throw: try_push() of a copy copies the value before claiming the cell,
+ * and try_push_n() requires that \c T's copy constructor does not throw.
+ *
+ * For blocking operations use unixstl::blocking_ring.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>).
+ */
+template <ss_typename_param_k T>
+class mpmc_ring
+{
+public: // types
+    /// The element type
+    typedef T                                               value_type;
+    /// This type
+    typedef mpmc_ring<T>                                    class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The bool type
+    typedef ss_bool_t                                       bool_type;
+private:
+    typedef STLSOFT_NS_QUAL_STD(atomic)<size_type>          index_type_;
+    typedef ss_ptrdiff_t                                    difference_type_;
+    struct cell_type_
+    {
+        index_type_                                         sequence;
+        alignas(T) ss_byte_t                                bytes[sizeof(T)];
+    };
+    typedef ximpl_cache_line_padded::cache_line_padded<
+        index_type_
+    >                                                       padded_index_type_;
+
+    static_assert(STLSOFT_NS_QUAL_STD(is_nothrow_move_constructible)<T>::value, "mpmc_ring element type must be nothrow move-constructible");
+    static_assert(STLSOFT_NS_QUAL_STD(is_nothrow_move_assignable)<T>::value, "mpmc_ring element type must be nothrow move-assignable");
+
+public: // construction
+    /// Constructs an empty ring
+    ///
+    /// \param capacity The minimum capacity, which is rounded up to a
+    ///   power of two, of at least 2
+    ///
+    /// \exception std::length_error If \c capacity exceeds the largest
+    ///   power of two representable by \c size_type
+    ss_explicit_k
+    mpmc_ring(size_type capacity)
+        : m_tail()
+        , m_head()
+        , m_mask(round_capacity_(capacity) - 1)
+        , m_cells(new cell_type_[m_mask + 1])
+    {
+        { for (size_type i = 0; i != m_mask + 1; ++i)
+        {
+            m_cells[i].sequence.store(i, STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+        }}
+    }
+    /// Destroys any elements remaining in the ring
+    ~mpmc_ring() STLSOFT_NOEXCEPT
+    {
+        size_type const tail = m_tail.value.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        { for (size_type head = m_head.value.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed)); head != tail; ++head)
+        {
+            element_(head)->~value_type();
+        }}
+
+        delete [] m_cells;
+    }
+private:
+    mpmc_ring(class_type const&);               // copy-construction proscribed
+    void operator =(class_type const&);         // copy-assignment proscribed
+
+public: // producer operations
+    /// Appends a copy of the given value, failing if the ring is full
+    bool_type try_push(value_type const& value)
+    {
+        // Copied before a cell is claimed, since a claimed cell must be
+        // filled
+        value_type copy(value);
+
+        return try_push(STLSOFT_NS_QUAL_STD(move)(copy));
+    }
+    /// Appends the given value, failing - without moving from \c value -
+    /// if the ring is full
+    bool_type try_push(value_type&& value) STLSOFT_NOEXCEPT
+    {
+        size_type const tail = claim_(m_tail.value, 1, 0);
+
+        if (~size_type(0) == tail)
+        {
+            return false;
+        }
+
+        ::new(element_(tail)) value_type(STLSOFT_NS_QUAL_STD(move)(value));
+
+        cell_(tail).sequence.store(tail + 1, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+        return true;
+    }
+    /// Appends copies of as many of the \c n values at \c values as the
+    /// ring can accommodate, claiming the cells for them at once
+    ///
+    /// \return The number of values appended
+    size_type try_push_n(value_type const* values, size_type n) STLSOFT_NOEXCEPT
+    {
+        static_assert(STLSOFT_NS_QUAL_STD(is_nothrow_copy_constructible)<T>::value, "mpmc_ring::try_push_n() requires that the element type be nothrow copy-constructible");
+
+        size_type       num;
+        size_type const tail = claim_n_(m_tail.value, n, 0, &num);
+
+        { for (size_type i = 0; i != num; ++i)
+        {
+            ::new(element_(tail + i)) value_type(values[i]);
+
+            cell_(tail + i).sequence.store(tail + i + 1, STLSOFT_NS_QUAL_STD(memory_order_release));
+        }}
+
+        return num;
+    }
+
+public: // consumer operations
+    /// Removes the element at the front of the ring into \c value,
+    /// failing if the ring is empty
+    bool_type try_pop(value_type& value) STLSOFT_NOEXCEPT
+    {
+        size_type const head = claim_(m_head.value, 1, 1);
+
+        if (~size_type(0) == head)
+        {
+            return false;
+        }
+
+        release_(head, value);
+
+        return true;
+    }
+    /// Removes up to \c maxCount elements from the front of the ring into
+    /// the array \c values, claiming their cells at once
+    ///
+    /// \return The number of elements removed
+    size_type try_pop_n(value_type* values, size_type maxCount) STLSOFT_NOEXCEPT
+    {
+        size_type       num;
+        size_type const head = claim_n_(m_head.value, maxCount, 1, &num);
+
+        { for (size_type i = 0; i != num; ++i)
+        {
+            release_(head + i, values[i]);
+        }}
+
+        return num;
+    }
+
+public: // accessors
+    /// The number of elements in the ring, which may be changed by other
+    /// threads at any time
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        size_type const head = m_head.value.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+        size_type const tail = m_tail.value.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        // The indexes are read separately, so the difference may appear
+        // momentarily out of range
+        return (tail - head <= capacity()) ? (tail - head) : 0;
+    }
+    /// Indicates whether the ring is empty, which may be changed by other
+    /// threads at any time
+    bool_type empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == size();
+    }
+    /// The maximum number of elements that the ring can hold
+    size_type capacity() const STLSOFT_NOEXCEPT
+    {
+        return m_mask + 1;
+    }
+
+private: // implementation
+    static size_type round_capacity_(size_type capacity)
+    {
+        // The largest power of two, beyond which n would overflow
+        size_type const maxCapacity = ~(~size_type(0) >> 1);
+
+        if (capacity > maxCapacity)
+        {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(STLSOFT_NS_QUAL_STD(length_error)("mpmc_ring capacity too large"));
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+            STLSOFT_MESSAGE_ASSERT("mpmc_ring capacity too large", capacity <= maxCapacity);
+
+            capacity = maxCapacity;
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+
+        size_type n = 2;
+
+        for (; n < capacity; n <<= 1)
+        {}
+
+        return n;
+    }
+
+    cell_type_& cell_(size_type index) const STLSOFT_NOEXCEPT
+    {
+        return m_cells[index & m_mask];
+    }
+    value_type* element_(size_type index) const STLSOFT_NOEXCEPT
+    {
+        return reinterpret_cast<value_type*>(&cell_(index).bytes[0]);
+    }
+
+    // A cell is ready for the claimant of position index - to fill it
+    // (lag 0) or empty it (lag 1) - when its sequence number is
+    // index + lag; if less, the cell is of the previous lap, so the ring
+    // is full (or empty)
+    difference_type_ readiness_(size_type index, size_type lag) const STLSOFT_NOEXCEPT
+    {
+        size_type const sequence = cell_(index).sequence.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        return static_cast<difference_type_>(sequence - (index + lag));
+    }
+
+    // Claims the position at the given index, returning it, or ~0 if the
+    // ring is full (or empty)
+    size_type claim_(index_type_& index, size_type n, size_type lag) STLSOFT_NOEXCEPT
+    {
+        size_type num;
+        size_type pos = claim_n_(index, n, lag, &num);
+
+        return (0 == num) ? ~size_type(0) : pos;
+    }
+
+    // Claims up to n consecutive positions from the given index, all of
+    // whose cells are ready, returning the first, and the number in *num
+    size_type claim_n_(index_type_& index, size_type n, size_type lag, size_type* num) STLSOFT_NOEXCEPT
+    {
+        size_type pos = index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+
+        for (;;)
+        {
+            difference_type_ const r = readiness_(pos, lag);
+
+            if (0 == n ||
+                r < 0)
+            {
+                *num = 0;
+
+                return pos;
+            }
+            else if (r > 0)
+            {
+                // Another thread has claimed pos
+                pos = index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+            }
+            else
+            {
+                size_type m = 1;
+
+                for (; m != n && 0 == readiness_(pos + m, lag); ++m)
+                {}
+
+                // Only the claimant of a position changes its cell, so
+                // cells found ready remain so while the index is pos
+                if (index.compare_exchange_weak(pos, pos + m, STLSOFT_NS_QUAL_STD(memory_order_relaxed)))
+                {
+                    *num = m;
+
+                    return pos;
+                }
+            }
+        }
+    }
+
+    void release_(size_type head, value_type& value) STLSOFT_NOEXCEPT
+    {
+        value_type* const p = element_(head);
+
+        value = STLSOFT_NS_QUAL_STD(move)(*p);
+        p->~value_type();
+
+        cell_(head).sequence.store(head + m_mask + 1, STLSOFT_NS_QUAL_STD(memory_order_release));
+    }
+
+private: // fields
+    padded_index_type_  m_tail;
+    padded_index_type_  m_head;
+    // After the indexes, so that they do not share a line with them
+    size_type const     m_mask;
+    cell_type_* const   m_cells;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_MPMC_RING */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,395 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/synch/spsc_ring.hpp
+ *
+ * Purpose:     Bounded, wait-free single-producer single-consumer ring queue.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/synch/spsc_ring.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::spsc_ring class template
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_SPSC_RING
+#define STLSOFT_INCL_STLSOFT_SYNCH_HPP_SPSC_RING
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_SPSC_RING_MAJOR      1
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_SPSC_RING_MINOR      0
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_SPSC_RING_REVISION   2
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_SPSC_RING_EDIT       2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+# include <stlsoft/synch/util/cache_line_padded_.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_NEW
+# define STLSOFT_INCL_NEW
+# include <new>
+#endif /* !STLSOFT_INCL_NEW */
+#ifndef STLSOFT_INCL_UTILITY
+# define STLSOFT_INCL_UTILITY
+# include <utility>
+#endif /* !STLSOFT_INCL_UTILITY */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A bounded, wait-free queue for a single producer thread and a single
+ * consumer thread.
+ *
+ * \ingroup group__library__Synch
+ *
+ * \param T The element type
+ * \param N The capacity, which must be a power of two, of at least 2
+ *
+ * The elements are held within the instance, in a ring of \c N slots.
+ * The producer advances the tail, and the consumer the head, each of
+ * which is on its own cache line together with the producer's (or
+ * consumer's) cached copy of the other index, so that each side reads
+ * the other's index only when its cached copy suggests that the ring is
+ * full (or empty). Every operation completes in a bounded number of
+ * steps.
+ *
+ * try_push_n() and try_pop_n() transfer as many elements as are
+ * possible, up to the number requested, publishing them with a single
+ * store.
+ *
+ * Only one thread may call the push operations, and only one (other)
+ * thread may call the pop operations, at a time. For blocking operations
+ * use unixstl::blocking_ring; for several producers or consumers use
+ * stlsoft::mpmc_ring.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>).
+ */
+template<
+    ss_typename_param_k T
+,   ss_size_t           N
+>
+class spsc_ring
+{
+public: // types
+    /// The element type
+    typedef T                                               value_type;
+    /// This type
+    typedef spsc_ring<T, N>                                 class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The bool type
+    typedef ss_bool_t                                       bool_type;
+private:
+    typedef STLSOFT_NS_QUAL_STD(atomic)<size_type>          index_type_;
+    struct side_type_
+    {
+        index_type_                                         index;
+        size_type                                           otherCached;
+
+        side_type_()
+            : index(0)
+            , otherCached(0)
+        {}
+    };
+    typedef ximpl_cache_line_padded::cache_line_padded<
+        side_type_
+    >                                                       padded_side_type_;
+    struct slot_type_
+    {
+        alignas(T) ss_byte_t                                bytes[sizeof(T)];
+    };
+
+    static_assert(N >= 2 && 0 == (N & (N - 1)), "spsc_ring capacity must be a power of two, of at least 2");
+
+    enum { mask_ = N - 1 };
+
+public: // construction
+    /// Constructs an empty ring
+    spsc_ring()
+        : m_producer()
+        , m_consumer()
+    {}
+    /// Destroys any elements remaining in the ring
+    ~spsc_ring() STLSOFT_NOEXCEPT
+    {
+        size_type const tail = m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        { for (size_type head = m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed)); head != tail; ++head)
+        {
+            slot_(head)->~value_type();
+        }}
+    }
+private:
+    spsc_ring(class_type const&);               // copy-construction proscribed
+    void operator =(class_type const&);         // copy-assignment proscribed
+
+public: // producer operations
+    /// Appends a copy of the given value, failing if the ring is full
+    bool_type try_push(value_type const& value)
+    {
+        return try_emplace_(value);
+    }
+    /// Appends the given value, failing - without moving from \c value -
+    /// if the ring is full
+    bool_type try_push(value_type&& value)
+    {
+        return try_emplace_(STLSOFT_NS_QUAL_STD(move)(value));
+    }
+    /// Appends copies of as many of the \c n values at \c values as the
+    /// ring can accommodate
+    ///
+    /// \return The number of values appended
+    ///
+    /// \note If copying a value throws, the values already copied are
+    ///   appended before the exception is propagated
+    size_type try_push_n(value_type const* values, size_type n)
+    {
+        size_type const tail    =   m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+        size_type       space   =   N - (tail - m_producer.value.otherCached);
+
+        if (space < n)
+        {
+            m_producer.value.otherCached = m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+            space = N - (tail - m_producer.value.otherCached);
+        }
+
+        size_type const num = (space < n) ? space : n;
+        size_type       i   = 0;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            for (; i != num; ++i)
+            {
+                ::new(slot_(tail + i)) value_type(values[i]);
+            }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (...)
+        {
+            m_producer.value.index.store(tail + i, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+            throw;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        m_producer.value.index.store(tail + num, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+        return num;
+    }
+
+public: // consumer operations
+    /// Removes the element at the front of the ring into \c value,
+    /// failing if the ring is empty
+    bool_type try_pop(value_type& value)
+    {
+        size_type const head = m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+
+        if (head == m_consumer.value.otherCached)
+        {
+            m_consumer.value.otherCached = m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+            if (head == m_consumer.value.otherCached)
+            {
+                return false;
+            }
+        }
+
+        value_type* const p = slot_(head);
+
+        value = STLSOFT_NS_QUAL_STD(move)(*p);
+        p->~value_type();
+
+        m_consumer.value.index.store(head + 1, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+        return true;
+    }
+    /// Removes up to \c maxCount elements from the front of the ring into
+    /// the array \c values
+    ///
+    /// \return The number of elements removed
+    ///
+    /// \note If assigning an element throws, the elements already
+    ///   assigned are removed before the exception is propagated
+    size_type try_pop_n(value_type* values, size_type maxCount)
+    {
+        size_type const head        =   m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+        size_type       available   =   m_consumer.value.otherCached - head;
+
+        if (available < maxCount)
+        {
+            m_consumer.value.otherCached = m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+            available = m_consumer.value.otherCached - head;
+        }
+
+        size_type const num = (available < maxCount) ? available : maxCount;
+        size_type       i   = 0;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        try
+        {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            for (; i != num; ++i)
+            {
+                value_type* const p = slot_(head + i);
+
+                values[i] = STLSOFT_NS_QUAL_STD(move)(*p);
+                p->~value_type();
+            }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        }
+        catch (...)
+        {
+            m_consumer.value.index.store(head + i, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+            throw;
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        m_consumer.value.index.store(head + num, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+        return num;
+    }
+
+public: // accessors
+    /// The number of elements in the ring, which may be changed by the
+    /// producer or consumer at any time
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        size_type const head = m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+        size_type const tail = m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        // The indexes are read separately, so the difference may appear
+        // momentarily out of range
+        return (tail - head <= N) ? (tail - head) : 0;
+    }
+    /// Indicates whether the ring is empty, which may be changed by the
+    /// producer or consumer at any time
+    bool_type empty() const STLSOFT_NOEXCEPT
+    {
+        return 0 == size();
+    }
+    /// The maximum number of elements that the ring can hold
+    static size_type capacity() STLSOFT_NOEXCEPT
+    {
+        return N;
+    }
+
+private: // implementation
+    value_type* slot_(size_type index) STLSOFT_NOEXCEPT
+    {
+        return reinterpret_cast<value_type*>(&m_slots[index & mask_].bytes[0]);
+    }
+
+    template <ss_typename_param_k V>
+    bool_type try_emplace_(V&& value)
+    {
+        size_type const tail = m_producer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+
+        if (N == tail - m_producer.value.otherCached)
+        {
+            m_producer.value.otherCached = m_consumer.value.index.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+            if (N == tail - m_producer.value.otherCached)
+            {
+                return false;
+            }
+        }
+
+        ::new(slot_(tail)) value_type(STLSOFT_NS_QUAL_STD(forward)<V>(value));
+
+        m_producer.value.index.store(tail + 1, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+        return true;
+    }
+
+private: // fields
+    padded_side_type_   m_producer; // The tail, and the producer's copy of the head
+    padded_side_type_   m_consumer; // The head, and the consumer's copy of the tail
+    slot_type_  m_slots[N];
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_SPSC_RING */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,137 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/synch/util/cache_line_padded_.hpp
+ *
+ * Purpose:     Padding of frequently-written shared data to a cache line.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/synch/util/cache_line_padded_.hpp
+ *
+ * \brief [INTERNAL] Padding of frequently-written shared data to a cache
+ *   line (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+#define STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED__MAJOR    1
+# define STLSOFT_VER_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED__MINOR    0
+# define STLSOFT_VER_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED__REVISION 1
+# define STLSOFT_VER_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED__EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_cache_line_padded
+{
+
+    enum
+    {
+        /* The size, in bytes, assumed for a cache line */
+        cache_line_size =   64
+    };
+
+    /* Holds a value of type T followed by padding to the next cache line
+     * boundary, so that, when instances are laid out one after another,
+     * writes to one value do not contend with accesses to its neighbours,
+     * as is required for the indexes of concurrent queues, the words of
+     * spin locks, and per-thread accumulators.
+     *
+     * The value is padded, rather than aligned, to the cache line size: a
+     * type with extended alignment (as by alignas(64)) is not allocated at
+     * that alignment by operator new prior to C++17, whereas the padding is
+     * effective however the instance is allocated. The cost is that the
+     * value may itself straddle two lines.
+     */
+    template <ss_typename_param_k T>
+    struct cache_line_padded
+    {
+        T           value;
+        ss_byte_t   pad_[cache_line_size - sizeof(T) % cache_line_size];
+
+        cache_line_padded()
+            : value()
+        {}
+        template <ss_typename_param_k A>
+        ss_explicit_k
+        cache_line_padded(A const& arg)
+            : value(arg)
+        {}
+    };
+
+} /* namespace ximpl_cache_line_padded */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+/* ///////////////////////////// end of file //////////////////////////// */
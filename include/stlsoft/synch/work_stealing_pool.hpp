@@ -0,0 +1,715 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/synch/work_stealing_pool.hpp
+ *
+ * Purpose:     Fixed-size work-stealing thread pool, for data-parallel
+ *              algorithms.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+
+
+/** \file stlsoft/synch/work_stealing_pool.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::work_stealing_pool class
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ *
+ * \note Requires C++11 (for <code>std::thread</code>).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL
+#define STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL_MAJOR     1
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL_MINOR     0
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL_REVISION  2
+# define STLSOFT_VER_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL_EDIT      2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+# include <stlsoft/synch/util/cache_line_padded_.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+#ifndef STLSOFT_INCL_CONDITION_VARIABLE
+# define STLSOFT_INCL_CONDITION_VARIABLE
+# include <condition_variable>
+#endif /* !STLSOFT_INCL_CONDITION_VARIABLE */
+#ifndef STLSOFT_INCL_EXCEPTION
+# define STLSOFT_INCL_EXCEPTION
+# include <exception>
+#endif /* !STLSOFT_INCL_EXCEPTION */
+#ifndef STLSOFT_INCL_MEMORY
+# define STLSOFT_INCL_MEMORY
+# include <memory>
+#endif /* !STLSOFT_INCL_MEMORY */
+#ifndef STLSOFT_INCL_MUTEX
+# define STLSOFT_INCL_MUTEX
+# include <mutex>
+#endif /* !STLSOFT_INCL_MUTEX */
+#ifndef STLSOFT_INCL_THREAD
+# define STLSOFT_INCL_THREAD
+# include <thread>
+#endif /* !STLSOFT_INCL_THREAD */
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A fixed-size pool of threads that executes data-parallel jobs, each
+ * job being a number of independent chunks, identified by index.
+ *
+ * \ingroup group__library__Synch
+ *
+ * The chunk indexes of a job are divided evenly between the participants
+ * - the pool's threads and the thread that submits the job, which takes
+ * part as participant 0 - each of which executes the chunks of its own
+ * range from the front and, when that is exhausted, steals the back half
+ * of the range of another participant. A range is held in a single
+ * 64-bit atomic word, so that taking and stealing are each a single
+ * compare-and-swap, and a participant leaves the job only when it finds
+ * every range empty.
+ *
+ * Which participant executes a given chunk is unspecified, so callers
+ * that need a deterministic result (such as a reduction) should make
+ * each chunk's work depend only on its index, and combine the per-chunk
+ * results in index order, as do the algorithms in
+ * stlsoft/algorithms/parallel.hpp.
+ *
+ * If a chunk function throws, the remaining chunks of that job are not
+ * executed, and the first exception thrown is rethrown by
+ * for_each_chunk() once all participants have left the job.
+ *
+ * A pool executes one job at a time: a job submitted while the pool is
+ * busy - whether from another thread, or from within a chunk function
+ * of the current job - is executed on the submitting thread alone,
+ * rather than waiting, so that nested use cannot deadlock.
+ *
+ * \note Requires C++11 (for <code>std::thread</code>).
+ */
+class work_stealing_pool
+{
+public: // types
+    /// This type
+    typedef work_stealing_pool                              class_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+private:
+    typedef ss_uint64_t                                     range_type;
+    typedef void (*invoke_fn_type)(void*, size_type);
+    // Each range is padded to a cache line, since it is written by its
+    // owner for every chunk
+    typedef ximpl_cache_line_padded::cache_line_padded<
+        STLSOFT_NS_QUAL_STD(atomic)<range_type>
+    >                                                       slot_type;
+
+public: // construction
+    /// Constructs a pool with the given total concurrency
+    ///
+    /// \param concurrency The number of participants in each job,
+    ///   including the submitting thread, so the pool creates
+    ///   <code>concurrency - 1</code> threads. If 0, the value of
+    ///   <code>std::thread::hardware_concurrency()</code> is used (or 1,
+    ///   if that is not known)
+    ss_explicit_k
+    work_stealing_pool(
+        size_type concurrency = 0
+    );
+    /// Stops and joins the pool's threads
+    ~work_stealing_pool() STLSOFT_NOEXCEPT;
+private:
+    work_stealing_pool(class_type const&);      // copy-construction proscribed
+    void operator =(class_type const&);         // copy-assignment proscribed
+
+public: // accessors
+    /// The number of participants in each job, including the
+    /// submitting thread
+    size_type
+    concurrency() const STLSOFT_NOEXCEPT;
+
+    /// A process-wide pool, with the hardware concurrency, which is
+    /// created on first use
+    static
+    class_type&
+    default_instance();
+
+public: // operations
+    /// Invokes <code>f(i)</code> for each \c i in
+    /// <code>[0, numChunks)</code>, concurrently, returning when all
+    /// have completed
+    ///
+    /// \param numChunks The number of chunks
+    /// \param f The chunk function, which will be invoked concurrently
+    ///   from multiple threads
+    ///
+    /// \exception any The first exception thrown by \c f
+    template <ss_typename_param_k F>
+    void
+    for_each_chunk(
+        size_type   numChunks
+    ,   F           f
+    );
+
+private: // implementation
+    static
+    range_type
+    pack_(
+        size_type   first
+    ,   size_type   last
+    ) STLSOFT_NOEXCEPT
+    {
+        return (static_cast<range_type>(last) << 32) | static_cast<range_type>(first);
+    }
+    static
+    size_type
+    first_(
+        range_type  r
+    ) STLSOFT_NOEXCEPT
+    {
+        return static_cast<size_type>(r & 0xffffffffu);
+    }
+    static
+    size_type
+    last_(
+        range_type  r
+    ) STLSOFT_NOEXCEPT
+    {
+        return static_cast<size_type>(r >> 32);
+    }
+
+    // Executes the consecutive chunks of a group, for jobs with more
+    // chunks than can be held in a range
+    template <ss_typename_param_k F>
+    struct chunk_group_
+    {
+    public:
+        chunk_group_(
+            F&          f
+        ,   size_type   numChunks
+        ,   size_type   groupSize
+        )
+            : f(f)
+            , numChunks(numChunks)
+            , groupSize(groupSize)
+        {}
+
+    public:
+        void operator ()(size_type group) const
+        {
+            size_type const first   =   group * groupSize;
+            size_type const last    =   (numChunks - first < groupSize) ? numChunks : (first + groupSize);
+
+            for (size_type i = first; i != last; ++i)
+            {
+                f(i);
+            }
+        }
+
+    public:
+        F&              f;
+        size_type const numChunks;
+        size_type const groupSize;
+    };
+
+    template <ss_typename_param_k F>
+    void
+    for_each_chunk_(
+        size_type   numChunks
+    ,   F&          f
+    );
+    template <ss_typename_param_k F>
+    static
+    void
+    invoke_(
+        void*       context
+    ,   size_type   index
+    )
+    {
+        (*static_cast<F*>(context))(index);
+    }
+
+    void
+    stop_() STLSOFT_NOEXCEPT;
+    void
+    work_(
+        size_type   participant
+    );
+    void
+    run_(
+        size_type   participant
+    ) STLSOFT_NOEXCEPT;
+    bool
+    pop_(
+        size_type   participant
+    ,   size_type*  index
+    ) STLSOFT_NOEXCEPT;
+    bool
+    steal_(
+        size_type   participant
+    ) STLSOFT_NOEXCEPT;
+    void
+    submit_(
+        size_type       numChunks
+    ,   invoke_fn_type  fn
+    ,   void*           context
+    );
+
+private: // fields
+    size_type const                                         m_concurrency;
+    STLSOFT_NS_QUAL_STD(unique_ptr)<slot_type[]>            m_slots;
+    STLSOFT_NS_QUAL_STD(vector)<STLSOFT_NS_QUAL_STD(thread)> m_threads;
+    STLSOFT_NS_QUAL_STD(atomic)<bool>                       m_busy;
+    STLSOFT_NS_QUAL_STD(atomic)<bool>                       m_cancelled;
+    // The following are guarded by m_mx
+    STLSOFT_NS_QUAL_STD(mutex)                              m_mx;
+    STLSOFT_NS_QUAL_STD(condition_variable)                 m_cvStart;
+    STLSOFT_NS_QUAL_STD(condition_variable)                 m_cvDone;
+    ss_uint64_t                                             m_generation;
+    size_type                                               m_numActive;
+    bool                                                    m_stopping;
+    invoke_fn_type                                          m_fn;
+    void*                                                   m_context;
+    STLSOFT_NS_QUAL_STD(exception_ptr)                      m_exception;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+inline
+/* ss_explicit_k */
+work_stealing_pool::work_stealing_pool(
+    work_stealing_pool::size_type concurrency
+)
+    : m_concurrency(
+        (0 != concurrency)
+            ? concurrency
+            : (0 != STLSOFT_NS_QUAL_STD(thread)::hardware_concurrency())
+                ? STLSOFT_NS_QUAL_STD(thread)::hardware_concurrency()
+                : 1
+    )
+    , m_slots(new slot_type[m_concurrency])
+    , m_threads()
+    , m_busy(false)
+    , m_cancelled(false)
+    , m_mx()
+    , m_cvStart()
+    , m_cvDone()
+    , m_generation(0)
+    , m_numActive(0)
+    , m_stopping(false)
+    , m_fn(ss_nullptr_k)
+    , m_context(ss_nullptr_k)
+    , m_exception()
+{
+    for (size_type i = 0; i != m_concurrency; ++i)
+    {
+        m_slots[i].value.store(0, STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+    }
+
+    m_threads.reserve(m_concurrency - 1);
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    try
+    {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        for (size_type i = 1; i != m_concurrency; ++i)
+        {
+            m_threads.push_back(STLSOFT_NS_QUAL_STD(thread)(&class_type::work_, this, i));
+        }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+    }
+    catch (...)
+    {
+        stop_();
+
+        throw;
+    }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+}
+
+inline
+work_stealing_pool::~work_stealing_pool() STLSOFT_NOEXCEPT
+{
+    stop_();
+}
+
+inline
+work_stealing_pool::size_type
+work_stealing_pool::concurrency() const STLSOFT_NOEXCEPT
+{
+    return m_concurrency;
+}
+
+inline
+/* static */
+work_stealing_pool&
+work_stealing_pool::default_instance()
+{
+    static class_type s_pool;
+
+    return s_pool;
+}
+
+template <ss_typename_param_k F>
+inline
+void
+work_stealing_pool::for_each_chunk(
+    work_stealing_pool::size_type   numChunks
+,   F                               f
+)
+{
+    // A range holds 32-bit chunk indexes, so a job with more chunks than
+    // that (as is possible only where size_type is 64-bit) is executed
+    // as fewer groups of consecutive chunks
+    range_type const maxChunks = 0xffffffffu;
+
+    if (static_cast<range_type>(numChunks) > maxChunks)
+    {
+        size_type const     groupSize   =   static_cast<size_type>(numChunks / maxChunks + (0 != numChunks % maxChunks));
+        chunk_group_<F>     group(f, numChunks, groupSize);
+
+        for_each_chunk_(numChunks / groupSize + (0 != numChunks % groupSize), group);
+    }
+    else
+    {
+        for_each_chunk_(numChunks, f);
+    }
+}
+
+template <ss_typename_param_k F>
+inline
+void
+work_stealing_pool::for_each_chunk_(
+    work_stealing_pool::size_type   numChunks
+,   F&                              f
+)
+{
+    bool expected = false;
+
+    if (numChunks < 2 ||
+        1 == m_concurrency ||
+        !m_busy.compare_exchange_strong(expected, true, STLSOFT_NS_QUAL_STD(memory_order_acquire)))
+    {
+        for (size_type i = 0; i != numChunks; ++i)
+        {
+            f(i);
+        }
+    }
+    else
+    {
+        submit_(numChunks, &class_type::invoke_<F>, &f);
+    }
+}
+
+inline
+void
+work_stealing_pool::stop_() STLSOFT_NOEXCEPT
+{
+    {
+        STLSOFT_NS_QUAL_STD(lock_guard)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+        m_stopping = true;
+    }
+
+    m_cvStart.notify_all();
+
+    for (size_type i = 0; i != m_threads.size(); ++i)
+    {
+        m_threads[i].join();
+    }
+}
+
+inline
+void
+work_stealing_pool::work_(
+    work_stealing_pool::size_type participant
+)
+{
+    ss_uint64_t generation = 0;
+
+    for (;;)
+    {
+        {
+            STLSOFT_NS_QUAL_STD(unique_lock)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+            for (; !m_stopping && generation == m_generation; )
+            {
+                m_cvStart.wait(lock);
+            }
+
+            if (m_stopping)
+            {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        run_(participant);
+
+        {
+            STLSOFT_NS_QUAL_STD(lock_guard)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+            if (0 == --m_numActive)
+            {
+                m_cvDone.notify_one();
+            }
+        }
+    }
+}
+
+inline
+void
+work_stealing_pool::run_(
+    work_stealing_pool::size_type participant
+) STLSOFT_NOEXCEPT
+{
+    for (;;)
+    {
+        size_type index;
+
+        if (pop_(participant, &index))
+        {
+            // Once cancelled, the remaining chunks are drained but not
+            // executed
+            if (!m_cancelled.load(STLSOFT_NS_QUAL_STD(memory_order_relaxed)))
+            {
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+                try
+                {
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+                    (*m_fn)(m_context, index);
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+                }
+                catch (...)
+                {
+                    STLSOFT_NS_QUAL_STD(lock_guard)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+                    if (!m_exception)
+                    {
+                        m_exception = STLSOFT_NS_QUAL_STD(current_exception)();
+                    }
+
+                    m_cancelled.store(true, STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+                }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+            }
+        }
+        else if (!steal_(participant))
+        {
+            break;
+        }
+    }
+}
+
+inline
+bool
+work_stealing_pool::pop_(
+    work_stealing_pool::size_type   participant
+,   work_stealing_pool::size_type*  index
+) STLSOFT_NOEXCEPT
+{
+    STLSOFT_NS_QUAL_STD(atomic)<range_type>& range = m_slots[participant].value;
+
+    range_type r = range.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+    for (;;)
+    {
+        size_type const first   =   first_(r);
+        size_type const last    =   last_(r);
+
+        if (first >= last)
+        {
+            return false;
+        }
+
+        if (range.compare_exchange_weak(r, pack_(first + 1, last), STLSOFT_NS_QUAL_STD(memory_order_acq_rel), STLSOFT_NS_QUAL_STD(memory_order_acquire)))
+        {
+            *index = first;
+
+            return true;
+        }
+    }
+}
+
+inline
+bool
+work_stealing_pool::steal_(
+    work_stealing_pool::size_type participant
+) STLSOFT_NOEXCEPT
+{
+    // Only the owner refills its own range, and only when it is empty,
+    // and no thief will change an empty range, so a plain store of the
+    // stolen range suffices. (A range's value identifies exactly the
+    // chunks it holds, so a thief's compare-and-swap that succeeds
+    // against a range that has since been emptied and refilled with the
+    // same value is still correct.)
+
+    for (size_type i = 1; i != m_concurrency; ++i)
+    {
+        size_type const                         victim  =   (participant + i) % m_concurrency;
+        STLSOFT_NS_QUAL_STD(atomic)<range_type>& range  =   m_slots[victim].value;
+        range_type                              r       =   range.load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+        for (;;)
+        {
+            size_type const first   =   first_(r);
+            size_type const last    =   last_(r);
+
+            if (first >= last)
+            {
+                break;
+            }
+
+            size_type const mid     =   last - (last - first + 1) / 2;
+
+            if (range.compare_exchange_weak(r, pack_(first, mid), STLSOFT_NS_QUAL_STD(memory_order_acq_rel), STLSOFT_NS_QUAL_STD(memory_order_acquire)))
+            {
+                m_slots[participant].value.store(pack_(mid, last), STLSOFT_NS_QUAL_STD(memory_order_release));
+
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+inline
+void
+work_stealing_pool::submit_(
+    work_stealing_pool::size_type   numChunks
+,   work_stealing_pool::invoke_fn_type fn
+,   void*                           context
+)
+{
+    for (size_type i = 0; i != m_concurrency; ++i)
+    {
+        size_type const first   =   static_cast<size_type>((static_cast<range_type>(numChunks) * i) / m_concurrency);
+        size_type const last    =   static_cast<size_type>((static_cast<range_type>(numChunks) * (i + 1)) / m_concurrency);
+
+        m_slots[i].value.store(pack_(first, last), STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+    }
+
+    m_cancelled.store(false, STLSOFT_NS_QUAL_STD(memory_order_relaxed));
+
+    {
+        STLSOFT_NS_QUAL_STD(lock_guard)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+        m_fn        =   fn;
+        m_context   =   context;
+        m_numActive =   m_threads.size();
+        ++m_generation;
+    }
+
+    m_cvStart.notify_all();
+
+    run_(0);
+
+    STLSOFT_NS_QUAL_STD(exception_ptr) x;
+
+    {
+        STLSOFT_NS_QUAL_STD(unique_lock)<STLSOFT_NS_QUAL_STD(mutex)> lock(m_mx);
+
+        for (; 0 != m_numActive; )
+        {
+            m_cvDone.wait(lock);
+        }
+
+        x.swap(m_exception);
+    }
+
+    m_busy.store(false, STLSOFT_NS_QUAL_STD(memory_order_release));
+
+    if (x)
+    {
+        STLSOFT_NS_QUAL_STD(rethrow_exception)(x);
+    }
+}
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_WORK_STEALING_POOL */
+
+/* ///////////////////////////// end of file //////////////////////////// */
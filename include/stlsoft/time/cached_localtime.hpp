@@ -0,0 +1,381 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/time/cached_localtime.hpp
+ *
+ * Purpose:     Per-thread cached localtime() conversion.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/time/cached_localtime.hpp
+ *
+ * \brief [C++] Per-thread cached form of <code>localtime()</code>
+ *  (\ref group__library__Time "Time" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_CACHED_LOCALTIME
+#define STLSOFT_INCL_STLSOFT_TIME_HPP_CACHED_LOCALTIME
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_TIME_HPP_CACHED_LOCALTIME_MAJOR    1
+# define STLSOFT_VER_STLSOFT_TIME_HPP_CACHED_LOCALTIME_MINOR    0
+# define STLSOFT_VER_STLSOFT_TIME_HPP_CACHED_LOCALTIME_REVISION 1
+# define STLSOFT_VER_STLSOFT_TIME_HPP_CACHED_LOCALTIME_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_time
+# include <stlsoft/api/internal/time.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_time */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if !defined(STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE)
+
+# if 0
+# elif __cplusplus >= 201103L
+# elif defined(_MSC_VER) && \
+       _MSC_VER >= 1900
+# else
+#  define STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+# endif
+#endif /* !STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes - 2
+ */
+
+#ifndef STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+
+# ifndef STLSOFT_INCL_ATOMIC
+#  define STLSOFT_INCL_ATOMIC
+#  include <atomic>
+# endif /* !STLSOFT_INCL_ATOMIC */
+
+# ifndef STLSOFT_INCL_H_STDLIB
+#  define STLSOFT_INCL_H_STDLIB
+#  include <stdlib.h>
+# endif /* !STLSOFT_INCL_H_STDLIB */
+# ifndef STLSOFT_INCL_H_STRING
+#  define STLSOFT_INCL_H_STRING
+#  include <string.h>
+# endif /* !STLSOFT_INCL_H_STRING */
+#endif /* !STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_cached_localtime
+{
+
+    /* Performs the full conversion, using the reentrant localtime_r() on
+     * UNIX, since the cache is per-thread (preceded by tzset(), since
+     * localtime_r() is not required to observe changes to TZ, as
+     * localtime() is)
+     */
+    inline
+    int
+    localtime_(
+        struct tm*      tm
+    ,   time_t const*   t
+    )
+    {
+# if !defined(STLSOFT_USING_SAFE_STR_FUNCTIONS) && \
+     (  defined(unix) || \
+        defined(UNIX) || \
+        defined(__unix__) || \
+        defined(__unix) || \
+        defined(__MACH__))
+
+        ::tzset();
+
+        return (ss_nullptr_k == ::localtime_r(t, tm)) ? errno : 0;
+# else
+
+        return STLSOFT_API_INTERNAL_Time_localtime(tm, t);
+# endif
+    }
+
+# ifndef STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+
+    struct cache_t
+    {
+        time_t      t;
+        struct tm   tm;
+        unsigned    generation;
+        bool        valid;
+        char        tz[64];
+    };
+
+    inline
+    STLSOFT_NS_QUAL_STD(atomic)<unsigned>&
+    generation_() STLSOFT_NOEXCEPT
+    {
+        static STLSOFT_NS_QUAL_STD(atomic)<unsigned> s_generation(0u);
+
+        return s_generation;
+    }
+
+    inline
+    cache_t&
+    cache_() STLSOFT_NOEXCEPT
+    {
+        static thread_local cache_t s_cache = { 0, {}, 0u, false, { '\0' } };
+
+        return s_cache;
+    }
+
+    /* Reads the TZ environment variable (an empty string if not
+     * defined), returning false if it is too long to be cached
+     */
+    inline
+    bool
+    read_tz_(
+        char (&tz)[64]
+    ) STLSOFT_NOEXCEPT
+    {
+#  ifdef STLSOFT_USING_SAFE_STR_FUNCTIONS
+
+        ss_size_t n;
+
+        if (0 != ::getenv_s(&n, &tz[0], STLSOFT_NUM_ELEMENTS(tz), "TZ"))
+        {
+            tz[0] = '\0';
+
+            return false;
+        }
+
+        return true;
+#  else /* ? STLSOFT_USING_SAFE_STR_FUNCTIONS */
+
+        char const* const   s   =   ::getenv("TZ");
+
+        if (ss_nullptr_k == s)
+        {
+            tz[0] = '\0';
+
+            return true;
+        }
+        else
+        {
+            ss_size_t const n   =   ::strlen(s);
+
+            if (n >= STLSOFT_NUM_ELEMENTS(tz))
+            {
+                tz[0] = '\0';
+
+                return false;
+            }
+
+            ::memcpy(&tz[0], s, n + 1);
+
+            return true;
+        }
+#  endif /* STLSOFT_USING_SAFE_STR_FUNCTIONS */
+    }
+
+# endif /* !STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+} /* namespace ximpl_cached_localtime */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Converts a time to its broken-down local time form, caching the
+ * result per-thread.
+ *
+ * \param tm Pointer to the instance to receive the result. May not be
+ *   \c null
+ * \param t Pointer to the time to be converted. May not be \c null
+ *
+ * \retval 0 The conversion succeeded
+ * \retval other The error (as would be returned from
+ *   <code>STLSOFT_API_INTERNAL_Time_localtime()</code>)
+ *
+ * \note Unlike <code>localtime()</code>, this function is thread-safe,
+ *   since on UNIX the full conversion uses <code>localtime_r()</code>.
+ *
+ * Each thread retains the most recently converted time and its
+ * broken-down form, so that repeated conversions within the same second
+ * - the common case for logging, and for the
+ * <code>std::chrono::system_clock::time_point</code> string access
+ * shims - are a copy, and conversions of a different second within the
+ * same minute (when the local offset from UTC is a whole number of
+ * minutes) adjust only <code>tm_sec</code>. Otherwise the full
+ * <code>localtime()</code> conversion is performed.
+ *
+ * \note The value of the \c TZ environment variable is compared whenever
+ *   the second changes, so a change to the timezone is detected within
+ *   one second. Call invalidate_cached_localtime() to have it (or any
+ *   other change that affects localtime(), such as a call to
+ *   <code>tzset()</code>) take effect immediately in all threads.
+ *
+ * \note If the macro <code>STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE</code>
+ *   is defined, or the compiler does not support C++11, no caching is
+ *   performed.
+ */
+inline
+int
+cached_localtime(
+    struct tm*      tm
+,   time_t const*   t
+)
+{
+    STLSOFT_ASSERT(ss_nullptr_k != tm);
+    STLSOFT_ASSERT(ss_nullptr_k != t);
+
+#ifdef STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+
+    return ximpl_cached_localtime::localtime_(tm, t);
+#else /* ? STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+
+    ximpl_cached_localtime::cache_t&    c           =   ximpl_cached_localtime::cache_();
+    unsigned const                      generation  =   ximpl_cached_localtime::generation_().load(STLSOFT_NS_QUAL_STD(memory_order_acquire));
+
+    if (c.valid &&
+        generation == c.generation)
+    {
+        if (*t == c.t)
+        {
+            *tm = c.tm;
+
+            return 0;
+        }
+        else
+        {
+            char    tz[64];
+
+            if (ximpl_cached_localtime::read_tz_(tz) &&
+                0 == ::strcmp(tz, c.tz))
+            {
+                // The cached time is on a (UTC) minute boundary, and the
+                // new time is in the same minute
+
+                time_t const    minute  =   c.t - c.tm.tm_sec;
+
+                if (c.tm.tm_sec == STLSOFT_STATIC_CAST(int, ((c.t % 60) + 60) % 60) &&
+                    *t >= minute &&
+                    *t < minute + 60)
+                {
+                    c.t         =   *t;
+                    c.tm.tm_sec =   STLSOFT_STATIC_CAST(int, *t - minute);
+
+                    *tm = c.tm;
+
+                    return 0;
+                }
+            }
+        }
+    }
+
+    int const r = ximpl_cached_localtime::localtime_(tm, t);
+
+    if (0 != r)
+    {
+        c.valid = false;
+    }
+    else
+    {
+        c.t             =   *t;
+        c.tm            =   *tm;
+        c.generation    =   generation;
+        c.valid         =   ximpl_cached_localtime::read_tz_(c.tz);
+    }
+
+    return r;
+#endif /* STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+}
+
+/** Invalidates the caches used by cached_localtime() in all threads,
+ * which should be called after any change to the process' timezone.
+ */
+inline
+void
+invalidate_cached_localtime() STLSOFT_NOEXCEPT
+{
+#ifndef STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+
+    ximpl_cached_localtime::generation_().fetch_add(1u, STLSOFT_NS_QUAL_STD(memory_order_release));
+#endif /* !STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_CACHED_LOCALTIME */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,1260 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/time/compiled_strftime_format.hpp
+ *
+ * Purpose:     Precompiled format programs for fast_strftime().
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/time/compiled_strftime_format.hpp
+ *
+ * \brief [C++] Definition of the stlsoft::basic_compiled_strftime_format
+ *   and stlsoft::basic_compiled_strftime_renderer class templates
+ *  (\ref group__library__Time "Time" Library).
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT
+#define STLSOFT_INCL_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT_MAJOR    1
+# define STLSOFT_VER_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT_MINOR    0
+# define STLSOFT_VER_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT_REVISION 2
+# define STLSOFT_VER_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT_EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME
+# include <stlsoft/time/fast_strftime.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_FAST_STRFTIME */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_ALLOCATOR_SELECTOR
+# include <stlsoft/memory/util/allocator_selector.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_UTIL_HPP_ALLOCATOR_SELECTOR */
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP
+# include <stlsoft/util/std_swap.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_HPP_STD_SWAP */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+template <ss_typename_param_k T_char>
+class basic_compiled_strftime_renderer;
+
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_compiled_strftime_format
+{
+
+    enum op_code_t
+    {
+            op_literal              // (only the run of literal characters)
+        ,   op_weekday_short        // %a
+        ,   op_weekday_long         // %A
+        ,   op_month_short          // %b, %h
+        ,   op_month_long           // %B
+        ,   op_century              // %C
+        ,   op_mday                 // %d
+        ,   op_mdy                  // %D
+        ,   op_mday_space           // %e
+        ,   op_ymd                  // %F
+        ,   op_hour_24              // %H
+        ,   op_hour_12              // %I
+        ,   op_yday                 // %j
+        ,   op_minute               // %M
+        ,   op_month                // %m
+        ,   op_hm                   // %R
+        ,   op_second               // %S
+        ,   op_hms                  // %T
+        ,   op_weekday_iso          // %u
+        ,   op_week_sunday          // %U
+        ,   op_week_monday          // %W
+        ,   op_weekday              // %w
+        ,   op_year                 // %Y
+        ,   op_year_2               // %y
+    };
+
+    // The fields of struct tm on which an operation depends
+    enum
+    {
+            dep_second  =   0x01
+        ,   dep_minute  =   0x02
+        ,   dep_hour    =   0x04
+        ,   dep_date    =   0x08
+
+        ,   dep_time    =   dep_second | dep_minute | dep_hour
+    };
+
+    struct op_t
+    {
+        ss_uint16_t code;
+        ss_uint8_t  hashed;
+        ss_uint8_t  deps;
+        ss_uint32_t offset;     // offset of the preceding literal run
+        ss_uint32_t length;     // length of the preceding literal run
+    };
+
+    // The two-digit forms of [0, 100), as a flat array of pairs
+    template <ss_typename_param_k T_char>
+    struct digit_pairs_traits_;
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct digit_pairs_traits_<char>
+    {
+        static char const* pairs() STLSOFT_NOEXCEPT
+        {
+            return
+                "00010203040506070809"
+                "10111213141516171819"
+                "20212223242526272829"
+                "30313233343536373839"
+                "40414243444546474849"
+                "50515253545556575859"
+                "60616263646566676869"
+                "70717273747576777879"
+                "80818283848586878889"
+                "90919293949596979899"
+                ;
+        }
+    };
+
+    STLSOFT_TEMPLATE_SPECIALISATION
+    struct digit_pairs_traits_<wchar_t>
+    {
+        static wchar_t const* pairs() STLSOFT_NOEXCEPT
+        {
+            return
+                L"00010203040506070809"
+                L"10111213141516171819"
+                L"20212223242526272829"
+                L"30313233343536373839"
+                L"40414243444546474849"
+                L"50515253545556575859"
+                L"60616263646566676869"
+                L"70717273747576777879"
+                L"80818283848586878889"
+                L"90919293949596979899"
+                ;
+        }
+    };
+
+    inline
+    int
+    op_deps_(
+        int code
+    ) STLSOFT_NOEXCEPT
+    {
+        switch (code)
+        {
+        case op_literal:
+            return 0;
+        case op_hour_24:
+        case op_hour_12:
+            return dep_hour;
+        case op_minute:
+            return dep_minute;
+        case op_second:
+            return dep_second;
+        case op_hm:
+            return dep_hour | dep_minute;
+        case op_hms:
+            return dep_time;
+        default:
+            return dep_date;
+        }
+    }
+
+    template <ss_typename_param_k T_slice>
+    inline
+    ss_size_t
+    max_slice_length_(
+        T_slice const*  slices
+    ,   ss_size_t       n
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_size_t r = 0;
+
+        { for (ss_size_t i = 0; i != n; ++i)
+        {
+            if (r < slices[i].len)
+            {
+                r = slices[i].len;
+            }
+        }}
+
+        return r;
+    }
+
+    template <ss_typename_param_k T_info>
+    inline
+    ss_size_t
+    op_max_width_(
+        int             code
+    ,   T_info const&   info
+    ) STLSOFT_NOEXCEPT
+    {
+        switch (code)
+        {
+        case op_literal:
+            return 0;
+        case op_weekday_short:
+            return max_slice_length_(info.weekdays_short, STLSOFT_NUM_ELEMENTS(info.weekdays_short));
+        case op_weekday_long:
+            return max_slice_length_(info.weekdays_long, STLSOFT_NUM_ELEMENTS(info.weekdays_long));
+        case op_month_short:
+            return max_slice_length_(info.months_short, STLSOFT_NUM_ELEMENTS(info.months_short));
+        case op_month_long:
+            return max_slice_length_(info.months_long, STLSOFT_NUM_ELEMENTS(info.months_long));
+        case op_mdy:
+        case op_hms:
+            return 8;
+        case op_ymd:
+            return 10;
+        case op_hm:
+            return 5;
+        case op_year:
+            return 4;
+        case op_yday:
+            return 3;
+        case op_weekday_iso:
+        case op_weekday:
+            return 1;
+        default:
+            return 2;
+        }
+    }
+
+    // The week number, for %U (wd == tm_wday) and %W, as calculated by
+    // fast_strftime()
+    inline
+    int
+    week_number_(
+        struct tm const*    tm
+    ,   int                 wd
+    ) STLSOFT_NOEXCEPT
+    {
+        if (tm->tm_yday < wd)
+        {
+            return 0;
+        }
+        else
+        {
+            int v = tm->tm_yday / 7;
+
+            if (wd <= (tm->tm_yday % 7))
+            {
+                ++v;
+            }
+
+            return v;
+        }
+    }
+
+    template <ss_typename_param_k T_char>
+    inline
+    T_char*
+    put_2_(
+        T_char*         p
+    ,   T_char const*   pairs
+    ,   int             v
+    ,   bool            hashed
+    ) STLSOFT_NOEXCEPT
+    {
+        T_char const* const s = pairs + 2 * v;
+
+        if (hashed &&
+            '0' == s[0])
+        {
+            p[0] = s[1];
+
+            return p + 1;
+        }
+        else
+        {
+            p[0] = s[0];
+            p[1] = s[1];
+
+            return p + 2;
+        }
+    }
+
+    template <ss_typename_param_k T_char>
+    inline
+    T_char*
+    put_run_(
+        T_char*         p
+    ,   T_char const*   s
+    ,   ss_size_t       n
+    ) STLSOFT_NOEXCEPT
+    {
+        // runs are usually very short, so this is preferred over memcpy()
+        { for (ss_size_t i = 0; i != n; ++i)
+        {
+            p[i] = s[i];
+        }}
+
+        return p + n;
+    }
+
+    template<
+        ss_typename_param_k T_char
+    ,   ss_typename_param_k T_slice
+    >
+    inline
+    T_char*
+    put_slice_(
+        T_char*         p
+    ,   T_slice const&  slice
+    ) STLSOFT_NOEXCEPT
+    {
+        return put_run_(p, slice.ptr, slice.len);
+    }
+
+    template <ss_typename_param_k T_char>
+    inline
+    T_char*
+    put_year_(
+        T_char*         p
+    ,   T_char const*   pairs
+    ,   int             v
+    ) STLSOFT_NOEXCEPT
+    {
+        T_char const* const tu0 = pairs + 2 * (v % 100);
+        T_char const* const tu1 = pairs + 2 * (v / 100);
+
+        p[0] = tu1[0];
+        p[1] = tu1[1];
+        p[2] = tu0[0];
+        p[3] = tu0[1];
+
+        return p + 4;
+    }
+
+    // Renders the field of a single operation, without bounds checking,
+    // producing the same output as fast_strftime() does for the
+    // corresponding specifier
+    template<
+        ss_typename_param_k T_char
+    ,   ss_typename_param_k T_info
+    >
+    inline
+    T_char*
+    render_field_(
+        T_char*                 p
+    ,   op_t const&             op
+    ,   struct tm const*        tm
+    ,   T_info const&           info
+    ,   T_char const*           pairs
+    ) STLSOFT_NOEXCEPT
+    {
+        bool const  hashed  =   0 != op.hashed;
+        int         v;
+
+        switch (op.code)
+        {
+        case op_literal:
+            return p;
+        case op_weekday_short:
+            return put_slice_(p, info.weekdays_short[tm->tm_wday]);
+        case op_weekday_long:
+            return put_slice_(p, info.weekdays_long[tm->tm_wday]);
+        case op_month_short:
+            return put_slice_(p, info.months_short[tm->tm_mon]);
+        case op_month_long:
+            return put_slice_(p, info.months_long[tm->tm_mon]);
+        case op_century:
+            return put_2_(p, pairs, (1900 + tm->tm_year) / 100, hashed);
+        case op_mday:
+            return put_2_(p, pairs, tm->tm_mday, hashed);
+        case op_mdy:
+            p = put_2_(p, pairs, tm->tm_mon + 1, false);
+            *p++ = '/';
+            p = put_2_(p, pairs, tm->tm_mday, false);
+            *p++ = '/';
+            return put_2_(p, pairs, tm->tm_year % 100, false);
+        case op_mday_space:
+            if (!hashed && tm->tm_mday < 10)
+            {
+                *p++ = ' ';
+            }
+            return put_2_(p, pairs, tm->tm_mday, true);
+        case op_ymd:
+            p = put_year_(p, pairs, 1900 + tm->tm_year);
+            *p++ = '-';
+            p = put_2_(p, pairs, tm->tm_mon + 1, hashed);
+            *p++ = '-';
+            return put_2_(p, pairs, tm->tm_mday, hashed);
+        case op_hour_24:
+            return put_2_(p, pairs, tm->tm_hour, hashed);
+        case op_hour_12:
+            v = tm->tm_hour % 12;
+            return put_2_(p, pairs, (0 == v) ? 12 : v, hashed);
+        case op_yday:
+            v = 1 + tm->tm_yday;
+            if (v > 99)
+            {
+                T_char const* const tu0 = pairs + 2 * (v % 100);
+
+                *p++ = pairs[2 * (v / 100) + 1];
+                *p++ = tu0[0];
+                *p++ = tu0[1];
+            }
+            else
+            {
+                T_char const* const tu0 = pairs + 2 * v;
+
+                if (!hashed)
+                {
+                    *p++ = '0';
+                    *p++ = tu0[0];
+                }
+                else if (v > 10)
+                {
+                    *p++ = tu0[0];
+                }
+
+                *p++ = tu0[1];
+            }
+            return p;
+        case op_minute:
+            return put_2_(p, pairs, tm->tm_min, hashed);
+        case op_month:
+            return put_2_(p, pairs, tm->tm_mon + 1, hashed);
+        case op_hm:
+            p = put_2_(p, pairs, tm->tm_hour, hashed);
+            *p++ = ':';
+            return put_2_(p, pairs, tm->tm_min, hashed);
+        case op_second:
+            return put_2_(p, pairs, tm->tm_sec, hashed);
+        case op_hms:
+            p = put_2_(p, pairs, tm->tm_hour, hashed);
+            *p++ = ':';
+            p = put_2_(p, pairs, tm->tm_min, hashed);
+            *p++ = ':';
+            return put_2_(p, pairs, tm->tm_sec, hashed);
+        case op_weekday_iso:
+            *p++ = T_char('0' + ((0 == tm->tm_wday) ? 7 : tm->tm_wday));
+            return p;
+        case op_week_sunday:
+            return put_2_(p, pairs, week_number_(tm, tm->tm_wday), hashed);
+        case op_week_monday:
+            return put_2_(p, pairs, week_number_(tm, (0 == tm->tm_wday) ? 6 : tm->tm_wday - 1), hashed);
+        case op_weekday:
+            *p++ = T_char('0' + tm->tm_wday);
+            return p;
+        case op_year:
+            return put_year_(p, pairs, 1900 + tm->tm_year);
+        case op_year_2:
+            return put_2_(p, pairs, tm->tm_year % 100, hashed);
+        default:
+            STLSOFT_MESSAGE_ASSERT("should not get here", false);
+            return p;
+        }
+    }
+
+} /* namespace ximpl_compiled_strftime_format */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** A format for fast_strftime() that is parsed once, into a program of
+ * operations and runs of literal characters, and may then be used to
+ * render any number of times.
+ *
+ * \tparam T_char The character type
+ *
+ * The rendered output is identical to that of fast_strftime() with the
+ * same format string, and the same formatting codes are supported. Each
+ * operation of the program renders a run of literal characters followed
+ * by a field, by table lookup, so that the format string is not
+ * interpreted on every call.
+ *
+ * \see basic_compiled_strftime_renderer, which re-renders only the fields
+ *   that have changed since the previous time
+ */
+template <ss_typename_param_k T_char>
+class basic_compiled_strftime_format
+{
+public: // types
+    /// The character type
+    typedef T_char                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// This type
+    typedef basic_compiled_strftime_format<T_char>          class_type;
+private:
+    typedef ximpl_fast_strftime_::fast_strftime_traits_<
+        char_type
+    >                                                       traits_type_;
+    typedef ss_typename_type_k traits_type_::info_type      info_type_;
+    typedef ximpl_compiled_strftime_format::op_t            op_type_;
+    typedef auto_buffer_old<
+        op_type_
+    ,   ss_typename_type_k allocator_selector<op_type_>::allocator_type
+    ,   16
+    >                                                       ops_type_;
+    typedef auto_buffer_old<
+        char_type
+    ,   ss_typename_type_k allocator_selector<char_type>::allocator_type
+    ,   64
+    >                                                       literals_type_;
+
+    friend class basic_compiled_strftime_renderer<T_char>;
+
+public: // construction
+    /// Compiles the given format
+    ///
+    /// \param fmt The format string. May not be \c null
+    ss_explicit_k
+    basic_compiled_strftime_format(
+        char_type const* fmt
+    )
+        : m_ops(0)
+        , m_literals(0)
+        , m_maxLength(0)
+        , m_deps(0)
+        , m_variableDeps(0)
+    {
+        STLSOFT_ASSERT(ss_nullptr_k != fmt);
+
+        compile_(fmt);
+    }
+    /// Creates a copy of \c rhs
+    basic_compiled_strftime_format(class_type const& rhs)
+        : m_ops(0)
+        , m_literals(0)
+        , m_maxLength(rhs.m_maxLength)
+        , m_deps(rhs.m_deps)
+        , m_variableDeps(rhs.m_variableDeps)
+    {
+        m_ops.copy_from(rhs.m_ops);
+        m_literals.copy_from(rhs.m_literals);
+    }
+
+    /// Copy-assigns from \c rhs
+    class_type& operator =(class_type const& rhs)
+    {
+        class_type t(rhs);
+
+        t.swap(*this);
+
+        return *this;
+    }
+
+    /// Swaps the state of the instance with that of \c rhs
+    void swap(class_type& rhs) STLSOFT_NOEXCEPT
+    {
+        m_ops.swap(rhs.m_ops);
+        m_literals.swap(rhs.m_literals);
+        std_swap(m_maxLength, rhs.m_maxLength);
+        std_swap(m_deps, rhs.m_deps);
+        std_swap(m_variableDeps, rhs.m_variableDeps);
+    }
+
+public: // attributes
+    /// The maximum number of characters (excluding the terminating nul)
+    /// of any rendering
+    size_type max_length() const STLSOFT_NOEXCEPT
+    {
+        return m_maxLength;
+    }
+
+    /// The number of operations in the compiled program
+    size_type num_ops() const STLSOFT_NOEXCEPT
+    {
+        return m_ops.size();
+    }
+
+public: // operations
+    /// Renders the given time into the given buffer
+    ///
+    /// \param dest The buffer to receive the result
+    /// \param cchDest The number of characters available in \c dest
+    /// \param tm Pointer to the time to be rendered. May not be \c null
+    ///
+    /// \return The number of characters written, excluding the
+    ///   terminating nul; 0 if the result (including the nul) would not
+    ///   fit in \c dest
+    ///
+    /// \pre 0 == cchDest || ss_nullptr_k != dest
+    /// \pre The fields of \c tm are within their defined ranges, and
+    ///   <code>tm->tm_year</code> is in the range [0, 8100)
+    size_type
+    render(
+        char_type*          dest
+    ,   size_type           cchDest
+    ,   struct tm const*    tm
+    ) const
+    {
+        STLSOFT_ASSERT(0 == cchDest || ss_nullptr_k != dest);
+        STLSOFT_ASSERT(is_valid_tm_(tm));
+
+        if (cchDest > m_maxLength)
+        {
+            return render_unchecked_(dest, tm, ss_nullptr_k);
+        }
+        else
+        {
+            return render_checked_(dest, cchDest, tm);
+        }
+    }
+
+#ifdef STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT
+
+    /// Renders the given time into the given array
+    template <ss_size_t V_dimension>
+    size_type
+    render(
+        char_type         (&dest)[V_dimension]
+    ,   struct tm const*    tm
+    ) const
+    {
+        return render(&dest[0], V_dimension, tm);
+    }
+#endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
+
+private: // implementation
+    static
+    bool
+    is_valid_tm_(
+        struct tm const* tm
+    ) STLSOFT_NOEXCEPT
+    {
+        return  ss_nullptr_k != tm &&
+                tm->tm_sec >= 0 && tm->tm_sec < 60 &&
+                tm->tm_min >= 0 && tm->tm_min < 60 &&
+                tm->tm_hour >= 0 && tm->tm_hour < 24 &&
+                tm->tm_mday >= 1 && tm->tm_mday <= 31 &&
+                tm->tm_mon >= 0 && tm->tm_mon < 12 &&
+                tm->tm_year >= 0 && tm->tm_year < 8100 &&
+                tm->tm_wday >= 0 && tm->tm_wday < 7 &&
+                tm->tm_yday >= 0 && tm->tm_yday < 366;
+    }
+
+    // Parses the format with the same state machine as fast_strftime(),
+    // so that every quirk of the latter (such as the handling of
+    // unsupported specifiers) is reproduced. Each field operation holds
+    // the run of literal characters that precedes it, and any trailing
+    // run is held by a final op_literal operation. The format is parsed
+    // twice - first to count, and then to emit - so that the buffers are
+    // sized once, and exactly.
+    void
+    compile_(
+        char_type const* fmt
+    )
+    {
+        namespace ximpl = ximpl_compiled_strftime_format;
+
+        size_type   numOps      =   0;
+        size_type   numLiterals =   0;
+
+        parse_(fmt, false, numOps, numLiterals);
+
+        m_ops.resize(numOps);
+        m_literals.resize(numLiterals);
+
+        numOps      =   0;
+        numLiterals =   0;
+
+        parse_(fmt, true, numOps, numLiterals);
+
+        STLSOFT_ASSERT(numOps == m_ops.size());
+        STLSOFT_ASSERT(numLiterals == m_literals.size());
+
+        info_type_ const& info = traits_type_::default_info();
+
+        { for (size_type i = 0; i != numOps; ++i)
+        {
+            op_type_ const& op = m_ops[i];
+
+            m_maxLength += op.length + ximpl::op_max_width_(op.code, info);
+
+            m_deps |= op.deps;
+
+            // a hashed time field varies in width
+            if (0 != op.hashed)
+            {
+                m_variableDeps |= (op.deps & ximpl::dep_time);
+            }
+        }}
+    }
+
+    // Parses the format, counting the operations and literal characters
+    // in numOps and numLiterals, and, if emit is true, writing them into
+    // m_ops and m_literals
+    void
+    parse_(
+        char_type const*    fmt
+    ,   bool                emit
+    ,   size_type&          numOps
+    ,   size_type&          numLiterals
+    )
+    {
+        namespace ximpl = ximpl_compiled_strftime_format;
+
+        enum state_t
+        {
+                state_literal
+            ,   state_percent
+            ,   state_percent_hash
+        };
+
+        state_t     state       =   state_literal;
+        size_type   runOffset   =   0;
+
+        { for (; '\0' != *fmt; ++fmt)
+        {
+            char_type const ch = *fmt;
+
+            switch (state)
+            {
+            case state_literal:
+
+                if ('%' == ch)
+                {
+                    state = state_percent;
+                }
+                else
+                {
+                    append_literal_(emit, numLiterals, ch);
+                }
+                continue;
+            case state_percent:
+
+                if ('%' == ch)
+                {
+                    append_literal_(emit, numLiterals, ch);
+
+                    state = state_literal;
+
+                    continue;
+                }
+                else if ('#' == ch)
+                {
+                    state = state_percent_hash;
+
+                    continue;
+                }
+                break;
+            default:
+
+                break;
+            }
+
+            int code = -1;
+
+            switch (ch)
+            {
+            case '%':   append_literal_(emit, numLiterals, ch); break;
+            case 'n':   append_literal_(emit, numLiterals, '\n'); state = state_literal; break;
+            case 't':   append_literal_(emit, numLiterals, '\t'); state = state_literal; break;
+            case 'a':   code = ximpl::op_weekday_short; break;
+            case 'A':   code = ximpl::op_weekday_long; break;
+            case 'b':
+            case 'h':   code = ximpl::op_month_short; break;
+            case 'B':   code = ximpl::op_month_long; break;
+            case 'C':   code = ximpl::op_century; break;
+            case 'd':   code = ximpl::op_mday; break;
+            case 'D':   code = ximpl::op_mdy; break;
+            case 'e':   code = ximpl::op_mday_space; break;
+            case 'F':   code = ximpl::op_ymd; break;
+            case 'H':   code = ximpl::op_hour_24; break;
+            case 'I':   code = ximpl::op_hour_12; break;
+            case 'j':   code = ximpl::op_yday; break;
+            case 'M':   code = ximpl::op_minute; break;
+            case 'm':   code = ximpl::op_month; break;
+            case 'R':   code = ximpl::op_hm; break;
+            case 'S':   code = ximpl::op_second; break;
+            case 'T':   code = ximpl::op_hms; break;
+            case 'u':   code = ximpl::op_weekday_iso; break;
+            case 'U':   code = ximpl::op_week_sunday; break;
+            case 'W':   code = ximpl::op_week_monday; break;
+            case 'w':   code = ximpl::op_weekday; break;
+            case 'Y':   code = ximpl::op_year; break;
+            case 'y':   code = ximpl::op_year_2; break;
+            default:    // unsupported: ignored, and the state is unchanged
+                break;
+            }
+
+            if (code >= 0)
+            {
+                append_op_(emit, numOps, code, state_percent_hash == state, runOffset, numLiterals);
+
+                state = state_literal;
+            }
+        }}
+
+        if (runOffset != numLiterals)
+        {
+            append_op_(emit, numOps, ximpl::op_literal, false, runOffset, numLiterals);
+        }
+    }
+
+    void
+    append_literal_(
+        bool        emit
+    ,   size_type&  numLiterals
+    ,   char_type   ch
+    )
+    {
+        if (emit)
+        {
+            m_literals[numLiterals] = ch;
+        }
+
+        ++numLiterals;
+    }
+
+    void
+    append_op_(
+        bool        emit
+    ,   size_type&  numOps
+    ,   int         code
+    ,   bool        hashed
+    ,   size_type&  runOffset
+    ,   size_type   numLiterals
+    )
+    {
+        if (emit)
+        {
+            op_type_& op = m_ops[numOps];
+
+            op.code     =   static_cast<ss_uint16_t>(code);
+            op.hashed   =   hashed;
+            op.deps     =   static_cast<ss_uint8_t>(ximpl_compiled_strftime_format::op_deps_(code));
+            op.offset   =   static_cast<ss_uint32_t>(runOffset);
+            op.length   =   static_cast<ss_uint32_t>(numLiterals - runOffset);
+        }
+
+        ++numOps;
+
+        runOffset = numLiterals;
+    }
+
+    // Renders the whole program into dest, which must have room for
+    // max_length() + 1 characters, optionally recording the offset of
+    // each operation's field
+    size_type
+    render_unchecked_(
+        char_type*          dest
+    ,   struct tm const*    tm
+    ,   size_type*          offsets
+    ) const STLSOFT_NOEXCEPT
+    {
+        namespace ximpl = ximpl_compiled_strftime_format;
+
+        info_type_ const&       info        =   traits_type_::default_info();
+        char_type const* const  pairs       =   ximpl::digit_pairs_traits_<char_type>::pairs();
+        char_type const* const  literals    =   m_literals.data();
+        op_type_ const*         b           =   m_ops.data();
+        op_type_ const* const   e           =   b + m_ops.size();
+        char_type*              p           =   dest;
+
+        if (ss_nullptr_k == offsets)
+        {
+            for (; b != e; ++b)
+            {
+                p = ximpl::put_run_(p, literals + b->offset, b->length);
+                p = ximpl::render_field_(p, *b, tm, info, pairs);
+            }
+        }
+        else
+        {
+            for (; b != e; ++b, ++offsets)
+            {
+                p = ximpl::put_run_(p, literals + b->offset, b->length);
+
+                *offsets = static_cast<size_type>(p - dest);
+
+                p = ximpl::render_field_(p, *b, tm, info, pairs);
+            }
+        }
+
+        *p = '\0';
+
+        return static_cast<size_type>(p - dest);
+    }
+
+    size_type
+    render_checked_(
+        char_type*          dest
+    ,   size_type           cchDest
+    ,   struct tm const*    tm
+    ) const STLSOFT_NOEXCEPT
+    {
+        namespace ximpl = ximpl_compiled_strftime_format;
+
+        info_type_ const&       info        =   traits_type_::default_info();
+        char_type const* const  pairs       =   ximpl::digit_pairs_traits_<char_type>::pairs();
+        char_type const* const  literals    =   m_literals.data();
+        size_type               n           =   0;
+
+        if (0 == cchDest)
+        {
+            return 0;
+        }
+
+        { for (size_type i = 0; i != m_ops.size(); ++i)
+        {
+            op_type_ const& op = m_ops[i];
+            char_type       field[16];
+            size_type const len =   static_cast<size_type>(ximpl::render_field_(&field[0], op, tm, info, pairs) - &field[0]);
+
+            if (!(n + op.length + len < cchDest))
+            {
+                return 0;
+            }
+
+            ximpl::put_run_(dest + n, literals + op.offset, op.length);
+            n += op.length;
+            ximpl::put_run_(dest + n, &field[0], len);
+            n += len;
+        }}
+
+        STLSOFT_ASSERT(n < cchDest);
+
+        dest[n] = '\0';
+
+        return n;
+    }
+
+    // Re-renders, in place, the fields of those operations that depend on
+    // the changed fields, which must all be of fixed width
+    void
+    rerender_(
+        char_type*          dest
+    ,   size_type const*    offsets
+    ,   struct tm const*    tm
+    ,   int                 changed
+    ) const STLSOFT_NOEXCEPT
+    {
+        namespace ximpl = ximpl_compiled_strftime_format;
+
+        STLSOFT_ASSERT(0 == (changed & m_variableDeps));
+
+        info_type_ const&       info    =   traits_type_::default_info();
+        char_type const* const  pairs   =   ximpl::digit_pairs_traits_<char_type>::pairs();
+
+        { for (size_type i = 0; i != m_ops.size(); ++i)
+        {
+            op_type_ const& op = m_ops[i];
+
+            if (0 != (op.deps & changed))
+            {
+                ximpl::render_field_(dest + offsets[i], op, tm, info, pairs);
+            }
+        }}
+    }
+
+private: // fields
+    ops_type_       m_ops;
+    literals_type_  m_literals;
+    size_type       m_maxLength;
+    int             m_deps;         // the fields used by any op
+    int             m_variableDeps; // the time fields used by variable-width ops
+};
+
+
+/** Renders times with a basic_compiled_strftime_format into an internal
+ * buffer, re-rendering only the changed fields when successive times
+ * differ only in their hour, minute and/or second.
+ *
+ * \tparam T_char The character type
+ *
+ * When the date fields of the time are unchanged from the previous
+ * rendering, only the operations that depend on the changed fields -
+ * e.g. just <code>%S</code> when successive log timestamps are in the
+ * same minute - are re-rendered, in place. (This is not done when one of
+ * those operations is variable-width, i.e. a time field with the
+ * <code>'#'</code> flag, in which case the whole is re-rendered.)
+ */
+template <ss_typename_param_k T_char>
+class basic_compiled_strftime_renderer
+{
+public: // types
+    /// The character type
+    typedef T_char                                          char_type;
+    /// The size type
+    typedef ss_size_t                                       size_type;
+    /// The format type
+    typedef basic_compiled_strftime_format<T_char>          format_type;
+    /// This type
+    typedef basic_compiled_strftime_renderer<T_char>        class_type;
+private:
+    typedef auto_buffer_old<
+        char_type
+    ,   ss_typename_type_k allocator_selector<char_type>::allocator_type
+    ,   64
+    >                                                       buffer_type_;
+    typedef auto_buffer_old<
+        size_type
+    ,   ss_typename_type_k allocator_selector<size_type>::allocator_type
+    ,   16
+    >                                                       offsets_type_;
+
+public: // construction
+    /// Creates an instance that renders with the given format
+    ///
+    /// \param format The format. Must outlive the instance
+    ss_explicit_k
+    basic_compiled_strftime_renderer(
+        format_type const& format
+    )
+        : m_format(format)
+        , m_buffer(1 + format.max_length())
+        , m_offsets(format.num_ops())
+        , m_length(0)
+        , m_tm()
+        , m_valid(false)
+    {
+        m_buffer[0] = '\0';
+    }
+private:
+    basic_compiled_strftime_renderer(class_type const&);    // copy-construction proscribed
+    class_type& operator =(class_type const&);              // copy-assignment proscribed
+
+public: // operations
+    /// Renders the given time, returning the length of the result, which
+    /// is available via c_str()
+    ///
+    /// \param tm Pointer to the time to be rendered. May not be \c null
+    ///
+    /// \pre The fields of \c tm are within their defined ranges, and
+    ///   <code>tm->tm_year</code> is in the range [0, 8100)
+    size_type
+    render(
+        struct tm const* tm
+    ) STLSOFT_NOEXCEPT
+    {
+        STLSOFT_ASSERT(format_type::is_valid_tm_(tm));
+
+        if (m_valid &&
+            tm->tm_mday == m_tm.tm_mday &&
+            tm->tm_mon == m_tm.tm_mon &&
+            tm->tm_year == m_tm.tm_year &&
+            tm->tm_wday == m_tm.tm_wday &&
+            tm->tm_yday == m_tm.tm_yday)
+        {
+            int changed = 0;
+
+            if (tm->tm_sec != m_tm.tm_sec)
+            {
+                changed |= ximpl_compiled_strftime_format::dep_second;
+            }
+            if (tm->tm_min != m_tm.tm_min)
+            {
+                changed |= ximpl_compiled_strftime_format::dep_minute;
+            }
+            if (tm->tm_hour != m_tm.tm_hour)
+            {
+                changed |= ximpl_compiled_strftime_format::dep_hour;
+            }
+
+            changed &= m_format.m_deps;
+
+            if (0 == (changed & m_format.m_variableDeps))
+            {
+                if (0 != changed)
+                {
+                    m_format.rerender_(m_buffer.data(), m_offsets.data(), tm, changed);
+                }
+
+                m_tm = *tm;
+
+                return m_length;
+            }
+        }
+
+        m_length    =   m_format.render_unchecked_(m_buffer.data(), tm, m_offsets.data());
+        m_tm        =   *tm;
+        m_valid     =   true;
+
+        return m_length;
+    }
+
+    /// Causes the next call to render() to render in full
+    void reset() STLSOFT_NOEXCEPT
+    {
+        m_valid = false;
+    }
+
+public: // attributes
+    /// The result of the most recent rendering
+    char_type const* c_str() const STLSOFT_NOEXCEPT
+    {
+        return m_buffer.data();
+    }
+
+    /// The result of the most recent rendering
+    char_type const* data() const STLSOFT_NOEXCEPT
+    {
+        return m_buffer.data();
+    }
+
+    /// The length of the result of the most recent rendering
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_length;
+    }
+
+private: // fields
+    format_type const&  m_format;
+    buffer_type_        m_buffer;
+    offsets_type_       m_offsets;
+    size_type           m_length;
+    struct tm           m_tm;
+    bool                m_valid;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * typedefs
+ */
+
+/** Specialisation of basic_compiled_strftime_format for \c char */
+typedef basic_compiled_strftime_format<ss_char_a_t>         compiled_strftime_format;
+/** Specialisation of basic_compiled_strftime_format for \c wchar_t */
+typedef basic_compiled_strftime_format<ss_char_w_t>         compiled_wcsftime_format;
+/** Specialisation of basic_compiled_strftime_renderer for \c char */
+typedef basic_compiled_strftime_renderer<ss_char_a_t>       compiled_strftime_renderer;
+/** Specialisation of basic_compiled_strftime_renderer for \c wchar_t */
+typedef basic_compiled_strftime_renderer<ss_char_w_t>       compiled_wcsftime_renderer;
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Form of fast_strftime() that takes a compiled format
+ *
+ * \see basic_compiled_strftime_format::render()
+ */
+template <ss_typename_param_k T_char>
+inline
+size_t
+fast_strftime(
+    T_char                                              dest[]
+,   size_t                                              cchDest
+,   basic_compiled_strftime_format<T_char> const&       fmt
+,   struct tm const*                                    tm
+)
+{
+    return fmt.render(dest, cchDest, tm);
+}
+
+#ifdef STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT
+
+template<
+    ss_typename_param_k T_char
+,   ss_size_t           V_dimension
+>
+inline
+size_t
+fast_strftime(
+    T_char                                            (&dest)[V_dimension]
+,   basic_compiled_strftime_format<T_char> const&       fmt
+,   struct tm const*                                    tm
+)
+{
+    return fmt.render(dest, V_dimension, tm);
+}
+#endif /* STLSOFT_CF_STATIC_ARRAY_SIZE_DETERMINATION_SUPPORT */
+
+/** Swaps two compiled formats */
+template <ss_typename_param_k T_char>
+inline
+void
+swap(
+    basic_compiled_strftime_format<T_char>&     lhs
+,   basic_compiled_strftime_format<T_char>&     rhs
+) STLSOFT_NOEXCEPT
+{
+    lhs.swap(rhs);
+}
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !STLSOFT_INCL_STLSOFT_TIME_HPP_COMPILED_STRFTIME_FORMAT */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,11 +4,11 @@
  * Purpose:     Efficient drop-in replacement for strftime().
  *
  * Created:     23rd December 2018
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2018-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -54,8 +54,8 @@
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_MAJOR       1
 # define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_MINOR       3
-# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_REVISION    1
-# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_EDIT        14
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_REVISION    2
+# define STLSOFT_VER_STLSOFT_TIME_HPP_FAST_STRFTIME_EDIT        15
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -132,6 +132,70 @@ struct fast_strftime_traits_<char>
 {
     typedef char                        char_type;
     typedef stlsoft_C_string_slice_a_t  slice_type;
+    typedef fast_strftime_info_a_t      info_type;
+
+    static info_type const& default_info()
+    {
+        static
+        info_type const s_info =
+        {
+                0
+
+            ,   0
+
+            ,   {
+                    { 6, "Sunday" }
+                ,   { 6, "Monday" }
+                ,   { 7, "Tuesday" }
+                ,   { 9, "Wednesday" }
+                ,   { 8, "Thursday" }
+                ,   { 6, "Friday" }
+                ,   { 8, "Saturday" }
+                }
+
+            ,   {
+                    { 3, "Sun" }
+                ,   { 3, "Mon" }
+                ,   { 3, "Tue" }
+                ,   { 3, "Wed" }
+                ,   { 3, "Thu" }
+                ,   { 3, "Fri" }
+                ,   { 3, "Sat" }
+                }
+
+            ,   {
+                    { 7, "January" }
+                ,   { 8, "February" }
+                ,   { 5, "March" }
+                ,   { 5, "April" }
+                ,   { 3, "May" }
+                ,   { 4, "June" }
+                ,   { 4, "July" }
+                ,   { 6, "August" }
+                ,   { 9, "September" }
+                ,   { 7, "October" }
+                ,   { 8, "November" }
+                ,   { 8, "December" }
+                }
+
+            ,   {
+                    { 3, "Jan" }
+                ,   { 3, "Feb" }
+                ,   { 3, "Mar" }
+                ,   { 3, "Apr" }
+                ,   { 3, "May" }
+                ,   { 3, "Jun" }
+                ,   { 3, "Jul" }
+                ,   { 3, "Aug" }
+                ,   { 3, "Sep" }
+                ,   { 3, "Oct" }
+                ,   { 3, "Nov" }
+                ,   { 3, "Dec" }
+                }
+        };
+
+        return s_info;
+    }
 
     static char_type const* const* tens_and_units()
     {
@@ -248,6 +312,70 @@ struct fast_strftime_traits_<wchar_t>
 {
     typedef wchar_t                     char_type;
     typedef stlsoft_C_string_slice_w_t  slice_type;
+    typedef fast_strftime_info_w_t      info_type;
+
+    static info_type const& default_info()
+    {
+        static
+        info_type const s_info =
+        {
+                0
+
+            ,   0
+
+            ,   {
+                    { 6, L"Sunday" }
+                ,   { 6, L"Monday" }
+                ,   { 7, L"Tuesday" }
+                ,   { 9, L"Wednesday" }
+                ,   { 8, L"Thursday" }
+                ,   { 6, L"Friday" }
+                ,   { 8, L"Saturday" }
+                }
+
+            ,   {
+                    { 3, L"Sun" }
+                ,   { 3, L"Mon" }
+                ,   { 3, L"Tue" }
+                ,   { 3, L"Wed" }
+                ,   { 3, L"Thu" }
+                ,   { 3, L"Fri" }
+                ,   { 3, L"Sat" }
+                }
+
+            ,   {
+                    { 7, L"January" }
+                ,   { 8, L"February" }
+                ,   { 5, L"March" }
+                ,   { 5, L"April" }
+                ,   { 3, L"May" }
+                ,   { 4, L"June" }
+                ,   { 4, L"July" }
+                ,   { 6, L"August" }
+                ,   { 9, L"September" }
+                ,   { 7, L"October" }
+                ,   { 8, L"November" }
+                ,   { 8, L"December" }
+                }
+
+            ,   {
+                    { 3, L"Jan" }
+                ,   { 3, L"Feb" }
+                ,   { 3, L"Mar" }
+                ,   { 3, L"Apr" }
+                ,   { 3, L"May" }
+                ,   { 3, L"Jun" }
+                ,   { 3, L"Jul" }
+                ,   { 3, L"Aug" }
+                ,   { 3, L"Sep" }
+                ,   { 3, L"Oct" }
+                ,   { 3, L"Nov" }
+                ,   { 3, L"Dec" }
+                }
+        };
+
+        return s_info;
+    }
 
     static char_type const* const* tens_and_units()
     {
@@ -1182,65 +1310,9 @@ fast_strftime(
 ,   struct tm const*            tm
 )
 {
-    static
-    fast_strftime_info_a_t const s_info =
-    {
-            0
-
-        ,   0
-
-        ,   {
-                { 6, "Sunday" }
-            ,   { 6, "Monday" }
-            ,   { 7, "Tuesday" }
-            ,   { 9, "Wednesday" }
-            ,   { 8, "Thursday" }
-            ,   { 6, "Friday" }
-            ,   { 8, "Saturday" }
-            }
+    typedef ximpl_fast_strftime_::fast_strftime_traits_<char>  traits_t;
 
-        ,   {
-                { 3, "Sun" }
-            ,   { 3, "Mon" }
-            ,   { 3, "Tue" }
-            ,   { 3, "Wed" }
-            ,   { 3, "Thu" }
-            ,   { 3, "Fri" }
-            ,   { 3, "Sat" }
-            }
-
-        ,   {
-                { 7, "January" }
-            ,   { 8, "February" }
-            ,   { 5, "March" }
-            ,   { 5, "April" }
-            ,   { 3, "May" }
-            ,   { 4, "June" }
-            ,   { 4, "July" }
-            ,   { 6, "August" }
-            ,   { 9, "September" }
-            ,   { 7, "October" }
-            ,   { 8, "November" }
-            ,   { 8, "December" }
-            }
-
-        ,   {
-                { 3, "Jan" }
-            ,   { 3, "Feb" }
-            ,   { 3, "Mar" }
-            ,   { 3, "Apr" }
-            ,   { 3, "May" }
-            ,   { 3, "Jun" }
-            ,   { 3, "Jul" }
-            ,   { 3, "Aug" }
-            ,   { 3, "Sep" }
-            ,   { 3, "Oct" }
-            ,   { 3, "Nov" }
-            ,   { 3, "Dec" }
-            }
-    };
-
-    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, s_info);
+    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, traits_t::default_info());
 }
 
 /** wide-string form */
@@ -1253,65 +1325,9 @@ fast_wcsftime(
 ,   struct tm const*            tm
 )
 {
-    static
-    fast_strftime_info_w_t const s_info =
-    {
-            0
-
-        ,   0
-
-        ,   {
-                { 6, L"Sunday" }
-            ,   { 6, L"Monday" }
-            ,   { 7, L"Tuesday" }
-            ,   { 9, L"Wednesday" }
-            ,   { 8, L"Thursday" }
-            ,   { 6, L"Friday" }
-            ,   { 8, L"Saturday" }
-            }
-
-        ,   {
-                { 3, L"Sun" }
-            ,   { 3, L"Mon" }
-            ,   { 3, L"Tue" }
-            ,   { 3, L"Wed" }
-            ,   { 3, L"Thu" }
-            ,   { 3, L"Fri" }
-            ,   { 3, L"Sat" }
-            }
-
-        ,   {
-                { 7, L"January" }
-            ,   { 8, L"February" }
-            ,   { 5, L"March" }
-            ,   { 5, L"April" }
-            ,   { 3, L"May" }
-            ,   { 4, L"June" }
-            ,   { 4, L"July" }
-            ,   { 6, L"August" }
-            ,   { 9, L"September" }
-            ,   { 7, L"October" }
-            ,   { 8, L"November" }
-            ,   { 8, L"December" }
-            }
-
-        ,   {
-                { 3, L"Jan" }
-            ,   { 3, L"Feb" }
-            ,   { 3, L"Mar" }
-            ,   { 3, L"Apr" }
-            ,   { 3, L"May" }
-            ,   { 3, L"Jun" }
-            ,   { 3, L"Jul" }
-            ,   { 3, L"Aug" }
-            ,   { 3, L"Sep" }
-            ,   { 3, L"Oct" }
-            ,   { 3, L"Nov" }
-            ,   { 3, L"Dec" }
-            }
-    };
+    typedef ximpl_fast_strftime_::fast_strftime_traits_<wchar_t>  traits_t;
 
-    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, s_info);
+    return ximpl_fast_strftime_::fast_strftime_(dest, cchDest, fmt, tm, traits_t::default_info());
 }
 
 /** wide-string form */
@@ -0,0 +1,391 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        stlsoft/util/bits/bitmap_functions.h
+ *
+ * Purpose:     Bitmap (bit-set) combination functions.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file stlsoft/util/bits/bitmap_functions.h
+ *
+ * \brief [C++] Functions to combine bitmaps
+ *   (\ref group__library__Utility "Utility" Library).
+ *
+ * The bitmaps are ranges of 64-bit unsigned integers, which are combined
+ * 256 bits at a time with AVX2, 128 bits at a time with SSE2, or else one
+ * integer at a time. Because each block is loaded in full before the
+ * result is stored, the destination may be either (or both) of the
+ * sources.
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS
+#define STLSOFT_INCL_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS_MAJOR     1
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS_MINOR     0
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS_REVISION  1
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS_EDIT      1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef STLSOFT_INCL_STLSOFT_H_STLSOFT
+# include <stlsoft/stlsoft.h>
+#endif /* !STLSOFT_INCL_STLSOFT_H_STLSOFT */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_STLSOFT_QUALITY_H_COVER
+# include <stlsoft/quality/cover.h>
+#endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef STLSOFT_NO_NAMESPACE
+namespace stlsoft
+{
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Calculates the bitwise AND (intersection) of two bitmaps, each of which is a range of
+ * 64-bit unsigned integers, into a third.
+ *
+ * \param dest Pointer to the first of the <code>n</code> result integers.
+ *   May be the same as <code>lhs</code> and/or <code>rhs</code>
+ * \param lhs Pointer to the first of the <code>n</code> left-hand integers
+ * \param rhs Pointer to the first of the <code>n</code> right-hand integers
+ * \param n The number of integers in each range
+ */
+STLSOFT_INLINE
+void
+stlsoft_C_bitmap_and_64bit_unsigned_range(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    size_t i = 0;
+
+    STLSOFT_COVER_MARK_LINE();
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i const   l   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, lhs + i));
+        __m256i const   r   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, rhs + i));
+
+        _mm256_storeu_si256(STLSOFT_REINTERPRET_CAST(__m256i*, dest + i), _mm256_and_si256(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128i const   l   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, lhs + i));
+        __m128i const   r   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, rhs + i));
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, dest + i), _mm_and_si128(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != n; ++i)
+    {
+        STLSOFT_COVER_MARK_LINE();
+
+        dest[i] = lhs[i] & rhs[i];
+    }
+}
+
+/** Calculates the bitwise OR (union) of two bitmaps, each of which is a range of
+ * 64-bit unsigned integers, into a third.
+ *
+ * \param dest Pointer to the first of the <code>n</code> result integers.
+ *   May be the same as <code>lhs</code> and/or <code>rhs</code>
+ * \param lhs Pointer to the first of the <code>n</code> left-hand integers
+ * \param rhs Pointer to the first of the <code>n</code> right-hand integers
+ * \param n The number of integers in each range
+ */
+STLSOFT_INLINE
+void
+stlsoft_C_bitmap_or_64bit_unsigned_range(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    size_t i = 0;
+
+    STLSOFT_COVER_MARK_LINE();
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i const   l   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, lhs + i));
+        __m256i const   r   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, rhs + i));
+
+        _mm256_storeu_si256(STLSOFT_REINTERPRET_CAST(__m256i*, dest + i), _mm256_or_si256(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128i const   l   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, lhs + i));
+        __m128i const   r   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, rhs + i));
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, dest + i), _mm_or_si128(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != n; ++i)
+    {
+        STLSOFT_COVER_MARK_LINE();
+
+        dest[i] = lhs[i] | rhs[i];
+    }
+}
+
+/** Calculates the bitwise XOR (symmetric difference) of two bitmaps, each of which is a range of
+ * 64-bit unsigned integers, into a third.
+ *
+ * \param dest Pointer to the first of the <code>n</code> result integers.
+ *   May be the same as <code>lhs</code> and/or <code>rhs</code>
+ * \param lhs Pointer to the first of the <code>n</code> left-hand integers
+ * \param rhs Pointer to the first of the <code>n</code> right-hand integers
+ * \param n The number of integers in each range
+ */
+STLSOFT_INLINE
+void
+stlsoft_C_bitmap_xor_64bit_unsigned_range(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    size_t i = 0;
+
+    STLSOFT_COVER_MARK_LINE();
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i const   l   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, lhs + i));
+        __m256i const   r   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, rhs + i));
+
+        _mm256_storeu_si256(STLSOFT_REINTERPRET_CAST(__m256i*, dest + i), _mm256_xor_si256(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128i const   l   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, lhs + i));
+        __m128i const   r   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, rhs + i));
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, dest + i), _mm_xor_si128(l, r));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != n; ++i)
+    {
+        STLSOFT_COVER_MARK_LINE();
+
+        dest[i] = lhs[i] ^ rhs[i];
+    }
+}
+
+/** Calculates the bitwise AND-NOT (difference) of two bitmaps, each of which is a range of
+ * 64-bit unsigned integers, into a third.
+ *
+ * \param dest Pointer to the first of the <code>n</code> result integers.
+ *   May be the same as <code>lhs</code> and/or <code>rhs</code>
+ * \param lhs Pointer to the first of the <code>n</code> left-hand integers
+ * \param rhs Pointer to the first of the <code>n</code> right-hand integers
+ * \param n The number of integers in each range
+ *
+ * \note <code>dest[i] = lhs[i] & ~rhs[i]</code>
+ */
+STLSOFT_INLINE
+void
+stlsoft_C_bitmap_andnot_64bit_unsigned_range(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    size_t i = 0;
+
+    STLSOFT_COVER_MARK_LINE();
+
+#ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256i const   l   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, lhs + i));
+        __m256i const   r   =   _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, rhs + i));
+
+        _mm256_storeu_si256(STLSOFT_REINTERPRET_CAST(__m256i*, dest + i), _mm256_andnot_si256(r, l));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    for (; i + 2 <= n; i += 2)
+    {
+        __m128i const   l   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, lhs + i));
+        __m128i const   r   =   _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, rhs + i));
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, dest + i), _mm_andnot_si128(r, l));
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
+    for (; i != n; ++i)
+    {
+        STLSOFT_COVER_MARK_LINE();
+
+        dest[i] = lhs[i] & ~rhs[i];
+    }
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * C++
+ */
+
+#ifdef __cplusplus
+
+/**
+ *
+ * \see stlsoft_C_bitmap_and_64bit_unsigned_range
+ */
+inline
+void
+bitmap_and(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    stlsoft_C_bitmap_and_64bit_unsigned_range(dest, lhs, rhs, n);
+}
+
+/**
+ *
+ * \see stlsoft_C_bitmap_or_64bit_unsigned_range
+ */
+inline
+void
+bitmap_or(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    stlsoft_C_bitmap_or_64bit_unsigned_range(dest, lhs, rhs, n);
+}
+
+/**
+ *
+ * \see stlsoft_C_bitmap_xor_64bit_unsigned_range
+ */
+inline
+void
+bitmap_xor(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    stlsoft_C_bitmap_xor_64bit_unsigned_range(dest, lhs, rhs, n);
+}
+
+/**
+ *
+ * \see stlsoft_C_bitmap_andnot_64bit_unsigned_range
+ */
+inline
+void
+bitmap_andnot(
+    ss_uint64_t*        dest
+,   ss_uint64_t const*  lhs
+,   ss_uint64_t const*  rhs
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    stlsoft_C_bitmap_andnot_64bit_unsigned_range(dest, lhs, rhs, n);
+}
+#endif /* __cplusplus */
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#ifndef STLSOFT_NO_NAMESPACE
+} /* namespace stlsoft */
+#endif /* STLSOFT_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+/* ////////////////////////////////////////////////////////////////////// */
+
+#endif /* !STLSOFT_INCL_STLSOFT_UTIL_BITS_H_BITMAP_FUNCTIONS */
+
+/* ///////////////////////////// end of file //////////////////////////// */
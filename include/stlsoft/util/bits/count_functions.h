@@ -4,11 +4,11 @@
  * Purpose:     Bit count functions.
  *
  * Created:     2nd June 2010
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2010-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -45,6 +45,13 @@
  *
  * \brief [C++] Functions to count bits
  *   (\ref group__library__Utility "Utility" Library).
+ *
+ * The method used by count_bits() is selected at compile time: the
+ * compiler's population-count intrinsic when the target has a population
+ * count instruction (<code>STLSOFT_BIT_COUNT_BY_intrinsic</code>),
+ * otherwise the 8-bit lookup table (or, if
+ * <code>STLSOFT_BIT_COUNT_BY_Kernighan</code> is defined, Kernighan's
+ * method).
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS
@@ -52,9 +59,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_MAJOR    1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_MINOR    3
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_MINOR    4
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_REVISION 1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_EDIT     18
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_COUNT_FUNCTIONS_EDIT     19
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -74,6 +81,41 @@
 #ifndef STLSOFT_INCL_STLSOFT_QUALITY_H_COVER
 # include <stlsoft/quality/cover.h>
 #endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
+#ifndef STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS
+# include <stlsoft/limits/integral_limits.h>
+#endif /* !STLSOFT_INCL_STLSOFT_LIMITS_H_INTEGRAL_LIMITS */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if 0
+#elif defined(STLSOFT_BIT_COUNT_BY_intrinsic) || \
+      defined(STLSOFT_BIT_COUNT_BY_Kernighan) || \
+      defined(STLSOFT_BIT_COUNT_BY_8bit_table)
+#elif ( defined(STLSOFT_COMPILER_IS_CLANG) || \
+        defined(STLSOFT_COMPILER_IS_GCC)) && \
+      ( defined(__POPCNT__) || \
+        defined(__aarch64__))
+
+# define STLSOFT_BIT_COUNT_BY_intrinsic
+#elif defined(STLSOFT_COMPILER_IS_MSVC) && \
+      defined(_M_X64) && \
+      defined(__AVX__)
+
+# define STLSOFT_BIT_COUNT_BY_intrinsic
+#endif
+
+#if defined(STLSOFT_BIT_COUNT_BY_intrinsic) && \
+    defined(STLSOFT_COMPILER_IS_MSVC)
+# ifndef STLSOFT_INCL_H_INTRIN
+#  define STLSOFT_INCL_H_INTRIN
+#  include <intrin.h>
+# endif /* !STLSOFT_INCL_H_INTRIN */
+#endif
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -362,6 +404,207 @@ namespace ximpl_bit_functions
         return &s_table;
     }
 
+    /* Counts the bits in a 64-bit value by bit-parallel ("SWAR")
+     * addition */
+    STLSOFT_INLINE
+    unsigned
+    stlsoft_C_count_functions_SWAR_64_(
+        ss_uint64_t v
+    )
+    {
+        v = v - ((v >> 1) & STLSOFT_GEN_UINT64_SUFFIX(0x5555555555555555));
+        v = (v & STLSOFT_GEN_UINT64_SUFFIX(0x3333333333333333)) + ((v >> 2) & STLSOFT_GEN_UINT64_SUFFIX(0x3333333333333333));
+        v = (v + (v >> 4)) & STLSOFT_GEN_UINT64_SUFFIX(0x0f0f0f0f0f0f0f0f);
+
+        return STLSOFT_STATIC_CAST(unsigned, (v * STLSOFT_GEN_UINT64_SUFFIX(0x0101010101010101)) >> 56);
+    }
+
+#if defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+    /* Counts the bits in each 64-bit lane, using nibble lookup */
+    STLSOFT_INLINE
+    __m256i
+    stlsoft_C_count_functions_AVX2_256_(
+        __m256i v
+    )
+    {
+        __m256i const   lookup  =   _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m256i const   mask    =   _mm256_set1_epi8(0x0f);
+        __m256i const   lo      =   _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, mask));
+        __m256i const   hi      =   _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi32(v, 4), mask));
+
+        return _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256());
+    }
+
+    /* Carry-save adder: (*h, *l) = a + b + c */
+    STLSOFT_INLINE
+    void
+    stlsoft_C_count_functions_AVX2_CSA_(
+        __m256i*    h
+    ,   __m256i*    l
+    ,   __m256i     a
+    ,   __m256i     b
+    ,   __m256i     c
+    )
+    {
+        __m256i const u = _mm256_xor_si256(a, b);
+
+        *h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+        *l = _mm256_xor_si256(u, c);
+    }
+
+    /* Counts the bits in the n 256-bit blocks at p, by the Harley-Seal
+     * method, which needs only one population count per 16 blocks */
+    STLSOFT_INLINE
+    size_t
+    stlsoft_C_count_functions_Harley_Seal_AVX2_(
+        __m256i const*  p
+    ,   size_t          n
+    )
+    {
+        __m256i     total   =   _mm256_setzero_si256();
+        __m256i     ones    =   _mm256_setzero_si256();
+        __m256i     twos    =   _mm256_setzero_si256();
+        __m256i     fours   =   _mm256_setzero_si256();
+        __m256i     eights  =   _mm256_setzero_si256();
+        __m256i     sixteens;
+        __m256i     twosA;
+        __m256i     twosB;
+        __m256i     foursA;
+        __m256i     foursB;
+        __m256i     eightsA;
+        __m256i     eightsB;
+        size_t      i       =   0;
+        ss_uint64_t lanes[4];
+
+# define STLSOFT_C_COUNT_FUNCTIONS_LOAD_(x)     _mm256_loadu_si256(p + i + (x))
+
+        for (; i + 16 <= n; i += 16)
+        {
+            stlsoft_C_count_functions_AVX2_CSA_(&twosA, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(0), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(1));
+            stlsoft_C_count_functions_AVX2_CSA_(&twosB, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(2), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(3));
+            stlsoft_C_count_functions_AVX2_CSA_(&foursA, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_AVX2_CSA_(&twosA, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(4), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(5));
+            stlsoft_C_count_functions_AVX2_CSA_(&twosB, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(6), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(7));
+            stlsoft_C_count_functions_AVX2_CSA_(&foursB, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_AVX2_CSA_(&eightsA, &fours, fours, foursA, foursB);
+            stlsoft_C_count_functions_AVX2_CSA_(&twosA, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(8), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(9));
+            stlsoft_C_count_functions_AVX2_CSA_(&twosB, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(10), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(11));
+            stlsoft_C_count_functions_AVX2_CSA_(&foursA, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_AVX2_CSA_(&twosA, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(12), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(13));
+            stlsoft_C_count_functions_AVX2_CSA_(&twosB, &ones, ones, STLSOFT_C_COUNT_FUNCTIONS_LOAD_(14), STLSOFT_C_COUNT_FUNCTIONS_LOAD_(15));
+            stlsoft_C_count_functions_AVX2_CSA_(&foursB, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_AVX2_CSA_(&eightsB, &fours, fours, foursA, foursB);
+            stlsoft_C_count_functions_AVX2_CSA_(&sixteens, &eights, eights, eightsA, eightsB);
+
+            total = _mm256_add_epi64(total, stlsoft_C_count_functions_AVX2_256_(sixteens));
+        }
+
+# undef STLSOFT_C_COUNT_FUNCTIONS_LOAD_
+
+        total = _mm256_slli_epi64(total, 4);
+        total = _mm256_add_epi64(total, _mm256_slli_epi64(stlsoft_C_count_functions_AVX2_256_(eights), 3));
+        total = _mm256_add_epi64(total, _mm256_slli_epi64(stlsoft_C_count_functions_AVX2_256_(fours), 2));
+        total = _mm256_add_epi64(total, _mm256_slli_epi64(stlsoft_C_count_functions_AVX2_256_(twos), 1));
+        total = _mm256_add_epi64(total, stlsoft_C_count_functions_AVX2_256_(ones));
+
+        for (; i != n; ++i)
+        {
+            total = _mm256_add_epi64(total, stlsoft_C_count_functions_AVX2_256_(_mm256_loadu_si256(p + i)));
+        }
+
+        _mm256_storeu_si256(STLSOFT_REINTERPRET_CAST(__m256i*, &lanes[0]), total);
+
+        return STLSOFT_STATIC_CAST(size_t, lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+#elif defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT) && \
+      !defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+
+    /* Counts the bits in each 64-bit lane, by bit-parallel addition */
+    STLSOFT_INLINE
+    __m128i
+    stlsoft_C_count_functions_SSE2_128_(
+        __m128i v
+    )
+    {
+        __m128i const   m1  =   _mm_set1_epi8(0x55);
+        __m128i const   m2  =   _mm_set1_epi8(0x33);
+        __m128i const   m4  =   _mm_set1_epi8(0x0f);
+
+        v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+        v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+        v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+
+        return _mm_sad_epu8(v, _mm_setzero_si128());
+    }
+
+    /* Carry-save adder: (*h, *l) = a + b + c */
+    STLSOFT_INLINE
+    void
+    stlsoft_C_count_functions_SSE2_CSA_(
+        __m128i*    h
+    ,   __m128i*    l
+    ,   __m128i     a
+    ,   __m128i     b
+    ,   __m128i     c
+    )
+    {
+        __m128i const u = _mm_xor_si128(a, b);
+
+        *h = _mm_or_si128(_mm_and_si128(a, b), _mm_and_si128(u, c));
+        *l = _mm_xor_si128(u, c);
+    }
+
+    /* Counts the bits in the n 128-bit blocks at p, by the Harley-Seal
+     * method, which needs only one population count per 8 blocks */
+    STLSOFT_INLINE
+    size_t
+    stlsoft_C_count_functions_Harley_Seal_SSE2_(
+        __m128i const*  p
+    ,   size_t          n
+    )
+    {
+        __m128i     total   =   _mm_setzero_si128();
+        __m128i     ones    =   _mm_setzero_si128();
+        __m128i     twos    =   _mm_setzero_si128();
+        __m128i     fours   =   _mm_setzero_si128();
+        __m128i     eights;
+        __m128i     twosA;
+        __m128i     twosB;
+        __m128i     foursA;
+        __m128i     foursB;
+        size_t      i       =   0;
+        ss_uint64_t lanes[2];
+
+        for (; i + 8 <= n; i += 8)
+        {
+            stlsoft_C_count_functions_SSE2_CSA_(&twosA, &ones, ones, _mm_loadu_si128(p + i + 0), _mm_loadu_si128(p + i + 1));
+            stlsoft_C_count_functions_SSE2_CSA_(&twosB, &ones, ones, _mm_loadu_si128(p + i + 2), _mm_loadu_si128(p + i + 3));
+            stlsoft_C_count_functions_SSE2_CSA_(&foursA, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_SSE2_CSA_(&twosA, &ones, ones, _mm_loadu_si128(p + i + 4), _mm_loadu_si128(p + i + 5));
+            stlsoft_C_count_functions_SSE2_CSA_(&twosB, &ones, ones, _mm_loadu_si128(p + i + 6), _mm_loadu_si128(p + i + 7));
+            stlsoft_C_count_functions_SSE2_CSA_(&foursB, &twos, twos, twosA, twosB);
+            stlsoft_C_count_functions_SSE2_CSA_(&eights, &fours, fours, foursA, foursB);
+
+            total = _mm_add_epi64(total, stlsoft_C_count_functions_SSE2_128_(eights));
+        }
+
+        total = _mm_slli_epi64(total, 3);
+        total = _mm_add_epi64(total, _mm_slli_epi64(stlsoft_C_count_functions_SSE2_128_(fours), 2));
+        total = _mm_add_epi64(total, _mm_slli_epi64(stlsoft_C_count_functions_SSE2_128_(twos), 1));
+        total = _mm_add_epi64(total, stlsoft_C_count_functions_SSE2_128_(ones));
+
+        for (; i != n; ++i)
+        {
+            total = _mm_add_epi64(total, stlsoft_C_count_functions_SSE2_128_(_mm_loadu_si128(p + i)));
+        }
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, &lanes[0]), total);
+
+        return STLSOFT_STATIC_CAST(size_t, lanes[0] + lanes[1]);
+    }
+#endif /* SIMD */
+
 # ifdef __cplusplus
 } /* namespace ximpl_bit_functions */
 # endif /* __cplusplus */
@@ -464,6 +707,114 @@ stlsoft_C_count_bits_in_64bit_unsigned_integer_by_8bit_table(
     return n_high + n_low;
 }
 
+#if defined(STLSOFT_BIT_COUNT_BY_intrinsic) || \
+    defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+
+/** Counts the number of bits in a 32-bit unsigned integer, using the
+ * compiler's population-count intrinsic.
+ *
+ * \param v The number whose bits are to be counted
+ *
+ * \return The number of bits in \c v
+ *
+ * \note Only defined when <code>STLSOFT_BIT_COUNT_BY_intrinsic</code> is
+ *   defined
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_count_bits_in_32bit_unsigned_integer_by_intrinsic(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+# if defined(STLSOFT_COMPILER_IS_MSVC)
+
+    return __popcnt(v);
+# else /* ? compiler */
+
+    return STLSOFT_STATIC_CAST(unsigned, __builtin_popcount(v));
+# endif /* compiler */
+}
+
+/** Counts the number of bits in a 64-bit unsigned integer, using the
+ * compiler's population-count intrinsic.
+ *
+ * \param v The number whose bits are to be counted
+ *
+ * \return The number of bits in \c v
+ *
+ * \note Only defined when <code>STLSOFT_BIT_COUNT_BY_intrinsic</code> is
+ *   defined
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_count_bits_in_64bit_unsigned_integer_by_intrinsic(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+# if defined(STLSOFT_COMPILER_IS_MSVC)
+
+    return STLSOFT_STATIC_CAST(unsigned, __popcnt64(v));
+# else /* ? compiler */
+
+    return STLSOFT_STATIC_CAST(unsigned, __builtin_popcountll(v));
+# endif /* compiler */
+}
+#endif /* STLSOFT_BIT_COUNT_BY_intrinsic */
+
+/** Counts the number of bits in a range of 64-bit unsigned integers.
+ *
+ * \param p Pointer to the first of the integers
+ * \param n The number of integers
+ *
+ * \return The total number of bits in <code>[p, p + n)</code>
+ *
+ * \note The count is carried out by the Harley-Seal method, over
+ *   256-bit blocks with AVX2 (or 128-bit blocks with SSE2, where the
+ *   population-count intrinsic is not available), or else per integer by
+ *   the intrinsic or by bit-parallel addition
+ */
+STLSOFT_INLINE
+size_t
+stlsoft_C_count_bits_over_64bit_unsigned_range(
+    ss_uint64_t const*  p
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    size_t  r   =   0;
+    size_t  i   =   0;
+
+#ifdef __cplusplus
+    using namespace ximpl_bit_functions;
+#endif /* __cplusplus */
+
+    STLSOFT_COVER_MARK_LINE();
+
+#if 0
+#elif defined(STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT)
+
+    r += stlsoft_C_count_functions_Harley_Seal_AVX2_(STLSOFT_REINTERPRET_CAST(__m256i const*, p), n / 4);
+    i += (n / 4) * 4;
+#elif defined(STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT) && \
+      !defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+
+    r += stlsoft_C_count_functions_Harley_Seal_SSE2_(STLSOFT_REINTERPRET_CAST(__m128i const*, p), n / 2);
+    i += (n / 2) * 2;
+#endif /* SIMD */
+
+    for (; i != n; ++i)
+    {
+#if defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+
+        r += stlsoft_C_count_bits_in_64bit_unsigned_integer_by_intrinsic(p[i]);
+#else /* ? STLSOFT_BIT_COUNT_BY_intrinsic */
+
+        r += stlsoft_C_count_functions_SWAR_64_(p[i]);
+#endif /* STLSOFT_BIT_COUNT_BY_intrinsic */
+    }
+
+    return r;
+}
+
 /* /////////////////////////////////////////////////////////////////////////
  * C++
  */
@@ -523,6 +874,36 @@ count_bits_by_8bit_table(
 }
 
 
+# if defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+
+/**
+ *
+ * \see stlsoft_C_count_bits_in_32bit_unsigned_integer_by_intrinsic
+ */
+inline
+unsigned
+count_bits_by_intrinsic(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_count_bits_in_32bit_unsigned_integer_by_intrinsic(v);
+}
+
+/**
+ *
+ * \see stlsoft_C_count_bits_in_64bit_unsigned_integer_by_intrinsic
+ */
+inline
+unsigned
+count_bits_by_intrinsic(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_count_bits_in_64bit_unsigned_integer_by_intrinsic(v);
+}
+# endif /* STLSOFT_BIT_COUNT_BY_intrinsic */
+
+
 /** Counts the number of bits in a 32-bit unsigned integer
  *
  * \param v The number whose bits are to be counted
@@ -535,8 +916,11 @@ count_bits(
     ss_uint32_t v
 ) STLSOFT_NOEXCEPT
 {
-# if defined(STLSOFT_BIT_COUNT_BY_Kernighan)
-    return count_bits_by_Kernighan(v);
+# if 0
+# elif defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+    return count_bits_by_intrinsic(v);
+# elif defined(STLSOFT_BIT_COUNT_BY_Kernighan)
+    return count_bits_by_Kernighan_method(v);
 # else
     return count_bits_by_8bit_table(v);
 # endif
@@ -554,13 +938,30 @@ count_bits(
     ss_uint64_t v
 ) STLSOFT_NOEXCEPT
 {
-# if defined(STLSOFT_BIT_COUNT_BY_Kernighan)
-    return count_bits_by_Kernighan(v);
+# if 0
+# elif defined(STLSOFT_BIT_COUNT_BY_intrinsic)
+    return count_bits_by_intrinsic(v);
+# elif defined(STLSOFT_BIT_COUNT_BY_Kernighan)
+    return count_bits_by_Kernighan_method(v);
 # else
     return count_bits_by_8bit_table(v);
 # endif
 }
 
+/**
+ *
+ * \see stlsoft_C_count_bits_over_64bit_unsigned_range
+ */
+inline
+size_t
+count_bits_over_range(
+    ss_uint64_t const*  p
+,   size_t              n
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_count_bits_over_64bit_unsigned_range(p, n);
+}
+
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 
@@ -4,11 +4,11 @@
  * Purpose:     Bit test functions
  *
  * Created:     2nd June 2010
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2010-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -45,6 +45,11 @@
  *
  * \brief [C++] Functions to test bits
  *   (\ref group__library__Utility "Utility" Library).
+ *
+ * Where the compiler provides bit-scan intrinsics
+ * (<code>STLSOFT_BIT_TEST_BY_intrinsic</code>), they are used in place of
+ * shifting; defining <code>STLSOFT_BIT_TEST_BY_shifting</code> suppresses
+ * their use.
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS
@@ -52,9 +57,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MAJOR       1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MINOR       0
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_REVISION    3
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_EDIT        11
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_MINOR       1
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_REVISION    1
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_TEST_FUNCTIONS_EDIT        12
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -75,6 +80,28 @@
 # include <stlsoft/quality/cover.h>
 #endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility
+ */
+
+#if 0
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) || \
+      defined(STLSOFT_BIT_TEST_BY_shifting)
+#elif defined(STLSOFT_COMPILER_IS_CLANG) || \
+      defined(STLSOFT_COMPILER_IS_GCC) || \
+      defined(STLSOFT_COMPILER_IS_MSVC)
+
+# define STLSOFT_BIT_TEST_BY_intrinsic
+#endif
+
+#if defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+    defined(STLSOFT_COMPILER_IS_MSVC)
+# ifndef STLSOFT_INCL_H_INTRIN
+#  define STLSOFT_INCL_H_INTRIN
+#  include <intrin.h>
+# endif /* !STLSOFT_INCL_H_INTRIN */
+#endif
+
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
  */
@@ -93,18 +120,30 @@ namespace stlsoft
  *
  * \retval 0 no bits are found
  */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT;
+
 STLSOFT_INLINE
 unsigned
 stlsoft_C_find_highest_bit_in_8bit_unsigned_integer(
     ss_uint8_t v
 ) STLSOFT_NOEXCEPT
 {
+#if defined(STLSOFT_BIT_TEST_BY_intrinsic)
+
+    return stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(v);
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
     unsigned c;
 
     for (c = 0; 0 != v; ++c, v >>= 1)
     {}
 
     return c;
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
 }
 
 /** Find the 1-based index of the highest non-zero bit in a 16-bit unsigned
@@ -118,6 +157,11 @@ stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(
     ss_uint16_t v
 ) STLSOFT_NOEXCEPT
 {
+#if defined(STLSOFT_BIT_TEST_BY_intrinsic)
+
+    return stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(v);
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
     unsigned const r_high = stlsoft_C_find_highest_bit_in_8bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint8_t, v >> 8));
 
     if (0 != r_high)
@@ -126,6 +170,7 @@ stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(
     }
 
     return stlsoft_C_find_highest_bit_in_8bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint8_t, v));
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
 }
 
 /** Find the 1-based index of the highest non-zero bit in a 32-bit unsigned
@@ -139,6 +184,18 @@ stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(
     ss_uint32_t v
 ) STLSOFT_NOEXCEPT
 {
+#if 0
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      defined(STLSOFT_COMPILER_IS_MSVC)
+
+    unsigned long index;
+
+    return _BitScanReverse(&index, v) ? STLSOFT_STATIC_CAST(unsigned, index) + 1u : 0u;
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic)
+
+    return (0 == v) ? 0u : 32u - STLSOFT_STATIC_CAST(unsigned, __builtin_clz(v));
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
     unsigned const r_high = stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint16_t, v >> 16));
 
     if (0 != r_high)
@@ -147,6 +204,7 @@ stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(
     }
 
     return stlsoft_C_find_highest_bit_in_16bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint16_t, v));
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
 }
 
 /** Find the 1-based index of the highest non-zero bit in a 64-bit unsigned
@@ -160,6 +218,20 @@ stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(
     ss_uint64_t v
 ) STLSOFT_NOEXCEPT
 {
+#if 0
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      defined(STLSOFT_COMPILER_IS_MSVC) && \
+      defined(_M_X64)
+
+    unsigned long index;
+
+    return _BitScanReverse64(&index, v) ? STLSOFT_STATIC_CAST(unsigned, index) + 1u : 0u;
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      !defined(STLSOFT_COMPILER_IS_MSVC)
+
+    return (0 == v) ? 0u : 64u - STLSOFT_STATIC_CAST(unsigned, __builtin_clzll(v));
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
     unsigned const r_high = stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v >> 32));
 
     if (0 != r_high)
@@ -168,6 +240,84 @@ stlsoft_C_find_highest_bit_in_64bit_unsigned_integer(
     }
 
     return stlsoft_C_find_highest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v));
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
+}
+
+/** Find the 1-based index of the lowest non-zero bit in a 32-bit unsigned
+ * integer
+ *
+ * \retval 0 no bits are found
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_find_lowest_bit_in_32bit_unsigned_integer(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+#if 0
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      defined(STLSOFT_COMPILER_IS_MSVC)
+
+    unsigned long index;
+
+    return _BitScanForward(&index, v) ? STLSOFT_STATIC_CAST(unsigned, index) + 1u : 0u;
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic)
+
+    return (0 == v) ? 0u : 1u + STLSOFT_STATIC_CAST(unsigned, __builtin_ctz(v));
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
+    unsigned c;
+
+    if (0 == v)
+    {
+        return 0;
+    }
+
+    for (c = 1; 0 == (v & 1u); ++c, v >>= 1)
+    {}
+
+    return c;
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
+}
+
+/** Find the 1-based index of the lowest non-zero bit in a 64-bit unsigned
+ * integer
+ *
+ * \retval 0 no bits are found
+ */
+STLSOFT_INLINE
+unsigned
+stlsoft_C_find_lowest_bit_in_64bit_unsigned_integer(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+#if 0
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      defined(STLSOFT_COMPILER_IS_MSVC) && \
+      defined(_M_X64)
+
+    unsigned long index;
+
+    return _BitScanForward64(&index, v) ? STLSOFT_STATIC_CAST(unsigned, index) + 1u : 0u;
+#elif defined(STLSOFT_BIT_TEST_BY_intrinsic) && \
+      !defined(STLSOFT_COMPILER_IS_MSVC)
+
+    return (0 == v) ? 0u : 1u + STLSOFT_STATIC_CAST(unsigned, __builtin_ctzll(v));
+#else /* ? STLSOFT_BIT_TEST_BY_intrinsic */
+
+    unsigned const r_low = stlsoft_C_find_lowest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v));
+
+    if (0 != r_low)
+    {
+        return r_low;
+    }
+
+    {
+        unsigned const r_high = stlsoft_C_find_lowest_bit_in_32bit_unsigned_integer(STLSOFT_STATIC_CAST(ss_uint32_t, v >> 32));
+
+        return (0 != r_high) ? r_high + 32u : 0u;
+    }
+#endif /* STLSOFT_BIT_TEST_BY_intrinsic */
 }
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -228,6 +378,32 @@ find_highest_bit(
     return stlsoft_C_find_highest_bit_in_8bit_unsigned_integer(v);
 }
 
+/**
+ *
+ * \see stlsoft_C_find_lowest_bit_in_64bit_unsigned_integer
+ */
+inline
+unsigned
+find_lowest_bit(
+    ss_uint64_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_find_lowest_bit_in_64bit_unsigned_integer(v);
+}
+
+/**
+ *
+ * \see stlsoft_C_find_lowest_bit_in_32bit_unsigned_integer
+ */
+inline
+unsigned
+find_lowest_bit(
+    ss_uint32_t v
+) STLSOFT_NOEXCEPT
+{
+    return stlsoft_C_find_lowest_bit_in_32bit_unsigned_integer(v);
+}
+
 
 #endif /* __cplusplus */
 
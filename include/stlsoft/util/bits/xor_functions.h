@@ -4,11 +4,11 @@
  * Purpose:     Bit XOR functions
  *
  * Created:     2nd June 2010
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2010-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -45,6 +45,9 @@
  *
  * \brief [C++] Functions to calculate XOR
  *   (\ref group__library__Utility "Utility" Library).
+ *
+ * Where SSE2 (or AVX2) is available, the ranges are accumulated in 128-bit
+ * (or 256-bit) blocks, which are then folded down to the element width.
  */
 
 #ifndef STLSOFT_INCL_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS
@@ -52,9 +55,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_MAJOR    1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_MINOR    2
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_MINOR    3
 # define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_REVISION 1
-# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_EDIT     13
+# define STLSOFT_VER_STLSOFT_UTIL_BITS_H_XOR_FUNCTIONS_EDIT     14
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -74,6 +77,9 @@
 #ifndef STLSOFT_INCL_STLSOFT_QUALITY_H_COVER
 # include <stlsoft/quality/cover.h>
 #endif /* !STLSOFT_INCL_STLSOFT_QUALITY_H_COVER */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_simd
+# include <stlsoft/api/internal/simd.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_simd */
 
 /* /////////////////////////////////////////////////////////////////////////
  * namespace
@@ -84,6 +90,68 @@ namespace stlsoft
 {
 #endif /* STLSOFT_NO_NAMESPACE */
 
+/* /////////////////////////////////////////////////////////////////////////
+ * implementation
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+#  ifdef __cplusplus
+namespace ximpl_bit_functions
+{
+#  endif /* __cplusplus */
+
+    /* Accumulates the XOR of the whole 16-byte blocks in [p, p + cb),
+     * folded into 64 bits, and returns the number of bytes consumed
+     * through *pcb. Since each element type divides 16 exactly, the
+     * result may be folded further down to the element width.
+     */
+    static
+    ss_uint64_t
+    stlsoft_C_xor_functions_SIMD_64_(
+        void const* p
+    ,   size_t      cb
+    ,   size_t*     pcb
+    ) STLSOFT_NOEXCEPT
+    {
+        ss_byte_t const*    b       =   STLSOFT_STATIC_CAST(ss_byte_t const*, p);
+        size_t              i       =   0;
+        __m128i             acc     =   _mm_setzero_si128();
+        ss_uint64_t         lanes[2];
+
+#  ifdef STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT
+
+        if (cb >= 32)
+        {
+            __m256i acc256 = _mm256_setzero_si256();
+
+            for (; i + 32 <= cb; i += 32)
+            {
+                acc256 = _mm256_xor_si256(acc256, _mm256_loadu_si256(STLSOFT_REINTERPRET_CAST(__m256i const*, b + i)));
+            }
+
+            acc = _mm_xor_si128(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+        }
+#  endif /* STLSOFT_API_INTERNAL_SIMD_AVX2_SUPPORT */
+
+        for (; i + 16 <= cb; i += 16)
+        {
+            acc = _mm_xor_si128(acc, _mm_loadu_si128(STLSOFT_REINTERPRET_CAST(__m128i const*, b + i)));
+        }
+
+        _mm_storeu_si128(STLSOFT_REINTERPRET_CAST(__m128i*, &lanes[0]), acc);
+
+        *pcb = i;
+
+        return lanes[0] ^ lanes[1];
+    }
+
+#  ifdef __cplusplus
+} /* namespace ximpl_bit_functions */
+#  endif /* __cplusplus */
+# endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
 /* /////////////////////////////////////////////////////////////////////////
  * functions
  */
@@ -101,6 +169,23 @@ stlsoft_C_calculate_xor_over_64bit_unsigned_range(
 
     STLSOFT_COVER_MARK_LINE();
 
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    {
+# ifdef __cplusplus
+        using namespace ximpl_bit_functions;
+# endif /* __cplusplus */
+
+        size_t      cb;
+        ss_uint64_t v   =   stlsoft_C_xor_functions_SIMD_64_(p, n * sizeof(*p), &cb);
+
+        r = v;
+
+        p += cb / sizeof(*p);
+        n -= cb / sizeof(*p);
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
     { for (; 0u != n; ++p, --n)
     {
         STLSOFT_COVER_MARK_LINE();
@@ -126,6 +211,23 @@ stlsoft_C_calculate_xor_over_32bit_unsigned_range(
 
     STLSOFT_COVER_MARK_LINE();
 
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    {
+# ifdef __cplusplus
+        using namespace ximpl_bit_functions;
+# endif /* __cplusplus */
+
+        size_t      cb;
+        ss_uint64_t v   =   stlsoft_C_xor_functions_SIMD_64_(p, n * sizeof(*p), &cb);
+
+        r = STLSOFT_STATIC_CAST(ss_uint32_t, v ^ (v >> 32));
+
+        p += cb / sizeof(*p);
+        n -= cb / sizeof(*p);
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
     { for (; 0u != n; ++p, --n)
     {
         STLSOFT_COVER_MARK_LINE();
@@ -151,6 +253,26 @@ stlsoft_C_calculate_xor_over_16bit_unsigned_range(
 
     STLSOFT_COVER_MARK_LINE();
 
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    {
+# ifdef __cplusplus
+        using namespace ximpl_bit_functions;
+# endif /* __cplusplus */
+
+        size_t      cb;
+        ss_uint64_t v   =   stlsoft_C_xor_functions_SIMD_64_(p, n * sizeof(*p), &cb);
+
+        v ^= v >> 32;
+        v ^= v >> 16;
+
+        r = STLSOFT_STATIC_CAST(ss_uint16_t, v);
+
+        p += cb / sizeof(*p);
+        n -= cb / sizeof(*p);
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
     { for (; 0u != n; ++p, --n)
     {
         STLSOFT_COVER_MARK_LINE();
@@ -176,6 +298,27 @@ stlsoft_C_calculate_xor_over_8bit_unsigned_range(
 
     STLSOFT_COVER_MARK_LINE();
 
+#ifdef STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT
+
+    {
+# ifdef __cplusplus
+        using namespace ximpl_bit_functions;
+# endif /* __cplusplus */
+
+        size_t      cb;
+        ss_uint64_t v   =   stlsoft_C_xor_functions_SIMD_64_(p, n * sizeof(*p), &cb);
+
+        v ^= v >> 32;
+        v ^= v >> 16;
+        v ^= v >> 8;
+
+        r = STLSOFT_STATIC_CAST(ss_uint8_t, v);
+
+        p += cb / sizeof(*p);
+        n -= cb / sizeof(*p);
+    }
+#endif /* STLSOFT_API_INTERNAL_SIMD_SSE2_SUPPORT */
+
     { for (; 0u != n; ++p, --n)
     {
         STLSOFT_COVER_MARK_LINE();
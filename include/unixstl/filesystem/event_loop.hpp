@@ -0,0 +1,1059 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/filesystem/event_loop.hpp
+ *
+ * Purpose:     event_loop class, a readiness multiplexer for file descriptors.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/filesystem/event_loop.hpp
+ *
+ * \brief [C++] Definition of the unixstl::event_loop class
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP_REVISION 2
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP_EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES
+# include <unixstl/exception/throw_policies.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES */
+
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_FCNTL
+# define STLSOFT_INCL_H_FCNTL
+# include <fcntl.h>
+#endif /* !STLSOFT_INCL_H_FCNTL */
+#ifndef STLSOFT_INCL_H_POLL
+# define STLSOFT_INCL_H_POLL
+# include <poll.h>
+#endif /* !STLSOFT_INCL_H_POLL */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+
+#if defined(UNIXSTL_OS_IS_LINUX)
+# define UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+# ifndef STLSOFT_INCL_SYS_H_EPOLL
+#  define STLSOFT_INCL_SYS_H_EPOLL
+#  include <sys/epoll.h>
+# endif /* !STLSOFT_INCL_SYS_H_EPOLL */
+# ifndef STLSOFT_INCL_SYS_H_EVENTFD
+#  define STLSOFT_INCL_SYS_H_EVENTFD
+#  include <sys/eventfd.h>
+# endif /* !STLSOFT_INCL_SYS_H_EVENTFD */
+# ifndef STLSOFT_INCL_SYS_H_TIMERFD
+#  define STLSOFT_INCL_SYS_H_TIMERFD
+#  include <sys/timerfd.h>
+# endif /* !STLSOFT_INCL_SYS_H_TIMERFD */
+#endif /* UNIXSTL_OS_IS_LINUX */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Notifies the readiness of any number of file descriptors, and the
+ * expiry of timers, returning many events from each system call.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * On Linux the loop uses <code>epoll</code>, unless constructed with
+ * event_loop::usePoll; elsewhere it uses <code>poll()</code>, for which:
+ *
+ * - edge-triggered registrations are reported as if level-triggered
+ *   (which is safe for callers that, as they must for edge-triggered
+ *   notification, read until <code>EAGAIN</code>);
+ * - the cost of each call to wait() is proportional to the number of
+ *   registered descriptors, rather than to the number that are ready.
+ *
+ * Timers are provided by <code>timerfd</code>, and so only on Linux
+ * (with either mechanism). A call to wake(), from any thread, interrupts
+ * a wait() in progress (or the next one), using <code>eventfd</code> on
+ * Linux and a non-blocking pipe elsewhere.
+ *
+ * \code
+  unixstl::event_loop           loop;
+  unixstl::event_loop::event_type events[64];
+
+  loop.add(p.read_handle(), unixstl::event_loop::readable);
+  loop.add_timer(1000, 1000);
+
+  for (;;)
+  {
+    size_t const n = loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events));
+
+    for (size_t i = 0; i != n; ++i)
+    {
+      if (events[i].events & unixstl::event_loop::timerExpired)
+      {
+        . . . // once a second
+      }
+      else if (events[i].events & unixstl::event_loop::readable)
+      {
+        . . . // read from events[i].fd
+      }
+    }
+  }
+ * \endcode
+ *
+ * \note With the exception of wake(), the methods are not thread-safe.
+ *   The loop does not own the registered descriptors, which must be
+ *   removed before they are closed.
+ */
+class event_loop
+{
+/// \name Member Types
+/// @{
+public:
+    /// This type
+    typedef event_loop                      class_type;
+    /// The exception policy type
+    typedef unix_exception_policy           exception_policy_type;
+    /// The size type
+    typedef us_size_t                       size_type;
+    /// The type of the events returned by wait()
+    struct event_type
+    {
+        /// The descriptor, or the identifier of the timer, or -1 for a
+        /// wake-up
+        int         fd;
+        /// A combination of readable, writable, hangup, error,
+        /// timerExpired, and woken
+        unsigned    events;
+        /// The cookie given on registration
+        void*       cookie;
+    };
+private:
+    enum registration_kind_
+    {
+        kindNone_
+    ,   kindDescriptor_
+    ,   kindTimer_
+    ,   kindWake_
+    };
+    struct registration_
+    {
+        registration_kind_  kind;
+        unsigned            interest;
+        void*               cookie;
+        size_type           pollIndex;
+
+        registration_()
+            : kind(kindNone_)
+            , interest(0)
+            , cookie(NULL)
+            , pollIndex(0)
+        {}
+    };
+    typedef std::vector<registration_>      registrations_type_;
+    typedef std::vector<struct pollfd>      pollfds_type_;
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+    typedef std::vector<struct epoll_event> epoll_events_type_;
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        /// Constructor flag: use <code>poll()</code> even where
+        /// <code>epoll</code> is available
+        usePoll         =   0x0001
+    };
+    enum
+    {
+        /// Interest / event: the descriptor is readable
+        readable        =   0x0001
+        /// Interest / event: the descriptor is writable
+    ,   writable        =   0x0002
+        /// Event: the peer has closed the descriptor
+    ,   hangup          =   0x0004
+        /// Event: an error is pending on the descriptor
+    ,   error           =   0x0008
+        /// Event: a timer has expired
+    ,   timerExpired    =   0x0010
+        /// Event: wake() was called
+    ,   woken           =   0x0020
+        /// Interest: report only changes in readiness
+    ,   edgeTriggered   =   0x0100
+        /// Interest: report the descriptor once, after which it must be
+        /// rearmed with modify()
+    ,   oneShot         =   0x0200
+    };
+    enum
+    {
+        /// The number of events dispatched by each call to dispatch()
+        defaultBatchSize    =   256
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Constructs an instance
+    ///
+    /// \param flags 0, or usePoll
+    ///
+    /// \exception unixstl::unixstl_exception Thrown if the loop cannot be
+    ///   created
+    explicit
+    event_loop(int flags = 0)
+        : m_epfd(-1)
+        , m_wakeRead(-1)
+        , m_wakeWrite(-1)
+        , m_numRegistered(0)
+        , m_pollNext(0)
+        , m_pollError(0)
+    {
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+
+        if (0 == (usePoll & flags))
+        {
+            m_epfd = ::epoll_create1(EPOLL_CLOEXEC);
+
+            if (m_epfd < 0)
+            {
+                exception_policy_type()(errno);
+
+                return;
+            }
+        }
+
+        m_wakeRead = m_wakeWrite = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        if (m_wakeRead < 0)
+        {
+            int const e = errno;
+
+            close_();
+
+            exception_policy_type()(e);
+
+            return;
+        }
+#else /* ? UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+        STLSOFT_SUPPRESS_UNUSED(flags);
+
+        int fds[2];
+
+        if (0 != ::pipe(&fds[0]))
+        {
+            exception_policy_type()(errno);
+
+            return;
+        }
+
+        m_wakeRead  =   fds[0];
+        m_wakeWrite =   fds[1];
+
+        { for (int i = 0; i != 2; ++i)
+        {
+            ::fcntl(fds[i], F_SETFL, ::fcntl(fds[i], F_GETFL) | O_NONBLOCK);
+            ::fcntl(fds[i], F_SETFD, ::fcntl(fds[i], F_GETFD) | FD_CLOEXEC);
+        }}
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+        int const e = register_(m_wakeRead, kindWake_, readable, NULL);
+
+        if (0 != e)
+        {
+            close_();
+
+            exception_policy_type()(e);
+        }
+    }
+    /// Closes the loop, and all timers
+    ~event_loop() STLSOFT_NOEXCEPT
+    {
+        close_();
+    }
+private:
+    event_loop(class_type const&);          // copy-construction proscribed
+    void operator =(class_type const&);     // copy-assignment proscribed
+/// @}
+
+/// \name Registration
+/// @{
+public:
+    /// Registers a descriptor
+    ///
+    /// \param fd The descriptor
+    /// \param interest A combination of readable and/or writable, and,
+    ///   optionally, edgeTriggered and/or oneShot
+    /// \param cookie A value returned with each event for the descriptor
+    ///
+    /// \exception unixstl::unixstl_exception Thrown if the descriptor
+    ///   cannot be registered, including if it is already registered
+    ///   (<code>EEXIST</code>)
+    void add(int fd, unsigned interest, void* cookie = NULL)
+    {
+        int const e = register_(fd, kindDescriptor_, interest, cookie);
+
+        if (0 != e)
+        {
+            exception_policy_type()(e);
+        }
+    }
+    /// Changes the interest and cookie of a registered descriptor,
+    /// rearming it if registered as oneShot
+    void modify(int fd, unsigned interest, void* cookie = NULL)
+    {
+        registration_* const reg = find_(fd, kindDescriptor_);
+
+        if (NULL == reg)
+        {
+            exception_policy_type()(ENOENT);
+
+            return;
+        }
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+        if (-1 != m_epfd)
+        {
+            struct epoll_event ev = make_epoll_event_(fd, interest);
+
+            if (0 != ::epoll_ctl(m_epfd, EPOLL_CTL_MOD, fd, &ev))
+            {
+                exception_policy_type()(errno);
+
+                return;
+            }
+        }
+        else
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+        {
+            struct pollfd& pfd = m_pollfds[reg->pollIndex];
+
+            pfd.fd      =   fd;
+            pfd.events  =   make_poll_events_(interest);
+        }
+
+        reg->interest   =   interest;
+        reg->cookie     =   cookie;
+    }
+    /// Removes a registered descriptor
+    ///
+    /// \note Events for the descriptor already returned by wait() remain
+    ///   in the caller's array
+    void remove(int fd)
+    {
+        int const e = unregister_(fd, kindDescriptor_);
+
+        if (0 != e)
+        {
+            exception_policy_type()(e);
+        }
+    }
+
+    /// Creates a timer, returning its identifier
+    ///
+    /// \param initialMs The time, in milliseconds, until the first
+    ///   expiry; must be non-zero
+    /// \param intervalMs The interval, in milliseconds, of subsequent
+    ///   expiries; 0 for a single expiry
+    /// \param cookie A value returned with each event for the timer
+    ///
+    /// \exception unixstl::unixstl_exception Thrown if the timer cannot be
+    ///   created, including on systems without <code>timerfd</code>
+    ///   (<code>ENOSYS</code>)
+    int add_timer(unsigned long initialMs, unsigned long intervalMs, void* cookie = NULL)
+    {
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+
+        int const tfd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+        if (tfd < 0)
+        {
+            exception_policy_type()(errno);
+
+            return -1;
+        }
+
+        struct itimerspec its;
+
+        its.it_value.tv_sec         =   static_cast<time_t>(initialMs / 1000);
+        its.it_value.tv_nsec        =   static_cast<long>(initialMs % 1000) * 1000000;
+        its.it_interval.tv_sec      =   static_cast<time_t>(intervalMs / 1000);
+        its.it_interval.tv_nsec     =   static_cast<long>(intervalMs % 1000) * 1000000;
+
+        int e = 0;
+
+        if (0 != ::timerfd_settime(tfd, 0, &its, NULL))
+        {
+            e = errno;
+        }
+        else
+        {
+            e = register_(tfd, kindTimer_, readable, cookie);
+        }
+
+        if (0 != e)
+        {
+            ::close(tfd);
+
+            exception_policy_type()(e);
+
+            return -1;
+        }
+
+        return tfd;
+#else /* ? UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+        STLSOFT_SUPPRESS_UNUSED(initialMs);
+        STLSOFT_SUPPRESS_UNUSED(intervalMs);
+        STLSOFT_SUPPRESS_UNUSED(cookie);
+
+        exception_policy_type()(ENOSYS);
+
+        return -1;
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+    }
+    /// Cancels and destroys a timer
+    void remove_timer(int id)
+    {
+        int const e = unregister_(id, kindTimer_);
+
+        if (0 != e)
+        {
+            exception_policy_type()(e);
+
+            return;
+        }
+
+        ::close(id);
+    }
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Waits for events, returning up to \c maxEvents of them
+    ///
+    /// \param events The array to receive the events
+    /// \param maxEvents The size of the array
+    /// \param timeoutMs The maximum time, in milliseconds, to wait; -1 to
+    ///   wait indefinitely
+    ///
+    /// \return The number of events, which is 0 if the timeout expired or
+    ///   the wait was interrupted by a signal
+    ///
+    /// \exception unixstl::unixstl_exception Thrown if the wait fails. With
+    ///   <code>poll()</code>, an invalid descriptor found along with other
+    ///   events is reported by the next call, after those events are
+    ///   returned
+    size_type wait(event_type* events, size_type maxEvents, int timeoutMs = -1)
+    {
+        if (0 == maxEvents)
+        {
+            return 0;
+        }
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+        if (-1 != m_epfd)
+        {
+            return wait_epoll_(events, maxEvents, timeoutMs);
+        }
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+        return wait_poll_(events, maxEvents, timeoutMs);
+    }
+
+    /// Waits for events, and invokes \c f with each of them
+    ///
+    /// \param f A function, or function object, that is invoked with each
+    ///   event, as <code>f(event_type const&)</code>
+    /// \param timeoutMs The maximum time, in milliseconds, to wait; -1 to
+    ///   wait indefinitely
+    ///
+    /// \return The number of events dispatched
+    template <ss_typename_param_k F>
+    size_type dispatch(F f, int timeoutMs = -1)
+    {
+        event_type      events[defaultBatchSize];
+        size_type const n = wait(&events[0], STLSOFT_NUM_ELEMENTS(events), timeoutMs);
+
+        { for (size_type i = 0; i != n; ++i)
+        {
+            f(events[i]);
+        }}
+
+        return n;
+    }
+
+    /// Causes a wait() in progress in another thread, or the next one, to
+    /// return a woken event
+    ///
+    /// \note This method may be called from any thread
+    void wake() STLSOFT_NOEXCEPT
+    {
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+        us_uint64_t const   v   =   1;
+#else /* ? UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+        char const          v   =   0;
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+        // If the write fails because the counter, or pipe, is full then a
+        // wake-up is already pending
+        ssize_t const r = ::write(m_wakeWrite, &v, sizeof(v));
+
+        STLSOFT_SUPPRESS_UNUSED(r);
+    }
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// Indicates whether the loop uses <code>epoll</code>
+    bool is_epoll() const STLSOFT_NOEXCEPT
+    {
+        return -1 != m_epfd;
+    }
+    /// The number of registered descriptors and timers
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_numRegistered;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    registration_* find_(int fd, registration_kind_ kind)
+    {
+        if (fd < 0 ||
+            static_cast<size_type>(fd) >= m_registrations.size() ||
+            kind != m_registrations[fd].kind)
+        {
+            return NULL;
+        }
+
+        return &m_registrations[fd];
+    }
+
+    int register_(int fd, registration_kind_ kind, unsigned interest, void* cookie)
+    {
+        if (fd < 0)
+        {
+            return EBADF;
+        }
+        if (static_cast<size_type>(fd) >= m_registrations.size())
+        {
+            m_registrations.resize(static_cast<size_type>(fd) + 1);
+        }
+
+        registration_& reg = m_registrations[fd];
+
+        if (kindNone_ != reg.kind)
+        {
+            return EEXIST;
+        }
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+        if (-1 != m_epfd)
+        {
+            struct epoll_event ev = make_epoll_event_(fd, interest);
+
+            if (0 != ::epoll_ctl(m_epfd, EPOLL_CTL_ADD, fd, &ev))
+            {
+                return errno;
+            }
+        }
+        else
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+        {
+            struct pollfd pfd;
+
+            pfd.fd          =   fd;
+            pfd.events      =   make_poll_events_(interest);
+            pfd.revents     =   0;
+
+            m_pollfds.push_back(pfd);
+
+            reg.pollIndex   =   m_pollfds.size() - 1;
+        }
+
+        reg.kind        =   kind;
+        reg.interest    =   interest;
+        reg.cookie      =   cookie;
+
+        if (kindWake_ != kind)
+        {
+            ++m_numRegistered;
+        }
+
+        return 0;
+    }
+
+    int unregister_(int fd, registration_kind_ kind)
+    {
+        registration_* const reg = find_(fd, kind);
+
+        if (NULL == reg)
+        {
+            return ENOENT;
+        }
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+        if (-1 != m_epfd)
+        {
+            struct epoll_event ev = make_epoll_event_(fd, 0);
+
+            if (0 != ::epoll_ctl(m_epfd, EPOLL_CTL_DEL, fd, &ev))
+            {
+                return errno;
+            }
+        }
+        else
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+        {
+            // Move the last entry into the vacated slot
+            size_type const ix  =   reg->pollIndex;
+            size_type const last=   m_pollfds.size() - 1;
+
+            if (ix != last)
+            {
+                m_pollfds[ix] = m_pollfds[last];
+                m_registrations[poll_fd_(m_pollfds[ix])].pollIndex = ix;
+            }
+
+            m_pollfds.pop_back();
+        }
+
+        *reg = registration_();
+
+        --m_numRegistered;
+
+        return 0;
+    }
+
+    // Translates a readiness notification into an event, returning false
+    // if there is nothing to report
+    bool translate_(int fd, unsigned ready, event_type& ev)
+    {
+        registration_& reg = m_registrations[fd];
+
+        switch (reg.kind)
+        {
+        case kindDescriptor_:
+            ev.fd       =   fd;
+            ev.events   =   ready & (reg.interest | hangup | error);
+            ev.cookie   =   reg.cookie;
+
+            return 0 != ev.events;
+        case kindTimer_:
+            {
+                us_uint64_t expirations;
+
+                if (::read(fd, &expirations, sizeof(expirations)) != static_cast<ssize_t>(sizeof(expirations)))
+                {
+                    return false;
+                }
+            }
+
+            ev.fd       =   fd;
+            ev.events   =   timerExpired;
+            ev.cookie   =   reg.cookie;
+
+            return true;
+        case kindWake_:
+            {
+                char buff[64];
+
+                for (; ::read(fd, &buff[0], sizeof(buff)) > 0; )
+                {}
+            }
+
+            ev.fd       =   -1;
+            ev.events   =   woken;
+            ev.cookie   =   NULL;
+
+            return true;
+        default:
+            // removed since the events were collected
+            return false;
+        }
+    }
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+    static
+    struct epoll_event
+    make_epoll_event_(int fd, unsigned interest)
+    {
+        struct epoll_event ev;
+
+        ev.events   =   0;
+        ev.data.u64 =   0;
+        ev.data.fd  =   fd;
+
+        if (0 != (readable & interest))
+        {
+            ev.events |= EPOLLIN | EPOLLRDHUP;
+        }
+        if (0 != (writable & interest))
+        {
+            ev.events |= EPOLLOUT;
+        }
+        if (0 != (edgeTriggered & interest))
+        {
+            ev.events |= EPOLLET;
+        }
+        if (0 != (oneShot & interest))
+        {
+            ev.events |= EPOLLONESHOT;
+        }
+
+        return ev;
+    }
+
+    size_type wait_epoll_(event_type* events, size_type maxEvents, int timeoutMs)
+    {
+        if (maxEvents > 0x10000)
+        {
+            maxEvents = 0x10000;
+        }
+        if (m_epollEvents.size() < maxEvents)
+        {
+            m_epollEvents.resize(maxEvents);
+        }
+
+        int const r = ::epoll_wait(m_epfd, &m_epollEvents[0], static_cast<int>(maxEvents), timeoutMs);
+
+        if (r < 0)
+        {
+            if (EINTR != errno)
+            {
+                exception_policy_type()(errno);
+            }
+
+            return 0;
+        }
+
+        size_type n = 0;
+
+        { for (int i = 0; i != r; ++i)
+        {
+            unsigned const      e       =   m_epollEvents[i].events;
+            unsigned            ready   =   0;
+
+            if (0 != (EPOLLIN & e))
+            {
+                ready |= readable;
+            }
+            if (0 != (EPOLLOUT & e))
+            {
+                ready |= writable;
+            }
+            if (0 != ((EPOLLHUP | EPOLLRDHUP) & e))
+            {
+                ready |= hangup;
+            }
+            if (0 != (EPOLLERR & e))
+            {
+                ready |= error;
+            }
+
+            if (translate_(m_epollEvents[i].data.fd, ready, events[n]))
+            {
+                ++n;
+            }
+        }}
+
+        return n;
+    }
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+    static
+    short
+    make_poll_events_(unsigned interest)
+    {
+        short events = 0;
+
+        if (0 != (readable & interest))
+        {
+            events |= POLLIN;
+        }
+        if (0 != (writable & interest))
+        {
+            events |= POLLOUT;
+        }
+
+        return events;
+    }
+
+    // The descriptor of an entry, which is stored complemented (and so
+    // ignored by poll()) while a oneShot registration is disarmed
+    static
+    int
+    poll_fd_(struct pollfd const& pfd) STLSOFT_NOEXCEPT
+    {
+        return (pfd.fd < 0) ? ~pfd.fd : pfd.fd;
+    }
+
+    size_type wait_poll_(event_type* events, size_type maxEvents, int timeoutMs)
+    {
+        // Report an error detected, after other events had been
+        // translated, by the previous call
+        if (0 != m_pollError)
+        {
+            int const e = m_pollError;
+
+            m_pollError = 0;
+
+            exception_policy_type()(e);
+
+            return 0;
+        }
+
+        int const r = ::poll(&m_pollfds[0], static_cast<nfds_t>(m_pollfds.size()), timeoutMs);
+
+        if (r < 0)
+        {
+            if (EINTR != errno)
+            {
+                exception_policy_type()(errno);
+            }
+
+            return 0;
+        }
+
+        size_type const num     =   m_pollfds.size();
+        size_type const start   =   m_pollNext;
+        size_type       n       =   0;
+        int             found   =   0;
+
+        // Start after the last descriptor reported by the previous call,
+        // so that none is starved when the array is too small for all
+        { for (size_type k = 0; k != num && found != r && n != maxEvents; ++k)
+        {
+            size_type const ix      =   (start + k) % num;
+            struct pollfd&  pfd     =   m_pollfds[ix];
+            short const     re      =   pfd.revents;
+
+            if (0 == re)
+            {
+                continue;
+            }
+
+            ++found;
+            pfd.revents = 0;
+
+            if (0 != (POLLNVAL & re))
+            {
+                // Since events may already have been translated - and
+                // timer expirations consumed - the error is reported
+                // after them, by the next call
+                m_pollError = EBADF;
+
+                continue;
+            }
+
+            unsigned ready = 0;
+
+            if (0 != (POLLIN & re))
+            {
+                ready |= readable;
+            }
+            if (0 != (POLLOUT & re))
+            {
+                ready |= writable;
+            }
+            if (0 != (POLLHUP & re))
+            {
+                // reported by poll() regardless of interest, and, for
+                // pipes, without POLLIN
+                ready |= hangup | (readable & m_registrations[pfd.fd].interest);
+            }
+            if (0 != (POLLERR & re))
+            {
+                ready |= error;
+            }
+
+            int const fd = pfd.fd;
+
+            // Disarm until rearmed by modify(): clearing events would
+            // not suffice, since POLLHUP and POLLERR are reported
+            // regardless
+            if (0 != (oneShot & m_registrations[fd].interest))
+            {
+                pfd.fd = ~fd;
+            }
+
+            if (translate_(fd, ready, events[n]))
+            {
+                ++n;
+            }
+
+            m_pollNext = ix + 1;
+        }}
+
+        if (0 == n &&
+            0 != m_pollError)
+        {
+            int const e = m_pollError;
+
+            m_pollError = 0;
+
+            exception_policy_type()(e);
+        }
+
+        return n;
+    }
+
+    void close_() STLSOFT_NOEXCEPT
+    {
+        { for (size_type i = 0; i != m_registrations.size(); ++i)
+        {
+            if (kindTimer_ == m_registrations[i].kind)
+            {
+                ::close(static_cast<int>(i));
+            }
+        }}
+
+        if (-1 != m_wakeRead)
+        {
+            ::close(m_wakeRead);
+        }
+        if (-1 != m_wakeWrite &&
+            m_wakeWrite != m_wakeRead)
+        {
+            ::close(m_wakeWrite);
+        }
+        if (-1 != m_epfd)
+        {
+            ::close(m_epfd);
+        }
+
+        m_wakeRead  =   -1;
+        m_wakeWrite =   -1;
+        m_epfd      =   -1;
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    int                 m_epfd;
+    int                 m_wakeRead;
+    int                 m_wakeWrite;
+    registrations_type_ m_registrations;
+    size_type           m_numRegistered;
+    pollfds_type_       m_pollfds;
+    size_type           m_pollNext;
+    int                 m_pollError;
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+    epoll_events_type_  m_epollEvents;
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+/// @}
+};
+
+#ifdef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+# undef UNIXSTL_EVENT_LOOP_HAS_EPOLL_
+#endif /* UNIXSTL_EVENT_LOOP_HAS_EPOLL_ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_EVENT_LOOP */
+
+/* ///////////////////////////// end of file //////////////////////////// */
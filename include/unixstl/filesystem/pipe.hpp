@@ -4,11 +4,11 @@
  * Purpose:     pipe class, based on UNIX pipe.
  *
  * Created:     19th June 2004
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 2004-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -52,9 +52,9 @@
 
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_MAJOR      4
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_MINOR      1
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_REVISION   10
-# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_EDIT       57
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_MINOR      2
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_REVISION   1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_EDIT       58
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -72,6 +72,10 @@
 # include <unixstl/exception/throw_policies.hpp>
 #endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES */
 
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
 #ifndef STLSOFT_INCL_H_FCNTL
 # define STLSOFT_INCL_H_FCNTL
 # include <fcntl.h>
@@ -117,6 +121,13 @@ namespace unixstl_project
 /** Class which wraps the UNIX pipe() function
  *
  * \ingroup group__library__FileSystem
+ *
+ * The ends of the pipe may be created non-blocking and/or close-on-exec,
+ * and, on Linux, the capacity of the pipe may be set (with
+ * <code>F_SETPIPE_SZ</code>).
+ *
+ * \see unixstl::pipe_splice(), unixstl::pipe_tee(), and
+ *   unixstl::pipe_line_reader
  */
 class pipe
 {
@@ -127,6 +138,25 @@ public:
     typedef pipe                    class_type;
     /// The exception policy type
     typedef unix_exception_policy   exception_policy_type;
+    /// The size type
+    typedef us_size_t               size_type;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        /// Both ends are non-blocking (<code>O_NONBLOCK</code>)
+        nonBlocking         =   0x0003
+        /// The read end is non-blocking
+    ,   nonBlockingRead     =   0x0001
+        /// The write end is non-blocking
+    ,   nonBlockingWrite    =   0x0002
+        /// Both ends are closed on <code>exec()</code>
+        /// (<code>O_CLOEXEC</code>)
+    ,   closeOnExec         =   0x0004
+    };
 /// @}
 
 /// \name Construction
@@ -134,19 +164,25 @@ public:
 public:
     pipe()
     {
-#if defined(_WIN32) && \
-    (   defined(_MSC_VER) || \
-        defined(STLSOFT_COMPILER_IS_DMC))
-        if (0 != ::_pipe(&m_handles[0], 10240, _O_TEXT))
-#else /* ? _WIN32 */
-        if (0 != ::pipe(&m_handles[0]))
-#endif /* _WIN32 */
-        {
-            exception_policy_type()(errno);
-
-            m_handles[0] = -1;
-            m_handles[1] = -1;
-        }
+        init_(0, 0);
+    }
+    /// Creates a pipe with the given options
+    ///
+    /// \param flags A combination of nonBlocking, nonBlockingRead,
+    ///   nonBlockingWrite, and closeOnExec
+    /// \param capacity The capacity of the pipe, in bytes. If 0, the
+    ///   system's default is used. Ignored on systems other than Linux
+    ///
+    /// \note Where <code>pipe2()</code> is available, the options are
+    ///   applied atomically with the creation of the pipe; otherwise they
+    ///   are applied with <code>fcntl()</code> immediately afterwards
+    explicit
+    pipe(
+        int         flags
+    ,   size_type   capacity = 0
+    )
+    {
+        init_(flags, capacity);
     }
 
     ~pipe() STLSOFT_NOEXCEPT
@@ -174,6 +210,27 @@ public:
     {
         return m_handles[1];
     }
+
+    /// The capacity of the pipe, in bytes, or 0 if it cannot be
+    /// determined
+    size_type capacity() const
+    {
+#if defined(F_GETPIPE_SZ)
+        int const r = ::fcntl(either_handle_(), F_GETPIPE_SZ);
+
+        if (r < 0)
+        {
+            exception_policy_type()(errno);
+
+            return 0;
+        }
+
+        return static_cast<size_type>(r);
+#else /* ? F_GETPIPE_SZ */
+
+        return 0;
+#endif /* F_GETPIPE_SZ */
+    }
 /// @}
 
 /// \name Operations
@@ -203,11 +260,178 @@ public:
         close_read();
         close_write();
     }
+
+    /// Sets the capacity of the pipe, which the system may round up
+    ///
+    /// \return The resulting capacity, or 0 on systems where the
+    ///   capacity cannot be set
+    ///
+    /// \note Unprivileged processes cannot exceed the system limit
+    ///   (<code>/proc/sys/fs/pipe-max-size</code>), nor reduce the
+    ///   capacity below the data currently in the pipe
+    size_type set_capacity(size_type capacity)
+    {
+#if defined(F_SETPIPE_SZ)
+        int const r = ::fcntl(either_handle_(), F_SETPIPE_SZ, static_cast<int>(capacity));
+
+        if (r < 0)
+        {
+            exception_policy_type()(errno);
+
+            return 0;
+        }
+
+        return static_cast<size_type>(r);
+#else /* ? F_SETPIPE_SZ */
+
+        STLSOFT_SUPPRESS_UNUSED(capacity);
+
+        return 0;
+#endif /* F_SETPIPE_SZ */
+    }
 /// @}
 
 /// \name Implementation
 /// @{
 private:
+    // Either end refers to the same pipe, so its capacity may be obtained
+    // after one end has been closed
+    int either_handle_() const STLSOFT_NOEXCEPT
+    {
+        return (-1 != m_handles[1]) ? m_handles[1] : m_handles[0];
+    }
+
+    void
+    init_(
+        int         flags
+    ,   size_type   capacity
+    )
+    {
+        int r;
+
+#if defined(_WIN32) && \
+    (   defined(_MSC_VER) || \
+        defined(STLSOFT_COMPILER_IS_DMC))
+
+        STLSOFT_SUPPRESS_UNUSED(flags);
+        STLSOFT_SUPPRESS_UNUSED(capacity);
+
+        r = ::_pipe(&m_handles[0], 10240, _O_TEXT);
+#else /* ? _WIN32 */
+# if defined(UNIXSTL_OS_IS_LINUX) && \
+     defined(_GNU_SOURCE) && \
+     defined(O_CLOEXEC)
+
+        // pipe2() applies O_NONBLOCK to both ends, so is used only when
+        // both, or neither, are to be non-blocking
+        if (0 != flags &&
+            (   nonBlocking == (nonBlocking & flags) ||
+                0 == (nonBlocking & flags)))
+        {
+            r = ::pipe2(&m_handles[0], ((0 != (nonBlocking & flags)) ? O_NONBLOCK : 0) | ((0 != (closeOnExec & flags)) ? O_CLOEXEC : 0));
+
+            flags = 0;
+        }
+        else
+# endif /* Linux */
+        {
+            r = ::pipe(&m_handles[0]);
+        }
+
+        if (0 == r)
+        {
+            int e = 0;
+
+            if (0 != (nonBlockingRead & flags))
+            {
+                e = set_fl_(m_handles[0], O_NONBLOCK);
+            }
+            if (0 == e &&
+                0 != (nonBlockingWrite & flags))
+            {
+                e = set_fl_(m_handles[1], O_NONBLOCK);
+            }
+            if (0 == e &&
+                0 != (closeOnExec & flags))
+            {
+                e = set_fd_cloexec_(m_handles[0]);
+
+                if (0 == e)
+                {
+                    e = set_fd_cloexec_(m_handles[1]);
+                }
+            }
+# if defined(F_SETPIPE_SZ)
+            if (0 == e &&
+                0 != capacity &&
+                ::fcntl(m_handles[1], F_SETPIPE_SZ, static_cast<int>(capacity)) < 0)
+            {
+                e = errno;
+            }
+# else /* ? F_SETPIPE_SZ */
+
+            STLSOFT_SUPPRESS_UNUSED(capacity);
+# endif /* F_SETPIPE_SZ */
+
+            if (0 != e)
+            {
+                close_(m_handles[0]);
+                close_(m_handles[1]);
+
+                errno = e;
+                r = -1;
+            }
+        }
+#endif /* _WIN32 */
+
+        if (0 != r)
+        {
+            m_handles[0] = -1;
+            m_handles[1] = -1;
+
+            exception_policy_type()(errno);
+        }
+    }
+
+#if !defined(_WIN32) || \
+    !(  defined(_MSC_VER) || \
+        defined(STLSOFT_COMPILER_IS_DMC))
+    static
+    int
+    set_fl_(
+        int h
+    ,   int fl
+    )
+    {
+        int const cur = ::fcntl(h, F_GETFL);
+
+        if (cur < 0 ||
+            ::fcntl(h, F_SETFL, cur | fl) < 0)
+        {
+            return errno;
+        }
+
+        return 0;
+    }
+
+    static
+    int
+    set_fd_cloexec_(
+        int h
+    )
+    {
+        int const cur = ::fcntl(h, F_GETFD);
+
+        if (cur < 0 ||
+            ::fcntl(h, F_SETFD, cur | FD_CLOEXEC) < 0)
+        {
+            return errno;
+        }
+
+        return 0;
+    }
+#endif /* !_WIN32 */
+
     static
     void
     close_(
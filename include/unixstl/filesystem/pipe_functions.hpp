@@ -0,0 +1,529 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/filesystem/pipe_functions.hpp
+ *
+ * Purpose:     Zero-copy transfer functions for pipes.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/filesystem/pipe_functions.hpp
+ *
+ * \brief [C++] Functions for transferring data between pipes and other
+ *   file descriptors without copying through user space
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS_REVISION 2
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS_EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES
+# include <unixstl/exception/throw_policies.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_FCNTL
+# define STLSOFT_INCL_H_FCNTL
+# include <fcntl.h>
+#endif /* !STLSOFT_INCL_H_FCNTL */
+#ifndef STLSOFT_INCL_H_POLL
+# define STLSOFT_INCL_H_POLL
+# include <poll.h>
+#endif /* !STLSOFT_INCL_H_POLL */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_pipe_functions
+{
+
+    // The most transferred by a single call, which keeps within the range
+    // of ssize_t and of the kernel's own limit
+    static us_size_t const  max_transfer_size   =   0x40000000;
+    // The size of the buffer used when data must be copied
+    static us_size_t const  copy_buffer_size    =   64 * 1024;
+
+    // The buffer used when data must be copied, which is allocated only
+    // when first needed
+    typedef STLSOFT_NS_QUAL(auto_buffer)<char, 4096>        copy_buffer_type;
+
+    // Waits until the descriptor is ready for the given events
+    inline
+    int
+    wait_for_(
+        int     fd
+    ,   short   events
+    )
+    {
+        struct pollfd pfd;
+
+        pfd.fd      =   fd;
+        pfd.events  =   events;
+        pfd.revents =   0;
+
+        for (;;)
+        {
+            int const r = ::poll(&pfd, 1, -1);
+
+            if (r < 0 &&
+                EINTR == errno)
+            {
+                continue;
+            }
+
+            return (r < 0) ? errno : 0;
+        }
+    }
+
+    // Indicates whether a read from the descriptor would not block: it
+    // has data, or is at its end, or is in error
+    inline
+    bool
+    is_readable_(
+        int fd
+    )
+    {
+        struct pollfd pfd;
+
+        pfd.fd      =   fd;
+        pfd.events  =   POLLIN;
+        pfd.revents =   0;
+
+        return ::poll(&pfd, 1, 0) > 0;
+    }
+
+    // Writes all of the given bytes, waiting if the descriptor is
+    // non-blocking, and returns 0 or the error code
+    inline
+    int
+    write_all_(
+        int         fd
+    ,   char const* p
+    ,   us_size_t   n
+    )
+    {
+        for (; 0 != n; )
+        {
+            ssize_t const r = ::write(fd, p, n);
+
+            if (r < 0)
+            {
+                int const e = errno;
+
+                if (EINTR == e)
+                {
+                    continue;
+                }
+                if (EAGAIN == e ||
+                    EWOULDBLOCK == e)
+                {
+                    int const e2 = wait_for_(fd, POLLOUT);
+
+                    if (0 != e2)
+                    {
+                        return e2;
+                    }
+
+                    continue;
+                }
+
+                return e;
+            }
+
+            p += r;
+            n -= static_cast<us_size_t>(r);
+        }
+
+        return 0;
+    }
+
+    // Transfers up to cb bytes by read() and write(), with the given
+    // buffer
+    inline
+    ssize_t
+    copy_(
+        int         fdIn
+    ,   int         fdOut
+    ,   us_size_t   cb
+    ,   char*       buff
+    ,   us_size_t   cbBuff
+    )
+    {
+        for (;;)
+        {
+            ssize_t const r = ::read(fdIn, buff, (cb < cbBuff) ? cb : cbBuff);
+
+            if (r < 0)
+            {
+                int const e = errno;
+
+                if (EINTR == e)
+                {
+                    continue;
+                }
+                if (EAGAIN == e ||
+                    EWOULDBLOCK == e)
+                {
+                    return -1;
+                }
+
+                unix_exception_policy()(e);
+
+                return -1;
+            }
+
+            if (r > 0)
+            {
+                int const e = write_all_(fdOut, buff, static_cast<us_size_t>(r));
+
+                if (0 != e)
+                {
+                    unix_exception_policy()(e);
+
+                    return -1;
+                }
+            }
+
+            return r;
+        }
+    }
+
+    inline
+    ssize_t
+    pipe_splice_(
+        int                 fdIn
+    ,   int                 fdOut
+    ,   us_size_t           cb
+    ,   copy_buffer_type&   buff
+    )
+    {
+        if (cb > max_transfer_size)
+        {
+            cb = max_transfer_size;
+        }
+
+#if defined(UNIXSTL_OS_IS_LINUX) && \
+    defined(SPLICE_F_MOVE)
+
+        for (;;)
+        {
+            ssize_t const r = ::splice(fdIn, NULL, fdOut, NULL, cb, SPLICE_F_MOVE);
+
+            if (r >= 0)
+            {
+                return r;
+            }
+
+            int const e = errno;
+
+            if (EINTR == e)
+            {
+                continue;
+            }
+            if (EAGAIN == e ||
+                EWOULDBLOCK == e)
+            {
+                return -1;
+            }
+            if (EINVAL != e &&
+                ENOSYS != e)
+            {
+                unix_exception_policy()(e);
+
+                return -1;
+            }
+
+            // Neither descriptor is a pipe, or one of them (such as a file
+            // opened for appending) does not support splicing, so the
+            // data must be copied
+            break;
+        }
+#endif /* Linux */
+
+        if (buff.empty() &&
+            !buff.resize(copy_buffer_size))
+        {
+            // Only in the absence of exception support
+            unix_exception_policy()(ENOMEM);
+
+            return -1;
+        }
+
+        return copy_(fdIn, fdOut, cb, buff.data(), buff.size());
+    }
+
+} /* namespace ximpl_pipe_functions */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * functions
+ */
+
+/** Transfers up to \c cb bytes from \c fdIn to \c fdOut.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * On Linux, when either descriptor is a pipe, the data is moved with
+ * <code>splice()</code>, without being copied through user space.
+ * Otherwise - on other systems, when neither is a pipe, or when one does
+ * not support splicing (such as a file opened with
+ * <code>O_APPEND</code>) - it is copied with <code>read()</code> and
+ * <code>write()</code>.
+ *
+ * \param fdIn The descriptor from which to read
+ * \param fdOut The descriptor to which to write
+ * \param cb The maximum number of bytes to transfer
+ *
+ * \return The number of bytes transferred, which is 0 at the end of the
+ *   input; or -1 if \c fdIn (or, when splicing, \c fdOut) is non-blocking
+ *   and not ready, in which case <code>errno</code> is
+ *   <code>EAGAIN</code>
+ *
+ * \exception unixstl::unixstl_exception Thrown if the transfer fails for
+ *   any other reason
+ */
+inline
+ssize_t
+pipe_splice(
+    int         fdIn
+,   int         fdOut
+,   us_size_t   cb
+)
+{
+    ximpl_pipe_functions::copy_buffer_type buff(0);
+
+    return ximpl_pipe_functions::pipe_splice_(fdIn, fdOut, cb, buff);
+}
+
+/** Transfers all data from \c fdIn to \c fdOut, until the end of the
+ * input or until \c cb bytes have been transferred, waiting for
+ * non-blocking descriptors to become ready.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * \return The number of bytes transferred
+ *
+ * \see pipe_splice()
+ */
+inline
+us_uint64_t
+pipe_splice_all(
+    int         fdIn
+,   int         fdOut
+,   us_uint64_t cb = ~us_uint64_t(0)
+)
+{
+    ximpl_pipe_functions::copy_buffer_type  buff(0);
+    us_uint64_t                             total = 0;
+
+    for (; total < cb; )
+    {
+        us_uint64_t const   remaining   =   cb - total;
+        us_size_t const     n           =   (remaining < ximpl_pipe_functions::max_transfer_size) ? static_cast<us_size_t>(remaining) : ximpl_pipe_functions::max_transfer_size;
+        ssize_t const       r           =   ximpl_pipe_functions::pipe_splice_(fdIn, fdOut, n, buff);
+
+        if (0 == r)
+        {
+            break;
+        }
+        else if (r > 0)
+        {
+            total += static_cast<us_uint64_t>(r);
+        }
+        else
+        {
+            // Either end may be the one that is not ready. If the input
+            // has data then it is the output, which is waited for alone,
+            // since waiting for both would return at once, and spin
+            int const e = ximpl_pipe_functions::is_readable_(fdIn)
+                            ? ximpl_pipe_functions::wait_for_(fdOut, POLLOUT)
+                            : ximpl_pipe_functions::wait_for_(fdIn, POLLIN);
+
+            if (0 != e)
+            {
+                unix_exception_policy()(e);
+
+                break;
+            }
+        }
+    }
+
+    return total;
+}
+
+/** Duplicates up to \c cb bytes from the pipe \c pipeIn to the pipe
+ * \c pipeOut, without consuming them from \c pipeIn.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * Uses <code>tee()</code>, and so is supported only on Linux; elsewhere
+ * it reports <code>ENOSYS</code>.
+ *
+ * \return The number of bytes duplicated, which is 0 if there is no data
+ *   in \c pipeIn and its write end is closed; or -1 if either pipe is
+ *   non-blocking and not ready, in which case <code>errno</code> is
+ *   <code>EAGAIN</code>
+ *
+ * \exception unixstl::unixstl_exception Thrown if the duplication fails
+ *   for any other reason
+ */
+inline
+ssize_t
+pipe_tee(
+    int         pipeIn
+,   int         pipeOut
+,   us_size_t   cb
+)
+{
+#if defined(UNIXSTL_OS_IS_LINUX) && \
+    defined(SPLICE_F_MOVE)
+
+    if (cb > ximpl_pipe_functions::max_transfer_size)
+    {
+        cb = ximpl_pipe_functions::max_transfer_size;
+    }
+
+    for (;;)
+    {
+        ssize_t const r = ::tee(pipeIn, pipeOut, cb, 0);
+
+        if (r >= 0)
+        {
+            return r;
+        }
+
+        int const e = errno;
+
+        if (EINTR == e)
+        {
+            continue;
+        }
+        if (EAGAIN != e &&
+            EWOULDBLOCK != e)
+        {
+            unix_exception_policy()(e);
+        }
+
+        return -1;
+    }
+#else /* ? Linux */
+
+    STLSOFT_SUPPRESS_UNUSED(pipeIn);
+    STLSOFT_SUPPRESS_UNUSED(pipeOut);
+    STLSOFT_SUPPRESS_UNUSED(cb);
+
+    unix_exception_policy()(ENOSYS);
+
+    return -1;
+#endif /* Linux */
+}
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_FUNCTIONS */
+
+/* ///////////////////////////// end of file //////////////////////////// */
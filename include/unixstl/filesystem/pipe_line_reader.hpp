@@ -0,0 +1,555 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/filesystem/pipe_line_reader.hpp
+ *
+ * Purpose:     pipe_line_reader class, which reads lines from multiple pipes.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/filesystem/pipe_line_reader.hpp
+ *
+ * \brief [C++] Definition of the unixstl::pipe_line_reader class
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER_REVISION   2
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER_EDIT       2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES
+# include <unixstl/exception/throw_policies.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES */
+#ifndef STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW
+# include <stlsoft/string/string_view.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_STRING_HPP_STRING_VIEW */
+
+#ifndef STLSOFT_INCL_VECTOR
+# define STLSOFT_INCL_VECTOR
+# include <vector>
+#endif /* !STLSOFT_INCL_VECTOR */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_POLL
+# define STLSOFT_INCL_H_POLL
+# include <poll.h>
+#endif /* !STLSOFT_INCL_H_POLL */
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Reads lines from any number of pipes (or other pollable descriptors),
+ * as they become available, with a single buffer per source.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * Each call to read_line() returns a complete line from one of the
+ * sources, already-buffered lines being served in rotation before the
+ * sources are polled again, so that a busy source cannot starve the
+ * others. Lines are returned without copying, as views onto the source's
+ * buffer, and the buffer of a source grows to accommodate a line that is
+ * longer than it.
+ *
+ * \code
+  unixstl::pipe             out;
+  unixstl::pipe             err;
+  unixstl::pipe_line_reader reader;
+
+  . . . // start a child process writing to out and err
+
+  out.close_write();
+  err.close_write();
+
+  reader.add(out.read_handle());
+  reader.add(err.read_handle());
+
+  size_t                source;
+  stlsoft::string_view  line;
+
+  for (; reader.read_line(source, line); )
+  {
+    . . . // use line, from source 0 (stdout) or 1 (stderr)
+  }
+ * \endcode
+ *
+ * \note The reader does not take ownership of the descriptors
+ */
+class pipe_line_reader
+{
+/// \name Member Types
+/// @{
+public:
+    /// This type
+    typedef pipe_line_reader                    class_type;
+    /// The exception policy type
+    typedef unix_exception_policy               exception_policy_type;
+    /// The size type
+    typedef us_size_t                           size_type;
+    /// The string view type
+    typedef STLSOFT_NS_QUAL(string_view)        string_view_type;
+private:
+    struct source_type
+    {
+        int                 fd;
+        bool                open;
+        std::vector<char>   buffer;
+        size_type           pos;    // The start of the unconsumed data
+        size_type           scan;   // Where the search for '\n' resumes
+        size_type           len;    // The end of the data
+
+        source_type(
+            int         h
+        ,   size_type   bufferSize
+        )
+            : fd(h)
+            , open(true)
+            , buffer(bufferSize)
+            , pos(0)
+            , scan(0)
+            , len(0)
+        {}
+    };
+    typedef std::vector<source_type>            sources_type_;
+    typedef std::vector<struct pollfd>          pollfds_type_;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        /// The default initial size of the buffer of each source
+        defaultBufferSize   =   64 * 1024
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Constructs an instance with no sources
+    ///
+    /// \param bufferSize The initial size of the buffer of each source
+    explicit
+    pipe_line_reader(size_type bufferSize = defaultBufferSize)
+        : m_bufferSize((0 == bufferSize) ? size_type(defaultBufferSize) : bufferSize)
+        , m_next(0)
+        , m_numOpen(0)
+    {}
+private:
+    pipe_line_reader(class_type const&);        // copy-construction proscribed
+    void operator =(class_type const&);         // copy-assignment proscribed
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Adds a source, returning its index
+    ///
+    /// \param fd The descriptor, typically the read handle of a
+    ///   unixstl::pipe, which should not be read by any other means while
+    ///   the reader is in use
+    size_type add(int fd)
+    {
+        m_sources.push_back(source_type(fd, m_bufferSize));
+        ++m_numOpen;
+
+        return m_sources.size() - 1;
+    }
+
+    /// Reads the next line from any source
+    ///
+    /// \param source Receives the index of the source of the line
+    /// \param line Receives the line, without its <code>'\\n'</code>, which
+    ///   remains valid until the next call to read_line() or add(). The
+    ///   final line of a source need not be terminated
+    /// \param timeoutMs The maximum time, in milliseconds, to wait for a
+    ///   line, however many times the sources must be polled; -1 to wait
+    ///   indefinitely
+    ///
+    /// \retval true A line was read
+    /// \retval false All sources have reached their end, or, if
+    ///   <code>0 != num_open()</code>, the timeout expired
+    ///
+    /// \exception unixstl::unixstl_exception Thrown if polling or reading
+    ///   fails
+    bool
+    read_line(
+        size_type&          source
+    ,   string_view_type&   line
+    ,   int                 timeoutMs = -1
+    )
+    {
+        us_uint64_t const deadlineNs = (timeoutMs > 0) ? now_ns_() + static_cast<us_uint64_t>(timeoutMs) * 1000000u : 0u;
+
+        for (;;)
+        {
+            if (take_buffered_line_(source, line))
+            {
+                return true;
+            }
+
+            if (0 == m_numOpen)
+            {
+                return false;
+            }
+
+            if (!poll_and_read_(timeoutMs, deadlineNs))
+            {
+                return false;
+            }
+        }
+    }
+/// @}
+
+/// \name Attributes
+/// @{
+public:
+    /// The number of sources
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_sources.size();
+    }
+    /// The number of sources that have not reached their end
+    size_type num_open() const STLSOFT_NOEXCEPT
+    {
+        return m_numOpen;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    // Takes a complete line - or, from a source at its end, the remaining
+    // data - from the first source that has one, starting after the
+    // source from which the last line was taken
+    bool
+    take_buffered_line_(
+        size_type&          source
+    ,   string_view_type&   line
+    )
+    {
+        size_type const n = m_sources.size();
+
+        for (size_type i = 0; i != n; ++i)
+        {
+            size_type const     ix  =   (m_next + i) % n;
+            source_type&        src =   m_sources[ix];
+
+            if (src.pos == src.len)
+            {
+                continue;
+            }
+
+            char* const         b   =   &src.buffer[0];
+            void const* const   nl  =   ::memchr(b + src.scan, '\n', src.len - src.scan);
+
+            if (NULL != nl)
+            {
+                size_type const end = static_cast<size_type>(static_cast<char const*>(nl) - b);
+
+                line        =   string_view_type(b + src.pos, end - src.pos);
+                src.pos     =   end + 1;
+                src.scan    =   src.pos;
+            }
+            else if (!src.open)
+            {
+                line        =   string_view_type(b + src.pos, src.len - src.pos);
+                src.pos     =   src.len;
+                src.scan    =   src.len;
+            }
+            else
+            {
+                src.scan    =   src.len;
+
+                continue;
+            }
+
+            source = ix;
+            m_next = ix + 1;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Waits for any open source to be readable, and reads from each that
+    // is, returning false on timeout
+    static
+    us_uint64_t
+    now_ns_() STLSOFT_NOEXCEPT
+    {
+        struct timespec ts;
+
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        return static_cast<us_uint64_t>(ts.tv_sec) * 1000000000u + static_cast<us_uint64_t>(ts.tv_nsec);
+    }
+
+    // The time, in milliseconds and rounded up, remaining until the given
+    // deadline, or timeoutMs if that is -1 or 0
+    static
+    int
+    remaining_ms_(
+        int         timeoutMs
+    ,   us_uint64_t deadlineNs
+    ) STLSOFT_NOEXCEPT
+    {
+        if (timeoutMs <= 0)
+        {
+            return timeoutMs;
+        }
+        else
+        {
+            us_uint64_t const now = now_ns_();
+
+            return (now >= deadlineNs) ? 0 : static_cast<int>((deadlineNs - now + 999999u) / 1000000u);
+        }
+    }
+
+    bool poll_and_read_(int timeoutMs, us_uint64_t deadlineNs)
+    {
+        m_pollfds.clear();
+        m_pollixs.clear();
+
+        { for (size_type i = 0; i != m_sources.size(); ++i)
+        {
+            if (m_sources[i].open)
+            {
+                struct pollfd pfd;
+
+                pfd.fd      =   m_sources[i].fd;
+                pfd.events  =   POLLIN;
+                pfd.revents =   0;
+
+                m_pollfds.push_back(pfd);
+                m_pollixs.push_back(i);
+            }
+        }}
+
+        int r;
+
+        for (;;)
+        {
+            r = ::poll(&m_pollfds[0], static_cast<nfds_t>(m_pollfds.size()), remaining_ms_(timeoutMs, deadlineNs));
+
+            if (r >= 0)
+            {
+                break;
+            }
+            if (EINTR != errno)
+            {
+                exception_policy_type()(errno);
+
+                return false;
+            }
+        }
+
+        if (0 == r)
+        {
+            return false;
+        }
+
+        { for (size_type i = 0; i != m_pollfds.size(); ++i)
+        {
+            short const revents = m_pollfds[i].revents;
+
+            if (0 != (POLLNVAL & revents))
+            {
+                exception_policy_type()(EBADF);
+
+                return false;
+            }
+            if (0 != ((POLLIN | POLLHUP | POLLERR) & revents))
+            {
+                read_(m_sources[m_pollixs[i]]);
+            }
+        }}
+
+        return true;
+    }
+
+    void read_(source_type& src)
+    {
+        size_type cap = src.buffer.size();
+
+        if (src.pos == src.len)
+        {
+            src.pos     =   0;
+            src.scan    =   0;
+            src.len     =   0;
+        }
+        else if (src.pos != 0 &&
+                 cap - src.len < cap / 2)
+        {
+            size_type const n = src.len - src.pos;
+
+            ::memmove(&src.buffer[0], &src.buffer[0] + src.pos, n);
+
+            src.scan    -=  src.pos;
+            src.len     =   n;
+            src.pos     =   0;
+        }
+
+        if (cap == src.len)
+        {
+            cap *= 2;
+
+            src.buffer.resize(cap);
+        }
+
+        for (;;)
+        {
+            ssize_t const r = ::read(src.fd, &src.buffer[0] + src.len, cap - src.len);
+
+            if (r > 0)
+            {
+                src.len += static_cast<size_type>(r);
+            }
+            else if (0 == r)
+            {
+                src.open = false;
+                --m_numOpen;
+            }
+            else
+            {
+                int const e = errno;
+
+                if (EINTR == e)
+                {
+                    continue;
+                }
+                if (EAGAIN != e &&
+                    EWOULDBLOCK != e)
+                {
+                    exception_policy_type()(e);
+                }
+            }
+
+            break;
+        }
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    size_type const         m_bufferSize;
+    sources_type_           m_sources;
+    size_type               m_next;
+    size_type               m_numOpen;
+    pollfds_type_           m_pollfds;
+    std::vector<size_type>  m_pollixs;
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_PIPE_LINE_READER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,654 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/filesystem/vectored_writer.hpp
+ *
+ * Purpose:     vectored_writer class, based on UNIX writev().
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/filesystem/vectored_writer.hpp
+ *
+ * \brief [C++] Definition of the unixstl::vectored_writer class
+ *   (\ref group__library__FileSystem "File System" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER
+#define UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER_MAJOR       1
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER_MINOR       0
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER_REVISION    2
+# define UNIXSTL_VER_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER_EDIT        2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES
+# include <unixstl/exception/throw_policies.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_HPP_EXCEPTION_THROW_POLICIES */
+#ifndef STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER
+# include <stlsoft/memory/auto_buffer.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_MEMORY_HPP_AUTO_BUFFER */
+#ifndef STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING
+# include <stlsoft/shims/access/string.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SHIMS_ACCESS_HPP_STRING */
+#ifndef STLSOFT_INCL_STLSOFT_API_internal_h_memfns
+# include <stlsoft/api/internal/memfns.h>
+#endif /* !STLSOFT_INCL_STLSOFT_API_internal_h_memfns */
+
+#if __cplusplus >= 201103L
+# ifndef STLSOFT_INCL_ITERATOR
+#  define STLSOFT_INCL_ITERATOR
+#  include <iterator>
+# endif /* !STLSOFT_INCL_ITERATOR */
+# ifndef STLSOFT_INCL_TYPE_TRAITS
+#  define STLSOFT_INCL_TYPE_TRAITS
+#  include <type_traits>
+# endif /* !STLSOFT_INCL_TYPE_TRAITS */
+# ifndef STLSOFT_INCL_UTILITY
+#  define STLSOFT_INCL_UTILITY
+#  include <utility>
+# endif /* !STLSOFT_INCL_UTILITY */
+#endif /* C++11 */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_LIMITS
+# define STLSOFT_INCL_H_LIMITS
+# include <limits.h>
+#endif /* !STLSOFT_INCL_H_LIMITS */
+#ifndef STLSOFT_INCL_H_TIME
+# define STLSOFT_INCL_H_TIME
+# include <time.h>
+#endif /* !STLSOFT_INCL_H_TIME */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+#ifndef STLSOFT_INCL_SYS_H_UIO
+# define STLSOFT_INCL_SYS_H_UIO
+# include <sys/uio.h>
+#endif /* !STLSOFT_INCL_SYS_H_UIO */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+/** Writes lines and blocks to a file descriptor with <code>writev()</code>,
+ * without copying a line in order to append its end-of-line character.
+ *
+ * \ingroup group__library__FileSystem
+ *
+ * The writer operates in one of two modes, selected at construction:
+ *
+ * - <b>immediate</b> (a group-commit interval of 0): each call to
+ *   write_line() issues a single <code>writev()</code> of the line and the
+ *   end-of-line character, so each line reaches the descriptor whole (and,
+ *   for <code>O_APPEND</code> files and pipes, without being interleaved
+ *   with the writes of other processes) at the cost of one system call;
+ * - <b>group-commit</b> (a non-zero interval, in milliseconds): lines are
+ *   staged in an internal buffer, which is written when the oldest staged
+ *   data has waited for the interval, when the buffer would overflow (in
+ *   which case the line that would overflow it is written in the same
+ *   call, without being staged), or when flush() is called or the
+ *   instance is destroyed. The interval is checked only by the writing
+ *   methods: there is no background thread, so a writer that falls idle
+ *   must be flushed explicitly.
+ *
+ * In either mode, write_lines() writes the whole batch - after any staged
+ * data - in as few <code>writev()</code> calls as the system's segment
+ * limit allows, without copying any of the lines. Since the segments
+ * refer to the lines until they are written, this requires that the
+ * range's iterators yield lvalues and that the string access shims yield
+ * pointers into them: when compiled as C++11 (or later), other ranges -
+ * such as those whose iterators yield temporaries, or whose elements are
+ * of types, such as <code>struct tm</code>, whose shims yield temporary
+ * strings - are copied into a single buffer and written in one call; with
+ * earlier standards, this is a precondition.
+ *
+ * The writer does not own the descriptor, and is not thread-safe.
+ */
+class vectored_writer
+{
+/// \name Member Types
+/// @{
+public:
+    /// The class type
+    typedef vectored_writer                         class_type;
+    /// The exception policy type
+    typedef unix_exception_policy                   exception_policy_type;
+    /// The size type
+    typedef us_size_t                               size_type;
+private:
+    typedef STLSOFT_NS_QUAL(auto_buffer)<char>      buffer_type_;
+/// @}
+
+/// \name Member Constants
+/// @{
+public:
+    enum
+    {
+        /// The default size of the group-commit buffer
+        defaultBufferSize   =   64 * 1024
+    };
+private:
+    enum
+    {
+#if 0
+#elif !defined(IOV_MAX)
+
+        max_segments_   =   16
+#elif IOV_MAX < 256
+
+        max_segments_   =   IOV_MAX & ~1
+#else
+
+        max_segments_   =   256
+#endif
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Constructs an instance that writes to the given descriptor
+    ///
+    /// \param fd The descriptor to which to write. The caller retains
+    ///   ownership
+    /// \param groupCommitIntervalMs The maximum time, in milliseconds,
+    ///   for which written data may be held in the buffer. If 0, the
+    ///   writer operates in immediate mode
+    /// \param bufferSize The size of the group-commit buffer. Ignored in
+    ///   immediate mode
+    explicit
+    vectored_writer(
+        int         fd
+    ,   unsigned    groupCommitIntervalMs = 0
+    ,   size_type   bufferSize = defaultBufferSize
+    )
+        : m_fd(fd)
+        , m_intervalNs(static_cast<us_uint64_t>(groupCommitIntervalMs) * 1000000u)
+        , m_buffer((0 != groupCommitIntervalMs) ? bufferSize : 0u)
+        , m_pending(0)
+        , m_oldestNs(0)
+    {}
+    /// Writes any pending data, ignoring any failure to do so
+    ///
+    /// \note Callers that must know whether all data was written should
+    ///   call flush() before the instance is destroyed
+    ~vectored_writer() STLSOFT_NOEXCEPT
+    {
+        if (0 != m_pending)
+        {
+            flush_();
+        }
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The descriptor to which the instance writes
+    int get() const STLSOFT_NOEXCEPT
+    {
+        return m_fd;
+    }
+    /// The number of bytes staged but not yet written
+    size_type pending() const STLSOFT_NOEXCEPT
+    {
+        return m_pending;
+    }
+    /// Indicates whether the instance operates in group-commit mode
+    bool is_group_commit() const STLSOFT_NOEXCEPT
+    {
+        return 0 != m_intervalNs;
+    }
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Writes the given string and the end-of-line character
+    /// <code>'\\n'</code>
+    template <ss_typename_param_k S>
+    class_type& write_line(S const& line)
+    {
+        return write_(STLSOFT_NS_QUAL(c_str_data_a)(line), STLSOFT_NS_QUAL(c_str_len_a)(line), true);
+    }
+    /// Writes the given string
+    template <ss_typename_param_k S>
+    class_type& write(S const& s)
+    {
+        return write_(STLSOFT_NS_QUAL(c_str_data_a)(s), STLSOFT_NS_QUAL(c_str_len_a)(s), false);
+    }
+    /// Writes the given block of memory
+    class_type& write(void const* pv, size_type cb)
+    {
+        return write_(static_cast<char const*>(pv), cb, false);
+    }
+
+    /// Writes each string in the range <code>[from, to)</code>, each
+    /// followed by the end-of-line character <code>'\\n'</code>, after any
+    /// staged data
+    ///
+    /// \pre Prior to C++11, <code>*from</code> must be an lvalue whose
+    ///   string access shims yield a pointer into it, rather than a
+    ///   temporary (see the class description)
+    template <ss_typename_param_k I>
+    class_type& write_lines(I from, I to)
+    {
+#if __cplusplus >= 201103L
+        return write_lines_(from, to, ss_typename_type_k lines_are_addressable_<I>::type());
+#else /* ? C++11 */
+        return write_lines_(from, to);
+#endif /* C++11 */
+    }
+    /// Writes each string in the given collection, each followed by the
+    /// end-of-line character <code>'\\n'</code>, after any staged data
+    template <ss_typename_param_k C>
+    class_type& write_lines(C const& lines)
+    {
+        return write_lines(lines.begin(), lines.end());
+    }
+
+    /// Writes any staged data
+    class_type& flush()
+    {
+        if (0 != m_pending)
+        {
+            int const e = flush_();
+
+            if (0 != e)
+            {
+                exception_policy_type()(e);
+            }
+        }
+
+        return *this;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+#if __cplusplus >= 201103L
+    // The segments of a batch may refer to its lines only if the iterator
+    // yields lvalues and the shim yields a pointer into each
+    template <ss_typename_param_k I>
+    struct lines_are_addressable_
+    {
+        typedef ss_typename_type_k STLSOFT_NS_QUAL_STD(iterator_traits)<I>::reference   reference_t;
+        typedef decltype(STLSOFT_NS_QUAL(c_str_data_a)(STLSOFT_NS_QUAL_STD(declval)<reference_t>())) data_t;
+
+        typedef STLSOFT_NS_QUAL_STD(integral_constant)<
+            bool
+        ,   STLSOFT_NS_QUAL_STD(is_lvalue_reference)<reference_t>::value &&
+            STLSOFT_NS_QUAL_STD(is_pointer)<ss_typename_type_k STLSOFT_NS_QUAL_STD(decay)<data_t>::type>::value
+        >                                                                               type;
+    };
+
+    template <ss_typename_param_k I>
+    class_type& write_lines_(I from, I to, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        return write_lines_(from, to);
+    }
+
+    // Copies each line, and its end-of-line character, into a buffer that
+    // is written, after any staged data, in a single call
+    template <ss_typename_param_k I>
+    class_type& write_lines_(I from, I to, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        typedef ss_typename_type_k lines_are_addressable_<I>::reference_t   reference_t;
+
+        buffer_type_    batch(0);
+        size_type       cb = 0;
+
+        for (; from != to; ++from)
+        {
+            reference_t     line        =   *from;
+            size_type const len         =   STLSOFT_NS_QUAL(c_str_len_a)(line);
+            size_type const cbRequired  =   cb + len + 1u;
+
+            if (cbRequired > batch.size() &&
+                !batch.resize((cbRequired < 2u * batch.size()) ? 2u * batch.size() : cbRequired))
+            {
+                exception_policy_type()(ENOMEM);
+
+                return *this;
+            }
+
+            if (0 != len)
+            {
+                STLSOFT_API_INTERNAL_memfns_memcpy(&batch[cb], STLSOFT_NS_QUAL(c_str_data_a)(line), len);
+            }
+            batch[cb + len] = '\n';
+            cb += len + 1u;
+        }
+
+        struct iovec    iov[2];
+        int             n = 0;
+
+        if (0 != m_pending)
+        {
+            set_segment_(iov[n++], m_buffer.data(), m_pending);
+        }
+        if (0 != cb)
+        {
+            set_segment_(iov[n++], batch.data(), cb);
+        }
+
+        if (0 != n)
+        {
+            commit_(iov, n);
+        }
+
+        return *this;
+    }
+#endif /* C++11 */
+
+    template <ss_typename_param_k I>
+    class_type& write_lines_(I from, I to)
+    {
+        struct iovec    iov[max_segments_];
+        int             n = 0;
+
+        if (0 != m_pending)
+        {
+            set_segment_(iov[n++], m_buffer.data(), m_pending);
+        }
+
+        for (; from != to; ++from)
+        {
+            if (n + 2 > max_segments_)
+            {
+                commit_(iov, n);
+
+                n = 0;
+            }
+
+            size_type const len = STLSOFT_NS_QUAL(c_str_len_a)(*from);
+
+            if (0 != len)
+            {
+                set_segment_(iov[n++], STLSOFT_NS_QUAL(c_str_data_a)(*from), len);
+            }
+            set_segment_(iov[n++], newline_(), 1u);
+        }
+
+        if (0 != n)
+        {
+            commit_(iov, n);
+        }
+
+        return *this;
+    }
+
+    static
+    char const*
+    newline_() STLSOFT_NOEXCEPT
+    {
+        return "\n";
+    }
+
+    static
+    void
+    set_segment_(
+        struct iovec&   iov
+    ,   char const*     p
+    ,   size_type       n
+    ) STLSOFT_NOEXCEPT
+    {
+        iov.iov_base    =   const_cast<char*>(p);
+        iov.iov_len     =   n;
+    }
+
+    static
+    us_uint64_t
+    now_ns_() STLSOFT_NOEXCEPT
+    {
+        struct timespec ts;
+
+        ::clock_gettime(CLOCK_MONOTONIC, &ts);
+
+        return static_cast<us_uint64_t>(ts.tv_sec) * 1000000000u + static_cast<us_uint64_t>(ts.tv_nsec);
+    }
+
+    class_type&
+    write_(
+        char const* s
+    ,   size_type   len
+    ,   bool        addNewline
+    )
+    {
+        size_type const cb = len + (addNewline ? 1u : 0u);
+
+        if (!is_group_commit() ||
+            cb > m_buffer.size() - m_pending)
+        {
+            // Write the staged data, the string, and the end-of-line
+            // character in a single call
+
+            struct iovec    iov[3];
+            int             n = 0;
+
+            if (0 != m_pending)
+            {
+                set_segment_(iov[n++], m_buffer.data(), m_pending);
+            }
+            if (0 != len)
+            {
+                set_segment_(iov[n++], s, len);
+            }
+            if (addNewline)
+            {
+                set_segment_(iov[n++], newline_(), 1u);
+            }
+
+            commit_(iov, n);
+        }
+        else
+        {
+            us_uint64_t const now = now_ns_();
+
+            if (0 == m_pending)
+            {
+                m_oldestNs = now;
+            }
+
+            if (0 != len)
+            {
+                STLSOFT_API_INTERNAL_memfns_memcpy(&m_buffer[m_pending], s, len);
+            }
+            if (addNewline)
+            {
+                m_buffer[m_pending + len] = '\n';
+            }
+            m_pending += cb;
+
+            if (now - m_oldestNs >= m_intervalNs)
+            {
+                flush();
+            }
+        }
+
+        return *this;
+    }
+
+    // Writes the given segments, which include any staged data, and
+    // clears the staging buffer
+    void
+    commit_(
+        struct iovec*   iov
+    ,   int             n
+    )
+    {
+        m_pending = 0;
+
+        int const e = writev_all_(m_fd, iov, n);
+
+        if (0 != e)
+        {
+            exception_policy_type()(e);
+        }
+    }
+
+    int
+    flush_() STLSOFT_NOEXCEPT
+    {
+        struct iovec iov;
+
+        set_segment_(iov, m_buffer.data(), m_pending);
+
+        m_pending = 0;
+
+        return writev_all_(m_fd, &iov, 1);
+    }
+
+    // Writes all the given segments, resuming after partial writes and
+    // interruptions, and returns 0 or the error code
+    static
+    int
+    writev_all_(
+        int             fd
+    ,   struct iovec*   iov
+    ,   int             n
+    ) STLSOFT_NOEXCEPT
+    {
+        for (; 0 != n; )
+        {
+            ssize_t r = ::writev(fd, iov, n);
+
+            if (r < 0)
+            {
+                if (EINTR == errno)
+                {
+                    continue;
+                }
+
+                return errno;
+            }
+
+            for (; 0 != n && static_cast<size_type>(r) >= iov->iov_len; ++iov, --n)
+            {
+                r -= static_cast<ssize_t>(iov->iov_len);
+            }
+
+            if (0 != n)
+            {
+                iov->iov_base   =   static_cast<char*>(iov->iov_base) + r;
+                iov->iov_len    -=  static_cast<size_type>(r);
+            }
+        }
+
+        return 0;
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    int const           m_fd;
+    us_uint64_t const   m_intervalNs;
+    buffer_type_        m_buffer;
+    size_type           m_pending;
+    us_uint64_t         m_oldestNs;
+/// @}
+
+/// \name Not to be implemented
+/// @{
+private:
+    vectored_writer(class_type const&);
+    class_type& operator =(class_type const&);
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_FILESYSTEM_HPP_VECTORED_WRITER */
+
+/* ///////////////////////////// end of file //////////////////////////// */
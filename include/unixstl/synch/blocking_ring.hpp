@@ -0,0 +1,452 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/blocking_ring.hpp
+ *
+ * Purpose:     blocking_ring class template, blocking operations for the ring queues.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/blocking_ring.hpp
+ *
+ * \brief [C++] Definition of the unixstl::blocking_ring class template
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_BLOCKING_RING
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_BLOCKING_RING
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_BLOCKING_RING_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_BLOCKING_RING_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_BLOCKING_RING_REVISION   2
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_BLOCKING_RING_EDIT       2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE
+# include <unixstl/synch/fast_semaphore.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_MPMC_RING
+# include <stlsoft/synch/mpmc_ring.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_MPMC_RING */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_HPP_SPSC_RING
+# include <stlsoft/synch/spsc_ring.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_HPP_SPSC_RING */
+
+#ifndef STLSOFT_INCL_TYPE_TRAITS
+# define STLSOFT_INCL_TYPE_TRAITS
+# include <type_traits>
+#endif /* !STLSOFT_INCL_TYPE_TRAITS */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+// class blocking_ring
+/** Adds blocking push and pop operations to a bounded ring queue
+ *
+ * \ingroup group__library__Synch
+ *
+ * \param R The ring type, either stlsoft::spsc_ring or stlsoft::mpmc_ring
+ *
+ * Two unixstl::fast_semaphore instances count the elements and the free
+ * slots, so that push() blocks while the ring is full and pop() while it
+ * is empty; neither makes a system call unless a thread is (or is about
+ * to be) blocked. The non-blocking operations of the ring remain
+ * available as try_push() and try_pop().
+ *
+ * The concurrency constraints of the ring apply: a
+ * <code>blocking_ring<spsc_ring<T, N> ></code> may have only one
+ * producer and one consumer thread.
+ *
+\code
+  unixstl::blocking_ring<stlsoft::mpmc_ring<job> > jobs(1024);
+
+  // producers
+  jobs.push(job(...));
+
+  // consumers
+  job j;
+
+  jobs.pop(j);
+\endcode
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+template <ss_typename_param_k R>
+class blocking_ring
+{
+/// \name Types
+/// @{
+public:
+    /// The ring type
+    typedef R                                               ring_type;
+    /// The element type
+    typedef ss_typename_type_k ring_type::value_type        value_type;
+    /// The size type
+    typedef ss_typename_type_k ring_type::size_type         size_type;
+    /// This type
+    typedef blocking_ring<R>                                class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+private:
+    typedef fast_semaphore::count_type                      count_type_;
+
+    // Publishes the elements pushed into the reserved slots, and - should
+    // an element's copy or move throw - returns the slots left unused
+    class push_scope_
+    {
+    public:
+        push_scope_(class_type& ring, size_type numReserved) STLSOFT_NOEXCEPT
+            : m_ring(ring)
+            , m_numReserved(numReserved)
+            , m_numPushed(0)
+        {}
+        ~push_scope_() STLSOFT_NOEXCEPT
+        {
+            if (0 != m_numPushed)
+            {
+                m_ring.m_items.unlock_n(static_cast<count_type_>(m_numPushed));
+            }
+            if (m_numPushed != m_numReserved)
+            {
+                m_ring.m_slots.unlock_n(static_cast<count_type_>(m_numReserved - m_numPushed));
+            }
+        }
+
+    public:
+        void pushed(size_type n) STLSOFT_NOEXCEPT
+        {
+            m_numPushed += n;
+        }
+
+    private:
+        class_type&     m_ring;
+        size_type const m_numReserved;
+        size_type       m_numPushed;
+
+    private:
+        push_scope_(push_scope_ const&);        // copy-construction proscribed
+        void operator =(push_scope_ const&);    // copy-assignment proscribed
+    };
+    friend class push_scope_;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an empty instance, for a ring type - such as
+    /// stlsoft::spsc_ring - whose capacity is fixed at compile time
+    blocking_ring()
+        : m_ring()
+        , m_items(0)
+        , m_slots(static_cast<count_type_>(m_ring.capacity()))
+        , m_spinCount(ximpl_futex::effective_spin_count(UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT))
+    {}
+    /// Creates an empty instance, for a ring type - such as
+    /// stlsoft::mpmc_ring - whose capacity is given at run time
+    ss_explicit_k blocking_ring(size_type capacity)
+        : m_ring(capacity)
+        , m_items(0)
+        , m_slots(static_cast<count_type_>(m_ring.capacity()))
+        , m_spinCount(ximpl_futex::effective_spin_count(UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT))
+    {}
+
+// Not to be implemented
+private:
+    blocking_ring(class_type const&);           // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+/// @}
+
+/// \name Producer Operations
+/// @{
+public:
+    /// Appends a copy of the given value, waiting while the ring is full
+    void push(value_type const& value)
+    {
+        m_slots.lock();
+
+        push_scope_ scope(*this, 1);
+
+        push_(value);
+        scope.pushed(1);
+    }
+    /// Appends the given value, waiting while the ring is full
+    void push(value_type&& value)
+    {
+        m_slots.lock();
+
+        push_scope_ scope(*this, 1);
+
+        push_(STLSOFT_NS_QUAL_STD(move)(value));
+        scope.pushed(1);
+    }
+    /// Appends copies of the \c n values at \c values, waiting while the
+    /// ring is full, and appending as many at once as there is space for
+    ///
+    /// \note Should an element's copy throw, the elements already appended
+    ///   remain in the ring
+    void push_n(value_type const* values, size_type n)
+    {
+        for (; 0 != n; )
+        {
+            m_slots.lock();
+
+            size_type const num         =   1 + m_slots.try_lock_n(max_batch_(n - 1));
+            unsigned        numCalls    =   0;
+            push_scope_     scope(*this, num);
+
+            { for (size_type i = 0; i != num; )
+            {
+                size_type const pushed = try_push_n_(values + i, num - i, STLSOFT_NS_QUAL_STD(is_nothrow_copy_constructible)<value_type>());
+
+                if (0 == pushed)
+                {
+                    // The slot is free, but its last consumer has not
+                    // yet finished with it
+                    ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+                }
+
+                scope.pushed(pushed);
+
+                i += pushed;
+            }}
+
+            values += num;
+            n -= num;
+        }
+    }
+    /// Appends a copy of the given value, failing if the ring is full
+    bool_type try_push(value_type const& value)
+    {
+        if (!m_slots.try_lock())
+        {
+            return false;
+        }
+
+        push_scope_ scope(*this, 1);
+
+        push_(value);
+        scope.pushed(1);
+
+        return true;
+    }
+/// @}
+
+/// \name Consumer Operations
+/// @{
+public:
+    /// Removes the element at the front of the ring into \c value,
+    /// waiting while the ring is empty
+    void pop(value_type& value)
+    {
+        m_items.lock();
+        pop_(value);
+        m_slots.unlock();
+    }
+    /// Removes at least one, and up to \c maxCount, elements from the
+    /// front of the ring into the array \c values, waiting while the ring
+    /// is empty
+    ///
+    /// \return The number of elements removed
+    size_type pop_n(value_type* values, size_type maxCount)
+    {
+        if (0 == maxCount)
+        {
+            return 0;
+        }
+
+        m_items.lock();
+
+        size_type const num         =   1 + m_items.try_lock_n(max_batch_(maxCount - 1));
+        unsigned        numCalls    =   0;
+
+        { for (size_type i = 0; i != num; )
+        {
+            size_type const popped = m_ring.try_pop_n(values + i, num - i);
+
+            if (0 == popped)
+            {
+                // The element is counted, but its producer has not yet
+                // finished with it
+                ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+            }
+
+            i += popped;
+        }}
+
+        m_slots.unlock_n(static_cast<count_type_>(num));
+
+        return num;
+    }
+    /// Removes the element at the front of the ring into \c value,
+    /// failing if the ring is empty
+    bool_type try_pop(value_type& value)
+    {
+        if (!m_items.try_lock())
+        {
+            return false;
+        }
+
+        pop_(value);
+        m_slots.unlock();
+
+        return true;
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The number of elements in the ring, which may be changed by other
+    /// threads at any time
+    size_type size() const STLSOFT_NOEXCEPT
+    {
+        return m_ring.size();
+    }
+    /// The maximum number of elements that the ring can hold
+    size_type capacity() const STLSOFT_NOEXCEPT
+    {
+        return m_ring.capacity();
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    static count_type_ max_batch_(size_type n) STLSOFT_NOEXCEPT
+    {
+        return (n < fast_semaphore::maxCountValue) ? static_cast<count_type_>(n) : static_cast<count_type_>(fast_semaphore::maxCountValue);
+    }
+
+    // Having acquired a slot (or an element), the ring operation can
+    // fail only while the thread that last used the cell is completing
+    // its operation on it, which is brief, so is retried
+    template <ss_typename_param_k V>
+    void push_(V&& value)
+    {
+        unsigned numCalls = 0;
+
+        for (; !m_ring.try_push(STLSOFT_NS_QUAL_STD(forward)<V>(value)); )
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+    }
+    // When copying may throw, the values are appended individually, so
+    // that the number appended is known should a copy throw
+    size_type try_push_n_(value_type const* values, size_type n, STLSOFT_NS_QUAL_STD(true_type))
+    {
+        return m_ring.try_push_n(values, n);
+    }
+    size_type try_push_n_(value_type const* values, size_type /* n */, STLSOFT_NS_QUAL_STD(false_type))
+    {
+        return m_ring.try_push(*values) ? 1 : 0;
+    }
+
+    void pop_(value_type& value)
+    {
+        unsigned numCalls = 0;
+
+        for (; !m_ring.try_pop(value); )
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+    }
+/// @}
+
+// Members
+private:
+    ring_type       m_ring;
+    fast_semaphore  m_items;
+    fast_semaphore  m_slots;
+    unsigned const  m_spinCount;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_BLOCKING_RING */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,520 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/event.hpp
+ *
+ * Purpose:     auto_reset_event and manual_reset_event classes, futex-based
+ *              events.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/event.hpp
+ *
+ * \brief [C++] Definition of the unixstl::auto_reset_event and
+ *   unixstl::manual_reset_event classes
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_EVENT
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_EVENT
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_EVENT_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_EVENT_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_EVENT_REVISION   1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_EVENT_EDIT       1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON
+# include <unixstl/synch/common.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON */
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+# include <unixstl/synch/util/futex_.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_ */
+
+#ifndef STLSOFT_INCL_H_LIMITS
+# define STLSOFT_INCL_H_LIMITS
+# include <limits.h>
+#endif /* !STLSOFT_INCL_H_LIMITS */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_futex
+{
+
+    // The state and the parking of waiters common to both types of event
+    class event_base
+    {
+    protected:
+        event_base(
+            bool        bInitialState
+        ,   unsigned    spinCount
+        ) STLSOFT_NOEXCEPT
+            : m_state(bInitialState ? 1 : 0)
+            , m_numWaiters(0)
+            , m_spinCount(effective_spin_count(spinCount))
+        {}
+
+    protected:
+        // Waits until try_acquire() succeeds
+        template <ss_typename_param_k F>
+        void wait_(F try_acquire) STLSOFT_NOEXCEPT
+        {
+            { for (unsigned i = 0; i != m_spinCount; ++i)
+            {
+                if (try_acquire())
+                {
+                    return;
+                }
+
+                cpu_relax();
+            }}
+
+            if (try_acquire())
+            {
+                return;
+            }
+
+            // Registering as a waiter before the final check of the state
+            // ensures that set() either is seen here or sees the waiter
+            m_numWaiters.fetch_add(1);
+
+            for (; !try_acquire(); )
+            {
+                futex_wait(&m_state, 0);
+            }
+
+            m_numWaiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        // Signals the state, waking up to n waiters if it was not
+        // already signalled
+        void set_(int n) STLSOFT_NOEXCEPT
+        {
+            if (0 == m_state.exchange(1) &&
+                0 != m_numWaiters.load())
+            {
+                futex_wake(&m_state, n);
+            }
+        }
+
+    protected:
+        futex_word_type     m_state;
+        std::atomic<int>    m_numWaiters;
+        unsigned const      m_spinCount;
+
+    private:
+        event_base(event_base const&);          // copy-construction proscribed
+        void operator =(event_base const&);     // copy-assignment proscribed
+    };
+
+} /* namespace ximpl_futex */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+// class auto_reset_event
+/** An event for the threads of a process that, once set, releases a
+ *   single waiting thread and is reset as it does so
+ *
+ * \ingroup group__library__Synch
+ *
+ * Setting an event that is already set has no effect, so two calls to
+ * set() with no intervening wait() release only one thread. wait()
+ * spins briefly - on multiprocessors only - before parking the thread,
+ * and set() makes a system call only when a thread is parked.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+class auto_reset_event
+    : private ximpl_futex::event_base
+    , public STLSOFT_NS_QUAL(synchronisable_object_tag)
+{
+/// \name Types
+/// @{
+public:
+    /// This type
+    typedef auto_reset_event                                class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates the event
+    ///
+    /// \param bInitialState Whether the event is initially set
+    /// \param spinCount The number of times that wait() tries to acquire
+    ///   the event before parking the thread
+    ss_explicit_k auto_reset_event(
+        bool_type   bInitialState = false
+    ,   unsigned    spinCount = UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+    ) STLSOFT_NOEXCEPT
+        : event_base(bInitialState, spinCount)
+    {}
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Sets the event, releasing one waiting thread, or, if there are
+    /// none, the next to call wait()
+    void set() STLSOFT_NOEXCEPT
+    {
+        set_(1);
+    }
+    /// Resets the event
+    void reset() STLSOFT_NOEXCEPT
+    {
+        m_state.store(0);
+    }
+    /// Waits until the event is set, and resets it
+    void wait() STLSOFT_NOEXCEPT
+    {
+        wait_(try_acquire_(m_state));
+    }
+    /// Resets the event if it is set
+    ///
+    /// \return <b>true</b> if the event was set
+    bool_type try_wait() STLSOFT_NOEXCEPT
+    {
+        return try_acquire_(m_state)();
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    struct try_acquire_
+    {
+        explicit try_acquire_(ximpl_futex::futex_word_type& state)
+            : state(state)
+        {}
+
+        bool operator ()() const STLSOFT_NOEXCEPT
+        {
+            int expected = 1;
+
+            return 1 == state.load() &&
+                   state.compare_exchange_strong(expected, 0);
+        }
+
+        ximpl_futex::futex_word_type& state;
+    };
+/// @}
+};
+
+// class manual_reset_event
+/** An event for the threads of a process that, once set, releases all
+ *   waiting threads, and remains set until reset() is called
+ *
+ * \ingroup group__library__Synch
+ *
+ * wait() spins briefly - on multiprocessors only - before parking the
+ * thread, and set() makes a system call only when a thread is parked.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+class manual_reset_event
+    : private ximpl_futex::event_base
+    , public STLSOFT_NS_QUAL(synchronisable_object_tag)
+{
+/// \name Types
+/// @{
+public:
+    /// This type
+    typedef manual_reset_event                              class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates the event
+    ///
+    /// \param bInitialState Whether the event is initially set
+    /// \param spinCount The number of times that wait() checks the event
+    ///   before parking the thread
+    ss_explicit_k manual_reset_event(
+        bool_type   bInitialState = false
+    ,   unsigned    spinCount = UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+    ) STLSOFT_NOEXCEPT
+        : event_base(bInitialState, spinCount)
+    {}
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Sets the event, releasing all waiting threads
+    void set() STLSOFT_NOEXCEPT
+    {
+        set_(INT_MAX);
+    }
+    /// Resets the event
+    void reset() STLSOFT_NOEXCEPT
+    {
+        m_state.store(0);
+    }
+    /// Waits until the event is set
+    void wait() STLSOFT_NOEXCEPT
+    {
+        wait_(is_set_(m_state));
+    }
+    /// Indicates whether the event is set
+    bool_type try_wait() STLSOFT_NOEXCEPT
+    {
+        return is_set_(m_state)();
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// Indicates whether the event is set
+    bool_type is_set() const STLSOFT_NOEXCEPT
+    {
+        return 0 != m_state.load();
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    struct is_set_
+    {
+        explicit is_set_(ximpl_futex::futex_word_type& state)
+            : state(state)
+        {}
+
+        bool operator ()() const STLSOFT_NOEXCEPT
+        {
+            return 0 != state.load();
+        }
+
+        ximpl_futex::futex_word_type& state;
+    };
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * shims
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/** This \ref group__concept__Shim "control shim" waits for the given event
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param ev The event for which to wait
+ */
+inline void lock_instance(UNIXSTL_NS_QUAL(auto_reset_event)& ev)
+{
+    ev.wait();
+}
+
+/** This \ref group__concept__Shim "control shim" sets the given event
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param ev The event to set
+ */
+inline void unlock_instance(UNIXSTL_NS_QUAL(auto_reset_event)& ev)
+{
+    ev.set();
+}
+
+/** This \ref group__concept__Shim "control shim" waits for the given event
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param ev The event for which to wait
+ */
+inline void lock_instance(UNIXSTL_NS_QUAL(manual_reset_event)& ev)
+{
+    ev.wait();
+}
+
+/** This \ref group__concept__Shim "control shim" sets the given event
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param ev The event to set
+ */
+inline void unlock_instance(UNIXSTL_NS_QUAL(manual_reset_event)& ev)
+{
+    ev.set();
+}
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+namespace unixstl {
+# else
+namespace unixstl_project {
+#  if defined(STLSOFT_COMPILER_IS_BORLAND)
+using ::stlsoft::lock_instance;
+using ::stlsoft::unlock_instance;
+#  endif /* compiler */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lock_traits
+ */
+
+// class lock_traits
+/** Traits for the auto_reset_event class
+ *
+ * \ingroup group__library__Synch
+ */
+struct auto_reset_event_lock_traits
+{
+public:
+    /// The lockable type
+    typedef auto_reset_event                lock_type;
+    typedef auto_reset_event_lock_traits    class_type;
+
+// Operations
+public:
+    /// Wait for the given auto_reset_event instance
+    static void lock(auto_reset_event& l)
+    {
+        lock_instance(l);
+    }
+
+    /// Set the given auto_reset_event instance
+    static void unlock(auto_reset_event& l)
+    {
+        unlock_instance(l);
+    }
+};
+
+// class lock_traits
+/** Traits for the manual_reset_event class
+ *
+ * \ingroup group__library__Synch
+ */
+struct manual_reset_event_lock_traits
+{
+public:
+    /// The lockable type
+    typedef manual_reset_event              lock_type;
+    typedef manual_reset_event_lock_traits  class_type;
+
+// Operations
+public:
+    /// Wait for the given manual_reset_event instance
+    static void lock(manual_reset_event& l)
+    {
+        lock_instance(l);
+    }
+
+    /// Set the given manual_reset_event instance
+    static void unlock(manual_reset_event& l)
+    {
+        unlock_instance(l);
+    }
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_EVENT */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,387 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/fast_semaphore.hpp
+ *
+ * Purpose:     fast_semaphore class, a futex-based semaphore.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/fast_semaphore.hpp
+ *
+ * \brief [C++] Definition of the unixstl::fast_semaphore class
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE_MAJOR     1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE_MINOR     1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE_REVISION  1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE_EDIT      2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON
+# include <unixstl/synch/common.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON */
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+# include <unixstl/synch/util/futex_.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+// class fast_semaphore
+/** A counting semaphore for the threads of a process, which acquires and
+ *   releases without a system call when uncontended
+ *
+ * \ingroup group__library__Synch
+ *
+ * The count is held in a futex word (on Linux; elsewhere the futex
+ * operations are emulated). lock() spins briefly - on multiprocessors
+ * only - before parking the thread in the kernel, and unlock() makes a
+ * system call only when a thread is parked.
+ *
+ * Unlike unixstl::semaphore, the semaphore cannot be shared between
+ * processes.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+class fast_semaphore
+    : public STLSOFT_NS_QUAL(critical_section)< STLSOFT_CRITICAL_SECTION_ISNOT_RECURSIVE
+                                            ,   STLSOFT_CRITICAL_SECTION_IS_TRYABLE
+                                            >
+    , public STLSOFT_NS_QUAL(synchronisable_object_tag)
+{
+/// \name Types
+/// @{
+public:
+    /// This type
+    typedef fast_semaphore                                  class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+    /// The count type
+    typedef unsigned int                                    count_type;
+/// @}
+
+/// \name Constants
+/// @{
+public:
+    enum
+    {
+        maxCountValue   =   0x7fffffff
+    };
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an instance of the semaphore
+    ///
+    /// \param initialCount The initial count
+    /// \param spinCount The number of times that lock() tries to acquire
+    ///   the semaphore before parking the thread
+    ss_explicit_k fast_semaphore(
+        count_type  initialCount
+    ,   unsigned    spinCount = UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+    ) STLSOFT_NOEXCEPT
+        : m_count(static_cast<int>(initialCount))
+        , m_numWaiters(0)
+        , m_spinCount(ximpl_futex::effective_spin_count(spinCount))
+    {
+        UNIXSTL_ASSERT(initialCount <= maxCountValue);
+    }
+
+// Not to be implemented
+private:
+    fast_semaphore(class_type const&);          // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+/// @}
+
+/// \name Operations
+/// @{
+public:
+    /// Acquires the semaphore, decrementing its count, pending the thread
+    /// until the count is non-zero
+    void lock() STLSOFT_NOEXCEPT
+    {
+        { for (unsigned i = 0; i != m_spinCount; ++i)
+        {
+            if (try_lock())
+            {
+                return;
+            }
+
+            ximpl_futex::cpu_relax();
+        }}
+
+        if (try_lock())
+        {
+            return;
+        }
+
+        // Registering as a waiter before the final check of the count
+        // ensures that unlock() either is seen here or sees the waiter
+        m_numWaiters.fetch_add(1);
+
+        for (; !try_lock(); )
+        {
+            ximpl_futex::futex_wait(&m_count, 0);
+        }
+
+        m_numWaiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+    /// Attempts to acquire the semaphore
+    ///
+    /// \return <b>true</b> if the semaphore was acquired, or <b>false</b> if
+    ///   its count is 0
+    bool_type try_lock() STLSOFT_NOEXCEPT
+    {
+        int count = m_count.load();
+
+        for (; count > 0; )
+        {
+            if (m_count.compare_exchange_weak(count, count - 1))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+    /// Attempts to acquire the semaphore up to \c maxCount times at
+    /// once, decrementing its count by the number acquired
+    ///
+    /// \return The number of times acquired, which is 0 if the count is 0
+    count_type try_lock_n(count_type maxCount) STLSOFT_NOEXCEPT
+    {
+        int count = m_count.load();
+
+        for (; count > 0; )
+        {
+            int const n = (static_cast<count_type>(count) < maxCount) ? count : static_cast<int>(maxCount);
+
+            if (m_count.compare_exchange_weak(count, count - n))
+            {
+                return static_cast<count_type>(n);
+            }
+        }
+
+        return 0;
+    }
+    /// Releases the semaphore, incrementing its count by one
+    void unlock() STLSOFT_NOEXCEPT
+    {
+        m_count.fetch_add(1);
+
+        if (0 != m_numWaiters.load())
+        {
+            ximpl_futex::futex_wake(&m_count, 1);
+        }
+    }
+    /// Releases the semaphore \c n times at once, incrementing its count
+    /// by \c n and waking up to \c n waiting threads
+    void unlock_n(count_type n) STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_ASSERT(n <= maxCountValue);
+
+        if (0 != n)
+        {
+            m_count.fetch_add(static_cast<int>(n));
+
+            if (0 != m_numWaiters.load())
+            {
+                ximpl_futex::futex_wake(&m_count, static_cast<int>(n));
+            }
+        }
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The current count, which may be changed by other threads at any
+    /// time
+    count_type count() const STLSOFT_NOEXCEPT
+    {
+        return static_cast<count_type>(m_count.load(std::memory_order_relaxed));
+    }
+/// @}
+
+// Members
+private:
+    ximpl_futex::futex_word_type    m_count;
+    std::atomic<int>                m_numWaiters;
+    unsigned const                  m_spinCount;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * shims
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/** This \ref group__concept__Shim "control shim" acquires a lock on the given semaphore
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param sem The semaphore on which to acquire the lock.
+ */
+inline void lock_instance(UNIXSTL_NS_QUAL(fast_semaphore)& sem)
+{
+    sem.lock();
+}
+
+/** This \ref group__concept__Shim "control shim" releases a lock on the given semaphore
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param sem The semaphore on which to release the lock
+ */
+inline void unlock_instance(UNIXSTL_NS_QUAL(fast_semaphore)& sem)
+{
+    sem.unlock();
+}
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+namespace unixstl {
+# else
+namespace unixstl_project {
+#  if defined(STLSOFT_COMPILER_IS_BORLAND)
+using ::stlsoft::lock_instance;
+using ::stlsoft::unlock_instance;
+#  endif /* compiler */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lock_traits
+ */
+
+// class lock_traits
+/** Traits for the fast_semaphore class
+ *
+ * \ingroup group__library__Synch
+ */
+struct fast_semaphore_lock_traits
+{
+public:
+    /// The lockable type
+    typedef fast_semaphore              lock_type;
+    typedef fast_semaphore_lock_traits  class_type;
+
+// Operations
+public:
+    /// Lock the given fast_semaphore instance
+    static void lock(fast_semaphore& l)
+    {
+        lock_instance(l);
+    }
+
+    /// Unlock the given fast_semaphore instance
+    static void unlock(fast_semaphore& l)
+    {
+        unlock_instance(l);
+    }
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_FAST_SEMAPHORE */
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,450 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/rw_spin_mutex.hpp
+ *
+ * Purpose:     rw_spin_mutex class, a writer-preferring reader-writer spin mutex.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/rw_spin_mutex.hpp
+ *
+ * \brief [C++] Definition of the unixstl::rw_spin_mutex class
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX_MAJOR      1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX_MINOR      0
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX_REVISION   2
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX_EDIT       2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON
+# include <unixstl/synch/common.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON */
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+# include <unixstl/synch/util/futex_.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_ */
+#ifndef STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_
+# include <stlsoft/synch/util/cache_line_padded_.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SYNCH_UTIL_HPP_CACHE_LINE_PADDED_ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+// class rw_spin_mutex
+/** A reader-writer spin mutex for the threads of a process, which permits
+ *   any number of concurrent shared (read) locks or a single exclusive
+ *   (write) lock
+ *
+ * \ingroup group__library__Synch
+ *
+ * The mutex prefers writers: once a writer has claimed the mutex, new
+ * readers wait until it has released it, so a stream of readers cannot
+ * starve a writer. The writer flag and the reader count are held on
+ * separate cache lines, so that readers, which modify only the count, do
+ * not invalidate the line that they poll while a writer is pending.
+ *
+ * Waiting threads spin - on multiprocessors only - and then yield the
+ * processor; the mutex never parks a thread in the kernel, so it suits
+ * critical sections that are short, such as the copying of a
+ * configuration snapshot or the lookup of a route. For longer ones use
+ * unixstl::rw_thread_mutex.
+ *
+ * Shared locks are acquired with lock_shared(), or by stlsoft::lock_scope
+ * with stlsoft::shared_lock_traits (or rw_spin_mutex_shared_lock_traits).
+ * Neither form of lock is recursive, and a shared lock cannot be
+ * upgraded.
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+class rw_spin_mutex
+    : public STLSOFT_NS_QUAL(critical_section)< STLSOFT_CRITICAL_SECTION_ISNOT_RECURSIVE
+                                            ,   STLSOFT_CRITICAL_SECTION_IS_TRYABLE
+                                            >
+    , public STLSOFT_NS_QUAL(synchronisable_object_tag)
+{
+/// \name Types
+/// @{
+public:
+    /// This type
+    typedef rw_spin_mutex                                   class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an instance of the mutex
+    ///
+    /// \param spinCount The number of times that a waiting thread spins on
+    ///   the processor before it starts to yield it
+    ss_explicit_k rw_spin_mutex(
+        unsigned    spinCount = UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+    ) STLSOFT_NOEXCEPT
+        : m_writer()
+        , m_numReaders()
+        , m_spinCount(ximpl_futex::effective_spin_count(spinCount))
+    {}
+    /// Destroys an instance of the mutex
+    ~rw_spin_mutex() STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_MESSAGE_ASSERT("rw_spin_mutex destroyed while locked", 0 == m_writer.value.load(std::memory_order_relaxed) && 0 == m_numReaders.value.load(std::memory_order_relaxed));
+    }
+
+// Not to be implemented
+private:
+    rw_spin_mutex(class_type const&);           // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+/// @}
+
+/// \name Exclusive Operations
+/// @{
+public:
+    /// Acquires an exclusive lock on the mutex, waiting until other
+    /// writers and all readers have released it
+    void lock() STLSOFT_NOEXCEPT
+    {
+        unsigned numCalls = 0;
+
+        for (int expected = 0; !m_writer.value.compare_exchange_weak(expected, 1); expected = 0)
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+
+        // Having claimed the mutex, wait for the readers that preceded
+        // the claim to leave
+        for (; 0 != m_numReaders.value.load(); )
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+    }
+    /// Attempts to acquire an exclusive lock on the mutex
+    ///
+    /// \return <b>true</b> if the lock was acquired, or <b>false</b> if
+    ///   the mutex is held by a writer or by any readers
+    bool_type try_lock() STLSOFT_NOEXCEPT
+    {
+        int expected = 0;
+
+        if (!m_writer.value.compare_exchange_strong(expected, 1))
+        {
+            return false;
+        }
+
+        if (0 != m_numReaders.value.load())
+        {
+            m_writer.value.store(0, std::memory_order_release);
+
+            return false;
+        }
+
+        return true;
+    }
+    /// Releases an exclusive lock on the mutex
+    void unlock() STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_ASSERT(0 != m_writer.value.load(std::memory_order_relaxed));
+
+        m_writer.value.store(0, std::memory_order_release);
+    }
+/// @}
+
+/// \name Shared Operations
+/// @{
+public:
+    /// Acquires a shared lock on the mutex, waiting while a writer holds,
+    /// or has claimed, the mutex
+    void lock_shared() STLSOFT_NOEXCEPT
+    {
+        unsigned numCalls = 0;
+
+        for (; !try_lock_shared(); )
+        {
+            for (; 0 != m_writer.value.load(std::memory_order_relaxed); )
+            {
+                ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+            }
+        }
+    }
+    /// Attempts to acquire a shared lock on the mutex
+    ///
+    /// \return <b>true</b> if the lock was acquired, or <b>false</b> if a
+    ///   writer holds, or has claimed, the mutex
+    bool_type try_lock_shared() STLSOFT_NOEXCEPT
+    {
+        if (0 != m_writer.value.load())
+        {
+            return false;
+        }
+
+        // Registering as a reader before the final check of the writer
+        // flag ensures that lock() either is seen here or sees the reader
+        m_numReaders.value.fetch_add(1);
+
+        if (0 != m_writer.value.load())
+        {
+            m_numReaders.value.fetch_sub(1, std::memory_order_release);
+
+            return false;
+        }
+
+        return true;
+    }
+    /// Releases a shared lock on the mutex
+    void unlock_shared() STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_ASSERT(0 != m_numReaders.value.load(std::memory_order_relaxed));
+
+        m_numReaders.value.fetch_sub(1, std::memory_order_release);
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The number of shared locks currently held, which may be changed by
+    /// other threads at any time
+    unsigned num_readers() const STLSOFT_NOEXCEPT
+    {
+        return static_cast<unsigned>(m_numReaders.value.load(std::memory_order_relaxed));
+    }
+/// @}
+
+// Implementation
+private:
+    typedef STLSOFT_NS_QUAL(ximpl_cache_line_padded)::cache_line_padded<
+        std::atomic<int>
+    >                                               padded_word_;
+
+// Members
+private:
+    padded_word_    m_writer;
+    padded_word_    m_numReaders;
+    unsigned const  m_spinCount;
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * shims
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/** This \ref group__concept__Shim "control shim" acquires an exclusive lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to acquire the lock.
+ */
+inline void lock_instance(UNIXSTL_NS_QUAL(rw_spin_mutex)& mx)
+{
+    mx.lock();
+}
+
+/** This \ref group__concept__Shim "control shim" releases an exclusive lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to release the lock
+ */
+inline void unlock_instance(UNIXSTL_NS_QUAL(rw_spin_mutex)& mx)
+{
+    mx.unlock();
+}
+
+/** This \ref group__concept__Shim "control shim" acquires a shared lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to acquire the lock.
+ */
+inline void lock_shared_instance(UNIXSTL_NS_QUAL(rw_spin_mutex)& mx)
+{
+    mx.lock_shared();
+}
+
+/** This \ref group__concept__Shim "control shim" releases a shared lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to release the lock
+ */
+inline void unlock_shared_instance(UNIXSTL_NS_QUAL(rw_spin_mutex)& mx)
+{
+    mx.unlock_shared();
+}
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+namespace unixstl {
+# else
+namespace unixstl_project {
+#  if defined(STLSOFT_COMPILER_IS_BORLAND)
+using ::stlsoft::lock_instance;
+using ::stlsoft::unlock_instance;
+using ::stlsoft::lock_shared_instance;
+using ::stlsoft::unlock_shared_instance;
+#  endif /* compiler */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lock_traits
+ */
+
+// class rw_spin_mutex_lock_traits
+/** Traits for acquiring exclusive locks on the rw_spin_mutex class
+ *
+ * \ingroup group__library__Synch
+ */
+struct rw_spin_mutex_lock_traits
+{
+public:
+    /// The lockable type
+    typedef rw_spin_mutex               lock_type;
+    typedef rw_spin_mutex_lock_traits   class_type;
+
+// Operations
+public:
+    /// Acquire an exclusive lock on the given rw_spin_mutex instance
+    static void lock(rw_spin_mutex& l)
+    {
+        lock_instance(l);
+    }
+
+    /// Release an exclusive lock on the given rw_spin_mutex instance
+    static void unlock(rw_spin_mutex& l)
+    {
+        unlock_instance(l);
+    }
+};
+
+// class rw_spin_mutex_shared_lock_traits
+/** Traits for acquiring shared locks on the rw_spin_mutex class
+ *
+ * \ingroup group__library__Synch
+ */
+struct rw_spin_mutex_shared_lock_traits
+{
+public:
+    /// The lockable type
+    typedef rw_spin_mutex                       lock_type;
+    typedef rw_spin_mutex_shared_lock_traits    class_type;
+
+// Operations
+public:
+    /// Acquire a shared lock on the given rw_spin_mutex instance
+    static void lock(rw_spin_mutex& l)
+    {
+        lock_shared_instance(l);
+    }
+
+    /// Release a shared lock on the given rw_spin_mutex instance
+    static void unlock(rw_spin_mutex& l)
+    {
+        unlock_shared_instance(l);
+    }
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_SPIN_MUTEX */
+
+/* ///////////////////////////// end of file //////////////////////////// */
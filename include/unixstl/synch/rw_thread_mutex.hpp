@@ -0,0 +1,531 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/rw_thread_mutex.hpp
+ *
+ * Purpose:     Intra-process reader-writer mutex, based on PTHREADS pthread_rwlock_t.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/rw_thread_mutex.hpp
+ *
+ * \brief [C++] Definition of the unixstl::rw_thread_mutex class
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX_REVISION 1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON
+# include <unixstl/synch/common.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON */
+
+#ifndef UNIXSTL_USING_PTHREADS
+# error unixstl/synch/rw_thread_mutex.hpp cannot be included in non-multithreaded compilation. _REENTRANT and/or _POSIX_THREADS must be defined
+#endif /* !UNIXSTL_USING_PTHREADS */
+#ifndef STLSOFT_INCL_STLSOFT_SMARTPTR_HPP_SCOPED_HANDLE
+# include <stlsoft/smartptr/scoped_handle.hpp>
+#endif /* !STLSOFT_INCL_STLSOFT_SMARTPTR_HPP_SCOPED_HANDLE */
+
+#ifndef STLSOFT_INCL_H_ERRNO
+# define STLSOFT_INCL_H_ERRNO
+# include <errno.h>
+#endif /* !STLSOFT_INCL_H_ERRNO */
+#ifndef STLSOFT_INCL_H_PTHREAD
+# define STLSOFT_INCL_H_PTHREAD
+# include <pthread.h>
+#endif /* !STLSOFT_INCL_H_PTHREAD */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility & feature control
+ */
+
+/* GLIBC's default read-write lock prefers readers, and can be made to
+ * prefer writers with a non-portable attribute
+ */
+#if defined(__GLIBC__) && \
+    (   defined(__USE_UNIX98) || \
+        defined(__USE_XOPEN2K))
+# define UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_
+#endif
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+// class rw_thread_mutex
+/** This class provides an implementation of a reader-writer mutex based
+ *   on the PTHREADS read-write lock.
+ *
+ * \ingroup group__library__Synch
+ *
+ * Waiting threads are blocked in the kernel, so the mutex suits critical
+ * sections of any length. For short ones, in which readers would
+ * otherwise contend on the lock's internal mutex, prefer
+ * unixstl::rw_spin_mutex.
+ *
+ * Shared locks are acquired with lock_shared(), or by stlsoft::lock_scope
+ * with stlsoft::shared_lock_traits (or rw_thread_mutex_shared_lock_traits).
+ */
+class rw_thread_mutex
+    : public STLSOFT_NS_QUAL(critical_section)< STLSOFT_CRITICAL_SECTION_ISNOT_RECURSIVE
+                                            ,   STLSOFT_CRITICAL_SECTION_IS_TRYABLE
+                                            >
+{
+/// \name Member Types
+/// @{
+public:
+    typedef rw_thread_mutex     class_type;
+    typedef us_bool_t           bool_type;
+
+    typedef pthread_rwlock_t*   resource_type;
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an instance of the mutex
+    ///
+    /// \param bPreferWriters If true, waiting writers are preferred to
+    ///   new readers, so that a stream of readers cannot starve them. This
+    ///   is supported only with GLIBC, and is ignored elsewhere
+    ss_explicit_k rw_thread_mutex(bool_type bPreferWriters = false) STLSOFT_NOEXCEPT
+        : m_rw(&m_rw_)
+        , m_error(create_(&m_rw_, bPreferWriters))
+        , m_bOwnHandle(true)
+    {}
+
+    /// Conversion constructor
+    ///
+    /// \param rw The raw read-write lock object handle that this instance will use
+    /// \param bTakeOwnership If true, the handle is closed when this instance is destroyed
+    rw_thread_mutex(pthread_rwlock_t* rw, bool_type bTakeOwnership)
+        : m_rw(rw)
+        , m_error(0)
+        , m_bOwnHandle(bTakeOwnership)
+    {
+        UNIXSTL_ASSERT(NULL != rw);
+    }
+
+    /// Destroys an instance of the mutex
+    ~rw_thread_mutex() STLSOFT_NOEXCEPT
+    {
+        if (0 == m_error &&
+            m_bOwnHandle)
+        {
+            ::pthread_rwlock_destroy(m_rw);
+        }
+    }
+private:
+    rw_thread_mutex(class_type const&);         // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+/// @}
+
+/// \name Exclusive Operations
+/// @{
+public:
+    /// Acquires an exclusive lock on the mutex, pending the thread until
+    /// the lock is acquired
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be acquired. When
+    /// compiling absent exception support, failure to acquire the lock
+    /// will be reflected in a non-zero return from get_error().
+    void lock()
+    {
+        check_(::pthread_rwlock_wrlock(m_rw), "Read-write lock write-lock failed");
+    }
+    /// Attempts to acquire an exclusive lock on the mutex
+    ///
+    /// \return <b>true</b> if the lock was acquired, or <b>false</b> if not.
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be acquired for a reason
+    /// other than that it is held (<code>EBUSY</code>). When compiling absent
+    /// exception support, failure to acquire the lock (for any other
+    /// reason) will be reflected in a non-zero return from get_error().
+    bool try_lock()
+    {
+        return try_(::pthread_rwlock_trywrlock(m_rw), "Read-write lock try-write-lock failed");
+    }
+    /// Releases an acquired exclusive lock on the mutex
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be released. When
+    /// compiling absent exception support, failure to release the lock
+    /// will be reflected in a non-zero return from get_error().
+    void unlock()
+    {
+        check_(::pthread_rwlock_unlock(m_rw), "Read-write lock unlock failed");
+    }
+/// @}
+
+/// \name Shared Operations
+/// @{
+public:
+    /// Acquires a shared lock on the mutex, pending the thread until the
+    /// lock is acquired
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be acquired.
+    void lock_shared()
+    {
+        check_(::pthread_rwlock_rdlock(m_rw), "Read-write lock read-lock failed");
+    }
+    /// Attempts to acquire a shared lock on the mutex
+    ///
+    /// \return <b>true</b> if the lock was acquired, or <b>false</b> if not.
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be acquired for a reason
+    /// other than that it is held exclusively (<code>EBUSY</code>).
+    bool try_lock_shared()
+    {
+        return try_(::pthread_rwlock_tryrdlock(m_rw), "Read-write lock try-read-lock failed");
+    }
+    /// Releases an acquired shared lock on the mutex
+    ///
+    /// \exception unixstl::synchronisation_exception When compiling with exception support, this will throw
+    /// unixstl::synchronisation_exception if the lock cannot be released.
+    void unlock_shared()
+    {
+        check_(::pthread_rwlock_unlock(m_rw), "Read-write lock unlock failed");
+    }
+
+    /// Contains the last failed error code from the underlying PTHREADS API
+    int get_error() const STLSOFT_NOEXCEPT
+    {
+        return m_error;
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The underlying kernel object handle
+    pthread_rwlock_t* handle() STLSOFT_NOEXCEPT
+    {
+        return m_rw;
+    }
+    /// The underlying kernel object handle
+    pthread_rwlock_t* get() STLSOFT_NOEXCEPT
+    {
+        return m_rw;
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    // m_error is written only on failure, since it is not protected by
+    // the lock
+    void check_(int e, char const* message)
+    {
+        if (0 != e)
+        {
+            m_error = e;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(synchronisation_exception(message, e));
+#else /* ? STLSOFT_CF_EXCEPTION_SUPPORT */
+            STLSOFT_SUPPRESS_UNUSED(message);
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+    }
+    bool try_(int e, char const* message)
+    {
+        if (0 == e)
+        {
+            return true;
+        }
+        else
+        {
+            if (EBUSY != e)
+            {
+                check_(e, message);
+            }
+
+            return false;
+        }
+    }
+
+#if defined(STLSOFT_COMPILER_IS_SUNPRO)
+    static int pthread_rwlockattr_destroy(pthread_rwlockattr_t *attr)
+    {
+        return ::pthread_rwlockattr_destroy(attr);
+    }
+#endif /* compiler */
+    static int create_(pthread_rwlock_t* rw, bool_type bPreferWriters)
+    {
+        pthread_rwlockattr_t    attr;
+        int                     res = 0;
+
+        if (0 == (res = ::pthread_rwlockattr_init(&attr)))
+        {
+            stlsoft::scoped_handle<pthread_rwlockattr_t*>   attr_(&attr, pthread_rwlockattr_destroy);
+
+#ifdef UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_
+            if (bPreferWriters)
+            {
+                ::pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+            }
+#else /* ? UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_ */
+            STLSOFT_SUPPRESS_UNUSED(bPreferWriters);
+#endif /* UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_ */
+
+            if (0 == (res = ::pthread_rwlock_init(rw, &attr)))
+            {
+            }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            else
+            {
+                STLSOFT_THROW_X(synchronisation_exception("failed to initialise PTHREADS read-write lock", res));
+            }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+        else
+        {
+            STLSOFT_THROW_X(synchronisation_exception("failed to initialise PTHREADS read-write lock attributes", res));
+        }
+#endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+
+        return res;
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    pthread_rwlock_t        m_rw_;          // The lock used when created and owned by the instance
+    pthread_rwlock_t* const m_rw;           // The lock "handle"
+    int                     m_error;        // The last PThreads error
+    const bool_type         m_bOwnHandle;   // Does the instance own the handle?
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * control shims
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/** This \ref group__concept__Shim "control shim" acquires an exclusive lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to acquire the lock.
+ */
+inline void lock_instance(UNIXSTL_NS_QUAL(rw_thread_mutex) &mx)
+{
+    mx.lock();
+}
+
+/** This \ref group__concept__Shim "control shim" releases an exclusive lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to release the lock
+ */
+inline void unlock_instance(UNIXSTL_NS_QUAL(rw_thread_mutex) &mx)
+{
+    mx.unlock();
+}
+
+/** This \ref group__concept__Shim "control shim" acquires a shared lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to acquire the lock.
+ */
+inline void lock_shared_instance(UNIXSTL_NS_QUAL(rw_thread_mutex) &mx)
+{
+    mx.lock_shared();
+}
+
+/** This \ref group__concept__Shim "control shim" releases a shared lock on the given mutex
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param mx The mutex on which to release the lock
+ */
+inline void unlock_shared_instance(UNIXSTL_NS_QUAL(rw_thread_mutex) &mx)
+{
+    mx.unlock_shared();
+}
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+namespace unixstl
+{
+# else
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lock_traits
+ */
+
+// class rw_thread_mutex_lock_traits
+/** Traits for acquiring exclusive locks on the rw_thread_mutex class
+ *
+ * \ingroup group__library__Synch
+ */
+struct rw_thread_mutex_lock_traits
+{
+public:
+    /// The lockable type
+    typedef rw_thread_mutex             lock_type;
+    typedef rw_thread_mutex_lock_traits class_type;
+
+// Operations
+public:
+    /// Acquire an exclusive lock on the given rw_thread_mutex instance
+    static void lock(rw_thread_mutex &c)
+    {
+        lock_instance(c);
+    }
+
+    /// Release an exclusive lock on the given rw_thread_mutex instance
+    static void unlock(rw_thread_mutex &c)
+    {
+        unlock_instance(c);
+    }
+};
+
+// class rw_thread_mutex_shared_lock_traits
+/** Traits for acquiring shared locks on the rw_thread_mutex class
+ *
+ * \ingroup group__library__Synch
+ */
+struct rw_thread_mutex_shared_lock_traits
+{
+public:
+    /// The lockable type
+    typedef rw_thread_mutex                     lock_type;
+    typedef rw_thread_mutex_shared_lock_traits  class_type;
+
+// Operations
+public:
+    /// Acquire a shared lock on the given rw_thread_mutex instance
+    static void lock(rw_thread_mutex &c)
+    {
+        lock_shared_instance(c);
+    }
+
+    /// Release a shared lock on the given rw_thread_mutex instance
+    static void unlock(rw_thread_mutex &c)
+    {
+        unlock_shared_instance(c);
+    }
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+#ifdef UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_
+# undef UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_
+#endif /* UNIXSTL_SYNCH_RW_THREAD_MUTEX_HAS_SETKIND_NP_ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_RW_THREAD_MUTEX */
+
+/* ///////////////////////////// end of file //////////////////////////// */
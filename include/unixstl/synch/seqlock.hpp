@@ -0,0 +1,478 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/seqlock.hpp
+ *
+ * Purpose:     seqlock class template, a sequence lock for small values.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/seqlock.hpp
+ *
+ * \brief [C++] Definition of the unixstl::seqlock class template
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_SEQLOCK
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_SEQLOCK
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_SEQLOCK_MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_SEQLOCK_MINOR    0
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_SEQLOCK_REVISION 1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_SEQLOCK_EDIT     1
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON
+# include <unixstl/synch/common.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_COMMON */
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+# include <unixstl/synch/util/futex_.hpp>
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_ */
+
+#ifndef STLSOFT_INCL_TYPE_TRAITS
+# define STLSOFT_INCL_TYPE_TRAITS
+# include <type_traits>
+#endif /* !STLSOFT_INCL_TYPE_TRAITS */
+
+#ifndef STLSOFT_INCL_H_STRING
+# define STLSOFT_INCL_H_STRING
+# include <string.h>
+#endif /* !STLSOFT_INCL_H_STRING */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * classes
+ */
+
+// class seqlock
+/** A sequence lock, which publishes snapshots of a small value from
+ *   writers to any number of readers, without the readers writing to
+ *   shared memory
+ *
+ * \ingroup group__library__Synch
+ *
+ * \param T The value type, which must be trivially copyable, such as a
+ *   POD structure of a few words
+ *
+ * A reader copies the value and then checks that the sequence number did
+ * not change during the copy, and that it was not odd (which denotes a
+ * write in progress), retrying if either occurred. Readers therefore
+ * neither block writers nor contend with one another: try_load() is
+ * wait-free, and load() retries only while writes are in progress.
+ * Writers are serialised by a spin on the sequence number.
+ *
+ * The value is held in atomic words, so that the racing reads are well
+ * defined. A value larger than a few cache lines is better published
+ * through a shared pointer, or guarded by unixstl::rw_spin_mutex.
+ *
+ * The writer side can be scoped by stlsoft::lock_scope (with
+ * seqlock_lock_traits, or the default traits), within which the value is
+ * changed by write(), and may be read by locked_value(). There is no
+ * shared lock, since readers take none.
+ *
+\code
+  struct route { unsigned dest; unsigned gateway; unsigned metric; };
+
+  unixstl::seqlock<route> current;
+
+  // writer
+  current.store(route{ 10, 1, 5 });
+
+  // readers
+  route const r = current.load();
+\endcode
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+template <ss_typename_param_k T>
+class seqlock
+{
+/// \name Types
+/// @{
+public:
+    /// The value type
+    typedef T                                               value_type;
+    /// This type
+    typedef seqlock<T>                                      class_type;
+    /// The bool type
+    typedef us_bool_t                                       bool_type;
+    /// The sequence number type
+    typedef unsigned                                        sequence_type;
+private:
+    typedef us_uintptr_t                                    word_type_;
+
+    enum
+    {
+        numWords_   =   (sizeof(T) + sizeof(word_type_) - 1) / sizeof(word_type_)
+    };
+
+    static_assert(std::is_trivially_copyable<T>::value, "seqlock value type must be trivially copyable");
+/// @}
+
+/// \name Construction
+/// @{
+public:
+    /// Creates an instance holding the given value
+    ///
+    /// \param value The initial value
+    /// \param spinCount The number of times that a writer waiting for
+    ///   another spins on the processor before it starts to yield it
+    ss_explicit_k seqlock(
+        value_type const&   value       =   value_type()
+    ,   unsigned            spinCount   =   UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+    ) STLSOFT_NOEXCEPT
+        : m_sequence(0)
+        , m_spinCount(ximpl_futex::effective_spin_count(spinCount))
+    {
+        write_(value);
+    }
+
+// Not to be implemented
+private:
+    seqlock(class_type const&);                 // copy-construction proscribed
+    class_type& operator =(class_type const&);  // copy-assignment proscribed
+/// @}
+
+/// \name Reader Operations
+/// @{
+public:
+    /// Attempts to copy the value, failing if a write was in progress
+    ///
+    /// \param value Receives the value if the copy succeeds; unchanged
+    ///   otherwise
+    ///
+    /// \return <b>true</b> if the value was copied, or <b>false</b> if a
+    ///   write was in progress
+    bool_type try_load(value_type& value) const STLSOFT_NOEXCEPT
+    {
+        sequence_type const before  =   m_sequence.load(std::memory_order_acquire);
+
+        if (0 != (before & 1u))
+        {
+            return false;
+        }
+
+        word_type_ words[numWords_];
+
+        { for (us_size_t i = 0; i != numWords_; ++i)
+        {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }}
+
+        // The fence orders the loads of the words before the re-load of
+        // the sequence number
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (before != m_sequence.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        ::memcpy(&value, &words[0], sizeof(value_type));
+
+        return true;
+    }
+    /// Copies the value, retrying while writes are in progress
+    ///
+    /// \pre The calling thread does not hold the write lock
+    value_type load() const STLSOFT_NOEXCEPT
+    {
+        value_type  value;
+        unsigned    numCalls = 0;
+
+        for (; !try_load(value); )
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+
+        return value;
+    }
+/// @}
+
+/// \name Writer Operations
+/// @{
+public:
+    /// Replaces the value, acquiring and releasing the write lock
+    void store(value_type const& value) STLSOFT_NOEXCEPT
+    {
+        lock();
+        write_(value);
+        unlock();
+    }
+
+    /// Acquires the write lock, waiting while another writer holds it
+    void lock() STLSOFT_NOEXCEPT
+    {
+        unsigned numCalls = 0;
+
+        for (; !try_lock(); )
+        {
+            ximpl_futex::spin_or_yield(numCalls, m_spinCount);
+        }
+    }
+    /// Attempts to acquire the write lock
+    ///
+    /// \return <b>true</b> if the lock was acquired, or <b>false</b> if
+    ///   another writer holds it
+    bool_type try_lock() STLSOFT_NOEXCEPT
+    {
+        sequence_type sequence = m_sequence.load(std::memory_order_relaxed);
+
+        if (0 != (sequence & 1u) ||
+            !m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        // The fence orders the (odd) sequence number before the stores
+        // of the words
+        std::atomic_thread_fence(std::memory_order_release);
+
+        return true;
+    }
+    /// Releases the write lock, publishing any value written
+    void unlock() STLSOFT_NOEXCEPT
+    {
+        sequence_type const sequence = m_sequence.load(std::memory_order_relaxed);
+
+        UNIXSTL_ASSERT(0 != (sequence & 1u));
+
+        m_sequence.store(sequence + 1, std::memory_order_release);
+    }
+
+    /// Replaces the value
+    ///
+    /// \pre The calling thread holds the write lock
+    void write(value_type const& value) STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_ASSERT(0 != (m_sequence.load(std::memory_order_relaxed) & 1u));
+
+        write_(value);
+    }
+    /// The current value
+    ///
+    /// \pre The calling thread holds the write lock
+    value_type locked_value() const STLSOFT_NOEXCEPT
+    {
+        UNIXSTL_ASSERT(0 != (m_sequence.load(std::memory_order_relaxed) & 1u));
+
+        word_type_  words[numWords_];
+        value_type  value;
+
+        { for (us_size_t i = 0; i != numWords_; ++i)
+        {
+            words[i] = m_words[i].load(std::memory_order_relaxed);
+        }}
+
+        ::memcpy(&value, &words[0], sizeof(value_type));
+
+        return value;
+    }
+/// @}
+
+/// \name Accessors
+/// @{
+public:
+    /// The sequence number, which is incremented twice by each write, and
+    /// is odd while a write is in progress
+    sequence_type sequence() const STLSOFT_NOEXCEPT
+    {
+        return m_sequence.load(std::memory_order_acquire);
+    }
+/// @}
+
+/// \name Implementation
+/// @{
+private:
+    void write_(value_type const& value) STLSOFT_NOEXCEPT
+    {
+        word_type_ words[numWords_] = { 0 };
+
+        ::memcpy(&words[0], &value, sizeof(value_type));
+
+        { for (us_size_t i = 0; i != numWords_; ++i)
+        {
+            m_words[i].store(words[i], std::memory_order_relaxed);
+        }}
+    }
+/// @}
+
+/// \name Members
+/// @{
+private:
+    std::atomic<sequence_type>      m_sequence;
+    std::atomic<word_type_>         m_words[numWords_];
+    unsigned const                  m_spinCount;
+/// @}
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * shims
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/** This \ref group__concept__Shim "control shim" acquires the write lock on the given sequence lock
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param sl The sequence lock on which to acquire the lock.
+ */
+template <ss_typename_param_k T>
+inline void lock_instance(UNIXSTL_NS_QUAL(seqlock)<T>& sl)
+{
+    sl.lock();
+}
+
+/** This \ref group__concept__Shim "control shim" releases the write lock on the given sequence lock
+ *
+ * \ingroup group__concept__Shim__synchronisation_control
+ *
+ * \param sl The sequence lock on which to release the lock
+ */
+template <ss_typename_param_k T>
+inline void unlock_instance(UNIXSTL_NS_QUAL(seqlock)<T>& sl)
+{
+    sl.unlock();
+}
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+namespace unixstl {
+# else
+namespace unixstl_project {
+#  if defined(STLSOFT_COMPILER_IS_BORLAND)
+using ::stlsoft::lock_instance;
+using ::stlsoft::unlock_instance;
+#  endif /* compiler */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * lock_traits
+ */
+
+// class seqlock_lock_traits
+/** Traits for acquiring the write lock on the seqlock class template
+ *
+ * \ingroup group__library__Synch
+ */
+template <ss_typename_param_k T>
+struct seqlock_lock_traits
+{
+public:
+    /// The lockable type
+    typedef seqlock<T>                  lock_type;
+    typedef seqlock_lock_traits<T>      class_type;
+
+// Operations
+public:
+    /// Acquire the write lock on the given seqlock instance
+    static void lock(lock_type& l)
+    {
+        lock_instance(l);
+    }
+
+    /// Release the write lock on the given seqlock instance
+    static void unlock(lock_type& l)
+    {
+        unlock_instance(l);
+    }
+};
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_HPP_SEQLOCK */
+
+/* ///////////////////////////// end of file //////////////////////////// */
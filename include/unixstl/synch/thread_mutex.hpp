@@ -4,11 +4,11 @@
  * Purpose:     Intra-process mutex, based on PTHREADS pthread_mutex_t.
  *
  * Created:     17th December 1996
- * Updated:     22nd January 2024
+ * Updated:     19th October 2026
  *
  * Home:        http://stlsoft.org/
  *
- * Copyright (c) 2019-2024, Matthew Wilson and Synesis Information Systems
+ * Copyright (c) 2019-2026, Matthew Wilson and Synesis Information Systems
  * Copyright (c) 1996-2019, Matthew Wilson and Synesis Software
  * All rights reserved.
  *
@@ -53,8 +53,8 @@
 #ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
 # define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_MAJOR       4
 # define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_MINOR       3
-# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_REVISION    10
-# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_EDIT        69
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_REVISION    12
+# define UNIXSTL_VER_UNIXSTL_SYNCH_HPP_THREAD_MUTEX_EDIT        71
 #endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
 
 /* /////////////////////////////////////////////////////////////////////////
@@ -178,14 +178,18 @@ public:
     /// will be reflected in a non-zero return from get_error().
     void lock()
     {
-        m_error = ::pthread_mutex_lock(m_mx);
+        // m_error is written only on failure, since it is not protected
+        // by the mutex
+        int const e = ::pthread_mutex_lock(m_mx);
 
-#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
-        if (0 != m_error)
+        if (0 != e)
         {
-            STLSOFT_THROW_X(synchronisation_exception("Mutex lock failed", m_error));
-        }
+            m_error = e;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(synchronisation_exception("Mutex lock failed", e));
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
     }
     /// Attempts to lock the mutex
     ///
@@ -196,21 +200,28 @@ public:
     /// other than a timeout (<code>EBUSY</code>). When compiling absent
     /// exception support, failure to acquire the lock (for any other
     /// reason) will be reflected in a non-zero return from get_error().
+    ///
+    /// \note A timeout is not a failure, and so is not recorded.
     bool try_lock()
     {
-        m_error = ::pthread_mutex_trylock(m_mx);
+        int const e = ::pthread_mutex_trylock(m_mx);
 
-        if (0 == m_error)
+        if (0 == e)
         {
             return true;
         }
+        else if (EBUSY == e)
+        {
+            // Not recorded, since the mutex is held by another thread,
+            // which may be writing m_error
+            return false;
+        }
         else
         {
+            m_error = e;
+
 #ifdef STLSOFT_CF_EXCEPTION_SUPPORT
-            if (EBUSY != m_error)
-            {
-                STLSOFT_THROW_X(synchronisation_exception("Mutex try-lock failed", m_error));
-            }
+            STLSOFT_THROW_X(synchronisation_exception("Mutex try-lock failed", e));
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
 
             return false;
@@ -224,17 +235,22 @@ public:
     /// will be reflected in a non-zero return from get_error().
     void unlock() STLSOFT_NOEXCEPT
     {
-        m_error = ::pthread_mutex_unlock(m_mx);
+        int const e = ::pthread_mutex_unlock(m_mx);
 
-#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
-        if (0 != m_error)
+        if (0 != e)
         {
-            STLSOFT_THROW_X(synchronisation_exception("Mutex unlock failed", m_error));
-        }
+            m_error = e;
+
+#ifdef STLSOFT_CF_EXCEPTION_SUPPORT
+            STLSOFT_THROW_X(synchronisation_exception("Mutex unlock failed", e));
 #endif /* STLSOFT_CF_EXCEPTION_SUPPORT */
+        }
     }
 
     /// Contains the last failed error code from the underlying PTHREADS API
+    ///
+    /// \note The error is sticky: it is set only by a failed operation,
+    ///   and is not reset by subsequent successful ones.
     int get_error() const STLSOFT_NOEXCEPT
     {
         return m_error;
@@ -0,0 +1,303 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:        unixstl/synch/util/futex_.hpp
+ *
+ * Purpose:     Futex operations for the futex-based synchronisation objects.
+ *
+ * Created:     19th October 2026
+ * Updated:     19th October 2026
+ *
+ * Home:        http://stlsoft.org/
+ *
+ * Copyright (c) 2026, Matthew Wilson and Synesis Information Systems
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ * - Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ * - Neither the name(s) of Matthew Wilson and Synesis Information Systems
+ *   nor the names of any contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written
+ *   permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+ * IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/** \file unixstl/synch/util/futex_.hpp
+ *
+ * \brief [INTERNAL] Futex wait and wake operations, and spinning helpers,
+ *   for the futex-based synchronisation objects
+ *   (\ref group__library__Synch "Synchronisation" Library).
+ *
+ * \note Requires C++11 (for <code>std::atomic</code>)
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+#define UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+# define UNIXSTL_VER_UNIXSTL_SYNCH_UTIL_HPP_FUTEX__MAJOR    1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_UTIL_HPP_FUTEX__MINOR    1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_UTIL_HPP_FUTEX__REVISION 1
+# define UNIXSTL_VER_UNIXSTL_SYNCH_UTIL_HPP_FUTEX__EDIT     2
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#ifndef UNIXSTL_INCL_UNIXSTL_H_UNIXSTL
+# include <unixstl/unixstl.h>
+#endif /* !UNIXSTL_INCL_UNIXSTL_H_UNIXSTL */
+#ifdef STLSOFT_TRACE_INCLUDE
+# pragma message(__FILE__)
+#endif /* STLSOFT_TRACE_INCLUDE */
+
+#ifndef STLSOFT_INCL_ATOMIC
+# define STLSOFT_INCL_ATOMIC
+# include <atomic>
+#endif /* !STLSOFT_INCL_ATOMIC */
+
+#if defined(UNIXSTL_OS_IS_LINUX)
+# define UNIXSTL_SYNCH_HAS_FUTEX_
+# ifndef STLSOFT_INCL_LINUX_H_FUTEX
+#  define STLSOFT_INCL_LINUX_H_FUTEX
+#  include <linux/futex.h>
+# endif /* !STLSOFT_INCL_LINUX_H_FUTEX */
+# ifndef STLSOFT_INCL_SYS_H_SYSCALL
+#  define STLSOFT_INCL_SYS_H_SYSCALL
+#  include <sys/syscall.h>
+# endif /* !STLSOFT_INCL_SYS_H_SYSCALL */
+#else /* ? UNIXSTL_OS_IS_LINUX */
+# ifndef STLSOFT_INCL_CONDITION_VARIABLE
+#  define STLSOFT_INCL_CONDITION_VARIABLE
+#  include <condition_variable>
+# endif /* !STLSOFT_INCL_CONDITION_VARIABLE */
+# ifndef STLSOFT_INCL_MUTEX
+#  define STLSOFT_INCL_MUTEX
+#  include <mutex>
+# endif /* !STLSOFT_INCL_MUTEX */
+#endif /* UNIXSTL_OS_IS_LINUX */
+
+#ifndef STLSOFT_INCL_H_SCHED
+# define STLSOFT_INCL_H_SCHED
+# include <sched.h>
+#endif /* !STLSOFT_INCL_H_SCHED */
+#ifndef STLSOFT_INCL_H_UNISTD
+# define STLSOFT_INCL_H_UNISTD
+# include <unistd.h>
+#endif /* !STLSOFT_INCL_H_UNISTD */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * compatibility & feature control
+ */
+
+/* The number of times that the futex-based objects try to acquire before
+ * parking the thread
+ */
+#ifndef UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT
+# define UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT             (1000)
+#endif /* !UNIXSTL_SYNCH_FUTEX_DEFAULT_SPIN_COUNT */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+/* There is no stlsoft namespace, so must define ::unixstl */
+namespace unixstl
+{
+# else
+/* Define stlsoft::unixstl_project */
+namespace stlsoft
+{
+namespace unixstl_project
+{
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helper functions
+ */
+
+#ifndef STLSOFT_DOCUMENTATION_SKIP_SECTION
+
+namespace ximpl_futex
+{
+
+    /// The type of the word on which threads wait
+    typedef std::atomic<int>                    futex_word_type;
+
+    static_assert(sizeof(futex_word_type) == sizeof(int), "std::atomic<int> must have the representation of int to be used as a futex word");
+
+    /// Hints to the processor that the caller is spinning
+    inline
+    void
+    cpu_relax() STLSOFT_NOEXCEPT
+    {
+#if defined(__GNUC__) && \
+    (   defined(__i386__) || \
+        defined(__x86_64__))
+
+        __builtin_ia32_pause();
+#elif defined(__GNUC__) && \
+      defined(__aarch64__)
+
+        __asm__ __volatile__("yield");
+#endif
+    }
+
+    /// The number of times to spin before parking, which is 0 on a
+    /// uniprocessor, where spinning cannot help
+    inline
+    unsigned
+    effective_spin_count(unsigned requested) STLSOFT_NOEXCEPT
+    {
+        static long const numCpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+
+        return (numCpus > 1) ? requested : 0u;
+    }
+
+    /// Waits briefly, by spinning on the processor for the first
+    /// \c spinCount calls and by yielding it thereafter, for use by the
+    /// objects that only ever spin
+    inline
+    void
+    spin_or_yield(
+        unsigned&   numCalls
+    ,   unsigned    spinCount
+    ) STLSOFT_NOEXCEPT
+    {
+        if (numCalls < spinCount)
+        {
+            ++numCalls;
+
+            cpu_relax();
+        }
+        else
+        {
+            ::sched_yield();
+        }
+    }
+
+#ifndef UNIXSTL_SYNCH_HAS_FUTEX_
+
+    // Emulates the futex operations with a fixed table of mutexes and
+    // condition variables, indexed by the address of the word
+    struct parking_bucket
+    {
+        std::mutex              mx;
+        std::condition_variable cv;
+    };
+
+    inline
+    parking_bucket&
+    bucket_for(void const* addr)
+    {
+        static parking_bucket buckets[64];
+
+        return buckets[(reinterpret_cast<us_uintptr_t>(addr) >> 4) % STLSOFT_NUM_ELEMENTS(buckets)];
+    }
+#endif /* !UNIXSTL_SYNCH_HAS_FUTEX_ */
+
+    /// Blocks the caller while <code>*word == expected</code>, until woken
+    /// by futex_wake(); may return spuriously
+    inline
+    void
+    futex_wait(
+        futex_word_type*    word
+    ,   int                 expected
+    ) STLSOFT_NOEXCEPT
+    {
+#ifdef UNIXSTL_SYNCH_HAS_FUTEX_
+
+        ::syscall(SYS_futex, reinterpret_cast<int*>(word), FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+#else /* ? UNIXSTL_SYNCH_HAS_FUTEX_ */
+
+        parking_bucket&                 b = bucket_for(word);
+        std::unique_lock<std::mutex>    lock(b.mx);
+
+        if (expected == word->load())
+        {
+            b.cv.wait(lock);
+        }
+#endif /* UNIXSTL_SYNCH_HAS_FUTEX_ */
+    }
+
+    /// Wakes up to \c n threads blocked in futex_wait() on \c word
+    inline
+    void
+    futex_wake(
+        futex_word_type*    word
+    ,   int                 n
+    ) STLSOFT_NOEXCEPT
+    {
+#ifdef UNIXSTL_SYNCH_HAS_FUTEX_
+
+        ::syscall(SYS_futex, reinterpret_cast<int*>(word), FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+#else /* ? UNIXSTL_SYNCH_HAS_FUTEX_ */
+
+        STLSOFT_SUPPRESS_UNUSED(n);
+
+        parking_bucket& b = bucket_for(word);
+
+        // Taking the lock orders the wake after any waiter's check of the
+        // word; all are woken, since the bucket may be shared
+        { std::lock_guard<std::mutex> lock(b.mx); }
+
+        b.cv.notify_all();
+#endif /* UNIXSTL_SYNCH_HAS_FUTEX_ */
+    }
+
+} /* namespace ximpl_futex */
+
+#endif /* !STLSOFT_DOCUMENTATION_SKIP_SECTION */
+
+#ifdef UNIXSTL_SYNCH_HAS_FUTEX_
+# undef UNIXSTL_SYNCH_HAS_FUTEX_
+#endif /* UNIXSTL_SYNCH_HAS_FUTEX_ */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * namespace
+ */
+
+#ifndef UNIXSTL_NO_NAMESPACE
+# if defined(STLSOFT_NO_NAMESPACE) || \
+     defined(STLSOFT_DOCUMENTATION_SKIP_SECTION)
+} /* namespace unixstl */
+# else
+} /* namespace unixstl_project */
+} /* namespace stlsoft */
+# endif /* STLSOFT_NO_NAMESPACE */
+#endif /* !UNIXSTL_NO_NAMESPACE */
+
+/* /////////////////////////////////////////////////////////////////////////
+ * inclusion control
+ */
+
+#ifdef STLSOFT_CF_PRAGMA_ONCE_SUPPORT
+# pragma once
+#endif /* STLSOFT_CF_PRAGMA_ONCE_SUPPORT */
+
+#endif /* !UNIXSTL_INCL_UNIXSTL_SYNCH_UTIL_HPP_FUTEX_ */
+
+/* ///////////////////////////// end of file //////////////////////////// */
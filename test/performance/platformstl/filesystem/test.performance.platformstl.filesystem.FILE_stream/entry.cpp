@@ -0,0 +1,227 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.platformstl.filesystem.FILE_stream/entry.cpp
+ *
+ * Purpose: Benchmark for writing lines with `platformstl::FILE_stream`,
+ *          by the former copy-and-format path and by the copy-free
+ *          `write_line()` and `write_lines()`, and (on UNIX) with
+ *          `unixstl::vectored_writer` in immediate and group-commit modes.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <platformstl/filesystem/FILE_stream.hpp>
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+# include <unixstl/filesystem/vectored_writer.hpp>
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+#include <stlsoft/memory/auto_buffer.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+# include <fcntl.h>
+# include <unistd.h>
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    std::size_t const   NUM_LINES           =   1000000;
+    // Immediate mode makes a system call per line, so is measured for
+    // fewer lines
+    std::size_t const   NUM_LINES_IMMEDIATE =   100000;
+    char const* const   PATH                =   "test.performance.platformstl.filesystem.FILE_stream.out";
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 numLines
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-36s: %8lu lines in %8ld us (%6.2f M lines/s)\n", name, static_cast<unsigned long>(numLines), static_cast<long>(us), double(numLines) / double(us ? us : 1));
+    }
+
+    // The former implementation of FILE_stream::write_line(), which copied
+    // the line in order to append the end-of-line character, and wrote
+    // the result with fprintf()
+    static
+    void
+    write_line_by_copy(
+        FILE*               stm
+    ,   std::string const&  line
+    )
+    {
+        stlsoft::auto_buffer<char>  buff(2u + line.size());
+        char                        fmt[21];
+
+        ::memcpy(&buff[0], line.data(), line.size());
+        buff[line.size() + 0] = '\n';
+        buff[line.size() + 1] = '\0';
+
+        ::sprintf(&fmt[0], "%%.%lus", static_cast<unsigned long>(1u + line.size()));
+        ::fprintf(stm, &fmt[0], buff.data());
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t                   counter;
+        std::vector<std::string>    lines;
+
+        lines.reserve(NUM_LINES);
+        for (std::size_t i = 0; i != NUM_LINES; ++i)
+        {
+            char sz[101];
+
+            lines.push_back(std::string(sz, static_cast<std::size_t>(::sprintf(sz, "2026-10-19 12:34:56.%06lu [info] request %lu completed", static_cast<unsigned long>(i % 1000000), static_cast<unsigned long>(i)))));
+        }
+
+        // FILE_stream
+
+        {
+            FILE* const stm = ::fopen(PATH, "w");
+
+            if (NULL == stm)
+            {
+                fprintf(stderr, "%s: could not open '%s'\n", program_name, PATH);
+
+                return EXIT_FAILURE;
+            }
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_LINES; ++i)
+            {
+                write_line_by_copy(stm, lines[i]);
+            }
+            ::fclose(stm);
+            counter.stop();
+            report("copy + fprintf() (former write_line)", NUM_LINES, counter.get_microseconds());
+        }
+        {
+            counter.start();
+            {
+                platformstl::FILE_stream stm(PATH, "w");
+
+                for (std::size_t i = 0; i != NUM_LINES; ++i)
+                {
+                    stm.write_line(lines[i]);
+                }
+            }
+            counter.stop();
+            report("FILE_stream::write_line()", NUM_LINES, counter.get_microseconds());
+        }
+        {
+            counter.start();
+            {
+                platformstl::FILE_stream stm(PATH, "w");
+
+                stm.write_lines(lines);
+            }
+            counter.stop();
+            report("FILE_stream::write_lines()", NUM_LINES, counter.get_microseconds());
+        }
+
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+
+        // vectored_writer
+
+        {
+            int const fd = ::open(PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            counter.start();
+            {
+                unixstl::vectored_writer w(fd);
+
+                for (std::size_t i = 0; i != NUM_LINES_IMMEDIATE; ++i)
+                {
+                    w.write_line(lines[i]);
+                }
+            }
+            counter.stop();
+            ::close(fd);
+            report("vectored_writer (immediate)", NUM_LINES_IMMEDIATE, counter.get_microseconds());
+        }
+        {
+            int const fd = ::open(PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            counter.start();
+            {
+                unixstl::vectored_writer w(fd, 10);
+
+                for (std::size_t i = 0; i != NUM_LINES; ++i)
+                {
+                    w.write_line(lines[i]);
+                }
+            }
+            counter.stop();
+            ::close(fd);
+            report("vectored_writer (group-commit 10ms)", NUM_LINES, counter.get_microseconds());
+        }
+        {
+            int const fd = ::open(PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+            counter.start();
+            {
+                unixstl::vectored_writer w(fd);
+
+                w.write_lines(lines);
+            }
+            counter.stop();
+            ::close(fd);
+            report("vectored_writer::write_lines()", NUM_LINES, counter.get_microseconds());
+        }
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+
+        ::remove(PATH);
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    ::remove(PATH);
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,228 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.platformstl.filesystem.async_FILE_sink/entry.cpp
+ *
+ * Purpose: Benchmark for producer throughput and enqueue latency (median,
+ *          p99, p99.9, maximum) of `platformstl::async_FILE_sink`, against
+ *          writing synchronously with
+ *          `platformstl::thread_shareable_FILE_stream`, for 1 to 8
+ *          producer threads.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <platformstl/filesystem/async_FILE_sink.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef platformstl::async_FILE_sink        sink_t;
+    typedef std::chrono::steady_clock           clock_t_;
+
+    std::size_t const   LINES_PER_THREAD    =   200000;
+    char const* const   PATH                =   "test.performance.platformstl.filesystem.async_FILE_sink.out";
+
+    // The enqueue latencies, in nanoseconds, of all producers
+    typedef std::vector<long>                   latencies_t;
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 numThreads
+    ,   counter_t::interval_type    us
+    ,   latencies_t&                latencies
+    )
+    {
+        std::sort(latencies.begin(), latencies.end());
+
+        std::size_t const   n   =   latencies.size();
+
+        fprintf(stdout, "%-28s %2lu thread(s): %7.2f M lines/s; latency (ns): p50 %6ld, p99 %7ld, p99.9 %8ld, max %9ld\n", name, static_cast<unsigned long>(numThreads), double(n) / double(us ? us : 1), latencies[n / 2], latencies[n * 99 / 100], latencies[n * 999 / 1000], latencies[n - 1]);
+    }
+
+    // Runs numThreads producers, each writing LINES_PER_THREAD lines with
+    // the given function, and recording the latency of each write
+    template <typename F>
+    counter_t::interval_type
+    run_producers(
+        std::size_t                         numThreads
+    ,   std::vector<std::string> const&     lines
+    ,   latencies_t&                        latencies
+    ,   F                                   f
+    )
+    {
+        std::vector<latencies_t>    perThread(numThreads, latencies_t(LINES_PER_THREAD));
+        std::vector<std::thread>    threads;
+        counter_t                   counter;
+
+        counter.start();
+        for (std::size_t t = 0; t != numThreads; ++t)
+        {
+            threads.push_back(std::thread([&lines, &perThread, &f, t]() {
+
+                latencies_t& l = perThread[t];
+
+                for (std::size_t i = 0; i != LINES_PER_THREAD; ++i)
+                {
+                    clock_t_::time_point const before = clock_t_::now();
+
+                    f(lines[i]);
+
+                    l[i] = static_cast<long>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t_::now() - before).count());
+                }
+            }));
+        }
+        for (std::size_t t = 0; t != numThreads; ++t)
+        {
+            threads[t].join();
+        }
+        counter.stop();
+
+        latencies.clear();
+        for (std::size_t t = 0; t != numThreads; ++t)
+        {
+            latencies.insert(latencies.end(), perThread[t].begin(), perThread[t].end());
+        }
+
+        return counter.get_microseconds();
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        std::vector<std::string>    lines;
+        latencies_t                 latencies;
+
+        lines.reserve(LINES_PER_THREAD);
+        for (std::size_t i = 0; i != LINES_PER_THREAD; ++i)
+        {
+            char sz[101];
+
+            lines.push_back(std::string(sz, static_cast<std::size_t>(::sprintf(sz, "2026-10-19 12:34:56.%06lu [audit] user=%lu action=read resource=/a/b/c", static_cast<unsigned long>(i), static_cast<unsigned long>(i % 977)))));
+        }
+
+        static std::size_t const thread_counts[] =
+        {
+            1, 2, 4, 8
+        };
+
+        for (std::size_t k = 0; k != STLSOFT_NUM_ELEMENTS(thread_counts); ++k)
+        {
+            std::size_t const numThreads = thread_counts[k];
+
+            // synchronous, buffered by the stream
+
+            {
+                platformstl::thread_shareable_FILE_stream stm(PATH, "w");
+
+                counter_t::interval_type const us = run_producers(numThreads, lines, latencies, [&stm](std::string const& line) {
+
+                    stm.write_line(line);
+                });
+
+                report("FILE_stream", numThreads, us, latencies);
+            }
+
+            // synchronous, flushed after each record, as an audit log
+            // would be if written synchronously
+
+            {
+                platformstl::thread_shareable_FILE_stream stm(PATH, "w");
+
+                counter_t::interval_type const us = run_producers(numThreads, lines, latencies, [&stm](std::string const& line) {
+
+                    stm.write_line(line);
+                    stm.flush();
+                });
+
+                report("FILE_stream + flush()", numThreads, us, latencies);
+            }
+
+            // asynchronous
+
+            {
+                sink_t sink(PATH, "w");
+
+                counter_t::interval_type const us = run_producers(numThreads, lines, latencies, [&sink](std::string const& line) {
+
+                    sink.write_line(line);
+                });
+
+                report("async_FILE_sink", numThreads, us, latencies);
+
+                sink.close();
+            }
+            {
+                sink_t::options opts;
+
+                opts.syncIntervalMs = 10;
+
+                sink_t sink(PATH, "w", opts);
+
+                counter_t::interval_type const us = run_producers(numThreads, lines, latencies, [&sink](std::string const& line) {
+
+                    sink.write_line(line);
+                });
+
+                report("async_FILE_sink (sync 10ms)", numThreads, us, latencies);
+
+                sink.close();
+            }
+        }
+
+        ::remove(PATH);
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    ::remove(PATH);
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,161 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.platformstl.filesystem.parallel_file_lines/entry.cpp
+ *
+ * Purpose: Scaling benchmark for `platformstl::parallel_file_lines`,
+ *          against `platformstl::file_lines`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <platformstl/filesystem/parallel_file_lines.hpp>
+#include <platformstl/filesystem/file_lines.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    // Writes a text file of (approximately) the given number of MB, with
+    // lines of between 0 and 159 characters, using a mix of LF and CRLF
+    static
+    void
+    create_text_file(
+        char const* path
+    ,   unsigned    cmb
+    )
+    {
+        FILE* const stm = fopen(path, "wb");
+
+        if (NULL == stm)
+        {
+            throw std::runtime_error("could not create test file");
+        }
+
+        char            line[256];
+        unsigned long   cb      =   0;
+        unsigned long   lim     =   1024ul * 1024ul * cmb;
+        unsigned        seed    =   1;
+
+        for (unsigned i = 0; cb < lim; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            unsigned const  len =   (seed >> 16) % 160u;
+
+            for (unsigned j = 0; j != len; ++j)
+            {
+                line[j] = static_cast<char>('a' + (i + j) % 26);
+            }
+
+            if (0 == (i % 7))
+            {
+                line[len + 0] = '\r';
+                line[len + 1] = '\n';
+
+                cb += fwrite(line, 1, len + 2, stm);
+            }
+            else
+            {
+                line[len + 0] = '\n';
+
+                cb += fwrite(line, 1, len + 1, stm);
+            }
+        }
+
+        fclose(stm);
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+    unsigned const      cmb             =   (argc < 2) ? 2048u : static_cast<unsigned>(atoi(argv[1]));
+    char const* const   path            =   (argc < 3) ? "test.performance.platformstl.filesystem.parallel_file_lines.txt" : argv[2];
+
+    try
+    {
+        typedef platformstl::performance_counter    counter_t;
+
+        counter_t   counter;
+
+        fprintf(stdout, "%s: creating %u MB file '%s' ...\n", program_name, cmb, path);
+
+        create_text_file(path, cmb);
+
+        // baseline
+
+        counter.start();
+        platformstl::file_lines const   lines(path);
+        counter.stop();
+
+        counter_t::interval_type const  base_ms =   counter.get_milliseconds();
+
+        fprintf(stdout, "%-24s: %10lu lines in %8ld ms\n", "file_lines", static_cast<unsigned long>(lines.size()), static_cast<long>(base_ms));
+
+        // scaling
+
+        for (unsigned n = 1; n <= 16; n *= 2)
+        {
+            // the pool's threads are created outside the measurement, as
+            // they would be by an application reusing them
+            stlsoft::work_stealing_pool pool(n);
+
+            counter.start();
+            platformstl::parallel_file_lines const  plines(path, pool);
+            counter.stop();
+
+            counter_t::interval_type const  ms  =   counter.get_milliseconds();
+
+            if (plines.size() != lines.size() ||
+                !std::equal(plines.begin(), plines.end(), lines.begin()))
+            {
+                throw std::runtime_error("parallel_file_lines results differ from file_lines");
+            }
+
+            fprintf(stdout, "parallel_file_lines (%2u): %10lu lines in %8ld ms (x%.2f)\n", n, static_cast<unsigned long>(plines.size()), static_cast<long>(ms), (0 == ms) ? 0.0 : double(base_ms) / double(ms));
+        }
+
+        remove(path);
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    remove(path);
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
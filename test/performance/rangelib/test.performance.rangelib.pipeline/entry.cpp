@@ -0,0 +1,303 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.rangelib.pipeline/entry.cpp
+ *
+ * Purpose: Benchmark for `rangelib::pipeline`, against the equivalent
+ *          hand-written loops, and against `rangelib::filtered_range`
+ *          with `rangelib::r_accumulate()`, over contiguous and
+ *          non-contiguous sources, with and without short-circuiting.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <rangelib/algorithms.hpp>
+#include <rangelib/filtered_range.hpp>
+#include <rangelib/pipeline.hpp>
+#include <rangelib/sequence_range.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <list>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    std::size_t const   NUM_ELEMENTS    =   1u << 20;
+    std::size_t const   NUM_LIST        =   1u << 16;
+    int const           ITERATIONS      =   100;
+
+    struct is_odd
+    {
+        bool operator ()(int x) const
+        {
+            return 0 != (x & 1);
+        }
+    };
+
+    struct square
+    {
+        int operator ()(int x) const
+        {
+            return x * x;
+        }
+    };
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   long                        result
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 n
+    )
+    {
+        fprintf(stdout, "%-22s %-22s: %12ld in %8ld us (%.3f ns/element)\n", category, name, result, static_cast<long>(us), 1000.0 * double(us) / (double(n) * ITERATIONS));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t           counter;
+        std::vector<int>    v(NUM_ELEMENTS);
+        unsigned            seed    =   1;
+
+        for (std::size_t i = 0; i != NUM_ELEMENTS; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            v[i] = static_cast<int>((seed >> 16) & 0xff);
+        }
+
+        std::list<int> const l(v.begin(), v.begin() + NUM_LIST);
+
+        // filter + sum
+
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                int s = 0;
+
+                for (std::size_t i = 0; i != v.size(); ++i)
+                {
+                    if (0 != (v[i] & 1))
+                    {
+                        s += v[i];
+                    }
+                }
+
+                r += s;
+            }
+            counter.stop();
+            report("filter+sum", "hand-written", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += rangelib::r_accumulate(rangelib::make_filtered_range(rangelib::make_sequence_range(v), is_odd()), 0);
+            }
+            counter.stop();
+            report("filter+sum", "filtered_range", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += (v | rangelib::filter(is_odd())).accumulate(0);
+            }
+            counter.stop();
+            report("filter+sum", "pipeline", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+
+        // filter + transform + sum
+
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                long s = 0;
+
+                for (std::size_t i = 0; i != v.size(); ++i)
+                {
+                    if (0 != (v[i] & 1))
+                    {
+                        s += v[i] * v[i];
+                    }
+                }
+
+                r += s;
+            }
+            counter.stop();
+            report("filter+transform+sum", "hand-written", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += (v | rangelib::filter(is_odd()) | rangelib::transform(square())).accumulate(0L);
+            }
+            counter.stop();
+            report("filter+transform+sum", "pipeline", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+
+        // filter + take + sum (short-circuiting, at half way)
+
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                int         s   =   0;
+                std::size_t n   =   NUM_ELEMENTS / 4;
+
+                for (std::size_t i = 0; 0 != n && i != v.size(); ++i)
+                {
+                    if (0 != (v[i] & 1))
+                    {
+                        s += v[i];
+                        --n;
+                    }
+                }
+
+                r += s;
+            }
+            counter.stop();
+            report("filter+take+sum", "hand-written", r, counter.get_microseconds(), NUM_ELEMENTS / 2);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += (v | rangelib::filter(is_odd()) | rangelib::take(NUM_ELEMENTS / 4)).accumulate(0);
+            }
+            counter.stop();
+            report("filter+take+sum", "pipeline", r, counter.get_microseconds(), NUM_ELEMENTS / 2);
+        }
+
+        // any_of (not found)
+
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != v.size(); ++i)
+                {
+                    if (v[i] * v[i] > 70000)
+                    {
+                        ++r;
+                        break;
+                    }
+                }
+            }
+            counter.stop();
+            report("transform+any_of", "hand-written", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += (v | rangelib::transform(square())).any_of([](int x) { return x > 70000; });
+            }
+            counter.stop();
+            report("transform+any_of", "pipeline", r, counter.get_microseconds(), NUM_ELEMENTS);
+        }
+
+        // non-contiguous source
+
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                long s = 0;
+
+                for (std::list<int>::const_iterator i = l.begin(); l.end() != i; ++i)
+                {
+                    if (0 != (*i & 1))
+                    {
+                        s += *i * *i;
+                    }
+                }
+
+                r += s;
+            }
+            counter.stop();
+            report("list", "hand-written", r, counter.get_microseconds(), NUM_LIST);
+        }
+        {
+            long r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += (l | rangelib::filter(is_odd()) | rangelib::transform(square())).accumulate(0L);
+            }
+            counter.stop();
+            report("list", "pipeline", r, counter.get_microseconds(), NUM_LIST);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,254 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.algorithms.parallel/entry.cpp
+ *
+ * Purpose: Benchmark for the parallel algorithms `stlsoft::par_for_all()`,
+ *          `stlsoft::par_transform()`, `stlsoft::par_accumulate()` and
+ *          `stlsoft::par_count_if()`, over `stlsoft::fixed_array_1d`,
+ *          against their sequential counterparts, with pools of from 1
+ *          to 16 threads.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/algorithms/collection.hpp>
+#include <stlsoft/algorithms/parallel.hpp>
+#include <stlsoft/containers/fixed_array.hpp>
+#include <stlsoft/synch/work_stealing_pool.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <numeric>
+#include <stdexcept>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef stlsoft::fixed_array_1d<double>     array_t;
+
+    std::size_t const   NUM_ELEMENTS    =   1u << 24;
+    int const           ITERATIONS      =   4;
+
+    struct scale
+    {
+        void operator ()(double& x) const
+        {
+            x = x * 1.0000001 + 0.5;
+        }
+    };
+
+    struct root
+    {
+        double operator ()(double x) const
+        {
+            return sqrt(x);
+        }
+    };
+
+    struct is_large
+    {
+        bool operator ()(double x) const
+        {
+            return x > 1000000.0;
+        }
+    };
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   std::size_t                 numThreads
+    ,   double                      result
+    ,   counter_t::interval_type    us
+    ,   counter_t::interval_type    baseline
+    )
+    {
+        fprintf(stdout, "%-10s %-14s %2lu: %20.0f in %8ld us (%.2f ns/element, x%.2f)\n", category, name, static_cast<unsigned long>(numThreads), result, static_cast<long>(us), 1000.0 * double(us) / (double(NUM_ELEMENTS) * ITERATIONS), (0 == us) ? 0.0 : double(baseline) / double(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        static std::size_t const threads[] = { 1, 2, 4, 8, 16 };
+
+        counter_t   counter;
+        array_t     a(NUM_ELEMENTS);
+        array_t     b(NUM_ELEMENTS);
+
+        for (std::size_t i = 0; i != NUM_ELEMENTS; ++i)
+        {
+            a[i] = double(i);
+        }
+
+        fprintf(stdout, "hardware concurrency: %u\n", std::thread::hardware_concurrency());
+
+        // sequential baselines
+
+        counter_t::interval_type    forAll;
+        counter_t::interval_type    transform;
+        counter_t::interval_type    accumulate;
+        counter_t::interval_type    countIf;
+
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                stlsoft::for_all(b, scale());
+            }
+            counter.stop();
+            forAll = counter.get_microseconds();
+            report("for_all", "sequential", 0, b[NUM_ELEMENTS - 1], forAll, forAll);
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                std::transform(a.begin(), a.end(), b.begin(), root());
+            }
+            counter.stop();
+            transform = counter.get_microseconds();
+            report("transform", "sequential", 0, b[NUM_ELEMENTS - 1], transform, transform);
+        }
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += std::accumulate(a.begin(), a.end(), 0.0);
+            }
+            counter.stop();
+            accumulate = counter.get_microseconds();
+            report("accumulate", "sequential", 0, r, accumulate, accumulate);
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += static_cast<std::size_t>(std::count_if(a.begin(), a.end(), is_large()));
+            }
+            counter.stop();
+            countIf = counter.get_microseconds();
+            report("count_if", "sequential", 0, double(r), countIf, countIf);
+        }
+
+        // parallel, with from 1 to 16 threads
+
+        for (std::size_t t = 0; t != STLSOFT_NUM_ELEMENTS(threads); ++t)
+        {
+            stlsoft::work_stealing_pool pool(threads[t]);
+
+            {
+                counter.start();
+                for (int k = 0; k != ITERATIONS; ++k)
+                {
+                    stlsoft::par_for_all(b, scale(), STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN, pool);
+                }
+                counter.stop();
+                report("for_all", "parallel", threads[t], b[NUM_ELEMENTS - 1], counter.get_microseconds(), forAll);
+            }
+            {
+                counter.start();
+                for (int k = 0; k != ITERATIONS; ++k)
+                {
+                    stlsoft::par_transform(a, b.begin(), root(), STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN, pool);
+                }
+                counter.stop();
+                report("transform", "parallel", threads[t], b[NUM_ELEMENTS - 1], counter.get_microseconds(), transform);
+            }
+            {
+                double r = 0;
+
+                counter.start();
+                for (int k = 0; k != ITERATIONS; ++k)
+                {
+                    r += stlsoft::par_accumulate(a, 0.0, std::plus<double>(), STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN, pool);
+                }
+                counter.stop();
+                report("accumulate", "parallel", threads[t], r, counter.get_microseconds(), accumulate);
+            }
+            {
+                std::size_t r = 0;
+
+                counter.start();
+                for (int k = 0; k != ITERATIONS; ++k)
+                {
+                    r += stlsoft::par_count_if(a, is_large(), STLSOFT_ALGORITHMS_PARALLEL_DEFAULT_GRAIN, pool);
+                }
+                counter.stop();
+                report("count_if", "parallel", threads[t], double(r), counter.get_microseconds(), countIf);
+            }
+        }
+
+        // grain size, with the hardware concurrency
+
+        {
+            static std::size_t const grains[] = { 256, 1024, 4096, 16384, 65536, 262144 };
+
+            stlsoft::work_stealing_pool pool;
+
+            for (std::size_t g = 0; g != STLSOFT_NUM_ELEMENTS(grains); ++g)
+            {
+                char    name[41];
+                double  r   =   0;
+
+                sprintf(name, "grain=%lu", static_cast<unsigned long>(grains[g]));
+
+                counter.start();
+                for (int k = 0; k != ITERATIONS; ++k)
+                {
+                    r += stlsoft::par_accumulate(a, 0.0, std::plus<double>(), grains[g], pool);
+                }
+                counter.stop();
+                report("accumulate", name, pool.concurrency(), r, counter.get_microseconds(), accumulate);
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,318 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.algorithms.pod/entry.cpp
+ *
+ * Purpose: Benchmark for the POD algorithms - `stlsoft::pod_find()`,
+ *          `stlsoft::pod_count()`, `stlsoft::pod_replace()`,
+ *          `stlsoft::pod_min_max()`, `stlsoft::pod_equal()`,
+ *          `stlsoft::pod_copy_nt()` and `stlsoft::pod_fill_n_nt()` -
+ *          against their standard counterparts, for buffers sized to fit
+ *          in L1, L2, and the last-level cache, and in DRAM.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/algorithms/pod.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The number of bytes processed by each measurement, at every size
+    std::size_t const   BYTES_PER_TEST  =   std::size_t(1) << 28;
+
+    struct buffer_size_t
+    {
+        char const* name;
+        std::size_t cb;
+    };
+
+    static
+    void
+    report(
+        char const*                 level
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-5s %-24s: %12lu in %8ld us (%.2f GB/s)\n", level, name, static_cast<unsigned long>(result), static_cast<long>(us), double(BYTES_PER_TEST) / (1000.0 * double(us ? us : 1)));
+    }
+
+    template <typename T>
+    void
+    run(
+        char const*     level
+    ,   std::size_t     cb
+    )
+    {
+        std::size_t const   n           =   cb / sizeof(T);
+        std::size_t const   iterations  =   BYTES_PER_TEST / cb;
+        std::vector<T>      a(n);
+        std::vector<T>      b(n);
+        counter_t           counter;
+        unsigned            seed        =   1;
+        // Never present, so that searches traverse the whole buffer
+        T const             absent      =   T(101);
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            a[i] = T((seed >> 16) % 100);
+        }
+        b = a;
+
+        T* const        p   =   &a[0];
+        T* const        q   =   &b[0];
+        T const* const  cp  =   p;
+
+        // find
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += static_cast<std::size_t>(std::find(cp, cp + n, absent) - cp);
+            }
+            counter.stop();
+            report(level, "std::find", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += static_cast<std::size_t>(stlsoft::pod_find(cp, cp + n, absent) - cp);
+            }
+            counter.stop();
+            report(level, "pod_find", r, counter.get_microseconds());
+        }
+
+        // count
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += static_cast<std::size_t>(std::count(cp, cp + n, T(k % 100)));
+            }
+            counter.stop();
+            report(level, "std::count", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += stlsoft::pod_count(cp, cp + n, T(k % 100));
+            }
+            counter.stop();
+            report(level, "pod_count", r, counter.get_microseconds());
+        }
+
+        // replace (alternately replacing and restoring a value)
+
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                std::replace(p, p + n, T(k & 1), T(~k & 1));
+            }
+            counter.stop();
+            report(level, "std::replace", static_cast<std::size_t>(std::count(cp, cp + n, T(0))), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                stlsoft::pod_replace(p, p + n, T(k & 1), T(~k & 1));
+            }
+            counter.stop();
+            report(level, "pod_replace", static_cast<std::size_t>(std::count(cp, cp + n, T(0))), counter.get_microseconds());
+        }
+
+        // min/max
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                std::pair<T const*, T const*> const mm = std::minmax_element(cp, cp + n);
+
+                r += static_cast<std::size_t>(*mm.second - *mm.first);
+            }
+            counter.stop();
+            report(level, "std::minmax_element", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                T mn = T();
+                T mx = T();
+
+                stlsoft::pod_min_max(cp, cp + n, &mn, &mx);
+
+                r += static_cast<std::size_t>(mx - mn);
+            }
+            counter.stop();
+            report(level, "pod_min_max", r, counter.get_microseconds());
+        }
+
+        // equal
+
+        b = a;
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += std::equal(cp, cp + n, q);
+            }
+            counter.stop();
+            report(level, "std::equal", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                r += stlsoft::pod_equal(cp, cp + n, q);
+            }
+            counter.stop();
+            report(level, "pod_equal", r, counter.get_microseconds());
+        }
+
+        // copy
+
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                stlsoft::pod_copy(cp, cp + n, q);
+            }
+            counter.stop();
+            report(level, "pod_copy", static_cast<std::size_t>(q[n / 2]), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                stlsoft::pod_copy_nt(cp, cp + n, q);
+            }
+            counter.stop();
+            report(level, "pod_copy_nt", static_cast<std::size_t>(q[n / 2]), counter.get_microseconds());
+        }
+
+        // fill
+
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                std::fill_n(q, n, T(k % 100));
+            }
+            counter.stop();
+            report(level, "std::fill_n", static_cast<std::size_t>(q[n / 2]), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (std::size_t k = 0; k != iterations; ++k)
+            {
+                stlsoft::pod_fill_n_nt(q, n, T(k % 100));
+            }
+            counter.stop();
+            report(level, "pod_fill_n_nt", static_cast<std::size_t>(q[n / 2]), counter.get_microseconds());
+        }
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        // Nominal sizes for a current desktop processor; the LLC size is
+        // at the non-temporal threshold, so that pod_copy_nt() and
+        // pod_fill_n_nt() use streaming stores only for DRAM
+        static buffer_size_t const sizes[] =
+        {
+                { "L1",     16 * 1024           }
+            ,   { "L2",     256 * 1024          }
+            ,   { "LLC",    4 * 1024 * 1024     }
+            ,   { "DRAM",   64 * 1024 * 1024    }
+        };
+
+        fprintf(stdout, "int8_t:\n");
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+        {
+            run<signed char>(sizes[i].name, sizes[i].cb);
+        }
+
+        fprintf(stdout, "\nint32_t:\n");
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+        {
+            run<int>(sizes[i].name, sizes[i].cb);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,139 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.algorithms.unordered/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::unordered_unique()`, comparing the
+ *          hashed and linear forms over sequences of 1k to 10M elements.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/algorithms/unordered.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // Creates n integers drawn from n/2 distinct values
+    static
+    std::vector<int>
+    create_values(
+        std::size_t n
+    )
+    {
+        std::vector<int>    values(n);
+        unsigned            seed    =   1;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            values[i] = static_cast<int>(((seed >> 8) ^ (seed << 7)) % (n / 2 + 1));
+        }
+
+        return values;
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 n
+    ,   std::size_t                 numUnique
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-20s: %9lu elements, %9lu unique, in %10ld us\n", name, static_cast<unsigned long>(n), static_cast<unsigned long>(numUnique), static_cast<long>(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t           counter;
+        std::size_t const   maxLinear   =   100000;
+
+        for (std::size_t n = 1000; n <= 10000000; n *= 10)
+        {
+            std::vector<int> const  source = create_values(n);
+            std::size_t             numLinear = 0;
+
+            // linear, as is selected for non-hashable types
+
+            if (n <= maxLinear)
+            {
+                std::vector<int> values(source);
+
+                counter.start();
+                numLinear = static_cast<std::size_t>(stlsoft::ximpl_unordered::unordered_unique_linear_(values.begin(), values.end()) - values.begin());
+                counter.stop();
+
+                report("linear", n, numLinear, counter.get_microseconds());
+            }
+
+            // hashed
+
+            {
+                std::vector<int> values(source);
+
+                counter.start();
+                std::size_t const numHashed = static_cast<std::size_t>(stlsoft::unordered_unique(values.begin(), values.end()) - values.begin());
+                counter.stop();
+
+                report("unordered_unique()", n, numHashed, counter.get_microseconds());
+
+                if (0 != numLinear &&
+                    numLinear != numHashed)
+                {
+                    throw std::runtime_error("inconsistent results");
+                }
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
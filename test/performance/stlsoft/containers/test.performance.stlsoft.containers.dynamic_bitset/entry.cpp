@@ -0,0 +1,261 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.containers.dynamic_bitset/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::dynamic_bitset`, against
+ *          `std::vector<bool>` and `std::bitset`, for: counting, iterating
+ *          the set bits, intersection, and rank queries.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/containers/dynamic_bitset.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <bitset>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef stlsoft::dynamic_bitset<>           dynamic_bitset_t;
+
+    std::size_t const   NUM_BITS        =   1u << 22;
+    std::size_t const   NUM_QUERIES     =   1u << 16;
+
+    typedef std::bitset<NUM_BITS>               std_bitset_t;
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-10s %-24s: %10lu in %8ld us\n", category, name, static_cast<unsigned long>(result), static_cast<long>(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t                   counter;
+        std::vector<bool>           vb1(NUM_BITS), vb2(NUM_BITS);
+        std::vector<std_bitset_t>   sbs(2);     // on the heap, since large
+        dynamic_bitset_t            db1(NUM_BITS), db2(NUM_BITS);
+        std::vector<std::size_t>    queries(NUM_QUERIES);
+        unsigned                    seed    =   1;
+
+        // ~1/16 and ~1/4 densities
+        for (std::size_t i = 0; i != NUM_BITS; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            bool const b1 = 0 == ((seed >> 16) & 15);
+            bool const b2 = 0 == ((seed >> 20) & 3);
+
+            vb1[i] = b1;
+            vb2[i] = b2;
+            sbs[0][i] = b1;
+            sbs[1][i] = b2;
+            db1.set(i, b1);
+            db2.set(i, b2);
+        }
+
+        for (std::size_t i = 0; i != NUM_QUERIES; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            queries[i] = (std::size_t(seed) * 2654435761u) % NUM_BITS;
+        }
+
+        // count
+
+        {
+            counter.start();
+            std::size_t const r = static_cast<std::size_t>(std::count(vb1.begin(), vb1.end(), true));
+            counter.stop();
+            report("count", "std::vector<bool>", r, counter.get_microseconds());
+        }
+        {
+            counter.start();
+            std::size_t const r = sbs[0].count();
+            counter.stop();
+            report("count", "std::bitset", r, counter.get_microseconds());
+        }
+        {
+            counter.start();
+            std::size_t const r = db1.count();
+            counter.stop();
+            report("count", "dynamic_bitset", r, counter.get_microseconds());
+        }
+
+        // iterate set bits
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_BITS; ++i)
+            {
+                if (vb1[i])
+                {
+                    r += i;
+                }
+            }
+            counter.stop();
+            report("iterate", "std::vector<bool>", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_BITS; ++i)
+            {
+                if (sbs[0][i])
+                {
+                    r += i;
+                }
+            }
+            counter.stop();
+            report("iterate", "std::bitset", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t i = db1.find_first(); dynamic_bitset_t::npos != i; i = db1.find_next(i))
+            {
+                r += i;
+            }
+            counter.stop();
+            report("iterate", "dynamic_bitset", r, counter.get_microseconds());
+        }
+
+        // intersection
+
+        {
+            std::vector<bool> t(vb1);
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_BITS; ++i)
+            {
+                t[i] = t[i] && vb2[i];
+            }
+            counter.stop();
+            report("and", "std::vector<bool>", static_cast<std::size_t>(std::count(t.begin(), t.end(), true)), counter.get_microseconds());
+        }
+        {
+            std::vector<std_bitset_t> t(1, sbs[0]);
+
+            counter.start();
+            t[0] &= sbs[1];
+            counter.stop();
+            report("and", "std::bitset", t[0].count(), counter.get_microseconds());
+        }
+        {
+            dynamic_bitset_t t(db1);
+
+            counter.start();
+            t &= db2;
+            counter.stop();
+            report("and", "dynamic_bitset", t.count(), counter.get_microseconds());
+        }
+
+        // rank
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_QUERIES / 64; ++i)
+            {
+                r += static_cast<std::size_t>(std::count(vb1.begin(), vb1.begin() + queries[i], true));
+            }
+            counter.stop();
+            report("rank/64", "std::vector<bool>", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_QUERIES / 64; ++i)
+            {
+                r += db1.rank(queries[i]);
+            }
+            counter.stop();
+            report("rank/64", "dynamic_bitset", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            db1.build_rank_index();
+            counter.stop();
+            report("rank", "build_rank_index()", 0, counter.get_microseconds());
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_QUERIES; ++i)
+            {
+                r += db1.rank(queries[i]);
+            }
+            counter.stop();
+            report("rank", "dynamic_bitset+index", r, counter.get_microseconds());
+
+            r = 0;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_QUERIES; ++i)
+            {
+                r += db1.select(queries[i] / 32);
+            }
+            counter.stop();
+            report("select", "dynamic_bitset+index", r, counter.get_microseconds());
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
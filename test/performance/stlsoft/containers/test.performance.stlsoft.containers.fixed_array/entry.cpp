@@ -0,0 +1,331 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.containers.fixed_array/entry.cpp
+ *
+ * Purpose: Benchmark for matrix traversal and transpose over
+ *          `stlsoft::fixed_array_2d`, by element subscripting, by
+ *          `stlsoft::strided_array_view_2d`, and by pointer and stride,
+ *          with dense rows and with rows padded by
+ *          `stlsoft::calc_padded_row_stride()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/collections/strided_array_view.hpp>
+#include <stlsoft/containers/fixed_array.hpp>
+#include <stlsoft/memory/aligned_allocator.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef stlsoft::fixed_array_2d<
+        double
+    ,   stlsoft::aligned_allocator<double, 64>
+    >                                           matrix_t;
+    typedef stlsoft::strided_array_view_2d<
+        double
+    >                                           view_t;
+    typedef stlsoft::strided_array_view_2d<
+        double const
+    >                                           const_view_t;
+
+    // A power of two, so that dense rows alias in the cache
+    std::size_t const   N           =   1024;
+    int const           ITERATIONS  =   10;
+    std::size_t const   TILE        =   16;
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   double                      result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-10s %-28s: %14.0f in %8ld us (%.2f ns/element)\n", category, name, result, static_cast<long>(us), 1000.0 * double(us) / (double(N) * double(N) * ITERATIONS));
+    }
+
+    static
+    double
+    sum_columns(
+        const_view_t const& m
+    )
+    {
+        double r = 0;
+
+        for (std::size_t j = 0; j != m.dimension1(); ++j)
+        {
+            for (std::size_t i = 0; i != m.dimension0(); ++i)
+            {
+                r += m(i, j);
+            }
+        }
+
+        return r;
+    }
+
+    static
+    void
+    transpose_naive(
+        view_t const&       dest
+    ,   const_view_t const& src
+    )
+    {
+        for (std::size_t i = 0; i != src.dimension0(); ++i)
+        {
+            for (std::size_t j = 0; j != src.dimension1(); ++j)
+            {
+                dest(j, i) = src(i, j);
+            }
+        }
+    }
+
+    static
+    void
+    transpose_tiled(
+        view_t const&       dest
+    ,   const_view_t const& src
+    )
+    {
+        for (std::size_t i = 0; i < src.dimension0(); i += TILE)
+        {
+            for (std::size_t j = 0; j < src.dimension1(); j += TILE)
+            {
+                transpose_naive(dest.block(j, i, TILE, TILE), src.block(i, j, TILE, TILE));
+            }
+        }
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t       counter;
+        std::size_t     stride  =   stlsoft::calc_padded_row_stride<double>(N, 64);
+        matrix_t        a(N, N);
+        matrix_t        b(N, N);
+        matrix_t        pa(N, stride);
+        matrix_t        pb(N, stride);
+        view_t const    va      =   stlsoft::make_strided_array_view_2d(a);
+        view_t const    vb      =   stlsoft::make_strided_array_view_2d(b);
+        view_t const    vpa     =   stlsoft::make_strided_array_view_2d(pa).block(0, 0, N, N);
+        view_t const    vpb     =   stlsoft::make_strided_array_view_2d(pb).block(0, 0, N, N);
+
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            for (std::size_t j = 0; j != N; ++j)
+            {
+                a(i, j)     =   double(i * N + j);
+                vpa(i, j)   =   double(i * N + j);
+            }
+        }
+
+        // row-major traversal
+
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != N; ++j)
+                    {
+                        r += a(i, j);
+                    }
+                }
+            }
+            counter.stop();
+            report("rows", "fixed_array_2d::operator ()", r, counter.get_microseconds());
+        }
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != N; ++j)
+                    {
+                        r += a.at(i, j);
+                    }
+                }
+            }
+            counter.stop();
+            report("rows", "fixed_array_2d::at()", r, counter.get_microseconds());
+        }
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != N; ++j)
+                    {
+                        r += va(i, j);
+                    }
+                }
+            }
+            counter.stop();
+            report("rows", "strided_array_view_2d", r, counter.get_microseconds());
+        }
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                double const* const p = a.data();
+
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    double const* const row = p + i * a.stride0();
+
+                    for (std::size_t j = 0; j != N; ++j)
+                    {
+                        r += row[j];
+                    }
+                }
+            }
+            counter.stop();
+            report("rows", "data() + stride0()", r, counter.get_microseconds());
+        }
+
+        // column-major traversal
+
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += sum_columns(va);
+            }
+            counter.stop();
+            report("columns", "dense", r, counter.get_microseconds());
+        }
+        {
+            double r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += sum_columns(vpa);
+            }
+            counter.stop();
+            report("columns", "padded", r, counter.get_microseconds());
+        }
+
+        // transpose
+
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    for (std::size_t j = 0; j != N; ++j)
+                    {
+                        b(j, i) = a(i, j);
+                    }
+                }
+            }
+            counter.stop();
+            report("transpose", "fixed_array_2d::operator ()", b(N - 1, 0), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                transpose_naive(vb, va);
+            }
+            counter.stop();
+            report("transpose", "dense", vb(N - 1, 0), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                transpose_naive(vpb, vpa);
+            }
+            counter.stop();
+            report("transpose", "padded", vpb(N - 1, 0), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                transpose_tiled(vb, va);
+            }
+            counter.stop();
+            report("transpose", "dense, tiled", vb(N - 1, 0), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                transpose_tiled(vpb, vpa);
+            }
+            counter.stop();
+            report("transpose", "padded, tiled", vpb(N - 1, 0), counter.get_microseconds());
+        }
+        {
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                transpose_naive(vb, va.transpose().transpose());
+            }
+            counter.stop();
+            report("transpose", "dense, via transpose()", vb(N - 1, 0), counter.get_microseconds());
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
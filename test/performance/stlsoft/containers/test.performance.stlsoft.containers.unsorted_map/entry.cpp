@@ -0,0 +1,180 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.containers.unsorted_map/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::unsorted_map`, with the linear and the
+ *          hash-index lookup policies, for insertion, lookup, and
+ *          iteration, at sizes from 4 to 100,000 entries.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/containers/unsorted_map.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    typedef stlsoft::unsorted_map<
+        std::string
+    ,   std::string
+    >                                           linear_map_t;
+    typedef stlsoft::unsorted_map<
+        std::string
+    ,   std::string
+    ,   std::less<std::string>
+    ,   std::allocator<std::string>
+    ,   stlsoft::unsorted_map_hash_index<>
+    >                                           indexed_map_t;
+
+    // The total number of lookups at each size
+    std::size_t const   NUM_LOOKUPS     =   100000;
+    // Linear lookup is not measured above this size
+    std::size_t const   MAX_LINEAR_SIZE =   10000;
+
+    static
+    std::string
+    make_key(
+        std::size_t i
+    )
+    {
+        char    sz[41];
+
+        sprintf(sz, "X-Header-Field-%lu", static_cast<unsigned long>(i));
+
+        return sz;
+    }
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   std::size_t                 size
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 numOps
+    )
+    {
+        fprintf(stdout, "%-8s %7lu %-8s: %10lu in %8ld us (%.1f ns/op)\n", category, static_cast<unsigned long>(size), name, static_cast<unsigned long>(result), static_cast<long>(us), 1000.0 * double(us) / double(numOps));
+    }
+
+    template <typename M>
+    void
+    run(
+        char const*                     name
+    ,   std::vector<std::string> const& keys
+    ,   std::vector<std::size_t> const& queries
+    )
+    {
+        counter_t   counter;
+        M           m;
+        std::size_t r   =   0;
+
+        counter.start();
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            m.push_back(keys[i], keys[i]);
+        }
+        counter.stop();
+        report("insert", keys.size(), name, m.size(), counter.get_microseconds(), keys.size());
+
+        counter.start();
+        for (std::size_t i = 0; i != queries.size(); ++i)
+        {
+            r += static_cast<std::size_t>(m.find(keys[queries[i]]) - m.begin());
+        }
+        counter.stop();
+        report("find", keys.size(), name, r, counter.get_microseconds(), queries.size());
+
+        r = 0;
+
+        counter.start();
+        for (typename M::const_iterator i = m.begin(); m.end() != i; ++i)
+        {
+            r += (*i).second.size();
+        }
+        counter.stop();
+        report("iterate", keys.size(), name, r, counter.get_microseconds(), keys.size());
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        static std::size_t const sizes[] = { 4, 8, 16, 32, 100, 1000, 10000, 100000 };
+
+        for (std::size_t s = 0; s != STLSOFT_NUM_ELEMENTS(sizes); ++s)
+        {
+            std::size_t const           n       =   sizes[s];
+            std::vector<std::string>    keys(n);
+            std::vector<std::size_t>    queries(NUM_LOOKUPS);
+            unsigned                    seed    =   1;
+
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                keys[i] = make_key(i);
+            }
+            for (std::size_t i = 0; i != queries.size(); ++i)
+            {
+                seed = seed * 1103515245u + 12345u;
+
+                queries[i] = (seed >> 8) % n;
+            }
+
+            if (n <= MAX_LINEAR_SIZE)
+            {
+                run<linear_map_t>("linear", keys, queries);
+            }
+            run<indexed_map_t>("indexed", keys, queries);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
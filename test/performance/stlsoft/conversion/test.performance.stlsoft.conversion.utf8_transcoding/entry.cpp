@@ -0,0 +1,181 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.conversion.utf8_transcoding/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::utf8_to_wide` and
+ *          `stlsoft::wide_to_utf8` against the locale-based
+ *          `stlsoft::m2w` and `stlsoft::w2m`, for ASCII, Latin, CJK, and
+ *          emoji text.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/conversion/char_conversions.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <locale.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The number of bytes of UTF-8 in each corpus
+    std::size_t const   CORPUS_SIZE =   64 * 1024;
+    int const           ITERATIONS  =   1000;
+
+    struct corpus_t
+    {
+        char const* name;
+        char const* text;
+    };
+
+    static
+    void
+    report(
+        char const*                 corpus
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-6s %-16s: %10lu in %8ld us (%.2f GB/s)\n", corpus, name, static_cast<unsigned long>(result), static_cast<long>(us), double(CORPUS_SIZE) * ITERATIONS / (1000.0 * double(us ? us : 1)));
+    }
+
+    static
+    void
+    run(
+        corpus_t const& corpus
+    )
+    {
+        counter_t   counter;
+        std::string s;
+
+        for (; s.size() < CORPUS_SIZE; )
+        {
+            s += corpus.text;
+        }
+
+        std::wstring const  ws(stlsoft::utf8_to_wide(s).c_str());
+
+        // UTF-8 => wide
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += stlsoft::m2w(s).size();
+            }
+            counter.stop();
+            report(corpus.name, "m2w", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += stlsoft::utf8_to_wide(s).size();
+            }
+            counter.stop();
+            report(corpus.name, "utf8_to_wide", r, counter.get_microseconds());
+        }
+
+        // wide => UTF-8
+
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += stlsoft::w2m(ws).size();
+            }
+            counter.stop();
+            report(corpus.name, "w2m", r, counter.get_microseconds());
+        }
+        {
+            std::size_t r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                r += stlsoft::wide_to_utf8(ws).size();
+            }
+            counter.stop();
+            report(corpus.name, "wide_to_utf8", r, counter.get_microseconds());
+        }
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        // m2w and w2m use the locale's encoding, which must be UTF-8 for a
+        // like-for-like comparison
+        if (NULL == ::setlocale(LC_ALL, "C.UTF-8") &&
+            NULL == ::setlocale(LC_ALL, "en_US.UTF-8"))
+        {
+            fprintf(stderr, "%s: no UTF-8 locale available\n", program_name);
+
+            return EXIT_FAILURE;
+        }
+
+        static corpus_t const corpora[] =
+        {
+                { "ASCII",  "The quick brown fox jumps over the lazy dog. " }
+            ,   { "Latin",  "Fran\xC3\xA7ois a d\xC3\xA9j\xC3\xA0 pr\xC3\xA9" "f\xC3\xA9r\xC3\xA9 l'\xC3\xA9t\xC3\xA9 \xC3\xA0 No\xC3\xABl. " }
+            ,   { "CJK",    "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82" }
+            ,   { "emoji",  "\xF0\x9F\x98\x80\xF0\x9F\x8E\x89\xF0\x9F\x9A\x80 " }
+        };
+
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(corpora); ++i)
+        {
+            run(corpora[i]);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
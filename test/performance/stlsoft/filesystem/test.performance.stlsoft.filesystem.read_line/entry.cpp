@@ -0,0 +1,187 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.filesystem.read_line/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::read_line()`, comparing the `fgetc()`
+ *          reader, the block-buffered reader, and `std::getline()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/filesystem/read_line.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    static
+    void
+    create_text_file(
+        char const* path
+    ,   unsigned    cmb
+    )
+    {
+        FILE* const stm = fopen(path, "wb");
+
+        if (NULL == stm)
+        {
+            throw std::runtime_error("could not create test file");
+        }
+
+        char            line[256];
+        unsigned long   cb      =   0;
+        unsigned long   lim     =   1024ul * 1024ul * cmb;
+        unsigned        seed    =   1;
+
+        for (unsigned i = 0; cb < lim; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            unsigned const  len =   (seed >> 16) % 160u;
+
+            for (unsigned j = 0; j != len; ++j)
+            {
+                line[j] = static_cast<char>('a' + (i + j) % 26);
+            }
+
+            line[len] = '\n';
+
+            cb += fwrite(line, 1, len + 1, stm);
+        }
+
+        fclose(stm);
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   unsigned long               numLines
+    ,   unsigned long               numChars
+    ,   counter_t::interval_type    ms
+    ,   unsigned                    cmb
+    )
+    {
+        fprintf(stdout, "%-28s: %10lu lines, %12lu chars in %8ld ms (%.1f MB/s)\n", name, numLines, numChars, static_cast<long>(ms), (0 == ms) ? 0.0 : (1000.0 * cmb) / double(ms));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+    unsigned const      cmb             =   (argc < 2) ? 1024u : static_cast<unsigned>(atoi(argv[1]));
+    char const* const   path            =   (argc < 3) ? "test.performance.stlsoft.filesystem.read_line.txt" : argv[2];
+
+    try
+    {
+        counter_t   counter;
+
+        fprintf(stdout, "%s: creating %u MB file '%s' ...\n", program_name, cmb, path);
+
+        create_text_file(path, cmb);
+
+        // read_line(FILE*)
+        {
+            FILE*           stm         =   fopen(path, "rb");
+            std::string     line;
+            unsigned long   numLines    =   0;
+            unsigned long   numChars    =   0;
+
+            counter.start();
+            for (; stlsoft::read_line(stm, line); ++numLines)
+            {
+                numChars += static_cast<unsigned long>(line.size());
+            }
+            counter.stop();
+
+            fclose(stm);
+
+            report("read_line(FILE*)", numLines, numChars, counter.get_milliseconds(), cmb);
+        }
+
+        // read_line(read_from_FILE_buffered&)
+        {
+            FILE*           stm         =   fopen(path, "rb");
+            std::string     line;
+            unsigned long   numLines    =   0;
+            unsigned long   numChars    =   0;
+
+            counter.start();
+            stlsoft::readers::read_from_FILE_buffered   reader(stm);
+
+            for (; stlsoft::read_line(reader, line); ++numLines)
+            {
+                numChars += static_cast<unsigned long>(line.size());
+            }
+            counter.stop();
+
+            fclose(stm);
+
+            report("read_line(FILE_buffered&)", numLines, numChars, counter.get_milliseconds(), cmb);
+        }
+
+        // std::getline()
+        {
+            std::ifstream   stm(path, std::ios::binary);
+            std::string     line;
+            unsigned long   numLines    =   0;
+            unsigned long   numChars    =   0;
+
+            counter.start();
+            for (; std::getline(stm, line); ++numLines)
+            {
+                numChars += static_cast<unsigned long>(line.size());
+            }
+            counter.stop();
+
+            report("std::getline()", numLines, numChars, counter.get_milliseconds(), cmb);
+        }
+
+        remove(path);
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    remove(path);
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
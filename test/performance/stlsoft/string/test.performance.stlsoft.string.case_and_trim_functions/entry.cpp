@@ -0,0 +1,227 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string.case_and_trim_functions/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::make_upper()`, `stlsoft::make_lower()`
+ *          and the default-whitespace `stlsoft::trim_XXXX()` functions,
+ *          against per-character `toupper()`/`tolower()` and trimming by
+ *          an explicit character set.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/string/case_functions.hpp>
+#include <stlsoft/string/trim_functions.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef std::vector<std::string>            strings_t;
+
+    // Creates HTTP-header-like values, of between 0 and 7 spaces/tabs
+    // either side of between 4 and 67 mixed-case characters
+    static
+    strings_t
+    create_strings(
+        std::size_t n
+    )
+    {
+        strings_t   strings(n);
+        unsigned    seed    =   1;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            std::string& s = strings[i];
+
+            seed = seed * 1103515245u + 12345u;
+
+            s.append((seed >> 16) % 8, ' ');
+            s.append(1, '\t');
+
+            for (unsigned j = 4 + (seed >> 8) % 64; 0 != j; --j)
+            {
+                seed = seed * 1103515245u + 12345u;
+
+                s.append(1, "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_/ ;="[(seed >> 16) % 68]);
+            }
+
+            s.append((seed >> 12) % 8, ' ');
+        }
+
+        return strings;
+    }
+
+    static
+    char
+    toupper_char(char ch)
+    {
+        return static_cast<char>(::toupper(static_cast<unsigned char>(ch)));
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 check
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 cb
+    )
+    {
+        fprintf(stdout, "%-32s: check %10lu, in %8ld us (%.1f MB/s)\n", name, static_cast<unsigned long>(check), static_cast<long>(us), (0 == us) ? 0.0 : double(cb) / double(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t           counter;
+        strings_t const     source      =   create_strings(1000000);
+        std::size_t         cb          =   0;
+        std::size_t const   numPasses   =   10;
+
+        for (strings_t::const_iterator i = source.begin(); i != source.end(); ++i)
+        {
+            cb += i->size() * numPasses;
+        }
+
+        // case conversion
+
+        {
+            strings_t   strings(source);
+            std::size_t check = 0;
+
+            counter.start();
+            for (std::size_t pass = 0; pass != numPasses; ++pass)
+            {
+                for (strings_t::iterator i = strings.begin(); i != strings.end(); ++i)
+                {
+                    std::transform(i->begin(), i->end(), i->begin(), toupper_char);
+
+                    check += static_cast<unsigned char>((*i)[i->size() / 2]);
+                }
+            }
+            counter.stop();
+            report("std::transform(toupper)", check, counter.get_microseconds(), cb);
+        }
+
+        {
+            strings_t   strings(source);
+            std::size_t check = 0;
+
+            counter.start();
+            for (std::size_t pass = 0; pass != numPasses; ++pass)
+            {
+                for (strings_t::iterator i = strings.begin(); i != strings.end(); ++i)
+                {
+                    stlsoft::make_upper(*i);
+
+                    check += static_cast<unsigned char>((*i)[i->size() / 2]);
+                }
+            }
+            counter.stop();
+            report("make_upper()", check, counter.get_microseconds(), cb);
+        }
+
+        {
+            strings_t   strings(source);
+            std::size_t check = 0;
+
+            counter.start();
+            for (std::size_t pass = 0; pass != numPasses; ++pass)
+            {
+                for (strings_t::iterator i = strings.begin(); i != strings.end(); ++i)
+                {
+                    stlsoft::make_lower(*i);
+
+                    check += static_cast<unsigned char>((*i)[i->size() / 2]);
+                }
+            }
+            counter.stop();
+            report("make_lower()", check, counter.get_microseconds(), cb);
+        }
+
+        // trimming
+
+        {
+            std::size_t check = 0;
+
+            counter.start();
+            for (std::size_t pass = 0; pass != numPasses; ++pass)
+            {
+                for (strings_t::const_iterator i = source.begin(); i != source.end(); ++i)
+                {
+                    std::string s(*i);
+
+                    check += stlsoft::trim_all(s, " \n\r\t\v").size();
+                }
+            }
+            counter.stop();
+            report("trim_all(s, \" \\n\\r\\t\\v\")", check, counter.get_microseconds(), cb);
+        }
+
+        {
+            std::size_t check = 0;
+
+            counter.start();
+            for (std::size_t pass = 0; pass != numPasses; ++pass)
+            {
+                for (strings_t::const_iterator i = source.begin(); i != source.end(); ++i)
+                {
+                    std::string s(*i);
+
+                    check += stlsoft::trim_all(s).size();
+                }
+            }
+            counter.stop();
+            report("trim_all(s)", check, counter.get_microseconds(), cb);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,229 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string.hash_functions/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::hash_bytes()` against
+ *          `std::hash<std::string>`, for inputs from 8 bytes to 64KB, and
+ *          for lookup in an unordered map keyed by `std::string` from
+ *          keys held as `stlsoft::string_view`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/string/hash_functions.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The number of bytes hashed by each throughput measurement
+    std::size_t const   BYTES_PER_TEST  =   std::size_t(1) << 28;
+    std::size_t const   NUM_KEYS        =   1 << 16;
+    int const           ITERATIONS      =   20;
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 numOps
+    ,   std::size_t                 cbPerOp
+    )
+    {
+        fprintf(stdout, "%-6s %-28s: %20lu in %8ld us (%7.2f ns/op, %6.2f GB/s)\n", category, name, static_cast<unsigned long>(result), static_cast<long>(us), 1000.0 * double(us) / double(numOps), double(numOps) * double(cbPerOp) / (1000.0 * double(us ? us : 1)));
+    }
+
+    static
+    void
+    run_throughput(
+        std::size_t cb
+    )
+    {
+        std::size_t const   numOps  =   BYTES_PER_TEST / cb;
+        std::string const   s(cb, 'x');
+        char                category[21];
+        counter_t           counter;
+
+        ::sprintf(category, "%lu", static_cast<unsigned long>(cb));
+
+        {
+            std::hash<std::string> const    h       =   std::hash<std::string>();
+            std::size_t                     r       =   0;
+
+            counter.start();
+            for (std::size_t i = 0; i != numOps; ++i)
+            {
+                r += h(s);
+            }
+            counter.stop();
+            report(category, "std::hash<std::string>", r, counter.get_microseconds(), numOps, cb);
+        }
+        {
+            stlsoft::ss_uint64_t            r       =   0;
+
+            counter.start();
+            for (std::size_t i = 0; i != numOps; ++i)
+            {
+                r += stlsoft::hash_bytes(s.data(), cb);
+            }
+            counter.stop();
+            report(category, "stlsoft::hash_bytes()", static_cast<std::size_t>(r), counter.get_microseconds(), numOps, cb);
+        }
+    }
+
+    template <typename M>
+    void
+    fill(
+        M&                                      m
+    ,   std::vector<std::string> const&         keys
+    )
+    {
+        for (std::size_t i = 0; i != keys.size(); ++i)
+        {
+            m[keys[i]] = static_cast<int>(i);
+        }
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t   counter;
+
+        // throughput
+
+        static std::size_t const sizes[] =
+        {
+            8, 16, 32, 64, 256, 1024, 4096, 65536
+        };
+
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+        {
+            run_throughput(sizes[i]);
+        }
+
+        // lookup, by keys too long for the small-string optimisation
+
+        std::vector<std::string>            keys;
+        std::vector<stlsoft::string_view>   views;
+
+        keys.reserve(NUM_KEYS);
+        views.reserve(NUM_KEYS);
+        for (std::size_t i = 0; i != NUM_KEYS; ++i)
+        {
+            char sz[101];
+
+            keys.push_back(std::string(sz, static_cast<std::size_t>(::sprintf(sz, "/usr/include/component-%05lu/header.hpp", static_cast<unsigned long>(i)))));
+        }
+        for (std::size_t i = 0; i != NUM_KEYS; ++i)
+        {
+            views.push_back(stlsoft::string_view(keys[i].data(), keys[i].size()));
+        }
+
+        {
+            std::unordered_map<std::string, int>    m;
+            long                                    r   =   0;
+
+            fill(m, keys);
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != NUM_KEYS; ++i)
+                {
+                    r += m.find(std::string(views[i].data(), views[i].size()))->second;
+                }
+            }
+            counter.stop();
+            report("lookup", "std::hash, by conversion", static_cast<std::size_t>(r), counter.get_microseconds(), NUM_KEYS * ITERATIONS, views[0].size());
+        }
+        {
+            std::unordered_map<
+                std::string
+            ,   int
+            ,   stlsoft::string_hash
+            ,   stlsoft::string_equal_to
+            >                                       m;
+            long                                    r   =   0;
+
+            fill(m, keys);
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != NUM_KEYS; ++i)
+                {
+                    r += m.find(std::string(views[i].data(), views[i].size()))->second;
+                }
+            }
+            counter.stop();
+            report("lookup", "string_hash, by conversion", static_cast<std::size_t>(r), counter.get_microseconds(), NUM_KEYS * ITERATIONS, views[0].size());
+
+#if __cplusplus >= 202002L
+
+            r = 0;
+
+            counter.start();
+            for (int k = 0; k != ITERATIONS; ++k)
+            {
+                for (std::size_t i = 0; i != NUM_KEYS; ++i)
+                {
+                    r += m.find(views[i])->second;
+                }
+            }
+            counter.stop();
+            report("lookup", "string_hash, heterogeneous", static_cast<std::size_t>(r), counter.get_microseconds(), NUM_KEYS * ITERATIONS, views[0].size());
+#endif /* C++20+ */
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,182 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string.replace_functions/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::replace()`, `stlsoft::replace_copy()`
+ *          and `stlsoft::replace_multiple()`, against in-place
+ *          replacement of each match.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/string/replace_functions.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <stddef.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The in-place algorithm, which shifts the tail of the string for
+    // each match whose replacement differs in length
+    static
+    std::string&
+    replace_in_place(
+        std::string&        str
+    ,   std::string const&  f
+    ,   std::string const&  r
+    )
+    {
+        for (std::string::size_type p = str.find(f); std::string::npos != p; p = str.find(f, p + r.size()))
+        {
+            str.replace(p, f.size(), r);
+        }
+
+        return str;
+    }
+
+    static
+    std::string
+    make_subject(
+        std::size_t   cch
+    ,   std::size_t   numMatches
+    )
+    {
+        std::string s(cch, '-');
+
+        for (std::size_t i = 0; i != cch; ++i)
+        {
+            s[i] = static_cast<char>('a' + (i % 23));
+        }
+
+        std::size_t const step = cch / (numMatches + 1);
+
+        for (std::size_t i = 1; i <= numMatches; ++i)
+        {
+            s.replace(i * step, 5, "{KEY}");
+        }
+
+        return s;
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                   numMatches
+    ,   std::size_t                   cch
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-26s: %8lu matches, result %10lu chars, in %10ld us\n", name, static_cast<unsigned long>(numMatches), static_cast<unsigned long>(cch), static_cast<long>(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t                   counter;
+        std::size_t const           cch         =   10 * 1024 * 1024;
+        std::string const           f("{KEY}");
+        std::string const           r("replacement-value");
+        std::size_t const             counts[]    =   { 1000, 5000, 20000 };
+
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(counts); ++i)
+        {
+            std::string const subject = make_subject(cch, counts[i]);
+
+            {
+                std::string s(subject);
+
+                counter.start();
+                replace_in_place(s, f, r);
+                counter.stop();
+
+                report("in-place replace", counts[i], s.size(), counter.get_microseconds());
+            }
+
+            {
+                std::string s(subject);
+
+                counter.start();
+                stlsoft::replace(s, f, r);
+                counter.stop();
+
+                report("stlsoft::replace", counts[i], s.size(), counter.get_microseconds());
+            }
+
+            {
+                std::string s(subject);
+                std::string d(subject.size() + counts[i] * (r.size() - f.size()), '\0');
+
+                counter.start();
+                std::size_t const n = stlsoft::replace_copy(s, f, r, &d[0], d.size());
+                counter.stop();
+
+                report("stlsoft::replace_copy", counts[i], n, counter.get_microseconds());
+            }
+
+            {
+                std::string                             s(subject);
+                std::pair<std::string, std::string>     pairs[] =
+                {
+                        std::make_pair(std::string("{KEY}"), r)
+                    ,   std::make_pair(std::string("{OTHER}"), std::string("x"))
+                    ,   std::make_pair(std::string("{THIRD}"), std::string("yy"))
+                };
+
+                counter.start();
+                stlsoft::replace_multiple(s, &pairs[0], &pairs[0] + STLSOFT_NUM_ELEMENTS(pairs));
+                counter.stop();
+
+                report("stlsoft::replace_multiple", counts[i], s.size(), counter.get_microseconds());
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,209 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string.simple_string/entry.cpp
+ *
+ * Purpose: Benchmark for building a `stlsoft::simple_string` by appending,
+ *          with the geometric and the exact growth policies, against
+ *          `std::string`, and for formatting in place with
+ *          `resize_and_overwrite()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/string/simple_string.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef stlsoft::simple_string              geometric_string_t;
+    typedef stlsoft::basic_simple_string<
+        char
+    ,   stlsoft::stlsoft_char_traits<char>
+    ,   stlsoft::allocator_selector<char>::allocator_type
+    ,   stlsoft::simple_string_exact_growth
+    >                                           exact_string_t;
+
+    std::size_t const   NUM_APPENDS         =   1000000;
+    // The exact policy is quadratic, so is measured for fewer appends
+    std::size_t const   NUM_APPENDS_EXACT   =   100000;
+    std::size_t const   NUM_FORMATS         =   1000000;
+
+    static
+    void
+    report(
+        char const*                 category
+    ,   char const*                 name
+    ,   std::size_t                 result
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 numOps
+    )
+    {
+        fprintf(stdout, "%-8s %-28s: %10lu in %8ld us (%.2f ns/op)\n", category, name, static_cast<unsigned long>(result), static_cast<long>(us), 1000.0 * double(us) / double(numOps));
+    }
+
+    template <typename S>
+    std::size_t
+    append_chars(
+        std::size_t n
+    )
+    {
+        S s;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            s += static_cast<char>('a' + i % 26);
+        }
+
+        return s.size();
+    }
+
+    template <typename S>
+    std::size_t
+    append_strings(
+        std::size_t n
+    )
+    {
+        S s;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            s.append("key=value;", 10);
+        }
+
+        return s.size();
+    }
+
+    struct format_number
+    {
+        explicit format_number(std::size_t value)
+            : n(value)
+        {}
+
+        std::size_t operator ()(char* p, std::size_t cch) const
+        {
+            return cch + static_cast<std::size_t>(::sprintf(p + cch - 24, "%lu,", static_cast<unsigned long>(n))) - 24;
+        }
+
+        std::size_t n;
+    };
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t   counter;
+
+        // single-character appends
+
+        {
+            counter.start();
+            std::size_t const r = append_chars<std::string>(NUM_APPENDS);
+            counter.stop();
+            report("char", "std::string", r, counter.get_microseconds(), NUM_APPENDS);
+        }
+        {
+            counter.start();
+            std::size_t const r = append_chars<geometric_string_t>(NUM_APPENDS);
+            counter.stop();
+            report("char", "simple_string (geometric)", r, counter.get_microseconds(), NUM_APPENDS);
+        }
+        {
+            counter.start();
+            std::size_t const r = append_chars<exact_string_t>(NUM_APPENDS_EXACT);
+            counter.stop();
+            report("char", "simple_string (exact)", r, counter.get_microseconds(), NUM_APPENDS_EXACT);
+        }
+
+        // short-string appends
+
+        {
+            counter.start();
+            std::size_t const r = append_strings<std::string>(NUM_APPENDS);
+            counter.stop();
+            report("string", "std::string", r, counter.get_microseconds(), NUM_APPENDS);
+        }
+        {
+            counter.start();
+            std::size_t const r = append_strings<geometric_string_t>(NUM_APPENDS);
+            counter.stop();
+            report("string", "simple_string (geometric)", r, counter.get_microseconds(), NUM_APPENDS);
+        }
+        {
+            counter.start();
+            std::size_t const r = append_strings<exact_string_t>(NUM_APPENDS_EXACT);
+            counter.stop();
+            report("string", "simple_string (exact)", r, counter.get_microseconds(), NUM_APPENDS_EXACT);
+        }
+
+        // formatting numbers onto the end of a string
+
+        {
+            geometric_string_t  s;
+            char                sz[21];
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_FORMATS; ++i)
+            {
+                s.append(sz, static_cast<std::size_t>(::sprintf(sz, "%lu,", static_cast<unsigned long>(i))));
+            }
+            counter.stop();
+            report("format", "sprintf() + append()", s.size(), counter.get_microseconds(), NUM_FORMATS);
+        }
+        {
+            geometric_string_t  s;
+
+            counter.start();
+            for (std::size_t i = 0; i != NUM_FORMATS; ++i)
+            {
+                s.resize_and_overwrite(s.size() + 24, format_number(i));
+            }
+            counter.stop();
+            report("format", "resize_and_overwrite()", s.size(), counter.get_microseconds(), NUM_FORMATS);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
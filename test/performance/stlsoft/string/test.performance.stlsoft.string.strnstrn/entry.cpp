@@ -0,0 +1,222 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.string.strnstrn/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::c_string::strnstrn()` and
+ *          `stlsoft::c_string::strnstrn_searcher`, against a naive
+ *          first-character-then-compare search and `std::search()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/string/c_string/strnstrn.h>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The algorithm previously used by stlsoft_C_strnstrn()
+    static
+    char const*
+    naive_strnstrn(
+        char const* s1
+    ,   size_t      n1
+    ,   char const* s2
+    ,   size_t      n2
+    )
+    {
+        if (0 == n2)
+        {
+            return s1;
+        }
+
+        for (; n1 >= n2; --n1, ++s1)
+        {
+            if (*s1 == *s2)
+            {
+                size_t i;
+
+                for (i = 1; i != n2; ++i)
+                {
+                    if (s1[i] != s2[i])
+                    {
+                        break;
+                    }
+                }
+
+                if (i == n2)
+                {
+                    return s1;
+                }
+            }
+        }
+
+        return NULL;
+    }
+
+    // Counts the (non-overlapping) occurrences of the needle, so that each
+    // algorithm is measured over the whole haystack
+    template <typename F>
+    static
+    size_t
+    count_matches(
+        std::string const&  haystack
+    ,   std::string const&  needle
+    ,   F                   f
+    )
+    {
+        size_t          n   =   0;
+        char const*     p   =   haystack.data();
+        char const*     e   =   p + haystack.size();
+
+        for (; NULL != (p = f(p, static_cast<size_t>(e - p), needle.data(), needle.size())); p += needle.size())
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+    struct strnstrn_fn
+    {
+        char const* operator ()(char const* s1, size_t n1, char const* s2, size_t n2) const
+        {
+            return stlsoft::c_string::strnstrn(s1, n1, s2, n2);
+        }
+    };
+
+    struct searcher_fn
+    {
+        explicit searcher_fn(stlsoft::c_string::strnstrn_searcher const& searcher)
+            : searcher(searcher)
+        {}
+
+        char const* operator ()(char const* s1, size_t n1, char const* , size_t ) const
+        {
+            return searcher.find(s1, n1);
+        }
+
+        stlsoft::c_string::strnstrn_searcher const& searcher;
+    };
+
+    struct std_search_fn
+    {
+        char const* operator ()(char const* s1, size_t n1, char const* s2, size_t n2) const
+        {
+            char const* const r = std::search(s1, s1 + n1, s2, s2 + n2);
+
+            return (s1 + n1 == r) ? NULL : r;
+        }
+    };
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   size_t                      needleLength
+    ,   size_t                      numMatches
+    ,   counter_t::interval_type    us
+    ,   size_t                      cb
+    )
+    {
+        fprintf(stdout, "%-20s: needle %3lu, %6lu matches, in %8ld us (%.1f MB/s)\n", name, static_cast<unsigned long>(needleLength), static_cast<unsigned long>(numMatches), static_cast<long>(us), (0 == us) ? 0.0 : double(cb) / double(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t       counter;
+        size_t const    cb          =   64 * 1024 * 1024;
+        size_t const    lengths[]   =   { 2, 4, 8, 16, 31, 32, 64, 256 };
+        std::string     haystack(cb, ' ');
+        unsigned        seed        =   1;
+
+        // English-like letter distribution, which makes first-character
+        // matches common
+        for (size_t i = 0; i != cb; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            haystack[i] = "eeeeetttaaooiinnsshhrdlcumwfgypbvkjxqz      "[(seed >> 16) % 44];
+        }
+
+        for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(lengths); ++i)
+        {
+            std::string const needle = haystack.substr(cb / 2, lengths[i]);
+
+            counter.start();
+            size_t const n0 = count_matches(haystack, needle, naive_strnstrn);
+            counter.stop();
+            report("naive", lengths[i], n0, counter.get_microseconds(), cb);
+
+            counter.start();
+            size_t const n1 = count_matches(haystack, needle, std_search_fn());
+            counter.stop();
+            report("std::search", lengths[i], n1, counter.get_microseconds(), cb);
+
+            counter.start();
+            size_t const n2 = count_matches(haystack, needle, strnstrn_fn());
+            counter.stop();
+            report("strnstrn", lengths[i], n2, counter.get_microseconds(), cb);
+
+            stlsoft::c_string::strnstrn_searcher const searcher(needle.data(), needle.size());
+
+            counter.start();
+            size_t const n3 = count_matches(haystack, needle, searcher_fn(searcher));
+            counter.stop();
+            report("strnstrn_searcher", lengths[i], n3, counter.get_microseconds(), cb);
+
+            if (n0 != n1 || n0 != n2 || n0 != n3)
+            {
+                throw std::runtime_error("inconsistent results");
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,412 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.synch.rings/entry.cpp
+ *
+ * Purpose: Benchmark for the throughput and latency (median, p99, p99.9,
+ *          maximum) of `stlsoft::spsc_ring`, `stlsoft::mpmc_ring` and
+ *          (on UNIX) `unixstl::blocking_ring`, singly and in batches,
+ *          against a bounded queue of `std::deque` guarded by
+ *          `std::mutex` and `std::condition_variable`, for 1 to 4
+ *          producers and consumers.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/synch/mpmc_ring.hpp>
+#include <stlsoft/synch/spsc_ring.hpp>
+#include <platformstl/platformstl.h>
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+# include <unixstl/synch/blocking_ring.hpp>
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef std::chrono::steady_clock           clock_t_;
+    // Each item is the time, in nanoseconds, at which it was pushed
+    typedef long long                           item_t;
+
+    // Divisible by each consumer count, so that the consumers share the
+    // items exactly
+    std::size_t const   ITEMS_PER_PRODUCER  =   120000;
+    std::size_t const   CAPACITY            =   1024;
+    std::size_t const   BATCH_SIZE          =   16;
+
+    typedef std::vector<long>                   latencies_t;
+
+    item_t now_ns()
+    {
+        return static_cast<item_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t_::now().time_since_epoch()).count());
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 numProducers
+    ,   std::size_t                 numConsumers
+    ,   counter_t::interval_type    us
+    ,   latencies_t&                latencies
+    )
+    {
+        std::sort(latencies.begin(), latencies.end());
+
+        std::size_t const   n   =   latencies.size();
+
+        fprintf(stdout, "%-32s %lu:%lu : %7.2f M items/s; latency (ns): p50 %7ld, p99 %8ld, p99.9 %8ld, max %9ld\n", name, static_cast<unsigned long>(numProducers), static_cast<unsigned long>(numConsumers), double(n) / double(us ? us : 1), latencies[n / 2], latencies[n * 99 / 100], latencies[n * 999 / 1000], latencies[n - 1]);
+    }
+
+    // Adapts a non-blocking ring to blocking push_n() and pop_n() by
+    // yielding while it is full or empty
+    template <typename R>
+    struct yielding
+    {
+        R   ring;
+
+        yielding()
+        {}
+        explicit yielding(std::size_t capacity)
+            : ring(capacity)
+        {}
+
+        void push_n(item_t const* items, std::size_t n)
+        {
+            if (1 == n)
+            {
+                for (; !ring.try_push(*items); )
+                {
+                    std::this_thread::yield();
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i != n; )
+                {
+                    std::size_t const m = ring.try_push_n(items + i, n - i);
+
+                    if (0 == m)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    i += m;
+                }
+            }
+        }
+
+        std::size_t pop_n(item_t* items, std::size_t maxCount)
+        {
+            for (;;)
+            {
+                std::size_t const n = (1 == maxCount) ? (ring.try_pop(*items) ? 1u : 0u) : ring.try_pop_n(items, maxCount);
+
+                if (0 != n)
+                {
+                    return n;
+                }
+
+                std::this_thread::yield();
+            }
+        }
+    };
+
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+
+    template <typename R>
+    struct blocking
+    {
+        unixstl::blocking_ring<R>   ring;
+
+        blocking()
+        {}
+        explicit blocking(std::size_t capacity)
+            : ring(capacity)
+        {}
+
+        void push_n(item_t const* items, std::size_t n)
+        {
+            if (1 == n)
+            {
+                ring.push(*items);
+            }
+            else
+            {
+                ring.push_n(items, n);
+            }
+        }
+
+        std::size_t pop_n(item_t* items, std::size_t maxCount)
+        {
+            if (1 == maxCount)
+            {
+                ring.pop(*items);
+
+                return 1;
+            }
+            else
+            {
+                return ring.pop_n(items, maxCount);
+            }
+        }
+    };
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+
+    // The baseline: a bounded std::deque, guarded by a mutex, with
+    // condition variables for not-full and not-empty
+    struct locked_deque
+    {
+        std::mutex                  mx;
+        std::condition_variable     notFull;
+        std::condition_variable     notEmpty;
+        std::deque<item_t>          items;
+        std::size_t const           capacity;
+
+        explicit locked_deque(std::size_t capacity)
+            : capacity(capacity)
+        {}
+
+        void push_n(item_t const* values, std::size_t n)
+        {
+            for (std::size_t i = 0; i != n; )
+            {
+                std::unique_lock<std::mutex> lock(mx);
+
+                notFull.wait(lock, [this]() { return items.size() < capacity; });
+
+                for (; i != n && items.size() < capacity; ++i)
+                {
+                    items.push_back(values[i]);
+                }
+
+                lock.unlock();
+                notEmpty.notify_all();
+            }
+        }
+
+        std::size_t pop_n(item_t* values, std::size_t maxCount)
+        {
+            std::unique_lock<std::mutex> lock(mx);
+
+            notEmpty.wait(lock, [this]() { return !items.empty(); });
+
+            std::size_t n = 0;
+
+            for (; n != maxCount && !items.empty(); ++n)
+            {
+                values[n] = items.front();
+                items.pop_front();
+            }
+
+            lock.unlock();
+            notFull.notify_all();
+
+            return n;
+        }
+    };
+
+    // Runs numProducers threads, each pushing ITEMS_PER_PRODUCER
+    // time-stamped items in batches of batchSize, and numConsumers
+    // threads, each popping its share in batches of up to batchSize, and
+    // recording the latency of each item
+    template <typename Q>
+    counter_t::interval_type
+    run(
+        Q&              q
+    ,   std::size_t     numProducers
+    ,   std::size_t     numConsumers
+    ,   std::size_t     batchSize
+    ,   latencies_t&    latencies
+    )
+    {
+        std::size_t const           perConsumer = numProducers * ITEMS_PER_PRODUCER / numConsumers;
+        std::vector<latencies_t>    perThread(numConsumers, latencies_t(perConsumer));
+        std::vector<std::thread>    threads;
+        counter_t                   counter;
+
+        counter.start();
+        for (std::size_t c = 0; c != numConsumers; ++c)
+        {
+            threads.push_back(std::thread([&q, &perThread, batchSize, perConsumer, c]() {
+
+                latencies_t&        l = perThread[c];
+                std::vector<item_t> buff(batchSize);
+
+                for (std::size_t i = 0; i != perConsumer; )
+                {
+                    std::size_t const   n   =   q.pop_n(&buff[0], std::min(batchSize, perConsumer - i));
+                    item_t const        t   =   now_ns();
+
+                    for (std::size_t j = 0; j != n; ++j, ++i)
+                    {
+                        l[i] = static_cast<long>(t - buff[j]);
+                    }
+                }
+            }));
+        }
+        for (std::size_t p = 0; p != numProducers; ++p)
+        {
+            threads.push_back(std::thread([&q, batchSize]() {
+
+                std::vector<item_t> buff(batchSize);
+
+                for (std::size_t i = 0; i != ITEMS_PER_PRODUCER; i += batchSize)
+                {
+                    item_t const t = now_ns();
+
+                    std::fill(buff.begin(), buff.end(), t);
+
+                    q.push_n(&buff[0], batchSize);
+                }
+            }));
+        }
+        for (std::size_t t = 0; t != threads.size(); ++t)
+        {
+            threads[t].join();
+        }
+        counter.stop();
+
+        latencies.clear();
+        for (std::size_t c = 0; c != numConsumers; ++c)
+        {
+            latencies.insert(latencies.end(), perThread[c].begin(), perThread[c].end());
+        }
+
+        return counter.get_microseconds();
+    }
+
+    template <typename Q>
+    void
+    run_and_report(
+        char const*     name
+    ,   Q&              q
+    ,   std::size_t     numProducers
+    ,   std::size_t     numConsumers
+    ,   std::size_t     batchSize
+    ,   latencies_t&    latencies
+    )
+    {
+        counter_t::interval_type const us = run(q, numProducers, numConsumers, batchSize, latencies);
+
+        report(name, numProducers, numConsumers, us, latencies);
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        typedef stlsoft::spsc_ring<item_t, CAPACITY>    spsc_t;
+        typedef stlsoft::mpmc_ring<item_t>              mpmc_t;
+
+        latencies_t latencies;
+
+        static struct
+        {
+            std::size_t numProducers;
+            std::size_t numConsumers;
+        } const configurations[] =
+        {
+            { 1, 1 }, { 2, 2 }, { 4, 4 }, { 1, 4 }, { 4, 1 }
+        };
+
+        for (std::size_t k = 0; k != STLSOFT_NUM_ELEMENTS(configurations); ++k)
+        {
+            std::size_t const   P   =   configurations[k].numProducers;
+            std::size_t const   C   =   configurations[k].numConsumers;
+
+            for (std::size_t batchSize = 1; batchSize <= BATCH_SIZE; batchSize *= BATCH_SIZE)
+            {
+                char const* const batched = (1 == batchSize) ? "" : " (batch)";
+                char              name[101];
+
+                if (1 == P && 1 == C)
+                {
+                    {
+                        yielding<spsc_t> q;
+
+                        ::sprintf(name, "spsc_ring%s", batched);
+                        run_and_report(name, q, P, C, batchSize, latencies);
+                    }
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+                    {
+                        blocking<spsc_t> q;
+
+                        ::sprintf(name, "blocking_ring<spsc_ring>%s", batched);
+                        run_and_report(name, q, P, C, batchSize, latencies);
+                    }
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+                }
+                {
+                    yielding<mpmc_t> q(CAPACITY);
+
+                    ::sprintf(name, "mpmc_ring%s", batched);
+                    run_and_report(name, q, P, C, batchSize, latencies);
+                }
+#if defined(PLATFORMSTL_OS_IS_UNIX)
+                {
+                    blocking<mpmc_t> q(CAPACITY);
+
+                    ::sprintf(name, "blocking_ring<mpmc_ring>%s", batched);
+                    run_and_report(name, q, P, C, batchSize, latencies);
+                }
+#endif /* PLATFORMSTL_OS_IS_UNIX */
+                {
+                    locked_deque q(CAPACITY);
+
+                    ::sprintf(name, "mutex + deque%s", batched);
+                    run_and_report(name, q, P, C, batchSize, latencies);
+                }
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
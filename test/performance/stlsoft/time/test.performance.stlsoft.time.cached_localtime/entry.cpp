@@ -0,0 +1,198 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.time.cached_localtime/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::cached_localtime()` against
+ *          `localtime()`, and of the per-call cost of the time string
+ *          access shims, against the two-pass strftime() conversion they
+ *          previously used.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/shims/access/string/std/chrono.hpp>
+#include <stlsoft/time/cached_localtime.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The number of conversions per second of time, as for a busy log
+    long const  CALLS_PER_SECOND    =   1000;
+    long const  NUM_CALLS           =   1000000;
+
+    // The conversion previously used by c_str_data_a(struct tm const*)
+    static
+    std::string
+    two_pass_strftime(
+        struct tm const* t
+    )
+    {
+        char        fmt[101];
+        size_t const n0 = ::strftime(&fmt[0], sizeof(fmt), "%a %b %%d %%H:%%M:%%S %%Y", t);
+        std::string s(n0 + 2, '\0');
+        size_t const n1 = ::strftime(&s[0], 1 + s.size(), fmt, t);
+
+        s.resize(n1);
+
+        return s;
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   unsigned long               result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-36s: %10lu in %8ld us (%.1f ns/call)\n", name, result, static_cast<long>(us), 1000.0 * double(us) / double(NUM_CALLS));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t       counter;
+        time_t const    t0  =   ::time(NULL);
+
+        // conversion
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                time_t const t = t0 + i / CALLS_PER_SECOND;
+
+                r += static_cast<unsigned long>(::localtime(&t)->tm_sec);
+            }
+            counter.stop();
+            report("localtime()", r, counter.get_microseconds());
+        }
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                time_t const    t   =   t0 + i / CALLS_PER_SECOND;
+                struct tm       tm;
+
+                stlsoft::cached_localtime(&tm, &t);
+
+                r += static_cast<unsigned long>(tm.tm_sec);
+            }
+            counter.stop();
+            report("cached_localtime()", r, counter.get_microseconds());
+        }
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                time_t const    t   =   t0 + i;
+                struct tm       tm;
+
+                stlsoft::cached_localtime(&tm, &t);
+
+                r += static_cast<unsigned long>(tm.tm_sec);
+            }
+            counter.stop();
+            report("cached_localtime() (1 call/sec)", r, counter.get_microseconds());
+        }
+
+        // formatting
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                time_t const t = t0 + i / CALLS_PER_SECOND;
+
+                r += static_cast<unsigned long>(two_pass_strftime(::localtime(&t)).size());
+            }
+            counter.stop();
+            report("localtime() + 2 x strftime()", r, counter.get_microseconds());
+        }
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                time_t const t = t0 + i / CALLS_PER_SECOND;
+
+                r += static_cast<unsigned long>(stlsoft::c_str_data_a(::localtime(&t)).size());
+            }
+            counter.stop();
+            report("localtime() + c_str_data_a(tm*)", r, counter.get_microseconds());
+        }
+        {
+            std::chrono::system_clock::time_point const tp0 = std::chrono::system_clock::from_time_t(t0);
+
+            unsigned long r = 0;
+
+            counter.start();
+            for (long i = 0; i != NUM_CALLS; ++i)
+            {
+                std::chrono::system_clock::time_point const tp = tp0 + std::chrono::milliseconds(i);
+
+                r += static_cast<unsigned long>(stlsoft::c_str_data_a(tp).size());
+            }
+            counter.stop();
+            report("c_str_data_a(time_point)", r, counter.get_microseconds());
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,169 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.time.compiled_strftime_format/entry.cpp
+ *
+ * Purpose: Benchmark for `stlsoft::compiled_strftime_format` and
+ *          `stlsoft::compiled_strftime_renderer`, against
+ *          `stlsoft::fast_strftime()` and `strftime()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/time/compiled_strftime_format.hpp>
+#include <stlsoft/time/fast_strftime.hpp>
+#include <stlsoft/shims/access/string/std/c_string.h>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    // The number of renderings per second of time, as for a busy log
+    std::size_t const   CALLS_PER_SECOND    =   100;
+    std::size_t const   NUM_CALLS           =   1000000;
+
+    static
+    void
+    report(
+        char const*                 format
+    ,   char const*                 name
+    ,   unsigned long               result
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-24s %-22s: %10lu in %8ld us (%.1f ns/call)\n", format, name, result, static_cast<long>(us), 1000.0 * double(us) / double(NUM_CALLS));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        counter_t               counter;
+        char const* const       formats[]   =
+        {
+            "%a %b %d %H:%M:%S %Y"
+        ,   "%Y-%m-%dT%H:%M:%S"
+        ,   "[%T] %F"
+        ,   "%A, %B %e, %Y"
+        };
+        std::vector<struct tm>  times(NUM_CALLS / CALLS_PER_SECOND);
+        time_t const            t0          =   1700000000;
+
+        for (std::size_t i = 0; i != times.size(); ++i)
+        {
+            time_t const t = t0 + static_cast<time_t>(i);
+
+            times[i] = *::gmtime(&t);
+        }
+
+        for (std::size_t i = 0; i != STLSOFT_NUM_ELEMENTS(formats); ++i)
+        {
+            char const* const   format  =   formats[i];
+            char                buff[101];
+
+            {
+                unsigned long r = 0;
+
+                counter.start();
+                for (std::size_t j = 0; j != NUM_CALLS; ++j)
+                {
+                    r += static_cast<unsigned long>(::strftime(&buff[0], STLSOFT_NUM_ELEMENTS(buff), format, &times[j / CALLS_PER_SECOND]));
+                }
+                counter.stop();
+                report(format, "strftime()", r, counter.get_microseconds());
+            }
+            {
+                unsigned long r = 0;
+
+                counter.start();
+                for (std::size_t j = 0; j != NUM_CALLS; ++j)
+                {
+                    r += static_cast<unsigned long>(stlsoft::fast_strftime(&buff[0], STLSOFT_NUM_ELEMENTS(buff), format, &times[j / CALLS_PER_SECOND]));
+                }
+                counter.stop();
+                report(format, "fast_strftime()", r, counter.get_microseconds());
+            }
+            {
+                stlsoft::compiled_strftime_format const cf(format);
+
+                unsigned long r = 0;
+
+                counter.start();
+                for (std::size_t j = 0; j != NUM_CALLS; ++j)
+                {
+                    r += static_cast<unsigned long>(cf.render(&buff[0], STLSOFT_NUM_ELEMENTS(buff), &times[j / CALLS_PER_SECOND]));
+                }
+                counter.stop();
+                report(format, "compiled (render)", r, counter.get_microseconds());
+
+                stlsoft::compiled_strftime_renderer renderer(cf);
+
+                r = 0;
+
+                counter.start();
+                for (std::size_t j = 0; j != NUM_CALLS; ++j)
+                {
+                    r += static_cast<unsigned long>(renderer.render(&times[j / CALLS_PER_SECOND]));
+                }
+                counter.stop();
+                report(format, "compiled (renderer)", r, counter.get_microseconds());
+
+                r = 0;
+
+                counter.start();
+                for (std::size_t j = 0; j != NUM_CALLS; ++j)
+                {
+                    r += static_cast<unsigned long>(renderer.render(&times[j % times.size()]));
+                }
+                counter.stop();
+                report(format, "compiled (renderer/1s)", r, counter.get_microseconds());
+            }
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
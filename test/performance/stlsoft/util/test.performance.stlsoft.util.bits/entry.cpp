@@ -0,0 +1,246 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.stlsoft.util.bits/entry.cpp
+ *
+ * Purpose: Benchmark for the bit functions: `stlsoft::count_bits()` by
+ *          each method, `stlsoft::count_bits_over_range()`,
+ *          `stlsoft::find_highest_bit()`/`stlsoft::find_lowest_bit()`,
+ *          `stlsoft::calculate_xor_over_range()`, and the bitmap
+ *          combination functions.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <stlsoft/util/bits/bitmap_functions.h>
+#include <stlsoft/util/bits/count_functions.h>
+#include <stlsoft/util/bits/test_functions.h>
+#include <stlsoft/util/bits/xor_functions.h>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef stlsoft::ss_uint64_t                uint64_t_;
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   unsigned long               result
+    ,   counter_t::interval_type    us
+    ,   std::size_t                 cb
+    )
+    {
+        fprintf(stdout, "%-32s: %14lu in %8ld us (%.1f MB/s)\n", name, result, static_cast<long>(us), (0 == us) ? 0.0 : double(cb) / double(us));
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+    std::size_t const   n               =   (argc < 2) ? 4 * 1024 * 1024 : static_cast<std::size_t>(atol(argv[1]));
+    std::size_t const   cb              =   n * sizeof(uint64_t_);
+    int const           iterations      =   10;
+
+    try
+    {
+        counter_t               counter;
+        std::vector<uint64_t_>  lhs(n);
+        std::vector<uint64_t_>  rhs(n);
+        std::vector<uint64_t_>  dest(n);
+        uint64_t_               seed    =   88172645463325252ull;
+
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+
+            lhs[i] = seed;
+            rhs[i] = seed * 0x9e3779b97f4a7c15ull;
+        }
+
+        // population count
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    r += stlsoft::count_bits_by_8bit_table(lhs[i]);
+                }
+            }
+            counter.stop();
+            report("count_bits_by_8bit_table()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    r += stlsoft::count_bits_by_Kernighan_method(lhs[i]);
+                }
+            }
+            counter.stop();
+            report("count_bits_by_Kernighan_method()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    r += stlsoft::count_bits(lhs[i]);
+                }
+            }
+            counter.stop();
+            report("count_bits()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            // (the offset prevents the calls being hoisted out of the loop)
+            for (int j = 0; j != iterations; ++j)
+            {
+                r += static_cast<unsigned long>(stlsoft::count_bits_over_range(&lhs[j & 1], n - 1));
+            }
+            counter.stop();
+            report("count_bits_over_range()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        // bit scanning
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    r += stlsoft::find_highest_bit(lhs[i] >> (i & 63));
+                }
+            }
+            counter.stop();
+            report("find_highest_bit()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        {
+            unsigned long r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    r += stlsoft::find_lowest_bit(lhs[i] << (i & 63));
+                }
+            }
+            counter.stop();
+            report("find_lowest_bit()", r, counter.get_microseconds(), cb * iterations);
+        }
+
+        // XOR
+
+        {
+            uint64_t_ r = 0;
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                r += stlsoft::calculate_xor_over_range(&lhs[j & 1], n - 1);
+            }
+            counter.stop();
+            report("calculate_xor_over_range()", static_cast<unsigned long>(r & 0xffffffff), counter.get_microseconds(), cb * iterations);
+        }
+
+        // bitmaps
+
+        {
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                stlsoft::bitmap_and(&dest[0], &lhs[0], &rhs[0], n);
+            }
+            counter.stop();
+            report("bitmap_and()", static_cast<unsigned long>(stlsoft::count_bits_over_range(&dest[0], n)), counter.get_microseconds(), cb * iterations);
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                stlsoft::bitmap_or(&dest[0], &lhs[0], &rhs[0], n);
+            }
+            counter.stop();
+            report("bitmap_or()", static_cast<unsigned long>(stlsoft::count_bits_over_range(&dest[0], n)), counter.get_microseconds(), cb * iterations);
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                stlsoft::bitmap_xor(&dest[0], &lhs[0], &rhs[0], n);
+            }
+            counter.stop();
+            report("bitmap_xor()", static_cast<unsigned long>(stlsoft::count_bits_over_range(&dest[0], n)), counter.get_microseconds(), cb * iterations);
+
+            counter.start();
+            for (int j = 0; j != iterations; ++j)
+            {
+                stlsoft::bitmap_andnot(&dest[0], &lhs[0], &rhs[0], n);
+            }
+            counter.stop();
+            report("bitmap_andnot()", static_cast<unsigned long>(stlsoft::count_bits_over_range(&dest[0], n)), counter.get_microseconds(), cb * iterations);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,270 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.unixstl.filesystem.event_loop/entry.cpp
+ *
+ * Purpose: Benchmark for the events/sec of `unixstl::event_loop`, with
+ *          `epoll` and with `poll()`, for 10,000 registered descriptors of
+ *          which varying numbers are ready at each wait.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <unixstl/filesystem/event_loop.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+#include <stlsoft/util/minmax.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sys/resource.h>
+#include <unistd.h>
+#if defined(UNIXSTL_OS_IS_LINUX)
+# include <sys/eventfd.h>
+#endif /* UNIXSTL_OS_IS_LINUX */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef unixstl::event_loop                 loop_t;
+
+    std::size_t const   NUM_EVENTS          =   1000000;
+    // The most events that a single wait can return
+    std::size_t const   BATCH_SIZE          =   1024;
+
+    // A readable descriptor, made ready by signal() and not-ready by
+    // consume(). On Linux this is an eventfd, so that 10,000 sources need
+    // only 10,000 descriptors
+    struct source
+    {
+        int readFd;
+        int writeFd;
+    };
+
+    static
+    source
+    make_source()
+    {
+        source s;
+
+#if defined(UNIXSTL_OS_IS_LINUX)
+        s.readFd = s.writeFd = ::eventfd(0, EFD_NONBLOCK);
+
+        if (s.readFd < 0)
+#else /* ? UNIXSTL_OS_IS_LINUX */
+        int fds[2];
+
+        if (0 == ::pipe(&fds[0]))
+        {
+            s.readFd    =   fds[0];
+            s.writeFd   =   fds[1];
+        }
+        else
+#endif /* UNIXSTL_OS_IS_LINUX */
+        {
+            throw std::runtime_error("could not create source; increase the descriptor limit");
+        }
+
+        return s;
+    }
+
+    static
+    void
+    close_source(source const& s)
+    {
+        ::close(s.readFd);
+        if (s.writeFd != s.readFd)
+        {
+            ::close(s.writeFd);
+        }
+    }
+
+    static
+    void
+    signal(source const& s)
+    {
+#if defined(UNIXSTL_OS_IS_LINUX)
+        unsigned long long const v = 1;
+#else /* ? UNIXSTL_OS_IS_LINUX */
+        char const v = 0;
+#endif /* UNIXSTL_OS_IS_LINUX */
+
+        ssize_t const r = ::write(s.writeFd, &v, sizeof(v));
+
+        STLSOFT_SUPPRESS_UNUSED(r);
+    }
+
+    static
+    void
+    consume(int fd)
+    {
+        unsigned long long  v;
+        ssize_t const       r = ::read(fd, &v, sizeof(v));
+
+        STLSOFT_SUPPRESS_UNUSED(r);
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 numSources
+    ,   std::size_t                 numReady
+    ,   std::size_t                 numEvents
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-6s: %5lu registered, %4lu ready per wait: %8lu events in %8ld us (%9.0f events/s)\n", name, static_cast<unsigned long>(numSources), static_cast<unsigned long>(numReady), static_cast<unsigned long>(numEvents), static_cast<long>(us), 1000000 * double(numEvents) / double(us ? us : 1));
+    }
+
+    // Repeatedly makes numReady of the sources ready, waits for them, and
+    // consumes them, until numEvents events have been received
+    static
+    void
+    run(
+        char const*                 name
+    ,   int                         flags
+    ,   std::vector<source> const&  sources
+    ,   std::size_t                 numReady
+    )
+    {
+        loop_t                          loop(flags);
+        std::vector<loop_t::event_type> events(BATCH_SIZE);
+        // Each poll() scans every source, so fewer waits are measured
+        std::size_t const               numEvents   =   (0 == (loop_t::usePoll & flags)) ? NUM_EVENTS : stlsoft::minimum(NUM_EVENTS / 10, 2000 * numReady);
+        std::size_t                     received    =   0;
+        std::size_t                     next        =   0;
+        counter_t                       counter;
+
+        for (std::size_t i = 0; i != sources.size(); ++i)
+        {
+            loop.add(sources[i].readFd, loop_t::readable);
+        }
+
+        counter.start();
+        for (; received < numEvents; )
+        {
+            // spread the ready sources across the whole set
+            for (std::size_t i = 0; i != numReady; ++i)
+            {
+                next = (next + 7919) % sources.size();
+
+                signal(sources[next]);
+            }
+
+            for (std::size_t pending = numReady; 0 != pending; )
+            {
+                std::size_t const n = loop.wait(&events[0], events.size(), -1);
+
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    consume(events[i].fd);
+                }
+
+                pending     -=  (n < pending) ? n : pending;
+                received    +=  n;
+            }
+        }
+        counter.stop();
+
+        for (std::size_t i = 0; i != sources.size(); ++i)
+        {
+            loop.remove(sources[i].readFd);
+        }
+
+        report(name, sources.size(), numReady, received, counter.get_microseconds());
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    std::vector<source> sources;
+
+    try
+    {
+        // The number of sources may be given on the command-line
+        std::size_t const   numSources  =   (argc > 1) ? static_cast<std::size_t>(::atoi(argv[1])) : 10000;
+
+        // Raise the descriptor limit as far as allowed
+        {
+            struct rlimit rl;
+
+            if (0 == ::getrlimit(RLIMIT_NOFILE, &rl))
+            {
+                rl.rlim_cur = rl.rlim_max;
+
+                ::setrlimit(RLIMIT_NOFILE, &rl);
+            }
+        }
+
+        for (std::size_t i = 0; i != numSources; ++i)
+        {
+            sources.push_back(make_source());
+        }
+
+        static std::size_t const ready_counts[] =
+        {
+            1, 64, 1024
+        };
+
+        for (std::size_t k = 0; k != STLSOFT_NUM_ELEMENTS(ready_counts); ++k)
+        {
+            if (ready_counts[k] <= numSources)
+            {
+#if defined(UNIXSTL_OS_IS_LINUX)
+                run("epoll", 0, sources, ready_counts[k]);
+#endif /* UNIXSTL_OS_IS_LINUX */
+                run("poll", loop_t::usePoll, sources, ready_counts[k]);
+            }
+        }
+
+        for (std::size_t i = 0; i != sources.size(); ++i)
+        {
+            close_source(sources[i]);
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    for (std::size_t i = 0; i != sources.size(); ++i)
+    {
+        close_source(sources[i]);
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
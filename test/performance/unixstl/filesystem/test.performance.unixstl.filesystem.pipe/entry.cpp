@@ -0,0 +1,239 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.unixstl.filesystem.pipe/entry.cpp
+ *
+ * Purpose: Benchmark for draining a `unixstl::pipe` into a file, by
+ *          read()/write() and by `unixstl::pipe_splice_all()`, with the
+ *          default pipe capacity and with a capacity of 1MB.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <unixstl/filesystem/pipe.hpp>
+#include <unixstl/filesystem/pipe_functions.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+    typedef unsigned long long                  uint64_t_;
+
+    std::size_t const   CHUNK_SIZE          =   1024 * 1024;
+    std::size_t const   COPY_BUFFER_SIZE    =   64 * 1024;
+    std::size_t const   LARGE_CAPACITY      =   1024 * 1024;
+    char const* const   PATH                =   "test.performance.unixstl.filesystem.pipe.out";
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 capacity
+    ,   uint64_t_                   cb
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-22s (capacity %7lu): %6llu MB in %9ld us (%7.1f MB/s)\n", name, static_cast<unsigned long>(capacity), cb / (1024 * 1024), static_cast<long>(us), (double(cb) / (1024 * 1024)) / (double(us ? us : 1) / 1000000));
+    }
+
+    // Writes totalSize bytes into the pipe, in chunks, and then closes
+    // its write end
+    static
+    void
+    produce(
+        unixstl::pipe*  p
+    ,   uint64_t_       totalSize
+    )
+    {
+        int const           fd  =   p->write_handle();
+        std::vector<char>   chunk(CHUNK_SIZE);
+
+        for (std::size_t i = 0; i != chunk.size(); ++i)
+        {
+            chunk[i] = static_cast<char>('a' + i % 26);
+        }
+
+        for (uint64_t_ written = 0; written != totalSize; )
+        {
+            std::size_t const   n   =   (totalSize - written < chunk.size()) ? static_cast<std::size_t>(totalSize - written) : chunk.size();
+            std::size_t         off =   0;
+
+            for (; off != n; )
+            {
+                ssize_t const r = ::write(fd, &chunk[off], n - off);
+
+                if (r < 0)
+                {
+                    p->close_write();
+
+                    return;
+                }
+
+                off += static_cast<std::size_t>(r);
+            }
+
+            written += n;
+        }
+
+        p->close_write();
+    }
+
+    // Drains fdIn into fdOut with read() and write()
+    static
+    uint64_t_
+    drain_by_copy(
+        int fdIn
+    ,   int fdOut
+    )
+    {
+        std::vector<char>   buff(COPY_BUFFER_SIZE);
+        uint64_t_           total = 0;
+
+        for (;;)
+        {
+            ssize_t const r = ::read(fdIn, &buff[0], buff.size());
+
+            if (r <= 0)
+            {
+                break;
+            }
+
+            for (ssize_t off = 0; off != r; )
+            {
+                ssize_t const w = ::write(fdOut, &buff[off], static_cast<std::size_t>(r - off));
+
+                if (w < 0)
+                {
+                    throw std::runtime_error("write failed");
+                }
+
+                off += w;
+            }
+
+            total += static_cast<uint64_t_>(r);
+        }
+
+        return total;
+    }
+
+    static
+    uint64_t_
+    drain_by_splice(
+        int fdIn
+    ,   int fdOut
+    )
+    {
+        return unixstl::pipe_splice_all(fdIn, fdOut);
+    }
+
+    // Runs a producer thread writing totalSize bytes into a pipe of the
+    // given capacity, and drains the pipe into the file with f
+    template <typename F>
+    void
+    run(
+        char const* name
+    ,   std::size_t capacity
+    ,   uint64_t_   totalSize
+    ,   F           f
+    )
+    {
+        int const fd = ::open(PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+        if (fd < 0)
+        {
+            throw std::runtime_error("could not open output file");
+        }
+
+        unixstl::pipe   p(0, capacity);
+        counter_t       counter;
+
+        counter.start();
+
+        std::thread     producer(produce, &p, totalSize);
+        uint64_t_       cb;
+
+        try
+        {
+            cb = f(p.read_handle(), fd);
+        }
+        catch (...)
+        {
+            p.close_read();
+            producer.join();
+            ::close(fd);
+
+            throw;
+        }
+        producer.join();
+        counter.stop();
+
+        ::close(fd);
+
+        report(name, p.capacity(), cb, counter.get_microseconds());
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        // The total, in MB, may be given on the command-line
+        uint64_t_ const     totalSize       =   uint64_t_((argc > 1) ? ::atoi(argv[1]) : 2048) * 1024 * 1024;
+
+        run("read()/write()", 0, totalSize, drain_by_copy);
+        run("pipe_splice_all()", 0, totalSize, drain_by_splice);
+        run("read()/write()", LARGE_CAPACITY, totalSize, drain_by_copy);
+        run("pipe_splice_all()", LARGE_CAPACITY, totalSize, drain_by_splice);
+
+        ::remove(PATH);
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    ::remove(PATH);
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,198 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.unixstl.synch.fast_semaphore/entry.cpp
+ *
+ * Purpose: Benchmark for the ping-pong (hand-off) latency, and the
+ *          uncontended cost, of `unixstl::fast_semaphore` and
+ *          `unixstl::auto_reset_event`, against a POSIX `sem_t`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <unixstl/synch/event.hpp>
+#include <unixstl/synch/fast_semaphore.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <semaphore.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    int const   NUM_ROUND_TRIPS     =   200000;
+    int const   NUM_UNCONTENDED     =   10000000;
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   int                         n
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-36s: %9d in %8ld us (%8.1f ns each)\n", name, n, static_cast<long>(us), 1000.0 * double(us) / double(n));
+    }
+
+    // Adapts sem_t to the interface of the other types
+    class posix_semaphore
+    {
+    public:
+        explicit posix_semaphore(unsigned initialCount)
+        {
+            if (0 != ::sem_init(&m_sem, 0, initialCount))
+            {
+                throw std::runtime_error("sem_init() failed");
+            }
+        }
+        ~posix_semaphore()
+        {
+            ::sem_destroy(&m_sem);
+        }
+
+    public:
+        void lock()
+        {
+            for (; 0 != ::sem_wait(&m_sem); )
+            {}
+        }
+        void unlock()
+        {
+            ::sem_post(&m_sem);
+        }
+
+    private:
+        sem_t   m_sem;
+    };
+
+    // Adapts the event to the interface of the other types
+    class event_semaphore
+    {
+    public:
+        explicit event_semaphore(unsigned initialCount)
+            : m_ev(0 != initialCount)
+        {}
+
+    public:
+        void lock()
+        {
+            m_ev.wait();
+        }
+        void unlock()
+        {
+            m_ev.set();
+        }
+
+    private:
+        unixstl::auto_reset_event   m_ev;
+    };
+
+    // Passes control back and forth between two threads, each waiting
+    // for the other, and returns the time for all round trips
+    template <typename S>
+    counter_t::interval_type
+    ping_pong(int numRoundTrips)
+    {
+        S           ping(0);
+        S           pong(0);
+        counter_t   counter;
+
+        std::thread t([&ping, &pong, numRoundTrips]() {
+
+            for (int i = 0; i != numRoundTrips; ++i)
+            {
+                ping.lock();
+                pong.unlock();
+            }
+        });
+
+        counter.start();
+        for (int i = 0; i != numRoundTrips; ++i)
+        {
+            ping.unlock();
+            pong.lock();
+        }
+        counter.stop();
+
+        t.join();
+
+        return counter.get_microseconds();
+    }
+
+    // Releases and acquires, with no other thread
+    template <typename S>
+    counter_t::interval_type
+    uncontended(int n)
+    {
+        S           sem(0);
+        counter_t   counter;
+
+        counter.start();
+        for (int i = 0; i != n; ++i)
+        {
+            sem.unlock();
+            sem.lock();
+        }
+        counter.stop();
+
+        return counter.get_microseconds();
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        fprintf(stdout, "%u processor(s)\n", std::thread::hardware_concurrency());
+
+        report("sem_t ping-pong", NUM_ROUND_TRIPS, ping_pong<posix_semaphore>(NUM_ROUND_TRIPS));
+        report("fast_semaphore ping-pong", NUM_ROUND_TRIPS, ping_pong<unixstl::fast_semaphore>(NUM_ROUND_TRIPS));
+        report("auto_reset_event ping-pong", NUM_ROUND_TRIPS, ping_pong<event_semaphore>(NUM_ROUND_TRIPS));
+
+        report("sem_t uncontended", NUM_UNCONTENDED, uncontended<posix_semaphore>(NUM_UNCONTENDED));
+        report("fast_semaphore uncontended", NUM_UNCONTENDED, uncontended<unixstl::fast_semaphore>(NUM_UNCONTENDED));
+        report("auto_reset_event uncontended", NUM_UNCONTENDED, uncontended<event_semaphore>(NUM_UNCONTENDED));
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
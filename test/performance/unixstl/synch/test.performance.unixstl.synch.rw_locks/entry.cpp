@@ -0,0 +1,254 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.performance.unixstl.synch.rw_locks/entry.cpp
+ *
+ * Purpose: Benchmark for the read throughput, with 1 to 32 readers and a
+ *          single writer, of a small configuration snapshot guarded by
+ *          `unixstl::rw_spin_mutex`, `unixstl::rw_thread_mutex` and
+ *          `unixstl::seqlock`, against `unixstl::thread_mutex`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+#include <unixstl/synch/rw_spin_mutex.hpp>
+#include <unixstl/synch/rw_thread_mutex.hpp>
+#include <unixstl/synch/seqlock.hpp>
+#include <unixstl/synch/thread_mutex.hpp>
+
+#include <platformstl/filesystem/path_functions.h>
+#include <platformstl/performance/performance_counter.hpp>
+#include <stlsoft/synch/lock_scope.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * helpers
+ */
+
+namespace
+{
+
+    typedef platformstl::performance_counter    counter_t;
+
+    int const   DURATION_MS         =   250;
+    // The interval between the writer's updates
+    int const   WRITE_INTERVAL_US   =   100;
+
+    struct config
+    {
+        unsigned long   values[4];
+    };
+
+    config make_config(unsigned long v)
+    {
+        config c = { { v, v, v, v } };
+
+        return c;
+    }
+
+    unsigned long checksum(config const& c)
+    {
+        return c.values[0] ^ c.values[1] ^ c.values[2] ^ c.values[3];
+    }
+
+    static
+    void
+    report(
+        char const*                 name
+    ,   std::size_t                 numReaders
+    ,   unsigned long               numReads
+    ,   unsigned long               numWrites
+    ,   counter_t::interval_type    us
+    )
+    {
+        fprintf(stdout, "%-28s %2lu reader(s): %8.2f M reads/s, %6lu writes\n", name, static_cast<unsigned long>(numReaders), double(numReads) / double(us ? us : 1), numWrites);
+    }
+
+    // Runs numReaders readers, each calling read() repeatedly, and a
+    // single writer calling write() at intervals, for DURATION_MS, and
+    // reports the rate of reads and the number of writes achieved
+    template<
+        typename R
+    ,   typename W
+    >
+    void
+    run(
+        char const* name
+    ,   std::size_t numReaders
+    ,   R           read
+    ,   W           write
+    )
+    {
+        std::atomic<bool>           stop(false);
+        std::atomic<unsigned long>  numReads(0);
+        std::atomic<unsigned long>  numBad(0);
+        unsigned long               numWrites = 0;
+        std::vector<std::thread>    threads;
+        counter_t                   counter;
+
+        counter.start();
+        for (std::size_t r = 0; r != numReaders; ++r)
+        {
+            threads.push_back(std::thread([&]() {
+
+                unsigned long n = 0;
+                unsigned long b = 0;
+
+                for (; !stop.load(std::memory_order_relaxed); ++n)
+                {
+                    if (0 != checksum(read()))
+                    {
+                        ++b;
+                    }
+                }
+
+                numReads += n;
+                numBad += b;
+            }));
+        }
+        threads.push_back(std::thread([&]() {
+
+            for (; !stop.load(std::memory_order_relaxed); )
+            {
+                write(make_config(++numWrites));
+
+                std::this_thread::sleep_for(std::chrono::microseconds(WRITE_INTERVAL_US));
+            }
+        }));
+
+        // The period is timed here, rather than by the writer, since a
+        // lock that prefers readers may starve the writer indefinitely
+        std::this_thread::sleep_for(std::chrono::milliseconds(DURATION_MS));
+
+        stop = true;
+
+        for (std::size_t t = 0; t != threads.size(); ++t)
+        {
+            threads[t].join();
+        }
+        counter.stop();
+
+        if (0 != numBad)
+        {
+            throw std::runtime_error("a reader observed a torn snapshot");
+        }
+
+        report(name, numReaders, numReads, numWrites, counter.get_microseconds());
+    }
+
+    // Guards the snapshot with a mutex of type M, using the traits RT for
+    // reading and WT for writing
+    template<
+        typename M
+    ,   typename RT
+    ,   typename WT
+    >
+    void
+    run_mutex(
+        char const* name
+    ,   std::size_t numReaders
+    ,   M&          mx
+    )
+    {
+        config snapshot = make_config(0);
+
+        run(name, numReaders, [&]() -> config {
+
+            stlsoft::lock_scope<M, RT> scope(mx);
+
+            return snapshot;
+        }, [&](config const& c) {
+
+            stlsoft::lock_scope<M, WT> scope(mx);
+
+            snapshot = c;
+        });
+    }
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int /* argc */, char* argv[])
+{
+    char const* const   program_name    =   platformstl::get_executable_name_from_path(argv[0]).ptr;
+
+    try
+    {
+        static std::size_t const reader_counts[] =
+        {
+            1, 2, 4, 8, 16, 32
+        };
+
+        for (std::size_t k = 0; k != STLSOFT_NUM_ELEMENTS(reader_counts); ++k)
+        {
+            std::size_t const numReaders = reader_counts[k];
+
+            {
+                unixstl::thread_mutex mx(false);
+
+                run_mutex<unixstl::thread_mutex, stlsoft::lock_traits<unixstl::thread_mutex>, stlsoft::lock_traits<unixstl::thread_mutex> >("thread_mutex", numReaders, mx);
+            }
+            {
+                unixstl::rw_thread_mutex mx;
+
+                run_mutex<unixstl::rw_thread_mutex, stlsoft::shared_lock_traits<unixstl::rw_thread_mutex>, stlsoft::lock_traits<unixstl::rw_thread_mutex> >("rw_thread_mutex", numReaders, mx);
+            }
+            {
+                unixstl::rw_thread_mutex mx(true);
+
+                run_mutex<unixstl::rw_thread_mutex, stlsoft::shared_lock_traits<unixstl::rw_thread_mutex>, stlsoft::lock_traits<unixstl::rw_thread_mutex> >("rw_thread_mutex (writers)", numReaders, mx);
+            }
+            {
+                unixstl::rw_spin_mutex mx;
+
+                run_mutex<unixstl::rw_spin_mutex, stlsoft::shared_lock_traits<unixstl::rw_spin_mutex>, stlsoft::lock_traits<unixstl::rw_spin_mutex> >("rw_spin_mutex", numReaders, mx);
+            }
+            {
+                unixstl::seqlock<config> sl(make_config(0));
+
+                run("seqlock", numReaders, [&sl]() -> config {
+
+                    return sl.load();
+                }, [&sl](config const& c) {
+
+                    sl.store(c);
+                });
+            }
+
+            fprintf(stdout, "\n");
+        }
+
+        return EXIT_SUCCESS;
+    }
+    catch (std::bad_alloc&)
+    {
+        fprintf(stderr, "%s: out of memory\n", program_name);
+    }
+    catch (std::exception& x)
+    {
+        fprintf(stderr, "%s: exception: %s\n", program_name, x.what());
+    }
+
+    return EXIT_FAILURE;
+}
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
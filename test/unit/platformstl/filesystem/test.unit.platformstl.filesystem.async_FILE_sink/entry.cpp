@@ -0,0 +1,479 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.platformstl.filesystem.async_FILE_sink/entry.cpp
+ *
+ * Purpose: Unit-tests for `platformstl::async_FILE_sink`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <platformstl/filesystem/async_FILE_sink.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* UNIX header files */
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_options_validated(void);
+    static void test_write_line(void);
+    static void test_write_blocks(void);
+    static void test_flush(void);
+    static void test_oversized_records(void);
+    static void test_closed_drops(void);
+    static void test_block(void);
+    static void test_drop(void);
+    static void test_spill(void);
+    static void test_flush_error(void);
+    static void test_close_error(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.platformstl.filesystem.async_FILE_sink", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_options_validated);
+        XTESTS_RUN_CASE(test_write_line);
+        XTESTS_RUN_CASE(test_write_blocks);
+        XTESTS_RUN_CASE(test_flush);
+        XTESTS_RUN_CASE(test_oversized_records);
+        XTESTS_RUN_CASE(test_closed_drops);
+        XTESTS_RUN_CASE(test_block);
+        XTESTS_RUN_CASE(test_drop);
+        XTESTS_RUN_CASE(test_spill);
+        XTESTS_RUN_CASE_THAT_THROWS(test_flush_error, platformstl::filesystem_exception);
+        XTESTS_RUN_CASE_THAT_THROWS(test_close_error, platformstl::filesystem_exception);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef platformstl::async_FILE_sink                    sink_t;
+    typedef sink_t::options                                 options_t;
+
+    // A temporary file, removed on destruction
+    class temp_file
+    {
+    public:
+        temp_file()
+        {
+            ::strcpy(m_path, "/tmp/test.unit.platformstl.async_FILE_sink.XXXXXX");
+
+            int const fd = ::mkstemp(m_path);
+
+            if (-1 != fd)
+            {
+                ::close(fd);
+            }
+        }
+        ~temp_file()
+        {
+            ::unlink(m_path);
+        }
+
+    public:
+        char const* path() const
+        {
+            return m_path;
+        }
+        std::string contents() const
+        {
+            std::ifstream   stm(m_path, std::ios::binary);
+            std::string     s;
+            char            buff[4096];
+
+            for (; stm.read(buff, sizeof(buff)) || 0 != stm.gcount(); )
+            {
+                s.append(buff, static_cast<size_t>(stm.gcount()));
+            }
+
+            return s;
+        }
+
+    private:
+        char    m_path[64];
+    };
+
+    std::vector<std::string> split_lines(std::string const& s)
+    {
+        std::vector<std::string>    lines;
+        size_t                      from = 0;
+
+        for (size_t to; std::string::npos != (to = s.find('\n', from)); from = to + 1)
+        {
+            lines.push_back(s.substr(from, to - from));
+        }
+
+        if (from != s.size())
+        {
+            lines.push_back(s.substr(from));
+        }
+
+        return lines;
+    }
+
+    // The record written by thread t as its i'th: "t:i:" followed by a
+    // number of copies of a character particular to the thread. Every
+    // 61st record is larger than the (test) buffer size
+    std::string make_record(int t, int i)
+    {
+        char    prefix[32];
+        size_t  len = static_cast<size_t>(i * 7 + t) % 50;
+
+        if (0 == i % 61)
+        {
+            len += 300;
+        }
+
+        ::sprintf(prefix, "%d:%d:", t, i);
+
+        return prefix + std::string(len, static_cast<char>('a' + t));
+    }
+
+    // Writes numRecords records from each of numThreads threads, closes
+    // the sink, and verifies that every record in the file is whole, and
+    // that the records of each thread are in order. Returns the number
+    // of records found
+    size_t
+    write_concurrently(
+        sink_t::backpressure_policy policy
+    ,   int                         numThreads
+    ,   int                         numRecords
+    ,   stlsoft::ss_uint64_t*       numDropped
+    ,   stlsoft::ss_uint64_t*       numSpilled
+    )
+    {
+        temp_file   file;
+        options_t   opts;
+
+        opts.bufferSize         =   256;
+        opts.numBuffers         =   2;
+        opts.backpressure       =   policy;
+        opts.flushIntervalMs    =   1;
+
+        {
+            sink_t                      sink(file.path(), "w", opts);
+            std::vector<std::thread>    threads;
+
+            for (int t = 0; t != numThreads; ++t)
+            {
+                threads.push_back(std::thread([&sink, t, numRecords]() {
+
+                    for (int i = 0; i != numRecords; ++i)
+                    {
+                        sink.write_line(make_record(t, i));
+                    }
+                }));
+            }
+
+            for (int t = 0; t != numThreads; ++t)
+            {
+                threads[t].join();
+            }
+
+            sink.close();
+
+            *numDropped = sink.num_dropped();
+            *numSpilled = sink.num_spilled();
+        }
+
+        std::vector<std::string> const  lines = split_lines(file.contents());
+        std::vector<int>                next(numThreads, 0);
+
+        for (size_t j = 0; j != lines.size(); ++j)
+        {
+            int t = -1;
+            int i = -1;
+
+            if (2 != ::sscanf(lines[j].c_str(), "%d:%d:", &t, &i) ||
+                t < 0 ||
+                t >= numThreads ||
+                i < 0 ||
+                i >= numRecords ||
+                lines[j] != make_record(t, i))
+            {
+                XTESTS_TEST_FAIL("record is not whole");
+
+                break;
+            }
+
+            if (i < next[t])
+            {
+                XTESTS_TEST_FAIL("record is out of order");
+
+                break;
+            }
+
+            next[t] = i + 1;
+        }
+
+        return lines.size();
+    }
+
+
+static void test_empty()
+{
+    temp_file file;
+
+    {
+        sink_t sink(file.path(), "w");
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, file.contents().size());
+}
+
+static void test_options_validated()
+{
+    temp_file   file;
+    options_t   opts;
+
+    opts.bufferSize = 0;
+    opts.numBuffers = 1;
+
+    sink_t sink(file.path(), "w", opts);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, sink.get_options().bufferSize);
+    XTESTS_TEST_INTEGER_EQUAL(2u, sink.get_options().numBuffers);
+}
+
+static void test_write_line()
+{
+    temp_file file;
+
+    {
+        sink_t sink(file.path(), "w");
+
+        XTESTS_TEST_BOOLEAN_TRUE(sink.write_line("abc"));
+        XTESTS_TEST_BOOLEAN_TRUE(sink.write_line(std::string("def")));
+        XTESTS_TEST_BOOLEAN_TRUE(sink.write_line(""));
+        XTESTS_TEST_BOOLEAN_TRUE(sink.write("ghi"));
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\ndef\n\nghi", file.contents());
+}
+
+static void test_write_blocks()
+{
+    temp_file       file;
+    options_t       opts;
+    std::string     expected;
+
+    opts.bufferSize = 100;
+
+    {
+        sink_t sink(file.path(), "wb", opts);
+
+        for (int i = 0; i != 1000; ++i)
+        {
+            char const block[] = { char(i), char(i >> 8), '\0', '\n' };
+
+            sink.write(&block[0], sizeof(block));
+
+            expected.append(&block[0], sizeof(block));
+        }
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(expected == file.contents());
+}
+
+static void test_flush()
+{
+    temp_file   file;
+    options_t   opts;
+
+    opts.flushIntervalMs = 0;
+
+    sink_t sink(file.path(), "w", opts);
+
+    sink.write_line("abc");
+    sink.flush();
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\n", file.contents());
+
+    sink.write_line("def");
+    sink.sync();
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\ndef\n", file.contents());
+}
+
+static void test_oversized_records()
+{
+    // a record larger than a buffer is written directly, but after the
+    // records buffered before it
+
+    temp_file   file;
+    options_t   opts;
+    std::string expected;
+
+    opts.bufferSize         =   16;
+    opts.flushIntervalMs    =   0;
+
+    {
+        sink_t sink(file.path(), "w", opts);
+
+        for (int i = 0; i != 100; ++i)
+        {
+            std::string const record = make_record(0, i);
+
+            sink.write_line(record);
+
+            expected += record + '\n';
+        }
+
+        XTESTS_TEST_INTEGER_LESS(100u, sink.num_spilled());
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1u, sink.num_spilled());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(expected == file.contents());
+}
+
+static void test_closed_drops()
+{
+    temp_file   file;
+    options_t   opts;
+
+    opts.bufferSize = 16;
+
+    sink_t sink(file.path(), "w", opts);
+
+    sink.write_line("abc");
+    sink.close();
+
+    XTESTS_TEST_BOOLEAN_FALSE(sink.write_line("def"));
+    XTESTS_TEST_BOOLEAN_FALSE(sink.write_line(std::string(100, 'x')));
+    XTESTS_TEST_INTEGER_EQUAL(2u, sink.num_dropped());
+    XTESTS_TEST_INTEGER_EQUAL(0u, sink.num_spilled());
+
+    sink.close();
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\n", file.contents());
+}
+
+static void test_block()
+{
+    static int const numsThreads[] = { 1, 2, 4, 8 };
+
+    for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(numsThreads); ++j)
+    {
+        stlsoft::ss_uint64_t    numDropped;
+        stlsoft::ss_uint64_t    numSpilled;
+        size_t const            numLines = write_concurrently(sink_t::backpressureBlock, numsThreads[j], 2000, &numDropped, &numSpilled);
+
+        XTESTS_TEST_INTEGER_EQUAL(2000u * numsThreads[j], numLines);
+        XTESTS_TEST_INTEGER_EQUAL(0u, numDropped);
+    }
+}
+
+static void test_drop()
+{
+    static int const numsThreads[] = { 1, 2, 4, 8 };
+
+    for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(numsThreads); ++j)
+    {
+        stlsoft::ss_uint64_t    numDropped;
+        stlsoft::ss_uint64_t    numSpilled;
+        size_t const            numLines = write_concurrently(sink_t::backpressureDrop, numsThreads[j], 2000, &numDropped, &numSpilled);
+
+        XTESTS_TEST_INTEGER_EQUAL(2000u * numsThreads[j], numLines + numDropped);
+    }
+}
+
+static void test_spill()
+{
+    static int const numsThreads[] = { 1, 2, 4, 8 };
+
+    for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(numsThreads); ++j)
+    {
+        stlsoft::ss_uint64_t    numDropped;
+        stlsoft::ss_uint64_t    numSpilled;
+        size_t const            numLines = write_concurrently(sink_t::backpressureSpill, numsThreads[j], 2000, &numDropped, &numSpilled);
+
+        XTESTS_TEST_INTEGER_EQUAL(2000u * numsThreads[j], numLines);
+        XTESTS_TEST_INTEGER_EQUAL(0u, numDropped);
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(33u * numsThreads[j], numSpilled);
+    }
+}
+
+static void test_flush_error()
+{
+    // writes to /dev/full fail with ENOSPC on the background thread, and
+    // the error is rethrown by flush()
+
+    sink_t sink("/dev/full", "w");
+
+    sink.write_line("abc");
+    sink.flush();
+}
+
+static void test_close_error()
+{
+    sink_t sink("/dev/full", "w");
+
+    sink.write_line("abc");
+    sink.close();
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
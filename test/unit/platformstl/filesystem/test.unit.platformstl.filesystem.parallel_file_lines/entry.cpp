@@ -0,0 +1,323 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.platformstl.filesystem.parallel_file_lines/entry.cpp
+ *
+ * Purpose: Unit-tests for `platformstl::parallel_file_lines`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <platformstl/filesystem/parallel_file_lines.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <platformstl/filesystem/file_lines.hpp>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* UNIX header files */
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty_file(void);
+    static void test_lf(void);
+    static void test_crlf(void);
+    static void test_cr(void);
+    static void test_no_trailing_newline(void);
+    static void test_blank_lines(void);
+    static void test_chunk_boundaries(void);
+    static void test_chunk_boundaries_concurrencies(void);
+    static void test_binary_file(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.platformstl.filesystem.parallel_file_lines", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty_file);
+        XTESTS_RUN_CASE(test_lf);
+        XTESTS_RUN_CASE(test_crlf);
+        XTESTS_RUN_CASE(test_cr);
+        XTESTS_RUN_CASE(test_no_trailing_newline);
+        XTESTS_RUN_CASE(test_blank_lines);
+        XTESTS_RUN_CASE(test_chunk_boundaries);
+        XTESTS_RUN_CASE(test_chunk_boundaries_concurrencies);
+        XTESTS_RUN_CASE_THAT_THROWS(test_binary_file, platformstl::invalid_file_type_exception);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef platformstl::parallel_file_lines                lines_t;
+
+    // A temporary file with the given contents, removed on destruction
+    class temp_file
+    {
+    public:
+        explicit temp_file(std::string const& contents)
+        {
+            ::strcpy(m_path, "/tmp/test.unit.platformstl.parallel_file_lines.XXXXXX");
+
+            int const fd = ::mkstemp(m_path);
+
+            if (-1 != fd)
+            {
+                if (!contents.empty())
+                {
+                    ssize_t const n = ::write(fd, contents.data(), contents.size());
+
+                    STLSOFT_SUPPRESS_UNUSED(n);
+                }
+
+                ::close(fd);
+            }
+        }
+        ~temp_file()
+        {
+            ::unlink(m_path);
+        }
+
+    public:
+        char const* path() const
+        {
+            return m_path;
+        }
+
+    private:
+        char    m_path[64];
+
+    private:
+        temp_file(temp_file const&);
+        void operator =(temp_file const&);
+    };
+
+    std::string line(lines_t const& lines, size_t index)
+    {
+        return std::string(lines[index].data(), lines[index].size());
+    }
+
+    // Creates a file of exactly 4 * minimumChunkSize characters, so that
+    // with a concurrency of 4 the chunk searches start at known offsets,
+    // and places an end-of-line sequence of each kind at those offsets.
+    // The last line has no trailing newline.
+    std::string make_contents()
+    {
+        size_t const    chunk   =   lines_t::minimumChunkSize;
+        size_t const    cch     =   4 * chunk;
+        std::string     s;
+
+        for (unsigned i = 0; s.size() < cch; ++i)
+        {
+            s.append(1 + (i * 7) % 50, static_cast<char>('a' + i % 26));
+
+            switch (i % 3)
+            {
+            case 0: s += "\n";      break;
+            case 1: s += "\r\n";    break;
+            case 2: s += "\r";      break;
+            }
+        }
+
+        s.resize(cch);
+        s[cch - 1] = 'z';
+
+        // the CR of a CRLF at the first search offset
+        s.replace(1 * chunk - 1, 4, "x\r\ny");
+        // the LF of a CRLF at the second
+        s.replace(2 * chunk - 2, 4, "x\r\ny");
+        // a lone CR at the third, followed by a blank CRLF line
+        s.replace(3 * chunk - 1, 6, "x\r\r\nyy");
+
+        return s;
+    }
+
+    // Compares the table with that produced by the sequential
+    // platformstl::file_lines
+    size_t num_differences(char const* path, lines_t const& lines)
+    {
+        platformstl::file_lines const   expected(path);
+        size_t                          n = 0;
+
+        if (expected.size() != lines.size())
+        {
+            return 1 + expected.size();
+        }
+
+        for (size_t i = 0; i != lines.size(); ++i)
+        {
+            if (std::string(expected[i].data(), expected[i].size()) != line(lines, i))
+            {
+                ++n;
+            }
+        }
+
+        return n;
+    }
+
+
+static void test_empty_file()
+{
+    temp_file   tf("");
+    lines_t     lines(tf.path());
+
+    XTESTS_TEST_BOOLEAN_TRUE(lines.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, lines.size());
+    XTESTS_TEST_BOOLEAN_TRUE(lines.begin() == lines.end());
+}
+
+static void test_lf()
+{
+    temp_file   tf("abc\ndef\n");
+    lines_t     lines(tf.path());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", line(lines, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", line(lines, 1));
+}
+
+static void test_crlf()
+{
+    temp_file   tf("abc\r\ndef\r\n");
+    lines_t     lines(tf.path());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", line(lines, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", line(lines, 1));
+}
+
+static void test_cr()
+{
+    temp_file   tf("abc\rdef\r");
+    lines_t     lines(tf.path());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", line(lines, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", line(lines, 1));
+}
+
+static void test_no_trailing_newline()
+{
+    temp_file   tf("abc\r\ndef");
+    lines_t     lines(tf.path());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", line(lines, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", line(lines, 1));
+}
+
+static void test_blank_lines()
+{
+    temp_file   tf("\n\r\n\r\rx\n");
+    lines_t     lines(tf.path());
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, num_differences(tf.path(), lines));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(5u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", line(lines, 0));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", line(lines, 3));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x", line(lines, 4));
+}
+
+static void test_chunk_boundaries()
+{
+    std::string const           contents = make_contents();
+    temp_file                   tf(contents);
+    stlsoft::work_stealing_pool pool(4);
+    lines_t                     lines(tf.path(), pool, 4);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, lines.num_chunks());
+    XTESTS_TEST_INTEGER_EQUAL(0u, num_differences(tf.path(), lines));
+
+    // the last line, which has no trailing newline
+    std::string const last = line(lines, lines.size() - 1);
+
+    XTESTS_TEST_CHARACTER_EQUAL('z', last[last.size() - 1]);
+}
+
+static void test_chunk_boundaries_concurrencies()
+{
+    std::string const           contents = make_contents();
+    temp_file                   tf(contents);
+    stlsoft::work_stealing_pool pool(3);
+
+    // more chunks than the pool has threads, and numbers of chunks that
+    // do not divide the file evenly
+    for (size_t concurrency = 1; concurrency != 8; ++concurrency)
+    {
+        lines_t lines(tf.path(), pool, concurrency);
+
+        XTESTS_TEST_INTEGER_EQUAL((concurrency < 4) ? concurrency : 4u, lines.num_chunks());
+        XTESTS_TEST_INTEGER_EQUAL(0u, num_differences(tf.path(), lines));
+    }
+
+    // the default pool
+    lines_t lines(tf.path());
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, num_differences(tf.path(), lines));
+}
+
+static void test_binary_file()
+{
+    std::string contents = make_contents();
+
+    contents[3 * lines_t::minimumChunkSize + 100] = '\0';
+
+    temp_file   tf(contents);
+    lines_t     lines(tf.path(), 4);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,455 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.rangelib.pipeline/entry.cpp
+ *
+ * Purpose: Unit-tests for `rangelib::pipeline`, including that the
+ *          functions of the stages are not invoked after a
+ *          short-circuiting operation has completed.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <rangelib/pipeline.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <rangelib/sequence_range.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <iterator>
+#include <list>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_accumulate(void);
+    static void test_count_and_copy(void);
+    static void test_for_each(void);
+    static void test_any_all_none(void);
+    static void test_first(void);
+    static void test_take_and_drop(void);
+    static void test_take_while(void);
+    static void test_empty_sources(void);
+    static void test_sources_agree(void);
+    static void test_calls_after_take(void);
+    static void test_calls_after_take_while(void);
+    static void test_calls_after_any_of(void);
+    static void test_calls_after_first(void);
+    static void test_calls_in_composite(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.rangelib.pipeline", verbosity))
+    {
+        XTESTS_RUN_CASE(test_accumulate);
+        XTESTS_RUN_CASE(test_count_and_copy);
+        XTESTS_RUN_CASE(test_for_each);
+        XTESTS_RUN_CASE(test_any_all_none);
+        XTESTS_RUN_CASE(test_first);
+        XTESTS_RUN_CASE(test_take_and_drop);
+        XTESTS_RUN_CASE(test_take_while);
+        XTESTS_RUN_CASE(test_empty_sources);
+        XTESTS_RUN_CASE(test_sources_agree);
+        XTESTS_RUN_CASE(test_calls_after_take);
+        XTESTS_RUN_CASE(test_calls_after_take_while);
+        XTESTS_RUN_CASE(test_calls_after_any_of);
+        XTESTS_RUN_CASE(test_calls_after_first);
+        XTESTS_RUN_CASE(test_calls_in_composite);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    using rangelib::filter;
+    using rangelib::transform;
+    using rangelib::take;
+    using rangelib::take_while;
+    using rangelib::drop;
+
+    // [0, n)
+    std::vector<int> iota(int n)
+    {
+        std::vector<int> v;
+
+        for (int i = 0; i != n; ++i)
+        {
+            v.push_back(i);
+        }
+
+        return v;
+    }
+
+    // the functions count their calls, through a pointer, since the
+    // pipeline copies them
+
+    struct is_odd
+    {
+        int* numCalls;
+
+        bool operator ()(int x) const
+        {
+            ++*numCalls;
+
+            return 0 != (x & 1);
+        }
+    };
+
+    struct square
+    {
+        int* numCalls;
+
+        int operator ()(int x) const
+        {
+            ++*numCalls;
+
+            return x * x;
+        }
+    };
+
+    struct less_than
+    {
+        int* numCalls;
+        int  limit;
+
+        bool operator ()(int x) const
+        {
+            ++*numCalls;
+
+            return x < limit;
+        }
+    };
+
+    struct summer
+    {
+        long sum;
+
+        void operator ()(int x)
+        {
+            sum += x;
+        }
+    };
+
+    int unused = 0;
+
+    is_odd odd()
+    {
+        is_odd const f = { &unused };
+
+        return f;
+    }
+
+    square sq()
+    {
+        square const f = { &unused };
+
+        return f;
+    }
+
+    less_than below(int limit)
+    {
+        less_than const f = { &unused, limit };
+
+        return f;
+    }
+
+
+static void test_accumulate()
+{
+    std::vector<int> const v = iota(1000);
+
+    long expected = 0;
+
+    for (int i = 1; i < 1000; i += 2)
+    {
+        expected += static_cast<long>(i) * i;
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected, (v | filter(odd()) | transform(sq())).accumulate(0L));
+    XTESTS_TEST_INTEGER_EQUAL(499500L, (v | drop(0)).accumulate(0L));
+}
+
+static void test_count_and_copy()
+{
+    std::vector<int> const  v = iota(200);
+    std::vector<int>        out;
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, (v | filter(odd())).count());
+
+    (v | filter(odd()) | take(5)).copy(std::back_inserter(out));
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, out.size());
+    XTESTS_TEST_INTEGER_EQUAL(1, out[0]);
+    XTESTS_TEST_INTEGER_EQUAL(9, out[4]);
+}
+
+static void test_for_each()
+{
+    std::vector<int> const  v = iota(100);
+    summer const            s = { 0 };
+
+    XTESTS_TEST_INTEGER_EQUAL(2500L, (v | filter(odd())).for_each(s).sum);
+}
+
+static void test_any_all_none()
+{
+    std::vector<int> const v = iota(100);
+
+    XTESTS_TEST_BOOLEAN_TRUE((v | drop(0)).any_of(odd()));
+    XTESTS_TEST_BOOLEAN_FALSE((v | drop(0)).all_of(odd()));
+    XTESTS_TEST_BOOLEAN_TRUE((v | filter(odd())).all_of(odd()));
+    XTESTS_TEST_BOOLEAN_TRUE((v | take(1)).none_of(odd()));
+}
+
+static void test_first()
+{
+    std::vector<int> const  v = iota(100);
+    int                     r = -1;
+
+    XTESTS_TEST_BOOLEAN_TRUE((v | filter(odd()) | drop(3)).first(r));
+    XTESTS_TEST_INTEGER_EQUAL(7, r);
+
+    r = -1;
+
+    XTESTS_TEST_BOOLEAN_FALSE((v | drop(100)).first(r));
+    XTESTS_TEST_INTEGER_EQUAL(-1, r);
+}
+
+static void test_take_and_drop()
+{
+    std::vector<int> const v = iota(1000);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, (v | take(0)).count());
+    XTESTS_TEST_INTEGER_EQUAL(10u, (v | take(10)).count());
+    XTESTS_TEST_INTEGER_EQUAL(1000u, (v | take(5000)).count());
+    XTESTS_TEST_INTEGER_EQUAL(990u, (v | drop(10)).count());
+    XTESTS_TEST_INTEGER_EQUAL(0u, (v | drop(5000)).count());
+    XTESTS_TEST_INTEGER_EQUAL(10L + 11 + 12, (v | drop(10) | take(3)).accumulate(0L));
+}
+
+static void test_take_while()
+{
+    std::vector<int> const v = iota(1000);
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, (v | take_while(below(100))).count());
+    XTESTS_TEST_INTEGER_EQUAL(0u, (v | take_while(below(0))).count());
+    XTESTS_TEST_INTEGER_EQUAL(1000u, (v | take_while(below(5000))).count());
+}
+
+static void test_empty_sources()
+{
+    std::vector<int> const  v;
+    std::list<int> const    l;
+    int                     r = -1;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, (v | filter(odd())).count());
+    XTESTS_TEST_INTEGER_EQUAL(0u, (l | filter(odd())).count());
+    XTESTS_TEST_BOOLEAN_FALSE((v | take(1)).first(r));
+    XTESTS_TEST_BOOLEAN_FALSE((l | take(1)).first(r));
+}
+
+static void test_sources_agree()
+{
+    // contiguous, iterator and Notional Range sources give the same
+    // results
+
+    std::vector<int> const  v = iota(777);
+    std::list<int> const    l(v.begin(), v.end());
+    int                     ar[777];
+
+    for (int i = 0; i != 777; ++i)
+    {
+        ar[i] = i;
+    }
+
+    rangelib::sequence_range<std::vector<int> const> const r(v);
+
+    long const expected = (v | filter(odd()) | transform(sq()) | take(123)).accumulate(0L);
+
+    XTESTS_TEST_INTEGER_EQUAL(expected, (l | filter(odd()) | transform(sq()) | take(123)).accumulate(0L));
+    XTESTS_TEST_INTEGER_EQUAL(expected, (ar | filter(odd()) | transform(sq()) | take(123)).accumulate(0L));
+    XTESTS_TEST_INTEGER_EQUAL(expected, (r | filter(odd()) | transform(sq()) | take(123)).accumulate(0L));
+}
+
+static void test_calls_after_take()
+{
+    // the functions of the stages preceding a take() are invoked only on
+    // the elements that are needed, even though a contiguous source is
+    // pushed through in batches
+
+    std::vector<int> const  v = iota(1000);
+    std::list<int> const    l(v.begin(), v.end());
+
+    {
+        int         numPredCalls = 0;
+        int         numFnCalls = 0;
+        is_odd      pred = { &numPredCalls };
+        square      fn = { &numFnCalls };
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, (v | transform(fn) | filter(pred) | take(3)).count());
+        XTESTS_TEST_INTEGER_EQUAL(6, numFnCalls);
+        XTESTS_TEST_INTEGER_EQUAL(6, numPredCalls);
+    }
+
+    {
+        int         numFnCalls = 0;
+        square      fn = { &numFnCalls };
+
+        XTESTS_TEST_INTEGER_EQUAL(5u, (v | transform(fn) | take(5)).count());
+        XTESTS_TEST_INTEGER_EQUAL(5, numFnCalls);
+    }
+
+    {
+        int         numFnCalls = 0;
+        square      fn = { &numFnCalls };
+
+        XTESTS_TEST_INTEGER_EQUAL(5u, (l | transform(fn) | take(5)).count());
+        XTESTS_TEST_INTEGER_EQUAL(5, numFnCalls);
+    }
+
+    {
+        // (the stages following the take() see only its elements)
+
+        int         numFnCalls = 0;
+        square      fn = { &numFnCalls };
+
+        XTESTS_TEST_INTEGER_EQUAL(7u, (v | take(7) | transform(fn)).count());
+        XTESTS_TEST_INTEGER_EQUAL(7, numFnCalls);
+    }
+}
+
+static void test_calls_after_take_while()
+{
+    std::vector<int> const v = iota(1000);
+
+    int         numPredCalls = 0;
+    int         numFnCalls = 0;
+    less_than   pred = { &numPredCalls, 10 };
+    square      fn = { &numFnCalls };
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, (v | take_while(pred) | transform(fn)).count());
+    XTESTS_TEST_INTEGER_EQUAL(11, numPredCalls);
+    XTESTS_TEST_INTEGER_EQUAL(10, numFnCalls);
+
+    numPredCalls = 0;
+    numFnCalls = 0;
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, (v | transform(fn) | take_while(pred)).count());
+    XTESTS_TEST_INTEGER_EQUAL(5, numPredCalls);
+    XTESTS_TEST_INTEGER_EQUAL(5, numFnCalls);
+
+    numPredCalls = 0;
+
+    // a take_while() preceding a take() does not test elements once the
+    // take() has completed
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, (v | take_while(pred) | take(4)).count());
+    XTESTS_TEST_INTEGER_EQUAL(4, numPredCalls);
+}
+
+static void test_calls_after_any_of()
+{
+    std::vector<int> const v = iota(1000);
+
+    int     numFnCalls = 0;
+    int     numPredCalls = 0;
+    square  fn = { &numFnCalls };
+    is_odd  pred = { &numPredCalls };
+
+    XTESTS_TEST_BOOLEAN_TRUE((v | transform(fn)).any_of(pred));
+    XTESTS_TEST_INTEGER_EQUAL(2, numFnCalls);
+    XTESTS_TEST_INTEGER_EQUAL(2, numPredCalls);
+
+    numFnCalls = 0;
+    numPredCalls = 0;
+
+    XTESTS_TEST_BOOLEAN_FALSE((v | transform(fn)).all_of(pred));
+    XTESTS_TEST_INTEGER_EQUAL(1, numFnCalls);
+    XTESTS_TEST_INTEGER_EQUAL(1, numPredCalls);
+}
+
+static void test_calls_after_first()
+{
+    std::vector<int> const v = iota(1000);
+
+    int     numFnCalls = 0;
+    int     numPredCalls = 0;
+    square  fn = { &numFnCalls };
+    is_odd  pred = { &numPredCalls };
+    int     r = 0;
+
+    XTESTS_TEST_BOOLEAN_TRUE((v | drop(10) | filter(pred) | transform(fn)).first(r));
+    XTESTS_TEST_INTEGER_EQUAL(121, r);
+    XTESTS_TEST_INTEGER_EQUAL(2, numPredCalls);
+    XTESTS_TEST_INTEGER_EQUAL(1, numFnCalls);
+}
+
+static void test_calls_in_composite()
+{
+    // a long chain, over a source of several batches, completing partway
+    // through a batch
+
+    std::vector<int> const v = iota(10000);
+
+    int     numPredCalls = 0;
+    int     numFnCalls = 0;
+    is_odd  pred = { &numPredCalls };
+    square  fn = { &numFnCalls };
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, (v | drop(50) | filter(pred) | transform(fn) | take_while(below(1000000)) | take(100)).count());
+    XTESTS_TEST_INTEGER_EQUAL(200, numPredCalls);
+    XTESTS_TEST_INTEGER_EQUAL(100, numFnCalls);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
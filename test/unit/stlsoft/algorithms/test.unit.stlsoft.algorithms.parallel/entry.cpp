@@ -0,0 +1,364 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.algorithms.parallel/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::par_for_all()`,
+ *          `stlsoft::par_transform()`, `stlsoft::par_accumulate()` and
+ *          `stlsoft::par_count_if()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/algorithms/parallel.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/containers/fixed_array.hpp>
+#include <stlsoft/synch/work_stealing_pool.hpp>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_for_all(void);
+    static void test_transform(void);
+    static void test_accumulate(void);
+    static void test_accumulate_deterministic(void);
+    static void test_accumulate_bool(void);
+    static void test_accumulate_string(void);
+    static void test_count_if(void);
+    static void test_grains(void);
+    static void test_fixed_array(void);
+    static void test_single_threaded_pool(void);
+    static void test_exception(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.algorithms.parallel", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_for_all);
+        XTESTS_RUN_CASE(test_transform);
+        XTESTS_RUN_CASE(test_accumulate);
+        XTESTS_RUN_CASE(test_accumulate_deterministic);
+        XTESTS_RUN_CASE(test_accumulate_bool);
+        XTESTS_RUN_CASE(test_accumulate_string);
+        XTESTS_RUN_CASE(test_count_if);
+        XTESTS_RUN_CASE(test_grains);
+        XTESTS_RUN_CASE(test_fixed_array);
+        XTESTS_RUN_CASE(test_single_threaded_pool);
+        XTESTS_RUN_CASE_THAT_THROWS(test_exception, std::runtime_error);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    std::vector<int> make_ints(size_t n)
+    {
+        std::vector<int> v(n);
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            v[i] = static_cast<int>(i % 1000) - 500;
+        }
+
+        return v;
+    }
+
+    struct is_odd
+    {
+        bool operator ()(int i) const
+        {
+            return 0 != (i & 1);
+        }
+    };
+
+    struct doubler
+    {
+        long operator ()(int i) const
+        {
+            return 2L * i;
+        }
+    };
+
+    // increments each element, counting the calls
+    struct incrementer
+    {
+        std::atomic<size_t>* numCalls;
+
+        void operator ()(int& i) const
+        {
+            ++i;
+            ++*numCalls;
+        }
+    };
+
+    struct logical_or
+    {
+        bool operator ()(bool lhs, bool rhs) const
+        {
+            return lhs || rhs;
+        }
+    };
+
+    struct logical_and
+    {
+        bool operator ()(bool lhs, bool rhs) const
+        {
+            return lhs && rhs;
+        }
+    };
+
+    struct thrower
+    {
+        void operator ()(int i) const
+        {
+            if (12345 == i)
+            {
+                throw std::runtime_error("chunk failed");
+            }
+        }
+    };
+
+
+static void test_empty()
+{
+    std::vector<int> const  v;
+    std::vector<int>        w;
+    std::vector<long>       out;
+
+    XTESTS_TEST_INTEGER_EQUAL(42, stlsoft::par_accumulate(v, 42));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::par_count_if(v, is_odd()));
+    XTESTS_TEST_BOOLEAN_TRUE(out.begin() == stlsoft::par_transform(v, out.begin(), doubler()));
+
+    std::atomic<size_t> numCalls(0);
+    incrementer         inc = { &numCalls };
+
+    stlsoft::par_for_all(w, inc);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numCalls.load());
+}
+
+static void test_for_all()
+{
+    std::vector<int>    v = make_ints(100000);
+    std::vector<int>    expected(v);
+    std::atomic<size_t> numCalls(0);
+    incrementer         inc = { &numCalls };
+
+    for (size_t i = 0; i != expected.size(); ++i)
+    {
+        ++expected[i];
+    }
+
+    stlsoft::par_for_all(v, inc, 1000);
+
+    XTESTS_TEST_INTEGER_EQUAL(v.size(), numCalls.load());
+    XTESTS_TEST_BOOLEAN_TRUE(expected == v);
+}
+
+static void test_transform()
+{
+    std::vector<int> const  v = make_ints(54321);
+    std::vector<long>       out(v.size());
+
+    std::vector<long>::iterator const end = stlsoft::par_transform(v, out.begin(), doubler(), 777);
+
+    XTESTS_TEST_BOOLEAN_TRUE(out.end() == end);
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        if (2L * v[i] != out[i])
+        {
+            XTESTS_TEST_INTEGER_EQUAL(2L * v[i], out[i]);
+
+            break;
+        }
+    }
+}
+
+static void test_accumulate()
+{
+    std::vector<int> const v = make_ints(123457);
+
+    XTESTS_TEST_INTEGER_EQUAL(std::accumulate(v.begin(), v.end(), 10), stlsoft::par_accumulate(v, 10));
+    XTESTS_TEST_INTEGER_EQUAL(std::accumulate(v.begin(), v.end(), 0L), stlsoft::par_accumulate(v, 0L, std::plus<long>(), 100));
+}
+
+static void test_accumulate_deterministic()
+{
+    // the per-chunk results are combined in chunk order, so a
+    // non-associative reduction gives the same result however the
+    // chunks are scheduled
+
+    std::vector<double> v(100000);
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        v[i] = 1.0 / static_cast<double>(1 + i);
+    }
+
+    double const r = stlsoft::par_accumulate(v, 0.0, std::plus<double>(), 333);
+
+    for (int i = 0; i != 20; ++i)
+    {
+        XTESTS_TEST_BOOLEAN_TRUE(r == stlsoft::par_accumulate(v, 0.0, std::plus<double>(), 333));
+    }
+}
+
+static void test_accumulate_bool()
+{
+    // a reduction to bool, for which the per-chunk results must be
+    // distinct objects (and so cannot be held in a std::vector<bool>)
+
+    std::vector<bool>   flags(50000, false);
+    std::vector<int>    ints(50000, 1);
+
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::par_accumulate(flags, false, logical_or(), 100));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::par_accumulate(ints, true, logical_and(), 100));
+
+    flags[43210] = true;
+    ints[49999] = 0;
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::par_accumulate(flags, false, logical_or(), 100));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::par_accumulate(ints, true, logical_and(), 100));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::par_accumulate(flags, true, logical_or(), 1));
+}
+
+static void test_accumulate_string()
+{
+    std::vector<std::string> v;
+
+    for (int i = 0; i != 5000; ++i)
+    {
+        v.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+    }
+
+    std::string const expected = std::accumulate(v.begin(), v.end(), std::string(">"));
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(expected, stlsoft::par_accumulate(v, std::string(">"), std::plus<std::string>(), 64));
+}
+
+static void test_count_if()
+{
+    std::vector<int> const v = make_ints(99999);
+
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<size_t>(std::count_if(v.begin(), v.end(), is_odd())), stlsoft::par_count_if(v, is_odd(), 1000));
+}
+
+static void test_grains()
+{
+    // grains that do, and do not, divide the size; that exceed it; and
+    // of a single element
+
+    std::vector<int> const  v = make_ints(10007);
+    long const              expected = std::accumulate(v.begin(), v.end(), 0L);
+
+    static size_t const grains[] = { 1, 2, 3, 7, 10, 1000, 10007, 10008, 1000000 };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(grains); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(expected, stlsoft::par_accumulate(v, 0L, std::plus<long>(), grains[i]));
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<size_t>(std::count_if(v.begin(), v.end(), is_odd())), stlsoft::par_count_if(v, is_odd(), grains[i]));
+    }
+}
+
+static void test_fixed_array()
+{
+    stlsoft::fixed_array_2d<int> a(300, 400);
+
+    for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            a(i0, i1) = static_cast<int>(i0 + i1);
+        }
+    }
+
+    long const expected = std::accumulate(a.data(), a.data() + a.size(), 0L);
+
+    XTESTS_TEST_INTEGER_EQUAL(expected, stlsoft::par_accumulate(a, 0L, std::plus<long>(), 1000));
+}
+
+static void test_single_threaded_pool()
+{
+    stlsoft::work_stealing_pool pool(1);
+    std::vector<int> const      v = make_ints(10000);
+
+    XTESTS_TEST_INTEGER_EQUAL(std::accumulate(v.begin(), v.end(), 0), stlsoft::par_accumulate(v, 0, std::plus<int>(), 100, pool));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<size_t>(std::count_if(v.begin(), v.end(), is_odd())), stlsoft::par_count_if(v, is_odd(), 100, pool));
+}
+
+static void test_exception()
+{
+    std::vector<int> v(20000);
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        v[i] = static_cast<int>(i);
+    }
+
+    stlsoft::par_for_all(v, thrower(), 100);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,522 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.algorithms.pod/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::pod_find()`, `stlsoft::pod_count()`,
+ *          `stlsoft::pod_replace()`, `stlsoft::pod_min_max()`,
+ *          `stlsoft::pod_equal()`, `stlsoft::pod_copy_nt()` and
+ *          `stlsoft::pod_fill_n_nt()`, against the standard algorithms,
+ *          over all lengths and alignments about those of the SIMD
+ *          blocks.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/algorithms/pod.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_find(void);
+    static void test_find_not_representable(void);
+    static void test_count(void);
+    static void test_replace(void);
+    static void test_min_max(void);
+    static void test_min_max_extremes(void);
+    static void test_equal(void);
+    static void test_floating_point(void);
+    static void test_copy_nt(void);
+    static void test_fill_n_nt(void);
+    static void test_non_temporal_large(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.algorithms.pod", verbosity))
+    {
+        XTESTS_RUN_CASE(test_find);
+        XTESTS_RUN_CASE(test_find_not_representable);
+        XTESTS_RUN_CASE(test_count);
+        XTESTS_RUN_CASE(test_replace);
+        XTESTS_RUN_CASE(test_min_max);
+        XTESTS_RUN_CASE(test_min_max_extremes);
+        XTESTS_RUN_CASE(test_equal);
+        XTESTS_RUN_CASE(test_floating_point);
+        XTESTS_RUN_CASE(test_copy_nt);
+        XTESTS_RUN_CASE(test_fill_n_nt);
+        XTESTS_RUN_CASE(test_non_temporal_large);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // The ranges are taken from within a larger buffer, at each offset in
+    // [0, MAX_OFFSET), so that they start at every alignment relative to
+    // the 16-byte blocks, and have each length in [0, MAX_LENGTH), so
+    // that they have every size of tail
+    size_t const MAX_OFFSET = 17;
+    size_t const MAX_LENGTH = 100;
+
+    // fills with values in [0, 7), which repeat irregularly
+    template <typename T>
+    void fill_pattern(std::vector<T>& v)
+    {
+        for (size_t i = 0; i != v.size(); ++i)
+        {
+            v[i] = static_cast<T>((i * 5 + i / 7) % 7);
+        }
+    }
+
+    template <typename T>
+    bool check_find()
+    {
+        std::vector<T> v(MAX_OFFSET + MAX_LENGTH);
+
+        for (size_t off = 0; off != MAX_OFFSET; ++off)
+        {
+            for (size_t n = 0; n != MAX_LENGTH; ++n)
+            {
+                std::fill(v.begin(), v.end(), T(1));
+
+                T* const first  =   &v[0] + off;
+                T* const last   =   first + n;
+
+                // not present
+                if (last != stlsoft::pod_find(first, last, 2))
+                {
+                    return false;
+                }
+
+                // present, at each position, and also beyond the range
+                v[off + n] = T(2);
+
+                for (size_t i = 0; i != n; ++i)
+                {
+                    first[i] = T(2);
+
+                    if (first + i != stlsoft::pod_find(first, last, 2))
+                    {
+                        return false;
+                    }
+
+                    first[i] = T(1);
+                }
+
+                if (last != stlsoft::pod_find(first, last, 2))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool check_count()
+    {
+        std::vector<T> v(MAX_OFFSET + MAX_LENGTH);
+
+        fill_pattern(v);
+
+        for (size_t off = 0; off != MAX_OFFSET; ++off)
+        {
+            for (size_t n = 0; n != MAX_LENGTH; ++n)
+            {
+                T* const first  =   &v[0] + off;
+                T* const last   =   first + n;
+
+                for (int value = 0; value != 8; ++value)
+                {
+                    size_t const expected = static_cast<size_t>(std::count(first, last, static_cast<T>(value)));
+
+                    if (expected != stlsoft::pod_count(first, last, value))
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool check_replace()
+    {
+        for (size_t off = 0; off != MAX_OFFSET; ++off)
+        {
+            for (size_t n = 0; n != MAX_LENGTH; ++n)
+            {
+                std::vector<T> v(MAX_OFFSET + MAX_LENGTH);
+
+                fill_pattern(v);
+
+                std::vector<T> expected(v);
+
+                std::replace(expected.begin() + off, expected.begin() + off + n, T(3), T(9));
+
+                stlsoft::pod_replace(&v[0] + off, &v[0] + off + n, 3, 9);
+
+                // (the elements outside the range are unchanged)
+                if (expected != v)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool min_max_matches(T* first, T* last)
+    {
+        T mn = T(0);
+        T mx = T(0);
+
+        return  stlsoft::pod_min_max(first, last, &mn, &mx) &&
+                *std::min_element(first, last) == mn &&
+                *std::max_element(first, last) == mx;
+    }
+
+    template <typename T>
+    bool check_min_max()
+    {
+        std::vector<T> v(MAX_OFFSET + MAX_LENGTH);
+
+        fill_pattern(v);
+
+        for (size_t off = 0; off != MAX_OFFSET; ++off)
+        {
+            for (size_t n = 1; n != MAX_LENGTH; ++n)
+            {
+                T* const first  =   &v[0] + off;
+                T* const last   =   first + n;
+
+                if (!min_max_matches(first, last))
+                {
+                    return false;
+                }
+
+                // the extremes at a range of positions, including the
+                // first and the last, which may lie outside the blocks
+                for (size_t i = 0; i < n; i = (n - 1 == i || n - 1 > i + 1 + i / 4) ? i + 1 + i / 4 : n - 1)
+                {
+                    T const saved = first[i];
+
+                    first[i] = static_cast<T>(100);
+
+                    if (!min_max_matches(first, last))
+                    {
+                        return false;
+                    }
+
+                    first[i] = static_cast<T>(0 - 1);
+
+                    if (!min_max_matches(first, last))
+                    {
+                        return false;
+                    }
+
+                    first[i] = saved;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    bool check_min_max_extremes()
+    {
+        T const lo = std::numeric_limits<T>::min();
+        T const hi = std::numeric_limits<T>::max();
+
+        std::vector<T> v(MAX_LENGTH, T(0));
+
+        v[37] = lo;
+        v[61] = hi;
+
+        T mn = T(0);
+        T mx = T(0);
+
+        if (!stlsoft::pod_min_max(&v[0], &v[0] + v.size(), &mn, &mx) ||
+            lo != mn ||
+            hi != mx)
+        {
+            return false;
+        }
+
+        // all the same
+        std::fill(v.begin(), v.end(), hi);
+
+        if (!stlsoft::pod_min_max(&v[0], &v[0] + v.size(), &mn, &mx) ||
+            hi != mn ||
+            hi != mx)
+        {
+            return false;
+        }
+
+        // empty
+        mn = T(1);
+        mx = T(2);
+
+        return !stlsoft::pod_min_max(&v[0], &v[0], &mn, &mx) && T(1) == mn && T(2) == mx;
+    }
+
+    template <typename T>
+    bool check_equal()
+    {
+        std::vector<T> v1(MAX_OFFSET + MAX_LENGTH);
+        std::vector<T> v2(MAX_OFFSET + MAX_LENGTH);
+
+        fill_pattern(v1);
+
+        for (size_t off = 0; off != MAX_OFFSET; ++off)
+        {
+            for (size_t n = 0; n != MAX_LENGTH; ++n)
+            {
+                std::copy(v1.begin(), v1.begin() + n, v2.begin() + off);
+
+                T const* const first1   =   &v1[0];
+                T* const       first2   =   &v2[0] + off;
+
+                if (!stlsoft::pod_equal(first1, first1 + n, first2))
+                {
+                    return false;
+                }
+
+                for (size_t i = 0; i != n; ++i)
+                {
+                    first2[i] = static_cast<T>(first2[i] + 1);
+
+                    if (stlsoft::pod_equal(first1, first1 + n, first2))
+                    {
+                        return false;
+                    }
+
+                    first2[i] = first1[i];
+                }
+            }
+        }
+
+        return true;
+    }
+
+#define POD_TEST_ALL_INTEGRAL_TYPES(fn)                                     \
+                                                                            \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<char>());                                   \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<signed char>());                            \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<unsigned char>());                          \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<short>());                                  \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<unsigned short>());                         \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<int>());                                    \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<unsigned int>());                           \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<long>());                                   \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<unsigned long>());                          \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<stlsoft::ss_sint64_t>());                      \
+    XTESTS_TEST_BOOLEAN_TRUE(fn<stlsoft::ss_uint64_t>())
+
+
+static void test_find()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_find);
+
+    // const elements
+    int const values[5] = { 1, 2, 3, 4, 5 };
+
+    XTESTS_TEST_POINTER_EQUAL(&values[3], stlsoft::pod_find(&values[0], &values[0] + 5, 4));
+}
+
+static void test_find_not_representable()
+{
+    // a value that is not representable in the element type matches no
+    // element, rather than one to which it is truncated
+
+    std::vector<unsigned char> v(40, static_cast<unsigned char>(44));
+
+    XTESTS_TEST_POINTER_EQUAL(&v[0] + v.size(), stlsoft::pod_find(&v[0], &v[0] + v.size(), 300));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::pod_count(&v[0], &v[0] + v.size(), 300));
+    XTESTS_TEST_INTEGER_EQUAL(40u, stlsoft::pod_count(&v[0], &v[0] + v.size(), 44));
+
+    std::vector<short> s(40, static_cast<short>(-1));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::pod_count(&s[0], &s[0] + s.size(), 65535));
+    XTESTS_TEST_INTEGER_EQUAL(40u, stlsoft::pod_count(&s[0], &s[0] + s.size(), -1));
+
+    stlsoft::pod_replace(&v[0], &v[0] + v.size(), 300, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(44, v[39]);
+}
+
+static void test_count()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_count);
+}
+
+static void test_replace()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_replace);
+}
+
+static void test_min_max()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_min_max);
+}
+
+static void test_min_max_extremes()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_min_max_extremes);
+}
+
+static void test_equal()
+{
+    POD_TEST_ALL_INTEGRAL_TYPES(check_equal);
+}
+
+static void test_floating_point()
+{
+    // the floating-point types are compared by value, rather than
+    // bitwise
+
+    XTESTS_TEST_BOOLEAN_TRUE(check_find<double>());
+    XTESTS_TEST_BOOLEAN_TRUE(check_count<float>());
+    XTESTS_TEST_BOOLEAN_TRUE(check_replace<double>());
+    XTESTS_TEST_BOOLEAN_TRUE(check_min_max<float>());
+
+    double const    zeros[3]    =   { 0.0, 0.0, 0.0 };
+    double const    negZeros[3] =   { -0.0, 0.0, -0.0 };
+    double const    nan         =   std::numeric_limits<double>::quiet_NaN();
+    double const    nans[3]     =   { 1.0, nan, 2.0 };
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::pod_equal(&zeros[0], &zeros[0] + 3, &negZeros[0]));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::pod_equal(&nans[0], &nans[0] + 3, &nans[0]));
+    XTESTS_TEST_POINTER_EQUAL(&negZeros[0], stlsoft::pod_find(&negZeros[0], &negZeros[0] + 3, 0.0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::pod_count(&nans[0], &nans[0] + 3, nan));
+}
+
+static void test_copy_nt()
+{
+    std::vector<unsigned char> src(MAX_OFFSET + 300);
+    std::vector<unsigned char> dest(MAX_OFFSET + 300 + 1);
+
+    fill_pattern(src);
+
+    for (size_t off = 0; off != MAX_OFFSET; ++off)
+    {
+        for (size_t n = 0; n < 300; n += 1 + n / 16)
+        {
+            std::fill(dest.begin(), dest.end(), static_cast<unsigned char>(0xAA));
+
+            stlsoft::pod_copy_nt(&src[0], &src[0] + n, &dest[0] + off);
+
+            XTESTS_TEST_INTEGER_EQUAL(0, ::memcmp(&src[0], &dest[0] + off, n));
+            XTESTS_TEST_INTEGER_EQUAL(0xAA, dest[off + n]);
+        }
+    }
+}
+
+static void test_fill_n_nt()
+{
+    std::vector<int> dest(MAX_OFFSET + 300 + 1);
+
+    for (size_t off = 0; off != MAX_OFFSET; ++off)
+    {
+        for (size_t n = 0; n < 300; n += 1 + n / 16)
+        {
+            std::fill(dest.begin(), dest.end(), -1);
+
+            stlsoft::pod_fill_n_nt(&dest[0] + off, n, 7);
+
+            XTESTS_TEST_INTEGER_EQUAL(static_cast<ptrdiff_t>(n), std::count(dest.begin(), dest.end(), 7));
+            XTESTS_TEST_INTEGER_EQUAL(-1, dest[off + n]);
+        }
+    }
+}
+
+static void test_non_temporal_large()
+{
+    // ranges above the threshold, which use streaming stores, starting
+    // at an unaligned address, and with a tail
+
+    size_t const n = STLSOFT_ALGORITHMS_POD_NON_TEMPORAL_THRESHOLD / sizeof(short) + 1001;
+
+    std::vector<short> src(n);
+    std::vector<short> dest(n + 3, static_cast<short>(-1));
+
+    fill_pattern(src);
+
+    stlsoft::pod_copy_nt(&src[0], &src[0] + n, &dest[0] + 1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(std::equal(src.begin(), src.end(), dest.begin() + 1));
+    XTESTS_TEST_INTEGER_EQUAL(-1, dest[0]);
+    XTESTS_TEST_INTEGER_EQUAL(-1, dest[n + 1]);
+
+    stlsoft::pod_fill_n_nt(&dest[0] + 1, n, 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<ptrdiff_t>(n), std::count(dest.begin(), dest.end(), static_cast<short>(3)));
+    XTESTS_TEST_INTEGER_EQUAL(-1, dest[0]);
+    XTESTS_TEST_INTEGER_EQUAL(-1, dest[n + 1]);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
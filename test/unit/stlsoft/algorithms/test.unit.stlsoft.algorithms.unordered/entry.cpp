@@ -0,0 +1,368 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.algorithms.unordered/entry.cpp
+ *
+ * Purpose: Unit-tests for the algorithms in `stlsoft/algorithms/unordered.hpp`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/algorithms/unordered.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <ctype.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_unordered_includes_empty(void);
+    static void test_unordered_includes_small(void);
+    static void test_unordered_includes_large(void);
+    static void test_unordered_includes_mixed_types(void);
+    static void test_unordered_includes_pred(void);
+    static void test_unordered_includes_hash_pred_small(void);
+    static void test_unordered_includes_hash_pred_large(void);
+    static void test_unordered_includes_hash_pred_non_lvalue(void);
+    static void test_find_first_duplicate(void);
+    static void test_unordered_unique(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.algorithms.unordered", verbosity))
+    {
+        XTESTS_RUN_CASE(test_unordered_includes_empty);
+        XTESTS_RUN_CASE(test_unordered_includes_small);
+        XTESTS_RUN_CASE(test_unordered_includes_large);
+        XTESTS_RUN_CASE(test_unordered_includes_mixed_types);
+        XTESTS_RUN_CASE(test_unordered_includes_pred);
+        XTESTS_RUN_CASE(test_unordered_includes_hash_pred_small);
+        XTESTS_RUN_CASE(test_unordered_includes_hash_pred_large);
+        XTESTS_RUN_CASE(test_unordered_includes_hash_pred_non_lvalue);
+        XTESTS_RUN_CASE(test_find_first_duplicate);
+        XTESTS_RUN_CASE(test_unordered_unique);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // case-insensitive equality and hashing, for which the default
+    // std::hash / operator == would give different results
+
+    struct ci_equal
+    {
+        bool operator ()(std::string const& lhs, std::string const& rhs) const
+        {
+            if (lhs.size() != rhs.size())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i != lhs.size(); ++i)
+            {
+                if (::tolower(static_cast<unsigned char>(lhs[i])) != ::tolower(static_cast<unsigned char>(rhs[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    struct ci_hash
+    {
+        size_t operator ()(std::string const& s) const
+        {
+            size_t h = 0;
+
+            for (size_t i = 0; i != s.size(); ++i)
+            {
+                h = h * 31 + static_cast<size_t>(::tolower(static_cast<unsigned char>(s[i])));
+            }
+
+            return h;
+        }
+    };
+
+    std::string word(int i, bool upper = false)
+    {
+        std::string s;
+
+        for (; ; i /= 26)
+        {
+            s += static_cast<char>((upper ? 'A' : 'a') + i % 26);
+
+            if (i < 26)
+            {
+                break;
+            }
+        }
+
+        return s;
+    }
+
+    std::vector<std::string> words(int from, int to, bool upper = false)
+    {
+        std::vector<std::string> v;
+
+        for (int i = from; i != to; ++i)
+        {
+            v.push_back(word(i, upper));
+        }
+
+        return v;
+    }
+
+    // an iterator yielding values, rather than references
+    class counting_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag   iterator_category;
+        typedef int                         value_type;
+        typedef std::ptrdiff_t              difference_type;
+        typedef int const*                  pointer;
+        typedef int                         reference;
+
+    public:
+        explicit counting_iterator(int i)
+            : m_i(i)
+        {}
+
+    public:
+        int operator *() const
+        {
+            return m_i;
+        }
+        counting_iterator& operator ++()
+        {
+            ++m_i;
+
+            return *this;
+        }
+        bool operator ==(counting_iterator const& rhs) const
+        {
+            return m_i == rhs.m_i;
+        }
+        bool operator !=(counting_iterator const& rhs) const
+        {
+            return m_i != rhs.m_i;
+        }
+
+    private:
+        int m_i;
+    };
+
+
+static void test_unordered_includes_empty()
+{
+    std::vector<int> const  empty;
+    std::vector<int> const  v(3, 1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(empty.begin(), empty.end(), empty.begin(), empty.end()));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(v.begin(), v.end(), empty.begin(), empty.end()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(empty.begin(), empty.end(), v.begin(), v.end()));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(v.begin(), v.end(), empty.begin(), empty.end(), std::hash<int>(), std::equal_to<int>()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(empty.begin(), empty.end(), v.begin(), v.end(), std::hash<int>(), std::equal_to<int>()));
+}
+
+static void test_unordered_includes_small()
+{
+    int const   a1[] = { 5, 3, 9, 1, 7 };
+    int const   a2[] = { 9, 1, 1, 5 };
+    int const   a3[] = { 9, 2 };
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(a1, a1 + 5, a2, a2 + 4));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(a1, a1 + 5, a3, a3 + 2));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(a2, a2 + 4, a1, a1 + 5));
+}
+
+static void test_unordered_includes_large()
+{
+    std::vector<std::string> const  all     =   words(0, 2000);
+    std::vector<std::string>        some    =   words(500, 1500);
+    std::vector<std::string> const  others  =   words(1990, 2010);
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(all.begin(), all.end(), some.begin(), some.end()));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(all.begin(), all.end(), all.rbegin(), all.rend()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(all.begin(), all.end(), others.begin(), others.end()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(some.begin(), some.end(), all.begin(), all.end()));
+
+    some.push_back("not-a-word");
+
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(all.begin(), all.end(), some.begin(), some.end()));
+}
+
+static void test_unordered_includes_mixed_types()
+{
+    // ranges of different types, or of values, are searched linearly
+
+    std::vector<int>    v;
+    std::list<long>     l;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(i);
+    }
+    l.push_back(10);
+    l.push_back(999);
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(v.begin(), v.end(), l.begin(), l.end()));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(v.begin(), v.end(), counting_iterator(100), counting_iterator(900)));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(v.begin(), v.end(), counting_iterator(100), counting_iterator(1001)));
+
+    l.push_back(1000);
+
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(v.begin(), v.end(), l.begin(), l.end()));
+}
+
+static void test_unordered_includes_pred()
+{
+    std::vector<std::string> const  lower   =   words(0, 100);
+    std::vector<std::string> const  upper   =   words(0, 50, true);
+
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(lower.begin(), lower.end(), upper.begin(), upper.end()));
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(lower.begin(), lower.end(), upper.begin(), upper.end(), ci_equal()));
+}
+
+static void test_unordered_includes_hash_pred_small()
+{
+    std::vector<std::string> const  lower   =   words(0, 100);
+    std::vector<std::string> const  upper   =   words(0, 50, true);
+    std::vector<std::string> const  beyond  =   words(90, 110, true);
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(lower.begin(), lower.end(), upper.begin(), upper.end(), ci_hash(), ci_equal()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(lower.begin(), lower.end(), beyond.begin(), beyond.end(), ci_hash(), ci_equal()));
+}
+
+static void test_unordered_includes_hash_pred_large()
+{
+    std::vector<std::string> const  lower   =   words(0, 5000);
+    std::vector<std::string> const  upper   =   words(1000, 4000, true);
+    std::vector<std::string>        beyond  =   words(4000, 5001, true);
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(lower.begin(), lower.end(), upper.begin(), upper.end(), ci_hash(), ci_equal()));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(lower.begin(), lower.end(), beyond.begin(), beyond.end(), ci_hash(), ci_equal()));
+
+    beyond.pop_back();
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(lower.begin(), lower.end(), beyond.begin(), beyond.end(), ci_hash(), ci_equal()));
+
+    // and, as a check on the test, not so with the default comparison
+
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(lower.begin(), lower.end(), upper.begin(), upper.end()));
+}
+
+static void test_unordered_includes_hash_pred_non_lvalue()
+{
+    // hash and predicate are accepted, but the search is linear, when the
+    // second range yields values
+
+    std::vector<int> v;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(2 * i);
+    }
+
+    std::hash<int> const        hash    =   std::hash<int>();
+    std::equal_to<int> const    pred    =   std::equal_to<int>();
+
+    XTESTS_TEST_BOOLEAN_TRUE(stlsoft::unordered_includes(v.begin(), v.end(), counting_iterator(0), counting_iterator(1), hash, pred));
+    XTESTS_TEST_BOOLEAN_FALSE(stlsoft::unordered_includes(v.begin(), v.end(), counting_iterator(0), counting_iterator(2), hash, pred));
+}
+
+static void test_find_first_duplicate()
+{
+    std::vector<std::string> v = words(0, 1000);
+
+    XTESTS_TEST(v.end() == stlsoft::find_first_duplicate(v.begin(), v.end()).first);
+    XTESTS_TEST(v.end() == stlsoft::find_first_duplicate(v.begin(), v.end(), ci_hash(), ci_equal()).first);
+
+    v[700] = word(300, true);
+
+    XTESTS_TEST(v.end() == stlsoft::find_first_duplicate(v.begin(), v.end()).first);
+
+    std::pair<std::vector<std::string>::iterator, std::vector<std::string>::iterator> const r = stlsoft::find_first_duplicate(v.begin(), v.end(), ci_hash(), ci_equal());
+
+    XTESTS_TEST_INTEGER_EQUAL(300, r.first - v.begin());
+    XTESTS_TEST_INTEGER_EQUAL(700, r.second - v.begin());
+}
+
+static void test_unordered_unique()
+{
+    std::vector<int> v;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back((i * 7) % 300);
+    }
+
+    std::vector<int>::iterator const e = stlsoft::unordered_unique(v.begin(), v.end());
+
+    XTESTS_TEST_INTEGER_EQUAL(300, e - v.begin());
+
+    for (int i = 0; i != 300; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL((i * 7) % 300, v[i]);
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
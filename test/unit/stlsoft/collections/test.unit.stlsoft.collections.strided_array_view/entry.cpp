@@ -0,0 +1,522 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.collections.strided_array_view/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::strided_array_view_1d`,
+ *          `stlsoft::strided_array_view_2d` and
+ *          `stlsoft::calc_padded_row_stride()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/collections/strided_array_view.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/containers/fixed_array.hpp>
+
+/* Standard C++ header files */
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_1d_default(void);
+    static void test_1d_dense(void);
+    static void test_1d_strided(void);
+    static void test_1d_negative_stride(void);
+    static void test_1d_slice(void);
+    static void test_1d_iterators(void);
+    static void test_1d_at(void);
+    static void test_1d_const_conversion(void);
+    static void test_2d_default(void);
+    static void test_2d_dense(void);
+    static void test_2d_row_and_column(void);
+    static void test_2d_block(void);
+    static void test_2d_transpose(void);
+    static void test_2d_at(void);
+    static void test_2d_modify_through_view(void);
+    static void test_make_from_containers(void);
+    static void test_calc_padded_row_stride(void);
+    static void test_padded_storage(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.collections.strided_array_view", verbosity))
+    {
+        XTESTS_RUN_CASE(test_1d_default);
+        XTESTS_RUN_CASE(test_1d_dense);
+        XTESTS_RUN_CASE(test_1d_strided);
+        XTESTS_RUN_CASE(test_1d_negative_stride);
+        XTESTS_RUN_CASE(test_1d_slice);
+        XTESTS_RUN_CASE(test_1d_iterators);
+        XTESTS_RUN_CASE_THAT_THROWS(test_1d_at, std::out_of_range);
+        XTESTS_RUN_CASE(test_1d_const_conversion);
+        XTESTS_RUN_CASE(test_2d_default);
+        XTESTS_RUN_CASE(test_2d_dense);
+        XTESTS_RUN_CASE(test_2d_row_and_column);
+        XTESTS_RUN_CASE(test_2d_block);
+        XTESTS_RUN_CASE(test_2d_transpose);
+        XTESTS_RUN_CASE_THAT_THROWS(test_2d_at, std::out_of_range);
+        XTESTS_RUN_CASE(test_2d_modify_through_view);
+        XTESTS_RUN_CASE(test_make_from_containers);
+        XTESTS_RUN_CASE(test_calc_padded_row_stride);
+        XTESTS_RUN_CASE(test_padded_storage);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::strided_array_view_1d<int>         view_1d_t;
+    typedef stlsoft::strided_array_view_1d<int const>   const_view_1d_t;
+    typedef stlsoft::strided_array_view_2d<int>         view_2d_t;
+    typedef stlsoft::strided_array_view_2d<int const>   const_view_2d_t;
+
+    // 0, 1, 2, ..., n - 1
+    std::vector<int> iota(size_t n)
+    {
+        std::vector<int> v(n);
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            v[i] = static_cast<int>(i);
+        }
+
+        return v;
+    }
+
+
+static void test_1d_default()
+{
+    view_1d_t const v;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, v.size());
+    XTESTS_TEST_BOOLEAN_TRUE(v.empty());
+    XTESTS_TEST(v.begin() == v.end());
+}
+
+static void test_1d_dense()
+{
+    std::vector<int>    a = iota(10);
+    view_1d_t const     v(&a[0], a.size());
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(10u, v.dimension0());
+    XTESTS_TEST_INTEGER_EQUAL(1, v.stride0());
+    XTESTS_TEST_BOOLEAN_TRUE(v.is_contiguous());
+    XTESTS_TEST_POINTER_EQUAL(&a[0], v.data());
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(i), v[i]);
+    }
+}
+
+static void test_1d_strided()
+{
+    std::vector<int>    a = iota(30);
+    view_1d_t const     v(&a[2], 10, 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(3, v.stride0());
+    XTESTS_TEST_BOOLEAN_FALSE(v.is_contiguous());
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(2 + 3 * i), v[i]);
+    }
+}
+
+static void test_1d_negative_stride()
+{
+    std::vector<int>    a = iota(10);
+    view_1d_t const     v(&a[9], 10, -1);
+
+    for (size_t i = 0; i != v.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(9 - i), v[i]);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(45, std::accumulate(v.begin(), v.end(), 0));
+}
+
+static void test_1d_slice()
+{
+    std::vector<int>    a = iota(20);
+    view_1d_t const     v(&a[0], 10, 2);        // 0, 2, 4, ..., 18
+    view_1d_t const     s1 = v.slice(1, 4);     // 2, 4, 6, 8
+    view_1d_t const     s2 = v.slice(0, 5, 2);  // 0, 4, 8, 12, 16
+    view_1d_t const     s3 = v.slice(9, 10, -1);// 18, 16, ..., 0
+    view_1d_t const     s4 = v.slice(3, 0);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, s1.size());
+    XTESTS_TEST_INTEGER_EQUAL(2, s1[0]);
+    XTESTS_TEST_INTEGER_EQUAL(8, s1[3]);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, s2.size());
+    XTESTS_TEST_INTEGER_EQUAL(4, s2.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(16, s2[4]);
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, s3.size());
+    XTESTS_TEST_INTEGER_EQUAL(18, s3[0]);
+    XTESTS_TEST_INTEGER_EQUAL(0, s3[9]);
+
+    XTESTS_TEST_BOOLEAN_TRUE(s4.empty());
+}
+
+static void test_1d_iterators()
+{
+    std::vector<int>    a = iota(12);
+    view_1d_t const     v(&a[1], 4, 3);         // 1, 4, 7, 10
+
+    XTESTS_TEST_INTEGER_EQUAL(4, v.end() - v.begin());
+    XTESTS_TEST_INTEGER_EQUAL(22, std::accumulate(v.begin(), v.end(), 0));
+    XTESTS_TEST_INTEGER_EQUAL(7, *(v.begin() + 2));
+    XTESTS_TEST_INTEGER_EQUAL(10, v.begin()[3]);
+    XTESTS_TEST_INTEGER_EQUAL(10, *(v.end() - 1));
+    XTESTS_TEST(v.begin() < v.end());
+
+    view_1d_t::iterator it = v.begin();
+
+    ++it;
+    it += 2;
+    --it;
+
+    XTESTS_TEST_INTEGER_EQUAL(7, *it);
+
+    // modify through the iterators, and sort the view in place
+
+    std::fill(v.begin(), v.end(), 0);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, a[4]);
+    XTESTS_TEST_INTEGER_EQUAL(5, a[5]);
+
+    std::vector<int>    b(10);
+    view_1d_t const     w(&b[0], 5, 2);
+
+    for (size_t i = 0; i != w.size(); ++i)
+    {
+        w[i] = static_cast<int>(10 - i);
+        b[2 * i + 1] = -1;
+    }
+
+    std::sort(w.begin(), w.end());
+
+    XTESTS_TEST_INTEGER_EQUAL(6, b[0]);
+    XTESTS_TEST_INTEGER_EQUAL(10, b[8]);
+    XTESTS_TEST_INTEGER_EQUAL(-1, b[1]);
+}
+
+static void test_1d_at()
+{
+    std::vector<int>    a = iota(10);
+    view_1d_t const     v(&a[0], 5, 2);
+
+    XTESTS_TEST_INTEGER_EQUAL(8, v.at(4));
+
+    v.at(5);
+}
+
+static void test_1d_const_conversion()
+{
+    std::vector<int>        a = iota(10);
+    view_1d_t const         v(&a[0], 10);
+    const_view_1d_t const   cv(v);
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, cv.size());
+    XTESTS_TEST_INTEGER_EQUAL(9, cv[9]);
+
+    view_1d_t   v1(&a[0], 2);
+    view_1d_t   v2(&a[5], 3);
+
+    v1.swap(v2);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, v1.size());
+    XTESTS_TEST_INTEGER_EQUAL(5, v1[0]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, v2.size());
+}
+
+static void test_2d_default()
+{
+    view_2d_t const v;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, v.size());
+    XTESTS_TEST_BOOLEAN_TRUE(v.empty());
+}
+
+static void test_2d_dense()
+{
+    std::vector<int>    a = iota(12);
+    view_2d_t const     m(&a[0], 3, 4);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, m.dimension0());
+    XTESTS_TEST_INTEGER_EQUAL(4u, m.dimension1());
+    XTESTS_TEST_INTEGER_EQUAL(4, m.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(1, m.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(12u, m.size());
+    XTESTS_TEST_BOOLEAN_TRUE(m.is_contiguous());
+
+    for (size_t i0 = 0; i0 != 3; ++i0)
+    {
+        for (size_t i1 = 0; i1 != 4; ++i1)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(4 * i0 + i1), m(i0, i1));
+            XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(4 * i0 + i1), m[i0][i1]);
+        }
+    }
+}
+
+static void test_2d_row_and_column()
+{
+    std::vector<int>    a = iota(12);
+    view_2d_t const     m(&a[0], 3, 4);
+    view_1d_t const     r = m.row(1);
+    view_1d_t const     c = m.column(2);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, r.size());
+    XTESTS_TEST_INTEGER_EQUAL(1, r.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(4, r[0]);
+    XTESTS_TEST_INTEGER_EQUAL(7, r[3]);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, c.size());
+    XTESTS_TEST_INTEGER_EQUAL(4, c.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(2, c[0]);
+    XTESTS_TEST_INTEGER_EQUAL(6, c[1]);
+    XTESTS_TEST_INTEGER_EQUAL(10, c[2]);
+    XTESTS_TEST_INTEGER_EQUAL(18, std::accumulate(c.begin(), c.end(), 0));
+}
+
+static void test_2d_block()
+{
+    std::vector<int>    a = iota(30);
+    view_2d_t const     m(&a[0], 5, 6);
+    view_2d_t const     b = m.block(1, 2, 3, 2);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, b.dimension0());
+    XTESTS_TEST_INTEGER_EQUAL(2u, b.dimension1());
+    XTESTS_TEST_INTEGER_EQUAL(6, b.stride0());
+    XTESTS_TEST_BOOLEAN_FALSE(b.is_contiguous());
+
+    for (size_t i0 = 0; i0 != 3; ++i0)
+    {
+        for (size_t i1 = 0; i1 != 2; ++i1)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(m(1 + i0, 2 + i1), b(i0, i1));
+        }
+    }
+
+    // a block of a block
+
+    view_2d_t const bb = b.block(1, 1, 2, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(15, bb(0, 0));
+    XTESTS_TEST_INTEGER_EQUAL(21, bb(1, 0));
+
+    // a block of whole rows is contiguous
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.block(2, 0, 2, 6).is_contiguous());
+}
+
+static void test_2d_transpose()
+{
+    std::vector<int>    a = iota(12);
+    view_2d_t const     m(&a[0], 3, 4);
+    view_2d_t const     t = m.transpose();
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, t.dimension0());
+    XTESTS_TEST_INTEGER_EQUAL(3u, t.dimension1());
+    XTESTS_TEST_INTEGER_EQUAL(1, t.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(4, t.stride1());
+    XTESTS_TEST_BOOLEAN_FALSE(t.is_contiguous());
+
+    for (size_t i0 = 0; i0 != 3; ++i0)
+    {
+        for (size_t i1 = 0; i1 != 4; ++i1)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(m(i0, i1), t(i1, i0));
+        }
+    }
+
+    // rows of the transpose are columns of the original
+
+    XTESTS_TEST_INTEGER_EQUAL(m.column(3)[2], t.row(3)[2]);
+
+    // the transpose of the transpose is the original
+
+    view_2d_t const tt = t.transpose();
+
+    XTESTS_TEST_INTEGER_EQUAL(m.stride0(), tt.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(m.stride1(), tt.stride1());
+    XTESTS_TEST_BOOLEAN_TRUE(tt.is_contiguous());
+}
+
+static void test_2d_at()
+{
+    std::vector<int>    a = iota(12);
+    view_2d_t const     m(&a[0], 3, 4);
+
+    XTESTS_TEST_INTEGER_EQUAL(11, m.at(2, 3));
+
+    m.at(2, 4);
+}
+
+static void test_2d_modify_through_view()
+{
+    // transpose a square matrix in place, through two views
+
+    std::vector<int>    a = iota(16);
+    view_2d_t const     m(&a[0], 4, 4);
+    view_2d_t const     t = m.transpose();
+
+    for (size_t i0 = 0; i0 != 4; ++i0)
+    {
+        for (size_t i1 = i0 + 1; i1 != 4; ++i1)
+        {
+            std::swap(m(i0, i1), t(i0, i1));
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(4, a[1]);
+    XTESTS_TEST_INTEGER_EQUAL(1, a[4]);
+    XTESTS_TEST_INTEGER_EQUAL(15, a[15]);
+    XTESTS_TEST_INTEGER_EQUAL(14, a[11]);
+
+    // and a const view of it
+
+    const_view_2d_t const cm(m);
+
+    XTESTS_TEST_INTEGER_EQUAL(4, cm(0, 1));
+}
+
+static void test_make_from_containers()
+{
+    std::vector<int> const  a = iota(5);
+    const_view_1d_t const   v = stlsoft::make_strided_array_view_1d(a);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, v.size());
+    XTESTS_TEST_INTEGER_EQUAL(4, v[4]);
+
+    stlsoft::fixed_array_2d<int>    fa(3, 5, 0);
+    view_2d_t const                 m = stlsoft::make_strided_array_view_2d(fa);
+
+    m(2, 4) = 7;
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, m.dimension0());
+    XTESTS_TEST_INTEGER_EQUAL(5u, m.dimension1());
+    XTESTS_TEST_INTEGER_EQUAL(7, fa(2, 4));
+
+    stlsoft::fixed_array_2d<int> const& cfa = fa;
+    const_view_2d_t const               cm  = stlsoft::make_strided_array_view_2d(cfa);
+
+    XTESTS_TEST_INTEGER_EQUAL(7, cm(2, 4));
+}
+
+static void test_calc_padded_row_stride()
+{
+    // an odd number of 64-byte units (of 8 doubles)
+
+    XTESTS_TEST_INTEGER_EQUAL(8u, stlsoft::calc_padded_row_stride<double>(8, 64));
+    XTESTS_TEST_INTEGER_EQUAL(24u, stlsoft::calc_padded_row_stride<double>(9, 64));
+    XTESTS_TEST_INTEGER_EQUAL(24u, stlsoft::calc_padded_row_stride<double>(24, 64));
+    XTESTS_TEST_INTEGER_EQUAL(1032u, stlsoft::calc_padded_row_stride<double>(1024, 64));
+    XTESTS_TEST_INTEGER_EQUAL(1040u, stlsoft::calc_padded_row_stride<float>(1024, 64));
+    XTESTS_TEST_INTEGER_EQUAL(1u * 16, stlsoft::calc_padded_row_stride<float>(1));
+
+    // and where the unit is not a multiple of the element size
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, stlsoft::calc_padded_row_stride<double>(100, 4));
+    XTESTS_TEST_INTEGER_EQUAL(100u, stlsoft::calc_padded_row_stride<char[3]>(100, 64));
+
+    for (size_t d1 = 1; d1 != 300; ++d1)
+    {
+        size_t const s      =   stlsoft::calc_padded_row_stride<double>(d1, 64);
+        size_t const units  =   s / 8;
+
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(d1, s);
+        XTESTS_TEST_INTEGER_EQUAL(0u, s % 8);
+        XTESTS_TEST_BOOLEAN_TRUE(1 == units || 1 == units % 2);
+    }
+}
+
+static void test_padded_storage()
+{
+    size_t const    d0  =   20;
+    size_t const    d1  =   32;
+    size_t const    s   =   stlsoft::calc_padded_row_stride<int>(d1, 64);
+
+    stlsoft::fixed_array_2d<int>    storage(d0, s, -1);
+    view_2d_t const                 m = stlsoft::make_strided_array_view_2d(storage).block(0, 0, d0, d1);
+
+    XTESTS_TEST_INTEGER_EQUAL(48u, s);
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<ptrdiff_t>(s), m.stride0());
+
+    for (size_t i0 = 0; i0 != d0; ++i0)
+    {
+        for (size_t i1 = 0; i1 != d1; ++i1)
+        {
+            m(i0, i1) = static_cast<int>(i0 * d1 + i1);
+        }
+    }
+
+    // the padding is untouched
+
+    XTESTS_TEST_INTEGER_EQUAL(-1, storage(0, d1));
+    XTESTS_TEST_INTEGER_EQUAL(-1, storage(d0 - 1, s - 1));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<int>(d0 * d1 - 1), storage(d0 - 1, d1 - 1));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,563 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.dynamic_bitset/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::dynamic_bitset`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/dynamic_bitset.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+/* Standard C header files */
+#include <stddef.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_ctor_default(void);
+    static void test_ctor_value(void);
+    static void test_set_reset_flip(void);
+    static void test_test_out_of_range(void);
+    static void test_resize(void);
+    static void test_push_back(void);
+    static void test_allocation_failure(void);
+    static void test_find_first_find_next(void);
+    static void test_set_operations(void);
+    static void test_rank_select(void);
+    static void test_rank_select_with_index(void);
+    static void test_rank_index_invalidation(void);
+    static void test_copy_and_swap(void);
+    static void test_against_vector_bool(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.dynamic_bitset", verbosity))
+    {
+        XTESTS_RUN_CASE(test_ctor_default);
+        XTESTS_RUN_CASE(test_ctor_value);
+        XTESTS_RUN_CASE(test_set_reset_flip);
+        XTESTS_RUN_CASE_THAT_THROWS(test_test_out_of_range, std::out_of_range);
+        XTESTS_RUN_CASE(test_resize);
+        XTESTS_RUN_CASE(test_push_back);
+        XTESTS_RUN_CASE(test_allocation_failure);
+        XTESTS_RUN_CASE(test_find_first_find_next);
+        XTESTS_RUN_CASE(test_set_operations);
+        XTESTS_RUN_CASE(test_rank_select);
+        XTESTS_RUN_CASE(test_rank_select_with_index);
+        XTESTS_RUN_CASE(test_rank_index_invalidation);
+        XTESTS_RUN_CASE(test_copy_and_swap);
+        XTESTS_RUN_CASE(test_against_vector_bool);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::dynamic_bitset<>                       bitset_t;
+    typedef stlsoft::dynamic_bitset<1>                      small_bitset_t;
+
+    // an allocator that returns NULL, rather than throwing, for requests
+    // of more than limited_allocator_limit elements
+
+    size_t limited_allocator_limit = 0;
+
+    template <typename T>
+    struct limited_allocator
+    {
+        typedef T               value_type;
+        typedef T*              pointer;
+        typedef T const*        const_pointer;
+        typedef T&              reference;
+        typedef T const&        const_reference;
+        typedef size_t          size_type;
+        typedef ptrdiff_t       difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef limited_allocator<U> other;
+        };
+
+        limited_allocator()
+        {}
+        template <typename U>
+        limited_allocator(limited_allocator<U> const&)
+        {}
+
+        T* allocate(size_t n, void const* = NULL)
+        {
+            return (n > limited_allocator_limit) ? NULL : static_cast<T*>(::malloc(n * sizeof(T)));
+        }
+        void deallocate(T* p, size_t = 0)
+        {
+            ::free(p);
+        }
+
+        bool operator ==(limited_allocator const&) const
+        {
+            return true;
+        }
+        bool operator !=(limited_allocator const&) const
+        {
+            return false;
+        }
+    };
+
+    typedef stlsoft::dynamic_bitset<1, limited_allocator<stlsoft::ss_uint64_t> > limited_bitset_t;
+
+
+static void test_ctor_default()
+{
+    bitset_t    bs;
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.count());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.num_words());
+    XTESTS_TEST_BOOLEAN_FALSE(bs.any());
+    XTESTS_TEST_BOOLEAN_TRUE(bs.none());
+    XTESTS_TEST_BOOLEAN_TRUE(bs.all());
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.find_first());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.rank(0));
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.select(0));
+}
+
+static void test_ctor_value()
+{
+    {
+        bitset_t    bs(100);
+
+        XTESTS_TEST_BOOLEAN_FALSE(bs.empty());
+        XTESTS_TEST_INTEGER_EQUAL(100u, bs.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, bs.count());
+        XTESTS_TEST_INTEGER_EQUAL(2u, bs.num_words());
+        XTESTS_TEST_BOOLEAN_TRUE(bs.none());
+    }
+
+    {
+        bitset_t    bs(100, true);
+
+        XTESTS_TEST_INTEGER_EQUAL(100u, bs.size());
+        XTESTS_TEST_INTEGER_EQUAL(100u, bs.count());
+        XTESTS_TEST_BOOLEAN_TRUE(bs.all());
+        XTESTS_TEST_BOOLEAN_TRUE(bs[0]);
+        XTESTS_TEST_BOOLEAN_TRUE(bs[99]);
+
+        // the unused bits of the last word are clear
+        XTESTS_TEST_INTEGER_EQUAL(0u, bs.data()[1] >> 36);
+    }
+}
+
+static void test_set_reset_flip()
+{
+    bitset_t    bs(130);
+
+    bs.set(0).set(64).set(129);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, bs.count());
+    XTESTS_TEST_BOOLEAN_TRUE(bs.test(0));
+    XTESTS_TEST_BOOLEAN_FALSE(bs.test(1));
+    XTESTS_TEST_BOOLEAN_TRUE(bs.test(64));
+    XTESTS_TEST_BOOLEAN_TRUE(bs.test(129));
+
+    bs.reset(64);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, bs.count());
+    XTESTS_TEST_BOOLEAN_FALSE(bs[64]);
+
+    bs.flip(64).flip(0);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, bs.count());
+    XTESTS_TEST_BOOLEAN_FALSE(bs[0]);
+    XTESTS_TEST_BOOLEAN_TRUE(bs[64]);
+
+    bs.flip();
+
+    XTESTS_TEST_INTEGER_EQUAL(128u, bs.count());
+    XTESTS_TEST_BOOLEAN_TRUE(bs[0]);
+    XTESTS_TEST_BOOLEAN_FALSE(bs[64]);
+    XTESTS_TEST_BOOLEAN_FALSE(bs[129]);
+
+    bs.set();
+
+    XTESTS_TEST_INTEGER_EQUAL(130u, bs.count());
+    XTESTS_TEST_BOOLEAN_TRUE(bs.all());
+
+    bs.reset();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.count());
+    XTESTS_TEST_BOOLEAN_TRUE(bs.none());
+}
+
+static void test_test_out_of_range()
+{
+    bitset_t    bs(10);
+
+    bs.test(10);
+}
+
+static void test_resize()
+{
+    bitset_t    bs(10, true);
+
+    bs.resize(70, true);
+
+    XTESTS_TEST_INTEGER_EQUAL(70u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(70u, bs.count());
+
+    bs.resize(200);
+
+    XTESTS_TEST_INTEGER_EQUAL(200u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(70u, bs.count());
+    XTESTS_TEST_BOOLEAN_FALSE(bs[70]);
+
+    bs.resize(5);
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(5u, bs.count());
+
+    // bits removed by a shrink do not reappear on a subsequent grow
+    bs.resize(100);
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(5u, bs.count());
+
+    bs.clear();
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.count());
+}
+
+static void test_push_back()
+{
+    small_bitset_t  bs;
+
+    { for (size_t i = 0; i != 1000; ++i)
+    {
+        bs.push_back(0 == i % 3);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(334u, bs.count());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u, bs.capacity());
+
+    { for (size_t i = 0; i != 1000; ++i)
+    {
+        XTESTS_TEST_BOOLEAN_TRUE((0 == i % 3) == bs[i]);
+    }}
+}
+
+static void test_allocation_failure()
+{
+    limited_allocator_limit = 4;
+
+    limited_bitset_t    bs(64 * 3, true);
+
+    XTESTS_TEST_INTEGER_EQUAL(192u, bs.size());
+
+    // geometric growth would request 6 words, which fails, so the exact
+    // size is requested instead
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs.resize(64 * 4, true));
+    XTESTS_TEST_INTEGER_EQUAL(256u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(256u, bs.count());
+
+    // beyond the limit, failure is reported and the instance is unchanged
+
+    bool    threw   =   false;
+
+    try
+    {
+        bs.resize(64 * 5, true);
+    }
+    catch (std::bad_alloc&)
+    {
+        threw = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(threw);
+    XTESTS_TEST_INTEGER_EQUAL(256u, bs.size());
+    XTESTS_TEST_INTEGER_EQUAL(256u, bs.count());
+
+    threw = false;
+
+    try
+    {
+        bs.push_back(true);
+    }
+    catch (std::bad_alloc&)
+    {
+        threw = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(threw);
+    XTESTS_TEST_INTEGER_EQUAL(256u, bs.size());
+
+    threw = false;
+
+    try
+    {
+        limited_bitset_t bs2(64 * 5);
+    }
+    catch (std::bad_alloc&)
+    {
+        threw = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(threw);
+
+    // shrinking needs no allocation
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs.resize(10));
+    XTESTS_TEST_INTEGER_EQUAL(10u, bs.count());
+}
+
+static void test_find_first_find_next()
+{
+    bitset_t            bs(1000);
+    size_t const        positions[] = { 3, 63, 64, 65, 511, 512, 998, 999 };
+    std::vector<size_t> found;
+
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.find_first());
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(positions); ++i)
+    {
+        bs.set(positions[i]);
+    }}
+
+    { for (size_t pos = bs.find_first(); bitset_t::npos != pos; pos = bs.find_next(pos))
+    {
+        found.push_back(pos);
+    }}
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(STLSOFT_NUM_ELEMENTS(positions), found.size()));
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(positions); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(positions[i], found[i]);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.find_next(999));
+}
+
+static void test_set_operations()
+{
+    bitset_t    lhs(300);
+    bitset_t    rhs(300);
+
+    { for (size_t i = 0; i != 300; ++i)
+    {
+        lhs.set(i, 0 == i % 2);
+        rhs.set(i, 0 == i % 3);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(50u, (lhs & rhs).count());
+    XTESTS_TEST_INTEGER_EQUAL(200u, (lhs | rhs).count());
+    XTESTS_TEST_INTEGER_EQUAL(150u, (lhs ^ rhs).count());
+    XTESTS_TEST_INTEGER_EQUAL(100u, (lhs - rhs).count());
+    XTESTS_TEST_BOOLEAN_TRUE(lhs.intersects(rhs));
+    XTESTS_TEST_BOOLEAN_FALSE((lhs - rhs).intersects(rhs));
+
+    bitset_t    t(lhs);
+
+    t &= rhs;
+
+    XTESTS_TEST_BOOLEAN_TRUE(t == (lhs & rhs));
+    XTESTS_TEST_BOOLEAN_TRUE(t != lhs);
+}
+
+static void test_rank_select()
+{
+    bitset_t    bs(1000);
+
+    { for (size_t i = 0; i < 1000; i += 7)
+    {
+        bs.set(i);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(143u, bs.count());
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.rank(0));
+    XTESTS_TEST_INTEGER_EQUAL(1u, bs.rank(1));
+    XTESTS_TEST_INTEGER_EQUAL(1u, bs.rank(7));
+    XTESTS_TEST_INTEGER_EQUAL(2u, bs.rank(8));
+    XTESTS_TEST_INTEGER_EQUAL(143u, bs.rank(1000));
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, bs.select(0));
+    XTESTS_TEST_INTEGER_EQUAL(7u, bs.select(1));
+    XTESTS_TEST_INTEGER_EQUAL(994u, bs.select(142));
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.select(143));
+}
+
+static void test_rank_select_with_index()
+{
+    bitset_t    bs(5000);
+
+    { for (size_t i = 0; i < 5000; i += 7)
+    {
+        bs.set(i);
+    }}
+
+    XTESTS_TEST_BOOLEAN_FALSE(bs.has_rank_index());
+
+    bs.build_rank_index();
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs.has_rank_index());
+
+    { for (size_t i = 0; i <= 5000; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL((i + 6) / 7, bs.rank(i));
+    }}
+
+    { for (size_t n = 0; n != bs.count(); ++n)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(n * 7, bs.select(n));
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(bitset_t::npos, bs.select(bs.count()));
+
+    bs.drop_rank_index();
+
+    XTESTS_TEST_BOOLEAN_FALSE(bs.has_rank_index());
+    XTESTS_TEST_INTEGER_EQUAL(715u, bs.rank(5000));
+}
+
+static void test_rank_index_invalidation()
+{
+    bitset_t    bs(1000);
+
+    bs.set(10);
+    bs.build_rank_index();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, bs.rank(1000));
+
+    bs.set(20);
+
+    XTESTS_TEST_BOOLEAN_FALSE(bs.has_rank_index());
+    XTESTS_TEST_INTEGER_EQUAL(2u, bs.rank(1000));
+    XTESTS_TEST_INTEGER_EQUAL(20u, bs.select(1));
+}
+
+static void test_copy_and_swap()
+{
+    bitset_t    bs1(100);
+    bitset_t    bs2(1000, true);
+
+    bs1.set(50);
+
+    bitset_t    bs3(bs1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs1 == bs3);
+
+    bs3 = bs2;
+
+    XTESTS_TEST_BOOLEAN_TRUE(bs2 == bs3);
+    XTESTS_TEST_INTEGER_EQUAL(1000u, bs3.count());
+
+    bs1.swap(bs2);
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, bs1.size());
+    XTESTS_TEST_INTEGER_EQUAL(1000u, bs1.count());
+    XTESTS_TEST_INTEGER_EQUAL(100u, bs2.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, bs2.count());
+
+    swap(bs1, bs2);
+
+    XTESTS_TEST_INTEGER_EQUAL(100u, bs1.size());
+    XTESTS_TEST_INTEGER_EQUAL(1000u, bs2.size());
+}
+
+static void test_against_vector_bool()
+{
+    std::vector<bool>   v;
+    bitset_t            bs;
+    unsigned            seed = 1;
+
+    { for (size_t i = 0; i != 3000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+
+        bool const b = 0 == ((seed >> 16) % 5);
+
+        v.push_back(b);
+        bs.push_back(b);
+    }}
+
+    bs.build_rank_index();
+
+    size_t r = 0;
+
+    { for (size_t i = 0; i != v.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(r, bs.rank(i));
+
+        if (v[i])
+        {
+            XTESTS_TEST_INTEGER_EQUAL(i, bs.select(r));
+
+            ++r;
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(v[i] == bs[i]);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(r, bs.count());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,250 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.fixed_array/entry.cpp
+ *
+ * Purpose: Unit-tests for the stride accessors of `stlsoft::fixed_array_2d`,
+ *          `stlsoft::fixed_array_3d` and `stlsoft::fixed_array_4d`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/fixed_array.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/memory/aligned_allocator.hpp>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_2d_strides(void);
+    static void test_2d_addressing(void);
+    static void test_3d_strides(void);
+    static void test_3d_addressing(void);
+    static void test_4d_strides(void);
+    static void test_4d_addressing(void);
+    static void test_unit_dimensions(void);
+    static void test_aligned_allocator(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.fixed_array", verbosity))
+    {
+        XTESTS_RUN_CASE(test_2d_strides);
+        XTESTS_RUN_CASE(test_2d_addressing);
+        XTESTS_RUN_CASE(test_3d_strides);
+        XTESTS_RUN_CASE(test_3d_addressing);
+        XTESTS_RUN_CASE(test_4d_strides);
+        XTESTS_RUN_CASE(test_4d_addressing);
+        XTESTS_RUN_CASE(test_unit_dimensions);
+        XTESTS_RUN_CASE(test_aligned_allocator);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::fixed_array_2d<int>    array_2d_t;
+    typedef stlsoft::fixed_array_3d<int>    array_3d_t;
+    typedef stlsoft::fixed_array_4d<int>    array_4d_t;
+
+
+static void test_2d_strides()
+{
+    array_2d_t const a(3, 7);
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, a.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(1u, a.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(a.size(), a.dimension0() * a.stride0());
+}
+
+static void test_2d_addressing()
+{
+    array_2d_t a(4, 5);
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            a(i0, i1) = static_cast<int>(100 * i0 + i1);
+        }
+    }}
+
+    int const* const p = a.data();
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(a(i0, i1), p[i0 * a.stride0() + i1 * a.stride1()]);
+        }
+    }}
+}
+
+static void test_3d_strides()
+{
+    array_3d_t const a(2, 3, 4);
+
+    XTESTS_TEST_INTEGER_EQUAL(12u, a.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(4u, a.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(1u, a.stride2());
+    XTESTS_TEST_INTEGER_EQUAL(a.size(), a.dimension0() * a.stride0());
+}
+
+static void test_3d_addressing()
+{
+    array_3d_t a(3, 4, 5);
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            for (size_t i2 = 0; i2 != a.dimension2(); ++i2)
+            {
+                a(i0, i1, i2) = static_cast<int>(10000 * i0 + 100 * i1 + i2);
+            }
+        }
+    }}
+
+    int const* const p = a.data();
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            for (size_t i2 = 0; i2 != a.dimension2(); ++i2)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(a(i0, i1, i2), p[i0 * a.stride0() + i1 * a.stride1() + i2 * a.stride2()]);
+            }
+        }
+    }}
+}
+
+static void test_4d_strides()
+{
+    array_4d_t const a(2, 3, 4, 5);
+
+    XTESTS_TEST_INTEGER_EQUAL(60u, a.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(20u, a.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(5u, a.stride2());
+    XTESTS_TEST_INTEGER_EQUAL(1u, a.stride3());
+    XTESTS_TEST_INTEGER_EQUAL(a.size(), a.dimension0() * a.stride0());
+}
+
+static void test_4d_addressing()
+{
+    array_4d_t a(2, 3, 4, 5);
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            for (size_t i2 = 0; i2 != a.dimension2(); ++i2)
+            {
+                for (size_t i3 = 0; i3 != a.dimension3(); ++i3)
+                {
+                    a(i0, i1, i2, i3) = static_cast<int>(1000 * i0 + 100 * i1 + 10 * i2 + i3);
+                }
+            }
+        }
+    }}
+
+    int const* const p = a.data();
+
+    { for (size_t i0 = 0; i0 != a.dimension0(); ++i0)
+    {
+        for (size_t i1 = 0; i1 != a.dimension1(); ++i1)
+        {
+            for (size_t i2 = 0; i2 != a.dimension2(); ++i2)
+            {
+                for (size_t i3 = 0; i3 != a.dimension3(); ++i3)
+                {
+                    XTESTS_TEST_INTEGER_EQUAL(a(i0, i1, i2, i3), p[i0 * a.stride0() + i1 * a.stride1() + i2 * a.stride2() + i3 * a.stride3()]);
+                }
+            }
+        }
+    }}
+}
+
+static void test_unit_dimensions()
+{
+    array_3d_t const a(1, 1, 9);
+
+    XTESTS_TEST_INTEGER_EQUAL(9u, a.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(9u, a.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(1u, a.stride2());
+
+    array_2d_t const b(6, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, b.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(1u, b.stride1());
+}
+
+static void test_aligned_allocator()
+{
+    typedef stlsoft::fixed_array_3d<
+        double
+    ,   stlsoft::aligned_allocator<double, 64>
+    >                                           array_t;
+
+    array_t a(3, 5, 7, 0.0);
+
+    a(2, 4, 6) = 1.0;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, reinterpret_cast<stlsoft::ss_uintptr_t>(a.data()) % 64);
+    XTESTS_TEST_INTEGER_EQUAL(35u, a.stride0());
+    XTESTS_TEST_INTEGER_EQUAL(7u, a.stride1());
+    XTESTS_TEST_INTEGER_EQUAL(1.0, a.data()[2 * a.stride0() + 4 * a.stride1() + 6 * a.stride2()]);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
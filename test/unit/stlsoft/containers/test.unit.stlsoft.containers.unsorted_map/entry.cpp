@@ -0,0 +1,446 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.containers.unsorted_map/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::unsorted_map`, with each of its lookup
+ *          policies.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/containers/unsorted_map.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_push_back_and_find(void);
+    static void test_insertion_order(void);
+    static void test_overwrite(void);
+    static void test_erase(void);
+    static void test_erase_all(void);
+    static void test_index_threshold(void);
+    static void test_colliding_hashes(void);
+    static void test_against_std_map(void);
+    static void test_string_keys(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.containers.unsorted_map", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_push_back_and_find);
+        XTESTS_RUN_CASE(test_insertion_order);
+        XTESTS_RUN_CASE(test_overwrite);
+        XTESTS_RUN_CASE(test_erase);
+        XTESTS_RUN_CASE(test_erase_all);
+        XTESTS_RUN_CASE(test_index_threshold);
+        XTESTS_RUN_CASE(test_colliding_hashes);
+        XTESTS_RUN_CASE(test_against_std_map);
+        XTESTS_RUN_CASE(test_string_keys);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // every key hashes the same, so that every lookup probes
+    struct constant_hash
+    {
+        size_t operator ()(int) const
+        {
+            return 7;
+        }
+    };
+
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    >                                           linear_map_t;
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   std::allocator<int>
+    ,   stlsoft::unsorted_map_hash_index<>
+    >                                           indexed_map_t;
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   std::allocator<int>
+    ,   stlsoft::unsorted_map_hash_index<std::hash<int>, 4>
+    >                                           small_indexed_map_t;
+    typedef stlsoft::unsorted_map<
+        int
+    ,   int
+    ,   std::less<int>
+    ,   std::allocator<int>
+    ,   stlsoft::unsorted_map_hash_index<constant_hash, 4>
+    >                                           colliding_map_t;
+
+    template <typename M>
+    void check_empty()
+    {
+        M               m;
+        M const&        cm = m;
+
+        XTESTS_TEST_BOOLEAN_TRUE(m.empty());
+        XTESTS_TEST_INTEGER_EQUAL(0u, m.size());
+        XTESTS_TEST(m.begin() == m.end());
+        XTESTS_TEST(cm.begin() == cm.end());
+        XTESTS_TEST(m.end() == m.find(1));
+        XTESTS_TEST(cm.end() == cm.find(1));
+        XTESTS_TEST_INTEGER_EQUAL(0u, m.count(1));
+        XTESTS_TEST_INTEGER_EQUAL(0u, m.erase(1));
+    }
+
+    template <typename M>
+    void check_push_back_and_find(size_t n)
+    {
+        M m;
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            m.push_back(static_cast<int>(i * 3), static_cast<int>(i));
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(n, m.size());
+
+        for (size_t i = 0; i != 3 * n; ++i)
+        {
+            int const                               key =   static_cast<int>(i);
+            typename M::const_iterator const        it  =   static_cast<M const&>(m).find(key);
+
+            if (0 == i % 3)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(1u, m.count(key));
+                XTESTS_REQUIRE(m.end() != m.find(key));
+                XTESTS_TEST_INTEGER_EQUAL(key, m.find(key)->first);
+                XTESTS_TEST_INTEGER_EQUAL(key / 3, it->second);
+                XTESTS_TEST_INTEGER_EQUAL(i / 3, static_cast<size_t>(m.find(key) - m.begin()));
+            }
+            else
+            {
+                XTESTS_TEST_INTEGER_EQUAL(0u, m.count(key));
+                XTESTS_TEST(m.end() == m.find(key));
+            }
+        }
+    }
+
+    template <typename M>
+    void check_erase(size_t n)
+    {
+        M m;
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            m.push_back(static_cast<int>(i), static_cast<int>(100 + i));
+        }
+
+        // erase the odd keys, from the back
+
+        for (size_t i = n; 0 != i; --i)
+        {
+            if (0 != (i - 1) % 2)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(static_cast<int>(i - 1)));
+            }
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL((n + 1) / 2, m.size());
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            int const key = static_cast<int>(i);
+
+            XTESTS_TEST_INTEGER_EQUAL((0 == i % 2) ? 1u : 0u, m.count(key));
+
+            if (0 == i % 2)
+            {
+                XTESTS_REQUIRE(m.end() != m.find(key));
+                XTESTS_TEST_INTEGER_EQUAL(100 + key, m.find(key)->second);
+                XTESTS_TEST_INTEGER_EQUAL(i / 2, static_cast<size_t>(m.find(key) - m.begin()));
+            }
+        }
+    }
+
+    template <typename M>
+    void check_against_std_map(int range, int iterations)
+    {
+        M                   m;
+        std::map<int, int>  r;
+        unsigned            seed = 12345;
+
+        for (int i = 0; i != iterations; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            int const key   =   static_cast<int>((seed >> 8) % static_cast<unsigned>(range));
+            int const op    =   static_cast<int>((seed >> 4) % 3u);
+
+            if (0 == op)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(r.erase(key), m.erase(key));
+            }
+            else
+            {
+                m.push_back(key, i);
+                r[key] = i;
+            }
+
+            XTESTS_TEST_INTEGER_EQUAL(r.size(), m.size());
+            XTESTS_TEST_INTEGER_EQUAL(r.count(key), m.count(key));
+        }
+
+        for (int key = 0; key != range; ++key)
+        {
+            std::map<int, int>::const_iterator const it = r.find(key);
+
+            if (r.end() == it)
+            {
+                XTESTS_TEST(m.end() == m.find(key));
+            }
+            else
+            {
+                XTESTS_REQUIRE(m.end() != m.find(key));
+                XTESTS_TEST_INTEGER_EQUAL(it->second, m.find(key)->second);
+            }
+        }
+    }
+
+
+static void test_empty()
+{
+    check_empty<linear_map_t>();
+    check_empty<indexed_map_t>();
+    check_empty<small_indexed_map_t>();
+    check_empty<colliding_map_t>();
+}
+
+static void test_push_back_and_find()
+{
+    static size_t const sizes[] = { 1, 2, 3, 4, 5, 15, 16, 17, 100, 1000 };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+    {
+        check_push_back_and_find<linear_map_t>(sizes[i]);
+        check_push_back_and_find<indexed_map_t>(sizes[i]);
+        check_push_back_and_find<small_indexed_map_t>(sizes[i]);
+        check_push_back_and_find<colliding_map_t>(sizes[i]);
+    }
+}
+
+static void test_insertion_order()
+{
+    static int const keys[] = { 42, 7, 19, -3, 0, 1000, 5, 6, 88, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+
+    indexed_map_t   m;
+    std::vector<int> expected;
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(keys); ++i)
+    {
+        if (0 == m.count(keys[i]))
+        {
+            expected.push_back(keys[i]);
+        }
+
+        m.push_back(keys[i], static_cast<int>(i));
+    }
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(expected.size(), m.size()));
+
+    size_t j = 0;
+
+    for (indexed_map_t::const_iterator i = m.begin(); m.end() != i; ++i, ++j)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(expected[j], i->first);
+        XTESTS_TEST_INTEGER_EQUAL(expected[j], m[j].first);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.front(), m.front().first);
+    XTESTS_TEST_INTEGER_EQUAL(expected.back(), m.back().first);
+}
+
+static void test_overwrite()
+{
+    small_indexed_map_t m;
+
+    for (int i = 0; i != 10; ++i)
+    {
+        m.push_back(i, i);
+    }
+
+    m.push_back(3, 300);
+    m.push_back(small_indexed_map_t::value_type(9, 900));
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, m.size());
+    XTESTS_TEST_INTEGER_EQUAL(300, m.find(3)->second);
+    XTESTS_TEST_INTEGER_EQUAL(900, m.find(9)->second);
+    XTESTS_TEST_INTEGER_EQUAL(3, m.find(3) - m.begin());
+}
+
+static void test_erase()
+{
+    static size_t const sizes[] = { 1, 2, 7, 16, 33, 200 };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(sizes); ++i)
+    {
+        check_erase<linear_map_t>(sizes[i]);
+        check_erase<indexed_map_t>(sizes[i]);
+        check_erase<small_indexed_map_t>(sizes[i]);
+        check_erase<colliding_map_t>(sizes[i]);
+    }
+}
+
+static void test_erase_all()
+{
+    // the map may be used after it has been emptied, including by lookup
+
+    indexed_map_t m;
+
+    for (int i = 0; i != 40; ++i)
+    {
+        m.push_back(i, i);
+    }
+
+    for (int i = 0; i != 40; ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(1u, m.erase(i));
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.empty());
+    XTESTS_TEST(m.begin() == m.end());
+    XTESTS_TEST(m.end() == m.find(0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.count(0));
+
+    m.push_back(1, 2);
+
+    XTESTS_TEST_INTEGER_EQUAL(2, m.find(1)->second);
+}
+
+static void test_index_threshold()
+{
+    small_indexed_map_t m;
+
+    for (int i = 0; i != 3; ++i)
+    {
+        m.push_back(i, i);
+
+        XTESTS_TEST_BOOLEAN_FALSE(m.lookup_policy().is_indexed());
+    }
+
+    m.push_back(3, 3);
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.lookup_policy().is_indexed());
+
+    // the index is discarded below half the threshold
+
+    m.erase(0);
+    m.erase(1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(m.lookup_policy().is_indexed());
+
+    m.erase(2);
+
+    XTESTS_TEST_BOOLEAN_FALSE(m.lookup_policy().is_indexed());
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.count(3));
+    XTESTS_TEST_INTEGER_EQUAL(0u, m.count(2));
+}
+
+static void test_colliding_hashes()
+{
+    check_against_std_map<colliding_map_t>(60, 2000);
+}
+
+static void test_against_std_map()
+{
+    check_against_std_map<linear_map_t>(50, 2000);
+    check_against_std_map<indexed_map_t>(50, 2000);
+    check_against_std_map<indexed_map_t>(2000, 10000);
+    check_against_std_map<small_indexed_map_t>(12, 2000);
+}
+
+static void test_string_keys()
+{
+    typedef stlsoft::unsorted_map<
+        std::string
+    ,   int
+    ,   std::less<std::string>
+    ,   std::allocator<int>
+    ,   stlsoft::unsorted_map_hash_index<>
+    >                                       map_t;
+
+    map_t m;
+
+    for (int i = 0; i != 50; ++i)
+    {
+        m.push_back(std::string(static_cast<size_t>(i), 'x'), i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(50u, m.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, m.count(std::string()));
+    XTESTS_TEST_INTEGER_EQUAL(20, m.find(std::string(20, 'x'))->second);
+    XTESTS_TEST(m.end() == m.find("y"));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
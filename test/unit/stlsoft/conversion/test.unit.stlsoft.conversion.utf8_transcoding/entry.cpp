@@ -0,0 +1,413 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.conversion.utf8_transcoding/entry.cpp
+ *
+ * Purpose: Unit-tests for the UTF-8 transcoding functions, and for
+ *          `stlsoft::utf8_to_wide` and `stlsoft::wide_to_utf8`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/conversion/char_conversions.hpp>
+#include <stlsoft/conversion/utf8_transcoding.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_transcode_empty(void);
+    static void test_transcode_ascii(void);
+    static void test_transcode_multibyte(void);
+    static void test_transcode_utf16_surrogates(void);
+    static void test_transcode_ill_formed_utf8(void);
+    static void test_transcode_ill_formed_wide(void);
+    static void test_transcode_round_trip(void);
+    static void test_utf8_to_wide(void);
+    static void test_utf8_to_wide_long(void);
+    static void test_utf8_to_wide_long_non_ascii(void);
+    static void test_utf8_to_wide_exact_capacity(void);
+    static void test_utf8_to_wide_copy(void);
+    static void test_utf8_to_wide_invalid(void);
+    static void test_wide_to_utf8(void);
+    static void test_wide_to_utf8_invalid(void);
+    static void test_shims(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.conversion.utf8_transcoding", verbosity))
+    {
+        XTESTS_RUN_CASE(test_transcode_empty);
+        XTESTS_RUN_CASE(test_transcode_ascii);
+        XTESTS_RUN_CASE(test_transcode_multibyte);
+        XTESTS_RUN_CASE(test_transcode_utf16_surrogates);
+        XTESTS_RUN_CASE(test_transcode_ill_formed_utf8);
+        XTESTS_RUN_CASE(test_transcode_ill_formed_wide);
+        XTESTS_RUN_CASE(test_transcode_round_trip);
+        XTESTS_RUN_CASE(test_utf8_to_wide);
+        XTESTS_RUN_CASE(test_utf8_to_wide_long);
+        XTESTS_RUN_CASE(test_utf8_to_wide_long_non_ascii);
+        XTESTS_RUN_CASE(test_utf8_to_wide_exact_capacity);
+        XTESTS_RUN_CASE(test_utf8_to_wide_copy);
+        XTESTS_RUN_CASE_THAT_THROWS(test_utf8_to_wide_invalid, stlsoft::conversion_error);
+        XTESTS_RUN_CASE(test_wide_to_utf8);
+        XTESTS_RUN_CASE_THAT_THROWS(test_wide_to_utf8_invalid, stlsoft::conversion_error);
+        XTESTS_RUN_CASE(test_shims);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::ss_uint16_t                            char16_type;
+    typedef stlsoft::ss_uint32_t                            char32_type;
+
+    size_t const    failed  =   ~size_t(0);
+
+    // "héllo 中 \U0001f600": 1-, 2-, 3- and 4-byte sequences
+    char const      MIXED_UTF8[] = "h\xC3\xA9llo \xE4\xB8\xAD \xF0\x9F\x98\x80";
+
+
+static void test_transcode_empty()
+{
+    char16_type w16[1];
+    char32_type w32[1];
+    char        u8[1];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::transcode_utf8_to_wide("", 0, &w16[0]));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::transcode_utf8_to_wide("", 0, &w32[0]));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::wide_to_utf8_length(&w16[0], 0));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::transcode_wide_to_utf8(&w32[0], 0, &u8[0]));
+}
+
+static void test_transcode_ascii()
+{
+    // long enough to exercise the vector paths, and an odd length to
+    // exercise the tails
+    std::string const   s("The quick brown fox jumps over the lazy dog; the quick brown fox jumps again.");
+    char16_type         w16[100];
+    char32_type         w32[100];
+    char                u8[100];
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w16[0]));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w32[0]));
+
+    { for (size_t i = 0; i != s.size(); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<unsigned char>(s[i]), w16[i]);
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<unsigned char>(s[i]), w32[i]);
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::wide_to_utf8_length(&w16[0], s.size()));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::wide_to_utf8_length(&w32[0], s.size()));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::transcode_wide_to_utf8(&w16[0], s.size(), &u8[0]));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s, std::string(&u8[0], s.size()));
+}
+
+static void test_transcode_multibyte()
+{
+    char32_type w32[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(9u, stlsoft::utf8_to_wide_length<char32_type>(MIXED_UTF8, sizeof(MIXED_UTF8) - 1));
+    XTESTS_TEST_INTEGER_EQUAL(9u, stlsoft::transcode_utf8_to_wide(MIXED_UTF8, sizeof(MIXED_UTF8) - 1, &w32[0]));
+    XTESTS_TEST_INTEGER_EQUAL(0x68u, w32[0]);
+    XTESTS_TEST_INTEGER_EQUAL(0xe9u, w32[1]);
+    XTESTS_TEST_INTEGER_EQUAL(0x4e2du, w32[6]);
+    XTESTS_TEST_INTEGER_EQUAL(0x1f600u, w32[8]);
+    XTESTS_TEST_INTEGER_EQUAL(sizeof(MIXED_UTF8) - 1, stlsoft::wide_to_utf8_length(&w32[0], 9));
+}
+
+static void test_transcode_utf16_surrogates()
+{
+    char16_type w16[20];
+    char        u8[20];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, stlsoft::utf8_to_wide_length<char16_type>(MIXED_UTF8, sizeof(MIXED_UTF8) - 1));
+    XTESTS_TEST_INTEGER_EQUAL(10u, stlsoft::transcode_utf8_to_wide(MIXED_UTF8, sizeof(MIXED_UTF8) - 1, &w16[0]));
+    XTESTS_TEST_INTEGER_EQUAL(0xd83du, w16[8]);
+    XTESTS_TEST_INTEGER_EQUAL(0xde00u, w16[9]);
+    XTESTS_TEST_INTEGER_EQUAL(sizeof(MIXED_UTF8) - 1, stlsoft::wide_to_utf8_length(&w16[0], 10));
+    XTESTS_TEST_INTEGER_EQUAL(sizeof(MIXED_UTF8) - 1, stlsoft::transcode_wide_to_utf8(&w16[0], 10, &u8[0]));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(std::string(MIXED_UTF8), std::string(&u8[0], sizeof(MIXED_UTF8) - 1));
+}
+
+static void test_transcode_ill_formed_utf8()
+{
+    static char const* const    strings[] =
+    {
+            "\x80"                  // lone continuation
+        ,   "\xC0\xAF"              // overlong
+        ,   "\xE0\x80\xAF"          // overlong
+        ,   "\xED\xA0\x80"          // surrogate
+        ,   "\xF4\x90\x80\x80"      // above U+10FFFF
+        ,   "\xF5\x80\x80\x80"      // invalid lead byte
+        ,   "abc\xE4\xB8"           // truncated
+        ,   "abcdefghijklmnopqrstuvwxyz\xFF"
+    };
+    char32_type w32[40];
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(strings); ++i)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::utf8_to_wide_length<char16_type>(strings[i], ::strlen(strings[i])));
+        XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::utf8_to_wide_length<char32_type>(strings[i], ::strlen(strings[i])));
+        XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::transcode_utf8_to_wide(strings[i], ::strlen(strings[i]), &w32[0]));
+    }}
+}
+
+static void test_transcode_ill_formed_wide()
+{
+    char16_type const   lone_high[] = { 'a', 0xd800 };
+    char16_type const   lone_low[]  = { 0xdc00, 'a' };
+    char32_type const   surrogate[] = { 0xdfff };
+    char32_type const   too_big[]   = { 0x110000 };
+    char                u8[10];
+
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::wide_to_utf8_length(&lone_high[0], 2));
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::wide_to_utf8_length(&lone_low[0], 2));
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::wide_to_utf8_length(&surrogate[0], 1));
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::wide_to_utf8_length(&too_big[0], 1));
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::transcode_wide_to_utf8(&lone_high[0], 2, &u8[0]));
+    XTESTS_TEST_INTEGER_EQUAL(failed, stlsoft::transcode_wide_to_utf8(&too_big[0], 1, &u8[0]));
+}
+
+static void test_transcode_round_trip()
+{
+    std::string s;
+    unsigned    seed = 1;
+
+    // runs of ASCII interleaved with 2-, 3- and 4-byte sequences
+    { for (size_t i = 0; i != 2000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+
+        switch ((seed >> 16) % 5)
+        {
+            case 0:     s += "\xC3\xA9";            break;
+            case 1:     s += "\xE4\xB8\xAD";        break;
+            case 2:     s += "\xF0\x9F\x98\x80";    break;
+            default:    s += "abcdefghijklmnopq";   break;
+        }
+    }}
+
+    std::basic_string<char16_type>  w16(s.size(), 0);
+    std::basic_string<char32_type>  w32(s.size(), 0);
+    std::string                     u8(s.size(), '\0');
+
+    size_t const n16 = stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w16[0]);
+    size_t const n32 = stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w32[0]);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(failed, n16));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(failed, n32));
+    XTESTS_TEST_INTEGER_EQUAL(n16, stlsoft::utf8_to_wide_length<char16_type>(s.data(), s.size()));
+    XTESTS_TEST_INTEGER_EQUAL(n32, stlsoft::utf8_to_wide_length<char32_type>(s.data(), s.size()));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::wide_to_utf8_length(w16.data(), n16));
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::wide_to_utf8_length(w32.data(), n32));
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::transcode_wide_to_utf8(w16.data(), n16, &u8[0]));
+    XTESTS_TEST_BOOLEAN_TRUE(s == u8);
+
+    XTESTS_TEST_INTEGER_EQUAL(s.size(), stlsoft::transcode_wide_to_utf8(w32.data(), n32, &u8[0]));
+    XTESTS_TEST_BOOLEAN_TRUE(s == u8);
+}
+
+static void test_utf8_to_wide()
+{
+    stlsoft::utf8_to_wide const w(MIXED_UTF8);
+
+    XTESTS_TEST_INTEGER_EQUAL((2 == sizeof(wchar_t)) ? 10u : 9u, w.size());
+    XTESTS_TEST_INTEGER_EQUAL(L'h', w.c_str()[0]);
+    XTESTS_TEST_INTEGER_EQUAL(0xe9, w.c_str()[1]);
+    XTESTS_TEST_INTEGER_EQUAL(0, w.c_str()[w.size()]);
+
+    stlsoft::utf8_to_wide const w2(MIXED_UTF8, 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, w2.size());
+}
+
+static void test_utf8_to_wide_long()
+{
+    std::string s(1000, 'a');
+
+    s += "\xC3\xA9";
+
+    stlsoft::utf8_to_wide const w(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(1001u, w.size());
+    XTESTS_TEST_INTEGER_EQUAL(0xe9, w.c_str()[1000]);
+    XTESTS_TEST_INTEGER_EQUAL(0, w.c_str()[1001]);
+}
+
+static void test_utf8_to_wide_long_non_ascii()
+{
+    // longer than the internal buffer, and with fewer wide characters
+    // than bytes, so the buffer is sized from the measured length rather
+    // than from the number of bytes
+
+    std::string s;
+
+    { for (size_t i = 0; i != 150; ++i)
+    {
+        s += "\xC3\xA9\xE4\xB8\xAD";
+    }}
+    s += "\xF0\x9F\x98\x80";
+
+    size_t const                expected = (2 == sizeof(wchar_t)) ? 302u : 301u;
+    stlsoft::utf8_to_wide const w(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(expected, w.size());
+    XTESTS_TEST_INTEGER_EQUAL(0xe9, w.c_str()[0]);
+    XTESTS_TEST_INTEGER_EQUAL(0x4e2d, w.c_str()[299]);
+    XTESTS_TEST_INTEGER_EQUAL(0, w.c_str()[expected]);
+
+    stlsoft::utf8_to_wide const w2(w);
+
+    XTESTS_TEST_INTEGER_EQUAL(expected, w2.size());
+    XTESTS_TEST_WIDE_STRING_EQUAL(w.c_str(), w2.c_str());
+
+    stlsoft::wide_to_utf8 const u(w.c_str());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s, u.c_str());
+}
+
+static void test_utf8_to_wide_exact_capacity()
+{
+    // the buffer is sized exactly, so a block that is not all ASCII near
+    // its end must not be stored whole
+
+    std::string s;
+
+    { for (size_t i = 0; i != 2000; ++i)
+    {
+        s += "\xC3\xA9";
+    }}
+    s += "a";
+    { for (size_t i = 0; i != 5; ++i)
+    {
+        s += "\xE4\xB8\xAD";
+    }}
+
+    stlsoft::utf8_to_wide const w(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(2006u, w.size());
+    XTESTS_TEST_INTEGER_EQUAL(0xe9, w.c_str()[1999]);
+    XTESTS_TEST_INTEGER_EQUAL(L'a', w.c_str()[2000]);
+    XTESTS_TEST_INTEGER_EQUAL(0x4e2d, w.c_str()[2005]);
+    XTESTS_TEST_INTEGER_EQUAL(0, w.c_str()[2006]);
+
+    // and likewise directly, into a buffer of exactly the required size
+    std::vector<char32_type>    w32(2006);
+    std::vector<char16_type>    w16(2006);
+
+    XTESTS_TEST_INTEGER_EQUAL(2006u, stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w32[0], w32.size()));
+    XTESTS_TEST_INTEGER_EQUAL(2006u, stlsoft::transcode_utf8_to_wide(s.data(), s.size(), &w16[0], w16.size()));
+    XTESTS_TEST_INTEGER_EQUAL(0x4e2du, w32[2005]);
+    XTESTS_TEST_INTEGER_EQUAL(0x4e2du, w16[2005]);
+}
+
+static void test_utf8_to_wide_copy()
+{
+    std::string const           s(300, 'x');
+    stlsoft::utf8_to_wide const w1(s);
+    stlsoft::utf8_to_wide const w2(w1);
+
+    XTESTS_TEST_INTEGER_EQUAL(w1.size(), w2.size());
+    XTESTS_TEST_WIDE_STRING_EQUAL(w1.c_str(), w2.c_str());
+}
+
+static void test_utf8_to_wide_invalid()
+{
+    stlsoft::utf8_to_wide const w("abc\xC0\x80");
+
+    XTESTS_TEST_FAIL("should not get here");
+}
+
+static void test_wide_to_utf8()
+{
+    std::wstring const          s(L"abc\u00e9\u4e2d");
+    stlsoft::wide_to_utf8 const u(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(8u, u.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\xC3\xA9\xE4\xB8\xAD", u.c_str());
+
+    stlsoft::wide_to_utf8 const u2(u);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(u.c_str(), u2.c_str());
+}
+
+static void test_wide_to_utf8_invalid()
+{
+    wchar_t const               s[] = { L'a', wchar_t(0xd800), 0 };
+    stlsoft::wide_to_utf8 const u(s);
+
+    XTESTS_TEST_FAIL("should not get here");
+}
+
+static void test_shims()
+{
+    stlsoft::utf8_to_wide const w("abc");
+    stlsoft::wide_to_utf8 const u(L"abcd");
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, stlsoft::c_str_len(w));
+    XTESTS_TEST_INTEGER_EQUAL(4u, stlsoft::c_str_len(u));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc", stlsoft::c_str_ptr(w));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcd", stlsoft::c_str_ptr(u));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcd", stlsoft::c_str_data_a(u));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
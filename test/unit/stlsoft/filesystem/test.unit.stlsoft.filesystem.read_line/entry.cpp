@@ -0,0 +1,315 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.filesystem.read_line/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::read_line()`, and in particular for
+ *          its block-buffered reader,
+ *          `stlsoft::readers::read_from_FILE_buffered`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/filesystem/read_line.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty_stream(void);
+    static void test_lf(void);
+    static void test_crlf(void);
+    static void test_cr(void);
+    static void test_no_trailing_newline(void);
+    static void test_flags(void);
+    static void test_long_lines(void);
+    static void test_buffer_boundaries(void);
+    static void test_same_as_unbuffered(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.filesystem.read_line", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty_stream);
+        XTESTS_RUN_CASE(test_lf);
+        XTESTS_RUN_CASE(test_crlf);
+        XTESTS_RUN_CASE(test_cr);
+        XTESTS_RUN_CASE(test_no_trailing_newline);
+        XTESTS_RUN_CASE(test_flags);
+        XTESTS_RUN_CASE(test_long_lines);
+        XTESTS_RUN_CASE(test_buffer_boundaries);
+        XTESTS_RUN_CASE(test_same_as_unbuffered);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::readers::read_from_FILE_buffered       reader_t;
+    typedef std::vector<std::string>                        lines_t;
+    typedef stlsoft::read_line_flags                        flags_t;
+
+    // A temporary stream containing the given contents
+    class temp_stream
+    {
+    public:
+        explicit temp_stream(std::string const& contents)
+            : m_stm(::tmpfile())
+        {
+            if (NULL != m_stm)
+            {
+                ::fwrite(contents.data(), 1, contents.size(), m_stm);
+                ::rewind(m_stm);
+            }
+        }
+        ~temp_stream()
+        {
+            if (NULL != m_stm)
+            {
+                ::fclose(m_stm);
+            }
+        }
+
+    public:
+        FILE* get() const
+        {
+            return m_stm;
+        }
+
+    private:
+        FILE* const m_stm;
+
+    private:
+        temp_stream(temp_stream const&);
+        void operator =(temp_stream const&);
+    };
+
+    lines_t
+    read_buffered(
+        std::string const&          contents
+    ,   stlsoft::ss_size_t          bufferSize  =   0
+    ,   flags_t::flags_t            flags       =   flags_t::recogniseAll
+    )
+    {
+        temp_stream stm(contents);
+        reader_t    reader(stm.get(), bufferSize);
+        lines_t     lines;
+        std::string line;
+
+        for (; stlsoft::read_line(reader, line, flags); )
+        {
+            lines.push_back(line);
+        }
+
+        return lines;
+    }
+
+    lines_t
+    read_unbuffered(
+        std::string const&          contents
+    ,   flags_t::flags_t            flags       =   flags_t::recogniseAll
+    )
+    {
+        temp_stream stm(contents);
+        lines_t     lines;
+        std::string line;
+
+        for (; stlsoft::read_line(stm.get(), line, flags); )
+        {
+            lines.push_back(line);
+        }
+
+        return lines;
+    }
+
+
+static void test_empty_stream()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, read_buffered("").size());
+}
+
+static void test_lf()
+{
+    lines_t const lines = read_buffered("abc\n\ndef\n");
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines[2]);
+}
+
+static void test_crlf()
+{
+    lines_t const lines = read_buffered("abc\r\n\r\ndef\r\n");
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(3u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lines[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines[2]);
+}
+
+static void test_cr()
+{
+    lines_t const lines = read_buffered("abc\rdef\r");
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines[1]);
+}
+
+static void test_no_trailing_newline()
+{
+    lines_t const lines = read_buffered("abc\ndef");
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", lines[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", lines[1]);
+}
+
+static void test_flags()
+{
+    // only LF: the CR of a CRLF, and a lone CR, are part of the line
+    {
+        lines_t const lines = read_buffered("a\r\nb\rc\n", 0, flags_t::recogniseLfAsEOL);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a\r", lines[0]);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("b\rc", lines[1]);
+    }
+
+    // only CRLF: lone CRs and LFs are part of the line
+    {
+        lines_t const lines = read_buffered("a\nb\rc\r\nd", 0, flags_t::recogniseCrLfAsEOL);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a\nb\rc", lines[0]);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("d", lines[1]);
+    }
+
+    // only CR
+    {
+        lines_t const lines = read_buffered("a\nb\rc", 0, flags_t::recogniseCrAsEOL);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a\nb", lines[0]);
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("c", lines[1]);
+    }
+}
+
+static void test_long_lines()
+{
+    // lines longer than the buffer
+
+    std::string const   long1(1000, 'x');
+    std::string const   long2(333, 'y');
+    lines_t const       lines = read_buffered(long1 + "\r\n" + long2 + "\n", 64);
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(2u, lines.size()));
+    XTESTS_TEST_BOOLEAN_TRUE(long1 == lines[0]);
+    XTESTS_TEST_BOOLEAN_TRUE(long2 == lines[1]);
+}
+
+static void test_buffer_boundaries()
+{
+    // every end-of-line sequence falls on, or straddles, a buffer
+    // boundary for at least one of the buffer sizes
+
+    std::string const contents = "ab\r\ncd\r\r\nef\n\r\rgh\r\n\r\n";
+
+    for (stlsoft::ss_size_t bufferSize = 1; bufferSize != 12; ++bufferSize)
+    {
+        for (int f = 1; f != 8; ++f)
+        {
+            flags_t::flags_t const flags = static_cast<flags_t::flags_t>(f);
+
+            XTESTS_TEST_BOOLEAN_TRUE(read_unbuffered(contents, flags) == read_buffered(contents, bufferSize, flags));
+        }
+    }
+}
+
+static void test_same_as_unbuffered()
+{
+    std::string contents;
+    unsigned    seed = 1;
+
+    for (int i = 0; i != 20000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+
+        switch ((seed >> 16) % 8)
+        {
+        case 0:     contents += '\r';   break;
+        case 1:     contents += '\n';   break;
+        case 2:     contents += "\r\n"; break;
+        default:    contents += static_cast<char>('a' + (seed >> 20) % 26); break;
+        }
+    }
+
+    for (int f = 1; f != 8; ++f)
+    {
+        flags_t::flags_t const  flags       =   static_cast<flags_t::flags_t>(f);
+        lines_t const           expected    =   read_unbuffered(contents, flags);
+
+        XTESTS_TEST_BOOLEAN_TRUE(expected == read_buffered(contents, 0, flags));
+        XTESTS_TEST_BOOLEAN_TRUE(expected == read_buffered(contents, 7, flags));
+        XTESTS_TEST_BOOLEAN_TRUE(expected == read_buffered(contents, 4096, flags));
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,260 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.memory.aligned_allocator/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::aligned_allocator`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/memory/aligned_allocator.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/containers/fixed_array.hpp>
+
+/* Standard C++ header files */
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_default_alignment(void);
+    static void test_alignments(void);
+    static void test_alignments_below_pointer_size(void);
+    static void test_whole_block_writable(void);
+    static void test_deallocate_null(void);
+    static void test_rebind_and_equality(void);
+    static void test_with_vector(void);
+    static void test_with_fixed_array(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.memory.aligned_allocator", verbosity))
+    {
+        XTESTS_RUN_CASE(test_default_alignment);
+        XTESTS_RUN_CASE(test_alignments);
+        XTESTS_RUN_CASE(test_alignments_below_pointer_size);
+        XTESTS_RUN_CASE(test_whole_block_writable);
+        XTESTS_RUN_CASE(test_deallocate_null);
+        XTESTS_RUN_CASE(test_rebind_and_equality);
+        XTESTS_RUN_CASE(test_with_vector);
+        XTESTS_RUN_CASE(test_with_fixed_array);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    bool is_aligned(void const* p, size_t n)
+    {
+        return 0 == (reinterpret_cast<stlsoft::ss_uintptr_t>(p) % n);
+    }
+
+    // allocates, checks the alignment of, fills, and deallocates blocks of
+    // a range of sizes, keeping several live at once so that they are not
+    // all at the same address
+    template <typename T, size_t N>
+    bool check_alignment()
+    {
+        typedef stlsoft::aligned_allocator<T, N>    allocator_t;
+
+        allocator_t     ator;
+        std::vector<T*> blocks;
+        bool            allAligned = true;
+
+        for (size_t n = 1; n < 300; n += 1 + n / 4)
+        {
+            T* const p = ator.allocate(n);
+
+            if (NULL == p ||
+                !is_aligned(p, N))
+            {
+                allAligned = false;
+            }
+            else
+            {
+                ::memset(static_cast<void*>(p), 0xA5, n * sizeof(T));
+            }
+
+            blocks.push_back(p);
+        }
+
+        for (size_t i = 0, n = 1; i != blocks.size(); ++i, n += 1 + n / 4)
+        {
+            ator.deallocate(blocks[i], n);
+        }
+
+        return allAligned;
+    }
+
+
+static void test_default_alignment()
+{
+    XTESTS_TEST_INTEGER_EQUAL(64, int(stlsoft::aligned_allocator<double>::alignment));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<double, STLSOFT_ALIGNED_ALLOCATOR_DEFAULT_ALIGNMENT>()));
+}
+
+static void test_alignments()
+{
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<char, 16>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<char, 32>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<float, 64>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<double, 128>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<int, 4096>()));
+}
+
+static void test_alignments_below_pointer_size()
+{
+    // alignments smaller than that of the pointer stored before each
+    // block (which must itself be aligned) are honoured
+
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<char, 1>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<char, 2>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<short, 4>()));
+    XTESTS_TEST_BOOLEAN_TRUE((check_alignment<int, 8>()));
+
+    stlsoft::aligned_allocator<char, 1> ator;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        char* const p = ator.allocate(1);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_aligned(p, sizeof(void*)));
+
+        *p = 'x';
+
+        ator.deallocate(p, 1);
+    }
+}
+
+static void test_whole_block_writable()
+{
+    // (the sanitisers catch any write beyond the allocated block)
+
+    stlsoft::aligned_allocator<unsigned char, 256>  ator;
+
+    for (size_t n = 1; n != 1000; n += 37)
+    {
+        unsigned char* const p = ator.allocate(n);
+
+        ::memset(p, 0xFF, n);
+
+        XTESTS_TEST_INTEGER_EQUAL(0xFF, p[n - 1]);
+
+        ator.deallocate(p, n);
+    }
+}
+
+static void test_deallocate_null()
+{
+    stlsoft::aligned_allocator<int, 64> ator;
+
+    ator.deallocate(NULL, 0);
+
+    XTESTS_TEST_PASSED();
+}
+
+static void test_rebind_and_equality()
+{
+    typedef stlsoft::aligned_allocator<int, 32>     int_allocator_t;
+    typedef int_allocator_t::rebind<double>::other  double_allocator_t;
+
+    int_allocator_t const       a1;
+    int_allocator_t const       a2;
+    double_allocator_t          a3(a1);
+
+    XTESTS_TEST_BOOLEAN_TRUE(a1 == a2);
+    XTESTS_TEST_BOOLEAN_FALSE(a1 != a2);
+    XTESTS_TEST_INTEGER_EQUAL(32, int(double_allocator_t::alignment));
+
+    double* const p = a3.allocate(3);
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_aligned(p, 32));
+
+    a3.deallocate(p, 3);
+}
+
+static void test_with_vector()
+{
+    std::vector<double, stlsoft::aligned_allocator<double, 64> > v;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        v.push_back(i);
+
+        XTESTS_TEST_BOOLEAN_TRUE(is_aligned(&v[0], 64));
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(999.0, v.back());
+}
+
+static void test_with_fixed_array()
+{
+    typedef stlsoft::fixed_array_2d<
+        float
+    ,   stlsoft::aligned_allocator<float, 64>
+    >                                           matrix_t;
+
+    matrix_t m(7, 13, 1.5f);
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_aligned(m.data(), 64));
+    XTESTS_TEST_INTEGER_EQUAL(1.5f, m(6, 12));
+
+    matrix_t m2(1, 1000);
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_aligned(m2.data(), 64));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
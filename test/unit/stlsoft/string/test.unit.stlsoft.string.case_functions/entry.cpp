@@ -0,0 +1,310 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.case_functions/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::make_upper()`, `stlsoft::make_lower()`,
+ *          `stlsoft::to_upper()` and `stlsoft::to_lower()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/case_functions.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/string/simple_string.hpp>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <ctype.h>
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_short(void);
+    static void test_long(void);
+    static void test_all_byte_values(void);
+    static void test_lengths(void);
+    static void test_to_upper_to_lower(void);
+    static void test_simple_string(void);
+    static void test_wide(void);
+    static void test_other_locale(void);
+    static void test_thread_locale(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.case_functions", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_short);
+        XTESTS_RUN_CASE(test_long);
+        XTESTS_RUN_CASE(test_all_byte_values);
+        XTESTS_RUN_CASE(test_lengths);
+        XTESTS_RUN_CASE(test_to_upper_to_lower);
+        XTESTS_RUN_CASE(test_simple_string);
+        XTESTS_RUN_CASE(test_wide);
+        XTESTS_RUN_CASE(test_other_locale);
+        XTESTS_RUN_CASE(test_thread_locale);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    std::string upper(std::string s)
+    {
+        return stlsoft::make_upper(s);
+    }
+
+    std::string lower(std::string s)
+    {
+        return stlsoft::make_lower(s);
+    }
+
+    // the per-character conversion, in the current locale, as reference
+
+    std::string reference_upper(std::string s)
+    {
+        for (size_t i = 0; i != s.size(); ++i)
+        {
+            s[i] = static_cast<char>(::toupper(static_cast<unsigned char>(s[i])));
+        }
+
+        return s;
+    }
+
+    std::string reference_lower(std::string s)
+    {
+        for (size_t i = 0; i != s.size(); ++i)
+        {
+            s[i] = static_cast<char>(::tolower(static_cast<unsigned char>(s[i])));
+        }
+
+        return s;
+    }
+
+    std::string all_byte_values()
+    {
+        std::string s;
+
+        for (int i = 0; i != 0x100; ++i)
+        {
+            s += static_cast<char>(i);
+        }
+
+        return s;
+    }
+
+
+static void test_empty()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", upper(""));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", lower(""));
+}
+
+static void test_short()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ABC-XYZ 019", upper("abc-XYZ 019"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc-xyz 019", lower("abc-XYZ 019"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("@[`{", upper("@[`{"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("@[`{", lower("@[`{"));
+}
+
+static void test_long()
+{
+    std::string const s = "The quick brown fox jumps over the lazy dog; THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG!";
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG; THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG!", upper(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("the quick brown fox jumps over the lazy dog; the quick brown fox jumps over the lazy dog!", lower(s));
+}
+
+static void test_all_byte_values()
+{
+    // the letters' neighbours ('@', '[', '`', '{') and the bytes with the
+    // high bit set are those a faulty range test would alter
+
+    std::string const s = all_byte_values();
+
+    XTESTS_TEST(reference_upper(s) == upper(s));
+    XTESTS_TEST(reference_lower(s) == lower(s));
+    XTESTS_TEST(reference_upper(s + s) == upper(s + s));
+    XTESTS_TEST(reference_lower(s.substr(1) + s) == lower(s.substr(1) + s));
+}
+
+static void test_lengths()
+{
+    // either side of the threshold, and of the SIMD block widths
+
+    std::string const s = all_byte_values();
+
+    for (size_t n = 0; n != 100; ++n)
+    {
+        for (size_t offset = 0; offset < s.size(); offset += 37)
+        {
+            std::string const t = (s + s).substr(offset, n);
+
+            XTESTS_TEST(reference_upper(t) == upper(t));
+            XTESTS_TEST(reference_lower(t) == lower(t));
+        }
+    }
+}
+
+static void test_to_upper_to_lower()
+{
+    std::string const s("Mixed Case String, long enough for the ASCII kernel");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("MIXED CASE STRING, LONG ENOUGH FOR THE ASCII KERNEL", stlsoft::to_upper(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("mixed case string, long enough for the ascii kernel", stlsoft::to_lower(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mixed Case String, long enough for the ASCII kernel", s);
+}
+
+static void test_simple_string()
+{
+    typedef stlsoft::simple_string  string_t;
+
+    std::string const   s = all_byte_values().substr(1);
+    string_t            u(s.c_str());
+    string_t            l(s.c_str());
+
+    stlsoft::make_upper(u);
+    stlsoft::make_lower(l);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference_upper(s), u.c_str());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference_lower(s), l.c_str());
+
+    string_t            sh("aBc");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ABC", stlsoft::make_upper(sh).c_str());
+}
+
+static void test_wide()
+{
+    std::wstring s(L"abc-XYZ, and a string long enough to be longer than the threshold");
+
+    stlsoft::make_upper(s);
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"ABC-XYZ, AND A STRING LONG ENOUGH TO BE LONGER THAN THE THRESHOLD", s);
+
+    stlsoft::make_lower(s);
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc-xyz, and a string long enough to be longer than the threshold", s);
+}
+
+static void test_other_locale()
+{
+    // in any other locale the results must be those of toupper() /
+    // tolower(), which may then differ from ASCII
+
+    static char const* const names[] =
+    {
+        "C.UTF-8",
+        "en_US.UTF-8",
+        "en_US.ISO-8859-1",
+        "de_DE.ISO-8859-1",
+        "tr_TR.ISO-8859-9",
+    };
+
+    std::string const   prior(::setlocale(LC_CTYPE, NULL));
+    std::string const   s = all_byte_values() + "Istanbul is in Turkey";
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(names); ++i)
+    {
+        if (NULL != ::setlocale(LC_CTYPE, names[i]))
+        {
+            XTESTS_TEST(reference_upper(s) == upper(s));
+            XTESTS_TEST(reference_lower(s) == lower(s));
+        }
+    }
+
+    ::setlocale(LC_CTYPE, prior.c_str());
+}
+
+static void test_thread_locale()
+{
+#ifdef LC_GLOBAL_LOCALE
+    // a locale installed by uselocale() must be honoured, even though the
+    // global locale is "C"
+
+    static char const* const names[] =
+    {
+        "C.UTF-8",
+        "en_US.UTF-8",
+        "en_US.ISO-8859-1",
+        "de_DE.ISO-8859-1",
+        "tr_TR.ISO-8859-9",
+    };
+
+    std::string const   s = all_byte_values() + "Istanbul is in Turkey";
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(names); ++i)
+    {
+        locale_t const loc = ::newlocale(LC_CTYPE_MASK, names[i], static_cast<locale_t>(0));
+
+        if (static_cast<locale_t>(0) != loc)
+        {
+            ::uselocale(loc);
+
+            XTESTS_TEST(reference_upper(s) == upper(s));
+            XTESTS_TEST(reference_lower(s) == lower(s));
+
+            ::uselocale(LC_GLOBAL_LOCALE);
+            ::freelocale(loc);
+        }
+    }
+#endif /* LC_GLOBAL_LOCALE */
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
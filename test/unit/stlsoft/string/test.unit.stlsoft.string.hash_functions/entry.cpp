@@ -0,0 +1,508 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.hash_functions/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::hash_bytes()`, `stlsoft::hash_string()`,
+ *          `stlsoft::string_hash`, `stlsoft::string_equal_to`, and the
+ *          `std::hash` specialisations, including tests of hash quality.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/hash_functions.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/containers/frequency_map.hpp>
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Standard C header files */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_seed(void);
+    static void test_known_values(void);
+    static void test_string_types(void);
+    static void test_wide_strings(void);
+    static void test_std_hash(void);
+    static void test_string_equal_to(void);
+    static void test_unordered_map(void);
+    static void test_frequency_map(void);
+    static void test_lengths_distinct(void);
+    static void test_every_byte_significant(void);
+    static void test_avalanche(void);
+    static void test_distribution(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.hash_functions", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_seed);
+        XTESTS_RUN_CASE(test_known_values);
+        XTESTS_RUN_CASE(test_string_types);
+        XTESTS_RUN_CASE(test_wide_strings);
+        XTESTS_RUN_CASE(test_std_hash);
+        XTESTS_RUN_CASE(test_string_equal_to);
+        XTESTS_RUN_CASE(test_unordered_map);
+        XTESTS_RUN_CASE(test_frequency_map);
+        XTESTS_RUN_CASE(test_lengths_distinct);
+        XTESTS_RUN_CASE(test_every_byte_significant);
+        XTESTS_RUN_CASE(test_avalanche);
+        XTESTS_RUN_CASE(test_distribution);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::ss_uint64_t                            hash_type;
+
+    // Lengths either side of the boundaries of the short-input
+    // algorithm's cases, and of the striped algorithm's stripes and blocks
+    size_t const    LENGTHS[] =
+    {
+        0, 1, 2, 3, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 48, 49, 63, 64, 65, 96, 97, 255, 256, 257, 1023, 1024, 1025, 1087, 1088, 1089, 2047, 2048, 2049, 5000
+    };
+
+    size_t const    MAX_LENGTH  =   5000;
+
+    // A deterministic pseudo-random byte sequence
+    std::vector<unsigned char> make_bytes(size_t n, unsigned seed)
+    {
+        std::vector<unsigned char> v(n + 1);
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+
+            v[i] = static_cast<unsigned char>(seed >> 16);
+        }
+
+        return v;
+    }
+
+    unsigned count_bits(hash_type v)
+    {
+        unsigned n = 0;
+
+        for (; 0 != v; v &= v - 1)
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+
+static void test_empty()
+{
+    char const empty[1] = { '\0' };
+
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_bytes(NULL, 0), stlsoft::hash_bytes(empty, 0));
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_bytes(NULL, 0), stlsoft::hash_string(""));
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_bytes(NULL, 0), stlsoft::hash_string(std::string()));
+    XTESTS_TEST_INTEGER_NOT_EQUAL(stlsoft::hash_bytes(NULL, 0), stlsoft::hash_bytes(NULL, 0, 1));
+}
+
+static void test_seed()
+{
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(LENGTHS); ++i)
+    {
+        std::vector<unsigned char> const    v   =   make_bytes(LENGTHS[i], 1);
+        hash_type const                     h0  =   stlsoft::hash_bytes(&v[0], LENGTHS[i]);
+
+        XTESTS_TEST_INTEGER_EQUAL(h0, stlsoft::hash_bytes(&v[0], LENGTHS[i]));
+        XTESTS_TEST_INTEGER_EQUAL(h0, stlsoft::hash_bytes(&v[0], LENGTHS[i], 0));
+        XTESTS_TEST_INTEGER_NOT_EQUAL(h0, stlsoft::hash_bytes(&v[0], LENGTHS[i], 1));
+        XTESTS_TEST_INTEGER_NOT_EQUAL(stlsoft::hash_bytes(&v[0], LENGTHS[i], 1), stlsoft::hash_bytes(&v[0], LENGTHS[i], 2));
+    }}
+}
+
+static void test_known_values()
+{
+    // The values are defined for little-endian byte order, and are the
+    // same whether or not SIMD is available, which is what this verifies
+
+    unsigned const  one =   1;
+
+    if (1 != *reinterpret_cast<unsigned char const*>(&one))
+    {
+        return;
+    }
+
+    struct known_value_t
+    {
+        size_t      len;
+        hash_type   h0;
+        hash_type   h12345;
+    };
+
+    static known_value_t const known_values[] =
+    {
+            {    0, STLSOFT_GEN_UINT64_SUFFIX(0x0409638ee2bde459), STLSOFT_GEN_UINT64_SUFFIX(0xfe71846ec21fdd78) }
+        ,   {    3, STLSOFT_GEN_UINT64_SUFFIX(0xa58dec738225155e), STLSOFT_GEN_UINT64_SUFFIX(0xc77e77652c24a4a9) }
+        ,   {    8, STLSOFT_GEN_UINT64_SUFFIX(0x2223a4f3ee441eef), STLSOFT_GEN_UINT64_SUFFIX(0x5f505116ad9820bd) }
+        ,   {   17, STLSOFT_GEN_UINT64_SUFFIX(0x32efa74c2c0c294c), STLSOFT_GEN_UINT64_SUFFIX(0xc8cf25bdc63fcc10) }
+        ,   {  100, STLSOFT_GEN_UINT64_SUFFIX(0x72e2d1e9a0cf7abc), STLSOFT_GEN_UINT64_SUFFIX(0xe60627941f71efed) }
+        ,   { 1024, STLSOFT_GEN_UINT64_SUFFIX(0xeba369459f522a57), STLSOFT_GEN_UINT64_SUFFIX(0x0058e0ff3836b419) }
+        ,   { 1025, STLSOFT_GEN_UINT64_SUFFIX(0x088f25ec4c38a52b), STLSOFT_GEN_UINT64_SUFFIX(0xaa2dabefd3d2c05d) }
+        ,   { 5000, STLSOFT_GEN_UINT64_SUFFIX(0x2b1bf9ba6baaf2e2), STLSOFT_GEN_UINT64_SUFFIX(0xdf6a3d634fe3d96a) }
+    };
+
+    std::vector<unsigned char> bytes(MAX_LENGTH);
+
+    { for (size_t i = 0; i != MAX_LENGTH; ++i)
+    {
+        bytes[i] = static_cast<unsigned char>(i * 7 + (i >> 8));
+    }}
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(known_values); ++i)
+    {
+        known_value_t const& kv = known_values[i];
+
+        XTESTS_TEST_INTEGER_EQUAL(kv.h0, stlsoft::hash_bytes(&bytes[0], kv.len));
+        XTESTS_TEST_INTEGER_EQUAL(kv.h12345, stlsoft::hash_bytes(&bytes[0], kv.len, 12345));
+    }}
+}
+
+static void test_string_types()
+{
+    char const                  s[]     =   "The quick brown fox jumps over the lazy dog";
+    size_t const                len     =   STLSOFT_NUM_ELEMENTS(s) - 1;
+    hash_type const             h       =   stlsoft::hash_bytes(s, len);
+
+    std::string const           str(s);
+    stlsoft::simple_string const
+                                ss(s);
+    stlsoft::basic_static_string<char, 64> const
+                                sts(s);
+    stlsoft::string_view const  sv(s, len);
+    stlsoft::string_slice<char> const
+                                sl(s, len);
+
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(s, len));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(s));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(str));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(ss));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(sts));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(sv));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::hash_string(sl));
+
+    // a view of part of a string hashes as that part alone
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_string("quick"), stlsoft::hash_string(stlsoft::string_view(s + 4, 5)));
+}
+
+static void test_wide_strings()
+{
+    wchar_t const               s[]     =   L"The quick brown fox";
+    size_t const                len     =   STLSOFT_NUM_ELEMENTS(s) - 1;
+
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_bytes(s, len * sizeof(wchar_t)), stlsoft::hash_string(s, len));
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_string(s, len), stlsoft::hash_string(std::wstring(s)));
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_string(s, len), stlsoft::hash_string(stlsoft::simple_wstring(s)));
+    XTESTS_TEST_INTEGER_EQUAL(stlsoft::hash_string(s, len), stlsoft::hash_string(stlsoft::wstring_view(s, len)));
+}
+
+static void test_std_hash()
+{
+    char const                  s[]     =   "key=value";
+    size_t const                h       =   stlsoft::string_hash()(s);
+
+    XTESTS_TEST_INTEGER_EQUAL(h, std::hash<stlsoft::simple_string>()(stlsoft::simple_string(s)));
+    XTESTS_TEST_INTEGER_EQUAL(h, (std::hash<stlsoft::basic_static_string<char, 32> >()(stlsoft::basic_static_string<char, 32>(s))));
+    XTESTS_TEST_INTEGER_EQUAL(h, std::hash<stlsoft::string_view>()(stlsoft::string_view(s)));
+    XTESTS_TEST_INTEGER_EQUAL(h, std::hash<stlsoft::string_slice<char> >()(stlsoft::string_slice<char>(s, 9)));
+    XTESTS_TEST_INTEGER_EQUAL(h, stlsoft::string_hash()(std::string(s)));
+
+    XTESTS_TEST_INTEGER_EQUAL(std::hash<stlsoft::simple_wstring>()(stlsoft::simple_wstring(L"abc")), stlsoft::string_hash()(L"abc"));
+
+    XTESTS_TEST_INTEGER_NOT_EQUAL(h, stlsoft::string_hash(1)(s));
+}
+
+static void test_string_equal_to()
+{
+    stlsoft::string_equal_to const  eq;
+
+    XTESTS_TEST_BOOLEAN_TRUE(eq(std::string("abc"), stlsoft::string_view("abc")));
+    XTESTS_TEST_BOOLEAN_TRUE(eq(stlsoft::simple_string("abc"), "abc"));
+    XTESTS_TEST_BOOLEAN_TRUE(eq(stlsoft::string_view("abcdef", 3), stlsoft::string_slice<char>("abc", 3)));
+    XTESTS_TEST_BOOLEAN_TRUE(eq("", std::string()));
+    XTESTS_TEST_BOOLEAN_FALSE(eq(std::string("abc"), stlsoft::string_view("abd")));
+    XTESTS_TEST_BOOLEAN_FALSE(eq(std::string("abc"), stlsoft::string_view("abcd")));
+    XTESTS_TEST_BOOLEAN_FALSE(eq(stlsoft::simple_string("abc"), ""));
+}
+
+static void test_unordered_map()
+{
+    typedef std::unordered_map<
+        stlsoft::simple_string
+    ,   int
+    >                                                       map_t;
+
+    map_t m;
+
+    { for (int i = 0; i != 1000; ++i)
+    {
+        char sz[21];
+
+        ::sprintf(sz, "key-%d", i);
+
+        m[stlsoft::simple_string(sz)] = i;
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, m.size());
+    XTESTS_TEST_INTEGER_EQUAL(0, m[stlsoft::simple_string("key-0")]);
+    XTESTS_TEST_INTEGER_EQUAL(999, m[stlsoft::simple_string("key-999")]);
+    XTESTS_TEST_BOOLEAN_TRUE(m.end() == m.find(stlsoft::simple_string("key-1000")));
+
+#if __cplusplus >= 202002L
+
+    // heterogeneous lookup, with no conversion to the key type
+    typedef std::unordered_map<
+        std::string
+    ,   int
+    ,   stlsoft::string_hash
+    ,   stlsoft::string_equal_to
+    >                                                       tmap_t;
+
+    tmap_t tm;
+
+    tm["abc"] = 1;
+    tm["defg"] = 2;
+
+    XTESTS_TEST_BOOLEAN_TRUE(tm.end() != tm.find(stlsoft::string_view("abc")));
+    XTESTS_TEST_INTEGER_EQUAL(2, tm.find(stlsoft::string_view("defgh", 4))->second);
+    XTESTS_TEST_BOOLEAN_TRUE(tm.end() == tm.find(stlsoft::simple_string("xyz")));
+#endif /* C++20+ */
+}
+
+static void test_frequency_map()
+{
+    typedef stlsoft::frequency_map<
+        stlsoft::string_view
+    ,   stlsoft::frequency_map_traits_unordered<stlsoft::string_view>
+    >                                                       fmap_t;
+
+    char const* const   text    =   "the cat and the hat and the bat";
+    char const*         b       =   text;
+    fmap_t              fm;
+
+    { for (char const* p = text; ; ++p)
+    {
+        if ('\0' == *p ||
+            ' ' == *p)
+        {
+            fm.push(stlsoft::string_view(b, static_cast<size_t>(p - b)));
+
+            if ('\0' == *p)
+            {
+                break;
+            }
+
+            b = p + 1;
+        }
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, fm.size());
+    XTESTS_TEST_INTEGER_EQUAL(3u, fm[stlsoft::string_view("the")]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, fm[stlsoft::string_view("and")]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, fm[stlsoft::string_view("cat")]);
+}
+
+static void test_lengths_distinct()
+{
+    // Every prefix of the same bytes - including runs of the same byte,
+    // and of zeroes - has a distinct hash
+
+    std::vector<unsigned char> const    bytes   =   make_bytes(MAX_LENGTH, 2);
+    std::vector<unsigned char> const    zeroes(MAX_LENGTH + 1);
+    std::vector<unsigned char> const    as(MAX_LENGTH + 1, 'a');
+    std::set<hash_type>                 hashes;
+
+    { for (size_t n = 0; n <= MAX_LENGTH; ++n)
+    {
+        hashes.insert(stlsoft::hash_bytes(&bytes[0], n));
+        hashes.insert(stlsoft::hash_bytes(&zeroes[0], n));
+        hashes.insert(stlsoft::hash_bytes(&as[0], n));
+    }}
+
+    // the empty prefix is common to all three
+    XTESTS_TEST_INTEGER_EQUAL(3 * MAX_LENGTH + 1, hashes.size());
+}
+
+static void test_every_byte_significant()
+{
+    // Changing any one byte changes the hash, whichever stripe, block, or
+    // tail it is in
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(LENGTHS); ++i)
+    {
+        size_t const                len     =   LENGTHS[i];
+        std::vector<unsigned char>  bytes   =   make_bytes(len, 3);
+        hash_type const             h       =   stlsoft::hash_bytes(&bytes[0], len);
+
+        { for (size_t j = 0; j != len; ++j)
+        {
+            bytes[j] ^= 0x01;
+
+            XTESTS_TEST_INTEGER_NOT_EQUAL(h, stlsoft::hash_bytes(&bytes[0], len));
+
+            bytes[j] ^= 0x01;
+        }}
+    }}
+}
+
+static void test_avalanche()
+{
+    // Flipping any one input bit flips each output bit with a probability
+    // close to 0.5, for inputs hashed by each algorithm
+
+    size_t const    lengths[]   =   { 8, 24, 100, 2048 };
+    unsigned const  NUM_TRIALS  =   64;
+
+    { for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(lengths); ++i)
+    {
+        size_t const    len         =   lengths[i];
+        unsigned        flips[64]   =   { 0 };
+        unsigned long   total       =   0;
+        unsigned long   samples     =   0;
+
+        { for (unsigned t = 0; t != NUM_TRIALS; ++t)
+        {
+            std::vector<unsigned char> bytes = make_bytes(len, 100 + t);
+
+            hash_type const h = stlsoft::hash_bytes(&bytes[0], len);
+
+            // every bit of short inputs; a sample of the bits of long ones
+            for (size_t bit = 0; bit < 8 * len; bit += (len > 100) ? 61 : 1)
+            {
+                bytes[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+
+                hash_type const d = h ^ stlsoft::hash_bytes(&bytes[0], len);
+
+                bytes[bit / 8] ^= static_cast<unsigned char>(1u << (bit % 8));
+
+                total += count_bits(d);
+                ++samples;
+
+                { for (unsigned k = 0; k != 64; ++k)
+                {
+                    flips[k] += static_cast<unsigned>((d >> k) & 1);
+                }}
+            }
+        }}
+
+        double const mean = double(total) / double(samples);
+
+        XTESTS_TEST_BOOLEAN_TRUE(mean > 31.5 && mean < 32.5);
+
+        { for (unsigned k = 0; k != 64; ++k)
+        {
+            double const p = double(flips[k]) / double(samples);
+
+            XTESTS_TEST_BOOLEAN_TRUE(p > 0.45 && p < 0.55);
+        }}
+    }}
+}
+
+static void test_distribution()
+{
+    // Sequential keys - the worst case for weak hashes - are distributed
+    // uniformly over buckets selected by both the low and the high bits
+    // of the hash, as measured by the chi-squared statistic
+
+    size_t const    NUM_KEYS    =   1 << 16;
+    size_t const    NUM_BUCKETS =   1 << 12;
+
+    std::vector<unsigned>   low(NUM_BUCKETS);
+    std::vector<unsigned>   high(NUM_BUCKETS);
+
+    { for (size_t i = 0; i != NUM_KEYS; ++i)
+    {
+        char        sz[21];
+        int const   n   =   ::sprintf(sz, "key-%lu", static_cast<unsigned long>(i));
+        hash_type   h   =   stlsoft::hash_string(sz, static_cast<size_t>(n));
+
+        ++low[static_cast<size_t>(h % NUM_BUCKETS)];
+        ++high[static_cast<size_t>(h >> 52)];
+    }}
+
+    double const    expected    =   double(NUM_KEYS) / double(NUM_BUCKETS);
+    double          chi2_low    =   0;
+    double          chi2_high   =   0;
+
+    { for (size_t i = 0; i != NUM_BUCKETS; ++i)
+    {
+        chi2_low    +=  (double(low[i]) - expected) * (double(low[i]) - expected) / expected;
+        chi2_high   +=  (double(high[i]) - expected) * (double(high[i]) - expected) / expected;
+    }}
+
+    // with 4095 degrees of freedom the statistic has a mean of 4095 and a
+    // standard deviation of about 90.5; allow 5 standard deviations
+    double const    lo          =   4095 - 5 * ::sqrt(2.0 * 4095);
+    double const    hi          =   4095 + 5 * ::sqrt(2.0 * 4095);
+
+    XTESTS_TEST_BOOLEAN_TRUE(chi2_low > lo && chi2_low < hi);
+    XTESTS_TEST_BOOLEAN_TRUE(chi2_high > lo && chi2_high < hi);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,376 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.replace_functions/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::replace()`, `stlsoft::replace_copy()`
+ *          and `stlsoft::replace_multiple()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/replace_functions.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/string/simple_string.hpp>
+
+/* Standard C++ header files */
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_replace_none(void);
+    static void test_replace_same_length(void);
+    static void test_replace_longer(void);
+    static void test_replace_shorter(void);
+    static void test_replace_empty_find(void);
+    static void test_replace_empty_replace(void);
+    static void test_replace_overlapping(void);
+    static void test_replace_replacement_contains_find(void);
+    static void test_replace_find_longer_than_string(void);
+    static void test_replace_string_types(void);
+    static void test_replace_wide(void);
+    static void test_replace_copy_iterator(void);
+    static void test_replace_copy_buffer(void);
+    static void test_replace_multiple(void);
+    static void test_replace_multiple_order(void);
+    static void test_replace_multiple_no_rescan(void);
+    static void test_replace_multiple_empty_find(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.replace_functions", verbosity))
+    {
+        XTESTS_RUN_CASE(test_replace_none);
+        XTESTS_RUN_CASE(test_replace_same_length);
+        XTESTS_RUN_CASE(test_replace_longer);
+        XTESTS_RUN_CASE(test_replace_shorter);
+        XTESTS_RUN_CASE(test_replace_empty_find);
+        XTESTS_RUN_CASE(test_replace_empty_replace);
+        XTESTS_RUN_CASE(test_replace_overlapping);
+        XTESTS_RUN_CASE(test_replace_replacement_contains_find);
+        XTESTS_RUN_CASE(test_replace_find_longer_than_string);
+        XTESTS_RUN_CASE(test_replace_string_types);
+        XTESTS_RUN_CASE(test_replace_wide);
+        XTESTS_RUN_CASE(test_replace_copy_iterator);
+        XTESTS_RUN_CASE(test_replace_copy_buffer);
+        XTESTS_RUN_CASE(test_replace_multiple);
+        XTESTS_RUN_CASE(test_replace_multiple_order);
+        XTESTS_RUN_CASE(test_replace_multiple_no_rescan);
+        XTESTS_RUN_CASE(test_replace_multiple_empty_find);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    std::string replace(char const* s, char const* f, char const* r)
+    {
+        std::string str(s);
+
+        stlsoft::replace(str, f, r);
+
+        return str;
+    }
+
+    std::string replace_copy(char const* s, char const* f, char const* r)
+    {
+        std::string str;
+
+        stlsoft::replace_copy(std::string(s), f, r, std::back_inserter(str));
+
+        return str;
+    }
+
+    typedef std::pair<std::string, std::string>             pair_t;
+    typedef std::vector<pair_t>                             pairs_t;
+
+
+static void test_replace_none()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", replace("", "a", "b"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", replace("abc", "d", "e"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", replace("abc", "ac", "e"));
+}
+
+static void test_replace_same_length()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xbcxbc", replace("abcabc", "a", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xyzxyz", replace("abcabc", "abc", "xyz"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abab", replace("abab", "ab", "ab"));
+}
+
+static void test_replace_longer()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a--b--c", replace("a-b-c", "-", "--"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("<x><x>", replace("xx", "x", "<x>"));
+}
+
+static void test_replace_shorter()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a-b-c", replace("a--b--c", "--", "-"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x.y.z", replace("x::y::z", "::", "."));
+}
+
+static void test_replace_empty_find()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", replace("abc", "", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", replace("", "", "x"));
+}
+
+static void test_replace_empty_replace()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("bc", replace("abcaaa", "a", ""));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", replace("abab", "ab", ""));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", replace("aabab", "ab", ""));
+}
+
+static void test_replace_overlapping()
+{
+    // matches are found left-to-right and do not overlap
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xx", replace("aaaa", "aa", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xa", replace("aaa", "aa", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xba", replace("abababa", "ababa", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("aaaaaa", replace("aaaa", "aa", "aaa"));
+}
+
+static void test_replace_replacement_contains_find()
+{
+    // replaced text is not searched again
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("aaaaaa", replace("aaa", "a", "aa"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xyx-xyx", replace("x-x", "x", "xyx"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("[ab][ab]", replace("abab", "ab", "[ab]"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ba", replace("ab", "ab", "ba"));
+}
+
+static void test_replace_find_longer_than_string()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab", replace("ab", "abc", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", replace("", "abc", "x"));
+}
+
+static void test_replace_string_types()
+{
+    {
+        std::string str("one two one");
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("1 two 1", stlsoft::replace(str, std::string("one"), "1"));
+    }
+
+    {
+        stlsoft::simple_string str("a.b.c");
+
+        stlsoft::replace(str, ".", std::string("::"));
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a::b::c", str);
+    }
+}
+
+static void test_replace_wide()
+{
+    std::wstring str(L"a-b-c");
+
+    stlsoft::replace(str, L"-", L"+=");
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"a+=b+=c", str.c_str());
+
+    stlsoft::replace(str, L"+=", L"");
+
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc", str.c_str());
+}
+
+static void test_replace_copy_iterator()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", replace_copy("", "a", "b"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", replace_copy("abc", "", "b"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a--b--c", replace_copy("a-b-c", "-", "--"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xa", replace_copy("aaa", "aa", "x"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("aaaaaa", replace_copy("aaa", "a", "aa"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("bc", replace_copy("abcaaa", "a", ""));
+}
+
+static void test_replace_copy_buffer()
+{
+    std::string const   str("a-b-c");
+    char                buff[21];
+
+    // the required size, without writing
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, stlsoft::replace_copy(str, "-", "--", static_cast<char*>(NULL), 0));
+
+    // an insufficient buffer is not written
+
+    ::memset(buff, '#', sizeof(buff));
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, stlsoft::replace_copy(str, "-", "--", &buff[0], 6));
+    XTESTS_TEST_CHARACTER_EQUAL('#', buff[0]);
+
+    // a sufficient buffer is written, without a nul-terminator
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, stlsoft::replace_copy(str, "-", "--", &buff[0], 7));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("a--b--c", buff, 7);
+    XTESTS_TEST_CHARACTER_EQUAL('#', buff[7]);
+
+    // no matches, and an empty find string
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, stlsoft::replace_copy(str, "x", "yy", &buff[0], sizeof(buff)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("a-b-c", buff, 5);
+    XTESTS_TEST_INTEGER_EQUAL(5u, stlsoft::replace_copy(str, "", "yy", &buff[0], sizeof(buff)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("a-b-c", buff, 5);
+
+    // shorter
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, stlsoft::replace_copy(str, "-", "", &buff[0], sizeof(buff)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL_N("abc", buff, 3);
+}
+
+static void test_replace_multiple()
+{
+    pairs_t pairs;
+
+    pairs.push_back(pair_t("&", "&amp;"));
+    pairs.push_back(pair_t("<", "&lt;"));
+    pairs.push_back(pair_t(">", "&gt;"));
+
+    std::string str("<a href=\"x&y\">");
+
+    stlsoft::replace_multiple(str, pairs.begin(), pairs.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("&lt;a href=\"x&amp;y\"&gt;", str);
+
+    std::string none("plain");
+
+    stlsoft::replace_multiple(none, pairs.begin(), pairs.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("plain", none);
+
+    std::string empty;
+
+    stlsoft::replace_multiple(empty, pairs.begin(), pairs.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", empty);
+}
+
+static void test_replace_multiple_order()
+{
+    // at each position, the first matching pair is applied
+
+    std::pair<char const*, char const*> const pairs[] =
+    {
+        std::pair<char const*, char const*>("ab", "X"),
+        std::pair<char const*, char const*>("a", "Y"),
+    };
+
+    std::string str("aab");
+
+    stlsoft::replace_multiple(str, &pairs[0], &pairs[0] + STLSOFT_NUM_ELEMENTS(pairs));
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("YX", str);
+}
+
+static void test_replace_multiple_no_rescan()
+{
+    // the text of one replacement is not matched by another pair
+
+    pairs_t pairs;
+
+    pairs.push_back(pair_t("a", "b"));
+    pairs.push_back(pair_t("b", "c"));
+
+    std::string str("ab");
+
+    stlsoft::replace_multiple(str, pairs.begin(), pairs.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("bc", str);
+
+    // nor by the same pair
+
+    pairs_t pairs2;
+
+    pairs2.push_back(pair_t("x", "xx"));
+
+    std::string str2("xyx");
+
+    stlsoft::replace_multiple(str2, pairs2.begin(), pairs2.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xxyxx", str2);
+}
+
+static void test_replace_multiple_empty_find()
+{
+    pairs_t pairs;
+
+    pairs.push_back(pair_t("", "never"));
+    pairs.push_back(pair_t("o", "0"));
+
+    std::string str("foo");
+
+    stlsoft::replace_multiple(str, pairs.begin(), pairs.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("f00", str);
+
+    pairs_t onlyEmpty(1, pair_t("", "x"));
+
+    stlsoft::replace_multiple(str, onlyEmpty.begin(), onlyEmpty.end());
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("f00", str);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -4,7 +4,7 @@
  * Purpose: Unit-tests for `stlsoft::basic_simple_string`.
  *
  * Created: 4th November 2008
- * Updated: 30th January 2024
+ * Updated: 19th October 2026
  *
  * ////////////////////////////////////////////////////////////////////// */
 
@@ -48,7 +48,9 @@
 #include <string>
 
 /* Standard C header files */
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* /////////////////////////////////////////////////////////////////////////
  * forward declarations
@@ -120,6 +122,9 @@ namespace
     static void test_1_22(void);
 #ifdef USING_STLSOFT_SIMPLE_STRING
     static void test_push_back(void);
+    static void test_push_back_geometric_growth(void);
+    static void test_append_exact_growth(void);
+    static void test_resize_and_overwrite(void);
 #endif /* USING_STLSOFT_SIMPLE_STRING */
     static void test_1_23(void);
     static void test_copy(void);
@@ -241,6 +246,9 @@ int main(int argc, char **argv)
         XTESTS_RUN_CASE(test_1_22);
 #ifdef USING_STLSOFT_SIMPLE_STRING
         XTESTS_RUN_CASE(test_push_back);
+        XTESTS_RUN_CASE(test_push_back_geometric_growth);
+        XTESTS_RUN_CASE(test_append_exact_growth);
+        XTESTS_RUN_CASE(test_resize_and_overwrite);
 #endif /* USING_STLSOFT_SIMPLE_STRING */
         XTESTS_RUN_CASE(test_1_23);
         XTESTS_RUN_CASE(test_copy);
@@ -2091,6 +2099,125 @@ static void test_push_back(void)
     XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(3u, s.capacity());
     XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s);
 }
+
+static void test_push_back_geometric_growth(void)
+{
+    string_t    s;
+    size_t      numReallocations = 0;
+    char const* prev = s.data();
+
+    { for (size_t i = 0; i != 100000; ++i)
+    {
+        s.push_back(static_cast<char>('a' + i % 26));
+
+        if (s.data() != prev)
+        {
+            ++numReallocations;
+            prev = s.data();
+        }
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(100000u, s.size());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(100000u, s.capacity());
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(30u, numReallocations);
+    XTESTS_TEST_CHARACTER_EQUAL('a', s[0]);
+    XTESTS_TEST_CHARACTER_EQUAL('z', s[25]);
+    XTESTS_TEST_CHARACTER_EQUAL('a' + 99999 % 26, s[99999]);
+    XTESTS_TEST_CHARACTER_EQUAL('\0', s.c_str()[100000]);
+
+    // a copy does not take the spare capacity
+    string_t    s2(s);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(s, s2);
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(s.capacity(), s2.capacity());
+
+    // nul characters are not appended, as is the case for append(s, cch)
+    s2 += '\0';
+
+    XTESTS_TEST_INTEGER_EQUAL(100000u, s2.size());
+}
+
+static void test_append_exact_growth(void)
+{
+    typedef stlsoft::basic_simple_string<
+        char
+    ,   stlsoft::stlsoft_char_traits<char>
+    ,   stlsoft::allocator_selector<char>::allocator_type
+    ,   stlsoft::simple_string_exact_growth
+    >                                       exact_string_t;
+
+    exact_string_t  s;
+
+    { for (size_t i = 0; i != 100; ++i)
+    {
+        s.append("0123456789");
+    }}
+
+    XTESTS_TEST_INTEGER_EQUAL(1000u, s.size());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1000u, s.capacity());
+    XTESTS_TEST_INTEGER_LESS(1100u, s.capacity());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0123456789", s.substr(990));
+
+    s.append(5, 'x');
+
+    XTESTS_TEST_INTEGER_EQUAL(1005u, s.size());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("789xxxxx", s.substr(997));
+}
+
+// Appends a number to the 7 characters of the existing contents
+struct append_number
+{
+    size_t operator ()(char* p, size_t /* cch */) const
+    {
+        return 7 + static_cast<size_t>(::sprintf(p + 7, "%d", 12345));
+    }
+};
+
+// Overwrites the whole of the contents
+struct overwrite_contents
+{
+    size_t operator ()(char* p, size_t cch) const
+    {
+        ::memset(p, '-', cch);
+
+        return cch / 2;
+    }
+};
+
+static void test_resize_and_overwrite(void)
+{
+    {
+        string_t    s("value: ");
+
+        s.resize_and_overwrite(20, append_number());
+
+        XTESTS_TEST_INTEGER_EQUAL(12u, s.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("value: 12345", s);
+    }
+
+    {
+        string_t    s("abc");
+
+        s.reserve(100);
+
+        char const* const p = s.data();
+
+        s.resize_and_overwrite(100, overwrite_contents());
+
+        XTESTS_TEST_POINTER_EQUAL(p, s.data());
+        XTESTS_TEST_INTEGER_EQUAL(50u, s.size());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(string_t(50, '-'), s);
+    }
+
+    {
+        string_t    s;
+
+        s.resize_and_overwrite(0, overwrite_contents());
+
+        XTESTS_TEST_BOOLEAN_TRUE(s.empty());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", s);
+    }
+}
 #endif /* USING_STLSOFT_SIMPLE_STRING */
 
 static void test_1_23(void)
@@ -0,0 +1,532 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.strnstrn/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft_C_strnstrn()`, `stlsoft_C_wcsnstrn()`
+ *          and `stlsoft::c_string::basic_strnstrn_searcher`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/c_string/strnstrn.h>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty_needle(void);
+    static void test_needle_longer_than_haystack(void);
+    static void test_single_character(void);
+    static void test_not_null_terminated(void);
+    static void test_match_positions(void);
+    static void test_random(void);
+    static void test_Horspool_lengths(void);
+    static void test_worst_case(void);
+    static void test_Two_Way(void);
+    static void test_wide(void);
+    static void test_wide_worst_case(void);
+    static void test_searcher(void);
+    static void test_wide_searcher(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.strnstrn", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty_needle);
+        XTESTS_RUN_CASE(test_needle_longer_than_haystack);
+        XTESTS_RUN_CASE(test_single_character);
+        XTESTS_RUN_CASE(test_not_null_terminated);
+        XTESTS_RUN_CASE(test_match_positions);
+        XTESTS_RUN_CASE(test_random);
+        XTESTS_RUN_CASE(test_Horspool_lengths);
+        XTESTS_RUN_CASE(test_worst_case);
+        XTESTS_RUN_CASE(test_Two_Way);
+        XTESTS_RUN_CASE(test_wide);
+        XTESTS_RUN_CASE(test_wide_worst_case);
+        XTESTS_RUN_CASE(test_searcher);
+        XTESTS_RUN_CASE(test_wide_searcher);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    using stlsoft::c_string::strnstrn_searcher;
+    using stlsoft::c_string::wcsnstrn_searcher;
+
+    // results are reported as offsets, with -1 for not found, so that
+    // failures are legible
+
+    template <typename C>
+    long naive_offset(C const* s1, size_t n1, C const* s2, size_t n2)
+    {
+        for (size_t i = 0; i + n2 <= n1; ++i)
+        {
+            if (std::char_traits<C>::compare(s1 + i, s2, n2) == 0)
+            {
+                return static_cast<long>(i);
+            }
+        }
+
+        return -1;
+    }
+
+    template <typename C>
+    long offset_of(C const* s1, C const* p)
+    {
+        return (NULL == p) ? -1 : static_cast<long>(p - s1);
+    }
+
+    long find(std::string const& s1, std::string const& s2)
+    {
+        return offset_of(s1.data(), stlsoft_C_strnstrn(s1.data(), s1.size(), s2.data(), s2.size()));
+    }
+
+    long find(std::wstring const& s1, std::wstring const& s2)
+    {
+        return offset_of(s1.data(), stlsoft_C_wcsnstrn(s1.data(), s1.size(), s2.data(), s2.size()));
+    }
+
+    template <typename S>
+    long naive(S const& s1, S const& s2)
+    {
+        return naive_offset(s1.data(), s1.size(), s2.data(), s2.size());
+    }
+
+    // a small linear congruential generator, so results are reproducible
+
+    class lcg
+    {
+    public:
+        lcg()
+            : m_state(12345)
+        {}
+
+    public:
+        unsigned operator ()(unsigned n)
+        {
+            m_state = m_state * 1103515245u + 12345u;
+
+            return (m_state >> 16) % n;
+        }
+
+    private:
+        unsigned m_state;
+    };
+
+    template <typename S>
+    S random_string(lcg& r, size_t n, unsigned alphabetSize, unsigned base)
+    {
+        S s(n, typename S::value_type());
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            s[i] = static_cast<typename S::value_type>(base + r(alphabetSize));
+        }
+
+        return s;
+    }
+
+
+static void test_empty_needle()
+{
+    char const s[] = "abc";
+
+    XTESTS_TEST_POINTER_EQUAL(s, stlsoft_C_strnstrn(s, 3, "x", 0));
+    XTESTS_TEST_POINTER_EQUAL(s, stlsoft_C_strnstrn(s, 0, "x", 0));
+
+    wchar_t const ws[] = L"abc";
+
+    XTESTS_TEST_POINTER_EQUAL(ws, stlsoft_C_wcsnstrn(ws, 3, L"x", 0));
+}
+
+static void test_needle_longer_than_haystack()
+{
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find("", "a"));
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find("abc", "abcd"));
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find(std::string(100, 'a'), std::string(1000, 'a')));
+}
+
+static void test_single_character()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0L, find("abc", "a"));
+    XTESTS_TEST_INTEGER_EQUAL(2L, find("abc", "c"));
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find("abc", "d"));
+    XTESTS_TEST_INTEGER_EQUAL(1L, find(std::string("a\0b", 3), std::string(1, '\0')));
+}
+
+static void test_not_null_terminated()
+{
+    // neither string need be terminated, and matches may not extend beyond
+    // the given lengths
+
+    char const s[] = "abcdefabcdef";
+
+    XTESTS_TEST_POINTER_EQUAL(s + 3, stlsoft_C_strnstrn(s, 6, "def", 3));
+    XTESTS_TEST_POINTER_EQUAL(NULL, stlsoft_C_strnstrn(s, 5, "def", 3));
+    XTESTS_TEST_POINTER_EQUAL(s + 3, stlsoft_C_strnstrn(s, 12, "defXYZ", 3));
+    XTESTS_TEST_POINTER_EQUAL(s + 1, stlsoft_C_strnstrn(s + 1, 11, "bcd", 3));
+}
+
+static void test_match_positions()
+{
+    // every position, across the SIMD block widths and the scalar tail
+
+    static char const* const needles[] =
+    {
+        "xy", "xyz", "x-y", "xyzw", "x0123456789y", "x0123456789abcdefghijklmnopqrstuvwxyz"
+    };
+
+    for (size_t n = 0; n != STLSOFT_NUM_ELEMENTS(needles); ++n)
+    {
+        std::string const needle(needles[n]);
+
+        for (size_t len = needle.size(); len != 100; ++len)
+        {
+            for (size_t pos = 0; pos + needle.size() <= len; ++pos)
+            {
+                std::string s(len, '.');
+
+                s.replace(pos, needle.size(), needle);
+
+                XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(pos), find(s, needle));
+
+                // a near-miss (first and last characters only) earlier on
+                if (pos > needle.size())
+                {
+                    s[0] = needle[0];
+                    s[needle.size() - 1] = needle[needle.size() - 1];
+
+                    XTESTS_TEST_INTEGER_EQUAL(naive(s, needle), find(s, needle));
+                }
+            }
+
+            XTESTS_TEST_INTEGER_EQUAL(-1L, find(std::string(len, '.'), needle));
+        }
+    }
+}
+
+static void test_random()
+{
+    lcg r;
+
+    for (unsigned alphabet = 2; alphabet != 5; ++alphabet)
+    {
+        for (int i = 0; i != 3000; ++i)
+        {
+            std::string const s1 = random_string<std::string>(r, r(200), alphabet, 'a');
+            std::string const s2 = random_string<std::string>(r, 1 + r(12), alphabet, 'a');
+
+            XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), find(s1, s2));
+        }
+    }
+}
+
+static void test_Horspool_lengths()
+{
+    lcg             r;
+    size_t const    lengths[] =
+    {
+        STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE - 1,
+        STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE,
+        STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE + 1,
+        2 * STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE + 3,
+    };
+
+    for (size_t l = 0; l != STLSOFT_NUM_ELEMENTS(lengths); ++l)
+    {
+        for (int i = 0; i != 20; ++i)
+        {
+            std::string         s1      =   random_string<std::string>(r, 8 * lengths[l], 3, 'a');
+            size_t const        pos     =   r(static_cast<unsigned>(s1.size() - lengths[l] + 1));
+            std::string const   s2      =   s1.substr(pos, lengths[l]);
+
+            XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), find(s1, s2));
+
+            s1[pos + lengths[l] / 2] = 'z';
+
+            XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), find(s1, s2));
+        }
+    }
+}
+
+static void test_worst_case()
+{
+    // "aaa...ab" in "aaa...a": each candidate position passes the
+    // first/last (or Horspool last-character) test and then fails only at
+    // the end, which was O(n1 * n2) before the hand-over to Two-Way
+
+    size_t const n1 = 1u << 20;
+
+    for (size_t n2 = 3; n2 < 8 * STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE; n2 *= 2)
+    {
+        std::string         s1(n1, 'a');
+        std::string         s2(n2, 'a');
+
+        // first-last filter (and Horspool) pass on all; verify fails late
+
+        s2[n2 - 2] = 'b';
+
+        XTESTS_TEST_INTEGER_EQUAL(-1L, find(s1, s2));
+
+        s1[n1 - 2] = 'b';
+
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(n1 - n2), find(s1, s2));
+
+        // periodic needle, found at the end
+
+        std::string         s3(n1, 'a');
+        std::string         s4(n2, 'a');
+
+        s4[0] = 'b';
+        s3[n1 - n2] = 'b';
+
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(n1 - n2), find(s3, s4));
+
+        s4[n2 / 2] = 'b';
+
+        XTESTS_TEST_INTEGER_EQUAL(-1L, find(s3, s4));
+    }
+}
+
+static void test_Two_Way()
+{
+    // the Two-Way method directly, since the others hand over to it only
+    // once their budget is exhausted
+
+    lcg r;
+
+    for (unsigned alphabet = 2; alphabet != 4; ++alphabet)
+    {
+        for (int i = 0; i != 5000; ++i)
+        {
+            std::string const   s1  =   random_string<std::string>(r, 1 + r(100), alphabet, 'a');
+            std::string         s2  =   random_string<std::string>(r, 1 + r(10), alphabet, 'a');
+
+            if (0 == r(2))
+            {
+                // periodic needle
+
+                std::string const unit = s2.substr(0, 1 + r(static_cast<unsigned>(s2.size())));
+
+                for (s2 = unit; s2.size() < 12; s2 += unit)
+                {}
+            }
+
+            if (s2.size() <= s1.size())
+            {
+                char const* const p = stlsoft_C_strnstrn_by_Two_Way_method(s1.data(), s1.size(), s2.data(), s2.size());
+
+                XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), offset_of(s1.data(), p));
+            }
+        }
+    }
+}
+
+static void test_wide()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0L, find(std::wstring(L"abc"), std::wstring(L"ab")));
+    XTESTS_TEST_INTEGER_EQUAL(1L, find(std::wstring(L"abc"), std::wstring(L"bc")));
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find(std::wstring(L"abc"), std::wstring(L"cb")));
+
+    // characters beyond 0xff, which share Horspool skip-table slots with
+    // others
+
+    lcg r;
+
+    for (int i = 0; i != 3000; ++i)
+    {
+        std::wstring const s1 = random_string<std::wstring>(r, r(300), 3, 0x0161);
+        std::wstring const s2 = random_string<std::wstring>(r, 1 + r(3 * STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE / 2), 3, 0x0161);
+
+        XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), find(s1, s2));
+    }
+
+    std::wstring        s1(1000, wchar_t(0x0100));
+    std::wstring const  s2(STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE, wchar_t(0x0200));
+
+    XTESTS_TEST_INTEGER_EQUAL(-1L, find(s1, s2));
+
+    s1.replace(500, s2.size(), s2);
+
+    XTESTS_TEST_INTEGER_EQUAL(500L, find(s1, s2));
+}
+
+static void test_wide_worst_case()
+{
+    size_t const n1 = 1u << 18;
+
+    for (size_t n2 = 3; n2 < 8 * STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE; n2 *= 2)
+    {
+        std::wstring    s1(n1, wchar_t(0x3042));
+        std::wstring    s2(n2, wchar_t(0x3042));
+
+        s2[n2 - 2] = wchar_t(0x3044);
+
+        XTESTS_TEST_INTEGER_EQUAL(-1L, find(s1, s2));
+
+        s1[n1 - 2] = wchar_t(0x3044);
+
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(n1 - n2), find(s1, s2));
+
+        std::wstring const s3(s1);
+
+        char const* const dummy = NULL;
+
+        STLSOFT_SUPPRESS_UNUSED(dummy);
+
+        wchar_t const* const p = stlsoft_C_wcsnstrn_by_Two_Way_method(s3.data(), s3.size(), s2.data(), s2.size());
+
+        XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(n1 - n2), offset_of(s3.data(), p));
+    }
+}
+
+static void test_searcher()
+{
+    lcg r;
+
+    {
+        strnstrn_searcher const searcher("abc", 3);
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, searcher.needle_length());
+        XTESTS_TEST_INTEGER_EQUAL(0, strncmp("abc", searcher.needle(), 3));
+    }
+
+    size_t const lengths[] =
+    {
+        2,
+        7,
+        STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE,
+        STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE + 5,
+    };
+
+    for (size_t l = 0; l != STLSOFT_NUM_ELEMENTS(lengths); ++l)
+    {
+        std::string const       s2  =   random_string<std::string>(r, lengths[l], 2, 'a');
+        strnstrn_searcher const searcher(s2.data(), s2.size());
+
+        // the same searcher, over many haystacks
+
+        for (int i = 0; i != 50; ++i)
+        {
+            std::string s1 = random_string<std::string>(r, r(static_cast<unsigned>(4 * lengths[l])), 2, 'a');
+
+            if (0 == r(2) &&
+                s1.size() >= s2.size())
+            {
+                s1.replace(r(static_cast<unsigned>(s1.size() - s2.size() + 1)), s2.size(), s2);
+            }
+
+            char const* const p = searcher.find(s1.data(), s1.size());
+
+            XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), offset_of(s1.data(), p));
+            XTESTS_TEST_INTEGER_EQUAL(find(s1, s2), offset_of(s1.data(), p));
+        }
+    }
+
+    // worst case, through the searcher's precomputed table
+
+    std::string         s1(1u << 20, 'a');
+    std::string         s2(2 * STLSOFT_C_STRNSTRN_HORSPOOL_MIN_NEEDLE, 'a');
+
+    s2[s2.size() / 2] = 'b';
+
+    strnstrn_searcher const searcher(s2.data(), s2.size());
+
+    XTESTS_TEST_POINTER_EQUAL(NULL, searcher.find(s1.data(), s1.size()));
+
+    s1.replace(s1.size() - s2.size(), s2.size(), s2);
+
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<long>(s1.size() - s2.size()), offset_of(s1.data(), searcher.find(s1.data(), s1.size())));
+}
+
+static void test_wide_searcher()
+{
+    lcg r;
+
+    size_t const lengths[] =
+    {
+        3,
+        STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE,
+        2 * STLSOFT_C_WCSNSTRN_HORSPOOL_MIN_NEEDLE + 1,
+    };
+
+    for (size_t l = 0; l != STLSOFT_NUM_ELEMENTS(lengths); ++l)
+    {
+        std::wstring const      s2  =   random_string<std::wstring>(r, lengths[l], 2, 0x4e00);
+        wcsnstrn_searcher const searcher(s2.data(), s2.size());
+
+        for (int i = 0; i != 50; ++i)
+        {
+            std::wstring s1 = random_string<std::wstring>(r, r(static_cast<unsigned>(4 * lengths[l])), 2, 0x4e00);
+
+            if (0 == r(2) &&
+                s1.size() >= s2.size())
+            {
+                s1.replace(r(static_cast<unsigned>(s1.size() - s2.size() + 1)), s2.size(), s2);
+            }
+
+            wchar_t const* const p = searcher.find(s1.data(), s1.size());
+
+            XTESTS_TEST_INTEGER_EQUAL(naive(s1, s2), offset_of(s1.data(), p));
+        }
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,268 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.string.trim_functions/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::trim_left()`, `stlsoft::trim_right()`
+ *          and `stlsoft::trim_all()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/trim_functions.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/string/simple_string.hpp>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_nothing_to_trim(void);
+    static void test_all_whitespace(void);
+    static void test_each_whitespace_character(void);
+    static void test_interior_whitespace_retained(void);
+    static void test_embedded_nul(void);
+    static void test_lengths(void);
+    static void test_trim_chars(void);
+    static void test_wide(void);
+    static void test_simple_string(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.string.trim_functions", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_nothing_to_trim);
+        XTESTS_RUN_CASE(test_all_whitespace);
+        XTESTS_RUN_CASE(test_each_whitespace_character);
+        XTESTS_RUN_CASE(test_interior_whitespace_retained);
+        XTESTS_RUN_CASE(test_embedded_nul);
+        XTESTS_RUN_CASE(test_lengths);
+        XTESTS_RUN_CASE(test_trim_chars);
+        XTESTS_RUN_CASE(test_wide);
+        XTESTS_RUN_CASE(test_simple_string);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    template <typename S>
+    S left(S s)
+    {
+        return stlsoft::trim_left(s);
+    }
+
+    template <typename S>
+    S right(S s)
+    {
+        return stlsoft::trim_right(s);
+    }
+
+    template <typename S>
+    S all(S s)
+    {
+        return stlsoft::trim_all(s);
+    }
+
+    std::string left(char const* s)
+    {
+        return left(std::string(s));
+    }
+
+    std::string right(char const* s)
+    {
+        return right(std::string(s));
+    }
+
+    std::string all(char const* s)
+    {
+        return all(std::string(s));
+    }
+
+
+static void test_empty()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", left(""));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", right(""));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", all(""));
+}
+
+static void test_nothing_to_trim()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", left("abc"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", right("abc"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", all("abc"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a", all("a"));
+}
+
+static void test_all_whitespace()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", left(" \t\r\n\v "));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", right(" \t\r\n\v "));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", all(" \t\r\n\v "));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", all(std::string(100, ' ')));
+}
+
+static void test_each_whitespace_character()
+{
+    char const ws[] = " \t\r\n\v";
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(ws) - 1; ++i)
+    {
+        std::string const w(1, ws[i]);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x" + w, left(w + "x" + w));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(w + "x", right(w + "x" + w));
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x", all(w + "x" + w));
+    }
+
+    // other characters, including form-feed, are not trimmed by default
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("\fx\f", all("\fx\f"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("\xA0x\xA0", all("\xA0x\xA0"));
+}
+
+static void test_interior_whitespace_retained()
+{
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a b\tc", all("  a b\tc\r\n"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a b\tc\r\n", left("  a b\tc\r\n"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("  a b\tc", right("  a b\tc\r\n"));
+}
+
+static void test_embedded_nul()
+{
+    // nul characters at the ends are trimmed, as they have always been
+    // (by strchr() matching the trim-set terminator)
+
+    std::string const s(" \0ab\0c\0 \0", 10);
+
+    XTESTS_TEST_INTEGER_EQUAL(8u, left(s).size());
+    XTESTS_TEST(std::string("ab\0c\0 \0", 8) == left(s));
+    XTESTS_TEST(std::string(" \0ab\0c", 6) == right(s));
+    XTESTS_TEST(std::string("ab\0c", 4) == all(s));
+
+    // and beyond the SIMD block width
+
+    std::string const t = std::string(40, '\0') + "x" + std::string(40, '\0');
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("x", all(t));
+}
+
+static void test_lengths()
+{
+    // leading and trailing runs that straddle the 16-character blocks
+
+    for (size_t nl = 0; nl != 40; ++nl)
+    {
+        for (size_t nr = 0; nr != 40; ++nr)
+        {
+            for (size_t nc = 0; nc < 20; nc += 19)
+            {
+                std::string const   content =   (0 == nc) ? std::string() : "x" + std::string(nc - 2, ' ') + "y";
+                std::string const   l(nl, (0 == nl % 2) ? ' ' : '\t');
+                std::string const   r(nr, (0 == nr % 2) ? '\n' : '\r');
+                std::string const   s       =   l + content + r;
+
+                XTESTS_TEST_MULTIBYTE_STRING_EQUAL(content.empty() ? std::string() : content + r, left(s));
+                XTESTS_TEST_MULTIBYTE_STRING_EQUAL(content.empty() ? std::string() : l + content, right(s));
+                XTESTS_TEST_MULTIBYTE_STRING_EQUAL(content, all(s));
+            }
+        }
+    }
+}
+
+static void test_trim_chars()
+{
+    std::string s1("--abc-+");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc-+", stlsoft::trim_left(s1, "-"));
+
+    std::string s2("--abc-+");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("--abc", stlsoft::trim_right(s2, "+-"));
+
+    std::string s3("  --abc-+  ");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", stlsoft::trim_all(s3, std::string(" +-")));
+}
+
+static void test_wide()
+{
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc \t", left(std::wstring(L" \r\nabc \t")));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L" \r\nabc", right(std::wstring(L" \r\nabc \t")));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"abc", all(std::wstring(L" \r\nabc \t")));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"", all(std::wstring(L" \v ")));
+
+    // characters whose low byte is whitespace are not whitespace
+
+    std::wstring const s(1, wchar_t(0x0120));
+
+    XTESTS_TEST(s == all(s));
+}
+
+static void test_simple_string()
+{
+    typedef stlsoft::simple_string  string_t;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", all(string_t("\t abc \r\n")).c_str());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc \r\n", left(string_t("\t abc \r\n")).c_str());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("\t abc", right(string_t("\t abc \r\n")).c_str());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", all(string_t("    ")).c_str());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
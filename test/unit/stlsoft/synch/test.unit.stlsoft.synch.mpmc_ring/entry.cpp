@@ -0,0 +1,369 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.synch.mpmc_ring/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::mpmc_ring`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/synch/mpmc_ring.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_capacity(void);
+    static void test_capacity_too_large(void);
+    static void test_push_pop(void);
+    static void test_full(void);
+    static void test_wrap_around(void);
+    static void test_move_only(void);
+    static void test_push_n(void);
+    static void test_pop_n(void);
+    static void test_destructor(void);
+    static void test_many_threads(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.synch.mpmc_ring", verbosity))
+    {
+        XTESTS_RUN_CASE(test_capacity);
+        XTESTS_RUN_CASE_THAT_THROWS(test_capacity_too_large, std::length_error);
+        XTESTS_RUN_CASE(test_push_pop);
+        XTESTS_RUN_CASE(test_full);
+        XTESTS_RUN_CASE(test_wrap_around);
+        XTESTS_RUN_CASE(test_move_only);
+        XTESTS_RUN_CASE(test_push_n);
+        XTESTS_RUN_CASE(test_pop_n);
+        XTESTS_RUN_CASE(test_destructor);
+        XTESTS_RUN_CASE(test_many_threads);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // Counts the live instances, to check that the ring destroys every
+    // element that it constructs
+    struct counted
+    {
+        static int  numLive;
+
+        int         value;
+
+        counted(int v = 0) STLSOFT_NOEXCEPT
+            : value(v)
+        {
+            ++numLive;
+        }
+        counted(counted const& rhs) STLSOFT_NOEXCEPT
+            : value(rhs.value)
+        {
+            ++numLive;
+        }
+        ~counted()
+        {
+            --numLive;
+        }
+        counted& operator =(counted const&) = default;
+    };
+
+    int counted::numLive = 0;
+
+
+static void test_capacity()
+{
+    XTESTS_TEST_INTEGER_EQUAL(2u, stlsoft::mpmc_ring<int>(0).capacity());
+    XTESTS_TEST_INTEGER_EQUAL(2u, stlsoft::mpmc_ring<int>(2).capacity());
+    XTESTS_TEST_INTEGER_EQUAL(8u, stlsoft::mpmc_ring<int>(5).capacity());
+    XTESTS_TEST_INTEGER_EQUAL(1024u, stlsoft::mpmc_ring<int>(1024).capacity());
+
+    stlsoft::mpmc_ring<int> ring(4);
+    int                     v = -1;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(-1, v);
+}
+
+static void test_capacity_too_large()
+{
+    // rounding up to a power of two would overflow
+    stlsoft::mpmc_ring<int> ring(~size_t(0));
+
+    XTESTS_TEST_FAIL("should not get here");
+}
+
+static void test_push_pop()
+{
+    stlsoft::mpmc_ring<std::string> ring(8);
+    std::string                     s("abc");
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(s));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::string("def")));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", s);
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(s));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_full()
+{
+    stlsoft::mpmc_ring<int> ring(2);
+    int                     v;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(1));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(2));
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(3));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(3));
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(4));
+}
+
+static void test_wrap_around()
+{
+    stlsoft::mpmc_ring<int> ring(4);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        int v = -1;
+
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(i));
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(i + 1));
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(i, v);
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(i + 1, v);
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_move_only()
+{
+    stlsoft::mpmc_ring<std::unique_ptr<int> >   ring(2);
+    std::unique_ptr<int>                        p(new int(42));
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::move(p)));
+    XTESTS_TEST_POINTER_EQUAL(NULL, p.get());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::unique_ptr<int>(new int(43))));
+
+    // a failed push does not move from its argument
+    std::unique_ptr<int> q(new int(44));
+
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(std::move(q)));
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, q.get());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(p));
+    XTESTS_TEST_INTEGER_EQUAL(42, *p);
+}
+
+static void test_push_n()
+{
+    stlsoft::mpmc_ring<int> ring(8);
+    int const               values[] = { 1, 2, 3, 4, 5, 6 };
+    int                     v;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.try_push_n(values, 0));
+    XTESTS_TEST_INTEGER_EQUAL(6u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(8u, ring.size());
+
+    for (int i = 0; i != 6; ++i)
+    {
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(values[i], v);
+    }
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+}
+
+static void test_pop_n()
+{
+    stlsoft::mpmc_ring<int> ring(8);
+    int                     values[8];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.try_pop_n(values, 8));
+
+    for (int i = 0; i != 5; ++i)
+    {
+        ring.try_push(10 + i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, ring.try_pop_n(values, 3));
+    XTESTS_TEST_INTEGER_EQUAL(10, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(12, values[2]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.try_pop_n(values, 8));
+    XTESTS_TEST_INTEGER_EQUAL(13, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(14, values[1]);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_destructor()
+{
+    counted::numLive = 0;
+
+    {
+        stlsoft::mpmc_ring<counted> ring(4);
+        counted                     c(1);
+
+        ring.try_push(c);
+        ring.try_push(c);
+        ring.try_push(c);
+        ring.try_pop(c);
+
+        XTESTS_TEST_INTEGER_EQUAL(3, counted::numLive);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0, counted::numLive);
+}
+
+static void test_many_threads()
+{
+    // Every value pushed, singly or in batches, by the producers is
+    // popped exactly once by the consumers
+
+    stlsoft::mpmc_ring<unsigned>    ring(64);
+    int const                       numProducers = 4;
+    int const                       numConsumers = 4;
+    unsigned const                  N = 20000;
+    std::vector<std::atomic<int> >  seen(numProducers * N);
+    std::atomic<unsigned>           numPopped(0);
+    std::vector<std::thread>        threads;
+
+    for (int p = 0; p != numProducers; ++p)
+    {
+        threads.push_back(std::thread([&, p]() {
+
+            unsigned const base = p * N;
+
+            for (unsigned i = 0; i != N; )
+            {
+                unsigned const  batch[3] = { base + i, base + i + 1, base + i + 2 };
+                size_t const    n = (0 == p % 2) ? (ring.try_push(base + i) ? 1u : 0u) : ring.try_push_n(batch, (N - i < 3) ? N - i : 3);
+
+                i += static_cast<unsigned>(n);
+
+                if (0 == n)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+    for (int c = 0; c != numConsumers; ++c)
+    {
+        threads.push_back(std::thread([&, c]() {
+
+            unsigned buff[5];
+
+            for (; numPopped.load() != numProducers * N; )
+            {
+                size_t const n = (0 == c % 2) ? (ring.try_pop(buff[0]) ? 1u : 0u) : ring.try_pop_n(buff, STLSOFT_NUM_ELEMENTS(buff));
+
+                for (size_t i = 0; i != n; ++i)
+                {
+                    ++seen[buff[i]];
+                }
+
+                numPopped += static_cast<unsigned>(n);
+
+                if (0 == n)
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    size_t numWrong = 0;
+
+    for (size_t i = 0; i != seen.size(); ++i)
+    {
+        if (1 != seen[i].load())
+        {
+            ++numWrong;
+        }
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numWrong);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
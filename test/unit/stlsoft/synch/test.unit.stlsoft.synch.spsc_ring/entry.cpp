@@ -0,0 +1,322 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.synch.spsc_ring/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::spsc_ring`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/synch/spsc_ring.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <memory>
+#include <string>
+#include <thread>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_push_pop(void);
+    static void test_full(void);
+    static void test_wrap_around(void);
+    static void test_move_only(void);
+    static void test_push_n(void);
+    static void test_pop_n(void);
+    static void test_destructor(void);
+    static void test_two_threads(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.synch.spsc_ring", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_push_pop);
+        XTESTS_RUN_CASE(test_full);
+        XTESTS_RUN_CASE(test_wrap_around);
+        XTESTS_RUN_CASE(test_move_only);
+        XTESTS_RUN_CASE(test_push_n);
+        XTESTS_RUN_CASE(test_pop_n);
+        XTESTS_RUN_CASE(test_destructor);
+        XTESTS_RUN_CASE(test_two_threads);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // Counts the live instances, to check that the ring destroys every
+    // element that it constructs
+    struct counted
+    {
+        static int  numLive;
+
+        int         value;
+
+        counted(int v = 0)
+            : value(v)
+        {
+            ++numLive;
+        }
+        counted(counted const& rhs)
+            : value(rhs.value)
+        {
+            ++numLive;
+        }
+        ~counted()
+        {
+            --numLive;
+        }
+        counted& operator =(counted const&) = default;
+    };
+
+    int counted::numLive = 0;
+
+
+static void test_empty()
+{
+    stlsoft::spsc_ring<int, 4>  ring;
+    int                         v = -1;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+    XTESTS_TEST_INTEGER_EQUAL(4u, ring.capacity());
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(-1, v);
+}
+
+static void test_push_pop()
+{
+    stlsoft::spsc_ring<std::string, 8>  ring;
+    std::string                         s;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push("abc"));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::string("def")));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", s);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(s));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("def", s);
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(s));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_full()
+{
+    stlsoft::spsc_ring<int, 2>  ring;
+    int                         v;
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(1));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(2));
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(3));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(3));
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(4));
+}
+
+static void test_wrap_around()
+{
+    stlsoft::spsc_ring<int, 4>  ring;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        int v = -1;
+
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(i));
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(i + 1));
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(i, v);
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(i + 1, v);
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_move_only()
+{
+    stlsoft::spsc_ring<std::unique_ptr<int>, 2> ring;
+    std::unique_ptr<int>                        p(new int(42));
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::move(p)));
+    XTESTS_TEST_POINTER_EQUAL(NULL, p.get());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(std::unique_ptr<int>(new int(43))));
+
+    // a failed push does not move from its argument
+    std::unique_ptr<int> q(new int(44));
+
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(std::move(q)));
+    XTESTS_TEST_POINTER_NOT_EQUAL(NULL, q.get());
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(p));
+    XTESTS_TEST_INTEGER_EQUAL(42, *p);
+}
+
+static void test_push_n()
+{
+    stlsoft::spsc_ring<int, 8>  ring;
+    int const                   values[] = { 1, 2, 3, 4, 5, 6 };
+    int                         v;
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.try_push_n(values, 6));
+    XTESTS_TEST_INTEGER_EQUAL(8u, ring.size());
+
+    for (int i = 0; i != 6; ++i)
+    {
+        XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+        XTESTS_TEST_INTEGER_EQUAL(values[i], v);
+    }
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+}
+
+static void test_pop_n()
+{
+    stlsoft::spsc_ring<int, 8>  ring;
+    int                         values[8];
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.try_pop_n(values, 8));
+
+    for (int i = 0; i != 5; ++i)
+    {
+        ring.try_push(10 + i);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, ring.try_pop_n(values, 3));
+    XTESTS_TEST_INTEGER_EQUAL(10, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(12, values[2]);
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.try_pop_n(values, 8));
+    XTESTS_TEST_INTEGER_EQUAL(13, values[0]);
+    XTESTS_TEST_INTEGER_EQUAL(14, values[1]);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_destructor()
+{
+    counted::numLive = 0;
+
+    {
+        stlsoft::spsc_ring<counted, 4>  ring;
+        counted                         c(1);
+
+        ring.try_push(c);
+        ring.try_push(c);
+        ring.try_push(c);
+        ring.try_pop(c);
+
+        XTESTS_TEST_INTEGER_EQUAL(3, counted::numLive);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0, counted::numLive);
+}
+
+static void test_two_threads()
+{
+    stlsoft::spsc_ring<unsigned, 64>    ring;
+    unsigned const                      N = 200000;
+    bool                                inOrder = true;
+
+    std::thread consumer([&]() {
+
+        unsigned    buff[16];
+        unsigned    expected = 0;
+
+        for (; expected != N; )
+        {
+            size_t const n = ring.try_pop_n(buff, STLSOFT_NUM_ELEMENTS(buff));
+
+            for (size_t i = 0; i != n; ++i, ++expected)
+            {
+                if (expected != buff[i])
+                {
+                    inOrder = false;
+                }
+            }
+
+            if (0 == n)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (unsigned i = 0; i != N; )
+    {
+        if (ring.try_push(i))
+        {
+            ++i;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    XTESTS_TEST_BOOLEAN_TRUE(inOrder);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,371 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.synch.work_stealing_pool/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::work_stealing_pool`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/synch/work_stealing_pool.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_concurrency(void);
+    static void test_default_instance(void);
+    static void test_no_chunks(void);
+    static void test_each_chunk_once(void);
+    static void test_uneven_work(void);
+    static void test_many_jobs(void);
+    static void test_nested(void);
+    static void test_concurrent_submitters(void);
+    static void test_exception_cancels_job(void);
+    static void test_usable_after_exception(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.synch.work_stealing_pool", verbosity))
+    {
+        XTESTS_RUN_CASE(test_concurrency);
+        XTESTS_RUN_CASE(test_default_instance);
+        XTESTS_RUN_CASE(test_no_chunks);
+        XTESTS_RUN_CASE(test_each_chunk_once);
+        XTESTS_RUN_CASE(test_uneven_work);
+        XTESTS_RUN_CASE(test_many_jobs);
+        XTESTS_RUN_CASE(test_nested);
+        XTESTS_RUN_CASE(test_concurrent_submitters);
+        XTESTS_RUN_CASE(test_exception_cancels_job);
+        XTESTS_RUN_CASE(test_usable_after_exception);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef stlsoft::work_stealing_pool                     pool_t;
+    typedef std::vector<std::atomic<int> >                  counts_t;
+
+    // counts the number of times each chunk is executed
+    struct count_chunk
+    {
+        counts_t* counts;
+
+        void operator ()(size_t chunk) const
+        {
+            (*counts)[chunk].fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    // does an amount of work that varies greatly between chunks, so that
+    // the participants must steal from one another
+    struct uneven_chunk
+    {
+        counts_t*               counts;
+        std::atomic<unsigned>*  sink;
+
+        void operator ()(size_t chunk) const
+        {
+            unsigned r = 0;
+
+            for (size_t i = 0, n = (0 == chunk % 17) ? 200000 : 10; i != n; ++i)
+            {
+                r = r * 31 + static_cast<unsigned>(i);
+            }
+
+            sink->fetch_add(r, std::memory_order_relaxed);
+            (*counts)[chunk].fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    bool all_once(counts_t const& counts)
+    {
+        for (size_t i = 0; i != counts.size(); ++i)
+        {
+            if (1 != counts[i].load())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // submits a job to the same pool from within each chunk
+    struct nesting_chunk
+    {
+        pool_t*             pool;
+        std::atomic<int>*   total;
+
+        void operator ()(size_t) const
+        {
+            counts_t    counts(10);
+            count_chunk inner = { &counts };
+
+            pool->for_each_chunk(counts.size(), inner);
+
+            total->fetch_add(all_once(counts) ? 1 : 0);
+        }
+    };
+
+    struct throwing_chunk
+    {
+        std::atomic<int>* numCalls;
+
+        void operator ()(size_t chunk) const
+        {
+            numCalls->fetch_add(1);
+
+            if (3 == chunk)
+            {
+                throw std::runtime_error("chunk 3");
+            }
+        }
+    };
+
+
+static void test_concurrency()
+{
+    XTESTS_TEST_INTEGER_EQUAL(1u, pool_t(1).concurrency());
+    XTESTS_TEST_INTEGER_EQUAL(4u, pool_t(4).concurrency());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1u, pool_t().concurrency());
+}
+
+static void test_default_instance()
+{
+    pool_t& pool = pool_t::default_instance();
+
+    XTESTS_TEST_POINTER_EQUAL(&pool, &pool_t::default_instance());
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(1u, pool.concurrency());
+}
+
+static void test_no_chunks()
+{
+    pool_t      pool(4);
+    counts_t    counts(1);
+    count_chunk f = { &counts };
+
+    pool.for_each_chunk(0, f);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, counts[0].load());
+
+    pool.for_each_chunk(1, f);
+
+    XTESTS_TEST_INTEGER_EQUAL(1, counts[0].load());
+}
+
+static void test_each_chunk_once()
+{
+    static size_t const concurrencies[]  =   { 1, 2, 3, 4, 8 };
+    static size_t const numsChunks[]     =   { 1, 2, 3, 5, 64, 1000, 100003 };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(concurrencies); ++i)
+    {
+        pool_t pool(concurrencies[i]);
+
+        for (size_t j = 0; j != STLSOFT_NUM_ELEMENTS(numsChunks); ++j)
+        {
+            counts_t    counts(numsChunks[j]);
+            count_chunk f = { &counts };
+
+            pool.for_each_chunk(counts.size(), f);
+
+            XTESTS_TEST_BOOLEAN_TRUE(all_once(counts));
+        }
+    }
+}
+
+static void test_uneven_work()
+{
+    pool_t                  pool(4);
+    counts_t                counts(1000);
+    std::atomic<unsigned>   sink(0);
+    uneven_chunk            f = { &counts, &sink };
+
+    pool.for_each_chunk(counts.size(), f);
+
+    XTESTS_TEST_BOOLEAN_TRUE(all_once(counts));
+}
+
+static void test_many_jobs()
+{
+    pool_t pool(4);
+
+    for (size_t n = 1; n < 2000; n += 13)
+    {
+        counts_t    counts(n);
+        count_chunk f = { &counts };
+
+        pool.for_each_chunk(counts.size(), f);
+
+        if (!all_once(counts))
+        {
+            XTESTS_TEST_FAIL("a chunk was not executed exactly once");
+
+            break;
+        }
+    }
+}
+
+static void test_nested()
+{
+    // a job submitted from within a chunk function is executed on the
+    // submitting thread, rather than deadlocking
+
+    pool_t              pool(4);
+    std::atomic<int>    total(0);
+    nesting_chunk       f = { &pool, &total };
+
+    pool.for_each_chunk(100, f);
+
+    XTESTS_TEST_INTEGER_EQUAL(100, total.load());
+}
+
+static void test_concurrent_submitters()
+{
+    pool_t                      pool(4);
+    std::vector<counts_t*>      counts;
+    std::vector<std::thread>    threads;
+
+    for (int i = 0; i != 4; ++i)
+    {
+        counts.push_back(new counts_t(5000));
+    }
+
+    for (int i = 0; i != 4; ++i)
+    {
+        count_chunk f = { counts[i] };
+
+        threads.push_back(std::thread([&pool, f]() {
+
+            for (int j = 0; j != 20; ++j)
+            {
+                pool.for_each_chunk(f.counts->size(), f);
+            }
+        }));
+    }
+
+    for (int i = 0; i != 4; ++i)
+    {
+        threads[i].join();
+
+        bool allTwenty = true;
+
+        for (size_t j = 0; j != counts[i]->size(); ++j)
+        {
+            if (20 != (*counts[i])[j].load())
+            {
+                allTwenty = false;
+            }
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(allTwenty);
+
+        delete counts[i];
+    }
+}
+
+static void test_exception_cancels_job()
+{
+    pool_t              pool(4);
+    std::atomic<int>    numCalls(0);
+    throwing_chunk      f = { &numCalls };
+    bool                caught = false;
+
+    try
+    {
+        pool.for_each_chunk(1000000, f);
+    }
+    catch (std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(caught);
+    XTESTS_TEST_INTEGER_LESS(1000000, numCalls.load());
+}
+
+static void test_usable_after_exception()
+{
+    pool_t              pool(4);
+    std::atomic<int>    numCalls(0);
+    throwing_chunk      f = { &numCalls };
+
+    for (int i = 0; i != 3; ++i)
+    {
+        try
+        {
+            pool.for_each_chunk(100, f);
+        }
+        catch (std::runtime_error&)
+        {}
+    }
+
+    counts_t    counts(10000);
+    count_chunk g = { &counts };
+
+    pool.for_each_chunk(counts.size(), g);
+
+    XTESTS_TEST_BOOLEAN_TRUE(all_once(counts));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,338 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.time.cached_localtime/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::cached_localtime()`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/time/cached_localtime.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_single_conversion(void);
+    static void test_same_second(void);
+    static void test_seconds_within_minute(void);
+    static void test_across_minutes(void);
+    static void test_backwards(void);
+    static void test_tz_change_detected(void);
+    static void test_tz_with_seconds_offset(void);
+    static void test_invalidate(void);
+    static void test_multiple_threads(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.time.cached_localtime", verbosity))
+    {
+        XTESTS_RUN_CASE(test_single_conversion);
+        XTESTS_RUN_CASE(test_same_second);
+        XTESTS_RUN_CASE(test_seconds_within_minute);
+        XTESTS_RUN_CASE(test_across_minutes);
+        XTESTS_RUN_CASE(test_backwards);
+        XTESTS_RUN_CASE(test_tz_change_detected);
+        XTESTS_RUN_CASE(test_tz_with_seconds_offset);
+        XTESTS_RUN_CASE(test_invalidate);
+        XTESTS_RUN_CASE(test_multiple_threads);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // 2026-10-19 12:34:56 UTC
+    time_t const BASE_TIME = 1792413296;
+
+    void set_tz(char const* tz)
+    {
+#if defined(_WIN32)
+
+        ::_putenv_s("TZ", tz);
+        ::_tzset();
+#else
+
+        ::setenv("TZ", tz, 1);
+        ::tzset();
+#endif
+    }
+
+    // the reference conversion (only ever called from the main thread)
+    struct tm reference(time_t t)
+    {
+        return *::localtime(&t);
+    }
+
+    struct tm cached(time_t t)
+    {
+        struct tm   tm;
+        int const   r = stlsoft::cached_localtime(&tm, &t);
+
+        XTESTS_TEST_INTEGER_EQUAL(0, r);
+
+        return tm;
+    }
+
+    bool same_tm(struct tm const& lhs, struct tm const& rhs)
+    {
+        return  lhs.tm_sec == rhs.tm_sec &&
+                lhs.tm_min == rhs.tm_min &&
+                lhs.tm_hour == rhs.tm_hour &&
+                lhs.tm_mday == rhs.tm_mday &&
+                lhs.tm_mon == rhs.tm_mon &&
+                lhs.tm_year == rhs.tm_year &&
+                lhs.tm_wday == rhs.tm_wday &&
+                lhs.tm_yday == rhs.tm_yday &&
+                lhs.tm_isdst == rhs.tm_isdst;
+    }
+
+    bool matches_reference(time_t t)
+    {
+        return same_tm(reference(t), cached(t));
+    }
+
+
+static void test_single_conversion()
+{
+    set_tz("UTC0");
+
+    struct tm const tm = cached(BASE_TIME);
+
+    XTESTS_TEST_INTEGER_EQUAL(56, tm.tm_sec);
+    XTESTS_TEST_INTEGER_EQUAL(34, tm.tm_min);
+    XTESTS_TEST_INTEGER_EQUAL(12, tm.tm_hour);
+    XTESTS_TEST_INTEGER_EQUAL(19, tm.tm_mday);
+    XTESTS_TEST_INTEGER_EQUAL(9, tm.tm_mon);
+    XTESTS_TEST_INTEGER_EQUAL(126, tm.tm_year);
+    XTESTS_TEST_INTEGER_EQUAL(1, tm.tm_wday);
+}
+
+static void test_same_second()
+{
+    set_tz("EST5EDT");
+    stlsoft::invalidate_cached_localtime();
+
+    for (int i = 0; i != 10; ++i)
+    {
+        XTESTS_TEST(matches_reference(BASE_TIME));
+    }
+}
+
+static void test_seconds_within_minute()
+{
+    set_tz("CET-1CEST");
+    stlsoft::invalidate_cached_localtime();
+
+    time_t const minute = BASE_TIME - (BASE_TIME % 60);
+
+    for (int i = 0; i != 60; ++i)
+    {
+        XTESTS_TEST(matches_reference(minute + i));
+    }
+
+    for (int i = 59; i >= 0; --i)
+    {
+        XTESTS_TEST(matches_reference(minute + i));
+    }
+}
+
+static void test_across_minutes()
+{
+    set_tz("IST-5:30");
+    stlsoft::invalidate_cached_localtime();
+
+    for (time_t t = BASE_TIME - 200; t < BASE_TIME + 200; t += 7)
+    {
+        XTESTS_TEST(matches_reference(t));
+    }
+
+    // hours, days and years
+
+    XTESTS_TEST(matches_reference(BASE_TIME + 3600));
+    XTESTS_TEST(matches_reference(BASE_TIME + 86400));
+    XTESTS_TEST(matches_reference(BASE_TIME + 86400 * 365));
+    XTESTS_TEST(matches_reference(0));
+}
+
+static void test_backwards()
+{
+    set_tz("UTC0");
+    stlsoft::invalidate_cached_localtime();
+
+    // the second before a minute boundary must not be taken as being in
+    // the cached minute
+
+    time_t const minute = BASE_TIME - (BASE_TIME % 60);
+
+    XTESTS_TEST(matches_reference(minute));
+    XTESTS_TEST(matches_reference(minute - 1));
+    XTESTS_TEST(matches_reference(minute + 60));
+    XTESTS_TEST(matches_reference(minute + 59));
+}
+
+static void test_tz_change_detected()
+{
+    // a change to TZ is detected, without invalidation, once the second
+    // changes
+
+    set_tz("UTC0");
+    stlsoft::invalidate_cached_localtime();
+
+    XTESTS_TEST_INTEGER_EQUAL(12, cached(BASE_TIME).tm_hour);
+
+    set_tz("JST-9");
+
+    struct tm const tm = cached(BASE_TIME + 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(21, tm.tm_hour);
+    XTESTS_TEST_INTEGER_EQUAL(57, tm.tm_sec);
+    XTESTS_TEST(matches_reference(BASE_TIME + 2));
+}
+
+static void test_tz_with_seconds_offset()
+{
+    // an offset that is not a whole number of minutes, for which the
+    // seconds may not simply be adjusted
+
+    set_tz("XXX-0:00:30");
+    stlsoft::invalidate_cached_localtime();
+
+    for (time_t t = BASE_TIME - 90; t != BASE_TIME + 90; ++t)
+    {
+        XTESTS_TEST(matches_reference(t));
+    }
+}
+
+static void test_invalidate()
+{
+    set_tz("UTC0");
+    stlsoft::invalidate_cached_localtime();
+
+    XTESTS_TEST_INTEGER_EQUAL(12, cached(BASE_TIME).tm_hour);
+
+    set_tz("PST8");
+
+#ifndef STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE
+
+    // without invalidation, the same second is served from the cache ...
+
+    XTESTS_TEST_INTEGER_EQUAL(12, cached(BASE_TIME).tm_hour);
+#endif /* !STLSOFT_TIME_CACHED_LOCALTIME_NO_CACHE */
+
+    // ... and with it the change takes effect immediately
+
+    stlsoft::invalidate_cached_localtime();
+
+    XTESTS_TEST_INTEGER_EQUAL(4, cached(BASE_TIME).tm_hour);
+    XTESTS_TEST(matches_reference(BASE_TIME));
+}
+
+static void test_multiple_threads()
+{
+    set_tz("EST5EDT");
+    stlsoft::invalidate_cached_localtime();
+
+    size_t const            NUM_THREADS =   4;
+    int const               NUM_TIMES   =   1000;
+    std::vector<struct tm>  expected;
+
+    for (int i = 0; i != NUM_TIMES; ++i)
+    {
+        expected.push_back(reference(BASE_TIME + i * 13));
+    }
+
+    std::vector<int>            failures(NUM_THREADS);
+    std::vector<std::thread>    threads;
+
+    for (size_t n = 0; n != NUM_THREADS; ++n)
+    {
+        threads.push_back(std::thread([&, n]() {
+
+            // each thread visits the times in its own order
+
+            for (int j = 0; j != 3; ++j)
+            {
+                for (int i = 0; i != NUM_TIMES; ++i)
+                {
+                    int const   ix  =   (0 == n % 2) ? i : (NUM_TIMES - 1 - i);
+                    time_t const t  =   BASE_TIME + ix * 13;
+                    struct tm   tm;
+
+                    if (0 != stlsoft::cached_localtime(&tm, &t) ||
+                        !same_tm(expected[ix], tm))
+                    {
+                        ++failures[n];
+                    }
+                }
+            }
+        }));
+    }
+
+    for (size_t n = 0; n != NUM_THREADS; ++n)
+    {
+        threads[n].join();
+
+        XTESTS_TEST_INTEGER_EQUAL(0, failures[n]);
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
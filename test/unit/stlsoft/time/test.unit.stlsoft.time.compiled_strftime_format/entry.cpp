@@ -0,0 +1,334 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.time.compiled_strftime_format/entry.cpp
+ *
+ * Purpose: Unit-tests for `stlsoft::compiled_strftime_format` and
+ *          `stlsoft::compiled_strftime_renderer`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/time/compiled_strftime_format.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/time/fast_strftime.hpp>
+
+/* Standard C++ header files */
+#include <string>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty_format(void);
+    static void test_literal_only(void);
+    static void test_simple_formats(void);
+    static void test_quirks(void);
+    static void test_long_formats(void);
+    static void test_num_ops_and_max_length(void);
+    static void test_buffer_too_small(void);
+    static void test_copy_and_swap(void);
+    static void test_renderer(void);
+    static void test_wide(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.time.compiled_strftime_format", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty_format);
+        XTESTS_RUN_CASE(test_literal_only);
+        XTESTS_RUN_CASE(test_simple_formats);
+        XTESTS_RUN_CASE(test_quirks);
+        XTESTS_RUN_CASE(test_long_formats);
+        XTESTS_RUN_CASE(test_num_ops_and_max_length);
+        XTESTS_RUN_CASE(test_buffer_too_small);
+        XTESTS_RUN_CASE(test_copy_and_swap);
+        XTESTS_RUN_CASE(test_renderer);
+        XTESTS_RUN_CASE(test_wide);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // 2026-10-19 12:34:56 UTC
+    time_t const BASE_TIME = 1792413296;
+
+    struct tm utc(time_t t)
+    {
+        return *::gmtime(&t);
+    }
+
+    // the reference rendering, by fast_strftime()
+    std::string reference(char const* fmt, struct tm const& tm)
+    {
+        char    buff[2001];
+        size_t  n = stlsoft::fast_strftime(&buff[0], STLSOFT_NUM_ELEMENTS(buff), fmt, &tm);
+
+        return std::string(buff, n);
+    }
+
+    std::string compiled(char const* fmt, struct tm const& tm)
+    {
+        stlsoft::compiled_strftime_format const f(fmt);
+        char                                    buff[2001];
+        size_t                                  n = f.render(buff, &tm);
+
+        return std::string(buff, n);
+    }
+
+    bool matches_reference(char const* fmt)
+    {
+        struct tm const tm = utc(BASE_TIME);
+
+        return reference(fmt, tm) == compiled(fmt, tm);
+    }
+
+
+static void test_empty_format()
+{
+    stlsoft::compiled_strftime_format const f("");
+    char                                    buff[10];
+    struct tm const                         tm = utc(BASE_TIME);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.num_ops());
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.max_length());
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.render(buff, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", buff);
+}
+
+static void test_literal_only()
+{
+    stlsoft::compiled_strftime_format const f("abc");
+    struct tm const                         tm = utc(BASE_TIME);
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, f.num_ops());
+    XTESTS_TEST_INTEGER_EQUAL(3u, f.max_length());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", compiled("abc", tm));
+}
+
+static void test_simple_formats()
+{
+    struct tm const tm = utc(BASE_TIME);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-19 12:34:56", compiled("%Y-%m-%d %H:%M:%S", tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", compiled("%a %b %d %T %Y", tm));
+
+    static char const* const formats[] =
+    {
+        "%a", "%A", "%b", "%h", "%B", "%C", "%d", "%D", "%e", "%F", "%H",
+        "%I", "%j", "%M", "%m", "%R", "%S", "%T", "%u", "%U", "%W", "%w",
+        "%Y", "%y", "%#d", "%#H", "%#j",
+        "[%Y]", "%Y%m%d", "x%%y", "%n%t",
+    };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(formats); ++i)
+    {
+        XTESTS_TEST(matches_reference(formats[i]));
+    }
+}
+
+static void test_quirks()
+{
+    // unsupported specifiers, and a trailing '%', are handled as by
+    // fast_strftime()
+
+    XTESTS_TEST(matches_reference("%Q%Y"));
+    XTESTS_TEST(matches_reference("abc%"));
+    XTESTS_TEST(matches_reference("%#%"));
+    XTESTS_TEST(matches_reference("%#n"));
+    XTESTS_TEST(matches_reference("%##Y"));
+}
+
+static void test_long_formats()
+{
+    // formats whose operations and literals exceed the internal sizes of
+    // the buffers (16 and 64, respectively), which are sized exactly
+
+    struct tm const tm = utc(BASE_TIME);
+
+    for (size_t n = 0; n < 200; n += 7)
+    {
+        std::string const   lits(n, 'x');
+        std::string         fmt;
+
+        for (size_t i = 0; i != n / 3; ++i)
+        {
+            fmt += "%Y-%m-";
+        }
+        fmt += lits;
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(fmt.c_str(), tm), compiled(fmt.c_str(), tm));
+
+        fmt = lits + "%H" + lits + "%%" + lits;
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(fmt.c_str(), tm), compiled(fmt.c_str(), tm));
+    }
+}
+
+static void test_num_ops_and_max_length()
+{
+    struct tm const tm = utc(BASE_TIME);
+
+    {
+        stlsoft::compiled_strftime_format const f("%Y-%m-%d");
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, f.num_ops());
+        XTESTS_TEST_INTEGER_EQUAL(10u, f.max_length());
+    }
+
+    {
+        stlsoft::compiled_strftime_format const f("%H:%M:%S.");
+
+        XTESTS_TEST_INTEGER_EQUAL(4u, f.num_ops());
+        XTESTS_TEST_INTEGER_EQUAL(9u, f.max_length());
+    }
+
+    {
+        stlsoft::compiled_strftime_format const f("%A %B");
+
+        XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(compiled("%A %B", tm).size(), f.max_length());
+    }
+}
+
+static void test_buffer_too_small()
+{
+    stlsoft::compiled_strftime_format const f("%Y-%m-%d");
+    struct tm const                         tm = utc(BASE_TIME);
+    char                                    buff[11];
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, f.render(&buff[0], 11, &tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-19", buff);
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.render(&buff[0], 10, &tm));
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.render(&buff[0], 1, &tm));
+    XTESTS_TEST_INTEGER_EQUAL(0u, f.render(NULL, 0, &tm));
+}
+
+static void test_copy_and_swap()
+{
+    std::string const                   fmt = std::string(100, '-') + "%Y%m%d%H%M%S%Y%m%d%H%M%S%Y%m%d%H%M%S";
+    stlsoft::compiled_strftime_format   f1(fmt.c_str());
+    stlsoft::compiled_strftime_format   f2("%H");
+    stlsoft::compiled_strftime_format   f3(f1);
+    struct tm const                     tm = utc(BASE_TIME);
+    char                                buff[201];
+
+    XTESTS_TEST_INTEGER_EQUAL(f1.num_ops(), f3.num_ops());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(fmt.c_str(), tm), std::string(buff, f3.render(buff, &tm)));
+
+    f1.swap(f2);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("12", std::string(buff, f1.render(buff, &tm)));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(fmt.c_str(), tm), std::string(buff, f2.render(buff, &tm)));
+
+    f2 = f1;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("12", std::string(buff, f2.render(buff, &tm)));
+}
+
+static void test_renderer()
+{
+    // successive seconds, minutes, hours and days, including those for
+    // which only the time fields are re-rendered in place
+
+    static char const* const formats[] =
+    {
+        "%Y-%m-%d %H:%M:%S",
+        "%a %b %e %T %Y",
+        "%#H:%#M:%#S",
+        "[%j] %I %M",
+    };
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(formats); ++i)
+    {
+        stlsoft::compiled_strftime_format const f(formats[i]);
+        stlsoft::compiled_strftime_renderer     r(f);
+
+        for (time_t t = BASE_TIME; t < BASE_TIME + 2 * 86400; t += 599)
+        {
+            struct tm const tm = utc(t);
+            size_t const    n  = r.render(&tm);
+
+            XTESTS_TEST_INTEGER_EQUAL(n, r.size());
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(formats[i], tm), r.c_str());
+        }
+
+        r.reset();
+
+        struct tm const tm = utc(BASE_TIME);
+
+        r.render(&tm);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(formats[i], tm), r.c_str());
+    }
+}
+
+static void test_wide()
+{
+    stlsoft::compiled_wcsftime_format const f(L"%Y-%m-%d %H:%M:%S");
+    struct tm const                         tm = utc(BASE_TIME);
+    wchar_t                                 buff[101];
+
+    XTESTS_TEST_INTEGER_EQUAL(19u, f.render(buff, &tm));
+    XTESTS_TEST_WIDE_STRING_EQUAL(L"2026-10-19 12:34:56", buff);
+
+    std::wstring const                      fmt = std::wstring(300, L'~') + L"%Y";
+    stlsoft::compiled_wcsftime_format const f2(fmt.c_str());
+    wchar_t                                 buff2[401];
+
+    XTESTS_TEST_INTEGER_EQUAL(304u, f2.render(buff2, &tm));
+    XTESTS_TEST_WIDE_STRING_EQUAL(std::wstring(300, L'~') + L"2026", buff2);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
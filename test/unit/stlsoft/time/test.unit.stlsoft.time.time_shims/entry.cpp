@@ -0,0 +1,290 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.time.time_shims/entry.cpp
+ *
+ * Purpose: Unit-tests for the string access shims for `struct tm` and
+ *          `std::chrono::system_clock::time_point`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/shims/access/string/std/time.hpp>
+#include <stlsoft/shims/access/string/std/chrono.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <chrono>
+#include <string>
+
+/* Standard C header files */
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_null(void);
+    static void test_default_format(void);
+    static void test_many_times(void);
+    static void test_fields_out_of_range(void);
+    static void test_other_locale(void);
+    static void test_thread_locale(void);
+    static void test_custom_format(void);
+    static void test_reference_overloads(void);
+    static void test_time_point(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.time.time_shims", verbosity))
+    {
+        XTESTS_RUN_CASE(test_null);
+        XTESTS_RUN_CASE(test_default_format);
+        XTESTS_RUN_CASE(test_many_times);
+        XTESTS_RUN_CASE(test_fields_out_of_range);
+        XTESTS_RUN_CASE(test_other_locale);
+        XTESTS_RUN_CASE(test_thread_locale);
+        XTESTS_RUN_CASE(test_custom_format);
+        XTESTS_RUN_CASE(test_reference_overloads);
+        XTESTS_RUN_CASE(test_time_point);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    // 2026-10-19 12:34:56 UTC
+    time_t const BASE_TIME = 1792413296;
+
+    struct tm utc(time_t t)
+    {
+        return *::gmtime(&t);
+    }
+
+    std::string reference(struct tm const& tm, char const* fmt = "%a %b %d %H:%M:%S %Y")
+    {
+        char    buff[101];
+        size_t  n = ::strftime(&buff[0], STLSOFT_NUM_ELEMENTS(buff), fmt, &tm);
+
+        return std::string(buff, n);
+    }
+
+    std::string data_of(struct tm const* tm)
+    {
+        stlsoft::basic_shim_string<char> const s = stlsoft::c_str_data_a(tm);
+
+        return std::string(s.data(), s.size());
+    }
+
+
+static void test_null()
+{
+    struct tm const* const tm = NULL;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", data_of(tm));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::c_str_len_a(tm));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::c_str_len(tm));
+}
+
+static void test_default_format()
+{
+    struct tm const tm = utc(BASE_TIME);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", data_of(&tm));
+    XTESTS_TEST_INTEGER_EQUAL(24u, stlsoft::c_str_len_a(&tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", stlsoft::c_str_ptr_a(&tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", stlsoft::c_str_ptr(&tm));
+}
+
+static void test_many_times()
+{
+    // every day of the week and month, and both single- and double-digit
+    // fields, compared with strftime(); the length is the exact length
+
+    for (time_t t = 0; t < BASE_TIME; t += 86400 * 37 + 3671)
+    {
+        struct tm const tm = utc(t);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+        XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+    }
+}
+
+static void test_fields_out_of_range()
+{
+    // fields outside the ranges of fast_strftime() are rendered by
+    // strftime()
+
+    struct tm tm = utc(BASE_TIME);
+
+    tm.tm_year = 9000;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+    XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+
+    tm = utc(BASE_TIME);
+    tm.tm_year = -1850;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+    XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+
+    tm = utc(BASE_TIME);
+    tm.tm_sec = 60;
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+    XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+}
+
+static void test_other_locale()
+{
+    // in any other locale the results must be those of strftime()
+
+    static char const* const names[] =
+    {
+        "C.UTF-8",
+        "de_DE.UTF-8",
+        "fr_FR.ISO-8859-1",
+        "ja_JP.UTF-8",
+    };
+
+    std::string const   prior(::setlocale(LC_TIME, NULL));
+    struct tm const     tm = utc(BASE_TIME);
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(names); ++i)
+    {
+        if (NULL != ::setlocale(LC_TIME, names[i]))
+        {
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+            XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+        }
+    }
+
+    ::setlocale(LC_TIME, prior.c_str());
+}
+
+static void test_thread_locale()
+{
+#ifdef LC_GLOBAL_LOCALE
+    // a locale installed by uselocale() must be honoured, even though the
+    // global locale is "C"
+
+    static char const* const names[] =
+    {
+        "C.UTF-8",
+        "de_DE.UTF-8",
+        "fr_FR.ISO-8859-1",
+        "ja_JP.UTF-8",
+    };
+
+    struct tm const tm = utc(BASE_TIME);
+
+    for (size_t i = 0; i != STLSOFT_NUM_ELEMENTS(names); ++i)
+    {
+        locale_t const loc = ::newlocale(LC_TIME_MASK, names[i], static_cast<locale_t>(0));
+
+        if (static_cast<locale_t>(0) != loc)
+        {
+            ::uselocale(loc);
+
+            XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), data_of(&tm));
+            XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(&tm));
+
+            ::uselocale(LC_GLOBAL_LOCALE);
+            ::freelocale(loc);
+        }
+    }
+#endif /* LC_GLOBAL_LOCALE */
+}
+
+static void test_custom_format()
+{
+    struct tm const tm = utc(BASE_TIME);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("2026-10-19", stlsoft::c_str_data_a(&tm, "%Y-%m-%d"));
+    XTESTS_TEST_INTEGER_EQUAL(10u, stlsoft::c_str_len_a(&tm, "%Y-%m-%d"));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("12:34:56", stlsoft::c_str_data_a(tm, "%H:%M:%S"));
+    XTESTS_TEST_INTEGER_EQUAL(8u, stlsoft::c_str_len_a(tm, "%H:%M:%S"));
+}
+
+static void test_reference_overloads()
+{
+    struct tm const tm = utc(BASE_TIME);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", stlsoft::c_str_data_a(tm));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("Mon Oct 19 12:34:56 2026", stlsoft::c_str_data(tm));
+    XTESTS_TEST_INTEGER_EQUAL(24u, stlsoft::c_str_len_a(tm));
+    XTESTS_TEST_INTEGER_EQUAL(24u, stlsoft::c_str_len(tm));
+}
+
+static void test_time_point()
+{
+    // the conversion is to local time, so the reference is localtime()
+
+    std::chrono::system_clock::time_point const tp = std::chrono::system_clock::from_time_t(BASE_TIME);
+    struct tm const                             tm = *::localtime(&BASE_TIME);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm), stlsoft::c_str_data_a(tp));
+    XTESTS_TEST_INTEGER_EQUAL(reference(tm).size(), stlsoft::c_str_len_a(tp));
+
+    // repeated conversions of the same, and of neighbouring, seconds
+
+    for (int i = 0; i != 120; ++i)
+    {
+        time_t const    t   =   BASE_TIME + i / 2;
+        struct tm const tm2 =   *::localtime(&t);
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL(reference(tm2), stlsoft::c_str_data_a(std::chrono::system_clock::from_time_t(t)));
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,489 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.stlsoft.util.bits/entry.cpp
+ *
+ * Purpose: Unit-tests for the bit-counting, bit-testing, XOR and bitmap
+ *          functions in `stlsoft/util/bits`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/util/bits/bitmap_functions.h>
+#include <stlsoft/util/bits/count_functions.h>
+#include <stlsoft/util/bits/test_functions.h>
+#include <stlsoft/util/bits/xor_functions.h>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_count_bits_32(void);
+    static void test_count_bits_64(void);
+    static void test_count_bits_methods(void);
+    static void test_count_bits_over_range(void);
+    static void test_find_highest_bit(void);
+    static void test_find_lowest_bit(void);
+    static void test_calculate_xor_over_range(void);
+    static void test_bitmap_functions(void);
+    static void test_bitmap_functions_aliased(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.stlsoft.util.bits", verbosity))
+    {
+        XTESTS_RUN_CASE(test_count_bits_32);
+        XTESTS_RUN_CASE(test_count_bits_64);
+        XTESTS_RUN_CASE(test_count_bits_methods);
+        XTESTS_RUN_CASE(test_count_bits_over_range);
+        XTESTS_RUN_CASE(test_find_highest_bit);
+        XTESTS_RUN_CASE(test_find_lowest_bit);
+        XTESTS_RUN_CASE(test_calculate_xor_over_range);
+        XTESTS_RUN_CASE(test_bitmap_functions);
+        XTESTS_RUN_CASE(test_bitmap_functions_aliased);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    using stlsoft::ss_uint8_t;
+    using stlsoft::ss_uint16_t;
+    using stlsoft::ss_uint32_t;
+    using stlsoft::ss_uint64_t;
+
+    // xorshift64, so that results are reproducible
+
+    class rng
+    {
+    public:
+        rng()
+            : m_state(0x9E3779B97F4A7C15ull)
+        {}
+
+    public:
+        ss_uint64_t operator ()()
+        {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 7;
+            m_state ^= m_state << 17;
+
+            return m_state;
+        }
+
+        // a value with a random density of bits, so that sparse and
+        // dense words are both exercised
+        ss_uint64_t any()
+        {
+            switch ((*this)() % 4)
+            {
+            case 0:
+                return (*this)() & (*this)() & (*this)();
+            case 1:
+                return (*this)() | (*this)() | (*this)();
+            case 2:
+                return ~ss_uint64_t(0);
+            default:
+                return (*this)();
+            }
+        }
+
+    private:
+        ss_uint64_t m_state;
+    };
+
+    template <typename T>
+    unsigned reference_count(T v)
+    {
+        unsigned n = 0;
+
+        for (; 0 != v; v >>= 1)
+        {
+            n += static_cast<unsigned>(v & 1);
+        }
+
+        return n;
+    }
+
+    template <typename T>
+    unsigned reference_highest(T v)
+    {
+        unsigned n = 0;
+
+        for (; 0 != v; v >>= 1)
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+    template <typename T>
+    unsigned reference_lowest(T v)
+    {
+        if (0 == v)
+        {
+            return 0;
+        }
+
+        unsigned n = 1;
+
+        for (; 0 == (v & 1); v >>= 1)
+        {
+            ++n;
+        }
+
+        return n;
+    }
+
+    // the kernels must not depend on the alignment of the range, so each is
+    // exercised at every offset into a buffer of its block size
+
+    template <typename T>
+    std::vector<T> random_values(rng& r, size_t n)
+    {
+        std::vector<T> v(n);
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            v[i] = static_cast<T>(r.any());
+        }
+
+        return v;
+    }
+
+    template <typename T>
+    T reference_xor(T const* p, size_t n)
+    {
+        T r = 0;
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            r = static_cast<T>(r ^ p[i]);
+        }
+
+        return r;
+    }
+
+
+static void test_count_bits_32()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::count_bits(ss_uint32_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(32u, stlsoft::count_bits(ss_uint32_t(0xffffffff)));
+    XTESTS_TEST_INTEGER_EQUAL(1u, stlsoft::count_bits(ss_uint32_t(0x80000000)));
+    XTESTS_TEST_INTEGER_EQUAL(16u, stlsoft::count_bits(ss_uint32_t(0xaaaaaaaa)));
+    XTESTS_TEST_INTEGER_EQUAL(2u, stlsoft::count_bits(3));
+    XTESTS_TEST_INTEGER_EQUAL(static_cast<unsigned>(8 * sizeof(int)), stlsoft::count_bits(-1));
+
+    rng r;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        ss_uint32_t const v = static_cast<ss_uint32_t>(r.any());
+
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v), stlsoft::count_bits(v));
+    }
+}
+
+static void test_count_bits_64()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::count_bits(ss_uint64_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(64u, stlsoft::count_bits(~ss_uint64_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(1u, stlsoft::count_bits(ss_uint64_t(1) << 63));
+    XTESTS_TEST_INTEGER_EQUAL(2u, stlsoft::count_bits((ss_uint64_t(1) << 63) | (ss_uint64_t(1) << 31)));
+
+    rng r;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        ss_uint64_t const v = r.any();
+
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v), stlsoft::count_bits(v));
+    }
+}
+
+static void test_count_bits_methods()
+{
+    // every method agrees, whichever is selected for count_bits()
+
+    rng r;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        ss_uint64_t const v64 = r.any();
+        ss_uint32_t const v32 = static_cast<ss_uint32_t>(v64 >> 16);
+
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v32), stlsoft::count_bits_by_Kernighan_method(v32));
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v32), stlsoft::count_bits_by_8bit_table(v32));
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v64), stlsoft::count_bits_by_Kernighan_method(v64));
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v64), stlsoft::count_bits_by_8bit_table(v64));
+#ifdef STLSOFT_BIT_COUNT_BY_intrinsic
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v32), stlsoft::count_bits_by_intrinsic(v32));
+        XTESTS_TEST_INTEGER_EQUAL(reference_count(v64), stlsoft::count_bits_by_intrinsic(v64));
+#endif /* STLSOFT_BIT_COUNT_BY_intrinsic */
+    }
+}
+
+static void test_count_bits_over_range()
+{
+    rng r;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::count_bits_over_range(static_cast<ss_uint64_t const*>(NULL), 0));
+
+    // lengths either side of the Harley-Seal block counts (16 blocks of 4
+    // or 2 integers), at every offset into a 256-bit block
+
+    for (size_t n = 0; n != 200; ++n)
+    {
+        std::vector<ss_uint64_t> const v = random_values<ss_uint64_t>(r, n + 4);
+
+        for (size_t offset = 0; offset != 4; ++offset)
+        {
+            size_t expected = 0;
+
+            for (size_t i = 0; i != n; ++i)
+            {
+                expected += reference_count(v[offset + i]);
+            }
+
+            XTESTS_TEST_INTEGER_EQUAL(expected, stlsoft::count_bits_over_range(&v[offset], n));
+        }
+    }
+
+    // all bits set, which saturates every carry-save accumulator
+
+    std::vector<ss_uint64_t> const ones(1000, ~ss_uint64_t(0));
+
+    XTESTS_TEST_INTEGER_EQUAL(64000u, stlsoft::count_bits_over_range(&ones[0], ones.size()));
+}
+
+static void test_find_highest_bit()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_highest_bit(ss_uint8_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_highest_bit(ss_uint16_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_highest_bit(ss_uint32_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_highest_bit(ss_uint64_t(0)));
+
+    for (unsigned b = 0; b != 64; ++b)
+    {
+        ss_uint64_t const v = ss_uint64_t(1) << b;
+
+        XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_highest_bit(v));
+        XTESTS_TEST_INTEGER_EQUAL(64u, stlsoft::find_highest_bit(v | (ss_uint64_t(1) << 63)));
+
+        if (b < 32)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_highest_bit(static_cast<ss_uint32_t>(v)));
+        }
+        if (b < 16)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_highest_bit(static_cast<ss_uint16_t>(v)));
+        }
+        if (b < 8)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_highest_bit(static_cast<ss_uint8_t>(v)));
+        }
+    }
+
+    rng r;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        ss_uint64_t const v = r() >> (r() % 64);
+
+        XTESTS_TEST_INTEGER_EQUAL(reference_highest(v), stlsoft::find_highest_bit(v));
+        XTESTS_TEST_INTEGER_EQUAL(reference_highest(static_cast<ss_uint32_t>(v)), stlsoft::find_highest_bit(static_cast<ss_uint32_t>(v)));
+        XTESTS_TEST_INTEGER_EQUAL(reference_highest(static_cast<ss_uint16_t>(v)), stlsoft::find_highest_bit(static_cast<ss_uint16_t>(v)));
+        XTESTS_TEST_INTEGER_EQUAL(reference_highest(static_cast<ss_uint8_t>(v)), stlsoft::find_highest_bit(static_cast<ss_uint8_t>(v)));
+    }
+}
+
+static void test_find_lowest_bit()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_lowest_bit(ss_uint32_t(0)));
+    XTESTS_TEST_INTEGER_EQUAL(0u, stlsoft::find_lowest_bit(ss_uint64_t(0)));
+
+    for (unsigned b = 0; b != 64; ++b)
+    {
+        ss_uint64_t const v = ss_uint64_t(1) << b;
+
+        XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_lowest_bit(v));
+        XTESTS_TEST_INTEGER_EQUAL(1u, stlsoft::find_lowest_bit(v | 1));
+        XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_lowest_bit(~ss_uint64_t(0) << b));
+
+        if (b < 32)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(b + 1, stlsoft::find_lowest_bit(static_cast<ss_uint32_t>(v)));
+        }
+    }
+
+    rng r;
+
+    for (int i = 0; i != 10000; ++i)
+    {
+        ss_uint64_t const v = r() << (r() % 64);
+
+        XTESTS_TEST_INTEGER_EQUAL(reference_lowest(v), stlsoft::find_lowest_bit(v));
+        XTESTS_TEST_INTEGER_EQUAL(reference_lowest(static_cast<ss_uint32_t>(v)), stlsoft::find_lowest_bit(static_cast<ss_uint32_t>(v)));
+    }
+}
+
+static void test_calculate_xor_over_range()
+{
+    rng r;
+
+    for (size_t n = 0; n != 100; ++n)
+    {
+        std::vector<ss_uint64_t> const  v64 =   random_values<ss_uint64_t>(r, n + 4);
+        std::vector<ss_uint32_t> const  v32 =   random_values<ss_uint32_t>(r, n + 8);
+        std::vector<ss_uint16_t> const  v16 =   random_values<ss_uint16_t>(r, n + 16);
+        std::vector<ss_uint8_t> const   v8  =   random_values<ss_uint8_t>(r, n + 32);
+
+        for (size_t offset = 0; offset != 4; ++offset)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(reference_xor(&v64[offset], n), stlsoft::calculate_xor_over_range(&v64[offset], n));
+        }
+        for (size_t offset = 0; offset != 8; ++offset)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(reference_xor(&v32[offset], n), stlsoft::calculate_xor_over_range(&v32[offset], n));
+        }
+        for (size_t offset = 0; offset != 16; ++offset)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(reference_xor(&v16[offset], n), stlsoft::calculate_xor_over_range(&v16[offset], n));
+        }
+        for (size_t offset = 0; offset != 32; ++offset)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(reference_xor(&v8[offset], n), stlsoft::calculate_xor_over_range(&v8[offset], n));
+        }
+    }
+}
+
+static void test_bitmap_functions()
+{
+    rng r;
+
+    for (size_t n = 0; n != 40; ++n)
+    {
+        std::vector<ss_uint64_t> const  lhs =   random_values<ss_uint64_t>(r, n + 1);
+        std::vector<ss_uint64_t> const  rhs =   random_values<ss_uint64_t>(r, n + 1);
+
+        for (size_t offset = 0; offset != 2; ++offset)
+        {
+            // a guard element after the range detects overrun
+
+            std::vector<ss_uint64_t>    d_and(n + 2, 0x5555);
+            std::vector<ss_uint64_t>    d_or(n + 2, 0x5555);
+            std::vector<ss_uint64_t>    d_xor(n + 2, 0x5555);
+            std::vector<ss_uint64_t>    d_andnot(n + 2, 0x5555);
+            size_t const                m   =   n - (offset < n ? offset : n);
+
+            stlsoft::bitmap_and(&d_and[offset], &lhs[offset], &rhs[offset], m);
+            stlsoft::bitmap_or(&d_or[offset], &lhs[offset], &rhs[offset], m);
+            stlsoft::bitmap_xor(&d_xor[offset], &lhs[offset], &rhs[offset], m);
+            stlsoft::bitmap_andnot(&d_andnot[offset], &lhs[offset], &rhs[offset], m);
+
+            for (size_t i = 0; i != m; ++i)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(lhs[offset + i] & rhs[offset + i], d_and[offset + i]);
+                XTESTS_TEST_INTEGER_EQUAL(lhs[offset + i] | rhs[offset + i], d_or[offset + i]);
+                XTESTS_TEST_INTEGER_EQUAL(lhs[offset + i] ^ rhs[offset + i], d_xor[offset + i]);
+                XTESTS_TEST_INTEGER_EQUAL(lhs[offset + i] & ~rhs[offset + i], d_andnot[offset + i]);
+            }
+
+            XTESTS_TEST_INTEGER_EQUAL(0x5555u, d_and[offset + m]);
+            XTESTS_TEST_INTEGER_EQUAL(0x5555u, d_or[offset + m]);
+            XTESTS_TEST_INTEGER_EQUAL(0x5555u, d_xor[offset + m]);
+            XTESTS_TEST_INTEGER_EQUAL(0x5555u, d_andnot[offset + m]);
+        }
+    }
+}
+
+static void test_bitmap_functions_aliased()
+{
+    // the destination may be either source
+
+    rng r;
+
+    for (size_t n = 1; n != 40; ++n)
+    {
+        std::vector<ss_uint64_t> const  lhs =   random_values<ss_uint64_t>(r, n);
+        std::vector<ss_uint64_t> const  rhs =   random_values<ss_uint64_t>(r, n);
+
+        std::vector<ss_uint64_t>        a1(lhs);
+        std::vector<ss_uint64_t>        a2(rhs);
+        std::vector<ss_uint64_t>        a3(lhs);
+        std::vector<ss_uint64_t>        a4(rhs);
+        std::vector<ss_uint64_t>        a5(lhs);
+
+        stlsoft::bitmap_and(&a1[0], &a1[0], &rhs[0], n);
+        stlsoft::bitmap_or(&a2[0], &lhs[0], &a2[0], n);
+        stlsoft::bitmap_xor(&a3[0], &a3[0], &rhs[0], n);
+        stlsoft::bitmap_andnot(&a4[0], &lhs[0], &a4[0], n);
+        stlsoft::bitmap_xor(&a5[0], &a5[0], &a5[0], n);
+
+        for (size_t i = 0; i != n; ++i)
+        {
+            XTESTS_TEST_INTEGER_EQUAL(lhs[i] & rhs[i], a1[i]);
+            XTESTS_TEST_INTEGER_EQUAL(lhs[i] | rhs[i], a2[i]);
+            XTESTS_TEST_INTEGER_EQUAL(lhs[i] ^ rhs[i], a3[i]);
+            XTESTS_TEST_INTEGER_EQUAL(lhs[i] & ~rhs[i], a4[i]);
+            XTESTS_TEST_INTEGER_EQUAL(0u, a5[i]);
+        }
+    }
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
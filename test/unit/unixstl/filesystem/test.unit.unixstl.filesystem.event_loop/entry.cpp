@@ -0,0 +1,643 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.filesystem.event_loop/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::event_loop`, with each of its
+ *          mechanisms.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/filesystem/event_loop.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <unixstl/filesystem/pipe.hpp>
+
+/* Standard C++ header files */
+#include <vector>
+
+/* Standard C header files */
+#include <errno.h>
+#include <stdlib.h>
+
+/* UNIX header files */
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_empty(void);
+    static void test_readable(void);
+    static void test_writable(void);
+    static void test_hangup(void);
+    static void test_modify_and_remove(void);
+    static void test_edgeTriggered(void);
+    static void test_oneShot(void);
+    static void test_oneShot_hangup(void);
+    static void test_socketpair(void);
+    static void test_batch(void);
+    static void test_dispatch(void);
+    static void test_wake(void);
+    static void test_wake_other_thread(void);
+    static void test_timer(void);
+    static void test_duplicate(void);
+    static void test_remove_unregistered(void);
+    static void test_invalid_descriptor(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.filesystem.event_loop", verbosity))
+    {
+        XTESTS_RUN_CASE(test_empty);
+        XTESTS_RUN_CASE(test_readable);
+        XTESTS_RUN_CASE(test_writable);
+        XTESTS_RUN_CASE(test_hangup);
+        XTESTS_RUN_CASE(test_modify_and_remove);
+        XTESTS_RUN_CASE(test_edgeTriggered);
+        XTESTS_RUN_CASE(test_oneShot);
+        XTESTS_RUN_CASE(test_oneShot_hangup);
+        XTESTS_RUN_CASE(test_socketpair);
+        XTESTS_RUN_CASE(test_batch);
+        XTESTS_RUN_CASE(test_dispatch);
+        XTESTS_RUN_CASE(test_wake);
+        XTESTS_RUN_CASE(test_wake_other_thread);
+        XTESTS_RUN_CASE(test_timer);
+        XTESTS_RUN_CASE_THAT_THROWS(test_duplicate, unixstl::unixstl_exception);
+        XTESTS_RUN_CASE_THAT_THROWS(test_remove_unregistered, unixstl::unixstl_exception);
+        XTESTS_RUN_CASE(test_invalid_descriptor);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::event_loop                             loop_t;
+    typedef loop_t::event_type                              event_t;
+    typedef unixstl::pipe                                   pipe_t;
+
+    // Each test is run with each mechanism: epoll, where available, and
+    // poll()
+    static int const mechanisms[] =
+    {
+        0,
+        loop_t::usePoll,
+    };
+
+    void write_byte(int fd)
+    {
+        char const      ch  =   'x';
+        ssize_t const   n   =   ::write(fd, &ch, 1);
+
+        STLSOFT_SUPPRESS_UNUSED(n);
+    }
+
+    void read_byte(int fd)
+    {
+        char            ch;
+        ssize_t const   n   =   ::read(fd, &ch, 1);
+
+        STLSOFT_SUPPRESS_UNUSED(n);
+    }
+
+    void* wake_after_delay(void* arg)
+    {
+        ::usleep(20 * 1000);
+
+        static_cast<loop_t*>(arg)->wake();
+
+        return NULL;
+    }
+
+    struct event_counter
+    {
+        size_t* count;
+
+        void operator ()(event_t const& ev) const
+        {
+            if (0 != (loop_t::readable & ev.events))
+            {
+                read_byte(ev.fd);
+            }
+
+            ++*count;
+        }
+    };
+
+
+static void test_empty()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        event_t events[4];
+
+#if defined(UNIXSTL_OS_IS_LINUX)
+        XTESTS_TEST_BOOLEAN_EQUAL(0 == mechanisms[m], loop.is_epoll());
+#endif /* UNIXSTL_OS_IS_LINUX */
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 10));
+    }
+}
+
+static void test_readable()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p;
+        event_t events[4];
+        int     cookie;
+
+        loop.add(p.read_handle(), loop_t::readable, &cookie);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        write_byte(p.write_handle());
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(p.read_handle(), events[0].fd);
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::readable), events[0].events);
+        XTESTS_TEST_POINTER_EQUAL(&cookie, events[0].cookie);
+
+        // level-triggered, so reported until read
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        read_byte(p.read_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        loop.remove(p.read_handle());
+    }
+}
+
+static void test_writable()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p;
+        event_t events[4];
+
+        loop.add(p.write_handle(), loop_t::writable);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(p.write_handle(), events[0].fd);
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::writable), events[0].events);
+        XTESTS_TEST_POINTER_EQUAL(NULL, events[0].cookie);
+
+        loop.remove(p.write_handle());
+    }
+}
+
+static void test_hangup()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p;
+        event_t events[4];
+
+        loop.add(p.read_handle(), loop_t::readable);
+
+        p.close_write();
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_BOOLEAN_TRUE(0 != (loop_t::hangup & events[0].events));
+
+        loop.remove(p.read_handle());
+    }
+}
+
+static void test_modify_and_remove()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p1;
+        pipe_t  p2;
+        event_t events[4];
+        int     cookie;
+
+        loop.add(p1.read_handle(), loop_t::readable);
+        loop.add(p2.read_handle(), loop_t::readable);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, loop.size());
+
+        write_byte(p1.write_handle());
+        write_byte(p2.write_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        // no longer interested
+        loop.modify(p1.read_handle(), 0);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(p2.read_handle(), events[0].fd);
+
+        loop.modify(p1.read_handle(), loop_t::readable, &cookie);
+        loop.remove(p2.read_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.size());
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(p1.read_handle(), events[0].fd);
+        XTESTS_TEST_POINTER_EQUAL(&cookie, events[0].cookie);
+
+        loop.remove(p1.read_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+    }
+}
+
+static void test_edgeTriggered()
+{
+    loop_t  loop;
+    pipe_t  p;
+    event_t events[4];
+
+    loop.add(p.read_handle(), loop_t::readable | loop_t::edgeTriggered);
+
+    write_byte(p.write_handle());
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+    if (loop.is_epoll())
+    {
+        // not reported again until more data arrives
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        write_byte(p.write_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+    }
+
+    loop.remove(p.read_handle());
+}
+
+static void test_oneShot()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p;
+        event_t events[4];
+
+        loop.add(p.read_handle(), loop_t::readable | loop_t::oneShot);
+
+        write_byte(p.write_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        loop.modify(p.read_handle(), loop_t::readable | loop_t::oneShot);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        loop.remove(p.read_handle());
+    }
+}
+
+static void test_oneShot_hangup()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        pipe_t  p;
+        event_t events[4];
+
+        loop.add(p.read_handle(), loop_t::readable | loop_t::oneShot);
+
+        p.close_write();
+
+        // a hang-up, like any other event, disarms the registration
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_BOOLEAN_TRUE(0 != (loop_t::hangup & events[0].events));
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        loop.modify(p.read_handle(), loop_t::readable | loop_t::oneShot);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        loop.remove(p.read_handle());
+    }
+}
+
+static void test_socketpair()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        int     fds[2];
+        event_t events[4];
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, &fds[0])));
+
+        loop.add(fds[0], loop_t::readable | loop_t::writable);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::writable), events[0].events);
+
+        write_byte(fds[1]);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::readable | loop_t::writable), events[0].events);
+
+        ::close(fds[1]);
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_BOOLEAN_TRUE(0 != (loop_t::hangup & events[0].events));
+
+        loop.remove(fds[0]);
+        ::close(fds[0]);
+    }
+}
+
+static void test_batch()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t                  loop(mechanisms[m]);
+        std::vector<pipe_t*>    pipes;
+        event_t                 events[64];
+
+        for (size_t i = 0; i != 50; ++i)
+        {
+            pipes.push_back(new pipe_t());
+
+            loop.add(pipes.back()->read_handle(), loop_t::readable);
+
+            write_byte(pipes.back()->write_handle());
+        }
+
+        // all returned from a single call
+        XTESTS_TEST_INTEGER_EQUAL(50u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+
+        // and, when the array is too small, over several, without any
+        // being missed
+        size_t total = 0;
+
+        for (size_t n; 0 != (n = loop.wait(&events[0], 8, 0)); )
+        {
+            for (size_t i = 0; i != n; ++i)
+            {
+                read_byte(events[i].fd);
+            }
+
+            total += n;
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(50u, total);
+
+        for (size_t i = 0; i != pipes.size(); ++i)
+        {
+            loop.remove(pipes[i]->read_handle());
+
+            delete pipes[i];
+        }
+    }
+}
+
+static void test_dispatch()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t          loop(mechanisms[m]);
+        pipe_t          p1;
+        pipe_t          p2;
+        size_t          count = 0;
+        event_counter   f = { &count };
+
+        loop.add(p1.read_handle(), loop_t::readable);
+        loop.add(p2.read_handle(), loop_t::readable);
+
+        write_byte(p1.write_handle());
+        write_byte(p2.write_handle());
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, loop.dispatch(f, 0));
+        XTESTS_TEST_INTEGER_EQUAL(2u, count);
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.dispatch(f, 0));
+
+        loop.remove(p1.read_handle());
+        loop.remove(p2.read_handle());
+    }
+}
+
+static void test_wake()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t  loop(mechanisms[m]);
+        event_t events[4];
+
+        loop.wake();
+        loop.wake();
+
+        // coalesced into one event
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+        XTESTS_TEST_INTEGER_EQUAL(-1, events[0].fd);
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::woken), events[0].events);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+    }
+}
+
+static void test_wake_other_thread()
+{
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t      loop(mechanisms[m]);
+        event_t     events[4];
+        pthread_t   thread;
+
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(0, ::pthread_create(&thread, NULL, wake_after_delay, &loop)));
+
+        // would wait indefinitely, but for the wake-up
+        XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), -1));
+        XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::woken), events[0].events);
+
+        ::pthread_join(thread, NULL);
+    }
+}
+
+static void test_timer()
+{
+#if defined(UNIXSTL_OS_IS_LINUX)
+
+    for (size_t m = 0; m != STLSOFT_NUM_ELEMENTS(mechanisms); ++m)
+    {
+        loop_t      loop(mechanisms[m]);
+        event_t     events[4];
+        int         cookie;
+        int const   once = loop.add_timer(10, 0, &cookie);
+        int const   repeating = loop.add_timer(5, 5);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, loop.size());
+
+        size_t  numOnce         =   0;
+        size_t  numRepeating    =   0;
+
+        for (; numRepeating < 4; )
+        {
+            size_t const n = loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 1000);
+
+            XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(0u, n));
+
+            for (size_t i = 0; i != n; ++i)
+            {
+                XTESTS_TEST_INTEGER_EQUAL(unsigned(loop_t::timerExpired), events[i].events);
+
+                if (once == events[i].fd)
+                {
+                    XTESTS_TEST_POINTER_EQUAL(&cookie, events[i].cookie);
+
+                    ++numOnce;
+                }
+                else
+                {
+                    XTESTS_TEST_INTEGER_EQUAL(repeating, events[i].fd);
+
+                    ++numRepeating;
+                }
+            }
+        }
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, numOnce);
+
+        loop.remove_timer(repeating);
+        loop.remove_timer(once);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.size());
+        XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 20));
+    }
+#else /* ? UNIXSTL_OS_IS_LINUX */
+
+    loop_t loop;
+
+    try
+    {
+        loop.add_timer(10, 0);
+
+        XTESTS_TEST_FAIL("should not get here");
+    }
+    catch (unixstl::unixstl_exception& x)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(ENOSYS, int(x.status_code()));
+    }
+#endif /* UNIXSTL_OS_IS_LINUX */
+}
+
+static void test_duplicate()
+{
+    loop_t  loop;
+    pipe_t  p;
+
+    loop.add(p.read_handle(), loop_t::readable);
+    loop.add(p.read_handle(), loop_t::readable);
+}
+
+static void test_remove_unregistered()
+{
+    loop_t  loop;
+    pipe_t  p;
+
+    loop.remove(p.read_handle());
+}
+
+static void test_invalid_descriptor()
+{
+    // poll() reports a descriptor closed while registered with POLLNVAL,
+    // which must not cause the events found with it to be lost
+
+    loop_t  loop(loop_t::usePoll);
+    pipe_t  p;
+    event_t events[4];
+    int     cookie;
+
+    loop.add(p.read_handle(), loop_t::readable, &cookie);
+
+    int const fd = ::dup(p.write_handle());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, fd));
+
+    loop.add(fd, loop_t::writable);
+    ::close(fd);
+
+    write_byte(p.write_handle());
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_EQUAL(1u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0)));
+    XTESTS_TEST_INTEGER_EQUAL(p.read_handle(), events[0].fd);
+    XTESTS_TEST_POINTER_EQUAL(&cookie, events[0].cookie);
+
+    try
+    {
+        loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0);
+
+        XTESTS_TEST_FAIL("should not get here");
+    }
+    catch (unixstl::unixstl_exception& x)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(EBADF, int(x.status_code()));
+    }
+
+    loop.remove(fd);
+    read_byte(p.read_handle());
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, loop.wait(&events[0], STLSOFT_NUM_ELEMENTS(events), 0));
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
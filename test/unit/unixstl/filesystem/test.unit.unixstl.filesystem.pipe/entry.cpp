@@ -0,0 +1,589 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.filesystem.pipe/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::pipe`, `unixstl::pipe_splice()`,
+ *          `unixstl::pipe_tee()`, and `unixstl::pipe_line_reader`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/filesystem/pipe.hpp>
+#include <unixstl/filesystem/pipe_functions.hpp>
+#include <unixstl/filesystem/pipe_line_reader.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UNIX header files */
+#include <fcntl.h>
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_default(void);
+    static void test_nonBlocking(void);
+    static void test_nonBlockingRead(void);
+    static void test_closeOnExec(void);
+    static void test_capacity(void);
+    static void test_splice_pipe_to_pipe(void);
+    static void test_splice_file_to_pipe(void);
+    static void test_splice_all_pipe_to_file(void);
+    static void test_splice_would_block(void);
+    static void test_splice_all_waits_for_output(void);
+    static void test_tee(void);
+    static void test_line_reader_one_source(void);
+    static void test_line_reader_many_sources(void);
+    static void test_line_reader_long_line(void);
+    static void test_line_reader_timeout(void);
+    static void test_line_reader_timeout_trickle(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.filesystem.pipe", verbosity))
+    {
+        XTESTS_RUN_CASE(test_default);
+        XTESTS_RUN_CASE(test_nonBlocking);
+        XTESTS_RUN_CASE(test_nonBlockingRead);
+        XTESTS_RUN_CASE(test_closeOnExec);
+        XTESTS_RUN_CASE(test_capacity);
+        XTESTS_RUN_CASE(test_splice_pipe_to_pipe);
+        XTESTS_RUN_CASE(test_splice_file_to_pipe);
+        XTESTS_RUN_CASE(test_splice_all_pipe_to_file);
+        XTESTS_RUN_CASE(test_splice_would_block);
+        XTESTS_RUN_CASE(test_splice_all_waits_for_output);
+        XTESTS_RUN_CASE(test_tee);
+        XTESTS_RUN_CASE(test_line_reader_one_source);
+        XTESTS_RUN_CASE(test_line_reader_many_sources);
+        XTESTS_RUN_CASE(test_line_reader_long_line);
+        XTESTS_RUN_CASE(test_line_reader_timeout);
+        XTESTS_RUN_CASE(test_line_reader_timeout_trickle);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::pipe                                   pipe_t;
+    typedef unixstl::pipe_line_reader                       reader_t;
+
+    // A temporary file, removed on destruction
+    class temp_file
+    {
+    public:
+        temp_file()
+            : m_fd(-1)
+        {
+            ::strcpy(m_path, "/tmp/test.unit.unixstl.pipe.XXXXXX");
+
+            m_fd = ::mkstemp(m_path);
+        }
+        ~temp_file()
+        {
+            if (-1 != m_fd)
+            {
+                ::close(m_fd);
+                ::unlink(m_path);
+            }
+        }
+
+    public:
+        int fd() const
+        {
+            return m_fd;
+        }
+
+        std::string contents() const
+        {
+            std::string s;
+            FILE*       f = ::fopen(m_path, "rb");
+
+            if (NULL != f)
+            {
+                char    buff[4096];
+                size_t  n;
+
+                for (; 0 != (n = ::fread(&buff[0], 1, sizeof(buff), f)); )
+                {
+                    s.append(&buff[0], n);
+                }
+
+                ::fclose(f);
+            }
+
+            return s;
+        }
+
+    private:
+        char    m_path[64];
+        int     m_fd;
+
+    private:
+        temp_file(temp_file const&);
+        void operator =(temp_file const&);
+    };
+
+    bool is_nonblocking(int fd)
+    {
+        return 0 != (O_NONBLOCK & ::fcntl(fd, F_GETFL));
+    }
+
+    bool is_cloexec(int fd)
+    {
+        return 0 != (FD_CLOEXEC & ::fcntl(fd, F_GETFD));
+    }
+
+    void write_string(int fd, std::string const& s)
+    {
+        ssize_t const n = ::write(fd, s.data(), s.size());
+
+        STLSOFT_SUPPRESS_UNUSED(n);
+    }
+
+    std::string read_string(int fd, size_t cb)
+    {
+        std::vector<char>   buff(cb);
+        ssize_t const       n = ::read(fd, &buff[0], cb);
+
+        return (n > 0) ? std::string(&buff[0], size_t(n)) : std::string();
+    }
+
+
+static void test_default()
+{
+    pipe_t p;
+
+    XTESTS_TEST_INTEGER_NOT_EQUAL(-1, p.read_handle());
+    XTESTS_TEST_INTEGER_NOT_EQUAL(-1, p.write_handle());
+    XTESTS_TEST_BOOLEAN_FALSE(is_nonblocking(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_nonblocking(p.write_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_cloexec(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_cloexec(p.write_handle()));
+
+    write_string(p.write_handle(), "abc");
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc", read_string(p.read_handle(), 10));
+}
+
+static void test_nonBlocking()
+{
+    pipe_t p(pipe_t::nonBlocking);
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_nonblocking(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_TRUE(is_nonblocking(p.write_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_cloexec(p.read_handle()));
+
+    char    ch;
+    ssize_t n = ::read(p.read_handle(), &ch, 1);
+
+    XTESTS_TEST_INTEGER_EQUAL(-1, n);
+    XTESTS_TEST_INTEGER_EQUAL(EAGAIN, errno);
+}
+
+static void test_nonBlockingRead()
+{
+    pipe_t p(pipe_t::nonBlockingRead | pipe_t::closeOnExec);
+
+    XTESTS_TEST_BOOLEAN_TRUE(is_nonblocking(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_nonblocking(p.write_handle()));
+    XTESTS_TEST_BOOLEAN_TRUE(is_cloexec(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_TRUE(is_cloexec(p.write_handle()));
+}
+
+static void test_closeOnExec()
+{
+    pipe_t p(pipe_t::closeOnExec);
+
+    XTESTS_TEST_BOOLEAN_FALSE(is_nonblocking(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_FALSE(is_nonblocking(p.write_handle()));
+    XTESTS_TEST_BOOLEAN_TRUE(is_cloexec(p.read_handle()));
+    XTESTS_TEST_BOOLEAN_TRUE(is_cloexec(p.write_handle()));
+}
+
+static void test_capacity()
+{
+#if defined(F_SETPIPE_SZ)
+
+    pipe_t p(0, 1024 * 1024);
+
+    XTESTS_TEST_INTEGER_EQUAL(1024u * 1024u, p.capacity());
+
+    XTESTS_TEST_INTEGER_EQUAL(128u * 1024u, p.set_capacity(100 * 1024));
+    XTESTS_TEST_INTEGER_EQUAL(128u * 1024u, p.capacity());
+
+    // still available from the read end
+    p.close_write();
+
+    XTESTS_TEST_INTEGER_EQUAL(128u * 1024u, p.capacity());
+#else /* ? F_SETPIPE_SZ */
+
+    pipe_t p(0, 1024 * 1024);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, p.capacity());
+#endif /* F_SETPIPE_SZ */
+}
+
+static void test_splice_pipe_to_pipe()
+{
+    pipe_t p1;
+    pipe_t p2;
+
+    write_string(p1.write_handle(), "0123456789");
+
+    XTESTS_TEST_INTEGER_EQUAL(4, unixstl::pipe_splice(p1.read_handle(), p2.write_handle(), 4));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("0123", read_string(p2.read_handle(), 100));
+
+    XTESTS_TEST_INTEGER_EQUAL(6, unixstl::pipe_splice(p1.read_handle(), p2.write_handle(), 100));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("456789", read_string(p2.read_handle(), 100));
+
+    p1.close_write();
+
+    XTESTS_TEST_INTEGER_EQUAL(0, unixstl::pipe_splice(p1.read_handle(), p2.write_handle(), 100));
+}
+
+static void test_splice_file_to_pipe()
+{
+    temp_file   tf;
+    pipe_t      p;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    write_string(tf.fd(), "file contents");
+    ::lseek(tf.fd(), 0, SEEK_SET);
+
+    XTESTS_TEST_INTEGER_EQUAL(13, unixstl::pipe_splice(tf.fd(), p.write_handle(), 100));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("file contents", read_string(p.read_handle(), 100));
+
+    XTESTS_TEST_INTEGER_EQUAL(0, unixstl::pipe_splice(tf.fd(), p.write_handle(), 100));
+}
+
+static void test_splice_all_pipe_to_file()
+{
+    temp_file   tf;
+    pipe_t      p;
+    std::string expected;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        char    sz[21];
+        int     n = ::sprintf(&sz[0], "line-%d\n", i);
+
+        expected.append(&sz[0], size_t(n));
+    }
+
+    // less than the capacity of the pipe, so it can be written before it
+    // is read
+    write_string(p.write_handle(), expected);
+    p.close_write();
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), unixstl::pipe_splice_all(p.read_handle(), tf.fd()));
+    XTESTS_TEST_BOOLEAN_TRUE(expected == tf.contents());
+}
+
+static void test_splice_would_block()
+{
+    pipe_t p1(pipe_t::nonBlocking);
+    pipe_t p2;
+
+    errno = 0;
+
+    XTESTS_TEST_INTEGER_EQUAL(-1, unixstl::pipe_splice(p1.read_handle(), p2.write_handle(), 100));
+    XTESTS_TEST_INTEGER_EQUAL(EAGAIN, errno);
+}
+
+static void test_splice_all_waits_for_output()
+{
+    // the input has data but the output is full, and does not drain for
+    // a while, which must be waited for rather than spun on
+
+    pipe_t              p1(pipe_t::nonBlocking);
+    pipe_t              p2(pipe_t::nonBlockingWrite, 4096);
+    std::string const   expected(32 * 1024, 'x');
+    std::string         received;
+
+    write_string(p1.write_handle(), expected);
+    p1.close_write();
+
+    std::thread reader([&p2, &received]() {
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        for (std::string s; !(s = read_string(p2.read_handle(), 4096)).empty(); )
+        {
+            received += s;
+        }
+    });
+
+    struct timespec t0;
+    struct timespec t1;
+
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t0);
+
+    unixstl::us_uint64_t const n = unixstl::pipe_splice_all(p1.read_handle(), p2.write_handle());
+
+    ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t1);
+
+    p2.close_write();
+    reader.join();
+
+    long const cpuMs = (t1.tv_sec - t0.tv_sec) * 1000L + (t1.tv_nsec - t0.tv_nsec) / 1000000L;
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), n);
+    XTESTS_TEST_BOOLEAN_TRUE(expected == received);
+    XTESTS_TEST_INTEGER_LESS(100L, cpuMs);
+}
+
+static void test_tee()
+{
+    pipe_t p1;
+    pipe_t p2;
+
+    write_string(p1.write_handle(), "abcdef");
+
+#if defined(UNIXSTL_OS_IS_LINUX)
+
+    XTESTS_TEST_INTEGER_EQUAL(6, unixstl::pipe_tee(p1.read_handle(), p2.write_handle(), 100));
+
+    // the data remains in the source pipe
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcdef", read_string(p2.read_handle(), 100));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcdef", read_string(p1.read_handle(), 100));
+#else /* ? UNIXSTL_OS_IS_LINUX */
+
+    try
+    {
+        unixstl::pipe_tee(p1.read_handle(), p2.write_handle(), 100);
+
+        XTESTS_TEST_FAIL("should not get here");
+    }
+    catch (unixstl::unixstl_exception& x)
+    {
+        XTESTS_TEST_INTEGER_EQUAL(ENOSYS, int(x.status_code()));
+    }
+#endif /* UNIXSTL_OS_IS_LINUX */
+}
+
+static void test_line_reader_one_source()
+{
+    pipe_t      p;
+    reader_t    reader;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, reader.add(p.read_handle()));
+    XTESTS_TEST_INTEGER_EQUAL(1u, reader.size());
+    XTESTS_TEST_INTEGER_EQUAL(1u, reader.num_open());
+
+    write_string(p.write_handle(), "first\n\nthird\nlast");
+    p.close_write();
+
+    size_t                  source = 99;
+    stlsoft::string_view    line;
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_INTEGER_EQUAL(0u, source);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("first", line);
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", line);
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("third", line);
+
+    // the final line need not be terminated
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("last", line);
+
+    XTESTS_TEST_BOOLEAN_FALSE(reader.read_line(source, line));
+    XTESTS_TEST_INTEGER_EQUAL(0u, reader.num_open());
+}
+
+static void test_line_reader_many_sources()
+{
+    pipe_t      p1;
+    pipe_t      p2;
+    pipe_t      p3;
+    reader_t    reader;
+
+    reader.add(p1.read_handle());
+    reader.add(p2.read_handle());
+    reader.add(p3.read_handle());
+
+    write_string(p1.write_handle(), "a1\na2\na3\n");
+    write_string(p2.write_handle(), "b1\nb2");
+    p1.close_write();
+    p2.close_write();
+    p3.close_write();
+
+    std::string             results[3];
+    size_t                  source;
+    stlsoft::string_view    line;
+    size_t                  numLines = 0;
+
+    for (; reader.read_line(source, line); ++numLines)
+    {
+        XTESTS_REQUIRE(XTESTS_TEST_INTEGER_LESS(3u, source));
+
+        results[source].append(line.data(), line.size());
+        results[source] += '|';
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(5u, numLines);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("a1|a2|a3|", results[0]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("b1|b2|", results[1]);
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", results[2]);
+    XTESTS_TEST_INTEGER_EQUAL(0u, reader.num_open());
+}
+
+static void test_line_reader_long_line()
+{
+    pipe_t      p;
+    reader_t    reader(16);
+
+    reader.add(p.read_handle());
+
+    std::string const long_line(1000, 'x');
+
+    write_string(p.write_handle(), "short\n" + long_line + "\nend\n");
+    p.close_write();
+
+    size_t                  source;
+    stlsoft::string_view    line;
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("short", line);
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_INTEGER_EQUAL(1000u, line.size());
+    XTESTS_TEST_BOOLEAN_TRUE(long_line == std::string(line.data(), line.size()));
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("end", line);
+
+    XTESTS_TEST_BOOLEAN_FALSE(reader.read_line(source, line));
+}
+
+static void test_line_reader_timeout()
+{
+    pipe_t      p;
+    reader_t    reader;
+
+    reader.add(p.read_handle());
+
+    size_t                  source;
+    stlsoft::string_view    line;
+
+    write_string(p.write_handle(), "partial");
+
+    XTESTS_TEST_BOOLEAN_FALSE(reader.read_line(source, line, 10));
+    XTESTS_TEST_INTEGER_EQUAL(1u, reader.num_open());
+
+    write_string(p.write_handle(), " line\n");
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line, 10));
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("partial line", line);
+}
+
+static void test_line_reader_timeout_trickle()
+{
+    // data that never completes a line arrives more often than the
+    // timeout, which must nevertheless expire on time
+
+    pipe_t      p;
+    reader_t    reader;
+
+    reader.add(p.read_handle());
+
+    std::thread writer([&p]() {
+
+        for (int i = 0; i != 20; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(25));
+
+            write_string(p.write_handle(), "x");
+        }
+    });
+
+    size_t                  source;
+    stlsoft::string_view    line;
+
+    std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+
+    bool const b = reader.read_line(source, line, 200);
+
+    std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+
+    writer.join();
+
+    long const elapsedMs = static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count());
+
+    XTESTS_TEST_BOOLEAN_FALSE(b);
+    XTESTS_TEST_INTEGER_GREATER_OR_EQUAL(200L, elapsedMs);
+    XTESTS_TEST_INTEGER_LESS(400L, elapsedMs);
+
+    write_string(p.write_handle(), "\n");
+
+    XTESTS_TEST_BOOLEAN_TRUE(reader.read_line(source, line, 10));
+    XTESTS_TEST_INTEGER_EQUAL(20u, line.size());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,539 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.filesystem.vectored_writer/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::vectored_writer`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/string/simple_string.hpp>
+#include <stlsoft/string/string_view.hpp>
+
+#include <unixstl/filesystem/vectored_writer.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <list>
+#include <iterator>
+#include <string>
+#include <vector>
+
+/* Standard C header files */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* UNIX header files */
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_write_line(void);
+    static void test_write(void);
+    static void test_string_types(void);
+    static void test_write_lines_range(void);
+    static void test_write_lines_collection(void);
+    static void test_write_lines_many(void);
+    static void test_write_lines_temporaries(void);
+    static void test_write_lines_shim_temporaries(void);
+    static void test_group_commit_staging(void);
+    static void test_group_commit_overflow(void);
+    static void test_group_commit_write_lines(void);
+    static void test_group_commit_interval(void);
+    static void test_group_commit_destructor(void);
+    static void test_bad_descriptor(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.filesystem.vectored_writer", verbosity))
+    {
+        XTESTS_RUN_CASE(test_write_line);
+        XTESTS_RUN_CASE(test_write);
+        XTESTS_RUN_CASE(test_string_types);
+        XTESTS_RUN_CASE(test_write_lines_range);
+        XTESTS_RUN_CASE(test_write_lines_collection);
+        XTESTS_RUN_CASE(test_write_lines_many);
+        XTESTS_RUN_CASE(test_write_lines_temporaries);
+        XTESTS_RUN_CASE(test_write_lines_shim_temporaries);
+        XTESTS_RUN_CASE(test_group_commit_staging);
+        XTESTS_RUN_CASE(test_group_commit_overflow);
+        XTESTS_RUN_CASE(test_group_commit_write_lines);
+        XTESTS_RUN_CASE(test_group_commit_interval);
+        XTESTS_RUN_CASE(test_group_commit_destructor);
+        XTESTS_RUN_CASE_THAT_THROWS(test_bad_descriptor, unixstl::unixstl_exception);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::vectored_writer                        writer_t;
+
+    // A temporary file, removed on destruction
+    class temp_file
+    {
+    public:
+        temp_file()
+            : m_fd(-1)
+        {
+            ::strcpy(m_path, "/tmp/test.unit.unixstl.vectored_writer.XXXXXX");
+
+            m_fd = ::mkstemp(m_path);
+        }
+        ~temp_file()
+        {
+            if (-1 != m_fd)
+            {
+                ::close(m_fd);
+                ::unlink(m_path);
+            }
+        }
+
+    public:
+        int fd() const
+        {
+            return m_fd;
+        }
+
+        std::string contents() const
+        {
+            std::string s;
+            FILE*       f = ::fopen(m_path, "rb");
+
+            if (NULL != f)
+            {
+                char    buff[4096];
+                size_t  n;
+
+                for (; 0 != (n = ::fread(&buff[0], 1, sizeof(buff), f)); )
+                {
+                    s.append(&buff[0], n);
+                }
+
+                ::fclose(f);
+            }
+
+            return s;
+        }
+
+    private:
+        char    m_path[64];
+        int     m_fd;
+
+    private:
+        temp_file(temp_file const&);
+        void operator =(temp_file const&);
+    };
+
+    // An input iterator whose elements are temporaries, each long enough
+    // to be held in allocated memory
+    class numbered_line_iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::string             value_type;
+        typedef std::ptrdiff_t          difference_type;
+        typedef std::string const*      pointer;
+        typedef std::string             reference;
+
+    public:
+        explicit numbered_line_iterator(int i)
+            : m_i(i)
+        {}
+
+    public:
+        std::string operator *() const
+        {
+            return expected(m_i);
+        }
+        numbered_line_iterator& operator ++()
+        {
+            ++m_i;
+
+            return *this;
+        }
+        bool operator !=(numbered_line_iterator const& rhs) const
+        {
+            return m_i != rhs.m_i;
+        }
+
+    public:
+        static std::string expected(int i)
+        {
+            char    sz[21];
+            int     n = ::sprintf(&sz[0], "%d", i);
+
+            return std::string(100, 'a' + char(i % 26)) + std::string(&sz[0], size_t(n));
+        }
+
+    private:
+        int m_i;
+    };
+
+
+static void test_write_line()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    {
+        writer_t w(tf.fd());
+
+        XTESTS_TEST_BOOLEAN_FALSE(w.is_group_commit());
+        XTESTS_TEST_INTEGER_EQUAL(tf.fd(), w.get());
+
+        w.write_line("abc");
+        XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\n", tf.contents());
+
+        w.write_line("");
+        w.write_line("def");
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\n\ndef\n", tf.contents());
+}
+
+static void test_write()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    {
+        writer_t w(tf.fd());
+
+        w.write("ab");
+        w.write("cd\0ef", 5);
+        w.write("", 0);
+        w.write_line("");
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL(std::string("abcd\0ef\n", 8), tf.contents());
+}
+
+static void test_string_types()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    {
+        writer_t w(tf.fd());
+
+        w.write_line(std::string("std::string"));
+        w.write_line(stlsoft::simple_string("simple_string"));
+        w.write_line(stlsoft::string_view("string_view (truncated)", 11));
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("std::string\nsimple_string\nstring_view\n", tf.contents());
+}
+
+static void test_write_lines_range()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    static char const* const lines[] =
+    {
+        "first", "", "third"
+    };
+
+    {
+        writer_t w(tf.fd());
+
+        w.write_lines(&lines[0], &lines[0] + STLSOFT_NUM_ELEMENTS(lines));
+        w.write_lines(&lines[0], &lines[0]);
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("first\n\nthird\n", tf.contents());
+}
+
+static void test_write_lines_collection()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    std::list<std::string>  lines;
+
+    lines.push_back("alpha");
+    lines.push_back("beta");
+
+    {
+        writer_t w(tf.fd());
+
+        w.write_lines(lines);
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("alpha\nbeta\n", tf.contents());
+}
+
+static void test_write_lines_many()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    // More lines than can be passed to a single writev()
+
+    std::vector<std::string>    lines;
+    std::string                 expected;
+
+    for (int i = 0; i != 5000; ++i)
+    {
+        char    sz[21];
+        int     n = ::sprintf(&sz[0], "line-%d", i);
+
+        lines.push_back(std::string(&sz[0], size_t(n)));
+        expected += lines.back();
+        expected += '\n';
+    }
+
+    {
+        writer_t w(tf.fd());
+
+        w.write_lines(lines);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(expected.size(), tf.contents().size());
+    XTESTS_TEST_BOOLEAN_TRUE(expected == tf.contents());
+}
+
+static void test_write_lines_temporaries()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    std::string expected;
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        expected += numbered_line_iterator::expected(i);
+        expected += '\n';
+    }
+
+    {
+        writer_t w(tf.fd(), 60 * 1000);
+
+        w.write_line("staged");
+        w.write_lines(numbered_line_iterator(0), numbered_line_iterator(1000));
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(7u + expected.size(), tf.contents().size());
+    XTESTS_TEST_BOOLEAN_TRUE("staged\n" + expected == tf.contents());
+}
+
+static void test_write_lines_shim_temporaries()
+{
+    temp_file tf1;
+    temp_file tf2;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf1.fd()));
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf2.fd()));
+
+    // The string access shims for struct tm yield temporary strings
+
+    std::vector<struct tm>  times;
+
+    for (int i = 0; i != 100; ++i)
+    {
+        struct tm   tm;
+
+        ::memset(&tm, 0, sizeof(tm));
+        tm.tm_year  =   100 + i;
+        tm.tm_mon   =   i % 12;
+        tm.tm_mday  =   1 + i % 28;
+        tm.tm_hour  =   i % 24;
+
+        times.push_back(tm);
+    }
+
+    {
+        writer_t w1(tf1.fd());
+        writer_t w2(tf2.fd());
+
+        w1.write_lines(times);
+
+        for (size_t i = 0; i != times.size(); ++i)
+        {
+            w2.write_line(times[i]);
+        }
+    }
+
+    XTESTS_TEST_INTEGER_NOT_EQUAL(0u, tf2.contents().size());
+    XTESTS_TEST_BOOLEAN_TRUE(tf2.contents() == tf1.contents());
+}
+
+static void test_group_commit_staging()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    writer_t w(tf.fd(), 60 * 1000);
+
+    XTESTS_TEST_BOOLEAN_TRUE(w.is_group_commit());
+
+    w.write_line("abc");
+    w.write("de");
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", tf.contents());
+
+    w.flush();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\nde", tf.contents());
+
+    w.flush();
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abc\nde", tf.contents());
+}
+
+static void test_group_commit_overflow()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    writer_t w(tf.fd(), 60 * 1000, 8);
+
+    w.write_line("ab");
+    w.write_line("cd");
+
+    XTESTS_TEST_INTEGER_EQUAL(6u, w.pending());
+
+    // does not fit, so is written with the staged data
+    w.write_line("ef");
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab\ncd\nef\n", tf.contents());
+
+    // larger than the buffer, so is written directly
+    w.write_line("0123456789");
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("ab\ncd\nef\n0123456789\n", tf.contents());
+}
+
+static void test_group_commit_write_lines()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    std::vector<std::string>    lines;
+
+    lines.push_back("b1");
+    lines.push_back("b2");
+
+    writer_t w(tf.fd(), 60 * 1000);
+
+    w.write_line("s1");
+    w.write_lines(lines);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("s1\nb1\nb2\n", tf.contents());
+}
+
+static void test_group_commit_interval()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    writer_t w(tf.fd(), 1);
+
+    w.write_line("t1");
+
+    ::usleep(20 * 1000);
+
+    // the oldest staged data has waited for longer than the interval
+    w.write_line("t2");
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, w.pending());
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("t1\nt2\n", tf.contents());
+}
+
+static void test_group_commit_destructor()
+{
+    temp_file tf;
+
+    XTESTS_REQUIRE(XTESTS_TEST_INTEGER_NOT_EQUAL(-1, tf.fd()));
+
+    {
+        writer_t w(tf.fd(), 60 * 1000);
+
+        w.write_line("pending");
+
+        XTESTS_TEST_MULTIBYTE_STRING_EQUAL("", tf.contents());
+    }
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("pending\n", tf.contents());
+}
+
+static void test_bad_descriptor()
+{
+    writer_t w(-1);
+
+    w.write_line("abc");
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
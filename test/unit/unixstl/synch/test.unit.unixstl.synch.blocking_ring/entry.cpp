@@ -0,0 +1,475 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.blocking_ring/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::blocking_ring`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/blocking_ring.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+/* UNIX header files */
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_spsc_push_pop(void);
+    static void test_mpmc_push_pop(void);
+    static void test_try_push_try_pop(void);
+    static void test_move_only(void);
+    static void test_push_n_pop_n(void);
+    static void test_push_throws(void);
+    static void test_push_n_throws(void);
+    static void test_pop_blocks(void);
+    static void test_push_blocks(void);
+    static void test_spsc_two_threads(void);
+    static void test_mpmc_many_threads(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.blocking_ring", verbosity))
+    {
+        XTESTS_RUN_CASE(test_spsc_push_pop);
+        XTESTS_RUN_CASE(test_mpmc_push_pop);
+        XTESTS_RUN_CASE(test_try_push_try_pop);
+        XTESTS_RUN_CASE(test_move_only);
+        XTESTS_RUN_CASE(test_push_n_pop_n);
+        XTESTS_RUN_CASE(test_push_throws);
+        XTESTS_RUN_CASE(test_push_n_throws);
+        XTESTS_RUN_CASE(test_pop_blocks);
+        XTESTS_RUN_CASE(test_push_blocks);
+        XTESTS_RUN_CASE(test_spsc_two_threads);
+        XTESTS_RUN_CASE(test_mpmc_many_threads);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::blocking_ring<stlsoft::spsc_ring<int, 4> > spsc_t;
+    typedef unixstl::blocking_ring<stlsoft::mpmc_ring<int> >    mpmc_t;
+
+    // An element whose copy-construction throws for negative values
+    struct throwing_copy
+    {
+        int value;
+
+        throwing_copy()
+            : value(0)
+        {}
+        throwing_copy(int v)
+            : value(v)
+        {}
+        throwing_copy(throwing_copy const& rhs)
+            : value(rhs.value)
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error("copy");
+            }
+        }
+        throwing_copy& operator =(throwing_copy const& rhs)
+        {
+            value = rhs.value;
+
+            return *this;
+        }
+    };
+
+    typedef unixstl::blocking_ring<stlsoft::spsc_ring<throwing_copy, 4> >   throwing_spsc_t;
+
+    // Verifies that the ring, when empty, accepts exactly its capacity
+    template <typename R>
+    bool has_full_capacity(R& ring)
+    {
+        throwing_copy   v;
+        bool            r = true;
+
+        for (size_t i = 0; i != ring.capacity(); ++i)
+        {
+            if (!ring.try_push(throwing_copy(1)))
+            {
+                r = false;
+            }
+        }
+
+        if (ring.try_push(throwing_copy(1)))
+        {
+            r = false;
+        }
+
+        for (; ring.try_pop(v); )
+        {}
+
+        return r;
+    }
+
+
+static void test_spsc_push_pop()
+{
+    spsc_t  ring;
+    int     v = -1;
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, ring.capacity());
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+
+    ring.push(1);
+    ring.push(2);
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+
+    ring.pop(v);
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+    ring.pop(v);
+    XTESTS_TEST_INTEGER_EQUAL(2, v);
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+
+static void test_mpmc_push_pop()
+{
+    mpmc_t  ring(3);
+    int     v = -1;
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, ring.capacity());
+
+    ring.push(10);
+    ring.push(11);
+
+    ring.pop(v);
+    XTESTS_TEST_INTEGER_EQUAL(10, v);
+    ring.pop(v);
+    XTESTS_TEST_INTEGER_EQUAL(11, v);
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+
+static void test_try_push_try_pop()
+{
+    mpmc_t  ring(2);
+    int     v = -1;
+
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(v));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(1));
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_push(2));
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(3));
+
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v);
+
+    // the blocking and non-blocking operations share the counts
+    ring.push(3);
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_push(4));
+
+    ring.pop(v);
+    XTESTS_TEST_INTEGER_EQUAL(2, v);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(3, v);
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(v));
+}
+
+static void test_move_only()
+{
+    unixstl::blocking_ring<stlsoft::mpmc_ring<std::unique_ptr<int> > >  ring(2);
+    std::unique_ptr<int>                                                p(new int(42));
+
+    ring.push(std::move(p));
+    XTESTS_TEST_POINTER_EQUAL(NULL, p.get());
+
+    ring.pop(p);
+    XTESTS_TEST_INTEGER_EQUAL(42, *p);
+}
+
+static void test_push_n_pop_n()
+{
+    mpmc_t      ring(4);
+    int const   values[] = { 1, 2, 3, 4, 5, 6 };
+    int         buff[8];
+
+    ring.push_n(values, 3);
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, ring.size());
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.pop_n(buff, 2));
+    XTESTS_TEST_INTEGER_EQUAL(1, buff[0]);
+    XTESTS_TEST_INTEGER_EQUAL(2, buff[1]);
+    XTESTS_TEST_INTEGER_EQUAL(1u, ring.pop_n(buff, 8));
+    XTESTS_TEST_INTEGER_EQUAL(3, buff[0]);
+
+    // more than the capacity, so completes only as the consumer pops
+
+    std::thread consumer([&ring]() {
+
+        int n = 0;
+        int b[3];
+
+        for (; 6 != n; )
+        {
+            n += static_cast<int>(ring.pop_n(b, STLSOFT_NUM_ELEMENTS(b)));
+        }
+    });
+
+    ring.push_n(values, STLSOFT_NUM_ELEMENTS(values));
+
+    consumer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+
+static void test_push_throws()
+{
+    throwing_spsc_t     ring;
+    throwing_copy const bad(-1);
+    bool                caught = false;
+
+    try
+    {
+        ring.push(bad);
+    }
+    catch (std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(caught);
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+
+    caught = false;
+
+    try
+    {
+        ring.try_push(bad);
+    }
+    catch (std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(caught);
+
+    // the slots taken by the failed pushes have been returned
+    XTESTS_TEST_BOOLEAN_TRUE(has_full_capacity(ring));
+}
+
+static void test_push_n_throws()
+{
+    throwing_spsc_t     ring;
+    throwing_copy const values[] = { 1, 2, -1, 4 };
+    throwing_copy       v;
+    bool                caught = false;
+
+    try
+    {
+        ring.push_n(values, STLSOFT_NUM_ELEMENTS(values));
+    }
+    catch (std::runtime_error&)
+    {
+        caught = true;
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(caught);
+
+    // the elements pushed before the failure are published ...
+    XTESTS_TEST_INTEGER_EQUAL(2u, ring.size());
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(1, v.value);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.try_pop(v));
+    XTESTS_TEST_INTEGER_EQUAL(2, v.value);
+    XTESTS_TEST_BOOLEAN_FALSE(ring.try_pop(v));
+
+    // ... and the remaining slots returned
+    XTESTS_TEST_BOOLEAN_TRUE(has_full_capacity(ring));
+}
+
+static void test_pop_blocks()
+{
+    mpmc_t              ring(2);
+    std::atomic<bool>   popped(false);
+    int                 v = -1;
+
+    std::thread consumer([&]() {
+
+        ring.pop(v);
+        popped = true;
+    });
+
+    ::usleep(20 * 1000);
+
+    XTESTS_TEST_BOOLEAN_FALSE(popped.load());
+
+    ring.push(7);
+    consumer.join();
+
+    XTESTS_TEST_BOOLEAN_TRUE(popped.load());
+    XTESTS_TEST_INTEGER_EQUAL(7, v);
+}
+
+static void test_push_blocks()
+{
+    spsc_t              ring;
+    std::atomic<bool>   pushed(false);
+    int                 v = -1;
+
+    for (int i = 0; i != 4; ++i)
+    {
+        ring.push(i);
+    }
+
+    std::thread producer([&]() {
+
+        ring.push(4);
+        pushed = true;
+    });
+
+    ::usleep(20 * 1000);
+
+    XTESTS_TEST_BOOLEAN_FALSE(pushed.load());
+
+    ring.pop(v);
+    producer.join();
+
+    XTESTS_TEST_BOOLEAN_TRUE(pushed.load());
+    XTESTS_TEST_INTEGER_EQUAL(0, v);
+    XTESTS_TEST_INTEGER_EQUAL(4u, ring.size());
+}
+
+static void test_spsc_two_threads()
+{
+    spsc_t      ring;
+    int const   N = 100000;
+    long        sum = 0;
+    int         numOutOfOrder = 0;
+
+    std::thread consumer([&]() {
+
+        for (int i = 0; i != N; ++i)
+        {
+            int v;
+
+            ring.pop(v);
+
+            if (v != i)
+            {
+                ++numOutOfOrder;
+            }
+            sum += v;
+        }
+    });
+
+    for (int i = 0; i != N; ++i)
+    {
+        ring.push(i);
+    }
+
+    consumer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0, numOutOfOrder);
+    XTESTS_TEST_INTEGER_EQUAL(long(N) * (N - 1) / 2, sum);
+}
+
+static void test_mpmc_many_threads()
+{
+    mpmc_t                      ring(16);
+    int const                   numProducers = 3;
+    int const                   numConsumers = 3;
+    int const                   N = 20000;
+    std::atomic<long>           sum(0);
+    std::vector<std::thread>    threads;
+
+    for (int p = 0; p != numProducers; ++p)
+    {
+        threads.push_back(std::thread([&ring]() {
+
+            for (int i = 0; i != N; ++i)
+            {
+                ring.push(i);
+            }
+        }));
+    }
+    for (int c = 0; c != numConsumers; ++c)
+    {
+        threads.push_back(std::thread([&ring, &sum]() {
+
+            long s = 0;
+
+            for (int i = 0; i != N; ++i)
+            {
+                int v;
+
+                ring.pop(v);
+                s += v;
+            }
+
+            sum += s;
+        }));
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(numProducers * (long(N) * (N - 1) / 2), sum.load());
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
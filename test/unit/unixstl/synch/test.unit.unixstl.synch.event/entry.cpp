@@ -0,0 +1,319 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.event/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::auto_reset_event` and
+ *          `unixstl::manual_reset_event`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/event.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/synch/lock_scope.hpp>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+/* UNIX header files */
+#include <unistd.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_auto_initial_state(void);
+    static void test_auto_set_reset(void);
+    static void test_auto_set_is_idempotent(void);
+    static void test_auto_lock_scope(void);
+    static void test_auto_releases_one(void);
+    static void test_auto_ping_pong(void);
+    static void test_manual_initial_state(void);
+    static void test_manual_set_reset(void);
+    static void test_manual_lock_scope(void);
+    static void test_manual_releases_all(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.event", verbosity))
+    {
+        XTESTS_RUN_CASE(test_auto_initial_state);
+        XTESTS_RUN_CASE(test_auto_set_reset);
+        XTESTS_RUN_CASE(test_auto_set_is_idempotent);
+        XTESTS_RUN_CASE(test_auto_lock_scope);
+        XTESTS_RUN_CASE(test_auto_releases_one);
+        XTESTS_RUN_CASE(test_auto_ping_pong);
+        XTESTS_RUN_CASE(test_manual_initial_state);
+        XTESTS_RUN_CASE(test_manual_set_reset);
+        XTESTS_RUN_CASE(test_manual_lock_scope);
+        XTESTS_RUN_CASE(test_manual_releases_all);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::auto_reset_event                       auto_event_t;
+    typedef unixstl::manual_reset_event                     manual_event_t;
+
+
+static void test_auto_initial_state()
+{
+    auto_event_t    ev0;
+    auto_event_t    ev1(true);
+
+    XTESTS_TEST_BOOLEAN_FALSE(ev0.try_wait());
+    XTESTS_TEST_BOOLEAN_TRUE(ev1.try_wait());
+
+    // reset by the successful wait
+    XTESTS_TEST_BOOLEAN_FALSE(ev1.try_wait());
+}
+
+static void test_auto_set_reset()
+{
+    auto_event_t ev;
+
+    ev.set();
+    ev.reset();
+
+    XTESTS_TEST_BOOLEAN_FALSE(ev.try_wait());
+
+    ev.set();
+    ev.wait();
+
+    XTESTS_TEST_BOOLEAN_FALSE(ev.try_wait());
+}
+
+static void test_auto_set_is_idempotent()
+{
+    auto_event_t ev;
+
+    ev.set();
+    ev.set();
+
+    XTESTS_TEST_BOOLEAN_TRUE(ev.try_wait());
+    XTESTS_TEST_BOOLEAN_FALSE(ev.try_wait());
+}
+
+static void test_auto_lock_scope()
+{
+    auto_event_t ev(true);
+
+    {
+        stlsoft::lock_scope<auto_event_t> scope(ev);
+
+        XTESTS_TEST_BOOLEAN_FALSE(ev.try_wait());
+    }
+
+    // set on leaving the scope
+    XTESTS_TEST_BOOLEAN_TRUE(ev.try_wait());
+
+    ev.set();
+
+    {
+        stlsoft::lock_scope<auto_event_t, unixstl::auto_reset_event_lock_traits> scope(ev);
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(ev.try_wait());
+}
+
+static void test_auto_releases_one()
+{
+    auto_event_t                ev;
+    std::atomic<int>            released(0);
+    std::vector<std::thread>    threads;
+
+    for (int t = 0; t != 3; ++t)
+    {
+        threads.push_back(std::thread([&]() {
+
+            ev.wait();
+
+            released.fetch_add(1);
+        }));
+    }
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        ev.set();
+
+        for (; released.load() < i; )
+        {
+            ::usleep(1000);
+        }
+
+        // give any wrongly-released thread the chance to be counted
+        ::usleep(5000);
+
+        XTESTS_TEST_INTEGER_EQUAL(i, released.load());
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+}
+
+static void test_auto_ping_pong()
+{
+    auto_event_t    ping;
+    auto_event_t    pong;
+    int const       N = 10000;
+    int             value = 0;
+
+    std::thread t([&]() {
+
+        for (int i = 0; i != N; ++i)
+        {
+            ping.wait();
+            ++value;
+            pong.set();
+        }
+    });
+
+    for (int i = 0; i != N; ++i)
+    {
+        ping.set();
+        pong.wait();
+    }
+
+    t.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(N, value);
+}
+
+static void test_manual_initial_state()
+{
+    manual_event_t  ev0;
+    manual_event_t  ev1(true);
+
+    XTESTS_TEST_BOOLEAN_FALSE(ev0.is_set());
+    XTESTS_TEST_BOOLEAN_FALSE(ev0.try_wait());
+    XTESTS_TEST_BOOLEAN_TRUE(ev1.is_set());
+    XTESTS_TEST_BOOLEAN_TRUE(ev1.try_wait());
+
+    // not reset by a successful wait
+    XTESTS_TEST_BOOLEAN_TRUE(ev1.try_wait());
+}
+
+static void test_manual_set_reset()
+{
+    manual_event_t ev;
+
+    ev.set();
+
+    XTESTS_TEST_BOOLEAN_TRUE(ev.is_set());
+
+    ev.wait();
+    ev.wait();
+
+    ev.reset();
+
+    XTESTS_TEST_BOOLEAN_FALSE(ev.is_set());
+}
+
+static void test_manual_lock_scope()
+{
+    manual_event_t ev(true);
+
+    {
+        stlsoft::lock_scope<manual_event_t> scope(ev);
+
+        XTESTS_TEST_BOOLEAN_TRUE(ev.is_set());
+    }
+
+    {
+        stlsoft::lock_scope<manual_event_t, unixstl::manual_reset_event_lock_traits> scope(ev);
+
+        ev.reset();
+    }
+
+    // set on leaving the scope
+    XTESTS_TEST_BOOLEAN_TRUE(ev.is_set());
+}
+
+static void test_manual_releases_all()
+{
+    manual_event_t              ev;
+    std::atomic<int>            released(0);
+    std::vector<std::thread>    threads;
+
+    for (int t = 0; t != 8; ++t)
+    {
+        threads.push_back(std::thread([&]() {
+
+            ev.wait();
+
+            released.fetch_add(1);
+        }));
+    }
+
+    ::usleep(10000);
+
+    XTESTS_TEST_INTEGER_EQUAL(0, released.load());
+
+    ev.set();
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(8, released.load());
+    XTESTS_TEST_BOOLEAN_TRUE(ev.is_set());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,307 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.fast_semaphore/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::fast_semaphore`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/fast_semaphore.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/synch/lock_scope.hpp>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_initial_count(void);
+    static void test_try_lock(void);
+    static void test_try_lock_n(void);
+    static void test_lock_unlock(void);
+    static void test_lock_scope(void);
+    static void test_lock_traits(void);
+    static void test_no_spin(void);
+    static void test_ping_pong(void);
+    static void test_producer_consumer(void);
+    static void test_bounded_concurrency(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.fast_semaphore", verbosity))
+    {
+        XTESTS_RUN_CASE(test_initial_count);
+        XTESTS_RUN_CASE(test_try_lock);
+        XTESTS_RUN_CASE(test_try_lock_n);
+        XTESTS_RUN_CASE(test_lock_unlock);
+        XTESTS_RUN_CASE(test_lock_scope);
+        XTESTS_RUN_CASE(test_lock_traits);
+        XTESTS_RUN_CASE(test_no_spin);
+        XTESTS_RUN_CASE(test_ping_pong);
+        XTESTS_RUN_CASE(test_producer_consumer);
+        XTESTS_RUN_CASE(test_bounded_concurrency);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::fast_semaphore                         semaphore_t;
+
+
+static void test_initial_count()
+{
+    semaphore_t sem0(0);
+    semaphore_t sem3(3);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem0.count());
+    XTESTS_TEST_INTEGER_EQUAL(3u, sem3.count());
+}
+
+static void test_try_lock()
+{
+    semaphore_t sem(2);
+
+    XTESTS_TEST_BOOLEAN_TRUE(sem.try_lock());
+    XTESTS_TEST_BOOLEAN_TRUE(sem.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(sem.try_lock());
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+
+    sem.unlock();
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, sem.count());
+    XTESTS_TEST_BOOLEAN_TRUE(sem.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(sem.try_lock());
+}
+
+static void test_try_lock_n()
+{
+    semaphore_t sem(5);
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.try_lock_n(0));
+    XTESTS_TEST_INTEGER_EQUAL(3u, sem.try_lock_n(3));
+    XTESTS_TEST_INTEGER_EQUAL(2u, sem.try_lock_n(3));
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.try_lock_n(3));
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+
+    sem.unlock_n(4);
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, sem.count());
+    XTESTS_TEST_BOOLEAN_TRUE(sem.try_lock());
+    XTESTS_TEST_INTEGER_EQUAL(3u, sem.try_lock_n(10));
+}
+
+static void test_lock_unlock()
+{
+    semaphore_t sem(1);
+
+    sem.lock();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+
+    sem.unlock();
+    sem.unlock();
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, sem.count());
+}
+
+static void test_lock_scope()
+{
+    semaphore_t sem(1);
+
+    {
+        stlsoft::lock_scope<semaphore_t> scope(sem);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, sem.count());
+}
+
+static void test_lock_traits()
+{
+    semaphore_t sem(1);
+
+    {
+        stlsoft::lock_scope<semaphore_t, unixstl::fast_semaphore_lock_traits> scope(sem);
+
+        XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(1u, sem.count());
+}
+
+static void test_no_spin()
+{
+    semaphore_t sem(0, 0);
+    std::thread t([&sem]() {
+
+        sem.unlock();
+    });
+
+    sem.lock();
+
+    t.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, sem.count());
+}
+
+static void test_ping_pong()
+{
+    semaphore_t ping(0);
+    semaphore_t pong(0);
+    int const   N = 10000;
+    int         value = 0;
+
+    std::thread t([&]() {
+
+        for (int i = 0; i != N; ++i)
+        {
+            ping.lock();
+            ++value;
+            pong.unlock();
+        }
+    });
+
+    for (int i = 0; i != N; ++i)
+    {
+        ping.unlock();
+        pong.lock();
+    }
+
+    t.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(N, value);
+}
+
+static void test_producer_consumer()
+{
+    semaphore_t         items(0);
+    std::atomic<int>    consumed(0);
+    int const           numConsumers = 4;
+    int const           numItems = 20000;
+    std::vector<std::thread> consumers;
+
+    for (int c = 0; c != numConsumers; ++c)
+    {
+        consumers.push_back(std::thread([&]() {
+
+            for (;;)
+            {
+                items.lock();
+
+                if (consumed.fetch_add(1) >= numItems)
+                {
+                    // the extra items released to stop the consumers
+                    break;
+                }
+            }
+        }));
+    }
+
+    for (int i = 0; i != numItems + numConsumers; ++i)
+    {
+        items.unlock();
+    }
+
+    for (int c = 0; c != numConsumers; ++c)
+    {
+        consumers[c].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(numItems + numConsumers, consumed.load());
+    XTESTS_TEST_INTEGER_EQUAL(0u, items.count());
+}
+
+static void test_bounded_concurrency()
+{
+    semaphore_t         sem(2);
+    std::atomic<int>    inside(0);
+    std::atomic<int>    maxInside(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t != 6; ++t)
+    {
+        threads.push_back(std::thread([&]() {
+
+            for (int i = 0; i != 2000; ++i)
+            {
+                stlsoft::lock_scope<semaphore_t> scope(sem);
+
+                int const n = 1 + inside.fetch_add(1);
+                int       m = maxInside.load();
+
+                for (; n > m && !maxInside.compare_exchange_weak(m, n); )
+                {}
+
+                inside.fetch_sub(1);
+            }
+        }));
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_LESS_OR_EQUAL(2, maxInside.load());
+    XTESTS_TEST_INTEGER_EQUAL(2u, sem.count());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
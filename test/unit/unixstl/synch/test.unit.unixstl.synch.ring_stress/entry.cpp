@@ -0,0 +1,463 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.ring_stress/entry.cpp
+ *
+ * Purpose: Stress-tests for `stlsoft::spsc_ring`, `stlsoft::mpmc_ring`
+ *          and `unixstl::blocking_ring`, with small capacities, batches
+ *          and several producer and consumer threads, for running under
+ *          ThreadSanitizer.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <stlsoft/synch/mpmc_ring.hpp>
+#include <stlsoft/synch/spsc_ring.hpp>
+#include <unixstl/synch/blocking_ring.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_spsc(void);
+    static void test_spsc_strings(void);
+    static void test_mpmc_1_4(void);
+    static void test_mpmc_4_1(void);
+    static void test_mpmc_4_4(void);
+    static void test_blocking_spsc(void);
+    static void test_blocking_mpmc(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.ring_stress", verbosity))
+    {
+        XTESTS_RUN_CASE(test_spsc);
+        XTESTS_RUN_CASE(test_spsc_strings);
+        XTESTS_RUN_CASE(test_mpmc_1_4);
+        XTESTS_RUN_CASE(test_mpmc_4_1);
+        XTESTS_RUN_CASE(test_mpmc_4_4);
+        XTESTS_RUN_CASE(test_blocking_spsc);
+        XTESTS_RUN_CASE(test_blocking_mpmc);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    unsigned const  NUM_ITEMS   =   50000;
+
+    // Records, for each of numProducers * NUM_ITEMS values, how many times
+    // it was popped
+    class tally
+    {
+    public:
+        explicit tally(unsigned numProducers)
+            : m_seen(numProducers * NUM_ITEMS)
+            , m_numPopped(0)
+        {}
+
+    public:
+        void record(unsigned const* values, size_t n)
+        {
+            for (size_t i = 0; i != n; ++i)
+            {
+                ++m_seen[values[i]];
+            }
+
+            m_numPopped += static_cast<unsigned>(n);
+        }
+
+        bool done() const
+        {
+            return m_seen.size() == m_numPopped.load();
+        }
+
+        size_t num_wrong() const
+        {
+            size_t n = 0;
+
+            for (size_t i = 0; i != m_seen.size(); ++i)
+            {
+                if (1 != m_seen[i].load())
+                {
+                    ++n;
+                }
+            }
+
+            return n;
+        }
+
+    private:
+        std::vector<std::atomic<int> >  m_seen;
+        std::atomic<unsigned>           m_numPopped;
+    };
+
+    // Runs numProducers threads, each pushing its NUM_ITEMS values singly
+    // and in batches of varying size, and numConsumers threads popping
+    // singly and in batches, into and from an mpmc_ring of the given
+    // capacity
+    static
+    size_t
+    run_mpmc(
+        size_t  capacity
+    ,   int     numProducers
+    ,   int     numConsumers
+    )
+    {
+        stlsoft::mpmc_ring<unsigned>    ring(capacity);
+        tally                           t(numProducers);
+        std::vector<std::thread>        threads;
+
+        for (int p = 0; p != numProducers; ++p)
+        {
+            threads.push_back(std::thread([&ring, p]() {
+
+                unsigned const  base = p * NUM_ITEMS;
+                unsigned        batch[7];
+
+                for (unsigned i = 0; i != NUM_ITEMS; )
+                {
+                    size_t const    want    =   1 + (i % STLSOFT_NUM_ELEMENTS(batch));
+                    size_t const    n       =   (NUM_ITEMS - i < want) ? (NUM_ITEMS - i) : want;
+                    size_t          pushed;
+
+                    for (size_t j = 0; j != n; ++j)
+                    {
+                        batch[j] = base + i + static_cast<unsigned>(j);
+                    }
+
+                    if (1 == n)
+                    {
+                        pushed = ring.try_push(batch[0]) ? 1 : 0;
+                    }
+                    else
+                    {
+                        pushed = ring.try_push_n(batch, n);
+                    }
+
+                    if (0 == pushed)
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    i += static_cast<unsigned>(pushed);
+                }
+            }));
+        }
+        for (int c = 0; c != numConsumers; ++c)
+        {
+            threads.push_back(std::thread([&ring, &t, c]() {
+
+                unsigned buff[5];
+
+                for (unsigned k = 0; !t.done(); ++k)
+                {
+                    size_t n;
+
+                    if (0 == (c + k) % 2)
+                    {
+                        n = ring.try_pop(buff[0]) ? 1 : 0;
+                    }
+                    else
+                    {
+                        n = ring.try_pop_n(buff, 1 + k % STLSOFT_NUM_ELEMENTS(buff));
+                    }
+
+                    if (0 == n)
+                    {
+                        std::this_thread::yield();
+                    }
+                    else
+                    {
+                        t.record(buff, n);
+                    }
+                }
+            }));
+        }
+
+        for (size_t i = 0; i != threads.size(); ++i)
+        {
+            threads[i].join();
+        }
+
+        XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+
+        return t.num_wrong();
+    }
+
+
+static void test_spsc()
+{
+    stlsoft::spsc_ring<unsigned, 2> ring;
+    unsigned                        numOutOfOrder = 0;
+
+    std::thread consumer([&ring, &numOutOfOrder]() {
+
+        unsigned buff[3];
+
+        for (unsigned expected = 0, k = 0; NUM_ITEMS != expected; ++k)
+        {
+            size_t const n = (0 == k % 2) ? (ring.try_pop(buff[0]) ? 1 : 0) : ring.try_pop_n(buff, 3);
+
+            for (size_t i = 0; i != n; ++i, ++expected)
+            {
+                if (buff[i] != expected)
+                {
+                    ++numOutOfOrder;
+                }
+            }
+
+            if (0 == n)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    unsigned batch[3];
+
+    for (unsigned i = 0; i != NUM_ITEMS; )
+    {
+        size_t n = (NUM_ITEMS - i < 3) ? (NUM_ITEMS - i) : 3;
+
+        for (size_t j = 0; j != n; ++j)
+        {
+            batch[j] = i + static_cast<unsigned>(j);
+        }
+
+        n = (0 == i % 2) ? (ring.try_push(batch[0]) ? 1 : 0) : ring.try_push_n(batch, n);
+
+        if (0 == n)
+        {
+            std::this_thread::yield();
+        }
+
+        i += static_cast<unsigned>(n);
+    }
+
+    consumer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numOutOfOrder);
+    XTESTS_TEST_BOOLEAN_TRUE(ring.empty());
+}
+
+static void test_spsc_strings()
+{
+    // A non-trivial element type, so that the construction and
+    // destruction of elements in the slots is also checked
+
+    stlsoft::spsc_ring<std::string, 4>  ring;
+    unsigned                            numWrong = 0;
+
+    std::thread consumer([&ring, &numWrong]() {
+
+        std::string s;
+
+        for (unsigned i = 0; i != NUM_ITEMS; )
+        {
+            if (ring.try_pop(s))
+            {
+                if (std::to_string(i) + std::string(64, '.') != s)
+                {
+                    ++numWrong;
+                }
+                ++i;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (unsigned i = 0; i != NUM_ITEMS; )
+    {
+        if (ring.try_push(std::to_string(i) + std::string(64, '.')))
+        {
+            ++i;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numWrong);
+}
+
+static void test_mpmc_1_4()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(2, 1, 4));
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(16, 1, 4));
+}
+
+static void test_mpmc_4_1()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(2, 4, 1));
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(16, 4, 1));
+}
+
+static void test_mpmc_4_4()
+{
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(2, 4, 4));
+    XTESTS_TEST_INTEGER_EQUAL(0u, run_mpmc(16, 4, 4));
+}
+
+static void test_blocking_spsc()
+{
+    unixstl::blocking_ring<stlsoft::spsc_ring<unsigned, 2> >    ring;
+    unsigned                                                    numOutOfOrder = 0;
+
+    std::thread consumer([&ring, &numOutOfOrder]() {
+
+        unsigned buff[3];
+
+        for (unsigned expected = 0; NUM_ITEMS != expected; )
+        {
+            size_t const n = ring.pop_n(buff, 1 + expected % 3);
+
+            for (size_t i = 0; i != n; ++i, ++expected)
+            {
+                if (buff[i] != expected)
+                {
+                    ++numOutOfOrder;
+                }
+            }
+        }
+    });
+
+    for (unsigned i = 0; i != NUM_ITEMS; ++i)
+    {
+        ring.push(i);
+    }
+
+    consumer.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, numOutOfOrder);
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+
+static void test_blocking_mpmc()
+{
+    unixstl::blocking_ring<stlsoft::mpmc_ring<unsigned> >   ring(4);
+    int const                                               numProducers = 4;
+    int const                                               numConsumers = 4;
+    tally                                                   t(numProducers);
+    std::vector<std::thread>                                threads;
+
+    for (int p = 0; p != numProducers; ++p)
+    {
+        threads.push_back(std::thread([&ring, p]() {
+
+            unsigned const  base = p * NUM_ITEMS;
+            unsigned        batch[5];
+
+            for (unsigned i = 0; i != NUM_ITEMS; )
+            {
+                if (0 == p % 2)
+                {
+                    ring.push(base + i);
+                    ++i;
+                }
+                else
+                {
+                    size_t const n = (NUM_ITEMS - i < 5) ? (NUM_ITEMS - i) : 5;
+
+                    for (size_t j = 0; j != n; ++j)
+                    {
+                        batch[j] = base + i + static_cast<unsigned>(j);
+                    }
+
+                    ring.push_n(batch, n);
+                    i += static_cast<unsigned>(n);
+                }
+            }
+        }));
+    }
+    for (int c = 0; c != numConsumers; ++c)
+    {
+        threads.push_back(std::thread([&ring, &t]() {
+
+            unsigned buff[3];
+
+            // each consumer pops its share, which the producers' total
+            // divides exactly
+            for (unsigned n = 0; NUM_ITEMS != n; )
+            {
+                size_t const m = ring.pop_n(buff, (NUM_ITEMS - n < 3) ? (NUM_ITEMS - n) : 3);
+
+                t.record(buff, m);
+                n += static_cast<unsigned>(m);
+            }
+        }));
+    }
+
+    for (size_t i = 0; i != threads.size(); ++i)
+    {
+        threads[i].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, t.num_wrong());
+    XTESTS_TEST_INTEGER_EQUAL(0u, ring.size());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
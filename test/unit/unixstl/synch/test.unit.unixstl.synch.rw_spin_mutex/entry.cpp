@@ -0,0 +1,322 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.rw_spin_mutex/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::rw_spin_mutex`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/rw_spin_mutex.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/synch/lock_scope.hpp>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_try_lock(void);
+    static void test_try_lock_shared(void);
+    static void test_many_readers(void);
+    static void test_lock_scope(void);
+    static void test_shared_lock_scope(void);
+    static void test_lock_traits(void);
+    static void test_writer_preference(void);
+    static void test_no_spin(void);
+    static void test_readers_and_writers(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.rw_spin_mutex", verbosity))
+    {
+        XTESTS_RUN_CASE(test_try_lock);
+        XTESTS_RUN_CASE(test_try_lock_shared);
+        XTESTS_RUN_CASE(test_many_readers);
+        XTESTS_RUN_CASE(test_lock_scope);
+        XTESTS_RUN_CASE(test_shared_lock_scope);
+        XTESTS_RUN_CASE(test_lock_traits);
+        XTESTS_RUN_CASE(test_writer_preference);
+        XTESTS_RUN_CASE(test_no_spin);
+        XTESTS_RUN_CASE(test_readers_and_writers);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::rw_spin_mutex                          mutex_t;
+
+
+static void test_try_lock()
+{
+    mutex_t mx;
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+
+    mx.unlock();
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_try_lock_shared()
+{
+    mutex_t mx;
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+    XTESTS_TEST_INTEGER_EQUAL(1u, mx.num_readers());
+    XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+
+    // a failed try_lock() must not leave the mutex claimed
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+    XTESTS_TEST_INTEGER_EQUAL(2u, mx.num_readers());
+
+    mx.unlock_shared();
+    mx.unlock_shared();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, mx.num_readers());
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_many_readers()
+{
+    mutex_t     mx;
+    int const   N = 100;
+
+    for (int i = 0; i != N; ++i)
+    {
+        mx.lock_shared();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(unsigned(N), mx.num_readers());
+
+    for (int i = 0; i != N; ++i)
+    {
+        mx.unlock_shared();
+    }
+
+    mx.lock();
+    mx.unlock();
+}
+
+static void test_lock_scope()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t> scope(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_shared_lock_scope()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope1(mx);
+        stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope2(mx);
+
+        XTESTS_TEST_INTEGER_EQUAL(2u, mx.num_readers());
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, mx.num_readers());
+}
+
+static void test_lock_traits()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t, unixstl::rw_spin_mutex_shared_lock_traits> scope(mx);
+
+        XTESTS_TEST_INTEGER_EQUAL(1u, mx.num_readers());
+    }
+    {
+        stlsoft::lock_scope<mutex_t, unixstl::rw_spin_mutex_lock_traits> scope(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+
+    mx.unlock_shared();
+}
+
+static void test_writer_preference()
+{
+    mutex_t             mx;
+    std::atomic<bool>   acquired(false);
+
+    mx.lock_shared();
+
+    std::thread writer([&]() {
+
+        mx.lock();
+        acquired = true;
+        mx.unlock();
+    });
+
+    // Once the writer has claimed the mutex, new readers are refused,
+    // although the existing reader still holds it
+    for (; mx.try_lock_shared(); )
+    {
+        mx.unlock_shared();
+
+        std::this_thread::yield();
+    }
+
+    XTESTS_TEST_BOOLEAN_FALSE(acquired.load());
+
+    mx.unlock_shared();
+
+    writer.join();
+
+    XTESTS_TEST_BOOLEAN_TRUE(acquired.load());
+    XTESTS_TEST_INTEGER_EQUAL(0u, mx.num_readers());
+}
+
+static void test_no_spin()
+{
+    mutex_t     mx(0);
+    int         value = 0;
+
+    mx.lock();
+
+    std::thread t([&]() {
+
+        stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope(mx);
+
+        value += 1;
+    });
+
+    value = 1;
+
+    mx.unlock();
+
+    t.join();
+
+    XTESTS_TEST_INTEGER_EQUAL(2, value);
+}
+
+static void test_readers_and_writers()
+{
+    // Writers keep the two halves of the pair equal; readers must never
+    // observe them unequal
+
+    mutex_t                     mx;
+    unsigned                    pair[2] = { 0, 0 };
+    std::atomic<int>            numTorn(0);
+    int const                   numReaders = 4;
+    int const                   numWriters = 2;
+    int const                   N = 5000;
+    std::vector<std::thread>    threads;
+
+    for (int r = 0; r != numReaders; ++r)
+    {
+        threads.push_back(std::thread([&]() {
+
+            for (int i = 0; i != N; ++i)
+            {
+                stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope(mx);
+
+                if (pair[0] != pair[1])
+                {
+                    ++numTorn;
+                }
+            }
+        }));
+    }
+    for (int w = 0; w != numWriters; ++w)
+    {
+        threads.push_back(std::thread([&]() {
+
+            for (int i = 0; i != N; ++i)
+            {
+                stlsoft::lock_scope<mutex_t> scope(mx);
+
+                ++pair[0];
+                ++pair[1];
+            }
+        }));
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0, numTorn.load());
+    XTESTS_TEST_INTEGER_EQUAL(unsigned(numWriters * N), pair[0]);
+    XTESTS_TEST_INTEGER_EQUAL(unsigned(numWriters * N), pair[1]);
+    XTESTS_TEST_INTEGER_EQUAL(0u, mx.num_readers());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
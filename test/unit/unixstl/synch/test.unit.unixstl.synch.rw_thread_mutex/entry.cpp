@@ -0,0 +1,295 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.rw_thread_mutex/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::rw_thread_mutex`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/rw_thread_mutex.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/synch/lock_scope.hpp>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_try_lock(void);
+    static void test_try_lock_shared(void);
+    static void test_handle(void);
+    static void test_lock_scope(void);
+    static void test_shared_lock_scope(void);
+    static void test_lock_traits(void);
+    static void test_prefer_writers(void);
+    static void test_readers_and_writers(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.rw_thread_mutex", verbosity))
+    {
+        XTESTS_RUN_CASE(test_try_lock);
+        XTESTS_RUN_CASE(test_try_lock_shared);
+        XTESTS_RUN_CASE(test_handle);
+        XTESTS_RUN_CASE(test_lock_scope);
+        XTESTS_RUN_CASE(test_shared_lock_scope);
+        XTESTS_RUN_CASE(test_lock_traits);
+        XTESTS_RUN_CASE(test_prefer_writers);
+        XTESTS_RUN_CASE(test_readers_and_writers);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    typedef unixstl::rw_thread_mutex                        mutex_t;
+
+
+static void test_try_lock()
+{
+    mutex_t mx;
+
+    XTESTS_TEST_INTEGER_EQUAL(0, mx.get_error());
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+
+    mx.unlock();
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_try_lock_shared()
+{
+    mutex_t mx;
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+    XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+
+    mx.unlock_shared();
+    mx.unlock_shared();
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_handle()
+{
+    pthread_rwlock_t rw = PTHREAD_RWLOCK_INITIALIZER;
+
+    {
+        mutex_t mx(&rw, false);
+
+        XTESTS_TEST_POINTER_EQUAL(&rw, mx.get());
+        XTESTS_TEST_POINTER_EQUAL(&rw, mx.handle());
+
+        mx.lock_shared();
+    }
+
+    // the lock was not destroyed, and is still held for reading
+    XTESTS_TEST_INTEGER_EQUAL(0, ::pthread_rwlock_tryrdlock(&rw));
+    XTESTS_TEST_INTEGER_NOT_EQUAL(0, ::pthread_rwlock_trywrlock(&rw));
+
+    ::pthread_rwlock_unlock(&rw);
+    ::pthread_rwlock_unlock(&rw);
+    ::pthread_rwlock_destroy(&rw);
+}
+
+static void test_lock_scope()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t> scope(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_shared_lock_scope()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope1(mx);
+        stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope2(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock());
+
+    mx.unlock();
+}
+
+static void test_lock_traits()
+{
+    mutex_t mx;
+
+    {
+        stlsoft::lock_scope<mutex_t, unixstl::rw_thread_mutex_shared_lock_traits> scope(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock());
+    }
+    {
+        stlsoft::lock_scope<mutex_t, unixstl::rw_thread_mutex_lock_traits> scope(mx);
+
+        XTESTS_TEST_BOOLEAN_FALSE(mx.try_lock_shared());
+    }
+
+    XTESTS_TEST_BOOLEAN_TRUE(mx.try_lock_shared());
+
+    mx.unlock_shared();
+}
+
+static void test_prefer_writers()
+{
+    mutex_t             mx(true);
+    std::atomic<bool>   acquired(false);
+
+    mx.lock_shared();
+
+    std::thread writer([&]() {
+
+        mx.lock();
+        acquired = true;
+        mx.unlock();
+    });
+
+#if defined(__GLIBC__)
+
+    // Once the writer is waiting, new readers are refused, although the
+    // existing reader still holds the lock
+    for (; mx.try_lock_shared(); )
+    {
+        mx.unlock_shared();
+
+        std::this_thread::yield();
+    }
+#endif /* __GLIBC__ */
+
+    XTESTS_TEST_BOOLEAN_FALSE(acquired.load());
+
+    mx.unlock_shared();
+
+    writer.join();
+
+    XTESTS_TEST_BOOLEAN_TRUE(acquired.load());
+}
+
+static void test_readers_and_writers()
+{
+    // Writers keep the two halves of the pair equal; readers must never
+    // observe them unequal
+
+    mutex_t                     mx;
+    unsigned                    pair[2] = { 0, 0 };
+    std::atomic<int>            numTorn(0);
+    int const                   numReaders = 4;
+    int const                   numWriters = 2;
+    int const                   N = 5000;
+    std::vector<std::thread>    threads;
+
+    for (int r = 0; r != numReaders; ++r)
+    {
+        threads.push_back(std::thread([&]() {
+
+            for (int i = 0; i != N; ++i)
+            {
+                stlsoft::lock_scope<mutex_t, stlsoft::shared_lock_traits<mutex_t> > scope(mx);
+
+                if (pair[0] != pair[1])
+                {
+                    ++numTorn;
+                }
+            }
+        }));
+    }
+    for (int w = 0; w != numWriters; ++w)
+    {
+        threads.push_back(std::thread([&]() {
+
+            for (int i = 0; i != N; ++i)
+            {
+                stlsoft::lock_scope<mutex_t> scope(mx);
+
+                ++pair[0];
+                ++pair[1];
+            }
+        }));
+    }
+
+    for (size_t t = 0; t != threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0, numTorn.load());
+    XTESTS_TEST_INTEGER_EQUAL(unsigned(numWriters * N), pair[0]);
+    XTESTS_TEST_INTEGER_EQUAL(unsigned(numWriters * N), pair[1]);
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */
@@ -0,0 +1,313 @@
+/* /////////////////////////////////////////////////////////////////////////
+ * File:    test.unit.unixstl.synch.seqlock/entry.cpp
+ *
+ * Purpose: Unit-tests for `unixstl::seqlock`.
+ *
+ * Created: 19th October 2026
+ * Updated: 19th October 2026
+ *
+ * ////////////////////////////////////////////////////////////////////// */
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * includes
+ */
+
+/* ///////////////////////////////////////////////
+ * test component header file include(s)
+ */
+
+#include <unixstl/synch/seqlock.hpp>
+
+/* ///////////////////////////////////////////////
+ * general includes
+ */
+
+/* xTests header files */
+#include <xtests/xtests.h>
+
+/* STLSoft header files */
+#include <stlsoft/stlsoft.h>
+#include <stlsoft/synch/lock_scope.hpp>
+
+/* Standard C++ header files */
+#include <atomic>
+#include <thread>
+#include <vector>
+
+/* Standard C header files */
+#include <stdlib.h>
+#include <string.h>
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * forward declarations
+ */
+
+namespace
+{
+
+    static void test_initial_value(void);
+    static void test_store_load(void);
+    static void test_sequence(void);
+    static void test_odd_size(void);
+    static void test_try_load_during_write(void);
+    static void test_lock_scope(void);
+    static void test_lock_traits(void);
+    static void test_readers_and_writers(void);
+
+} // anonymous namespace
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * main()
+ */
+
+int main(int argc, char **argv)
+{
+    int retCode = EXIT_SUCCESS;
+    int verbosity = 2;
+
+    XTESTS_COMMANDLINE_PARSEVERBOSITY(argc, argv, &verbosity);
+
+    if (XTESTS_START_RUNNER("test.unit.unixstl.synch.seqlock", verbosity))
+    {
+        XTESTS_RUN_CASE(test_initial_value);
+        XTESTS_RUN_CASE(test_store_load);
+        XTESTS_RUN_CASE(test_sequence);
+        XTESTS_RUN_CASE(test_odd_size);
+        XTESTS_RUN_CASE(test_try_load_during_write);
+        XTESTS_RUN_CASE(test_lock_scope);
+        XTESTS_RUN_CASE(test_lock_traits);
+        XTESTS_RUN_CASE(test_readers_and_writers);
+
+        XTESTS_PRINT_RESULTS();
+
+        XTESTS_END_RUNNER_UPDATE_EXITCODE(&retCode);
+    }
+
+    return retCode;
+}
+
+
+/* /////////////////////////////////////////////////////////////////////////
+ * test function implementations
+ */
+
+namespace
+{
+
+    struct route
+    {
+        unsigned    dest;
+        unsigned    gateway;
+        unsigned    metric;
+    };
+
+    route make_route(unsigned dest, unsigned gateway, unsigned metric)
+    {
+        route r = { dest, gateway, metric };
+
+        return r;
+    }
+
+    typedef unixstl::seqlock<route>                         seqlock_t;
+
+
+static void test_initial_value()
+{
+    seqlock_t       sl0;
+    seqlock_t       sl1(make_route(1, 2, 3));
+    route const     r0 = sl0.load();
+    route const     r1 = sl1.load();
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, r0.dest);
+    XTESTS_TEST_INTEGER_EQUAL(0u, r0.metric);
+    XTESTS_TEST_INTEGER_EQUAL(1u, r1.dest);
+    XTESTS_TEST_INTEGER_EQUAL(2u, r1.gateway);
+    XTESTS_TEST_INTEGER_EQUAL(3u, r1.metric);
+}
+
+static void test_store_load()
+{
+    seqlock_t   sl;
+
+    sl.store(make_route(10, 20, 30));
+
+    route r = sl.load();
+
+    XTESTS_TEST_INTEGER_EQUAL(10u, r.dest);
+    XTESTS_TEST_INTEGER_EQUAL(20u, r.gateway);
+    XTESTS_TEST_INTEGER_EQUAL(30u, r.metric);
+
+    sl.store(make_route(11, 21, 31));
+
+    XTESTS_TEST_BOOLEAN_TRUE(sl.try_load(r));
+    XTESTS_TEST_INTEGER_EQUAL(11u, r.dest);
+    XTESTS_TEST_INTEGER_EQUAL(31u, r.metric);
+}
+
+static void test_sequence()
+{
+    seqlock_t   sl;
+
+    XTESTS_TEST_INTEGER_EQUAL(0u, sl.sequence());
+
+    sl.store(make_route(1, 1, 1));
+
+    XTESTS_TEST_INTEGER_EQUAL(2u, sl.sequence());
+
+    sl.lock();
+
+    XTESTS_TEST_INTEGER_EQUAL(3u, sl.sequence());
+
+    sl.unlock();
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, sl.sequence());
+}
+
+static void test_odd_size()
+{
+    struct name
+    {
+        char    s[13];
+    };
+
+    name n;
+
+    ::strcpy(n.s, "abcdefghijkl");
+
+    unixstl::seqlock<name>  sl(n);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("abcdefghijkl", sl.load().s);
+
+    ::strcpy(n.s, "xyz");
+    sl.store(n);
+
+    XTESTS_TEST_MULTIBYTE_STRING_EQUAL("xyz", sl.load().s);
+
+    unixstl::seqlock<char>  slc('a');
+
+    slc.store('b');
+
+    XTESTS_TEST_CHARACTER_EQUAL('b', slc.load());
+}
+
+static void test_try_load_during_write()
+{
+    seqlock_t   sl(make_route(1, 2, 3));
+    route       r = make_route(0, 0, 0);
+
+    XTESTS_TEST_BOOLEAN_TRUE(sl.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(sl.try_lock());
+    XTESTS_TEST_BOOLEAN_FALSE(sl.try_load(r));
+
+    // r is unchanged by the failed attempt
+    XTESTS_TEST_INTEGER_EQUAL(0u, r.dest);
+
+    sl.write(make_route(4, 5, 6));
+
+    XTESTS_TEST_BOOLEAN_FALSE(sl.try_load(r));
+
+    sl.unlock();
+
+    XTESTS_TEST_BOOLEAN_TRUE(sl.try_load(r));
+    XTESTS_TEST_INTEGER_EQUAL(4u, r.dest);
+}
+
+static void test_lock_scope()
+{
+    seqlock_t   sl(make_route(1, 2, 3));
+
+    {
+        stlsoft::lock_scope<seqlock_t> scope(sl);
+
+        route r = sl.locked_value();
+
+        XTESTS_TEST_INTEGER_EQUAL(3u, r.metric);
+
+        ++r.metric;
+
+        sl.write(r);
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(4u, sl.load().metric);
+    XTESTS_TEST_INTEGER_EQUAL(2u, sl.sequence());
+}
+
+static void test_lock_traits()
+{
+    seqlock_t   sl(make_route(1, 2, 3));
+
+    {
+        stlsoft::lock_scope<seqlock_t, unixstl::seqlock_lock_traits<route> > scope(sl);
+
+        XTESTS_TEST_BOOLEAN_FALSE(sl.try_lock());
+
+        sl.write(make_route(7, 8, 9));
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(7u, sl.load().dest);
+}
+
+static void test_readers_and_writers()
+{
+    // Writers store routes whose three fields are equal; readers must
+    // never observe them unequal
+
+    seqlock_t                   sl;
+    std::atomic<int>            numTorn(0);
+    std::atomic<bool>           done(false);
+    int const                   numReaders = 4;
+    int const                   numWriters = 2;
+    unsigned const              N = 20000;
+    std::vector<std::thread>    readers;
+    std::vector<std::thread>    writers;
+
+    for (int r = 0; r != numReaders; ++r)
+    {
+        readers.push_back(std::thread([&]() {
+
+            for (; !done.load(); )
+            {
+                route const v = sl.load();
+
+                if (v.dest != v.gateway ||
+                    v.dest != v.metric)
+                {
+                    ++numTorn;
+                }
+            }
+        }));
+    }
+    for (int w = 0; w != numWriters; ++w)
+    {
+        writers.push_back(std::thread([&]() {
+
+            for (unsigned i = 1; i <= N; ++i)
+            {
+                sl.store(make_route(i, i, i));
+            }
+        }));
+    }
+
+    for (size_t t = 0; t != writers.size(); ++t)
+    {
+        writers[t].join();
+    }
+
+    done = true;
+
+    for (size_t t = 0; t != readers.size(); ++t)
+    {
+        readers[t].join();
+    }
+
+    XTESTS_TEST_INTEGER_EQUAL(0, numTorn.load());
+    XTESTS_TEST_INTEGER_EQUAL(N, sl.load().dest);
+    XTESTS_TEST_INTEGER_EQUAL(2u * numWriters * N, sl.sequence());
+}
+} // anonymous namespace
+
+
+/* ///////////////////////////// end of file //////////////////////////// */